@@ -72,6 +72,21 @@ namespace Physics
         //! Returns the list of heights and materials used by the height field.
         //! @return the rows*columns vector of the heights and materials.
         virtual AZStd::vector<Physics::HeightMaterialPoint> GetHeightsAndMaterials() const = 0;
+
+        //! Returns the rectangle of heightfield samples affected by a change in the given region.
+        //! @param region contains the world space AABB of the area of interest.
+        //! @param startColumn contains the index of the first column of the rectangle.
+        //! @param startRow contains the index of the first row of the rectangle.
+        //! @param numColumns contains the number of columns in the rectangle, 0 if the region doesn't overlap the heightfield.
+        //! @param numRows contains the number of rows in the rectangle, 0 if the region doesn't overlap the heightfield.
+        virtual void GetHeightfieldIndicesFromRegion(
+            const AZ::Aabb& region, size_t& startColumn, size_t& startRow, size_t& numColumns, size_t& numRows) const = 0;
+
+        //! Returns the heights and materials for a rectangle of the height field, as returned by GetHeightfieldIndicesFromRegion.
+        //! This allows heightfield consumers to refresh only the part of the data that changed.
+        //! @return the numRows*numColumns vector of the heights and materials in the rectangle.
+        virtual AZStd::vector<Physics::HeightMaterialPoint> GetHeightsAndMaterialsInRegion(
+            size_t startColumn, size_t startRow, size_t numColumns, size_t numRows) const = 0;
     };
 
     using HeightfieldProviderRequestsBus = AZ::EBus<HeightfieldProviderRequests>;
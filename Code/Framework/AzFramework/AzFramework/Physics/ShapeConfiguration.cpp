@@ -418,6 +418,21 @@ namespace Physics
         m_samples = samples;
     }
 
+    void HeightfieldShapeConfiguration::ModifySamples(
+        size_t startColumn, size_t startRow, size_t numColumns, size_t numRows, const AZStd::vector<Physics::HeightMaterialPoint>& samples)
+    {
+        AZ_Assert(samples.size() == numColumns * numRows, "Sample count doesn't match the size of the modified region");
+        AZ_Assert(
+            startColumn + numColumns <= static_cast<size_t>(m_numColumns) && startRow + numRows <= static_cast<size_t>(m_numRows),
+            "Modified region is outside of the heightfield");
+
+        for (size_t row = 0; row < numRows; ++row)
+        {
+            const auto sourceRow = samples.begin() + row * numColumns;
+            AZStd::copy(sourceRow, sourceRow + numColumns, m_samples.begin() + (startRow + row) * m_numColumns + startColumn);
+        }
+    }
+
     float HeightfieldShapeConfiguration::GetMinHeightBounds() const
     {
         return m_minHeightBounds;
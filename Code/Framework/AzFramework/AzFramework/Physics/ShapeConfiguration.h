@@ -229,6 +229,9 @@ namespace Physics
         void SetNumRows(int32_t numRows);
         const AZStd::vector<Physics::HeightMaterialPoint>& GetSamples() const;
         void SetSamples(const AZStd::vector<Physics::HeightMaterialPoint>& samples);
+        //! Replaces the samples of a rectangle of the grid, samples is a numRows*numColumns vector.
+        void ModifySamples(
+            size_t startColumn, size_t startRow, size_t numColumns, size_t numRows, const AZStd::vector<Physics::HeightMaterialPoint>& samples);
         float GetMinHeightBounds() const;
         void SetMinHeightBounds(float minBounds);
         float GetMaxHeightBounds() const;
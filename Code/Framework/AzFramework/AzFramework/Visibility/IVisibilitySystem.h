@@ -72,6 +72,11 @@ namespace AzFramework
         //! @param visibilityEntry data for the object being added/updated
         virtual void InsertOrUpdateEntry(VisibilityEntry& visibilityEntry) = 0;
 
+        //! Insert or update a batch of entries within the visibility system, see InsertOrUpdateEntry().
+        //! The visibility system is locked once for the whole batch instead of once per entry.
+        //! @param visibilityEntries data for the objects being added/updated
+        virtual void InsertOrUpdateEntries(const AZStd::vector<VisibilityEntry*>& visibilityEntries) = 0;
+
         //! Removes an entry from the visibility system.
         //! @param visibilityEntry data for the object being removed
         virtual void RemoveEntry(VisibilityEntry& visibilityEntry) = 0;
@@ -351,6 +351,20 @@ namespace AzFramework
     void OctreeScene::InsertOrUpdateEntry(VisibilityEntry& entry)
     {
         AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        InsertOrUpdateEntryLocked(entry);
+    }
+
+    void OctreeScene::InsertOrUpdateEntries(const AZStd::vector<VisibilityEntry*>& entries)
+    {
+        AZStd::lock_guard<AZStd::shared_mutex> lock(m_sharedMutex);
+        for (VisibilityEntry* entry : entries)
+        {
+            InsertOrUpdateEntryLocked(*entry);
+        }
+    }
+
+    void OctreeScene::InsertOrUpdateEntryLocked(VisibilityEntry& entry)
+    {
         if (entry.m_internalNode != nullptr)
         {
             static_cast<OctreeNode*>(entry.m_internalNode)->Update(*this, &entry);
@@ -103,6 +103,7 @@ namespace AzFramework
         //! @{
         const AZ::Name& GetName() const override;
         void InsertOrUpdateEntry(VisibilityEntry& entry) override;
+        void InsertOrUpdateEntries(const AZStd::vector<VisibilityEntry*>& entries) override;
         void RemoveEntry(VisibilityEntry& entry) override;
         void Enumerate(const AZ::Aabb& aabb, const IVisibilityScene::EnumerateCallback& callback) const override;
         void Enumerate(const AZ::Sphere& sphere, const IVisibilityScene::EnumerateCallback& callback) const override;
@@ -121,6 +122,7 @@ namespace AzFramework
         //! @}
 
     private:
+        void InsertOrUpdateEntryLocked(VisibilityEntry& entry);
         uint32_t AllocateChildNodes();
         void ReleaseChildNodes(uint32_t nodeIndex);
         OctreeNode* GetChildNodesAtIndex(uint32_t nodeIndex) const;
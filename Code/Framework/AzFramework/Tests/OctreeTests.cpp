@@ -236,6 +236,36 @@ namespace UnitTest
         EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1);
     }
 
+    TEST_F(OctreeTests, InsertOrUpdateEntriesBatch)
+    {
+        AzFramework::VisibilityEntry visEntry[3];
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        visEntry[2].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+        AZStd::vector<VisibilityEntry*> entries = { &visEntry[0], &visEntry[1], &visEntry[2] };
+
+        m_octreeScene->InsertOrUpdateEntries(entries);
+        EXPECT_TRUE(visEntry[0].m_internalNode != nullptr);
+        EXPECT_TRUE(visEntry[1].m_internalNode != nullptr);
+        EXPECT_TRUE(visEntry[2].m_internalNode != nullptr);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 3);
+        EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1 + (2 * m_octreeScene->GetChildNodeCount()));
+
+        // Updating the same entries again must move them, not add them a second time
+        visEntry[1].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-0.9f), AZ::Vector3(-0.6f));
+        visEntry[2].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.1f), AZ::Vector3( 0.4f));
+        visEntry[0].m_boundingVolume = AZ::Aabb::CreateFromMinMax(AZ::Vector3( 0.6f), AZ::Vector3( 0.9f));
+        m_octreeScene->InsertOrUpdateEntries(entries);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 3);
+        EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1 + (2 * m_octreeScene->GetChildNodeCount()));
+
+        m_octreeScene->RemoveEntry(visEntry[0]);
+        m_octreeScene->RemoveEntry(visEntry[1]);
+        m_octreeScene->RemoveEntry(visEntry[2]);
+        ValidateEntryCountEqualsExpectedCount(m_octreeScene, 0);
+        EXPECT_TRUE(m_octreeScene->GetNodeCount() == 1);
+    }
+
     void AppendEntries(AZStd::vector<VisibilityEntry*>& gatheredEntries, const AzFramework::IVisibilityScene::NodeData& nodeData)
     {
         gatheredEntries.insert(gatheredEntries.end(), nodeData.m_entries.begin(), nodeData.m_entries.end());
@@ -1291,7 +1291,8 @@ namespace AzToolsFramework
                    m_lastLogTime == other.m_lastLogTime &&
                    AzFramework::StringFunc::Equal(m_lastLogFile.c_str(), other.m_lastLogFile.c_str()) &&
                    m_errorCount == other.m_errorCount &&
-                   m_warningCount == other.m_warningCount;
+                   m_warningCount == other.m_warningCount &&
+                   m_processDurationMs == other.m_processDurationMs;
         }
 
         AZStd::string JobDatabaseEntry::ToString() const
@@ -1320,7 +1321,8 @@ namespace AzToolsFramework
                 MakeColumn("LastLogTime", m_lastLogTime),
                 MakeColumn("LastLogFile", m_lastLogFile),
                 MakeColumn("WarningCount", m_warningCount),
-                MakeColumn("ErrorCount", m_errorCount)
+                MakeColumn("ErrorCount", m_errorCount),
+                MakeColumn("ProcessDurationMs", m_processDurationMs)
             );
         }
 
@@ -1617,13 +1619,15 @@ namespace AzToolsFramework
                 && m_fileName == other.m_fileName
                 && m_isFolder == other.m_isFolder
                 && m_modTime == other.m_modTime
-                && m_hash == other.m_hash;
+                && m_hash == other.m_hash
+                && m_fileSize == other.m_fileSize;
         }
 
         AZStd::string FileDatabaseEntry::ToString() const
         {
-            return AZStd::string::format("FileDatabaseEntry id: %" PRId64 " scanfolderpk: %" PRId64 " filename: %s isfolder: %i modtime: %" PRIu64 " hash: %" PRIu64,
-                static_cast<int64_t>(m_fileID), static_cast<int64_t>(m_scanFolderPK), m_fileName.c_str(), m_isFolder, static_cast<uint64_t>(m_modTime), static_cast<uint64_t>(m_hash));
+            return AZStd::string::format("FileDatabaseEntry id: %" PRId64 " scanfolderpk: %" PRId64 " filename: %s isfolder: %i modtime: %" PRIu64 " hash: %" PRIu64 " filesize: %" PRIu64,
+                static_cast<int64_t>(m_fileID), static_cast<int64_t>(m_scanFolderPK), m_fileName.c_str(), m_isFolder, static_cast<uint64_t>(m_modTime), static_cast<uint64_t>(m_hash),
+                static_cast<uint64_t>(m_fileSize));
         }
 
         auto FileDatabaseEntry::GetColumns()
@@ -1634,7 +1638,8 @@ namespace AzToolsFramework
                 MakeColumn("FileName", m_fileName),
                 MakeColumn("IsFolder", m_isFolder),
                 MakeColumn("ModTime", m_modTime),
-                MakeColumn("Hash", m_hash)
+                MakeColumn("Hash", m_hash),
+                MakeColumn("FileSize", m_fileSize)
             );
         }
 
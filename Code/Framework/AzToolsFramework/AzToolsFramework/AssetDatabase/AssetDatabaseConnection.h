@@ -66,6 +66,8 @@ namespace AzToolsFramework
             ChangedSortFunctionFromQSortToStdStableSort = 30,
             RemoveOutputPrefixFromScanFolders,
             AddedSourceIndexForSourceDependencyTable,
+            AddedFileSizeField,
+            AddedJobProcessDurationField,
             //Add all new versions before this
             DatabaseVersionCount,
             LatestVersion = DatabaseVersionCount - 1
@@ -188,6 +190,7 @@ namespace AzToolsFramework
             AZStd::string m_lastLogFile;
             AZ::u32 m_errorCount = 0;
             AZ::u32 m_warningCount = 0;
+            AZ::s64 m_processDurationMs = 0; ///< wall clock time the last run of this job spent processing, 0 if unknown.
         };
 
         typedef AZStd::vector<JobDatabaseEntry> JobDatabaseEntryContainer;
@@ -391,6 +394,7 @@ namespace AzToolsFramework
             int m_isFolder = 0;
             AZ::u64 m_modTime{};
             AZ::u64 m_hash{};
+            AZ::u64 m_fileSize{};
         };
 
         typedef AZStd::vector<FileDatabaseEntry> FileDatabaseEntryContainer;
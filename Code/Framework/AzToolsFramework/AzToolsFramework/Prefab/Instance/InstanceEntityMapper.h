@@ -11,6 +11,7 @@
 #include <AzCore/Component/EntityId.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceEntityMapperInterface.h>
 namespace AzToolsFramework
 {
@@ -34,6 +35,8 @@ namespace AzToolsFramework
 
         private:
             AZStd::unordered_map<AZ::EntityId, Instance*> m_entityToInstanceMap;
+            // Instances may be loaded on worker threads by the InstanceUpdateExecutor, which registers their entities.
+            mutable AZStd::mutex m_entityToInstanceMapMutex;
         };
     }
 }
@@ -178,7 +178,11 @@ namespace AzToolsFramework
                     (result.GetOutcome() != AZ::JsonSerializationResult::Outcomes::PartialSkip),
                     "Some of the patches were not successfully applied.");
                 m_prefabSystemComponentInterface->SetTemplateDirtyFlag(templateId, true);
-                m_prefabSystemComponentInterface->PropagateTemplateChanges(templateId, immediate, instanceToExclude);
+
+                // Only the values the patch changed need to be copied to the instances linked to the template.
+                PrefabDomPathList changedPaths;
+                PrefabDomUtils::GetPatchChangedPaths(providedPatch, changedPaths);
+                m_prefabSystemComponentInterface->PropagateTemplatePathChanges(templateId, changedPaths, immediate, instanceToExclude);
                 return true;
             }
         }
@@ -9,7 +9,12 @@
 #include <AzToolsFramework/Prefab/Instance/InstanceUpdateExecutor.h>
 
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/Console/IConsole.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzToolsFramework/Entity/EditorEntityContextBus.h>
 #include <AzToolsFramework/Entity/EditorEntityHelpers.h>
 #include <AzToolsFramework/API/ToolsApplicationAPI.h>
@@ -21,10 +26,30 @@
 #include <AzToolsFramework/Prefab/PrefabSystemComponentInterface.h>
 #include <AzToolsFramework/Prefab/Template/Template.h>
 
+AZ_CVAR(
+    bool,
+    ed_prefabParallelInstanceUpdate,
+    false,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Load the instances of changed prefab templates on worker threads. Components that aren't safe to deserialize off the main "
+    "thread must not be used in prefabs when this is enabled.");
+
+AZ_CVAR(
+    int,
+    ed_prefabInstanceUpdateTimeBudgetMs,
+    0,
+    nullptr,
+    AZ::ConsoleFunctorFlags::Null,
+    "Time in milliseconds after which the update of prefab instances continues on the next tick. 0 updates all queued instances at once.");
+
 namespace AzToolsFramework
 {
     namespace Prefab
     {
+        // The instances loaded in parallel before the time budget is checked again.
+        static constexpr unsigned int InstancesPerWorkerInRound = 4;
+
         InstanceUpdateExecutor::InstanceUpdateExecutor(int instanceCountToUpdateInBatch)
             : m_instanceCountToUpdateInBatch(instanceCountToUpdateInBatch)
         { 
@@ -72,22 +97,26 @@ namespace AzToolsFramework
                 instanceToExcludePtr = &(instanceToExclude->get());
             }
 
-            for (auto instance : findInstancesResult->get())
             {
-                if (instance != instanceToExcludePtr)
+                AZStd::lock_guard<AZStd::mutex> lock(m_instancesUpdateQueueMutex);
+                for (auto instance : *findInstancesResult)
                 {
-                    m_instancesUpdateQueue.emplace_back(instance);
+                    if (instance != instanceToExcludePtr)
+                    {
+                        m_instancesUpdateQueue.emplace_back(instance);
+                    }
                 }
             }
 
             if (immediate)
             {
-                UpdateTemplateInstancesInQueue();
+                UpdateTemplateInstancesInQueue(true);
             }
         }
 
         void InstanceUpdateExecutor::RemoveTemplateInstanceFromQueue(const Instance* instance)
         {
+            AZStd::lock_guard<AZStd::mutex> lock(m_instancesUpdateQueueMutex);
             AZStd::erase_if(m_instancesUpdateQueue, [instance](Instance* entry)
             {
                 return entry == instance;
@@ -95,16 +124,38 @@ namespace AzToolsFramework
         }
 
         bool InstanceUpdateExecutor::UpdateTemplateInstancesInQueue()
+        {
+            return UpdateTemplateInstancesInQueue(false);
+        }
+
+        Instance* InstanceUpdateExecutor::PopInstanceFromQueue()
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_instancesUpdateQueueMutex);
+            if (m_instancesUpdateQueue.empty())
+            {
+                return nullptr;
+            }
+
+            Instance* instance = m_instancesUpdateQueue.front();
+            m_instancesUpdateQueue.pop_front();
+            return instance;
+        }
+
+        bool InstanceUpdateExecutor::UpdateTemplateInstancesInQueue(bool isImmediate)
         {
             bool isUpdateSuccessful = true;
             if (!m_updatingTemplateInstancesInQueue)
             {
                 m_updatingTemplateInstancesInQueue = true;
 
+                size_t queueSize = 0;
+                {
+                    AZStd::lock_guard<AZStd::mutex> lock(m_instancesUpdateQueueMutex);
+                    queueSize = m_instancesUpdateQueue.size();
+                }
+
                 const int instanceCountToUpdateInBatch =
-                    m_instanceCountToUpdateInBatch == 0 ? static_cast<int>(m_instancesUpdateQueue.size()) : m_instanceCountToUpdateInBatch;
-                TemplateId currentTemplateId = InvalidTemplateId;
-                TemplateReference currentTemplateReference = AZStd::nullopt;
+                    m_instanceCountToUpdateInBatch == 0 ? static_cast<int>(queueSize) : m_instanceCountToUpdateInBatch;
 
                 if (instanceCountToUpdateInBatch > 0)
                 {
@@ -115,130 +166,74 @@ namespace AzToolsFramework
                     ToolsApplicationRequestBus::BroadcastResult(selectedEntityIds, &ToolsApplicationRequests::GetSelectedEntities);
                     PrefabDom instanceDomFromRootDocument;
 
+                    // Instances are loaded in parallel only if there are workers to load them on.
+                    const bool isParallel = ed_prefabParallelInstanceUpdate && AZ::JobContext::GetGlobalContext() != nullptr;
+                    const size_t instanceCountInRound =
+                        isParallel ? AZStd::max(AZStd::thread::hardware_concurrency(), 1u) * InstancesPerWorkerInRound : 1;
+
+                    // Updates spread over several ticks once they take longer than the budget, unless they were asked for immediately.
+                    const AZStd::chrono::milliseconds timeBudget(isImmediate ? 0 : static_cast<int>(ed_prefabInstanceUpdateTimeBudgetMs));
+                    const AZStd::chrono::system_clock::time_point startTime = AZStd::chrono::system_clock::now();
+
                     // Process all instances in the queue, capped to the batch size.
                     // Even though we potentially initialized the batch size to the queue, it's possible for the queue size to shrink
                     // during instance processing if the instance gets deleted and it was queued multiple times.  To handle this, we
                     // make sure to end the loop once the queue is empty, regardless of what the initial size was.
-                    for (int i = 0; (i < instanceCountToUpdateInBatch) && !m_instancesUpdateQueue.empty(); ++i)
+                    int instanceCountTakenFromQueue = 0;
+                    while (instanceCountTakenFromQueue < instanceCountToUpdateInBatch)
                     {
-                        Instance* instanceToUpdate = m_instancesUpdateQueue.front();
-                        m_instancesUpdateQueue.pop_front();
-                        AZ_Assert(instanceToUpdate != nullptr, "Invalid instance on update queue.");
-
-                        TemplateId instanceTemplateId = instanceToUpdate->GetTemplateId();
-                        if (currentTemplateId != instanceTemplateId)
+                        m_instancesToUpdate.clear();
+                        Instance* instance = nullptr;
+                        while (m_instancesToUpdate.size() < instanceCountInRound &&
+                            instanceCountTakenFromQueue < instanceCountToUpdateInBatch && (instance = PopInstanceFromQueue()) != nullptr)
                         {
-                            currentTemplateId = instanceTemplateId;
-                            currentTemplateReference = m_prefabSystemComponentInterface->FindTemplate(currentTemplateId);
-                            if (!currentTemplateReference.has_value())
-                            {
-                                AZ_Error(
-                                    "Prefab", false,
-                                    "InstanceUpdateExecutor::UpdateTemplateInstancesInQueue - "
-                                    "Could not find Template using Id '%llu'. Unable to update Instance.",
-                                    currentTemplateId);
+                            ++instanceCountTakenFromQueue;
 
-                                // Remove the instance from update queue if its corresponding template couldn't be found
+                            InstanceToUpdate instanceToUpdate;
+                            if (PrepareInstanceToUpdate(instance, instanceToUpdate))
+                            {
+                                m_instancesToUpdate.emplace_back(AZStd::move(instanceToUpdate));
+                            }
+                            else
+                            {
                                 isUpdateSuccessful = false;
-                                continue;
                             }
                         }
 
-                        auto findInstancesResult = m_templateInstanceMapperInterface->FindInstancesOwnedByTemplate(instanceTemplateId);
-                        AZ_Assert(
-                            findInstancesResult.has_value(), "Prefab Instances corresponding to template with id %llu couldn't be found.",
-                            instanceTemplateId);
-
-                        if (findInstancesResult == AZStd::nullopt ||
-                            findInstancesResult->get().find(instanceToUpdate) == findInstancesResult->get().end())
+                        if (m_instancesToUpdate.empty())
                         {
-                            // Since nested instances get reconstructed during propagation, remove any nested instance that no longer
-                            // maps to a template.
-                            isUpdateSuccessful = false;
-                            continue;
+                            break;
                         }
 
-                        Instance::EntityList newEntities;
-
-                        // Climb up to the root of the instance hierarchy from this instance
-                        InstanceOptionalConstReference rootInstance = *instanceToUpdate;
-                        AZStd::vector<InstanceOptionalConstReference> pathOfInstances;
-
-                        while (rootInstance->get().GetParentInstance() != AZStd::nullopt)
+                        if (isParallel)
                         {
-                            pathOfInstances.emplace_back(rootInstance);
-                            rootInstance = rootInstance->get().GetParentInstance();
+                            LoadInstancesInParallel(m_instancesToUpdate);
                         }
-
-                        AZStd::string aliasPathResult = "";
-                        for (auto instanceIter = pathOfInstances.rbegin(); instanceIter != pathOfInstances.rend(); ++instanceIter)
+                        else
                         {
-                            aliasPathResult.append("/Instances/");
-                            aliasPathResult.append((*instanceIter)->get().GetInstanceAlias());
-                        }
-
-                        PrefabDomPath rootPrefabDomPath(aliasPathResult.c_str());
-
-                        PrefabDom& rootPrefabTemplateDom =
-                            m_prefabSystemComponentInterface->FindTemplateDom(rootInstance->get().GetTemplateId());
-
-                        auto instanceDomFromRootValue = rootPrefabDomPath.Get(rootPrefabTemplateDom);
-                        if (!instanceDomFromRootValue)
-                        {
-                            AZ_Assert(
-                                false,
-                                "InstanceUpdateExecutor::UpdateTemplateInstancesInQueue - "
-                                "Could not load Instance DOM from the top level ancestor's DOM.");
-
-                            isUpdateSuccessful = false;
-                            continue;
-                        }
-
-                        PrefabDomValueReference instanceDomFromRoot = *instanceDomFromRootValue;
-                        if (!instanceDomFromRoot.has_value())
-                        {
-                            AZ_Assert(
-                                false,
-                                "InstanceUpdateExecutor::UpdateTemplateInstancesInQueue - "
-                                "Could not load Instance DOM from the top level ancestor's DOM.");
-
-                            isUpdateSuccessful = false;
-                            continue;
-                        }
-
-                        // If a link was created for a nested instance before the changes were propagated,
-                        // then we associate it correctly here
-                        instanceDomFromRootDocument.CopyFrom(instanceDomFromRoot->get(), instanceDomFromRootDocument.GetAllocator());
-                        if (PrefabDomUtils::LoadInstanceFromPrefabDom(*instanceToUpdate, newEntities, instanceDomFromRootDocument))
-                        {
-                            Template& currentTemplate = currentTemplateReference->get();
-                            instanceToUpdate->GetNestedInstances([&](AZStd::unique_ptr<Instance>& nestedInstance) 
+                            for (InstanceToUpdate& instanceToUpdate : m_instancesToUpdate)
                             {
-                                if (nestedInstance->GetLinkId() != InvalidLinkId)
+                                // If a link was created for a nested instance before the changes were propagated,
+                                // then we associate it correctly here
+                                instanceDomFromRootDocument.CopyFrom(*instanceToUpdate.m_instanceDom, instanceDomFromRootDocument.GetAllocator());
+                                if (PrefabDomUtils::LoadInstanceFromPrefabDom(
+                                        *instanceToUpdate.m_instance, instanceToUpdate.m_newEntities, instanceDomFromRootDocument))
                                 {
-                                    return;
-                                }
+                                    AssignLinkIdsToNestedInstances(*instanceToUpdate.m_instance, *instanceToUpdate.m_template);
 
-                                for (auto linkId : currentTemplate.GetLinks())
-                                {
-                                    LinkReference nestedLink = m_prefabSystemComponentInterface->FindLink(linkId);
-                                    if (!nestedLink.has_value())
-                                    {
-                                        continue;
-                                    }
-
-                                    if (nestedLink->get().GetInstanceName() == nestedInstance->GetInstanceAlias())
-                                    {
-                                        nestedInstance->SetLinkId(linkId);
-                                        break;
-                                    }
+                                    AzToolsFramework::EditorEntityContextRequestBus::Broadcast(
+                                        &AzToolsFramework::EditorEntityContextRequests::HandleEntitiesAdded, instanceToUpdate.m_newEntities);
                                 }
-                            });
+                            }
+                        }
 
-                            AzToolsFramework::EditorEntityContextRequestBus::Broadcast(
-                                &AzToolsFramework::EditorEntityContextRequests::HandleEntitiesAdded, newEntities);
+                        if (timeBudget.count() > 0 && AZStd::chrono::system_clock::now() - startTime >= timeBudget)
+                        {
+                            break;
                         }
                     }
+                    m_instancesToUpdate.clear();
+
                     for (auto entityIdIterator = selectedEntityIds.begin(); entityIdIterator != selectedEntityIds.end(); entityIdIterator++)
                     {
                         // Since entities get recreated during propagation, we need to check whether the entities
@@ -260,5 +255,149 @@ namespace AzToolsFramework
 
             return isUpdateSuccessful;
         }
+
+        bool InstanceUpdateExecutor::PrepareInstanceToUpdate(Instance* instance, InstanceToUpdate& instanceToUpdate)
+        {
+            AZ_Assert(instance != nullptr, "Invalid instance on update queue.");
+
+            TemplateId instanceTemplateId = instance->GetTemplateId();
+            TemplateReference instanceTemplateReference = m_prefabSystemComponentInterface->FindTemplate(instanceTemplateId);
+            if (!instanceTemplateReference.has_value())
+            {
+                AZ_Error(
+                    "Prefab", false,
+                    "InstanceUpdateExecutor::UpdateTemplateInstancesInQueue - "
+                    "Could not find Template using Id '%llu'. Unable to update Instance.",
+                    instanceTemplateId);
+
+                // Remove the instance from update queue if its corresponding template couldn't be found
+                return false;
+            }
+
+            if (!m_templateInstanceMapperInterface->IsInstanceOwnedByTemplate(instance, instanceTemplateId))
+            {
+                // Since nested instances get reconstructed during propagation, remove any nested instance that no longer
+                // maps to a template.
+                return false;
+            }
+
+            // Climb up to the root of the instance hierarchy from this instance
+            InstanceOptionalConstReference rootInstance = *instance;
+            AZStd::vector<InstanceOptionalConstReference> pathOfInstances;
+
+            while (rootInstance->get().GetParentInstance() != AZStd::nullopt)
+            {
+                pathOfInstances.emplace_back(rootInstance);
+                rootInstance = rootInstance->get().GetParentInstance();
+            }
+
+            AZStd::string aliasPathResult = "";
+            for (auto instanceIter = pathOfInstances.rbegin(); instanceIter != pathOfInstances.rend(); ++instanceIter)
+            {
+                aliasPathResult.append("/Instances/");
+                aliasPathResult.append((*instanceIter)->get().GetInstanceAlias());
+            }
+
+            PrefabDomPath rootPrefabDomPath(aliasPathResult.c_str());
+
+            PrefabDom& rootPrefabTemplateDom =
+                m_prefabSystemComponentInterface->FindTemplateDom(rootInstance->get().GetTemplateId());
+
+            auto instanceDomFromRootValue = rootPrefabDomPath.Get(rootPrefabTemplateDom);
+            if (!instanceDomFromRootValue)
+            {
+                AZ_Assert(
+                    false,
+                    "InstanceUpdateExecutor::UpdateTemplateInstancesInQueue - "
+                    "Could not load Instance DOM from the top level ancestor's DOM.");
+
+                return false;
+            }
+
+            instanceToUpdate.m_instance = instance;
+            instanceToUpdate.m_templateId = instanceTemplateId;
+            instanceToUpdate.m_template = &instanceTemplateReference->get();
+            instanceToUpdate.m_instanceDom = instanceDomFromRootValue;
+            return true;
+        }
+
+        void InstanceUpdateExecutor::LoadInstancesInParallel(AZStd::vector<InstanceToUpdate>& instancesToUpdate)
+        {
+            for (InstanceToUpdate& instanceToUpdate : instancesToUpdate)
+            {
+                // Destroying the nested instances of an instance may destroy instances that are to be updated after it. Those are
+                // unregistered from their template, and are skipped below.
+                if (m_templateInstanceMapperInterface->IsInstanceOwnedByTemplate(instanceToUpdate.m_instance, instanceToUpdate.m_templateId))
+                {
+                    Instance& instance = *instanceToUpdate.m_instance;
+                    instance.DetachNestedInstances([](AZStd::unique_ptr<Instance>) {});
+                    instance.DetachEntities([](AZStd::unique_ptr<AZ::Entity>) {});
+                    instance.DetachContainerEntity();
+                }
+            }
+
+            AZStd::erase_if(instancesToUpdate, [this](const InstanceToUpdate& instanceToUpdate)
+            {
+                return !m_templateInstanceMapperInterface->IsInstanceOwnedByTemplate(instanceToUpdate.m_instance, instanceToUpdate.m_templateId);
+            });
+
+            AZ::JobCompletion jobCompletion;
+            for (InstanceToUpdate& instanceToUpdate : instancesToUpdate)
+            {
+                AZ::Job* job = AZ::CreateJobFunction(
+                    [&instanceToUpdate]()
+                    {
+                        PrefabDom instanceDom;
+                        instanceDom.CopyFrom(*instanceToUpdate.m_instanceDom, instanceDom.GetAllocator());
+                        instanceToUpdate.m_isLoaded = PrefabDomUtils::LoadInstanceFromPrefabDom(
+                            *instanceToUpdate.m_instance, instanceToUpdate.m_newEntities, instanceDom);
+                    },
+                    true);
+                job->SetDependent(&jobCompletion);
+                job->Start();
+            }
+            jobCompletion.StartAndWaitForCompletion();
+
+            // If a link was created for a nested instance before the changes were propagated,
+            // then we associate it correctly here
+            Instance::EntityList newEntities;
+            for (InstanceToUpdate& instanceToUpdate : instancesToUpdate)
+            {
+                if (instanceToUpdate.m_isLoaded)
+                {
+                    AssignLinkIdsToNestedInstances(*instanceToUpdate.m_instance, *instanceToUpdate.m_template);
+                    newEntities.insert(newEntities.end(), instanceToUpdate.m_newEntities.begin(), instanceToUpdate.m_newEntities.end());
+                }
+            }
+
+            AzToolsFramework::EditorEntityContextRequestBus::Broadcast(
+                &AzToolsFramework::EditorEntityContextRequests::HandleEntitiesAdded, newEntities);
+        }
+
+        void InstanceUpdateExecutor::AssignLinkIdsToNestedInstances(Instance& instance, const Template& instanceTemplate)
+        {
+            instance.GetNestedInstances([&](AZStd::unique_ptr<Instance>& nestedInstance)
+            {
+                if (nestedInstance->GetLinkId() != InvalidLinkId)
+                {
+                    return;
+                }
+
+                for (auto linkId : instanceTemplate.GetLinks())
+                {
+                    LinkReference nestedLink = m_prefabSystemComponentInterface->FindLink(linkId);
+                    if (!nestedLink.has_value())
+                    {
+                        continue;
+                    }
+
+                    if (nestedLink->get().GetInstanceName() == nestedInstance->GetInstanceAlias())
+                    {
+                        nestedInstance->SetLinkId(linkId);
+                        break;
+                    }
+                }
+            });
+        }
     }
 }
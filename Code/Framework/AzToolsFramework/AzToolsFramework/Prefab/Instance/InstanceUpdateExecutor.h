@@ -11,7 +11,10 @@
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 #include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzToolsFramework/Prefab/Instance/InstanceUpdateExecutorInterface.h>
+#include <AzToolsFramework/Prefab/PrefabDomTypes.h>
 #include <AzToolsFramework/Prefab/PrefabIdTypes.h>
 
 namespace AzToolsFramework
@@ -20,6 +23,7 @@ namespace AzToolsFramework
     {
         class Instance;
         class PrefabSystemComponentInterface;
+        class Template;
         class TemplateInstanceMapperInterface;
 
         class InstanceUpdateExecutor
@@ -39,10 +43,38 @@ namespace AzToolsFramework
             void UnregisterInstanceUpdateExecutorInterface();
 
         private:
+            // An instance that was taken off the queue, whose DOM was found in the DOM of the template of its root instance.
+            struct InstanceToUpdate
+            {
+                Instance* m_instance = nullptr;
+                TemplateId m_templateId = InvalidTemplateId;
+                Template* m_template = nullptr;
+                const PrefabDomValue* m_instanceDom = nullptr;
+                Instance::EntityList m_newEntities;
+                bool m_isLoaded = false;
+            };
+
+            bool UpdateTemplateInstancesInQueue(bool isImmediate);
+
+            // Takes the next instance off the queue, or returns nullptr when the queue is empty.
+            Instance* PopInstanceFromQueue();
+
+            // Validates the instance and finds its DOM. Returns false if the instance can't be updated.
+            bool PrepareInstanceToUpdate(Instance* instance, InstanceToUpdate& instanceToUpdate);
+
+            // Loads the instances on worker threads. Their entities and nested instances are destroyed first on this thread, as
+            // destroying entities isn't safe elsewhere. The new entities are added to the editor entity context in one call.
+            void LoadInstancesInParallel(AZStd::vector<InstanceToUpdate>& instancesToUpdate);
+
+            void AssignLinkIdsToNestedInstances(Instance& instance, const Template& instanceTemplate);
+
             PrefabSystemComponentInterface* m_prefabSystemComponentInterface = nullptr;
             TemplateInstanceMapperInterface* m_templateInstanceMapperInterface = nullptr;
             int m_instanceCountToUpdateInBatch = 0;
             AZStd::deque<Instance*> m_instancesUpdateQueue;
+            // Instances loaded on worker threads create nested instances, which removes them from the queue.
+            AZStd::mutex m_instancesUpdateQueueMutex;
+            AZStd::vector<InstanceToUpdate> m_instancesToUpdate;
             bool m_updatingTemplateInstancesInQueue { false };
         };
     }
@@ -29,6 +29,7 @@ namespace AzToolsFramework
 
         bool TemplateInstanceMapper::RegisterTemplate(TemplateId templateId)
         {
+            AZStd::lock_guard<AZStd::mutex> lock(m_templateIdToInstancesMapMutex);
             const bool result = m_templateIdToInstancesMap.emplace(templateId, InstanceSet()).second;
             AZ_Assert(result,
                 "Prefab - PrefabSystemComponent::RegisterTemplate - "
@@ -41,6 +42,7 @@ namespace AzToolsFramework
 
         bool TemplateInstanceMapper::UnregisterTemplate(TemplateId templateId)
         {
+            AZStd::lock_guard<AZStd::mutex> lock(m_templateIdToInstancesMapMutex);
             const bool result = m_templateIdToInstancesMap.erase(templateId) != 0;
             AZ_Assert(result,
                 "Prefab - PrefabSystemComponent::UnregisterTemplate - "
@@ -60,6 +62,7 @@ namespace AzToolsFramework
             }
             else
             {
+                AZStd::lock_guard<AZStd::mutex> lock(m_templateIdToInstancesMapMutex);
                 auto found = m_templateIdToInstancesMap.find(templateId);
                 return found != m_templateIdToInstancesMap.end() &&
                     found->second.emplace(&instance).second;
@@ -74,13 +77,15 @@ namespace AzToolsFramework
             AZ_Assert(AZ::Interface<InstanceUpdateExecutorInterface>::Get() != nullptr, "InstanceUpdateExecutor doesn't exist");
             AZ::Interface<InstanceUpdateExecutorInterface>::Get()->RemoveTemplateInstanceFromQueue(&instance);
 
+            AZStd::lock_guard<AZStd::mutex> lock(m_templateIdToInstancesMapMutex);
             auto found = m_templateIdToInstancesMap.find(instance.GetTemplateId());
             return found != m_templateIdToInstancesMap.end() &&
                 found->second.erase(&instance) != 0;
         }
 
-        InstanceSetConstReference TemplateInstanceMapper::FindInstancesOwnedByTemplate(TemplateId templateId) const
+        AZStd::optional<InstanceSet> TemplateInstanceMapper::FindInstancesOwnedByTemplate(TemplateId templateId) const
         {
+            AZStd::lock_guard<AZStd::mutex> lock(m_templateIdToInstancesMapMutex);
             auto found = m_templateIdToInstancesMap.find(templateId);
 
             if (found != m_templateIdToInstancesMap.end())
@@ -92,5 +97,13 @@ namespace AzToolsFramework
                 return AZStd::nullopt;
             }
         }
+
+        bool TemplateInstanceMapper::IsInstanceOwnedByTemplate(Instance* instance, TemplateId templateId) const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_templateIdToInstancesMapMutex);
+            auto found = m_templateIdToInstancesMap.find(templateId);
+            return found != m_templateIdToInstancesMap.end() &&
+                found->second.contains(instance);
+        }
     }
 }
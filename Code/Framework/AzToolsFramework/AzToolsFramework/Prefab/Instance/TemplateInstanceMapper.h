@@ -10,6 +10,7 @@
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
 #include <AzToolsFramework/Prefab/Instance/TemplateInstanceMapperInterface.h>
 
 namespace AzToolsFramework
@@ -26,7 +27,8 @@ namespace AzToolsFramework
             TemplateInstanceMapper();
             ~TemplateInstanceMapper() override;
 
-            InstanceSetConstReference FindInstancesOwnedByTemplate(TemplateId templateId) const override;
+            AZStd::optional<InstanceSet> FindInstancesOwnedByTemplate(TemplateId templateId) const override;
+            bool IsInstanceOwnedByTemplate(Instance* instance, TemplateId templateId) const override;
 
             bool RegisterTemplate(TemplateId templateId);
             bool UnregisterTemplate(TemplateId templateId);
@@ -37,6 +39,8 @@ namespace AzToolsFramework
 
         private:
             AZStd::unordered_map<TemplateId, InstanceSet> m_templateIdToInstancesMap;
+            // Nested instances may be created on worker threads by the InstanceUpdateExecutor, which registers them.
+            mutable AZStd::mutex m_templateIdToInstancesMapMutex;
         };
     }
 }
@@ -24,7 +24,10 @@ namespace AzToolsFramework
             AZ_RTTI(TemplateInstanceMapperInterface, "{5DCCCDAA-3441-4266-9670-B349386E0129}");
 
             virtual ~TemplateInstanceMapperInterface() = default;
-            virtual InstanceSetConstReference FindInstancesOwnedByTemplate(TemplateId templateId) const = 0;
+            //! Returns a copy of the instances of the template, since instances can be registered from other threads.
+            virtual AZStd::optional<InstanceSet> FindInstancesOwnedByTemplate(TemplateId templateId) const = 0;
+            //! Returns whether the instance is registered to the template, without copying the instances of the template.
+            virtual bool IsInstanceOwnedByTemplate(Instance* instance, TemplateId templateId) const = 0;
 
         protected:
             // Only the Instance class is allowed to register and unregister Instances.
@@ -213,6 +213,151 @@ namespace AzToolsFramework
             return true;
         }
 
+        bool Link::UpdateTarget(const PrefabDomPathList& changedSourcePaths, PrefabDomPathList& changedTargetPaths)
+        {
+            const AZStd::string instancePath = GetInstancePathString();
+
+            auto updateFullTarget = [this, &instancePath, &changedTargetPaths]()
+            {
+                PrefabDomValue& linkedInstanceDom = GetLinkedInstanceDom();
+                PrefabDom& targetTemplatePrefabDom = m_prefabSystemComponentInterface->FindTemplateDom(m_targetTemplateId);
+                PrefabDomValue linkedInstanceDomBeforeUpdate;
+                linkedInstanceDomBeforeUpdate.CopyFrom(linkedInstanceDom, targetTemplatePrefabDom.GetAllocator());
+
+                const bool result = UpdateTarget();
+                if (AZ::JsonSerialization::Compare(linkedInstanceDomBeforeUpdate, GetLinkedInstanceDom()) !=
+                    AZ::JsonSerializerCompareResult::Equal)
+                {
+                    changedTargetPaths.push_back(instancePath);
+                }
+                return result;
+            };
+
+            // The patches of this link that are under each changed path have to be applied again once the source values are copied.
+            // A patch that is on a changed path or one of its ancestors, or that is only partly under a changed path, can't be
+            // applied to the changed values alone.
+            AZStd::vector<AZStd::vector<const PrefabDomValue*>> patchesPerChangedPath(changedSourcePaths.size());
+            PrefabDomValueReference patchesReference = GetLinkPatches();
+            if (patchesReference.has_value() && patchesReference->get().IsArray())
+            {
+                PrefabDomPathList patchPaths;
+                for (const PrefabDomValue& patch : patchesReference->get().GetArray())
+                {
+                    patchPaths.clear();
+                    PrefabDomUtils::GetPatchChangedPaths(patch, patchPaths);
+
+                    for (size_t changedPathIndex = 0; changedPathIndex < changedSourcePaths.size(); ++changedPathIndex)
+                    {
+                        const AZStd::string& changedPath = changedSourcePaths[changedPathIndex];
+                        size_t patchPathsUnderChangedPath = 0;
+                        for (const AZStd::string& patchPath : patchPaths)
+                        {
+                            if (PrefabDomUtils::IsPathPrefix(patchPath, changedPath))
+                            {
+                                return updateFullTarget();
+                            }
+                            if (PrefabDomUtils::IsPathPrefix(changedPath, patchPath))
+                            {
+                                ++patchPathsUnderChangedPath;
+                            }
+                        }
+
+                        if (patchPathsUnderChangedPath == patchPaths.size())
+                        {
+                            patchesPerChangedPath[changedPathIndex].push_back(&patch);
+                        }
+                        else if (patchPathsUnderChangedPath > 0)
+                        {
+                            return updateFullTarget();
+                        }
+                    }
+                }
+            }
+            else if (patchesReference.has_value())
+            {
+                return updateFullTarget();
+            }
+
+            for (const AZStd::string& changedPath : changedSourcePaths)
+            {
+                if (changedPath.empty())
+                {
+                    return updateFullTarget();
+                }
+            }
+
+            PrefabDomValue& linkedInstanceDom = GetLinkedInstanceDom();
+            PrefabDom& targetTemplatePrefabDom = m_prefabSystemComponentInterface->FindTemplateDom(m_targetTemplateId);
+            const PrefabDom& sourceTemplatePrefabDom = m_prefabSystemComponentInterface->FindTemplateDom(m_sourceTemplateId);
+            PrefabDom::AllocatorType& allocator = targetTemplatePrefabDom.GetAllocator();
+
+            bool result = true;
+            for (size_t changedPathIndex = 0; changedPathIndex < changedSourcePaths.size(); ++changedPathIndex)
+            {
+                const AZStd::string& changedPath = changedSourcePaths[changedPathIndex];
+                const AZStd::vector<const PrefabDomValue*>& patches = patchesPerChangedPath[changedPathIndex];
+
+                PrefabDomPath path(changedPath.c_str(), changedPath.size());
+                if (!path.IsValid())
+                {
+                    return updateFullTarget();
+                }
+
+                const PrefabDomValue* sourceValue = path.Get(sourceTemplatePrefabDom);
+                const PrefabDomValue* targetValue = path.Get(linkedInstanceDom);
+
+                // Without overrides, a value that already matches its source is left alone, and doesn't need to be propagated.
+                if (patches.empty())
+                {
+                    if (!sourceValue && !targetValue)
+                    {
+                        continue;
+                    }
+                    if (sourceValue && targetValue &&
+                        AZ::JsonSerialization::Compare(*sourceValue, *targetValue) == AZ::JsonSerializerCompareResult::Equal)
+                    {
+                        continue;
+                    }
+                }
+
+                if (sourceValue)
+                {
+                    PrefabDomValue sourceValueCopy(*sourceValue, allocator);
+                    path.Set(linkedInstanceDom, sourceValueCopy, allocator);
+                }
+                else if (targetValue)
+                {
+                    path.Erase(linkedInstanceDom);
+                }
+
+                if (!patches.empty())
+                {
+                    PrefabDomValue patchesUnderPath(rapidjson::kArrayType);
+                    for (const PrefabDomValue* patch : patches)
+                    {
+                        patchesUnderPath.PushBack(PrefabDomValue(*patch, allocator), allocator);
+                    }
+
+                    AZ::JsonSerializationResult::ResultCode applyPatchResult =
+                        PrefabDomUtils::ApplyPatches(linkedInstanceDom, allocator, patchesUnderPath);
+                    if (applyPatchResult.GetProcessing() != AZ::JsonSerializationResult::Processing::Completed)
+                    {
+                        AZ_Error(
+                            "Prefab", false,
+                            "Link::UpdateTarget - ApplyPatches failed under '%s' for Prefab DOM from source Template '%u' and target Template '%u'.",
+                            changedPath.c_str(), m_sourceTemplateId, m_targetTemplateId);
+                        result = false;
+                    }
+                }
+
+                changedTargetPaths.push_back(instancePath + changedPath);
+            }
+
+            // This is a guardrail to ensure the linked instance dom always has the LinkId value.
+            AddLinkIdToInstanceDom(linkedInstanceDom, allocator);
+            return result;
+        }
+
         PrefabDomValue& Link::GetLinkedInstanceDom()
         {
             AZ_Assert(IsValid(), "Link::GetLinkDom - Trying to get DOM of an invalid link.");
@@ -249,5 +394,10 @@ namespace AzToolsFramework
             return PrefabDomUtils::FindPrefabDomValue(m_linkDom, PrefabDomUtils::PatchesName);
         }
 
+        AZStd::string Link::GetInstancePathString() const
+        {
+            return AZStd::string::format("/%s/%s", PrefabDomUtils::InstancesName, m_instanceName.c_str());
+        }
+
     } // namespace Prefab
 } // namespace AzToolsFramework
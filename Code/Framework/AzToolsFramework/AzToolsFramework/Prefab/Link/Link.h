@@ -61,6 +61,18 @@ namespace AzToolsFramework
 
             bool UpdateTarget();
 
+            /**
+             * Updates the linked instance DOM after the values at the given paths of the source template changed.
+             * Only those values are copied from the source template, and only the patches of this link under them are applied again.
+             * If a patch of this link could be affected in another way, e.g. it is on a value containing a changed path, this falls
+             * back to the full UpdateTarget().
+             *
+             * @param changedSourcePaths The paths that changed in the source template DOM.
+             * @param[out] changedTargetPaths The paths that changed in the target template DOM are appended to this list.
+             * @return False if the patches of the link couldn't be applied.
+             */
+            bool UpdateTarget(const PrefabDomPathList& changedSourcePaths, PrefabDomPathList& changedTargetPaths);
+
             /**
              * Get the DOM of the instance that the link points to.
              * 
@@ -77,6 +89,9 @@ namespace AzToolsFramework
 
             PrefabDomValueReference GetLinkPatches();
 
+            //! The path of the linked instance in the target template DOM, as a string.
+            AZStd::string GetInstancePathString() const;
+
         private:
 
             /**
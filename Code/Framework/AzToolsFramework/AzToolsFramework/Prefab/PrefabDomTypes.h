@@ -12,6 +12,7 @@
 #include <AzCore/JSON/pointer.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/optional.h>
+#include <AzCore/std/string/string.h>
 
 namespace AzToolsFramework
 {
@@ -21,6 +22,8 @@ namespace AzToolsFramework
         using PrefabDomValue = rapidjson::Value;
         using PrefabDomPath = rapidjson::Pointer;
         using PrefabDomList = AZStd::vector<PrefabDom>;
+        //! JSON pointer strings of DOM values, e.g. "/Entities/Entity_[1]/Components". The empty string is the whole DOM.
+        using PrefabDomPathList = AZStd::vector<AZStd::string>;
 
         using PrefabDomReference = AZStd::optional<AZStd::reference_wrapper<PrefabDom>>;
         using PrefabDomConstReference = AZStd::optional<AZStd::reference_wrapper<const PrefabDom>>;
@@ -9,6 +9,7 @@
 #include <AzCore/Asset/AssetManager.h>
 #include <AzCore/Asset/AssetJsonSerializer.h>
 #include <AzCore/JSON/prettywriter.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 
 #include <AzToolsFramework/Entity/EditorEntityContextBus.h>
@@ -359,6 +360,85 @@ namespace AzToolsFramework
                     prefabDomToApplyPatchesOn, allocator, patches, AZ::JsonMergeApproach::JsonPatch, applyPatchSettings);
             }
 
+            namespace Internal
+            {
+                // Paths of array elements end in an index, or in "-" for the end of the array
+                bool IsArrayElementPath(AZStd::string_view path)
+                {
+                    const size_t lastSeparator = path.rfind('/');
+                    if (lastSeparator == AZStd::string_view::npos || lastSeparator + 1 == path.size())
+                    {
+                        return false;
+                    }
+
+                    AZStd::string_view lastToken = path.substr(lastSeparator + 1);
+                    return lastToken == "-" || AZStd::all_of(lastToken.begin(), lastToken.end(), [](char c) { return c >= '0' && c <= '9'; });
+                }
+
+                AZStd::string_view GetParentPath(AZStd::string_view path)
+                {
+                    const size_t lastSeparator = path.rfind('/');
+                    return lastSeparator == AZStd::string_view::npos ? AZStd::string_view() : path.substr(0, lastSeparator);
+                }
+
+                void AddPatchOperationChangedPaths(const PrefabDomValue& patch, PrefabDomPathList& changedPaths)
+                {
+                    PrefabDomValueConstReference operation = FindPrefabDomValue(patch, "op");
+                    PrefabDomValueConstReference path = FindPrefabDomValue(patch, "path");
+                    if (!operation || !operation->get().IsString() || !path || !path->get().IsString())
+                    {
+                        changedPaths.emplace_back();
+                        return;
+                    }
+
+                    const AZStd::string_view operationName(operation->get().GetString(), operation->get().GetStringLength());
+                    if (operationName == "test")
+                    {
+                        return;
+                    }
+
+                    const bool changesArrayLayout = operationName == "add" || operationName == "remove" || operationName == "move" ||
+                        operationName == "copy";
+                    auto addPath = [&changedPaths, changesArrayLayout](AZStd::string_view changedPath)
+                    {
+                        changedPaths.emplace_back(changesArrayLayout && IsArrayElementPath(changedPath) ? GetParentPath(changedPath) : changedPath);
+                    };
+
+                    addPath(AZStd::string_view(path->get().GetString(), path->get().GetStringLength()));
+
+                    // A move also removes the value it moves
+                    PrefabDomValueConstReference from = FindPrefabDomValue(patch, "from");
+                    if (operationName == "move" && from && from->get().IsString())
+                    {
+                        addPath(AZStd::string_view(from->get().GetString(), from->get().GetStringLength()));
+                    }
+                }
+            }
+
+            void GetPatchChangedPaths(const PrefabDomValue& patches, PrefabDomPathList& changedPaths)
+            {
+                if (patches.IsArray())
+                {
+                    for (const PrefabDomValue& patch : patches.GetArray())
+                    {
+                        Internal::AddPatchOperationChangedPaths(patch, changedPaths);
+                    }
+                }
+                else if (patches.IsObject())
+                {
+                    Internal::AddPatchOperationChangedPaths(patches, changedPaths);
+                }
+                else
+                {
+                    changedPaths.emplace_back();
+                }
+            }
+
+            bool IsPathPrefix(AZStd::string_view prefixPath, AZStd::string_view path)
+            {
+                return path.starts_with(prefixPath) && (path.size() == prefixPath.size() || path[prefixPath.size()] == '/');
+            }
+
             void PrintPrefabDomValue(
                 [[maybe_unused]] const AZStd::string_view printMessage,
                 [[maybe_unused]] const PrefabDomValue& prefabDomValue)
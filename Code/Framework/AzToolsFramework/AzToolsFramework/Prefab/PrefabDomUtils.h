@@ -145,6 +145,20 @@ namespace AzToolsFramework
                 PrefabDom::AllocatorType& allocator,
                 const PrefabDomValue& patches);
 
+            /**
+             * Gets the paths of the DOM values that a JSON patch changes, in the DOM the patch is applied to.
+             * Adding or removing an array element shifts the elements after it, so for those the path of the array is used.
+             * @param patches A single patch operation or an array of them.
+             * @param[out] changedPaths The paths are appended to this list. A patch that can't be read adds the whole DOM ("").
+             */
+            void GetPatchChangedPaths(const PrefabDomValue& patches, PrefabDomPathList& changedPaths);
+
+            /**
+             * Checks whether a path is the same as another path or one of its ancestors, comparing whole path tokens.
+             * @return True if prefixPath is "", equal to path, or the path of a value containing the value at path.
+             */
+            bool IsPathPrefix(AZStd::string_view prefixPath, AZStd::string_view path);
+
             /**
              * Prints the contents of the given prefab DOM value to the debug output console in a readable format.
              * @param printMessage The message that will be printed before printing the PrefabDomValue
@@ -161,6 +161,12 @@ namespace AzToolsFramework
         }
         
         void PrefabSystemComponent::PropagateTemplateChanges(TemplateId templateId, bool immediate, InstanceOptionalReference instanceToExclude)
+        {
+            PropagateTemplatePathChanges(templateId, PrefabDomPathList{ "" }, immediate, instanceToExclude);
+        }
+
+        void PrefabSystemComponent::PropagateTemplatePathChanges(
+            TemplateId templateId, const PrefabDomPathList& changedPaths, bool immediate, InstanceOptionalReference instanceToExclude)
         {
             UpdatePrefabInstances(templateId, immediate, instanceToExclude);
 
@@ -172,7 +178,10 @@ namespace AzToolsFramework
                 AZStd::queue<LinkIds> linkIdsToUpdateQueue;
                 linkIdsToUpdateQueue.push(LinkIds(templateIdToLinkIdsIterator->second.begin(),
                     templateIdToLinkIdsIterator->second.end()));
-                UpdateLinkedInstances(linkIdsToUpdateQueue);
+
+                TemplateIdToChangedPathsMap templateIdToChangedPathsMap;
+                templateIdToChangedPathsMap.emplace(templateId, changedPaths);
+                UpdateLinkedInstances(linkIdsToUpdateQueue, templateIdToChangedPathsMap);
             }
         }
 
@@ -196,7 +205,7 @@ namespace AzToolsFramework
             m_instanceUpdateExecutor.AddTemplateInstancesToQueue(templateId, immediate, instanceToExclude);
         }
 
-        void PrefabSystemComponent::UpdateLinkedInstances(AZStd::queue<LinkIds>& linkIdsQueue)
+        void PrefabSystemComponent::UpdateLinkedInstances(AZStd::queue<LinkIds>& linkIdsQueue, TemplateIdToChangedPathsMap& changedPaths)
         {
             while (!linkIdsQueue.empty())
             {
@@ -209,7 +218,7 @@ namespace AzToolsFramework
                 // This will ensure that templates are updated with changes in the same order they are received.
                 for (const LinkId& linkIdToUpdate : LinkIdsToUpdate)
                 {
-                    UpdateLinkedInstance(linkIdToUpdate, targetTemplateIdToLinkIdMap, linkIdsQueue);
+                    UpdateLinkedInstance(linkIdToUpdate, targetTemplateIdToLinkIdMap, linkIdsQueue, changedPaths);
                 }
                 linkIdsQueue.pop();
             }
@@ -235,20 +244,23 @@ namespace AzToolsFramework
         }
 
         void PrefabSystemComponent::UpdateLinkedInstance(const LinkId linkIdToUpdate,
-            TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap, AZStd::queue<LinkIds>& linkIdsQueue)
+            TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap, AZStd::queue<LinkIds>& linkIdsQueue,
+            TemplateIdToChangedPathsMap& changedPaths)
         {
             Link& linkToUpdate = m_linkIdMap[linkIdToUpdate];
             TemplateId targetTemplateId = linkToUpdate.GetTargetTemplateId();
-            PrefabDomValue& linkdedInstanceDom = linkToUpdate.GetLinkedInstanceDom();
-            PrefabDomValue linkDomBeforeUpdate;
-            linkDomBeforeUpdate.CopyFrom(linkdedInstanceDom, m_templateIdMap[targetTemplateId].GetPrefabDom().GetAllocator());
-            linkToUpdate.UpdateTarget();
-
-            // If any of the templates links are already updated, we don't need to check whether the linkedInstance DOM differs
-            // in content because the template is already marked to be sent for change propagation.
-            bool isTemplateUpdated = targetTemplateIdToLinkIdMap[targetTemplateId].second;
-            if (isTemplateUpdated ||
-                AZ::JsonSerialization::Compare(linkDomBeforeUpdate, linkdedInstanceDom) != AZ::JsonSerializerCompareResult::Equal)
+
+            // A source template without changed paths is one that changed as a whole, e.g. from a link update that fell back
+            // to copying the whole linked instance.
+            // The paths are copied, as adding the changed paths of the target may rehash the map.
+            auto sourceChangedPathsIterator = changedPaths.find(linkToUpdate.GetSourceTemplateId());
+            const PrefabDomPathList changedSourcePaths =
+                sourceChangedPathsIterator != changedPaths.end() ? sourceChangedPathsIterator->second : PrefabDomPathList{ "" };
+            PrefabDomPathList& changedTargetPaths = changedPaths[targetTemplateId];
+            const size_t changedTargetPathCount = changedTargetPaths.size();
+            linkToUpdate.UpdateTarget(changedSourcePaths, changedTargetPaths);
+
+            if (changedTargetPaths.size() != changedTargetPathCount)
             {
                 targetTemplateIdToLinkIdMap[targetTemplateId].second = true;
             }
@@ -56,6 +56,7 @@ namespace AzToolsFramework
         public:
 
             using TargetTemplateIdToLinkIdMap = AZStd::unordered_map<TemplateId, AZStd::pair<AZStd::unordered_set<LinkId>, bool>>;
+            using TemplateIdToChangedPathsMap = AZStd::unordered_map<TemplateId, PrefabDomPathList>;
             
             AZ_COMPONENT(PrefabSystemComponent, "{27203AE6-A398-4614-881B-4EEB5E9B34E9}");
 
@@ -233,6 +234,9 @@ namespace AzToolsFramework
 
             void PropagateTemplateChanges(TemplateId templateId, bool immediate = false, InstanceOptionalReference instanceToExclude = AZStd::nullopt) override;
 
+            void PropagateTemplatePathChanges(TemplateId templateId, const PrefabDomPathList& changedPaths, bool immediate = false,
+                InstanceOptionalReference instanceToExclude = AZStd::nullopt) override;
+
             /**
              * Updates all Instances owned by a Template.
              *
@@ -266,8 +270,9 @@ namespace AzToolsFramework
              * Queue gets populated with more linkId lists as linked instances are updated. Updating stops when the queue is empty.
              * 
              * @param linkIdsQueue A queue of vector of link-Ids to update.
+             * @param changedPaths The paths that changed in each template DOM. A template without an entry changed as a whole.
              */
-            void UpdateLinkedInstances(AZStd::queue<LinkIds>& linkIdsQueue);
+            void UpdateLinkedInstances(AZStd::queue<LinkIds>& linkIdsQueue, TemplateIdToChangedPathsMap& changedPaths);
 
             /**
              * Given a vector of link ids to update, splits them into smaller lists based on the target template id of the links.
@@ -287,9 +292,10 @@ namespace AzToolsFramework
              * @param targetTemplateIdToLinkIdMap The map of target templateIds to a pair of lists of linkIds and a bool flag indicating
              *                                    whether any of the instances of the target template were updated.
              * @param linkIdsQueue A queue of vector of link-Ids to update.
+             * @param changedPaths The paths that changed in each template DOM. The paths that change in the target template are added.
              */
             void UpdateLinkedInstance(const LinkId linkIdToUpdate, TargetTemplateIdToLinkIdMap& targetTemplateIdToLinkIdMap,
-                AZStd::queue<LinkIds>& linkIdsQueue);
+                AZStd::queue<LinkIds>& linkIdsQueue, TemplateIdToChangedPathsMap& changedPaths);
 
             /**
              * If all linked instances of a target template are updated and if the content of any of the linked instances changed,
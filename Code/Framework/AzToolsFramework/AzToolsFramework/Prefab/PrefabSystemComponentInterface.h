@@ -68,6 +68,10 @@ namespace AzToolsFramework
             virtual PrefabDom& FindTemplateDom(TemplateId templateId) = 0;
             virtual void UpdatePrefabTemplate(TemplateId templateId, const PrefabDom& updatedDom) = 0;
             virtual void PropagateTemplateChanges(TemplateId templateId, bool immediate = false, InstanceOptionalReference instanceToExclude = AZStd::nullopt) = 0;
+            //! Same as PropagateTemplateChanges, for when only the values at the given paths of the template DOM changed.
+            //! Linked instances only copy those values, instead of the whole template.
+            virtual void PropagateTemplatePathChanges(TemplateId templateId, const PrefabDomPathList& changedPaths, bool immediate = false,
+                InstanceOptionalReference instanceToExclude = AZStd::nullopt) = 0;
 
             virtual AZStd::unique_ptr<Instance> InstantiatePrefab(
                 AZ::IO::PathView filePath, InstanceOptionalReference parent = AZStd::nullopt) = 0;
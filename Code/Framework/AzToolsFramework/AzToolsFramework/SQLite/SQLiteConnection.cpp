@@ -97,6 +97,10 @@ namespace AzToolsFramework
             // you still don't lose data if the application crashes, only if you literally lose power while the disk is writing.
             // and because you're in WAL mode, you only lose the current transaction anyway.
             sqlite3_exec(m_db, "PRAGMA synchronous = 0;", NULL, NULL, NULL);
+
+            // readers and the writer mostly don't block each other in WAL mode, but checkpoints and schema changes still can.
+            // let sqlite wait for the lock instead of failing the query right away.
+            sqlite3_busy_timeout(m_db, 1000);
             return      (res == SQLITE_OK);
         }
 
@@ -107,6 +111,7 @@ namespace AzToolsFramework
                 FinalizeAll();
                 sqlite3_close(m_db);
                 m_db = NULL;
+                m_transactionDepth = 0;
             }
         }
 
@@ -117,6 +122,16 @@ namespace AzToolsFramework
                 delete it.second;
             }
             m_statementPrototypes.clear();
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_rawStatementMutex);
+            for (auto& it : m_rawStatements)
+            {
+                for (sqlite3_stmt* statement : it.second)
+                {
+                    sqlite3_finalize(statement);
+                }
+            }
+            m_rawStatements.clear();
         }
 
         void Connection::AddStatement(const AZStd::string& shortName, const AZStd::string& sqlText)
@@ -217,7 +232,18 @@ namespace AzToolsFramework
             {
                 return;
             }
-            sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+
+            if (m_transactionDepth == 0)
+            {
+                sqlite3_exec(m_db, "BEGIN TRANSACTION;", NULL, NULL, NULL);
+            }
+            else
+            {
+                // a nested transaction becomes a savepoint so that it can be rolled back without affecting the outer one.
+                AZStd::string savepoint = AZStd::string::format("SAVEPOINT nested_%i;", m_transactionDepth);
+                sqlite3_exec(m_db, savepoint.c_str(), NULL, NULL, NULL);
+            }
+            ++m_transactionDepth;
         }
 
         void Connection::CommitTransaction()
@@ -227,6 +253,17 @@ namespace AzToolsFramework
             {
                 return;
             }
+
+            AZ_Assert(m_transactionDepth > 0, "CommitTransaction:  No transaction is open!");
+            if (m_transactionDepth > 1)
+            {
+                --m_transactionDepth;
+                AZStd::string savepoint = AZStd::string::format("RELEASE SAVEPOINT nested_%i;", m_transactionDepth);
+                sqlite3_exec(m_db, savepoint.c_str(), NULL, NULL, NULL);
+                return;
+            }
+
+            m_transactionDepth = 0;
             sqlite3_exec(m_db, "COMMIT TRANSACTION;", NULL, NULL, NULL);
         }
 
@@ -237,9 +274,24 @@ namespace AzToolsFramework
             {
                 return;
             }
+
+            if (m_transactionDepth > 1)
+            {
+                --m_transactionDepth;
+                AZStd::string savepoint = AZStd::string::format("ROLLBACK TO SAVEPOINT nested_%i; RELEASE SAVEPOINT nested_%i;", m_transactionDepth, m_transactionDepth);
+                sqlite3_exec(m_db, savepoint.c_str(), NULL, NULL, NULL);
+                return;
+            }
+
+            m_transactionDepth = 0;
             sqlite3_exec(m_db, "ROLLBACK;", NULL, NULL, NULL);
         }
 
+        int Connection::GetTransactionDepth() const
+        {
+            return m_transactionDepth;
+        }
+
         void Connection::Vacuum()
         {
             AZ_Assert(m_db, "Vacuum:  Database is not open!");
@@ -294,13 +346,27 @@ namespace AzToolsFramework
 
         bool Connection::ExecuteRawSqlQuery(const AZStd::string& sql, const AZStd::function<bool(sqlite3_stmt*)>& resultCallback, const AZStd::function<void(sqlite3_stmt*)>& bindCallback)
         {
-            sqlite3_stmt* statement;
-            int res = sqlite3_prepare_v2(m_db, sql.c_str(), aznumeric_caster(sql.length() + 1), &statement, nullptr);
+            sqlite3_stmt* statement = nullptr;
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_rawStatementMutex);
+                auto cached = m_rawStatements.find(sql);
+                if (cached != m_rawStatements.end() && !cached->second.empty())
+                {
+                    statement = cached->second.back();
+                    cached->second.pop_back();
+                }
+            }
 
-            if(res != SQLITE_OK)
+            if (!statement)
             {
-                AZ_Error("Sqlite", false, "Failed to prepare statement.  Error code %d, sql: %s", sqlite3_extended_errcode(m_db), sql.c_str());
-                return false;
+                int res = sqlite3_prepare_v2(m_db, sql.c_str(), aznumeric_caster(sql.length() + 1), &statement, nullptr);
+
+                if (res != SQLITE_OK)
+                {
+                    AZ_Error("Sqlite", false, "Failed to prepare statement.  Error code %d, sql: %s", sqlite3_extended_errcode(m_db), sql.c_str());
+                    sqlite3_finalize(statement);
+                    return false;
+                }
             }
 
             if (bindCallback)
@@ -308,17 +374,18 @@ namespace AzToolsFramework
                 bindCallback(statement);
             }
 
-            res = sqlite3_step(statement);
+            int res = sqlite3_step(statement);
             bool validResult = res == SQLITE_DONE;
 
             while(res == SQLITE_ROW)
             {
                 validResult = true;
 
-                if (resultCallback && resultCallback(statement))
+                if (!resultCallback || !resultCallback(statement))
                 {
-                    res = sqlite3_step(statement);
+                    break;
                 }
+                res = sqlite3_step(statement);
             }
 
             if(res != SQLITE_OK && res != SQLITE_DONE && res != SQLITE_ROW)
@@ -326,6 +393,23 @@ namespace AzToolsFramework
                 AZ_Error("Sqlite", false, "Failed to step statement.  Error code %d, sql: %s", sqlite3_extended_errcode(m_db), sql.c_str());
             }
 
+            // keep the statement prepared for the next call with the same sql, unless the cache is full of other queries.
+            sqlite3_reset(statement);
+            sqlite3_clear_bindings(statement);
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_rawStatementMutex);
+                auto cached = m_rawStatements.find(sql);
+                if (cached == m_rawStatements.end() && m_rawStatements.size() < s_maxCachedRawStatements)
+                {
+                    cached = m_rawStatements.emplace(sql, AZStd::vector<sqlite3_stmt*>()).first;
+                }
+
+                if (cached != m_rawStatements.end())
+                {
+                    cached->second.push_back(statement);
+                    statement = nullptr;
+                }
+            }
             sqlite3_finalize(statement);
 
             return validResult;
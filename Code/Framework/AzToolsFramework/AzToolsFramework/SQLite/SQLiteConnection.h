@@ -12,6 +12,7 @@
 #include <AzCore/base.h>
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/parallel/mutex.h>
 
@@ -46,9 +47,13 @@ namespace AzToolsFramework
             bool IsOpen() const;
 
             // ----- Transaction support -----
+            //! Transactions can be nested, only the outermost one is a real transaction and the nested ones are savepoints in it.
+            //! This lets callers coalesce many small scoped transactions into a single commit.
             void BeginTransaction();
             void CommitTransaction();
             void RollbackTransaction();
+            //! Returns how many transactions are currently open on this connection, 0 if none.
+            int GetTransactionDepth() const;
             // -------------------------------
 
             //! SQLite-specific, compacts the database and cleans up any temporary space allocated.
@@ -80,6 +85,7 @@ namespace AzToolsFramework
 
             //! Prepares and executes an sql string, running callback on each result row.  If callback returns false, iteration will stop and the function will exit
             //! bindCallback is called after the query is prepared and gives an option to bind any needed parameters
+            //! The prepared statement is kept and reused by the next call with the same sql string.
             bool ExecuteRawSqlQuery(const AZStd::string& sql, const AZStd::function<bool(sqlite3_stmt*)>& resultCallback, const AZStd::function<void(sqlite3_stmt*)>& bindCallback);
 
             //! Returns true if the given table name exists in the database.
@@ -89,6 +95,15 @@ namespace AzToolsFramework
             sqlite3* m_db;
             typedef AZStd::unordered_map< AZStd::string, StatementPrototype* > StatementContainer;
             StatementContainer m_statementPrototypes;
+
+            //! Statements prepared by ExecuteRawSqlQuery, by sql text.  There can be more than one per sql text when a result
+            //! callback runs the same query again.
+            static const size_t s_maxCachedRawStatements = 64;
+            typedef AZStd::unordered_map< AZStd::string, AZStd::vector<sqlite3_stmt*> > RawStatementContainer;
+            RawStatementContainer m_rawStatements;
+            AZStd::mutex m_rawStatementMutex;
+
+            int m_transactionDepth = 0;
         };
 
         AZStd::string GetColumnText(sqlite3_stmt* statement, int col);
@@ -247,6 +247,101 @@ namespace Benchmark
         ->DenseRange(8, 12, 2)
         ->Unit(benchmark::kMillisecond)
         ->Complexity();
+
+    // Edits the name of one entity in a nested template with many entities, which is linked to an enclosing template a few times,
+    // and propagates the change to the linked instances. With changedPaths, only the edited value is copied to the linked instances,
+    // otherwise the whole nested template is.
+    class BM_PrefabPropagateTemplateChanges
+        : public BM_Prefab
+    {
+    protected:
+        void PropagateSingleEntityEdit(::benchmark::State& state, bool propagateChangedPaths);
+    };
+
+    void BM_PrefabPropagateTemplateChanges::PropagateSingleEntityEdit(::benchmark::State& state, bool propagateChangedPaths)
+    {
+        constexpr unsigned int numLinks = 10;
+        const unsigned int numEntities = static_cast<unsigned int>(state.range());
+
+        CreateFakePaths(2);
+        const auto& nestedTemplatePath = m_paths.front();
+        const auto& enclosingTemplatePath = m_paths.back();
+
+        for (auto _ : state)
+        {
+            state.PauseTiming();
+
+            AZStd::vector<AZ::Entity*> entities;
+            CreateEntities(numEntities, entities);
+            AZStd::unique_ptr<Instance> nestedInstance = m_prefabSystemComponent->CreatePrefab(entities, {}, nestedTemplatePath);
+            const TemplateId nestedTemplateId = nestedInstance->GetTemplateId();
+
+            AZStd::vector<AZStd::unique_ptr<Instance>> nestedInstances;
+            nestedInstances.emplace_back(AZStd::move(nestedInstance));
+            for (unsigned int linkCounter = 1; linkCounter < numLinks; ++linkCounter)
+            {
+                nestedInstances.emplace_back(m_prefabSystemComponent->InstantiatePrefab(nestedTemplateId));
+            }
+
+            AZStd::unique_ptr<Instance> enclosingInstance =
+                m_prefabSystemComponent->CreatePrefab({}, AZStd::move(nestedInstances), enclosingTemplatePath);
+
+            PrefabDom& nestedTemplateDom = m_prefabSystemComponent->FindTemplateDom(nestedTemplateId);
+            const PrefabDomValue& entitiesValue = nestedTemplateDom[PrefabDomUtils::EntitiesName];
+            const AZStd::string namePath = AZStd::string::format(
+                "/%s/%s/Name", PrefabDomUtils::EntitiesName, entitiesValue.MemberBegin()->name.GetString());
+
+            PrefabDom patches;
+            patches.SetArray();
+            PrefabDomValue patch(rapidjson::kObjectType);
+            patch.AddMember("op", "replace", patches.GetAllocator());
+            patch.AddMember("path", PrefabDomValue(namePath.c_str(), patches.GetAllocator()), patches.GetAllocator());
+            patch.AddMember("value", "Updated Entity", patches.GetAllocator());
+            patches.PushBack(patch, patches.GetAllocator());
+            PrefabDomUtils::ApplyPatches(nestedTemplateDom, nestedTemplateDom.GetAllocator(), patches);
+
+            state.ResumeTiming();
+
+            if (propagateChangedPaths)
+            {
+                m_prefabSystemComponent->PropagateTemplatePathChanges(nestedTemplateId, PrefabDomPathList{ namePath }, true);
+            }
+            else
+            {
+                m_prefabSystemComponent->PropagateTemplateChanges(nestedTemplateId, true);
+            }
+
+            state.PauseTiming();
+
+            enclosingInstance.reset();
+
+            ResetPrefabSystem();
+
+            state.ResumeTiming();
+        }
+
+        state.SetComplexityN(numEntities);
+    }
+
+    BENCHMARK_DEFINE_F(BM_PrefabPropagateTemplateChanges, PropagateTemplateChanges_SingleEntityEdit)(::benchmark::State& state)
+    {
+        PropagateSingleEntityEdit(state, false);
+    }
+    BENCHMARK_REGISTER_F(BM_PrefabPropagateTemplateChanges, PropagateTemplateChanges_SingleEntityEdit)
+        ->RangeMultiplier(10)
+        ->Range(10, 1000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
+
+    BENCHMARK_DEFINE_F(BM_PrefabPropagateTemplateChanges, PropagateTemplatePathChanges_SingleEntityEdit)(::benchmark::State& state)
+    {
+        PropagateSingleEntityEdit(state, true);
+    }
+    BENCHMARK_REGISTER_F(BM_PrefabPropagateTemplateChanges, PropagateTemplatePathChanges_SingleEntityEdit)
+        ->RangeMultiplier(10)
+        ->Range(10, 1000)
+        ->Unit(benchmark::kMillisecond)
+        ->Complexity();
 }
 
 #endif
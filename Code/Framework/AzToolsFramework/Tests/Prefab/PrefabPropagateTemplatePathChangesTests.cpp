@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Serialization/Json/JsonSerialization.h>
+#include <AzToolsFramework/Prefab/Link/Link.h>
+#include <AzToolsFramework/Prefab/PrefabDomUtils.h>
+#include <Prefab/PrefabTestFixture.h>
+
+namespace UnitTest
+{
+    namespace PrefabPropagateTemplatePathChangesTestData
+    {
+        constexpr const char* WheelTemplateJson = R"({
+            "Source": "Wheel.prefab",
+            "Entities": {
+                "Entity_[1]": {
+                    "Name": "Wheel",
+                    "Components": {
+                        "Component_[1]": { "Radius": 1.0, "Tags": [ "a", "b", "c" ] }
+                    }
+                }
+            }
+        })";
+        constexpr const char* AxleTemplateJson = R"({ "Source": "Axle.prefab", "Entities": {} })";
+        constexpr const char* CarTemplateJson = R"({ "Source": "Car.prefab", "Entities": {} })";
+
+        constexpr const char* ComponentPath = "/Entities/Entity_[1]/Components/Component_[1]";
+        constexpr const char* RadiusPath = "/Entities/Entity_[1]/Components/Component_[1]/Radius";
+        constexpr const char* TagsPath = "/Entities/Entity_[1]/Components/Component_[1]/Tags";
+        constexpr const char* NamePath = "/Entities/Entity_[1]/Name";
+
+        constexpr const char* LeftWheelAlias = "Instance_[LeftWheel]";
+        constexpr const char* RightWheelAlias = "Instance_[RightWheel]";
+        constexpr const char* AxleAlias = "Instance_[Axle]";
+    }
+
+    using namespace PrefabPropagateTemplatePathChangesTestData;
+
+    /*
+        The below tests build car->axle->wheel templates directly from DOMs, edit the wheel template, and propagate the changed paths.
+        Propagating the whole wheel template afterwards must not change any template, i.e. propagating the changed paths has the
+        same result as PropagateTemplateChanges.
+    */
+    class PrefabPropagateTemplatePathChangesTest
+        : public PrefabTestFixture
+    {
+    protected:
+        TemplateId AddTemplate(const char* filePath, const char* json)
+        {
+            PrefabDom dom;
+            dom.Parse(json);
+            EXPECT_FALSE(dom.HasParseError());
+            return m_prefabSystemComponent->AddTemplate(filePath, AZStd::move(dom));
+        }
+
+        LinkId CreateLink(TemplateId targetTemplateId, TemplateId sourceTemplateId, const char* instanceAlias, const char* patchesJson = nullptr)
+        {
+            PrefabDom patches;
+            if (patchesJson)
+            {
+                patches.Parse(patchesJson);
+                EXPECT_FALSE(patches.HasParseError());
+            }
+            return m_prefabSystemComponent->CreateLink(targetTemplateId, sourceTemplateId, instanceAlias,
+                patchesJson ? PrefabDomConstReference(patches) : AZStd::nullopt);
+        }
+
+        //! Builds a car with an axle with two wheels. The right wheel has the link patches given.
+        void CreateCar(const char* rightWheelPatchesJson = nullptr)
+        {
+            m_wheelTemplateId = AddTemplate("Wheel.prefab", WheelTemplateJson);
+            m_axleTemplateId = AddTemplate("Axle.prefab", AxleTemplateJson);
+            m_carTemplateId = AddTemplate("Car.prefab", CarTemplateJson);
+            ASSERT_NE(m_wheelTemplateId, InvalidTemplateId);
+            ASSERT_NE(m_axleTemplateId, InvalidTemplateId);
+            ASSERT_NE(m_carTemplateId, InvalidTemplateId);
+
+            m_leftWheelLinkId = CreateLink(m_axleTemplateId, m_wheelTemplateId, LeftWheelAlias);
+            m_rightWheelLinkId = CreateLink(m_axleTemplateId, m_wheelTemplateId, RightWheelAlias, rightWheelPatchesJson);
+            m_axleLinkId = CreateLink(m_carTemplateId, m_axleTemplateId, AxleAlias);
+        }
+
+        //! Applies the patches to the wheel template and propagates only the paths they change
+        void PatchWheelTemplate(const char* patchesJson)
+        {
+            PrefabDom patches;
+            patches.Parse(patchesJson);
+            ASSERT_FALSE(patches.HasParseError());
+
+            PrefabDom& wheelTemplateDom = m_prefabSystemComponent->FindTemplateDom(m_wheelTemplateId);
+            AZ::JsonSerializationResult::ResultCode result = PrefabDomUtils::ApplyPatches(wheelTemplateDom, wheelTemplateDom.GetAllocator(), patches);
+            ASSERT_EQ(result.GetProcessing(), AZ::JsonSerializationResult::Processing::Completed);
+
+            PrefabDomPathList changedPaths;
+            PrefabDomUtils::GetPatchChangedPaths(patches, changedPaths);
+            m_prefabSystemComponent->PropagateTemplatePathChanges(m_wheelTemplateId, changedPaths, true);
+        }
+
+        const PrefabDomValue* GetCarValue(const AZStd::string& path)
+        {
+            PrefabDomPath domPath(path.c_str(), path.size());
+            return domPath.Get(m_prefabSystemComponent->FindTemplateDom(m_carTemplateId));
+        }
+
+        AZStd::string GetWheelPathInCar(const char* wheelAlias, const char* path)
+        {
+            return AZStd::string::format("/%s/%s/%s/%s%s", PrefabDomUtils::InstancesName, AxleAlias, PrefabDomUtils::InstancesName,
+                wheelAlias, path);
+        }
+
+        void ExpectSameAsFullPropagation()
+        {
+            PrefabDom axleTemplateDomAfterPathPropagation;
+            axleTemplateDomAfterPathPropagation.CopyFrom(
+                m_prefabSystemComponent->FindTemplateDom(m_axleTemplateId), axleTemplateDomAfterPathPropagation.GetAllocator());
+            PrefabDom carTemplateDomAfterPathPropagation;
+            carTemplateDomAfterPathPropagation.CopyFrom(
+                m_prefabSystemComponent->FindTemplateDom(m_carTemplateId), carTemplateDomAfterPathPropagation.GetAllocator());
+
+            m_prefabSystemComponent->PropagateTemplateChanges(m_wheelTemplateId, true);
+
+            EXPECT_EQ(AZ::JsonSerialization::Compare(axleTemplateDomAfterPathPropagation, m_prefabSystemComponent->FindTemplateDom(m_axleTemplateId)),
+                AZ::JsonSerializerCompareResult::Equal);
+            EXPECT_EQ(AZ::JsonSerialization::Compare(carTemplateDomAfterPathPropagation, m_prefabSystemComponent->FindTemplateDom(m_carTemplateId)),
+                AZ::JsonSerializerCompareResult::Equal);
+        }
+
+        Link& GetLink(LinkId linkId)
+        {
+            return m_prefabSystemComponent->FindLink(linkId)->get();
+        }
+
+        TemplateId m_wheelTemplateId = InvalidTemplateId;
+        TemplateId m_axleTemplateId = InvalidTemplateId;
+        TemplateId m_carTemplateId = InvalidTemplateId;
+        LinkId m_leftWheelLinkId = InvalidLinkId;
+        LinkId m_rightWheelLinkId = InvalidLinkId;
+        LinkId m_axleLinkId = InvalidLinkId;
+    };
+
+    TEST_F(PrefabPropagateTemplatePathChangesTest, GetPatchChangedPaths_ReplaceValue_ReturnsValuePath)
+    {
+        PrefabDom patches;
+        patches.Parse(R"([ { "op": "replace", "path": "/Entities/Entity_[1]/Components/Component_[1]/Tags/1", "value": "x" } ])");
+
+        PrefabDomPathList changedPaths;
+        PrefabDomUtils::GetPatchChangedPaths(patches, changedPaths);
+
+        EXPECT_EQ(changedPaths, PrefabDomPathList({ "/Entities/Entity_[1]/Components/Component_[1]/Tags/1" }));
+    }
+
+    TEST_F(PrefabPropagateTemplatePathChangesTest, GetPatchChangedPaths_AddOrRemoveArrayElement_ReturnsArrayPath)
+    {
+        PrefabDom patches;
+        patches.Parse(R"([
+            { "op": "add", "path": "/Tags/1", "value": "x" },
+            { "op": "add", "path": "/Tags/-", "value": "y" },
+            { "op": "remove", "path": "/Tags/0" },
+            { "op": "add", "path": "/Name", "value": "z" }
+        ])");
+
+        PrefabDomPathList changedPaths;
+        PrefabDomUtils::GetPatchChangedPaths(patches, changedPaths);
+
+        EXPECT_EQ(changedPaths, PrefabDomPathList({ "/Tags", "/Tags", "/Tags", "/Name" }));
+    }
+
+    TEST_F(PrefabPropagateTemplatePathChangesTest, GetPatchChangedPaths_MoveTestAndInvalidOperations_ReturnsChangedPaths)
+    {
+        PrefabDom patches;
+        patches.Parse(R"([
+            { "op": "move", "from": "/Source/Value", "path": "/Target/Value" },
+            { "op": "test", "path": "/Tested", "value": 1 },
+            { "path": "/NoOperation" }
+        ])");
+
+        PrefabDomPathList changedPaths;
+        PrefabDomUtils::GetPatchChangedPaths(patches, changedPaths);
+
+        // the move changes both of its paths, the test changes nothing and a patch that can't be read changes the whole DOM
+        EXPECT_EQ(changedPaths, PrefabDomPathList({ "/Target/Value", "/Source/Value", "" }));
+    }
+
+    TEST_F(PrefabPropagateTemplatePathChangesTest, IsPathPrefix_ComparesWholeTokens)
+    {
+        EXPECT_TRUE(PrefabDomUtils::IsPathPrefix("", "/Entities"));
+        EXPECT_TRUE(PrefabDomUtils::IsPathPrefix("/Entities", "/Entities"));
+        EXPECT_TRUE(PrefabDomUtils::IsPathPrefix("/Entities", "/Entities/Entity_[1]"));
+        EXPECT_FALSE(PrefabDomUtils::IsPathPrefix("/Entities/Entity_[1]", "/Entities/Entity_[10]"));
+        EXPECT_FALSE(PrefabDomUtils::IsPathPrefix("/Entities/Entity_[1]", "/Entities"));
+    }
+
+    TEST_F(PrefabPropagateTemplatePathChangesTest, PropagateTemplatePathChanges_NestedLinks_SameAsFullPropagation)
+    {
+        CreateCar();
+        PatchWheelTemplate(R"([ { "op": "replace", "path": "/Entities/Entity_[1]/Name", "value": "Tire" } ])");
+
+        for (const char* wheelAlias : { LeftWheelAlias, RightWheelAlias })
+        {
+            const PrefabDomValue* name = GetCarValue(GetWheelPathInCar(wheelAlias, NamePath));
+            ASSERT_TRUE(name && name->IsString());
+            EXPECT_STREQ(name->GetString(), "Tire");
+        }
+        ExpectSameAsFullPropagation();
+    }
+
+    TEST_F(PrefabPropagateTemplatePathChangesTest, PropagateTemplatePathChanges_LinkPatchUnderChangedPath_PatchAppliedAgain)
+    {
+        CreateCar(R"([ { "op": "replace", "path": "/Entities/Entity_[1]/Components/Component_[1]/Radius", "value": 2.0 } ])");
+        PatchWheelTemplate(R"([ { "op": "replace", "path": "/Entities/Entity_[1]/Components/Component_[1]",
+            "value": { "Radius": 3.0, "Width": 0.5, "Tags": [] } } ])");
+
+        const PrefabDomValue* leftRadius = GetCarValue(GetWheelPathInCar(LeftWheelAlias, RadiusPath));
+        const PrefabDomValue* rightRadius = GetCarValue(GetWheelPathInCar(RightWheelAlias, RadiusPath));
+        ASSERT_TRUE(leftRadius && leftRadius->IsNumber());
+        ASSERT_TRUE(rightRadius && rightRadius->IsNumber());
+        EXPECT_EQ(leftRadius->GetDouble(), 3.0);
+        EXPECT_EQ(rightRadius->GetDouble(), 2.0);
+        EXPECT_NE(GetCarValue(GetWheelPathInCar(RightWheelAlias, ComponentPath) + "/Width"), nullptr);
+        ExpectSameAsFullPropagation();
+    }
+
+    TEST_F(PrefabPropagateTemplatePathChangesTest, PropagateTemplatePathChanges_ArrayElementEdits_SameAsFullPropagation)
+    {
+        // the override of the first tag has to follow the elements the source template inserts and removes
+        CreateCar(R"([ { "op": "replace", "path": "/Entities/Entity_[1]/Components/Component_[1]/Tags/0", "value": "override" } ])");
+        PatchWheelTemplate(R"([
+            { "op": "replace", "path": "/Entities/Entity_[1]/Components/Component_[1]/Tags/2", "value": "z" },
+            { "op": "add", "path": "/Entities/Entity_[1]/Components/Component_[1]/Tags/0", "value": "first" },
+            { "op": "remove", "path": "/Entities/Entity_[1]/Components/Component_[1]/Tags/1" }
+        ])");
+
+        const PrefabDomValue* leftTags = GetCarValue(GetWheelPathInCar(LeftWheelAlias, TagsPath));
+        const PrefabDomValue* rightTags = GetCarValue(GetWheelPathInCar(RightWheelAlias, TagsPath));
+        ASSERT_TRUE(leftTags && leftTags->IsArray() && leftTags->Size() == 3);
+        ASSERT_TRUE(rightTags && rightTags->IsArray() && rightTags->Size() == 3);
+        EXPECT_STREQ((*leftTags)[0u].GetString(), "first");
+        EXPECT_STREQ((*leftTags)[2u].GetString(), "z");
+        EXPECT_STREQ((*rightTags)[0u].GetString(), "override");
+        ExpectSameAsFullPropagation();
+    }
+
+    TEST_F(PrefabPropagateTemplatePathChangesTest, PropagateTemplatePathChanges_LinkPatchOnParentPath_SameAsFullPropagation)
+    {
+        // the right wheel replaces the whole component, so a change inside of the component can't be copied on its own
+        CreateCar(R"([ { "op": "replace", "path": "/Entities/Entity_[1]/Components/Component_[1]", "value": { "Radius": 5.0 } } ])");
+        PatchWheelTemplate(R"([ { "op": "replace", "path": "/Entities/Entity_[1]/Components/Component_[1]/Radius", "value": 3.0 } ])");
+
+        const PrefabDomValue* leftRadius = GetCarValue(GetWheelPathInCar(LeftWheelAlias, RadiusPath));
+        const PrefabDomValue* rightRadius = GetCarValue(GetWheelPathInCar(RightWheelAlias, RadiusPath));
+        ASSERT_TRUE(leftRadius && leftRadius->IsNumber());
+        ASSERT_TRUE(rightRadius && rightRadius->IsNumber());
+        EXPECT_EQ(leftRadius->GetDouble(), 3.0);
+        EXPECT_EQ(rightRadius->GetDouble(), 5.0);
+        ExpectSameAsFullPropagation();
+    }
+
+    TEST_F(PrefabPropagateTemplatePathChangesTest, LinkUpdateTarget_ChangedPath_ReportsPathInTargetTemplate)
+    {
+        CreateCar();
+        PrefabDom& wheelTemplateDom = m_prefabSystemComponent->FindTemplateDom(m_wheelTemplateId);
+        PrefabDomPath(NamePath).Set(wheelTemplateDom, "Tire");
+
+        PrefabDomPathList changedTargetPaths;
+        EXPECT_TRUE(GetLink(m_leftWheelLinkId).UpdateTarget(PrefabDomPathList{ NamePath }, changedTargetPaths));
+        EXPECT_EQ(changedTargetPaths, PrefabDomPathList({ AZStd::string::format("/%s/%s%s", PrefabDomUtils::InstancesName, LeftWheelAlias, NamePath) }));
+
+        // the value is up to date now, so nothing changes
+        changedTargetPaths.clear();
+        EXPECT_TRUE(GetLink(m_leftWheelLinkId).UpdateTarget(PrefabDomPathList{ NamePath }, changedTargetPaths));
+        EXPECT_TRUE(changedTargetPaths.empty());
+    }
+
+    TEST_F(PrefabPropagateTemplatePathChangesTest, LinkUpdateTarget_FallsBackToFullUpdate_ReportsInstancePath)
+    {
+        // a patch which moves a value from under the changed path to outside of it is only partly under the changed path
+        CreateCar(R"([ { "op": "move", "from": "/Entities/Entity_[1]/Components/Component_[1]/Radius", "path": "/Entities/Entity_[1]/Radius" } ])");
+        PrefabDom& wheelTemplateDom = m_prefabSystemComponent->FindTemplateDom(m_wheelTemplateId);
+        PrefabDomPath(RadiusPath).Set(wheelTemplateDom, 3.0);
+
+        const AZStd::string rightWheelInstancePath = AZStd::string::format("/%s/%s", PrefabDomUtils::InstancesName, RightWheelAlias);
+        PrefabDomPathList changedTargetPaths;
+        EXPECT_TRUE(GetLink(m_rightWheelLinkId).UpdateTarget(PrefabDomPathList{ ComponentPath }, changedTargetPaths));
+        EXPECT_EQ(changedTargetPaths, PrefabDomPathList({ rightWheelInstancePath }));
+
+        // the whole DOM changed
+        PrefabDomPath("/Entities/Entity_[1]/Name").Set(wheelTemplateDom, "Tire");
+        changedTargetPaths.clear();
+        EXPECT_TRUE(GetLink(m_leftWheelLinkId).UpdateTarget(PrefabDomPathList{ "" }, changedTargetPaths));
+        EXPECT_EQ(changedTargetPaths, PrefabDomPathList({ AZStd::string::format("/%s/%s", PrefabDomUtils::InstancesName, LeftWheelAlias) }));
+    }
+}
@@ -6,6 +6,11 @@
  *
  */
 
+#include <AzCore/Console/IConsole.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzToolsFramework/Entity/PrefabEditorEntityOwnershipInterface.h>
 #include <AzToolsFramework/Prefab/PrefabDomUtils.h>
 #include <Prefab/PrefabTestComponent.h>
@@ -16,6 +21,55 @@ namespace UnitTest
 {
     using PrefabUpdateInstancesTest = PrefabTestFixture;
 
+    //! Counts the components constructed off the main thread, to tell the parallel instance update ran on the job workers.
+    class PrefabThreadRecordingComponent
+        : public AzToolsFramework::Components::EditorComponentBase
+    {
+    public:
+        AZ_EDITOR_COMPONENT(PrefabThreadRecordingComponent, "{5E0C3C52-8E5A-4F8B-9D0A-3A6E2B7C41D9}");
+
+        PrefabThreadRecordingComponent()
+        {
+            if (AZStd::this_thread::get_id() != s_mainThreadId)
+            {
+                ++s_constructedOffMainThreadCount;
+            }
+        }
+
+        static void Reflect(AZ::ReflectContext* reflection)
+        {
+            if (auto serializeContext = azrtti_cast<AZ::SerializeContext*>(reflection))
+            {
+                serializeContext->Class<PrefabThreadRecordingComponent, AzToolsFramework::Components::EditorComponentBase>();
+            }
+        }
+
+        static AZStd::thread_id s_mainThreadId;
+        static AZStd::atomic_int s_constructedOffMainThreadCount;
+    };
+
+    AZStd::thread_id PrefabThreadRecordingComponent::s_mainThreadId;
+    AZStd::atomic_int PrefabThreadRecordingComponent::s_constructedOffMainThreadCount{ 0 };
+
+    //! Sets ed_prefabParallelInstanceUpdate for the scope, so a failed assert doesn't leave it set for the next tests.
+    class ScopedParallelInstanceUpdate
+    {
+    public:
+        explicit ScopedParallelInstanceUpdate(AZ::IConsole* console)
+            : m_console(console)
+        {
+            m_console->PerformCommand("ed_prefabParallelInstanceUpdate true");
+        }
+
+        ~ScopedParallelInstanceUpdate()
+        {
+            m_console->PerformCommand("ed_prefabParallelInstanceUpdate false");
+        }
+
+    private:
+        AZ::IConsole* m_console = nullptr;
+    };
+
     TEST_F(PrefabUpdateInstancesTest, PrefabUpdateInstances_UpdateEntityName_UpdateSucceeds)
     {
         // Create a Template from an Instance owning a single entity.
@@ -59,6 +113,57 @@ namespace UnitTest
 
     }
 
+    TEST_F(PrefabUpdateInstancesTest, PrefabUpdateInstances_UpdateEntityNameInParallel_UpdateSucceeds)
+    {
+        using namespace AzToolsFramework::Prefab;
+        AZ::IConsole* console = AZ::Interface<AZ::IConsole>::Get();
+        ASSERT_TRUE(console != nullptr);
+        // The update only runs on the job workers when there is a global JobContext.
+        ASSERT_TRUE(AZ::JobContext::GetGlobalContext() != nullptr);
+        ScopedParallelInstanceUpdate parallelInstanceUpdate(console);
+
+        GetApplication()->RegisterComponentDescriptor(PrefabThreadRecordingComponent::CreateDescriptor());
+        PrefabThreadRecordingComponent::s_mainThreadId = AZStd::this_thread::get_id();
+        PrefabThreadRecordingComponent::s_constructedOffMainThreadCount = 0;
+
+        // Create a Template from an Instance owning a single entity, nested in another Template.
+        AZ::Entity* newEntity = CreateEntity("New Entity", false);
+        ASSERT_TRUE(newEntity->CreateComponent<PrefabThreadRecordingComponent>());
+        AZStd::unique_ptr<Instance> nestedInstance = m_prefabSystemComponent->CreatePrefab({ newEntity }, {}, NestedPrefabMockFilePath);
+        ASSERT_TRUE(nestedInstance);
+        TemplateId nestedTemplateId = nestedInstance->GetTemplateId();
+        PrefabDom& nestedTemplatePrefabDom = m_prefabSystemComponent->FindTemplateDom(nestedTemplateId);
+        AZStd::vector<EntityAlias> entityAliases = nestedInstance->GetEntityAliases();
+        ASSERT_EQ(entityAliases.size(), 1);
+
+        AZStd::unique_ptr<Instance> enclosingInstance =
+            m_prefabSystemComponent->CreatePrefab({}, MakeInstanceList(AZStd::move(nestedInstance)), PrefabMockFilePath);
+        ASSERT_TRUE(enclosingInstance);
+
+        // Instantiate enough Instances of the nested Template to be loaded on several workers.
+        const int numberOfInstances = 64;
+        AZStd::vector<AZStd::unique_ptr<Instance>> instantiatedInstances;
+        for (int i = 0; i < numberOfInstances; ++i)
+        {
+            instantiatedInstances.emplace_back(m_prefabSystemComponent->InstantiatePrefab(nestedTemplateId));
+            ASSERT_TRUE(instantiatedInstances.back());
+        }
+
+        // Update Template's PrefabDom with a new entity name, and propagate it to the other Template and to all the Instances.
+        PrefabDomPath entityNamePath = PrefabTestDomUtils::GetPrefabDomEntityNamePath(entityAliases.front());
+        entityNamePath.Set(nestedTemplatePrefabDom, "Updated Entity");
+        m_prefabSystemComponent->PropagateTemplateChanges(nestedTemplateId);
+        const bool updateResult = m_instanceUpdateExecutorInterface->UpdateTemplateInstancesInQueue();
+        EXPECT_TRUE(updateResult);
+
+        const PrefabDomValue* entityNameValue = PrefabTestDomUtils::GetPrefabDomEntityName(nestedTemplatePrefabDom, entityAliases.front());
+        ASSERT_TRUE(entityNameValue != nullptr);
+        PrefabTestDomUtils::ValidateInstances(nestedTemplateId, *entityNameValue, entityNamePath);
+
+        // The instances were loaded on the job workers rather than on this thread.
+        EXPECT_GT(PrefabThreadRecordingComponent::s_constructedOffMainThreadCount.load(), 0);
+    }
+
     TEST_F(PrefabUpdateInstancesTest, UpdatePrefabInstances_AddEntity_UpdateSucceeds)
     {
         // Create a Template from an Instance owning a single entity.
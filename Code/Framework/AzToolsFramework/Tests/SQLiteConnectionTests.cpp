@@ -126,4 +126,98 @@ namespace UnitTest
         }
     }
 
+    class SQLiteRawQueryTest
+        : public SQLiteTest
+    {
+    public:
+        void SetUp() override
+        {
+            SQLiteTest::SetUp();
+            ASSERT_TRUE(m_database->ExecuteRawSqlQuery("CREATE TABLE values_table(value INTEGER NOT NULL);", nullptr, nullptr));
+        }
+
+        int CountRows()
+        {
+            int count = -1;
+            m_database->ExecuteRawSqlQuery("SELECT COUNT(*) FROM values_table;", [&count](sqlite3_stmt* statement)
+            {
+                count = SQLite::GetColumnInt(statement, 0);
+                return true;
+            }, nullptr);
+            return count;
+        }
+
+        bool Insert(int value)
+        {
+            return m_database->ExecuteRawSqlQuery(AZStd::string::format("INSERT INTO values_table VALUES(%i);", value), nullptr, nullptr);
+        }
+    };
+
+    TEST_F(SQLiteRawQueryTest, ExecuteRawSqlQuery_SameQueryRepeated_SeesCurrentData)
+    {
+        EXPECT_EQ(CountRows(), 0);
+        EXPECT_TRUE(Insert(1));
+        EXPECT_EQ(CountRows(), 1);
+        EXPECT_TRUE(Insert(2));
+        EXPECT_EQ(CountRows(), 2);
+    }
+
+    TEST_F(SQLiteRawQueryTest, ExecuteRawSqlQuery_CallbackReturnsFalse_StopsIteration)
+    {
+        for (int value = 0; value < 5; ++value)
+        {
+            EXPECT_TRUE(Insert(value));
+        }
+
+        int rowsSeen = 0;
+        EXPECT_TRUE(m_database->ExecuteRawSqlQuery("SELECT value FROM values_table;", [&rowsSeen](sqlite3_stmt*)
+        {
+            ++rowsSeen;
+            return rowsSeen < 2;
+        }, nullptr));
+        EXPECT_EQ(rowsSeen, 2);
+
+        // the statement left mid iteration is reset before being reused.
+        rowsSeen = 0;
+        EXPECT_TRUE(m_database->ExecuteRawSqlQuery("SELECT value FROM values_table;", [&rowsSeen](sqlite3_stmt*)
+        {
+            ++rowsSeen;
+            return true;
+        }, nullptr));
+        EXPECT_EQ(rowsSeen, 5);
+    }
+
+    TEST_F(SQLiteRawQueryTest, ScopedTransaction_NestedNotCommitted_OnlyNestedChangesRolledBack)
+    {
+        {
+            SQLite::ScopedTransaction outer(m_database.get());
+            EXPECT_TRUE(Insert(1));
+            {
+                SQLite::ScopedTransaction inner(m_database.get());
+                EXPECT_EQ(m_database->GetTransactionDepth(), 2);
+                EXPECT_TRUE(Insert(2));
+            }
+            EXPECT_EQ(m_database->GetTransactionDepth(), 1);
+            {
+                SQLite::ScopedTransaction inner(m_database.get());
+                EXPECT_TRUE(Insert(3));
+                inner.Commit();
+            }
+            outer.Commit();
+        }
+        EXPECT_EQ(m_database->GetTransactionDepth(), 0);
+        EXPECT_EQ(CountRows(), 2);
+    }
+
+    TEST_F(SQLiteRawQueryTest, ScopedTransaction_OuterNotCommitted_NestedCommitsRolledBack)
+    {
+        {
+            SQLite::ScopedTransaction outer(m_database.get());
+            SQLite::ScopedTransaction inner(m_database.get());
+            EXPECT_TRUE(Insert(1));
+            inner.Commit();
+        }
+        EXPECT_EQ(m_database->GetTransactionDepth(), 0);
+        EXPECT_EQ(CountRows(), 0);
+    }
 }
@@ -72,6 +72,7 @@ set(FILES
     Prefab/PrefabInstantiateTests.cpp
     Prefab/PrefabInstantiateTests.cpp
     Prefab/PrefabLoadTemplateTests.cpp
+    Prefab/PrefabPropagateTemplatePathChangesTests.cpp
     Prefab/PrefabTestComponent.cpp
     Prefab/PrefabTestComponent.h
     Prefab/PrefabTestData.cpp
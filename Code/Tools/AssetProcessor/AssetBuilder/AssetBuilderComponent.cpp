@@ -61,6 +61,10 @@ static const char* const s_taskDebug = "debug"; // runs a one shot job in a fake
 static const char* const s_taskDebugCreate = "debug_create"; // runs a one shot job in a fake environment for a specified file.
 static const char* const s_taskDebugProcess = "debug_process"; // runs a one shot job in a fake environment for a specified file.
 
+// Shared memory job channel:
+static const AZ::u32 s_jobChannelReceiveTimeMS = 100; // How long the channel thread waits for a request before checking if it should stop.
+static const AZ::u32 s_jobChannelSendTimeoutMS = 60 * 1000; // How long a response can wait for the Asset Processor to make room for it.
+
 //! Scoped Setters for the SettingsRegistry to its previous value on destruction
 struct ScopedSettingsRegistrySetter
 {
@@ -146,6 +150,7 @@ void AssetBuilderComponent::PrintHelp()
     AZ_TracePrintf("Help", "%s - For resident mode, the path to the builder dll folder, otherwise the full path to a single builder dll to use.\n", s_paramModule);
     AZ_TracePrintf("Help", "%s - Optional, port number to use to connect to the AP.\n", s_paramPort);
     AZ_TracePrintf("Help", "%s - UUID string that identifies the builder.  Only used for resident mode when the AP directly starts up the AssetBuilder.\n", s_paramId);
+    AZ_TracePrintf("Help", "%s - Name of the shared memory job channel to receive jobs from.  Only used for resident mode when the AP directly starts up the AssetBuilder.\n", AssetBuilderSDK::SharedMemoryJobChannelParam);
     AZ_TracePrintf("Help", "%s - For non-resident mode, full path to the file containing the serialized job request.\n", s_paramInput);
     AZ_TracePrintf("Help", "%s - For non-resident mode, full path to the file to write the job response to.\n", s_paramOutput);
     AZ_TracePrintf("Help", "%s - Debug mode for the create and process job of the specified file.\n", s_paramDebug);
@@ -393,6 +398,20 @@ bool AssetBuilderComponent::RunInResidentMode()
     AzFramework::SocketConnection::GetInstance()->AddMessageHandler(CreateJobsNetRequest::MessageType(), AZStd::bind(&AssetBuilderComponent::CreateJobsResidentHandler, this, _1, _2, _3, _4));
     AzFramework::SocketConnection::GetInstance()->AddMessageHandler(ProcessJobNetRequest::MessageType(), AZStd::bind(&AssetBuilderComponent::ProcessJobResidentHandler, this, _1, _2, _3, _4));
 
+    AZStd::string jobChannelName;
+    if (GetParameter(SharedMemoryJobChannelParam, jobChannelName, false) && m_jobChannel.Open(jobChannelName.c_str()))
+    {
+        // Lets the Asset Processor know jobs can be sent through the channel, this has to happen before the hello request below
+        if (m_jobChannel.Send(BuilderHelloRequest::MessageType(), 0, nullptr, 0, s_jobChannelSendTimeoutMS))
+        {
+            AZ_TracePrintf("AssetBuilderComponent", "RunInResidentMode: Receiving jobs through shared memory job channel %s\n", jobChannelName.c_str());
+        }
+        else
+        {
+            m_jobChannel.Close();
+        }
+    }
+
     BuilderHelloRequest request;
     BuilderHelloResponse response;
 
@@ -413,6 +432,13 @@ bool AssetBuilderComponent::RunInResidentMode()
         m_jobThreadDesc.m_name = "Builder Job Thread";
         m_jobThread = AZStd::thread(m_jobThreadDesc, AZStd::bind(&AssetBuilderComponent::JobThread, this));
 
+        if (m_jobChannel.IsOpen())
+        {
+            AZStd::thread_desc jobChannelThreadDesc;
+            jobChannelThreadDesc.m_name = "Builder Job Channel Thread";
+            m_jobChannelThread = AZStd::thread(jobChannelThreadDesc, AZStd::bind(&AssetBuilderComponent::JobChannelThread, this));
+        }
+
         AzFramework::EngineConnectionEvents::Bus::Handler::BusConnect(); // Listen for disconnects
 
         AZ_TracePrintf("AssetBuilder", "Builder ID: %s\n", response.m_uuid.ToString<AZStd::string>().c_str());
@@ -423,12 +449,19 @@ bool AssetBuilderComponent::RunInResidentMode()
         m_running = false;
     }
 
+    if (m_jobChannelThread.joinable())
+    {
+        m_jobChannelThread.join();
+    }
+
     if (m_jobThread.joinable())
     {
         m_jobEvent.release();
         m_jobThread.join();
     }
 
+    m_jobChannel.Close();
+
     return result;
 }
 
@@ -812,19 +845,20 @@ bool AssetBuilderComponent::GetAssetDatabaseLocation(AZStd::string& location)
 }
 
 template<typename TNetRequest, typename TNetResponse>
-void AssetBuilderComponent::ResidentJobHandler(AZ::u32 serial, const void* data, AZ::u32 dataLength, JobType jobType)
+void AssetBuilderComponent::ResidentJobHandler(AZ::u32 serial, const void* data, AZ::u32 dataLength, JobType jobType, bool fromJobChannel)
 {
     auto job = AZStd::make_unique<Job>();
     job->m_netResponse = AZStd::make_unique<TNetResponse>();
     job->m_requestSerial = serial;
     job->m_jobType = jobType;
+    job->m_fromJobChannel = fromJobChannel;
 
     auto* request = AZ::Utils::LoadObjectFromBuffer<TNetRequest>(data, dataLength);
 
     if (!request)
     {
         AZ_Error("AssetBuilder", false, "Problem deserializing net request");
-        AzFramework::AssetSystem::SendResponse(*(job->m_netResponse), serial);
+        SendJobResponse(*(job->m_netResponse), serial, fromJobChannel);
 
         return;
     }
@@ -834,22 +868,25 @@ void AssetBuilderComponent::ResidentJobHandler(AZ::u32 serial, const void* data,
     // Queue up the job for the worker thread
     {
         AZStd::lock_guard<AZStd::mutex> lock(m_jobMutex);
+        m_queuedJobs.push_back(AZStd::move(job));
+    }
 
-        if (!m_queuedJob)
-        {
-            m_queuedJob.swap(job);
-        }
-        else
-        {
-            AZ_Error("AssetBuilder", false, "Builder already has a job queued");
-            AzFramework::AssetSystem::SendResponse(*(job->m_netResponse), serial);
+    // Wake up the job thread
+    m_jobEvent.release();
+}
 
-            return;
+void AssetBuilderComponent::SendJobResponse(const AzFramework::AssetSystem::BaseAssetProcessorMessage& response, AZ::u32 serial, bool viaJobChannel)
+{
+    if (viaJobChannel)
+    {
+        if (!m_jobChannel.SendNetMessage(response, serial, s_jobChannelSendTimeoutMS))
+        {
+            AZ_Error("AssetBuilder", false, "Failed to send job response through the shared memory job channel");
         }
+        return;
     }
 
-    // Wake up the job thread
-    m_jobEvent.release();
+    AzFramework::AssetSystem::SendResponse(response, serial);
 }
 
 bool AssetBuilderComponent::IsBuilderForFile(const AZStd::string& filePath, const AssetBuilderSDK::AssetBuilderDesc& builderDescription) const
@@ -870,22 +907,22 @@ void AssetBuilderComponent::JobThread()
 {
     while (m_running)
     {
-        m_jobEvent.acquire();
-
         AZStd::unique_ptr<Job> job;
 
         {
             AZStd::lock_guard<AZStd::mutex> lock(m_jobMutex);
-            job.swap(m_queuedJob);
-        }
 
-        if (!job)
-        {
-            if (m_running)
+            if (!m_queuedJobs.empty())
             {
-                AZ_TracePrintf("AssetBuilder", "JobThread woke up, but there was no queued job\n");
+                job = AZStd::move(m_queuedJobs.front());
+                m_queuedJobs.pop_front();
             }
+        }
 
+        if (!job)
+        {
+            // Every queued job has been processed, wait for the next one
+            m_jobEvent.acquire();
             continue;
         }
 
@@ -971,11 +1008,51 @@ void AssetBuilderComponent::JobThread()
         std::fflush(stdout);
         std::fflush(stderr);
 
-        AZ::SystemTickBus::Broadcast(&AZ::SystemTickBus::Events::OnSystemTick);
-        AZ::TickBus::Broadcast(&AZ::TickEvents::OnTick, 0.00f, AZ::ScriptTimePoint(AZStd::chrono::system_clock::now()));
-        AZ::AllocatorManager::Instance().GarbageCollect();
+        bool moreJobsQueued = false;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_jobMutex);
+            moreJobsQueued = !m_queuedJobs.empty();
+        }
+
+        // Ticking and garbage collecting can cost more than a small job, so it is done once per batch of queued jobs
+        if (!moreJobsQueued)
+        {
+            AZ::SystemTickBus::Broadcast(&AZ::SystemTickBus::Events::OnSystemTick);
+            AZ::TickBus::Broadcast(&AZ::TickEvents::OnTick, 0.00f, AZ::ScriptTimePoint(AZStd::chrono::system_clock::now()));
+            AZ::AllocatorManager::Instance().GarbageCollect();
+        }
+
+        SendJobResponse(*(job->m_netResponse), job->m_requestSerial, job->m_fromJobChannel);
+    }
+}
 
-        AzFramework::AssetSystem::SendResponse(*(job->m_netResponse), job->m_requestSerial);
+void AssetBuilderComponent::JobChannelThread()
+{
+    using namespace AssetBuilderSDK;
+
+    SharedMemoryJobChannel::Message message;
+
+    while (m_running && m_jobChannel.IsOpen())
+    {
+        if (!m_jobChannel.Receive(message, s_jobChannelReceiveTimeMS))
+        {
+            continue;
+        }
+
+        const AZ::u32 dataLength = aznumeric_cast<AZ::u32>(message.m_payload.size());
+
+        if (message.m_type == CreateJobsNetRequest::MessageType())
+        {
+            ResidentJobHandler<CreateJobsNetRequest, CreateJobsNetResponse>(message.m_serial, message.m_payload.data(), dataLength, JobType::Create, true);
+        }
+        else if (message.m_type == ProcessJobNetRequest::MessageType())
+        {
+            ResidentJobHandler<ProcessJobNetRequest, ProcessJobNetResponse>(message.m_serial, message.m_payload.data(), dataLength, JobType::Process, true);
+        }
+        else
+        {
+            AZ_Error("AssetBuilder", false, "Unhandled message type %u received through the shared memory job channel", message.m_type);
+        }
     }
 }
 
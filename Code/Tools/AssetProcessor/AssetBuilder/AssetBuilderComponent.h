@@ -10,7 +10,9 @@
 
 #include <AssetBuilderSDK/AssetBuilderBusses.h>
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
+#include <AssetBuilderSDK/SharedMemoryJobChannel.h>
 #include <AzCore/Component/Component.h>
+#include <AzCore/std/containers/deque.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
 #include <AzFramework/Network/SocketConnection.h>
 #include <AzToolsFramework/Application/ToolsApplication.h>
@@ -88,6 +90,8 @@ protected:
         AZ::u32 m_requestSerial;
         AZStd::unique_ptr<AzFramework::AssetSystem::BaseAssetProcessorMessage> m_netRequest;
         AZStd::unique_ptr<AzFramework::AssetSystem::BaseAssetProcessorMessage> m_netResponse;
+        //! The response goes back through the transport the request came from
+        bool m_fromJobChannel = false;
     };
 
     //! Reads a command line parameter and places it in the outValue parameter.  Returns false if the value is empty, true otherwise
@@ -108,7 +112,7 @@ protected:
     bool RunOneShotTask(const AZStd::string& task);
 
     template<typename TNetRequest, typename TNetResponse>
-    void ResidentJobHandler(AZ::u32 serial, const void* data, AZ::u32 dataLength, JobType jobType);
+    void ResidentJobHandler(AZ::u32 serial, const void* data, AZ::u32 dataLength, JobType jobType, bool fromJobChannel = false);
     void CreateJobsResidentHandler(AZ::u32 typeId, AZ::u32 serial, const void* data, AZ::u32 dataLength);
     void ProcessJobResidentHandler(AZ::u32 typeId, AZ::u32 serial, const void* data, AZ::u32 dataLength);
 
@@ -118,6 +122,13 @@ protected:
     //! Handles calling the appropriate builder job function for the incoming job
     void JobThread();
 
+    //! Run by a separate thread when the Asset Processor provided a shared memory job channel
+    //! Receives the job requests sent through it and queues them up for the job thread
+    void JobChannelThread();
+
+    //! Sends a job response through the socket or the shared memory job channel
+    void SendJobResponse(const AzFramework::AssetSystem::BaseAssetProcessorMessage& response, AZ::u32 serial, bool viaJobChannel);
+
     void ProcessJob(const AssetBuilderSDK::ProcessJobFunction& job, const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& outResponse);
 
     //! Handles a builder registration request
@@ -154,11 +165,16 @@ protected:
     //! Use to signal a new job is ready to be processed
     AZStd::binary_semaphore m_jobEvent;
     
-    //! Lock for m_queuedJob
+    //! Lock for m_queuedJobs
     AZStd::mutex m_jobMutex;
 
-    //! Stored job that is waiting to be picked up for processing by the job thread
-    AZStd::unique_ptr<Job> m_queuedJob;
+    //! Stored jobs that are waiting to be picked up for processing by the job thread, in the order they were received
+    //! The Asset Processor can send a batch of jobs before waiting for their responses
+    AZStd::deque<AZStd::unique_ptr<Job>> m_queuedJobs;
+
+    //! Optional shared memory transport for job requests, provided by the Asset Processor on the command line
+    AssetBuilderSDK::SharedMemoryJobChannel m_jobChannel;
+    AZStd::thread m_jobChannelThread;
 
     AZStd::string m_gameName;
     AZStd::string m_projectPath;
@@ -0,0 +1,284 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AssetBuilderSDK/SharedMemoryJobChannel.h>
+#include <AzCore/std/parallel/thread.h>
+
+namespace AssetBuilderSDK
+{
+    const char* const SharedMemoryJobChannelParam = "sharedmemory";
+
+    namespace
+    {
+        //! Number of times a blocked sender or an idle receiver yields before it starts sleeping between attempts.
+        //! Small jobs are answered in microseconds, sleeping right away would cap throughput at a job per scheduler tick.
+        constexpr int s_spinCount = 256;
+
+        void WaitBeforeRetry(int attempt)
+        {
+            if (attempt < s_spinCount)
+            {
+                AZStd::this_thread::yield();
+            }
+            else
+            {
+                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1));
+            }
+        }
+
+        AZStd::string HostToBuilderName(const char* name)
+        {
+            return AZStd::string::format("%s_ToBuilder", name);
+        }
+
+        AZStd::string BuilderToHostName(const char* name)
+        {
+            return AZStd::string::format("%s_ToHost", name);
+        }
+    }
+
+    SharedMemoryJobChannel::~SharedMemoryJobChannel()
+    {
+        Close();
+    }
+
+    bool SharedMemoryJobChannel::IsSupported()
+    {
+#if AZ_TRAIT_SUPPORT_IPC
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool SharedMemoryJobChannel::Create([[maybe_unused]] const char* name, [[maybe_unused]] AZ::u32 bufferSize)
+    {
+#if AZ_TRAIT_SUPPORT_IPC
+        Close();
+
+        m_hostToBuilder = AZStd::make_unique<AZ::SharedMemoryRingBuffer>();
+        m_builderToHost = AZStd::make_unique<AZ::SharedMemoryRingBuffer>();
+        if (!m_hostToBuilder->Create(HostToBuilderName(name).c_str(), bufferSize) || !m_hostToBuilder->Map()
+            || !m_builderToHost->Create(BuilderToHostName(name).c_str(), bufferSize) || !m_builderToHost->Map())
+        {
+            AZ_Warning("SharedMemoryJobChannel", false, "Failed to create the shared memory job channel %s", name);
+            Close();
+            return false;
+        }
+
+        m_name = name;
+        m_outgoing = m_hostToBuilder.get();
+        m_incoming = m_builderToHost.get();
+        m_open = true;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    bool SharedMemoryJobChannel::Open([[maybe_unused]] const char* name)
+    {
+#if AZ_TRAIT_SUPPORT_IPC
+        Close();
+
+        m_hostToBuilder = AZStd::make_unique<AZ::SharedMemoryRingBuffer>();
+        m_builderToHost = AZStd::make_unique<AZ::SharedMemoryRingBuffer>();
+        if (!m_hostToBuilder->Open(HostToBuilderName(name).c_str()) || !m_hostToBuilder->Map()
+            || !m_builderToHost->Open(BuilderToHostName(name).c_str()) || !m_builderToHost->Map())
+        {
+            AZ_Warning("SharedMemoryJobChannel", false, "Failed to open the shared memory job channel %s", name);
+            Close();
+            return false;
+        }
+
+        m_name = name;
+        m_outgoing = m_builderToHost.get();
+        m_incoming = m_hostToBuilder.get();
+        m_open = true;
+        return true;
+#else
+        return false;
+#endif
+    }
+
+    void SharedMemoryJobChannel::Close()
+    {
+        m_open = false;
+        m_outgoing = nullptr;
+        m_incoming = nullptr;
+        // the ring buffer destructors unmap and close the shared memory.
+        m_hostToBuilder.reset();
+        m_builderToHost.reset();
+        m_name.clear();
+
+        m_receiveHeader = {};
+        m_receivedHeaderBytes = 0;
+        m_receivePayload.clear();
+        m_receivedPayloadBytes = 0;
+    }
+
+    bool SharedMemoryJobChannel::IsOpen() const
+    {
+        return m_open;
+    }
+
+    const AZStd::string& SharedMemoryJobChannel::GetName() const
+    {
+        return m_name;
+    }
+
+    bool SharedMemoryJobChannel::LockRingBuffer(AZ::SharedMemoryRingBuffer& ringBuffer)
+    {
+        ringBuffer.lock();
+        if (ringBuffer.IsLockAbandoned())
+        {
+            // the other process died while holding the lock, the content of the ring buffer can't be trusted anymore.
+            AZ_Warning("SharedMemoryJobChannel", false, "The other end of the shared memory job channel %s is gone", m_name.c_str());
+            ringBuffer.Clear();
+            ringBuffer.unlock();
+            m_open = false;
+            return false;
+        }
+        return true;
+    }
+
+    bool SharedMemoryJobChannel::WriteBytes(const char* data, AZ::u32 dataSize, AZStd::chrono::system_clock::time_point deadline)
+    {
+        int attempt = 0;
+        while (dataSize > 0)
+        {
+            if (!m_open || !LockRingBuffer(*m_outgoing))
+            {
+                return false;
+            }
+            const AZ::u32 chunkSize = AZStd::GetMin(m_outgoing->MaxToWrite(), dataSize);
+            const bool written = chunkSize > 0 && m_outgoing->Write(data, chunkSize);
+            m_outgoing->unlock();
+
+            if (written)
+            {
+                data += chunkSize;
+                dataSize -= chunkSize;
+                attempt = 0;
+            }
+            else if (AZStd::chrono::system_clock::now() > deadline)
+            {
+                return false;
+            }
+            else
+            {
+                WaitBeforeRetry(attempt++);
+            }
+        }
+        return true;
+    }
+
+    AZ::u32 SharedMemoryJobChannel::ReadBytes(char* data, AZ::u32 dataSize)
+    {
+        if (dataSize == 0 || !m_open || !LockRingBuffer(*m_incoming))
+        {
+            return 0;
+        }
+        const AZ::u32 readSize = m_incoming->DataToRead() > 0 ? m_incoming->Read(data, dataSize) : 0;
+        m_incoming->unlock();
+        return readSize;
+    }
+
+    bool SharedMemoryJobChannel::Send(AZ::u32 type, AZ::u32 serial, const void* data, AZ::u32 dataSize, AZ::u32 timeoutMS)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_sendMutex);
+
+        if (!m_open)
+        {
+            return false;
+        }
+
+        if (dataSize > MaxMessageSize)
+        {
+            AZ_Warning("SharedMemoryJobChannel", false, "Message of %u bytes is larger than the %u bytes the shared memory job channel %s accepts",
+                dataSize, MaxMessageSize, m_name.c_str());
+            return false;
+        }
+
+        const FrameHeader header{ type, serial, dataSize };
+        const auto deadline = AZStd::chrono::system_clock::now() + AZStd::chrono::milliseconds(timeoutMS);
+        if (!WriteBytes(reinterpret_cast<const char*>(&header), sizeof(header), deadline)
+            || !WriteBytes(reinterpret_cast<const char*>(data), dataSize, deadline))
+        {
+            AZ_Warning("SharedMemoryJobChannel", !m_open, "Timed out sending a message through the shared memory job channel %s", m_name.c_str());
+            // the receiver is left with a partial message, nothing else can go through this channel.
+            m_open = false;
+            return false;
+        }
+        return true;
+    }
+
+    bool SharedMemoryJobChannel::Receive(Message& message, AZ::u32 timeoutMS)
+    {
+        const auto deadline = AZStd::chrono::system_clock::now() + AZStd::chrono::milliseconds(timeoutMS);
+        int attempt = 0;
+
+        while (m_open)
+        {
+            bool progressed = false;
+
+            if (m_receivedHeaderBytes < sizeof(FrameHeader))
+            {
+                const AZ::u32 readSize = ReadBytes(reinterpret_cast<char*>(&m_receiveHeader) + m_receivedHeaderBytes, sizeof(FrameHeader) - m_receivedHeaderBytes);
+                m_receivedHeaderBytes += readSize;
+                progressed = readSize > 0;
+                if (m_receivedHeaderBytes == sizeof(FrameHeader))
+                {
+                    if (m_receiveHeader.m_size > MaxMessageSize)
+                    {
+                        AZ_Warning("SharedMemoryJobChannel", false, "Received a message of %u bytes through the shared memory job channel %s, "
+                            "more than the %u bytes allowed. The stream is corrupt and the channel is closed.",
+                            m_receiveHeader.m_size, m_name.c_str(), MaxMessageSize);
+                        m_open = false;
+                        m_receivedHeaderBytes = 0;
+                        return false;
+                    }
+                    m_receivePayload.resize_no_construct(m_receiveHeader.m_size);
+                    m_receivedPayloadBytes = 0;
+                }
+            }
+
+            if (m_receivedHeaderBytes == sizeof(FrameHeader))
+            {
+                const AZ::u32 readSize = ReadBytes(m_receivePayload.data() + m_receivedPayloadBytes, m_receiveHeader.m_size - m_receivedPayloadBytes);
+                m_receivedPayloadBytes += readSize;
+                progressed = progressed || readSize > 0;
+
+                if (m_receivedPayloadBytes == m_receiveHeader.m_size)
+                {
+                    message.m_type = m_receiveHeader.m_type;
+                    message.m_serial = m_receiveHeader.m_serial;
+                    message.m_payload.swap(m_receivePayload);
+                    m_receivePayload.clear();
+                    m_receivedHeaderBytes = 0;
+                    m_receivedPayloadBytes = 0;
+                    return true;
+                }
+            }
+
+            if (progressed)
+            {
+                attempt = 0;
+            }
+            else if (AZStd::chrono::system_clock::now() >= deadline)
+            {
+                break;
+            }
+            else
+            {
+                WaitBeforeRetry(attempt++);
+            }
+        }
+        return false;
+    }
+} // namespace AssetBuilderSDK
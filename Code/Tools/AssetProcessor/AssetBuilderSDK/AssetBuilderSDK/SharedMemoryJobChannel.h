@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/IPC/SharedMemory.h>
+#include <AzCore/std/chrono/chrono.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <AzCore/std/string/string.h>
+#include <AzFramework/Asset/AssetProcessorMessages.h>
+
+namespace AssetBuilderSDK
+{
+    //! Command line switch the Asset Processor uses to hand a resident builder the name of its shared memory job channel.
+    extern const char* const SharedMemoryJobChannelParam;
+
+    //! Local transport for job requests and responses between the Asset Processor and one resident AssetBuilder process.
+    //! It is made of two shared memory ring buffers, one per direction, carrying the same serialized net messages as the socket
+    //! connection. Each message is framed as [type][serial][size][payload] and streamed through the ring buffer in chunks,
+    //! so messages larger than the ring buffer go through as long as the other side keeps reading.
+    //! The Asset Processor creates the channel before launching the builder, the builder opens it by name.
+    //! Only available on platforms with AZ_TRAIT_SUPPORT_IPC, everywhere else Create and Open fail and the socket is used.
+    class SharedMemoryJobChannel
+    {
+    public:
+        struct Message
+        {
+            AZ::u32 m_type = 0;
+            AZ::u32 m_serial = 0;
+            AZStd::vector<char> m_payload;
+        };
+
+        static constexpr AZ::u32 DefaultBufferSize = 4 * 1024 * 1024;
+        //! Largest message accepted either way. The size in a received frame comes from the other process, a larger one means
+        //! the stream is corrupt and the channel is closed instead of allocating it.
+        static constexpr AZ::u32 MaxMessageSize = 256 * 1024 * 1024;
+
+        SharedMemoryJobChannel() = default;
+        ~SharedMemoryJobChannel();
+
+        AZ_DISABLE_COPY_MOVE(SharedMemoryJobChannel);
+
+        //! Returns true if shared memory is supported on this platform.
+        static bool IsSupported();
+
+        //! Creates both ring buffers, done by the Asset Processor side.
+        bool Create(const char* name, AZ::u32 bufferSize = DefaultBufferSize);
+        //! Opens the ring buffers created by the Asset Processor, done by the builder side.
+        bool Open(const char* name);
+        void Close();
+
+        //! Returns true if the channel is open and the other side hasn't been detected as gone.
+        bool IsOpen() const;
+        const AZStd::string& GetName() const;
+
+        //! Sends a message, waiting up to timeoutMS for room in the ring buffer. A failed send leaves a partial message
+        //! in the ring buffer, so the channel stops being open and nothing else goes through it.
+        //! Messages larger than MaxMessageSize are refused without touching the channel.
+        bool Send(AZ::u32 type, AZ::u32 serial, const void* data, AZ::u32 dataSize, AZ::u32 timeoutMS);
+
+        //! Serializes and sends an Asset Processor message.
+        template<class TMessage>
+        bool SendNetMessage(const TMessage& message, AZ::u32 serial, AZ::u32 timeoutMS)
+        {
+            AZStd::vector<char> buffer;
+            if (!AzFramework::AssetSystem::PackMessage(message, buffer))
+            {
+                return false;
+            }
+            return Send(message.GetMessageType(), serial, buffer.data(), static_cast<AZ::u32>(buffer.size()), timeoutMS);
+        }
+
+        //! Waits up to timeoutMS for a complete message. Partially received messages are kept and completed by the next call.
+        //! A frame announcing more than MaxMessageSize bytes closes the channel.
+        bool Receive(Message& message, AZ::u32 timeoutMS);
+
+    protected:
+        struct FrameHeader
+        {
+            AZ::u32 m_type;
+            AZ::u32 m_serial;
+            AZ::u32 m_size;
+        };
+
+        //! Writes the bytes to the outgoing ring buffer, returns false if the deadline passes first.
+        bool WriteBytes(const char* data, AZ::u32 dataSize, AZStd::chrono::system_clock::time_point deadline);
+        //! Reads whatever is available up to dataSize bytes, returns the number of bytes read.
+        AZ::u32 ReadBytes(char* data, AZ::u32 dataSize);
+        //! Locks a ring buffer, returns false and marks the channel as not open if the lock was abandoned by a process that died holding it.
+        bool LockRingBuffer(AZ::SharedMemoryRingBuffer& ringBuffer);
+
+        AZStd::string m_name;
+        //! The ring buffers are only instantiated on platforms supporting shared memory.
+        AZStd::unique_ptr<AZ::SharedMemoryRingBuffer> m_hostToBuilder;
+        AZStd::unique_ptr<AZ::SharedMemoryRingBuffer> m_builderToHost;
+        AZ::SharedMemoryRingBuffer* m_outgoing = nullptr;
+        AZ::SharedMemoryRingBuffer* m_incoming = nullptr;
+        AZStd::atomic_bool m_open{ false };
+
+        //! Serializes senders, a message has to be written in one go for the stream to stay consistent.
+        AZStd::mutex m_sendMutex;
+
+        //! State of the message being received, used by the receiving thread only.
+        FrameHeader m_receiveHeader = {};
+        AZ::u32 m_receivedHeaderBytes = 0;
+        AZStd::vector<char> m_receivePayload;
+        AZ::u32 m_receivedPayloadBytes = 0;
+    };
+} // namespace AssetBuilderSDK
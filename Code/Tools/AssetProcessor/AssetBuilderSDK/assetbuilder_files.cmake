@@ -12,4 +12,6 @@ set(FILES
     AssetBuilderSDK/AssetBuilderBusses.h
     AssetBuilderSDK/SerializationDependencies.h
     AssetBuilderSDK/SerializationDependencies.cpp
+    AssetBuilderSDK/SharedMemoryJobChannel.h
+    AssetBuilderSDK/SharedMemoryJobChannel.cpp
 )
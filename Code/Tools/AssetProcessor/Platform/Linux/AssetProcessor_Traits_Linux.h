@@ -9,3 +9,5 @@
 
 #define ASSETPROCESSOR_TRAIT_LEGACY_RC_RELATIVE_PATH "rc"
 #define ASSETPROCESSOR_TRAIT_CASE_SENSITIVE_FILESYSTEM true
+// A mapped file truncated by another process while it is read raises SIGBUS, stream files instead
+#define ASSETPROCESSOR_TRAIT_MAP_FILES_FOR_HASHING false
@@ -9,3 +9,4 @@
 
 #define ASSETPROCESSOR_TRAIT_LEGACY_RC_RELATIVE_PATH "rc.exe"
 #define ASSETPROCESSOR_TRAIT_CASE_SENSITIVE_FILESYSTEM false
+#define ASSETPROCESSOR_TRAIT_MAP_FILES_FOR_HASHING true
@@ -9,6 +9,8 @@
 set(FILES
     native/AssetDatabase/AssetDatabase.cpp
     native/AssetDatabase/AssetDatabase.h
+    native/AssetDatabase/AssetDatabaseConnectionPool.cpp
+    native/AssetDatabase/AssetDatabaseConnectionPool.h
     native/AssetManager/AssetCatalog.cpp
     native/AssetManager/AssetCatalog.h
     native/AssetManager/assetProcessorManager.cpp
@@ -95,6 +97,8 @@ set(FILES
     native/utilities/IniConfiguration.h
     native/utilities/JobDiagnosticTracker.cpp
     native/utilities/JobDiagnosticTracker.h
+    native/utilities/JobOutputCache.cpp
+    native/utilities/JobOutputCache.h
     native/utilities/LineByLineDependencyScanner.cpp
     native/utilities/LineByLineDependencyScanner.h
     native/utilities/MissingDependencyScanner.cpp
@@ -36,6 +36,9 @@ set(FILES
     native/tests/platformconfiguration/platformconfigurationtests.h
     native/tests/utilities/JobModelTest.cpp
     native/tests/utilities/JobModelTest.h
+    native/tests/utilities/JobOutputCacheTests.cpp
+    native/tests/utilities/ProcessJobBatcherTests.cpp
+    native/tests/utilities/SharedMemoryJobChannelTests.cpp
     native/tests/AssetCatalog/AssetCatalogUnitTests.cpp
     native/tests/assetscanner/AssetScannerTests.h
     native/tests/assetscanner/AssetScannerTests.cpp
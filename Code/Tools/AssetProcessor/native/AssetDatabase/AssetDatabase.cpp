@@ -73,6 +73,7 @@ namespace AssetProcessor
             "    LastLogFile      TEXT collate nocase, "
             "    ErrorCount       INTEGER NOT NULL, "
             "    WarningCount     INTEGER NOT NULL, "
+            "    ProcessDurationMs INTEGER NOT NULL DEFAULT 0, "
             "    FOREIGN KEY (SourcePK) REFERENCES "
             "       Sources(SourceID) ON DELETE CASCADE);";
 
@@ -160,6 +161,7 @@ namespace AssetProcessor
             "    IsFolder       INTEGER NOT NULL, "
             "    ModTime        INTEGER NOT NULL, "
             "    Hash           INTEGER NOT NULL, "
+            "    FileSize       INTEGER NOT NULL, "
             "    FOREIGN KEY (ScanFolderPK) REFERENCES "
             "       ScanFolders(ScanFolderID) ON DELETE CASCADE);";
 
@@ -322,10 +324,16 @@ namespace AssetProcessor
 
         static const auto s_GetHighestJobrunkeyQuery = MakeSqlQuery(GET_HIGHEST_JOBRUNKEY, GET_HIGHEST_JOBRUNKEY_STATEMENT, LOG_NAME);
 
+        static const char* GET_AVERAGE_JOB_PROCESS_DURATIONS = "AssetProcessor::GetAverageJobProcessDurations";
+        static const char* GET_AVERAGE_JOB_PROCESS_DURATIONS_STATEMENT =
+            "SELECT BuilderGuid, AVG(ProcessDurationMs) FROM Jobs WHERE ProcessDurationMs > 0 GROUP BY BuilderGuid;";
+
+        static const auto s_GetAverageJobProcessDurationsQuery = MakeSqlQuery(GET_AVERAGE_JOB_PROCESS_DURATIONS, GET_AVERAGE_JOB_PROCESS_DURATIONS_STATEMENT, LOG_NAME);
+
         static const char* INSERT_JOB = "AssetProcessor::InsertJob";
         static const char* INSERT_JOB_STATEMENT =
-            "INSERT INTO Jobs (SourcePK, JobKey, Fingerprint, Platform, BuilderGuid, Status, JobRunKey, FirstFailLogTime, FirstFailLogFile, LastFailLogTime, LastFailLogFile, LastLogTime, LastLogFile, WarningCount, ErrorCount) "
-            "VALUES (:sourceid, :jobkey, :fingerprint, :platform, :builderguid, :status, :jobrunkey, :firstfaillogtime, :firstfaillogfile, :lastfaillogtime, :lastfaillogfile, :lastlogtime, :lastlogfile, :warningcount, :errorcount);";
+            "INSERT INTO Jobs (SourcePK, JobKey, Fingerprint, Platform, BuilderGuid, Status, JobRunKey, FirstFailLogTime, FirstFailLogFile, LastFailLogTime, LastFailLogFile, LastLogTime, LastLogFile, WarningCount, ErrorCount, ProcessDurationMs) "
+            "VALUES (:sourceid, :jobkey, :fingerprint, :platform, :builderguid, :status, :jobrunkey, :firstfaillogtime, :firstfaillogfile, :lastfaillogtime, :lastfaillogfile, :lastlogtime, :lastlogfile, :warningcount, :errorcount, :processdurationms);";
 
         static const auto s_InsertJobQuery = MakeSqlQuery(INSERT_JOB, INSERT_JOB_STATEMENT, LOG_NAME,
             SqlParam<AZ::s64>(":sourceid"),
@@ -342,7 +350,8 @@ namespace AssetProcessor
             SqlParam<AZ::s64>(":lastlogtime"),
             SqlParam<const char*>(":lastlogfile"),
             SqlParam<AZ::u32>(":warningcount"),
-            SqlParam<AZ::u32>(":errorcount")
+            SqlParam<AZ::u32>(":errorcount"),
+            SqlParam<AZ::s64>(":processdurationms")
         );
 
         static const char* UPDATE_JOB = "AssetProcessor::UpdateJob";
@@ -362,7 +371,8 @@ namespace AssetProcessor
             "LastLogTime = :lastlogtime, "
             "LastLogFile = :lastlogfile, "
             "WarningCount = :warningcount, "
-            "ErrorCount = :errorcount "
+            "ErrorCount = :errorcount, "
+            "ProcessDurationMs = :processdurationms "
             "WHERE JobID = :jobid;";
 
         static const auto s_UpdateJobQuery = MakeSqlQuery(UPDATE_JOB, UPDATE_JOB_STATEMENT, LOG_NAME,
@@ -381,6 +391,7 @@ namespace AssetProcessor
             SqlParam<const char*>(":lastlogfile"),
             SqlParam<AZ::u32>(":warningcount"),
             SqlParam<AZ::u32>(":errorcount"),
+            SqlParam<AZ::s64>(":processdurationms"),
             SqlParam<AZ::s64>(":jobid")
         );
 
@@ -662,6 +673,11 @@ namespace AssetProcessor
             "ALTER TABLE Files "
             "ADD Hash INTEGER NOT NULL DEFAULT 0;";
 
+        static const char* INSERT_COLUMN_FILE_SIZE = "AssetProcessor::AddFiles_FileSize";
+        static const char* INSERT_COLUMN_FILE_SIZE_STATEMENT =
+            "ALTER TABLE Files "
+            "ADD FileSize INTEGER NOT NULL DEFAULT 0;";
+
         static const char* INSERT_COLUMN_PRODUCTDEPENDENCY_UNRESOLVEDPATH = "AssetProcessor::AddProductDependency_UnresolvedPath";
         static const char* INSERT_COLUMN_PRODUCTDEPENDENCY_UNRESOLVEDPATH_STATEMENT =
             "ALTER TABLE ProductDependencies "
@@ -677,6 +693,11 @@ namespace AssetProcessor
             "ALTER TABLE ProductDependencies "
             "ADD Platform TEXT NOT NULL collate nocase default('');";
 
+        static const char* INSERT_COLUMN_JOB_PROCESS_DURATION = "AssetProcessor::AddJobs_ProcessDurationMs";
+        static const char* INSERT_COLUMN_JOB_PROCESS_DURATION_STATEMENT =
+            "ALTER TABLE Jobs "
+            "ADD ProcessDurationMs INTEGER NOT NULL DEFAULT 0;";
+
         static const char* INSERT_COLUMNS_JOB_WARNING_COUNT = "AssetProcessor::AddJobs_WarningCount";
         static const char* INSERT_COLUMNS_JOB_WARNING_COUNT_STATEMENT =
             "ALTER TABLE Jobs "
@@ -713,14 +734,15 @@ namespace AssetProcessor
 
         static const char* INSERT_FILE = "AssetProcessor::InsertFile";
         static const char* INSERT_FILE_STATEMENT =
-            "INSERT INTO Files (ScanFolderPK, FileName, IsFolder, ModTime, Hash) "
-            "VALUES (:scanfolderpk, :filename, :isfolder, :modtime, :hash);";
+            "INSERT INTO Files (ScanFolderPK, FileName, IsFolder, ModTime, Hash, FileSize) "
+            "VALUES (:scanfolderpk, :filename, :isfolder, :modtime, :hash, :filesize);";
         static const auto s_InsertFileQuery = MakeSqlQuery(INSERT_FILE, INSERT_FILE_STATEMENT, LOG_NAME,
             SqlParam<AZ::s64>(":scanfolderpk"),
             SqlParam<const char*>(":filename"),
             SqlParam<AZ::s64>(":isfolder"),
             SqlParam<AZ::u64>(":modtime"),
-            SqlParam<AZ::u64>(":hash"));
+            SqlParam<AZ::u64>(":hash"),
+            SqlParam<AZ::u64>(":filesize"));
         
         static const char* UPDATE_FILE = "AssetProcessor::UpdateFile";
         static const char* UPDATE_FILE_STATEMENT =
@@ -729,7 +751,8 @@ namespace AssetProcessor
             "FileName = :filename, "
             "IsFolder = :isfolder, "
             "ModTime = :modtime, "
-            "Hash = :hash "
+            "Hash = :hash, "
+            "FileSize = :filesize "
             "WHERE FileID = :fileid;";
         static const auto s_UpdateFileQuery = MakeSqlQuery(UPDATE_FILE, UPDATE_FILE_STATEMENT, LOG_NAME,
             SqlParam<AZ::s64>(":scanfolderpk"),
@@ -737,18 +760,21 @@ namespace AssetProcessor
             SqlParam<AZ::s64>(":isfolder"),
             SqlParam<AZ::u64>(":modtime"),
             SqlParam<AZ::u64>(":hash"),
+            SqlParam<AZ::u64>(":filesize"),
             SqlParam<AZ::s64>(":fileid"));
 
         static const char* UPDATE_FILE_MODTIME_AND_HASH_BY_FILENAME_SCANFOLDER_ID = "AssetProcessor::UpdateFileModtimeAndHashByFileNameScanFolderId";
         static const char* UPDATE_FILE_MODTIME_AND_HASH_BY_FILENAME_SCANFOLDER_ID_STATEMENT =
             "UPDATE Files SET "
             "ModTime = :modtime, "
-            "Hash = :hash "
+            "Hash = :hash, "
+            "FileSize = :filesize "
             "WHERE FileName = :filename "
             "AND ScanFolderPK = :scanfolderpk;";
         static const auto s_UpdateFileModtimeByFileNameScanFolderIdQuery = MakeSqlQuery(UPDATE_FILE_MODTIME_AND_HASH_BY_FILENAME_SCANFOLDER_ID, UPDATE_FILE_MODTIME_AND_HASH_BY_FILENAME_SCANFOLDER_ID_STATEMENT, LOG_NAME,
             SqlParam<AZ::u64>(":modtime"),
             SqlParam<AZ::u64>(":hash"),
+            SqlParam<AZ::u64>(":filesize"),
             SqlParam<const char*>(":filename"),
             SqlParam<AZ::s64>(":scanfolderpk"));
 
@@ -768,7 +794,8 @@ namespace AssetProcessor
             "DROP INDEX IF EXISTS BuilderGuid_Source_SourceDependency;";
     }
 
-    AssetDatabaseConnection::AssetDatabaseConnection()
+    AssetDatabaseConnection::AssetDatabaseConnection(bool readOnly)
+        : m_readOnly(readOnly)
     {
         qRegisterMetaType<ScanFolderDatabaseEntry>("ScanFolderEntry");
         qRegisterMetaType<SourceDatabaseEntry>("SourceEntry");
@@ -814,6 +841,12 @@ namespace AssetProcessor
 
     bool AssetDatabaseConnection::PostOpenDatabase()
     {
+        if (m_readOnly)
+        {
+            // the writer owns the schema, a reader only checks that it can use it.
+            return AzToolsFramework::AssetDatabase::AssetDatabaseConnection::PostOpenDatabase();
+        }
+
         DatabaseVersion foundVersion = DatabaseVersion::DatabaseDoesNotExist;
 
         if (m_databaseConnection->DoesTableExist("dbinfo"))
@@ -1050,6 +1083,24 @@ namespace AssetProcessor
             }
         }
 
+        if (foundVersion == AssetDatabase::DatabaseVersion::AddedSourceIndexForSourceDependencyTable)
+        {
+            if (m_databaseConnection->ExecuteOneOffStatement(INSERT_COLUMN_FILE_SIZE))
+            {
+                foundVersion = AssetDatabase::DatabaseVersion::AddedFileSizeField;
+                AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Upgraded Asset Database to version %i (AddedFileSizeField)\n", foundVersion)
+            }
+        }
+
+        if (foundVersion == AssetDatabase::DatabaseVersion::AddedFileSizeField)
+        {
+            if (m_databaseConnection->ExecuteOneOffStatement(INSERT_COLUMN_JOB_PROCESS_DURATION))
+            {
+                foundVersion = AssetDatabase::DatabaseVersion::AddedJobProcessDurationField;
+                AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Upgraded Asset Database to version %i (AddedJobProcessDurationField)\n", foundVersion)
+            }
+        }
+
         if (foundVersion == CurrentDatabaseVersion())
         {
             dropAllTables = false;
@@ -1175,9 +1226,11 @@ namespace AssetProcessor
         m_databaseConnection->AddStatement(CREATE_JOBS_TABLE, CREATE_JOBS_TABLE_STATEMENT);
         m_databaseConnection->AddStatement(INSERT_COLUMNS_JOB_WARNING_COUNT, INSERT_COLUMNS_JOB_WARNING_COUNT_STATEMENT);
         m_databaseConnection->AddStatement(INSERT_COLUMNS_JOB_ERROR_COUNT, INSERT_COLUMNS_JOB_ERROR_COUNT_STATEMENT);
+        m_databaseConnection->AddStatement(INSERT_COLUMN_JOB_PROCESS_DURATION, INSERT_COLUMN_JOB_PROCESS_DURATION_STATEMENT);
         m_createStatements.push_back(CREATE_JOBS_TABLE);
 
         AddStatement(m_databaseConnection, s_GetHighestJobrunkeyQuery);
+        AddStatement(m_databaseConnection, s_GetAverageJobProcessDurationsQuery);
         AddStatement(m_databaseConnection, s_InsertJobQuery);
         AddStatement(m_databaseConnection, s_UpdateJobQuery);
         AddStatement(m_databaseConnection, s_DeleteJobQuery);
@@ -1269,6 +1322,7 @@ namespace AssetProcessor
         m_databaseConnection->AddStatement(DELETE_FILE, DELETE_FILE_STATEMENT);
         m_databaseConnection->AddStatement(INSERT_COLUMN_FILE_MODTIME, INSERT_COLUMN_FILE_MODTIME_STATEMENT);
         m_databaseConnection->AddStatement(INSERT_COLUMN_FILE_HASH, INSERT_COLUMN_FILE_HASH_STATEMENT);
+        m_databaseConnection->AddStatement(INSERT_COLUMN_FILE_SIZE, INSERT_COLUMN_FILE_SIZE_STATEMENT);
         m_databaseConnection->AddStatement(INSERT_COLUMN_LAST_SCAN, INSERT_COLUMN_LAST_SCAN_STATEMENT);
         m_databaseConnection->AddStatement(INSERT_COLUMN_SCAN_TIME_SECONDS_SINCE_EPOCH, INSERT_COLUMN_SCAN_TIME_SECONDS_SINCE_EPOCH_STATEMENT);
         // ---------------------------------------------------------------------------------------------
@@ -1344,6 +1398,12 @@ namespace AssetProcessor
         }
     }
 
+    AZStd::unique_ptr<ScopedTransaction> AssetDatabaseConnection::BeginBatchedWrites()
+    {
+        AZ_Assert(m_databaseConnection, "No connection!");
+        return AZStd::make_unique<ScopedTransaction>(m_databaseConnection);
+    }
+
     bool AssetDatabaseConnection::GetScanFolderByScanFolderID(AZ::s64 scanfolderID, ScanFolderDatabaseEntry& entry)
     {
         bool found = false;
@@ -1788,6 +1848,32 @@ namespace AssetProcessor
         return statement->GetColumnInt64(0);
     }
 
+    bool AssetDatabaseConnection::GetAverageJobProcessDurations(AZStd::unordered_map<AZ::Uuid, AZ::s64>& averageDurationMsByBuilder)
+    {
+        if (!m_databaseConnection)
+        {
+            return false;
+        }
+
+        StatementAutoFinalizer autoFinal;
+
+        if (!s_GetAverageJobProcessDurationsQuery.Bind(*m_databaseConnection, autoFinal))
+        {
+            return false;
+        }
+
+        Statement* statement = autoFinal.Get();
+
+        Statement::SqlStatus result = statement->Step();
+        while (result == Statement::SqlOK)
+        {
+            averageDurationMsByBuilder[statement->GetColumnUuid(0)] = statement->GetColumnInt64(1);
+            result = statement->Step();
+        }
+
+        return result == Statement::SqlDone;
+    }
+
     bool AssetDatabaseConnection::GetJobs(JobDatabaseEntryContainer& container, AZ::Uuid builderGuid, QString jobKey, QString platform, JobStatus status)
     {
         bool found = false;
@@ -1971,7 +2057,7 @@ namespace AssetProcessor
 
             if (!s_InsertJobQuery.BindAndStep(*m_databaseConnection, entry.m_sourcePK, entry.m_jobKey.c_str(), entry.m_fingerprint, entry.m_platform.c_str(),
                 entry.m_builderGuid, static_cast<int>(entry.m_status), entry.m_jobRunKey, entry.m_firstFailLogTime, entry.m_firstFailLogFile.c_str(),
-                entry.m_lastFailLogTime, entry.m_lastFailLogFile.c_str(), entry.m_lastLogTime, entry.m_lastLogFile.c_str(), entry.m_warningCount, entry.m_errorCount))
+                entry.m_lastFailLogTime, entry.m_lastFailLogFile.c_str(), entry.m_lastLogTime, entry.m_lastLogFile.c_str(), entry.m_warningCount, entry.m_errorCount, entry.m_processDurationMs))
             {
                 return false;
             }
@@ -2013,7 +2099,7 @@ namespace AssetProcessor
 
             return s_UpdateJobQuery.BindAndStep(*m_databaseConnection, entry.m_sourcePK, entry.m_jobKey.c_str(), entry.m_fingerprint, entry.m_platform.c_str(),
                 entry.m_builderGuid, static_cast<int>(entry.m_status), entry.m_jobRunKey, entry.m_firstFailLogTime, entry.m_firstFailLogFile.c_str(),
-                entry.m_lastFailLogTime, entry.m_lastFailLogFile.c_str(), entry.m_lastLogTime, entry.m_lastLogFile.c_str(), entry.m_warningCount, entry.m_errorCount, entry.m_jobID);
+                entry.m_lastFailLogTime, entry.m_lastFailLogFile.c_str(), entry.m_lastLogTime, entry.m_lastLogFile.c_str(), entry.m_warningCount, entry.m_errorCount, entry.m_processDurationMs, entry.m_jobID);
         }
     }
 
@@ -3074,7 +3160,7 @@ namespace AssetProcessor
         {
             StatementAutoFinalizer autoFinal;
 
-            if (!s_InsertFileQuery.Bind(*m_databaseConnection, autoFinal, entry.m_scanFolderPK, entry.m_fileName.c_str(), static_cast<AZ::s64>(entry.m_isFolder), entry.m_modTime, entry.m_hash))
+            if (!s_InsertFileQuery.Bind(*m_databaseConnection, autoFinal, entry.m_scanFolderPK, entry.m_fileName.c_str(), static_cast<AZ::s64>(entry.m_isFolder), entry.m_modTime, entry.m_hash, entry.m_fileSize))
             {
                 return false;
             }
@@ -3113,7 +3199,7 @@ namespace AssetProcessor
             }
             StatementAutoFinalizer autoFinal;
 
-            if (!s_InsertFileQuery.Bind(*m_databaseConnection, autoFinal, entry.m_scanFolderPK, entry.m_fileName.c_str(), static_cast<AZ::s64>(entry.m_isFolder), entry.m_modTime, entry.m_hash))
+            if (!s_InsertFileQuery.Bind(*m_databaseConnection, autoFinal, entry.m_scanFolderPK, entry.m_fileName.c_str(), static_cast<AZ::s64>(entry.m_isFolder), entry.m_modTime, entry.m_hash, entry.m_fileSize))
             {
                 return false;
             }
@@ -3162,7 +3248,7 @@ namespace AssetProcessor
         }
 
         StatementAutoFinalizer autoFinal;
-        if (!s_UpdateFileQuery.BindAndStep(*m_databaseConnection, entry.m_scanFolderPK, entry.m_fileName.c_str(), entry.m_isFolder, entry.m_modTime, entry.m_hash, entry.m_fileID))
+        if (!s_UpdateFileQuery.BindAndStep(*m_databaseConnection, entry.m_scanFolderPK, entry.m_fileName.c_str(), entry.m_isFolder, entry.m_modTime, entry.m_hash, entry.m_fileSize, entry.m_fileID))
         {
             return false;
         }
@@ -3170,9 +3256,9 @@ namespace AssetProcessor
         return true;
     }
 
-    bool AssetDatabaseConnection::UpdateFileModTimeAndHashByFileNameAndScanFolderId(QString fileName, AZ::s64 scanFolderId, AZ::u64 modTime, AZ::u64 hash)
+    bool AssetDatabaseConnection::UpdateFileModTimeAndHashByFileNameAndScanFolderId(QString fileName, AZ::s64 scanFolderId, AZ::u64 modTime, AZ::u64 hash, AZ::u64 fileSize)
     {
-        if(!s_UpdateFileModtimeByFileNameScanFolderIdQuery.BindAndStep(*m_databaseConnection, modTime, hash, fileName.toUtf8().constData(), scanFolderId))
+        if(!s_UpdateFileModtimeByFileNameScanFolderIdQuery.BindAndStep(*m_databaseConnection, modTime, hash, fileSize, fileName.toUtf8().constData(), scanFolderId))
         {
             return false;
         }
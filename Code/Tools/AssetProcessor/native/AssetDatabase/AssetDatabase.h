@@ -12,7 +12,10 @@
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzToolsFramework/AssetDatabase/AssetDatabaseConnection.h>
+#include <AzToolsFramework/SQLite/SQLiteConnection.h>
 
 #include <QtCore/QSet>
 #include <QtCore/QString>
@@ -32,7 +35,9 @@ namespace AssetProcessor
     public:
         AZ_CLASS_ALLOCATOR(AssetDatabaseConnection, AZ::SystemAllocator, 0);
 
-        AssetDatabaseConnection();
+        //! A read only connection runs the same queries but never creates or upgrades the database, it is meant for
+        //! systems which only read from the database while the Asset Processor Manager writes to it.
+        explicit AssetDatabaseConnection(bool readOnly = false);
         ~AssetDatabaseConnection();
 
         //////////////////////////////////////////////////////////////////////////
@@ -40,10 +45,15 @@ namespace AssetProcessor
     public:
         bool IsReadOnly() const override
         { 
-            return false;// return false, we actually curate/write to this database.
+            return m_readOnly; // by default false, we actually curate/write to this database.
         } 
         void VacuumAndAnalyze();
 
+        //! Opens a transaction which every update made through this connection joins until it is committed, the transactions
+        //! of the individual updates become savepoints in it. Committing many small updates at once is much cheaper than one by one.
+        //! Other connections only see the updates after the commit, and they are rolled back if it is destroyed without committing.
+        AZStd::unique_ptr<AzToolsFramework::SQLite::ScopedTransaction> BeginBatchedWrites();
+
     protected:
         void CreateStatements() override;
         bool PostOpenDatabase() override;
@@ -105,6 +115,8 @@ namespace AssetProcessor
         
         // used to initialize the predictor for job Run Keys
         AZ::s64 GetHighestJobRunKey(); 
+        // average processing time of the previous runs of each builder's jobs, used to estimate the duration of new jobs
+        bool GetAverageJobProcessDurations(AZStd::unordered_map<AZ::Uuid, AZ::s64>& averageDurationMsByBuilder);
         bool GetJobs(AzToolsFramework::AssetDatabase::JobDatabaseEntryContainer& container, AZ::Uuid builderGuid = AZ::Uuid::CreateNull(), QString jobKey = QString(), QString platform = QString(), AzToolsFramework::AssetSystem::JobStatus status = AzToolsFramework::AssetSystem::JobStatus::Any);
         bool GetJobByJobID(AZ::s64 jobID, AzToolsFramework::AssetDatabase::JobDatabaseEntry& entry);
         bool GetJobByProductID(AZ::s64 productID, AzToolsFramework::AssetDatabase::JobDatabaseEntry& entry);
@@ -217,8 +229,8 @@ namespace AssetProcessor
         bool InsertFile(AzToolsFramework::AssetDatabase::FileDatabaseEntry& entry, bool& entryAlreadyExists);
         bool UpdateFile(AzToolsFramework::AssetDatabase::FileDatabaseEntry& entry, bool& entryAlreadyExists);
         
-        // updates the modtime and hash for a file if it exists.  Only returns true if the row existed and was successfully updated
-        bool UpdateFileModTimeAndHashByFileNameAndScanFolderId(QString fileName, AZ::s64 scanFolderId, AZ::u64 modTime, AZ::u64 hash);
+        // updates the modtime, hash and size for a file if it exists.  Only returns true if the row existed and was successfully updated
+        bool UpdateFileModTimeAndHashByFileNameAndScanFolderId(QString fileName, AZ::s64 scanFolderId, AZ::u64 modTime, AZ::u64 hash, AZ::u64 fileSize);
         bool RemoveFile(AZ::s64 sourceID);
     protected:
         void SetDatabaseVersion(AzToolsFramework::AssetDatabase::DatabaseVersion ver);
@@ -226,6 +238,7 @@ namespace AssetProcessor
 
     private:
         AZStd::vector<AZStd::string> m_createStatements; // contains all statements required to create the tables
+        bool m_readOnly = false;
     };
 }//namespace EditorFramework
 
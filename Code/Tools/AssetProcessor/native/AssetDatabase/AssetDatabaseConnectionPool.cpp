@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/AssetDatabase/AssetDatabaseConnectionPool.h>
+
+namespace AssetProcessor
+{
+    AssetDatabaseConnectionPool::ScopedConnection::ScopedConnection(AssetDatabaseConnectionPool* pool, AZStd::unique_ptr<AssetDatabaseConnection> connection)
+        : m_pool(pool)
+        , m_connection(AZStd::move(connection))
+    {
+    }
+
+    AssetDatabaseConnectionPool::ScopedConnection::ScopedConnection(ScopedConnection&& other)
+        : m_pool(other.m_pool)
+        , m_connection(AZStd::move(other.m_connection))
+    {
+        other.m_pool = nullptr;
+    }
+
+    AssetDatabaseConnectionPool::ScopedConnection& AssetDatabaseConnectionPool::ScopedConnection::operator=(ScopedConnection&& other)
+    {
+        if (this != &other)
+        {
+            Release();
+            m_pool = other.m_pool;
+            m_connection = AZStd::move(other.m_connection);
+            other.m_pool = nullptr;
+        }
+        return *this;
+    }
+
+    AssetDatabaseConnectionPool::ScopedConnection::~ScopedConnection()
+    {
+        Release();
+    }
+
+    void AssetDatabaseConnectionPool::ScopedConnection::Release()
+    {
+        if (m_pool && m_connection)
+        {
+            m_pool->Release(AZStd::move(m_connection));
+        }
+        m_pool = nullptr;
+        m_connection.reset();
+    }
+
+    AssetDatabaseConnection* AssetDatabaseConnectionPool::ScopedConnection::get() const
+    {
+        return m_connection.get();
+    }
+
+    AssetDatabaseConnection* AssetDatabaseConnectionPool::ScopedConnection::operator->() const
+    {
+        AZ_Assert(m_connection, "Using an empty asset database connection.");
+        return m_connection.get();
+    }
+
+    AssetDatabaseConnectionPool::ScopedConnection::operator bool() const
+    {
+        return m_connection != nullptr;
+    }
+
+    AssetDatabaseConnectionPool::AssetDatabaseConnectionPool(size_t maxIdleConnections)
+        : m_maxIdleConnections(maxIdleConnections)
+    {
+    }
+
+    AssetDatabaseConnectionPool::~AssetDatabaseConnectionPool()
+    {
+        Clear();
+    }
+
+    AssetDatabaseConnectionPool::ScopedConnection AssetDatabaseConnectionPool::Acquire()
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (!m_idleConnections.empty())
+            {
+                AZStd::unique_ptr<AssetDatabaseConnection> connection = AZStd::move(m_idleConnections.back());
+                m_idleConnections.pop_back();
+                return ScopedConnection(this, AZStd::move(connection));
+            }
+        }
+
+        // opening a connection validates the schema, other threads can keep using the pool meanwhile.
+        auto connection = AZStd::make_unique<AssetDatabaseConnection>(true);
+        if (!connection->OpenDatabase())
+        {
+            AZ_Warning("AssetDatabaseConnectionPool", false, "Unable to open a read only connection to the asset database.");
+            return ScopedConnection();
+        }
+        ++m_openedConnectionCount;
+        return ScopedConnection(this, AZStd::move(connection));
+    }
+
+    void AssetDatabaseConnectionPool::Release(AZStd::unique_ptr<AssetDatabaseConnection> connection)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_idleConnections.size() < m_maxIdleConnections)
+        {
+            m_idleConnections.push_back(AZStd::move(connection));
+        }
+        // otherwise the connection is closed when it goes out of scope.
+    }
+
+    void AssetDatabaseConnectionPool::Clear()
+    {
+        AZStd::vector<AZStd::unique_ptr<AssetDatabaseConnection>> idleConnections;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            idleConnections.swap(m_idleConnections);
+        }
+    }
+
+    AZ::u64 AssetDatabaseConnectionPool::GetOpenedConnectionCount() const
+    {
+        return m_openedConnectionCount;
+    }
+} // namespace AssetProcessor
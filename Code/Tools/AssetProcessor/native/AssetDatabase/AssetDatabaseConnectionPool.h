@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+#include <native/AssetDatabase/AssetDatabase.h>
+
+namespace AssetProcessor
+{
+    //! Hands out read only connections to the asset database so that several threads can query it at the same time,
+    //! instead of taking turns on a single connection. Connections are opened on demand and kept open for reuse.
+    //! The database is in WAL mode, so the readers don't block the Asset Processor Manager writing to it and always see
+    //! the last committed transaction.
+    class AssetDatabaseConnectionPool
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(AssetDatabaseConnectionPool, AZ::SystemAllocator, 0);
+
+        //! A connection checked out of the pool, given back to it when destroyed.
+        class ScopedConnection
+        {
+        public:
+            ScopedConnection() = default;
+            ScopedConnection(AssetDatabaseConnectionPool* pool, AZStd::unique_ptr<AssetDatabaseConnection> connection);
+            ScopedConnection(ScopedConnection&& other);
+            ScopedConnection& operator=(ScopedConnection&& other);
+            ~ScopedConnection();
+
+            AssetDatabaseConnection* get() const;
+            AssetDatabaseConnection* operator->() const;
+            explicit operator bool() const;
+
+            ScopedConnection(const ScopedConnection&) = delete;
+            ScopedConnection& operator=(const ScopedConnection&) = delete;
+
+        private:
+            void Release();
+
+            AssetDatabaseConnectionPool* m_pool = nullptr;
+            AZStd::unique_ptr<AssetDatabaseConnection> m_connection;
+        };
+
+        //! maxIdleConnections is how many connections are kept open once they are given back, any more than that are closed.
+        explicit AssetDatabaseConnectionPool(size_t maxIdleConnections = 8);
+        ~AssetDatabaseConnectionPool();
+
+        //! Returns an idle connection, or opens a new one if there is none. The returned connection is empty if the database
+        //! could not be opened.
+        ScopedConnection Acquire();
+
+        //! Closes the idle connections, the ones currently checked out go back to the pool as usual.
+        void Clear();
+
+        //! Returns how many connections were opened by the pool since it was created.
+        AZ::u64 GetOpenedConnectionCount() const;
+
+        AZ_DISABLE_COPY_MOVE(AssetDatabaseConnectionPool);
+
+    private:
+        void Release(AZStd::unique_ptr<AssetDatabaseConnection> connection);
+
+        AZStd::mutex m_mutex;
+        AZStd::vector<AZStd::unique_ptr<AssetDatabaseConnection>> m_idleConnections;
+        size_t m_maxIdleConnections;
+        AZStd::atomic<AZ::u64> m_openedConnectionCount{ 0 };
+    };
+} // namespace AssetProcessor
@@ -195,8 +195,8 @@ namespace AssetProcessor
 
             bool cyclicDependencyFound = false;
 
-            AZStd::lock_guard<AZStd::mutex> lock(m_databaseMutex);
-            while (!assetStack.empty())
+            AssetDatabaseConnectionPool::ScopedConnection db = m_databasePool.Acquire();
+            while (db && !assetStack.empty())
             {
                 AZ::Data::AssetId assetId = assetStack.top().first;
                 AZ::Data::AssetId parentAssetId = assetStack.top().second;
@@ -212,7 +212,7 @@ namespace AssetProcessor
                 currentVisitedAssetsTree.insert(assetId);
                 currentAssetTree.emplace_back(assetId);
 
-                m_db->QueryProductDependencyBySourceGuidSubId(assetId.m_guid, assetId.m_subId, iter->second.toUtf8().constData(), [&](const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry& entry)
+                db->QueryProductDependencyBySourceGuidSubId(assetId.m_guid, assetId.m_subId, iter->second.toUtf8().constData(), [&](const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry& entry)
                     {
                         auto loadBehavior = AZ::Data::ProductDependencyInfo::LoadBehaviorFromFlags(entry.m_dependencyFlags);
                         if (loadBehavior == AZ::Data::AssetLoadBehavior::PreLoad)
@@ -236,17 +236,17 @@ namespace AssetProcessor
                                 for (const auto& assetIdEntry : currentAssetTree)
                                 {
                                     AzToolsFramework::AssetDatabase::ProductDatabaseEntry productDatabaseEntry;
-                                    m_db->GetProductBySourceGuidSubId(assetIdEntry.m_guid, assetIdEntry.m_subId, productDatabaseEntry);
+                                    db->GetProductBySourceGuidSubId(assetIdEntry.m_guid, assetIdEntry.m_subId, productDatabaseEntry);
                                     cyclicPreloadDependencyTreeString = cyclicPreloadDependencyTreeString + AZStd::string::format("%s ->", productDatabaseEntry.m_productName.c_str());
                                 };
 
                                 AzToolsFramework::AssetDatabase::ProductDatabaseEntry productDatabaseEntry;
-                                m_db->GetProductBySourceGuidSubId(dependentAssetId.m_guid, dependentAssetId.m_subId, productDatabaseEntry);
+                                db->GetProductBySourceGuidSubId(dependentAssetId.m_guid, dependentAssetId.m_subId, productDatabaseEntry);
 
                                 cyclicPreloadDependencyTreeString = cyclicPreloadDependencyTreeString + AZStd::string::format(" %s ", productDatabaseEntry.m_productName.c_str());
 
                                 AzToolsFramework::AssetDatabase::ProductDatabaseEntry productDatabaseRootEntry;
-                                m_db->GetProductBySourceGuidSubId(iter->first.m_guid, iter->first.m_subId, productDatabaseRootEntry);
+                                db->GetProductBySourceGuidSubId(iter->first.m_guid, iter->first.m_subId, productDatabaseRootEntry);
 
                                 AZ_Error(AssetProcessor::ConsoleChannel, false, "Preload circular dependency detected while processing asset (%s).\n Preload hierarchy is %s . Adjust your product dependencies for assets in this chain to break this loop.",
                                     productDatabaseRootEntry.m_productName.c_str(), cyclicPreloadDependencyTreeString.c_str());
@@ -404,18 +404,20 @@ namespace AssetProcessor
         }
 
         {
-            AZStd::lock_guard<AZStd::mutex> lock(m_databaseMutex);
-
-            m_db->QueryProductDependencyBySourceGuidSubId(messageData.m_message->m_assetId.m_guid, messageData.m_message->m_assetId.m_subId, messageData.m_platform.toUtf8().constData(), [&response](const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry& entry)
-                {
-                    if (!entry.m_unresolvedPath.empty() && entry.m_unresolvedPath.find('*') == entry.m_unresolvedPath.npos
-                        && !entry.m_unresolvedPath.starts_with(ExcludedDependenciesSymbol))
+            AssetDatabaseConnectionPool::ScopedConnection db = m_databasePool.Acquire();
+            if (db)
+            {
+                db->QueryProductDependencyBySourceGuidSubId(messageData.m_message->m_assetId.m_guid, messageData.m_message->m_assetId.m_subId, messageData.m_platform.toUtf8().constData(), [&response](const AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry& entry)
                     {
-                        ++response.m_unresolvedPathReferences;
-                    }
+                        if (!entry.m_unresolvedPath.empty() && entry.m_unresolvedPath.find('*') == entry.m_unresolvedPath.npos
+                            && !entry.m_unresolvedPath.starts_with(ExcludedDependenciesSymbol))
+                        {
+                            ++response.m_unresolvedPathReferences;
+                        }
 
-                    return true;
-                });
+                        return true;
+                    });
+            }
         }
 
         return response;
@@ -465,7 +467,11 @@ namespace AssetProcessor
         m_catalogIsDirty = true;
         m_registryBuiltOnce = true;
 
-        AZStd::lock_guard<AZStd::mutex> lock(m_databaseMutex);
+        AssetDatabaseConnectionPool::ScopedConnection db = m_databasePool.Acquire();
+        if (!db)
+        {
+            return;
+        }
         QMutexLocker locker(&m_registriesMutex);
 
         for (QString platform : m_platforms)
@@ -520,14 +526,14 @@ namespace AssetProcessor
                     return true;//see them all
                 };
 
-            m_db->QueryCombined(
+            db->QueryCombined(
                 databaseQueryCallback, AZ::Uuid::CreateNull(),
                 nullptr,
                 platform.toUtf8().constData(),
                 AzToolsFramework::AssetSystem::JobStatus::Any,
                 true); /*we still need legacy IDs - hardly anyone else does*/
 
-            m_db->QueryProductDependenciesTable([this, &platform](AZ::Data::AssetId& assetId, AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry& entry)
+            db->QueryProductDependenciesTable([this, &platform](AZ::Data::AssetId& assetId, AzToolsFramework::AssetDatabase::ProductDependencyDatabaseEntry& entry)
             {
                 if (AzFramework::StringFunc::Equal(entry.m_platform.c_str(), platform.toUtf8().data()))
                 {
@@ -987,17 +993,17 @@ namespace AssetProcessor
         // Check the database first for the UUID now that we have the "database name" (which includes output prefix)
 
         {
-            AZStd::lock_guard<AZStd::mutex> lock(m_databaseMutex);
+            AssetDatabaseConnectionPool::ScopedConnection db = m_databasePool.Acquire();
             AzToolsFramework::AssetDatabase::SourceDatabaseEntryContainer returnedSources;
 
-            if (m_db->GetSourcesBySourceName(databaseName, returnedSources))
+            if (db && db->GetSourcesBySourceName(databaseName, returnedSources))
             {
                 if (!returnedSources.empty())
                 {
                     AzToolsFramework::AssetDatabase::SourceDatabaseEntry& entry = returnedSources.front();
 
                     AzToolsFramework::AssetDatabase::ScanFolderDatabaseEntry scanEntry;
-                    if (m_db->GetScanFolderByScanFolderID(entry.m_scanFolderPK, scanEntry))
+                    if (db->GetScanFolderByScanFolderID(entry.m_scanFolderPK, scanEntry))
                     {
                         watchFolder = scanEntry.m_scanFolder;
                         // since we are returning the UUID of a source file, as opposed to the full assetId of a product file produced by that source file,
@@ -1074,15 +1080,15 @@ namespace AssetProcessor
 
     bool AssetCatalog::GetAssetsProducedBySourceUUID(const AZ::Uuid& sourceUuid, AZStd::vector<AZ::Data::AssetInfo>& productsAssetInfo)
     {
-        AZStd::lock_guard<AZStd::mutex> lock(m_databaseMutex);
+        AssetDatabaseConnectionPool::ScopedConnection db = m_databasePool.Acquire();
 
         AzToolsFramework::AssetDatabase::SourceDatabaseEntry entry;
 
-        if (m_db->GetSourceBySourceGuid(sourceUuid, entry))
+        if (db && db->GetSourceBySourceGuid(sourceUuid, entry))
         {
             AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer products;
 
-            if (m_db->GetProductsBySourceID(entry.m_sourceID, products))
+            if (db->GetProductsBySourceID(entry.m_sourceID, products))
             {
                 for (const AzToolsFramework::AssetDatabase::ProductDatabaseEntry& product : products)
                 {
@@ -1247,10 +1253,10 @@ namespace AssetProcessor
 
                     if (m_platformConfig->ConvertToRelativePath(overridingFile, relativeName, scanFolder))
                     {
-                        AZStd::lock_guard<AZStd::mutex> lock(m_databaseMutex);
+                        AssetDatabaseConnectionPool::ScopedConnection db = m_databasePool.Acquire();
                         AzToolsFramework::AssetDatabase::ProductDatabaseEntryContainer products;
 
-                        if (m_db->GetProductsBySourceName(relativeName, products))
+                        if (db && db->GetProductsBySourceName(relativeName, products))
                         {
                             resultCode = ConvertDatabaseProductPathToProductFilename(products[0].m_productName, productFileName);
                         }
@@ -1326,10 +1332,14 @@ namespace AssetProcessor
             //remove aliases if present
             normalisedAssetPath = AssetUtilities::NormalizeAndRemoveAlias(normalisedAssetPath);
 
+            AssetDatabaseConnectionPool::ScopedConnection db;
             if (!normalisedAssetPath.isEmpty()) // this happens if it comes in as just for example "@products@/"
             {
-                AZStd::lock_guard<AZStd::mutex> lock(m_databaseMutex);
+                db = m_databasePool.Acquire();
+            }
 
+            if (db)
+            {
                 //We should have the asset now, we can now find the full asset path
                 // we have to check each platform individually until we get a hit.
                 const auto& platforms = m_platformConfig->GetEnabledPlatforms();
@@ -1337,7 +1347,7 @@ namespace AssetProcessor
                 for (const AssetBuilderSDK::PlatformInfo& platformInfo : platforms)
                 {
                     QString platformName = QString::fromUtf8(platformInfo.m_identifier.c_str());
-                    productName = AssetUtilities::GuessProductNameInDatabase(normalisedAssetPath, platformName, m_db.get());
+                    productName = AssetUtilities::GuessProductNameInDatabase(normalisedAssetPath, platformName, db.get());
                     if (!productName.isEmpty())
                     {
                         break;
@@ -1348,7 +1358,7 @@ namespace AssetProcessor
                 {
                     //Now find the input name for the path,if we are here this should always return true since we were able to find the productName before
                     AzToolsFramework::AssetDatabase::SourceDatabaseEntryContainer sources;
-                    if (m_db->GetSourcesByProductName(productName, sources))
+                    if (db->GetSourcesByProductName(productName, sources))
                     {
                         //Once we have found the inputname we will try finding the full path
                         fullAssetPath = m_platformConfig->FindFirstMatchingFile(sources[0].m_sourceName.c_str());
@@ -1410,13 +1420,13 @@ namespace AssetProcessor
     {
         // Check the database first
         {
-            AZStd::lock_guard<AZStd::mutex> lock(m_databaseMutex);
+            AssetDatabaseConnectionPool::ScopedConnection db = m_databasePool.Acquire();
             AzToolsFramework::AssetDatabase::SourceDatabaseEntry entry;
 
-            if (m_db->GetSourceBySourceGuid(assetId.m_guid, entry))
+            if (db && db->GetSourceBySourceGuid(assetId.m_guid, entry))
             {
                 AzToolsFramework::AssetDatabase::ScanFolderDatabaseEntry scanEntry;
-                if (m_db->GetScanFolderByScanFolderID(entry.m_scanFolderPK, scanEntry))
+                if (db->GetScanFolderByScanFolderID(entry.m_scanFolderPK, scanEntry))
                 {
                     relativePath = entry.m_sourceName;
 
@@ -1638,25 +1648,16 @@ namespace AssetProcessor
 
     bool AssetCatalog::ConnectToDatabase()
     {
-        AZStd::lock_guard<AZStd::mutex> lock(m_databaseMutex);
+        AZStd::string databaseLocation;
+        AzToolsFramework::AssetDatabase::AssetDatabaseRequestsBus::Broadcast(&AzToolsFramework::AssetDatabase::AssetDatabaseRequests::GetAssetDatabaseLocation, databaseLocation);
 
-        if (!m_db)
+        if (databaseLocation.empty())
         {
-            AZStd::string databaseLocation;
-            AzToolsFramework::AssetDatabase::AssetDatabaseRequestsBus::Broadcast(&AzToolsFramework::AssetDatabase::AssetDatabaseRequests::GetAssetDatabaseLocation, databaseLocation);
-
-            if (!databaseLocation.empty())
-            {
-                m_db = AZStd::make_unique<AssetProcessor::AssetDatabaseConnection>();
-                m_db->OpenDatabase();
-
-                return true;
-            }
-
             return false;
         }
 
-        return true;
+        // open the first connection right away, the pool keeps it for the first query.
+        return static_cast<bool>(m_databasePool.Acquire());
     }
 
     void AssetCatalog::AsyncAssetCatalogStatusRequest()
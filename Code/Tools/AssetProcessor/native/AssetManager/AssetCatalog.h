@@ -18,6 +18,7 @@
 #include <QHash>
 #include <QDir>
 #include "native/AssetDatabase/AssetDatabase.h"
+#include "native/AssetDatabase/AssetDatabaseConnectionPool.h"
 #include "native/assetprocessor.h"
 #include "native/utilities/AssetUtilEBusHelper.h"
 #include "native/utilities/PlatformConfiguration.h"
@@ -178,8 +179,8 @@ namespace AssetProcessor
         AZStd::unordered_map<AZStd::string, AZ::Data::AssetType> m_sourceAssetTypeFilters;
         AZStd::mutex m_sourceAssetTypesMutex;
 
-        //! Used to protect access to the database connection, only one thread can use it at a time
-        AZStd::mutex m_databaseMutex;
+        //! Read only connections to the database, each query checks one out so that requests from several threads run concurrently
+        AssetDatabaseConnectionPool m_databasePool;
 
         struct SourceInfo
         {
@@ -198,7 +199,6 @@ namespace AssetProcessor
         QHash<QString, AzFramework::AssetRegistry> m_registries; // per platform.
         AssetProcessor::PlatformConfiguration* m_platformConfig;
         QStringList m_platforms;
-        AZStd::unique_ptr<AssetDatabaseConnection> m_db;
         QDir m_cacheRoot;
 
         bool m_registryBuiltOnce;
@@ -10,10 +10,17 @@
 #include "native/utilities/assetUtils.h"
 #include <AssetProcessor_Traits_Platform.h>
 
+#include <AzCore/std/algorithm.h>
 #include <QDir>
+#include <QSemaphore>
+#include <QThread>
 
 namespace AssetProcessor
 {
+    FileStateCache::FileStateCache()
+    {
+        m_hashThreadPool.setMaxThreadCount(AZStd::clamp(QThread::idealThreadCount(), 1, MaxHashThreads));
+    }
 
     bool FileStateCache::GetFileInfo(const QString& absolutePath, FileStateInfo* foundFileInfo) const
     {
@@ -39,30 +46,85 @@ namespace AssetProcessor
 
     bool FileStateCache::GetHash(const QString& absolutePath, FileHash* foundHash)
     {
-        LockGuardType scopeLock(m_mapMutex);
-        auto fileInfoItr = m_fileInfoMap.find(PathToKey(absolutePath));
+        const QString key = PathToKey(absolutePath);
+        AZStd::shared_ptr<PendingHash> pendingHash;
+        bool computeHash = false;
 
-        if(fileInfoItr == m_fileInfoMap.end())
         {
-            // No info on this file, return false
-            return false;
-        }
+            LockGuardType scopeLock(m_mapMutex);
+            auto fileInfoItr = m_fileInfoMap.find(key);
+
+            if (fileInfoItr == m_fileInfoMap.end())
+            {
+                // No info on this file, return false
+                return false;
+            }
+
+            auto itr = m_fileHashMap.find(key);
+
+            if (itr != m_fileHashMap.end())
+            {
+                *foundHash = itr.value();
+                return true;
+            }
 
-        auto itr = m_fileHashMap.find(PathToKey(absolutePath));
+            auto pendingItr = m_pendingHashMap.find(key);
+            if (pendingItr != m_pendingHashMap.end())
+            {
+                // Another thread is already hashing this file
+                pendingHash = pendingItr.value();
+            }
+            else
+            {
+                pendingHash = AZStd::make_shared<PendingHash>();
+                m_pendingHashMap[key] = pendingHash;
+                computeHash = true;
+            }
+        }
 
-        if (itr != m_fileHashMap.end())
+        if (!computeHash)
         {
-            *foundHash = itr.value();
+            *foundHash = pendingHash->WaitForResult();
             return true;
         }
 
-        // There's no hash stored yet or its been invalidated, calculate it
+        // There's no hash stored yet or its been invalidated, calculate it.
+        // This is done without holding the lock so other files can be looked up and hashed meanwhile.
         *foundHash = AssetUtilities::GetFileHash(absolutePath.toUtf8().constData(), true);
 
-        m_fileHashMap[PathToKey(absolutePath)] = *foundHash;
+        {
+            LockGuardType scopeLock(m_mapMutex);
+            auto pendingItr = m_pendingHashMap.find(key);
+
+            // If the file was updated or removed while it was being hashed the result is out of date, don't cache it
+            if (pendingItr != m_pendingHashMap.end() && pendingItr.value() == pendingHash)
+            {
+                m_pendingHashMap.erase(pendingItr);
+                m_fileHashMap[key] = *foundHash;
+            }
+        }
+
+        pendingHash->SetResult(*foundHash);
         return true;
     }
 
+    void FileStateCache::PrecomputeHashes(const QStringList& absolutePaths)
+    {
+        QSemaphore hashesDone;
+
+        for (const QString& absolutePath : absolutePaths)
+        {
+            m_hashThreadPool.start([this, absolutePath, &hashesDone]()
+            {
+                FileHash hash = 0;
+                GetHash(absolutePath, &hash);
+                hashesDone.release();
+            });
+        }
+
+        hashesDone.acquire(absolutePaths.size());
+    }
+
     void FileStateCache::AddInfoSet(QSet<AssetFileInfo> infoSet)
     {
         LockGuardType scopeLock(m_mapMutex);
@@ -127,12 +189,33 @@ namespace AssetProcessor
 
     void FileStateCache::InvalidateHash(const QString& absolutePath)
     {
-        auto fileHashItr = m_fileHashMap.find(PathToKey(absolutePath));
+        const QString key = PathToKey(absolutePath);
+        auto fileHashItr = m_fileHashMap.find(key);
 
         if (fileHashItr != m_fileHashMap.end())
         {
             m_fileHashMap.erase(fileHashItr);
         }
+
+        // A hash in progress was started on the previous contents, make sure its result doesn't get cached
+        m_pendingHashMap.remove(key);
+    }
+
+    void FileStateCache::PendingHash::SetResult(FileHash hash)
+    {
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_hash = hash;
+            m_done = true;
+        }
+        m_condition.notify_all();
+    }
+
+    FileStateCache::FileHash FileStateCache::PendingHash::WaitForResult()
+    {
+        AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+        m_condition.wait(lock, [this]() { return m_done; });
+        return m_hash;
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -205,6 +288,11 @@ namespace AssetProcessor
         return true;
     }
 
+    void FileStatePassthrough::PrecomputeHashes(const QStringList& /*absolutePaths*/)
+    {
+        // Nothing is cached, every GetHash call reads the file
+    }
+
     bool FileStateInfo::operator==(const FileStateInfo& rhs) const
     {
         return m_absolutePath == rhs.m_absolutePath
@@ -13,7 +13,12 @@
 #include <QString>
 #include <QSet>
 #include <QFileInfo>
+#include <QStringList>
+#include <QThreadPool>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 namespace AssetProcessor
 {
@@ -51,6 +56,8 @@ namespace AssetProcessor
         /// Convenience function to check if a file or directory exists.
         virtual bool Exists(const QString& absolutePath) const = 0;
         virtual bool GetHash(const QString& absolutePath, FileHash* foundHash) = 0;
+        /// Hashes the given files concurrently so later GetHash calls for them are served from the cache.  Blocks until done.
+        virtual void PrecomputeHashes(const QStringList& absolutePaths) = 0;
 
         AZ_DISABLE_COPY_MOVE(IFileStateRequests);
     };
@@ -88,20 +95,36 @@ namespace AssetProcessor
         public FileStateBase
     {
     public:
-
+        FileStateCache();
 
         // FileStateRequestBus implementation
         bool GetFileInfo(const QString& absolutePath, FileStateInfo* foundFileInfo) const override;
         bool Exists(const QString& absolutePath) const override;
         bool GetHash(const QString& absolutePath, FileHash* foundHash) override;
+        void PrecomputeHashes(const QStringList& absolutePaths) override;
 
         void AddInfoSet(QSet<AssetFileInfo> infoSet) override;
         void AddFile(const QString& absolutePath) override;
         void UpdateFile(const QString& absolutePath) override;
         void RemoveFile(const QString& absolutePath) override;
 
+        /// Upper bound of threads used by PrecomputeHashes
+        static constexpr int MaxHashThreads = 8;
+
     private:
 
+        /// A hash being computed by one thread, other threads asking for the same file wait for it instead of hashing it again
+        struct PendingHash
+        {
+            void SetResult(FileHash hash);
+            FileHash WaitForResult();
+
+            AZStd::mutex m_mutex;
+            AZStd::condition_variable m_condition;
+            FileHash m_hash = 0;
+            bool m_done = false;
+        };
+
         /// Invalidates the hash for a file so it will be re-computed next time it's requested
         void InvalidateHash(const QString& absolutePath);
 
@@ -119,6 +142,11 @@ namespace AssetProcessor
         
         QHash<QString, FileHash> m_fileHashMap;
 
+        /// Hashes currently being computed, files are hashed outside of m_mapMutex
+        QHash<QString, AZStd::shared_ptr<PendingHash>> m_pendingHashMap;
+
+        QThreadPool m_hashThreadPool;
+
         using LockGuardType = AZStd::lock_guard<decltype(m_mapMutex)>;
     };
 
@@ -131,5 +159,6 @@ namespace AssetProcessor
         bool GetFileInfo(const QString& absolutePath, FileStateInfo* foundFileInfo) const override;
         bool Exists(const QString& absolutePath) const override;
         bool GetHash(const QString& absolutePath, FileHash* foundHash) override;
+        void PrecomputeHashes(const QStringList& absolutePaths) override;
     };
 } // namespace AssetProcessor
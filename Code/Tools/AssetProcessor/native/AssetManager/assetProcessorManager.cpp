@@ -24,6 +24,7 @@
 #include <AzToolsFramework/API/AssetDatabaseBus.h>
 
 #include <native/AssetManager/PathDependencyManager.h>
+#include <native/AssetManager/FileStateCache.h>
 #include <native/utilities/BuilderConfigurationBus.h>
 
 #include "AssetRequestHandler.h"
@@ -52,6 +53,7 @@ namespace AssetProcessor
         MigrateScanFolders();
 
         m_highestJobRunKeySoFar = m_stateData->GetHighestJobRunKey() + 1;
+        m_stateData->GetAverageJobProcessDurations(m_averageProcessDurationMsByBuilder);
 
         // cache this up front.  Note that it can fail here, and will retry later.
         InitializeCacheRoot();
@@ -125,6 +127,7 @@ namespace AssetProcessor
             m_sourceFilesInDatabase.clear();
             m_fileModTimes.clear();
             m_fileHashes.clear();
+            m_fileSizes.clear();
 
             auto sourcesFunction = [this](AzToolsFramework::AssetDatabase::SourceAndScanFolderDatabaseEntry& entry)
             {
@@ -164,6 +167,7 @@ namespace AssetProcessor
                 QString finalAbsolute = (QString("%1/%2").arg(scanFolderPath).arg(relativeToScanFolderPath));
                 m_fileModTimes.emplace(finalAbsolute.toUtf8().data(), entry.m_modTime);
                 m_fileHashes.emplace(finalAbsolute.toUtf8().constData(), entry.m_hash);
+                m_fileSizes.emplace(finalAbsolute.toUtf8().constData(), entry.m_fileSize);
 
                 return true;
             });
@@ -951,6 +955,12 @@ namespace AssetProcessor
             }
         }
 
+        // the database updates of every job in the list go into a single transaction, which is much cheaper than committing them
+        // one by one. Whatever lets other threads and processes know about the results is deferred until it is committed,
+        // since they look the results up through their own connections to the database.
+        AZStd::unique_ptr<AzToolsFramework::SQLite::ScopedTransaction> batchedWrites = m_stateData->BeginBatchedWrites();
+        AZStd::vector<AZStd::function<void()>> notifications;
+
         //process the asset list
         for (AssetProcessedEntry& processedAsset : m_assetProcessedList)
         {
@@ -1000,7 +1010,13 @@ namespace AssetProcessor
             job.m_platform = processedAsset.m_entry.m_platformInfo.m_identifier;
             job.m_builderGuid = processedAsset.m_entry.m_builderGuid;
             job.m_jobRunKey = processedAsset.m_entry.m_jobRunKey;
+            job.m_processDurationMs = processedAsset.m_entry.m_processDurationMs;
 
+            if (job.m_processDurationMs > 0)
+            {
+                // only seeds builders that have no history yet, the averages are refreshed from the database on the next start
+                m_averageProcessDurationMsByBuilder.emplace(job.m_builderGuid, job.m_processDurationMs);
+            }
 
             if (!AZ::IO::FileIOBase::GetInstance()->Exists(job.m_lastLogFile.c_str()))
             {
@@ -1157,7 +1173,7 @@ namespace AssetProcessor
 
                         // we still need to tell everyone that its gone!
 
-                        Q_EMIT AssetMessage(message); // we notify that we are aware of a missing product either way.
+                        notifications.push_back([this, message]() { Q_EMIT AssetMessage(message); }); // we notify that we are aware of a missing product either way.
                     }
                     else
                     {
@@ -1172,7 +1188,7 @@ namespace AssetProcessor
                         else
                         {
                             AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Deleting file %s because the recompiled input file no longer emitted that product.\n", fullProductPath.toUtf8().constData());
-                            Q_EMIT AssetMessage(message); // we notify that we are aware of a missing product either way.
+                            notifications.push_back([this, message]() { Q_EMIT AssetMessage(message); }); // we notify that we are aware of a missing product either way.
                         }
                     }
                 }
@@ -1333,28 +1349,37 @@ namespace AssetProcessor
                     }
                 }
 
-                Q_EMIT AssetMessage( message);
+                notifications.push_back([this, message]() { Q_EMIT AssetMessage(message); });
                 
                 AddKnownFoldersRecursivelyForFile(fullProductPath, m_cacheRootDir.absolutePath());
             }
 
-            QString fullSourcePath = processedAsset.m_entry.GetAbsoluteSourcePath();
+            notifications.push_back([this, entry = processedAsset.m_entry]()
+            {
+                QString fullSourcePath = entry.GetAbsoluteSourcePath();
 
-            // notify the system about inputs:
-            Q_EMIT InputAssetProcessed(fullSourcePath, QString(processedAsset.m_entry.m_platformInfo.m_identifier.c_str()));
-            Q_EMIT AddedToCatalog(processedAsset.m_entry);
-            OnJobStatusChanged(processedAsset.m_entry, JobStatus::Completed);
+                // notify the system about inputs:
+                Q_EMIT InputAssetProcessed(fullSourcePath, QString(entry.m_platformInfo.m_identifier.c_str()));
+                Q_EMIT AddedToCatalog(entry);
+                OnJobStatusChanged(entry, JobStatus::Completed);
 
-            // notify the analysis tracking system of our success (each processed entry is one job)
-            // do this after the various checks above and database updates, so that the finalization step can take it all into account if it needs to.
-            UpdateAnalysisTrackerForFile(processedAsset.m_entry, AnalysisTrackerUpdateType::JobFinished);
+                // notify the analysis tracking system of our success (each processed entry is one job)
+                // do this after the various checks above and database updates, so that the finalization step can take it all into account if it needs to.
+                UpdateAnalysisTrackerForFile(entry, AnalysisTrackerUpdateType::JobFinished);
 
-            if (!QFile::exists(fullSourcePath))
-            {
-                AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Source file %s deleted during processing - re-checking...\n",
-                    fullSourcePath.toUtf8().constData());
-                AssessFileInternal(fullSourcePath, true);
-            }
+                if (!QFile::exists(fullSourcePath))
+                {
+                    AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Source file %s deleted during processing - re-checking...\n",
+                        fullSourcePath.toUtf8().constData());
+                    AssessFileInternal(fullSourcePath, true);
+                }
+            });
+        }
+
+        batchedWrites->Commit();
+        for (const AZStd::function<void()>& notification : notifications)
+        {
+            notification();
         }
 
         m_assetProcessedList.clear();
@@ -1489,7 +1514,8 @@ namespace AssetProcessor
 
                     m_stateData->UpdateFileModTimeAndHashByFileNameAndScanFolderId(databaseName, scanFolder->ScanFolderID(),
                         AssetUtilities::AdjustTimestamp(metadataFileInfo.lastModified()),
-                        AssetUtilities::GetFileHash(metadataFileInfo.absoluteFilePath().toUtf8().constData()));
+                        AssetUtilities::GetFileHash(metadataFileInfo.absoluteFilePath().toUtf8().constData()),
+                        metadataFileInfo.size());
                 }
                 else
                 {
@@ -2039,7 +2065,8 @@ namespace AssetProcessor
 
             m_stateData->UpdateFileModTimeAndHashByFileNameAndScanFolderId(databaseSourceFile, scanFolder->ScanFolderID(),
                 AssetUtilities::AdjustTimestamp(lastModifiedTime),
-                AssetUtilities::GetFileHash(fileInfo.absoluteFilePath().toUtf8().constData()));
+                AssetUtilities::GetFileHash(fileInfo.absoluteFilePath().toUtf8().constData()),
+                fileInfo.size());
         }
     }
 
@@ -2143,6 +2170,21 @@ namespace AssetProcessor
 
             lowerCasePath = lowerCasePath.toLower();
             jobDetails.m_destinationPath = m_cacheRootDir.absoluteFilePath(lowerCasePath);
+
+            // estimate how long the job will take for the critical path scheduler, preferring the last run of this exact job
+            // and falling back to the average of all jobs of the same builder.
+            if (foundInDatabase && jobs[0].m_processDurationMs > 0)
+            {
+                jobDetails.m_estimatedProcessDurationMs = jobs[0].m_processDurationMs;
+            }
+            else
+            {
+                auto foundAverage = m_averageProcessDurationMsByBuilder.find(jobDetails.m_jobEntry.m_builderGuid);
+                if (foundAverage != m_averageProcessDurationMsByBuilder.end())
+                {
+                    jobDetails.m_estimatedProcessDurationMs = foundAverage->second;
+                }
+            }
         }
 
         return true;
@@ -2818,6 +2860,11 @@ namespace AssetProcessor
     {
         int processedFileCount = 0;
 
+        if (m_allowModtimeSkippingFeature)
+        {
+            PrecomputeFileHashes(filePaths);
+        }
+
         for (const AssetFileInfo& fileInfo : filePaths)
         {
             if (m_allowModtimeSkippingFeature)
@@ -2833,7 +2880,7 @@ namespace AssetProcessor
                         m_platformConfig->ConvertToRelativePath(fileInfo.m_filePath, fileInfo.m_scanFolder, databaseName);
 
                         // Update the modtime in the db since its possible that the hash is the same, but the modtime is out of date.  Recording the current modtime will allow us to skip hashing the file in the future if no changes are made
-                        bool updated = m_stateData->UpdateFileModTimeAndHashByFileNameAndScanFolderId(databaseName, fileInfo.m_scanFolder->ScanFolderID(), AssetUtilities::AdjustTimestamp(fileInfo.m_modTime), fileHash);
+                        bool updated = m_stateData->UpdateFileModTimeAndHashByFileNameAndScanFolderId(databaseName, fileInfo.m_scanFolder->ScanFolderID(), AssetUtilities::AdjustTimestamp(fileInfo.m_modTime), fileHash, fileInfo.m_fileSize);
 
                         if(!updated)
                         {
@@ -2855,6 +2902,53 @@ namespace AssetProcessor
         }
     }
 
+    void AssetProcessorManager::PrecomputeFileHashes(const QSet<AssetFileInfo>& filePaths)
+    {
+        if (m_buildersAddedOrRemoved || !AssetUtilities::ShouldUseFileHashing())
+        {
+            return;
+        }
+
+        auto* fileStateInterface = AZ::Interface<AssetProcessor::IFileStateRequests>::Get();
+        if (!fileStateInterface)
+        {
+            return;
+        }
+
+        // Mirrors the checks of CanSkipProcessingFile: only files with a changed modtime, a known hash and an unchanged size get hashed
+        QStringList filesToHash;
+        for (const AssetFileInfo& fileInfo : filePaths)
+        {
+            const AZStd::string filePath = fileInfo.m_filePath.toUtf8().constData();
+
+            auto modTimeItr = m_fileModTimes.find(filePath);
+            if (modTimeItr == m_fileModTimes.end() || modTimeItr->second == 0 ||
+                modTimeItr->second == AssetUtilities::AdjustTimestamp(fileInfo.m_modTime))
+            {
+                continue;
+            }
+
+            auto hashItr = m_fileHashes.find(filePath);
+            if (hashItr == m_fileHashes.end() || hashItr->second == 0)
+            {
+                continue;
+            }
+
+            auto sizeItr = m_fileSizes.find(filePath);
+            if (sizeItr != m_fileSizes.end() && sizeItr->second != 0 && sizeItr->second != fileInfo.m_fileSize)
+            {
+                continue;
+            }
+
+            filesToHash.append(fileInfo.m_filePath);
+        }
+
+        if (!filesToHash.isEmpty())
+        {
+            fileStateInterface->PrecomputeHashes(filesToHash);
+        }
+    }
+
     bool AssetProcessorManager::CanSkipProcessingFile(const AssetFileInfo &fileInfo, AZ::u64& fileHashOut)
     {
         // Check to see if the file has changed since the last time we saw it
@@ -2885,6 +2979,20 @@ namespace AssetProcessor
             return false;
         }
 
+        // A size of 0 is either an empty file or a row recorded before sizes were stored, only compare known sizes
+        auto sizeItr = m_fileSizes.find(fileInfo.m_filePath.toUtf8().constData());
+        if (sizeItr != m_fileSizes.end())
+        {
+            AZ::u64 databaseFileSize = sizeItr->second;
+            m_fileSizes.erase(sizeItr);
+
+            if (databaseFileSize != 0 && databaseFileSize != fileInfo.m_fileSize)
+            {
+                // File size has changed, the contents have changed as well so there is no need to hash it
+                return false;
+            }
+        }
+
         auto thisModTime = aznumeric_cast<decltype(databaseModTime)>(AssetUtilities::AdjustTimestamp(fileInfo.m_modTime));
 
         if (databaseModTime != thisModTime)
@@ -4399,7 +4507,8 @@ namespace AssetProcessor
 
         m_stateData->UpdateFileModTimeAndHashByFileNameAndScanFolderId(databaseSourceName.toUtf8().constData(), scanFolderPk,
             AssetUtilities::AdjustTimestamp(lastModifiedTime),
-            AssetUtilities::GetFileHash(fileInfo.absoluteFilePath().toUtf8().constData()));
+            AssetUtilities::GetFileHash(fileInfo.absoluteFilePath().toUtf8().constData()),
+            fileInfo.size());
 
         m_remainingJobsForEachSourceFile.erase(foundTrackingInfo);
     }
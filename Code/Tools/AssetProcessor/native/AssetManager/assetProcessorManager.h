@@ -367,6 +367,9 @@ namespace AssetProcessor
         // Checks whether or not a file can be skipped for processing (ie, file content hasn't changed, builders haven't been added/removed, builders for the file haven't changed)
         bool CanSkipProcessingFile(const AssetFileInfo &fileInfo, AZ::u64& fileHash);
 
+        // Hashes the scanned files CanSkipProcessingFile will need to hash concurrently, ahead of checking them one by one
+        void PrecomputeFileHashes(const QSet<AssetFileInfo>& filePaths);
+
         AZ::s64 GenerateNewJobRunKey();
         // Attempt to erase a log file.  Failing to erase it is not a critical problem, but should be logged.
         // returns true if there is no log file there after this operation completes
@@ -429,6 +432,9 @@ namespace AssetProcessor
         // this map contains hashes of all files AP processed last time it ran
         AZStd::unordered_map<AZStd::string, AZ::u64> m_fileHashes;
 
+        // this map contains sizes of all files AP processed last time it ran
+        AZStd::unordered_map<AZStd::string, AZ::u64> m_fileSizes;
+
         QSet<QString> m_knownFolders; // a cache of all known folder names, normalized to have forward slashes.
         typedef AZStd::unordered_map<AZ::u64, AzToolsFramework::AssetSystem::JobInfo> JobRunKeyToJobInfoMap;  // for when network requests come in about the jobInfo
 
@@ -450,6 +456,8 @@ namespace AssetProcessor
         QMutex m_processingJobMutex;
         AZStd::unordered_set<AZStd::string> m_processingProductInfoList;
         AZ::s64 m_highestJobRunKeySoFar = 0;
+        //! Average processing time of each builder's jobs, used to estimate the duration of jobs which never ran before.
+        AZStd::unordered_map<AZ::Uuid, AZ::s64> m_averageProcessDurationMsByBuilder;
         AZStd::vector<JobToProcessEntry> m_jobEntries;
         AZStd::unordered_set<JobDetails> m_jobsToProcess;
         //! This map is required to prevent multiple sourceFile modified events been send by the APM 
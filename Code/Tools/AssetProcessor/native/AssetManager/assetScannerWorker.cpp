@@ -8,6 +8,8 @@
 #include "native/AssetManager/assetScannerWorker.h"
 #include "native/AssetManager/assetScanner.h"
 #include "native/utilities/PlatformConfiguration.h"
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/thread.h>
 #include <QDir>
 
 using namespace AssetProcessor;
@@ -25,6 +27,7 @@ void AssetScannerWorker::StartScan()
 
     m_fileList.clear();
     m_folderList.clear();
+    m_excludedList.clear();
     m_doScan = true;
 
     AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Scanning file system for changes...\n");
@@ -32,10 +35,55 @@ void AssetScannerWorker::StartScan()
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Started);
     Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::InProgress);
 
-    for (int idx = 0; idx < m_platformConfiguration->GetScanFolderCount(); idx++)
+    // The Cache folder should not be scanned, its location doesn't change during a scan so only compute it once
+    QDir projectCacheRoot;
+    AssetUtilities::ComputeProjectCacheRoot(projectCacheRoot);
+    m_projectCacheRootPath = projectCacheRoot.path();
+
+    const int scanFolderCount = m_platformConfiguration->GetScanFolderCount();
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_directoryQueueMutex);
+        m_directoryQueue.clear();
+        for (int idx = 0; idx < scanFolderCount; idx++)
+        {
+            const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
+            m_directoryQueue.push_back({ scanFolderInfo.ScanPath(), scanFolderInfo.RecurseSubFolders(), idx });
+        }
+        m_numDirectoriesPending = m_directoryQueue.size();
+    }
+
+    // Walk the directory trees on several threads, this one included.
+    // Every thread keeps its own results so that no lock is needed while scanning a directory.
+    const unsigned int numThreads = AZStd::min(AZStd::max(AZStd::thread::hardware_concurrency(), 1u), MaxScanThreads);
+    AZStd::vector<AZStd::vector<ScanResults>> threadResults(numThreads, AZStd::vector<ScanResults>(scanFolderCount));
+
+    AZStd::vector<AZStd::thread> scanThreads;
+    scanThreads.reserve(numThreads - 1);
+    AZStd::thread_desc threadDesc;
+    threadDesc.m_name = "AssetScannerWorker";
+    for (unsigned int threadIdx = 1; threadIdx < numThreads; ++threadIdx)
+    {
+        scanThreads.emplace_back(threadDesc, [this, &threadResults, threadIdx]()
+        {
+            ScanQueuedDirectories(threadResults[threadIdx]);
+        });
+    }
+    ScanQueuedDirectories(threadResults[0]);
+    for (AZStd::thread& scanThread : scanThreads)
+    {
+        scanThread.join();
+    }
+
+    // Merge in scan folder order so a file reachable from several scan folders is reported
+    // for the highest priority one, as it was when scan folders were walked one after the other.
+    for (int idx = 0; idx < scanFolderCount; idx++)
     {
-        const ScanFolderInfo& scanFolderInfo = m_platformConfiguration->GetScanFolderAt(idx);
-        ScanForSourceFiles(scanFolderInfo, scanFolderInfo);
+        for (AZStd::vector<ScanResults>& results : threadResults)
+        {
+            m_fileList.unite(results[idx].m_fileList);
+            m_folderList.unite(results[idx].m_folderList);
+            m_excludedList.unite(results[idx].m_excludedList);
+        }
     }
 
     // we want not to emit any signals until we're finished scanning
@@ -46,6 +94,7 @@ void AssetScannerWorker::StartScan()
     {
         m_fileList.clear();
         m_folderList.clear();
+        m_excludedList.clear();
         Q_EMIT ScanningStateChanged(AssetProcessor::AssetScanningStatus::Stopped);
         return;
     }
@@ -67,19 +116,62 @@ void AssetScannerWorker::StopScan()
     m_doScan = false;
 }
 
-void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder)
+void AssetScannerWorker::ScanQueuedDirectories(AZStd::vector<ScanResults>& results)
+{
+    // QDir lazily caches data in const functions, give each thread its own instance
+    const QDir projectCacheRoot(m_projectCacheRootPath);
+    AZStd::vector<DirectoryToScan> subFolders;
+
+    while (true)
+    {
+        DirectoryToScan directory;
+        {
+            AZStd::unique_lock<AZStd::mutex> lock(m_directoryQueueMutex);
+            // an empty queue doesn't mean we're done, directories being scanned by other threads may add sub folders to it
+            m_directoryQueueCondition.wait(lock, [this]()
+            {
+                return !m_directoryQueue.empty() || m_numDirectoriesPending == 0 || !m_doScan;
+            });
+
+            if (m_directoryQueue.empty() || !m_doScan)
+            {
+                return;
+            }
+
+            directory = AZStd::move(m_directoryQueue.front());
+            m_directoryQueue.pop_front();
+        }
+
+        subFolders.clear();
+        ScanForSourceFiles(directory, projectCacheRoot, results[directory.m_rootScanFolderIndex], subFolders);
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_directoryQueueMutex);
+            for (DirectoryToScan& subFolder : subFolders)
+            {
+                m_directoryQueue.push_back(AZStd::move(subFolder));
+            }
+            m_numDirectoriesPending += subFolders.size();
+            --m_numDirectoriesPending;
+        }
+        m_directoryQueueCondition.notify_all();
+    }
+}
+
+void AssetScannerWorker::ScanForSourceFiles(const DirectoryToScan& directory, const QDir& projectCacheRoot, ScanResults& results, AZStd::vector<DirectoryToScan>& subFolders)
 {
     if (!m_doScan)
     {
         return;
     }
 
-    QDir dir(scanFolderInfo.ScanPath());
+    const ScanFolderInfo* rootScanFolder = &m_platformConfiguration->GetScanFolderAt(directory.m_rootScanFolderIndex);
+    QDir dir(directory.m_path);
 
     QFileInfoList entries;
 
     //Only scan sub folders if recurseSubFolders flag is set
-    if (!scanFolderInfo.RecurseSubFolders())
+    if (!directory.m_recurseSubFolders)
     {
         entries = dir.entryInfoList(QDir::NoDotAndDotDot | QDir::Files);
     }
@@ -99,11 +191,9 @@ void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo
         const bool isDirectory = entry.isDir();
         QDateTime modTime = entry.lastModified();
         AZ::u64 fileSize = isDirectory ? 0 : entry.size();
-        AssetFileInfo assetFileInfo(absPath, modTime, fileSize, &rootScanFolder, isDirectory);
+        AssetFileInfo assetFileInfo(absPath, modTime, fileSize, rootScanFolder, isDirectory);
 
         // Skip over the Cache folder if the file entry is the project cache root
-        QDir projectCacheRoot;
-        AssetUtilities::ComputeProjectCacheRoot(projectCacheRoot);
         QString relativeToProjectCacheRoot = projectCacheRoot.relativeFilePath(absPath);
         if (QDir::isRelativePath(relativeToProjectCacheRoot) && !relativeToProjectCacheRoot.startsWith(".."))
         {
@@ -114,21 +204,20 @@ void AssetScannerWorker::ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo
         // Filtering out excluded files
         if (m_platformConfiguration->IsFileExcluded(absPath))
         {
-            m_excludedList.insert(AZStd::move(assetFileInfo));
+            results.m_excludedList.insert(AZStd::move(assetFileInfo));
             continue;
         }
 
         if (isDirectory)
         {
             //Entry is a directory
-            m_folderList.insert(AZStd::move(assetFileInfo));
-            ScanFolderInfo tempScanFolderInfo(absPath, "", "", false, true);
-            ScanForSourceFiles(tempScanFolderInfo, rootScanFolder);
+            results.m_folderList.insert(AZStd::move(assetFileInfo));
+            subFolders.push_back({ absPath, true, directory.m_rootScanFolderIndex });
         }
         else
         {
             //Entry is a file
-            m_fileList.insert(AZStd::move(assetFileInfo));
+            results.m_fileList.insert(AZStd::move(assetFileInfo));
         }
     }
 }
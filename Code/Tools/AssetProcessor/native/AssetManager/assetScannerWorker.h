@@ -14,6 +14,11 @@
 #include <QString>
 #include <QSet>
 #include <QObject>
+#include <QDir>
+#include <AzCore/std/containers/deque.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
 #endif
 
 namespace AssetProcessor
@@ -24,6 +29,8 @@ namespace AssetProcessor
      * and finding file of interest files.
      * Its created on the main thread and then moved to the worker thread
      * so it should contain no QObject-based classes at construction time (it can make them later)
+     * The directory tree is walked by several threads sharing a queue of directories, the results are
+     * merged in scan folder order once every directory has been visited.
      */
     class AssetScannerWorker
         : public QObject
@@ -43,13 +50,42 @@ Q_SIGNALS:
         void StopScan();
 
     protected:
-        // scanFolderInfo - the folder we're currently scanning (this will sometimes be a fake scanfolder created when recursing through directories)
-        // rootScanFolder - the actual scan folder we started with, which will either be the same as scanFolderInfo or a parent folder
-        void ScanForSourceFiles(const ScanFolderInfo& scanFolderInfo, const ScanFolderInfo& rootScanFolder);
+        // A directory waiting to be scanned
+        struct DirectoryToScan
+        {
+            QString m_path;
+            bool m_recurseSubFolders = false;
+            int m_rootScanFolderIndex = 0; // index of the actual scan folder we started with, the directory is either that scan folder or a sub folder of it
+        };
+
+        // Everything found under one scan folder by one scanning thread
+        struct ScanResults
+        {
+            QSet<AssetFileInfo> m_fileList;
+            QSet<AssetFileInfo> m_folderList;
+            QSet<AssetFileInfo> m_excludedList;
+        };
+
+        // Pops directories from the queue until every directory has been scanned or the scan is stopped.
+        // results has one entry per scan folder and is only accessed by the calling thread.
+        void ScanQueuedDirectories(AZStd::vector<ScanResults>& results);
+
+        // Scans a single directory (without recursing), the sub folders to visit are added to subFolders.
+        void ScanForSourceFiles(const DirectoryToScan& directory, const QDir& projectCacheRoot, ScanResults& results, AZStd::vector<DirectoryToScan>& subFolders);
         void EmitFiles();
 
+        // Upper bound of threads walking the file system, beyond this the scan is bound by the file system itself.
+        static constexpr unsigned int MaxScanThreads = 8;
+
     private:
         volatile bool m_doScan = true;
+        QString m_projectCacheRootPath; // computed once per scan, every scanning thread builds its own QDir from it
+
+        AZStd::mutex m_directoryQueueMutex;
+        AZStd::condition_variable m_directoryQueueCondition;
+        AZStd::deque<DirectoryToScan> m_directoryQueue;
+        size_t m_numDirectoriesPending = 0; // directories queued or being scanned, the scan is done when this reaches 0
+
         QSet<AssetFileInfo> m_fileList; // note:  neither QSet nor QString are qobject-derived
         QSet<AssetFileInfo> m_folderList;
         QSet<AssetFileInfo> m_excludedList;
@@ -128,6 +128,7 @@ namespace AssetProcessor
         AZ::u64 m_jobRunKey = 0;
         bool m_checkExclusiveLock = false;      ///< indicates whether we need to check the input file for exclusive lock before we process this job
         bool m_addToDatabase = true; ///< If false, this is just a UI job, and should not affect the database.
+        AZ::s64 m_processDurationMs = 0; ///< wall clock time the job spent processing, filled in by the RCController once the job finishes.
 
         QString GetAbsoluteSourcePath() const
         {
@@ -213,6 +214,8 @@ namespace AssetProcessor
 
         bool m_critical = false;
         int m_priority = -1;
+        // how long the job is expected to take, based on previous runs of it or of its builder.  Used by the critical path scheduler.
+        AZ::s64 m_estimatedProcessDurationMs = 0;
         // indicates whether we need to check the server first for the outputs of this job 
         // before we start processing locally
         bool m_checkServer = false;
@@ -8,6 +8,8 @@
 #include <native/resourcecompiler/RCQueueSortModel.h>
 #include "rcjoblistmodel.h"
 
+#include <AzCore/std/containers/unordered_set.h>
+
 namespace AssetProcessor
 {
     RCQueueSortModel::RCQueueSortModel(QObject* parent)
@@ -25,6 +27,19 @@ namespace AssetProcessor
             BusConnect();
             m_sourceModel = target;
 
+            // new jobs can lengthen the chains of jobs already in the queue, so the critical paths are recomputed on the next resort.
+            m_sourceModelConnections.push_back(QObject::connect(target, &QAbstractItemModel::rowsInserted, this, [this]()
+            {
+                m_dirtyNeedsResort |= m_criticalPathScheduling;
+            }));
+            m_sourceModelConnections.push_back(QObject::connect(target, &QAbstractItemModel::rowsAboutToBeRemoved, this, [this](const QModelIndex&, int first, int last)
+            {
+                for (int row = first; row <= last; ++row)
+                {
+                    m_criticalPathMs.erase(m_sourceModel->getItem(row));
+                }
+            }));
+
             setSourceModel(target);
             setSortRole(RCJobListModel::jobIndexRole);
             sort(0);
@@ -32,6 +47,12 @@ namespace AssetProcessor
         else
         {
             BusDisconnect();
+            for (const QMetaObject::Connection& connection : m_sourceModelConnections)
+            {
+                QObject::disconnect(connection);
+            }
+            m_sourceModelConnections.clear();
+            m_criticalPathMs.clear();
             setSourceModel(nullptr);
             m_sourceModel = nullptr;
         }
@@ -41,6 +62,7 @@ namespace AssetProcessor
     {
         if (m_dirtyNeedsResort)
         {
+            UpdateCriticalPaths();
             setDynamicSortFilter(false);
             QSortFilterProxyModel::sort(0);
             setDynamicSortFilter(true);
@@ -177,6 +199,17 @@ namespace AssetProcessor
             return leftJobEscalation > rightJobEscalation;
         }
 
+        // start the longest chain of remaining work first, so that it does not end up running on its own at the end of the batch.
+        if (m_criticalPathScheduling)
+        {
+            AZ::s64 leftCriticalPath = GetCriticalPathMs(leftJob);
+            AZ::s64 rightCriticalPath = GetCriticalPathMs(rightJob);
+            if (leftCriticalPath != rightCriticalPath)
+            {
+                return leftCriticalPath > rightCriticalPath;
+            }
+        }
+
         // arbitrarily, lets have PC get done first since pc-format assets are what the editor uses.
         if (leftJob->GetPlatformInfo().m_identifier != rightJob->GetPlatformInfo().m_identifier)
         {
@@ -214,6 +247,115 @@ namespace AssetProcessor
         return leftJob->GetJobEntry().m_jobRunKey < rightJob->GetJobEntry().m_jobRunKey;
     }
 
+    AZ::s64 RCQueueSortModel::GetCriticalPathMs(const RCJob* rcJob) const
+    {
+        auto found = m_criticalPathMs.find(rcJob);
+        if (found != m_criticalPathMs.end())
+        {
+            return found->second;
+        }
+
+        // not part of the last update yet, only its own duration is known.
+        AZ::s64 estimatedDurationMs = rcJob->GetEstimatedProcessDurationMs();
+        return estimatedDurationMs > 0 ? estimatedDurationMs : DefaultEstimatedProcessDurationMs;
+    }
+
+    void RCQueueSortModel::UpdateCriticalPaths()
+    {
+        m_criticalPathMs.clear();
+        if (!m_criticalPathScheduling || !m_sourceModel)
+        {
+            return;
+        }
+
+        // index the pending jobs by the id other jobs use to declare order dependencies on them.
+        QHash<QueueElementID, RCJob*> pendingJobs;
+        for (int row = 0; row < m_sourceModel->itemCount(); ++row)
+        {
+            RCJob* rcJob = m_sourceModel->getItem(row);
+            if (rcJob && rcJob->GetState() == RCJob::pending)
+            {
+                pendingJobs.insert(rcJob->GetElementID(), rcJob);
+            }
+        }
+
+        // invert the job dependencies, for each job collect the queued jobs which have to wait for it.
+        // Order and OrderOnce dependencies block the dependent job in GetNextPendingJob. Fingerprint dependencies do not block it,
+        // but they declare the same producer -> consumer relation (e.g. model -> material), so they are followed as well.
+        // Source dependencies and product (path) dependencies are not followed. Queued jobs do not carry them (source dependencies
+        // are only folded into the fingerprint, product dependencies are only emitted by processing) and neither makes a queued job
+        // wait for another queued job, so such a chain only counts here when the builder also declares a job dependency for it.
+        AZStd::unordered_map<const RCJob*, AZStd::vector<RCJob*>> waitingJobs;
+        for (RCJob* rcJob : pendingJobs)
+        {
+            for (const JobDependencyInternal& jobDependencyInternal : rcJob->GetJobDependencies())
+            {
+                const AssetBuilderSDK::JobDependency& jobDependency = jobDependencyInternal.m_jobDependency;
+                QueueElementID elementId(jobDependency.m_sourceFile.m_sourceFileDependencyPath.c_str(), jobDependency.m_platformIdentifier.c_str(), jobDependency.m_jobKey.c_str());
+                auto foundDependency = pendingJobs.find(elementId);
+                if (foundDependency != pendingJobs.end() && foundDependency.value() != rcJob)
+                {
+                    waitingJobs[foundDependency.value()].push_back(rcJob);
+                }
+            }
+        }
+
+        // iterative depth first walk, a job's critical path is its own duration plus the longest critical path of the jobs waiting for it.
+        // Jobs already on the stack are skipped, cyclic dependencies are resolved by GetNextPendingJob and must not recurse forever here.
+        struct StackEntry
+        {
+            RCJob* m_job;
+            size_t m_nextWaitingJob;
+            AZ::s64 m_longestWaitingPathMs;
+        };
+        AZStd::vector<StackEntry> stack;
+        AZStd::unordered_set<const RCJob*> onStack;
+        const AZStd::vector<RCJob*> noWaitingJobs;
+
+        for (RCJob* rootJob : pendingJobs)
+        {
+            if (m_criticalPathMs.find(rootJob) != m_criticalPathMs.end())
+            {
+                continue;
+            }
+
+            stack.push_back({ rootJob, 0, 0 });
+            onStack.insert(rootJob);
+            while (!stack.empty())
+            {
+                RCJob* currentJob = stack.back().m_job;
+                auto foundWaiting = waitingJobs.find(currentJob);
+                const AZStd::vector<RCJob*>& waiting = foundWaiting != waitingJobs.end() ? foundWaiting->second : noWaitingJobs;
+
+                if (stack.back().m_nextWaitingJob < waiting.size())
+                {
+                    RCJob* waitingJob = waiting[stack.back().m_nextWaitingJob++];
+                    auto foundPath = m_criticalPathMs.find(waitingJob);
+                    if (foundPath != m_criticalPathMs.end())
+                    {
+                        stack.back().m_longestWaitingPathMs = AZStd::max(stack.back().m_longestWaitingPathMs, foundPath->second);
+                    }
+                    else if (onStack.insert(waitingJob).second)
+                    {
+                        stack.push_back({ waitingJob, 0, 0 });
+                    }
+                    continue;
+                }
+
+                AZ::s64 estimatedDurationMs = currentJob->GetEstimatedProcessDurationMs();
+                AZ::s64 criticalPathMs = (estimatedDurationMs > 0 ? estimatedDurationMs : DefaultEstimatedProcessDurationMs) + stack.back().m_longestWaitingPathMs;
+                m_criticalPathMs[currentJob] = criticalPathMs;
+                onStack.erase(currentJob);
+                stack.pop_back();
+
+                if (!stack.empty())
+                {
+                    stack.back().m_longestWaitingPathMs = AZStd::max(stack.back().m_longestWaitingPathMs, criticalPathMs);
+                }
+            }
+        }
+    }
+
     void RCQueueSortModel::AssetProcessorPlatformConnected(const AZStd::string platform)
     {
         QMetaObject::invokeMethod(this, "ProcessPlatformChangeMessage", Qt::QueuedConnection, Q_ARG(QString, QString::fromUtf8(platform.c_str())), Q_ARG(bool, true));
@@ -12,10 +12,12 @@
 #include <QSortFilterProxyModel>
 #include <QSet>
 #include <QString>
+#include <QVector>
 
 
 #include "native/utilities/AssetUtilEBusHelper.h"
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
 #include "native/assetprocessor.h"
 #endif
 
@@ -35,6 +37,8 @@ namespace AssetProcessor
     //!  * Jobs in Async Compile Lists for currently connected platforms
     //!  * Remaining jobs in currently connected platforms, in priority order
     //!  (The same, repeated, for unconnected platforms).
+    //! When critical path scheduling is enabled, jobs of equal escalation are instead ordered by the estimated length
+    //! of the longest chain of queued jobs that have to wait for them, so long dependency chains start first.
     class RCQueueSortModel
         : public QSortFilterProxyModel
         , protected AssetProcessorPlatformBus::Handler
@@ -55,6 +59,16 @@ namespace AssetProcessor
             m_sortQueueOnDBSourceName = true;
         }
 
+        void SetCriticalPathScheduling(bool enable)
+        {
+            m_criticalPathScheduling = enable;
+            m_dirtyNeedsResort = true;
+        }
+
+        //! Returns the estimated duration of the job plus the longest chain of queued jobs with an order dependency on it,
+        //! as computed during the last resort.
+        AZ::s64 GetCriticalPathMs(const RCJob* rcJob) const;
+
         // implement QSortFilteRProxyModel:
         bool filterAcceptsRow(int source_row, const QModelIndex& source_parent) const override;
         bool lessThan(const QModelIndex& left, const QModelIndex& right) const override;
@@ -77,6 +91,16 @@ namespace AssetProcessor
         // order for those tests each time they are run.
         bool m_sortQueueOnDBSourceName = false;
 
+        // Jobs which never ran before and have no estimate from other jobs of their builder are assumed to take this long.
+        static constexpr AZ::s64 DefaultEstimatedProcessDurationMs = 1000;
+
+        //! Recomputes m_criticalPathMs for every pending job, walking the job dependencies (order and fingerprint) between them.
+        void UpdateCriticalPaths();
+
+        bool m_criticalPathScheduling = false;
+        AZStd::unordered_map<const RCJob*, AZ::s64> m_criticalPathMs;
+        QVector<QMetaObject::Connection> m_sourceModelConnections;
+
         // ---------------------------------------------------------
         // AssetProcessorPlatformBus::Handler
         void AssetProcessorPlatformConnected(const AZStd::string platform) override;
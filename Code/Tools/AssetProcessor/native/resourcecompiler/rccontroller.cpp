@@ -62,6 +62,11 @@ namespace AssetProcessor
     void RCController::StartJob(RCJob* rcJob)
     {
         Q_ASSERT(rcJob);
+        if (!m_batchTimer.isValid())
+        {
+            m_batchTimer.start();
+        }
+
         // request to be notified when job is done
         QObject::connect(rcJob, &RCJob::Finished, this, [this, rcJob]()
         {
@@ -121,6 +126,16 @@ namespace AssetProcessor
             m_pendingCriticalJobsPerPlatform[platform.toLower()] = criticalJobsCount;
         }
 
+        // jobs which are removed before they started have no launch time and don't count towards the batch.
+        AZ::s64 processDurationMs = 0;
+        if (rcJob->GetTimeLaunched().isValid())
+        {
+            processDurationMs = qMax<AZ::s64>(rcJob->GetTimeLaunched().msecsTo(QDateTime::currentDateTime()), 0);
+            m_batchBusyTimeMs += processDurationMs;
+            m_batchLongestJobMs = qMax(m_batchLongestJobMs, processDurationMs);
+            ++m_batchJobCount;
+        }
+
         if (rcJob->GetState() == RCJob::cancelled)
         {
             Q_EMIT FileCancelled(rcJob->GetJobEntry());
@@ -132,7 +147,9 @@ namespace AssetProcessor
         }
         else
         {
-            Q_EMIT FileCompiled(rcJob->GetJobEntry(), AZStd::move(rcJob->GetProcessJobResponse()));
+            JobEntry jobEntry = rcJob->GetJobEntry();
+            jobEntry.m_processDurationMs = processDurationMs;
+            Q_EMIT FileCompiled(jobEntry, AZStd::move(rcJob->GetProcessJobResponse()));
             Q_EMIT JobStatusChanged(rcJob->GetJobEntry(), AzToolsFramework::AssetSystem::JobStatus::Completed);
         }
         
@@ -153,6 +170,7 @@ namespace AssetProcessor
             // if there is no next job, and nothing is in flight, we are done.
             if (IsIdle())
             {
+                ReportBatchStatistics();
                 Q_EMIT BecameIdle();
             }
         }
@@ -168,6 +186,36 @@ namespace AssetProcessor
         m_RCQueueSortModel.SetQueueSortOnDBSourceName();
     }
 
+    void RCController::SetCriticalPathScheduling(bool enable)
+    {
+        m_RCQueueSortModel.SetCriticalPathScheduling(enable);
+    }
+
+    void RCController::ReportBatchStatistics()
+    {
+        if (!m_batchTimer.isValid())
+        {
+            return;
+        }
+
+        const AZ::s64 wallTimeMs = m_batchTimer.elapsed();
+        if (m_batchJobCount > 0 && wallTimeMs > 0)
+        {
+            // achieved parallelism is the average number of jobs that were running at the same time.
+            // The longest job is a lower bound of the wall time no matter how many job slots are available.
+            const double achievedParallelism = static_cast<double>(m_batchBusyTimeMs) / static_cast<double>(wallTimeMs);
+            AZ_TracePrintf(AssetProcessor::ConsoleChannel,
+                "Processed %d jobs in %.2f seconds (%.2f seconds of job time, longest job %.2f seconds). Achieved parallelism %.2f of %u job slots (%.0f%% utilization).\n",
+                m_batchJobCount, wallTimeMs / 1000.0, m_batchBusyTimeMs / 1000.0, m_batchLongestJobMs / 1000.0,
+                achievedParallelism, m_maxJobs, 100.0 * achievedParallelism / qMax(m_maxJobs, 1u));
+        }
+
+        m_batchTimer.invalidate();
+        m_batchBusyTimeMs = 0;
+        m_batchLongestJobMs = 0;
+        m_batchJobCount = 0;
+    }
+
     void RCController::JobSubmitted(JobDetails details)
     {
         AssetProcessor::QueueElementID checkFile(details.m_jobEntry.m_databaseSourceName, details.m_jobEntry.m_platformInfo.m_identifier.c_str(), details.m_jobEntry.m_jobKey);
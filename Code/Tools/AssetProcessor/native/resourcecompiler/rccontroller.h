@@ -14,6 +14,7 @@
 #include <QObject>
 #include <QProcess>
 #include <QDir>
+#include <QElapsedTimer>
 #include <QList>
 #include "native/utilities/AssetUtilEBusHelper.h"
 
@@ -58,6 +59,7 @@ namespace AssetProcessor
         bool IsIdle();
 
         void SetQueueSortOnDBSourceName();
+        void SetCriticalPathScheduling(bool enable);
 
     Q_SIGNALS:
         void FileCompiled(JobEntry entry, AssetBuilderSDK::ProcessJobResponse response);
@@ -110,8 +112,16 @@ namespace AssetProcessor
     private:
         void FinishJob(AssetProcessor::RCJob* rcJob);
 
+        //! Logs how well the jobs of the batch that just finished made use of the available job slots.
+        void ReportBatchStatistics();
+
         unsigned int m_maxJobs;
 
+        QElapsedTimer m_batchTimer; // measures a batch of jobs, from the first dispatched job until the queue becomes idle
+        AZ::s64 m_batchBusyTimeMs = 0; // sum of the processing times of the jobs finished in the current batch
+        AZ::s64 m_batchLongestJobMs = 0;
+        int m_batchJobCount = 0;
+
         bool m_dispatchingJobs = false;
         bool m_shuttingDown = false;
         bool m_dispatchingPaused = true;// dispatching starts out paused.
@@ -12,6 +12,7 @@
 #include <AzToolsFramework/UI/Logging/LogLine.h>
 
 #include <native/utilities/BuilderManager.h>
+#include <native/utilities/JobOutputCache.h>
 #include <native/utilities/ThreadHelper.h>
 
 #include <QtConcurrent/QtConcurrentRun>
@@ -258,6 +259,11 @@ namespace AssetProcessor
         return m_jobDetails.m_priority;
     }
 
+    AZ::s64 RCJob::GetEstimatedProcessDurationMs() const
+    {
+        return m_jobDetails.m_estimatedProcessDurationMs;
+    }
+
     const AZStd::vector<AssetProcessor::JobDependencyInternal>& RCJob::GetJobDependencies()
     {
         return m_jobDetails.m_jobDependencyList;
@@ -519,7 +525,33 @@ namespace AssetProcessor
                 if (!JobCancelListener.IsCancelled())
                 {
                     bool runProcessJob = true;
-                    if (m_jobDetails.m_checkServer)
+
+                    // the local job output cache is consulted first, it is cheaper than both the asset server and the builder.
+                    IJobOutputCacheRequests* jobOutputCache = AZ::Interface<IJobOutputCacheRequests>::Get();
+                    QString jobOutputCacheKey;
+                    if (jobOutputCache)
+                    {
+                        jobOutputCacheKey = AssetUtilities::ComputeJobOutputCacheKey(m_jobDetails, builderParams.m_processJobRequest);
+                        if (jobOutputCache->RetrieveJobResult(jobOutputCacheKey, workFolder))
+                        {
+                            runProcessJob = !AfterRetrievingJobResult(builderParams, jobLogTraceListener, result, true);
+                            if (!runProcessJob)
+                            {
+                                AZ_TracePrintf(AssetProcessor::DebugChannel, "Job (%s, %s, %s) retrieved from the local job output cache with key %s, the builder was not run.\n",
+                                    builderParams.m_rcJob->GetJobEntry().m_pathRelativeToWatchFolder.toUtf8().data(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
+                                    builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), jobOutputCacheKey.toUtf8().data());
+                            }
+                            else
+                            {
+                                // don't let a broken entry leave files behind in the folder the builder is about to use.
+                                QDir(workFolder).removeRecursively();
+                                QDir().mkpath(workFolder);
+                            }
+                        }
+                    }
+                    const bool retrievedFromJobOutputCache = !runProcessJob;
+
+                    if (runProcessJob && m_jobDetails.m_checkServer)
                     {
                         QFileInfo fileInfo(builderParams.m_processJobRequest.m_sourceFile.c_str());
                         builderParams.m_serverKey = QString("%1_%2_%3_%4").arg(fileInfo.completeBaseName(), builderParams.m_processJobRequest.m_jobDescription.m_jobKey.c_str(), builderParams.m_processJobRequest.m_platformInfo.m_identifier.c_str()).arg(builderParams.m_rcJob->GetOriginalFingerprint());
@@ -576,6 +608,18 @@ namespace AssetProcessor
                         // sending process job command to the builder
                         builderParams.m_assetBuilderDesc.m_processJobFunction(builderParams.m_processJobRequest, result);
                     }
+
+                    if (jobOutputCache && !retrievedFromJobOutputCache && !jobOutputCacheKey.isEmpty()
+                        && result.m_resultCode == AssetBuilderSDK::ProcessJobResult_Success && !JobCancelListener.IsCancelled())
+                    {
+                        // the entry is stored in the same layout the asset server uses, so retrieving it goes through AfterRetrievingJobResult too.
+                        auto beforeStoreResult = BeforeStoringJobResult(builderParams, result);
+                        if (beforeStoreResult.IsSuccess())
+                        {
+                            QString sourceFolder = QFileInfo(builderParams.m_rcJob->GetJobEntry().GetAbsoluteSourcePath()).absolutePath();
+                            jobOutputCache->StoreJobResult(jobOutputCacheKey, workFolder, sourceFolder, beforeStoreResult.GetValue());
+                        }
+                    }
                 }
             }
 
@@ -877,8 +921,10 @@ namespace AssetProcessor
         return AZ::Success(sourceFiles);
     }
 
-    bool RCJob::AfterRetrievingJobResult(const BuilderParams& builderParams, AssetUtilities::JobLogTraceListener& jobLogTraceListener, AssetBuilderSDK::ProcessJobResponse& jobResponse)
+    bool RCJob::AfterRetrievingJobResult(const BuilderParams& builderParams, AssetUtilities::JobLogTraceListener& jobLogTraceListener, AssetBuilderSDK::ProcessJobResponse& jobResponse, bool fromJobOutputCache)
     {
+        const char* retrievedFrom = fromJobOutputCache ? "JOB OUTPUT CACHE" : "SERVER";
+
         AZStd::string responseFilePath;
         AzFramework::StringFunc::Path::ConstructFull(builderParams.m_processJobRequest.m_tempDirPath.c_str(), AssetBuilderSDK::s_processJobResponseFileName, responseFilePath, true);
         if (!AZ::Utils::LoadObjectFromFileInPlace(responseFilePath.c_str(), jobResponse))
@@ -903,9 +949,9 @@ namespace AssetProcessor
 
         if (!jobLogResponse.m_isSuccess)
         {
-            AZ_TracePrintf(AssetProcessor::DebugChannel, "Job log request was unsuccessful for job (%s, %s, %s) from the server.\n",
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Job log request was unsuccessful for job (%s, %s, %s) from the %s.\n",
                 builderParams.m_rcJob->GetJobEntry().m_pathRelativeToWatchFolder.toUtf8().data(), builderParams.m_rcJob->GetJobKey().toUtf8().data(),
-                builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str());
+                builderParams.m_rcJob->GetPlatformInfo().m_identifier.c_str(), fromJobOutputCache ? "local job output cache" : "server");
 
             if(jobLogResponse.m_jobLog.find("No log file found") != AZStd::string::npos)
             {
@@ -916,14 +962,14 @@ please check the assetprocessorplatformconfig.ini file and ensure that server ca
             return false;
         }
 
-        // writing server logs
-        AZ_TracePrintf(AssetProcessor::DebugChannel, "------------SERVER BEGIN----------\n");
+        // writing server logs, or the logs of the build which stored the job output cache entry
+        AZ_TracePrintf(AssetProcessor::DebugChannel, "------------%s BEGIN----------\n", retrievedFrom);
         AzToolsFramework::Logging::LogLine::ParseLog(jobLogResponse.m_jobLog.c_str(), jobLogResponse.m_jobLog.size(),
             [&jobLogTraceListener](AzToolsFramework::Logging::LogLine& line)
         {
             jobLogTraceListener.AppendLog(line);
         });
-        AZ_TracePrintf(AssetProcessor::DebugChannel, "------------SERVER END----------\n");
+        AZ_TracePrintf(AssetProcessor::DebugChannel, "------------%s END----------\n", retrievedFrom);
         return true;
     }
 
@@ -191,13 +191,15 @@ namespace AssetProcessor
         static AZ::Outcome<AZStd::vector<AZStd::string>> BeforeStoringJobResult(const BuilderParams& builderParams, AssetBuilderSDK::ProcessJobResponse jobResponse);
         //! This method will retrieve the processJobResponse and the job log from the temp directory.
         //! This method is also responsible for emitting the server job logs to the local job log file.
-        static bool AfterRetrievingJobResult(const BuilderParams& builderParams, AssetUtilities::JobLogTraceListener& jobLogTraceListener, AssetBuilderSDK::ProcessJobResponse& jobResponse);
+        //! fromJobOutputCache marks the emitted logs as coming from the local job output cache rather than the server.
+        static bool AfterRetrievingJobResult(const BuilderParams& builderParams, AssetUtilities::JobLogTraceListener& jobLogTraceListener, AssetBuilderSDK::ProcessJobResponse& jobResponse, bool fromJobOutputCache = false);
 
         QString GetJobKey() const;
         AZ::Uuid GetBuilderGuid() const;
         bool IsCritical() const;
         bool IsAutoFail() const;
         int GetPriority() const;
+        AZ::s64 GetEstimatedProcessDurationMs() const;
         const AZStd::vector<JobDependencyInternal>& GetJobDependencies();
 
     protected:
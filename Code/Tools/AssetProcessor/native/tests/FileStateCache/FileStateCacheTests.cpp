@@ -9,6 +9,9 @@
 #include "FileStateCacheTests.h"
 #include <native/utilities/assetUtils.h>
 #include <native/unittests/UnitTestRunner.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzFramework/IO/LocalFileIO.h>
 
 namespace UnitTests
 {
@@ -164,4 +167,100 @@ namespace UnitTests
         CheckForFile(R"(c:\some\test\file.txt)", true);
         CheckForFile(R"(c:/some/test/file.txt)", true);
     }
+
+    // Hashing reads files through FileIOBase and allocates from the system allocator
+    class FileStateCacheHashTests
+        : public FileStateCacheTests
+    {
+    public:
+        void SetUp() override
+        {
+            if (!AZ::AllocatorInstance<AZ::SystemAllocator>::IsReady())
+            {
+                m_ownsSystemAllocator = true;
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Create();
+            }
+
+            m_previousFileIO = AZ::IO::FileIOBase::GetInstance();
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            m_localFileIO = AZStd::make_unique<AZ::IO::LocalFileIO>();
+            AZ::IO::FileIOBase::SetInstance(m_localFileIO.get());
+
+            AssetUtilities::SetUseFileHashOverride(true, true);
+            FileStateCacheTests::SetUp();
+        }
+
+        void TearDown() override
+        {
+            FileStateCacheTests::TearDown();
+            AssetUtilities::SetUseFileHashOverride(false, false);
+
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+            m_localFileIO.reset();
+            AZ::IO::FileIOBase::SetInstance(m_previousFileIO);
+
+            if (m_ownsSystemAllocator)
+            {
+                AZ::AllocatorInstance<AZ::SystemAllocator>::Destroy();
+            }
+        }
+
+    protected:
+        AZStd::unique_ptr<AZ::IO::LocalFileIO> m_localFileIO;
+        AZ::IO::FileIOBase* m_previousFileIO = nullptr;
+        bool m_ownsSystemAllocator = false;
+    };
+
+    TEST_F(FileStateCacheHashTests, ConcurrentHashRequests_ReturnSameHash)
+    {
+        QString testPath = m_temporarySourceDir.absoluteFilePath("test.txt");
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(testPath, "some contents"));
+
+        m_fileStateCache->AddFile(testPath);
+        const AZ::u64 expectedHash = AssetUtilities::GetFileHash(testPath.toUtf8().constData(), true);
+        ASSERT_NE(expectedHash, 0);
+
+        constexpr int NumThreads = 8;
+        AZStd::vector<AZ::u64> hashes(NumThreads, 0);
+        AZStd::vector<AZStd::thread> threads;
+        for (int threadIdx = 0; threadIdx < NumThreads; ++threadIdx)
+        {
+            threads.emplace_back([this, &hashes, &testPath, threadIdx]()
+            {
+                m_fileStateCache->GetHash(testPath, &hashes[threadIdx]);
+            });
+        }
+        for (AZStd::thread& thread : threads)
+        {
+            thread.join();
+        }
+
+        for (AZ::u64 hash : hashes)
+        {
+            EXPECT_EQ(hash, expectedHash);
+        }
+    }
+
+    TEST_F(FileStateCacheHashTests, PrecomputeHashesAfterUpdate_ReturnsNewHash)
+    {
+        QString testPath = m_temporarySourceDir.absoluteFilePath("test.txt");
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(testPath, "some contents"));
+
+        m_fileStateCache->AddFile(testPath);
+        m_fileStateCache->PrecomputeHashes({ testPath });
+
+        AZ::u64 hash = 0;
+        EXPECT_TRUE(m_fileStateCache->GetHash(testPath, &hash));
+        EXPECT_EQ(hash, AssetUtilities::GetFileHash(testPath.toUtf8().constData(), true));
+
+        // Updating the file must drop the cached hash
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(testPath, "other contents"));
+        m_fileStateCache->UpdateFile(testPath);
+        m_fileStateCache->PrecomputeHashes({ testPath });
+
+        AZ::u64 updatedHash = 0;
+        EXPECT_TRUE(m_fileStateCache->GetHash(testPath, &updatedHash));
+        EXPECT_EQ(updatedHash, AssetUtilities::GetFileHash(testPath.toUtf8().constData(), true));
+        EXPECT_NE(updatedHash, hash);
+    }
 }
@@ -2169,7 +2169,7 @@ namespace UnitTests
     {
         CreateCoverageTestData();
 
-        ASSERT_FALSE(m_data->m_connection.UpdateFileModTimeAndHashByFileNameAndScanFolderId("testfile.txt", m_data->m_scanFolder.m_scanFolderID, 1234, 1111));
+        ASSERT_FALSE(m_data->m_connection.UpdateFileModTimeAndHashByFileNameAndScanFolderId("testfile.txt", m_data->m_scanFolder.m_scanFolderID, 1234, 1111, 42));
 
         EXPECT_EQ(m_errorAbsorber->m_numAssertsAbsorbed, 0); // not allowed to assert on this
     }
@@ -2185,7 +2185,13 @@ namespace UnitTests
         bool entryAlreadyExists;
         ASSERT_TRUE(m_data->m_connection.InsertFile(entry, entryAlreadyExists));
         ASSERT_FALSE(entryAlreadyExists);
-        ASSERT_TRUE(m_data->m_connection.UpdateFileModTimeAndHashByFileNameAndScanFolderId("testfile.txt", m_data->m_scanFolder.m_scanFolderID, 1234, 1111));
+        ASSERT_TRUE(m_data->m_connection.UpdateFileModTimeAndHashByFileNameAndScanFolderId("testfile.txt", m_data->m_scanFolder.m_scanFolderID, 1234, 1111, 42));
+
+        FileDatabaseEntry updatedEntry;
+        ASSERT_TRUE(m_data->m_connection.GetFileByFileNameAndScanFolderId("testfile.txt", m_data->m_scanFolder.m_scanFolderID, updatedEntry));
+        EXPECT_EQ(updatedEntry.m_modTime, 1234);
+        EXPECT_EQ(updatedEntry.m_hash, 1111);
+        EXPECT_EQ(updatedEntry.m_fileSize, 42);
 
         EXPECT_EQ(m_errorAbsorber->m_numAssertsAbsorbed, 0); // not allowed to assert on this
     }
@@ -2434,4 +2440,39 @@ namespace UnitTests
 
     }
 
+    TEST_F(AssetDatabaseTest, BeginBatchedWrites_Committed_KeepsAllUpdates)
+    {
+        CreateCoverageTestData();
+
+        auto batchedWrites = m_data->m_connection.BeginBatchedWrites();
+        SourceDatabaseEntry newSource(m_data->m_scanFolder.m_scanFolderID, "newfile.tif", AZ::Uuid::CreateRandom(), "AnalysisFingerprint3");
+        ASSERT_TRUE(m_data->m_connection.SetSource(newSource));
+        // updates made inside the batch are visible to the same connection right away.
+        SourceDatabaseEntry foundSource;
+        EXPECT_TRUE(m_data->m_connection.GetSourceBySourceID(newSource.m_sourceID, foundSource));
+        EXPECT_TRUE(m_data->m_connection.RemoveProduct(m_data->m_product1.m_productID));
+        batchedWrites->Commit();
+
+        EXPECT_TRUE(m_data->m_connection.GetSourceBySourceID(newSource.m_sourceID, foundSource));
+        ProductDatabaseEntry foundProduct;
+        EXPECT_FALSE(m_data->m_connection.GetProductByProductID(m_data->m_product1.m_productID, foundProduct));
+    }
+
+    TEST_F(AssetDatabaseTest, BeginBatchedWrites_NotCommitted_RollsBackAllUpdates)
+    {
+        CreateCoverageTestData();
+
+        SourceDatabaseEntry newSource(m_data->m_scanFolder.m_scanFolderID, "newfile.tif", AZ::Uuid::CreateRandom(), "AnalysisFingerprint3");
+        {
+            auto batchedWrites = m_data->m_connection.BeginBatchedWrites();
+            ASSERT_TRUE(m_data->m_connection.SetSource(newSource));
+            EXPECT_TRUE(m_data->m_connection.RemoveProduct(m_data->m_product1.m_productID));
+        }
+
+        SourceDatabaseEntry foundSource;
+        EXPECT_FALSE(m_data->m_connection.GetSourceBySourceID(newSource.m_sourceID, foundSource));
+        ProductDatabaseEntry foundProduct;
+        EXPECT_TRUE(m_data->m_connection.GetProductByProductID(m_data->m_product1.m_productID, foundProduct));
+    }
+
 } // end namespace UnitTests
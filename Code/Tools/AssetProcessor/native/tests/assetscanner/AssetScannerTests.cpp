@@ -22,6 +22,7 @@ namespace AssetProcessor
         }
         friend class GTEST_TEST_CLASS_NAME_(AssetScannerTest, AssetScannerExcludeFileTest);
         friend class GTEST_TEST_CLASS_NAME_(AssetScannerTest, AssetScannerExcludeFolderTest);
+        friend class GTEST_TEST_CLASS_NAME_(AssetScannerTest, AssetScannerNestedFoldersTest);
     };
 
 
@@ -154,4 +155,44 @@ namespace AssetProcessor
         EXPECT_FALSE(m_files.contains(tempDir.filePath("subfolder2/aaa/basefile.txt")));
         EXPECT_EQ(m_folders.size(), 0);
     }
+
+    TEST_F(AssetScannerTest, AssetScannerNestedFoldersTest)
+    {
+        using namespace UnitTestUtils;
+        QDir tempDir(m_tempDir.path());
+
+        // enough folders for the scanning threads to share the work
+        QSet<QString> expectedFiles;
+        QSet<QString> expectedFolders;
+        expectedFolders << tempDir.filePath("subfolder2/aaa");
+        for (int outerIdx = 0; outerIdx < 8; ++outerIdx)
+        {
+            QString outerFolder = QString("subfolder2/nested%1").arg(outerIdx);
+            expectedFolders << tempDir.filePath(outerFolder);
+            for (int innerIdx = 0; innerIdx < 4; ++innerIdx)
+            {
+                QString innerFolder = QString("%1/inner%2").arg(outerFolder).arg(innerIdx);
+                expectedFolders << tempDir.filePath(innerFolder);
+                expectedFiles << tempDir.filePath(QString("%1/file.txt").arg(innerFolder));
+            }
+        }
+
+        for (const QString& expect : expectedFiles)
+        {
+            EXPECT_TRUE(CreateDummyFile(expect));
+        }
+
+        m_assetScanner.get()->StartScan();
+
+        ASSERT_TRUE(BlockUntilScanComplete(5000));
+
+        // the 4 files created by the fixture plus the nested ones
+        EXPECT_EQ(m_files.size(), expectedFiles.size() + 4);
+        for (const QString& expect : expectedFiles)
+        {
+            EXPECT_TRUE(m_files.contains(expect));
+        }
+
+        EXPECT_EQ(m_folders, expectedFolders);
+    }
 }
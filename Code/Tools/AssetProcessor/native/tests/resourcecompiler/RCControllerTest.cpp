@@ -243,3 +243,97 @@ TEST_F(RCcontrollerTest_Simple, DISABLED_SameJobIsCompletedMultipleTimes_Complet
     ASSERT_EQ(m_errorAbsorber->m_numAssertsAbsorbed, 4); // Expected that there are 4 errors related to the files not existing on disk.  Error message: GenerateFingerprint was called but no input files were requested for fingerprinting.
     ASSERT_EQ(m_errorAbsorber->m_numErrorsAbsorbed, 0);
 }
+
+class RCcontrollerTest_CriticalPath
+    : public RCcontrollerTest
+{
+public:
+    void SetUp() override
+    {
+        RCcontrollerTest::SetUp();
+        m_rcQueueSortModel.AttachToModel(&m_rcJobListModel);
+    }
+
+    void TearDown() override
+    {
+        m_rcQueueSortModel.AttachToModel(nullptr);
+        RCcontrollerTest::TearDown();
+    }
+
+    AssetProcessor::RCJob* AddPendingJob(const char* sourceName, AZ::u64 jobRunKey, AZ::s64 estimatedDurationMs, const char* dependencySourceName = nullptr,
+        AssetBuilderSDK::JobDependencyType dependencyType = AssetBuilderSDK::JobDependencyType::Order)
+    {
+        using namespace AssetProcessor;
+
+        JobDetails jobDetails;
+        jobDetails.m_jobEntry.m_pathRelativeToWatchFolder = jobDetails.m_jobEntry.m_databaseSourceName = sourceName;
+        jobDetails.m_jobEntry.m_platformInfo = { "pc", { "desktop", "renderer" } };
+        jobDetails.m_jobEntry.m_jobKey = "Compile Stuff";
+        jobDetails.m_jobEntry.m_jobRunKey = jobRunKey;
+        jobDetails.m_estimatedProcessDurationMs = estimatedDurationMs;
+        if (dependencySourceName)
+        {
+            AssetBuilderSDK::SourceFileDependency sourceFileDependency;
+            sourceFileDependency.m_sourceFileDependencyPath = dependencySourceName;
+            jobDetails.m_jobDependencyList.push_back({ AssetBuilderSDK::JobDependency("Compile Stuff", "pc", dependencyType, sourceFileDependency) });
+        }
+
+        RCJob* job = new RCJob(&m_rcJobListModel);
+        job->SetState(RCJob::pending);
+        job->Init(jobDetails);
+        m_rcJobListModel.addNewJob(job);
+        return job;
+    }
+
+    AssetProcessor::RCJobListModel m_rcJobListModel;
+    AssetProcessor::RCQueueSortModel m_rcQueueSortModel;
+};
+
+TEST_F(RCcontrollerTest_CriticalPath, GetNextPendingJob_CriticalPathScheduling_StartsLongestChainFirst)
+{
+    using namespace AssetProcessor;
+
+    // the standalone job is longer than the head of the chain, but the chain as a whole is the longest remaining work.
+    RCJob* standaloneJob = AddPendingJob("standalone.txt", 1, 2000);
+    RCJob* chainHeadJob = AddPendingJob("chainhead.txt", 2, 100);
+    RCJob* chainTailJob = AddPendingJob("chaintail.txt", 3, 5000, "chainhead.txt");
+
+    EXPECT_EQ(m_rcQueueSortModel.GetNextPendingJob(), standaloneJob);
+
+    m_rcQueueSortModel.SetCriticalPathScheduling(true);
+    EXPECT_EQ(m_rcQueueSortModel.GetNextPendingJob(), chainHeadJob);
+
+    EXPECT_EQ(m_rcQueueSortModel.GetCriticalPathMs(chainHeadJob), 5100);
+    EXPECT_EQ(m_rcQueueSortModel.GetCriticalPathMs(chainTailJob), 5000);
+    EXPECT_EQ(m_rcQueueSortModel.GetCriticalPathMs(standaloneJob), 2000);
+}
+
+TEST_F(RCcontrollerTest_CriticalPath, GetCriticalPathMs_FingerprintDependency_CountsAsChain)
+{
+    using namespace AssetProcessor;
+
+    RCJob* modelJob = AddPendingJob("model.fbx", 1, 100);
+    RCJob* materialJob = AddPendingJob("model.material", 2, 3000, "model.fbx", AssetBuilderSDK::JobDependencyType::Fingerprint);
+    RCJob* standaloneJob = AddPendingJob("standalone.txt", 3, 2000);
+
+    m_rcQueueSortModel.SetCriticalPathScheduling(true);
+    EXPECT_EQ(m_rcQueueSortModel.GetNextPendingJob(), modelJob);
+
+    EXPECT_EQ(m_rcQueueSortModel.GetCriticalPathMs(modelJob), 3100);
+    EXPECT_EQ(m_rcQueueSortModel.GetCriticalPathMs(materialJob), 3000);
+    EXPECT_EQ(m_rcQueueSortModel.GetCriticalPathMs(standaloneJob), 2000);
+}
+
+TEST_F(RCcontrollerTest_CriticalPath, GetCriticalPathMs_CyclicDependency_Terminates)
+{
+    using namespace AssetProcessor;
+
+    RCJob* jobA = AddPendingJob("a.txt", 1, 100, "b.txt");
+    RCJob* jobB = AddPendingJob("b.txt", 2, 100, "a.txt");
+
+    m_rcQueueSortModel.SetCriticalPathScheduling(true);
+    EXPECT_NE(m_rcQueueSortModel.GetNextPendingJob(), nullptr);
+
+    // the cycle is broken wherever the walk entered it, so one job counts both durations and the other only its own.
+    EXPECT_EQ(m_rcQueueSortModel.GetCriticalPathMs(jobA) + m_rcQueueSortModel.GetCriticalPathMs(jobB), 300);
+}
@@ -14,6 +14,11 @@
 
 DECLARE_AZ_UNIT_TEST_MAIN()
 
+#if !defined(AZ_MONOLITHIC_BUILD)
+// defined by AZ_UNIT_TEST_HOOK in AssetProcessorTest.cpp
+extern "C" int AzRunBenchmarks(int argc, char** argv);
+#endif
+
 int RunUnitTests(int argc, char* argv[], bool& ranUnitTests)
 {
     ranUnitTests = true;
@@ -30,6 +35,16 @@ int main(int argc, char* argv[])
     qputenv("QT_MAC_DISABLE_FOREGROUND_APPLICATION_TRANSFORM", "1");
 
     AZ::Debug::Trace::HandleExceptions(true);
+
+#if !defined(AZ_MONOLITHIC_BUILD)
+    // "AzRunBenchmarks" as the first argument runs the benchmarks instead of the unit tests
+    if (argc >= 2 && strcmp(argv[1], "AzRunBenchmarks") == 0)
+    {
+        argv[1] = argv[0];
+        return AzRunBenchmarks(argc - 1, &argv[1]);
+    }
+#endif
+
     AZ::Test::ApplyGlobalParameters(&argc, argv);
 
     // If "--unittest" is present on the command line, run unit testing
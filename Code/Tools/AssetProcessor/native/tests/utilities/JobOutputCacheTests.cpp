@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "native/tests/AssetProcessorTest.h"
+#include <native/utilities/JobOutputCache.h>
+#include <AzTest/AzTest.h>
+
+#include <QDir>
+#include <QFile>
+#include <QTemporaryDir>
+
+namespace AssetProcessor
+{
+    class JobOutputCacheTest
+        : public AssetProcessorTest
+    {
+    protected:
+        void SetUp() override
+        {
+            AssetProcessorTest::SetUp();
+            m_root = QDir(m_tempDir.path());
+            m_cacheFolder = m_root.absoluteFilePath("cache");
+            m_sourceFolder = m_root.absoluteFilePath("source");
+            m_jobFolder = m_root.absoluteFilePath("job");
+            m_retrieveFolder = m_root.absoluteFilePath("retrieve");
+        }
+
+        AZStd::string ReadFile(const QString& filePath)
+        {
+            QFile file(filePath);
+            if (!file.open(QIODevice::ReadOnly))
+            {
+                return {};
+            }
+            const QByteArray contents = file.readAll();
+            return AZStd::string(contents.constData(), contents.size());
+        }
+
+        QTemporaryDir m_tempDir;
+        QDir m_root;
+        QString m_cacheFolder;
+        QString m_sourceFolder;
+        QString m_jobFolder;
+        QString m_retrieveFolder;
+    };
+
+    TEST_F(JobOutputCacheTest, RetrieveJobResult_AfterStore_RestoresTempFolderAndCopiedSources)
+    {
+        JobOutputCache cache(m_cacheFolder);
+        const QString key = "0123456789abcdef0123456789abcdef01234567";
+
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(QDir(m_jobFolder).absoluteFilePath("product.bin"), "product"));
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(QDir(m_jobFolder).absoluteFilePath("subfolder/other.bin"), "other"));
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(QDir(m_sourceFolder).absoluteFilePath("copied.txt"), "copied"));
+
+        EXPECT_FALSE(cache.RetrieveJobResult(key, m_retrieveFolder));
+        EXPECT_TRUE(cache.StoreJobResult(key, m_jobFolder, m_sourceFolder, { "copied.txt" }));
+        EXPECT_TRUE(QDir(cache.GetEntryFolder(key)).exists());
+        EXPECT_TRUE(cache.GetEntryFolder(key).contains("/01/"));
+
+        ASSERT_TRUE(cache.RetrieveJobResult(key, m_retrieveFolder));
+        QDir retrieveDir(m_retrieveFolder);
+        EXPECT_EQ(ReadFile(retrieveDir.absoluteFilePath("product.bin")), "product");
+        EXPECT_EQ(ReadFile(retrieveDir.absoluteFilePath("subfolder/other.bin")), "other");
+        EXPECT_EQ(ReadFile(retrieveDir.absoluteFilePath("copied.txt")), "copied");
+
+        const JobOutputCache::Statistics statistics = cache.GetStatistics();
+        EXPECT_EQ(statistics.m_hits, 1u);
+        EXPECT_EQ(statistics.m_misses, 1u);
+        EXPECT_EQ(statistics.m_stores, 1u);
+        EXPECT_EQ(statistics.m_storeFailures, 0u);
+    }
+
+    TEST_F(JobOutputCacheTest, StoreJobResult_MissingCopiedSource_StoresNothing)
+    {
+        JobOutputCache cache(m_cacheFolder);
+        const QString key = "fedcba9876543210fedcba9876543210fedcba98";
+
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(QDir(m_jobFolder).absoluteFilePath("product.bin"), "product"));
+
+        EXPECT_FALSE(cache.StoreJobResult(key, m_jobFolder, m_sourceFolder, { "missing.txt" }));
+        EXPECT_FALSE(QDir(cache.GetEntryFolder(key)).exists());
+        EXPECT_FALSE(cache.RetrieveJobResult(key, m_retrieveFolder));
+        EXPECT_EQ(cache.GetStatistics().m_storeFailures, 1u);
+
+        // nothing is left behind besides the empty bucket folder.
+        EXPECT_TRUE(QDir(QFileInfo(cache.GetEntryFolder(key)).absolutePath()).isEmpty());
+    }
+
+    TEST_F(JobOutputCacheTest, RetrieveJobResult_EmptyKey_IsNotCached)
+    {
+        JobOutputCache cache(m_cacheFolder);
+
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(QDir(m_jobFolder).absoluteFilePath("product.bin"), "product"));
+
+        EXPECT_FALSE(cache.StoreJobResult(QString(), m_jobFolder, m_sourceFolder, {}));
+        EXPECT_FALSE(cache.RetrieveJobResult(QString(), m_retrieveFolder));
+        EXPECT_FALSE(QDir(m_cacheFolder).exists());
+    }
+
+    TEST_F(JobOutputCacheTest, RetrieveJobResult_HardLinksEnabled_RestoresFiles)
+    {
+        JobOutputCache cache(m_cacheFolder, true);
+        const QString key = "00112233445566778899aabbccddeeff00112233";
+
+        ASSERT_TRUE(UnitTestUtils::CreateDummyFile(QDir(m_jobFolder).absoluteFilePath("product.bin"), "product"));
+        EXPECT_TRUE(cache.StoreJobResult(key, m_jobFolder, m_sourceFolder, {}));
+
+        ASSERT_TRUE(cache.RetrieveJobResult(key, m_retrieveFolder));
+        EXPECT_EQ(ReadFile(QDir(m_retrieveFolder).absoluteFilePath("product.bin")), "product");
+    }
+
+    TEST_F(JobOutputCacheTest, Constructor_RegistersInterface)
+    {
+        EXPECT_EQ(AZ::Interface<IJobOutputCacheRequests>::Get(), nullptr);
+        {
+            JobOutputCache cache(m_cacheFolder);
+            EXPECT_EQ(AZ::Interface<IJobOutputCacheRequests>::Get(), &cache);
+        }
+        EXPECT_EQ(AZ::Interface<IJobOutputCacheRequests>::Get(), nullptr);
+    }
+} // namespace AssetProcessor
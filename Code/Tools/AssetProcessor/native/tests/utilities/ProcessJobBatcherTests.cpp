@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "native/tests/AssetProcessorTest.h"
+#include <native/utilities/BuilderManager.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzTest/AzTest.h>
+
+#include <QDir>
+#include <QTemporaryDir>
+
+namespace AssetProcessor
+{
+    class ProcessJobBatcherTest
+        : public AssetProcessorTest
+    {
+    protected:
+        void SetUp() override
+        {
+            AssetProcessorTest::SetUp();
+            m_root = QDir(m_tempDir.path());
+        }
+
+        //! Answers every request with a successful response which has the source file as its only product
+        BuilderRunJobOutcome RunBatch(const AZStd::vector<AssetBuilderSDK::ProcessJobRequest>& requests, AZStd::vector<AssetBuilderSDK::ProcessJobResponse>& responses)
+        {
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_batchSizesMutex);
+                m_batchSizes.push_back(requests.size());
+            }
+
+            if (requests.size() > 1 && m_failBatches)
+            {
+                return BuilderRunJobOutcome::ResponseFailure;
+            }
+
+            responses.clear();
+            for (const AssetBuilderSDK::ProcessJobRequest& request : requests)
+            {
+                AssetBuilderSDK::ProcessJobResponse& response = responses.emplace_back();
+                response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Success;
+                response.m_outputProducts.push_back(AssetBuilderSDK::JobProduct(request.m_sourceFile));
+            }
+            return BuilderRunJobOutcome::Ok;
+        }
+
+        ProcessJobBatcher::RunBatchFunction GetRunBatchFunction()
+        {
+            return [this](const AZStd::vector<AssetBuilderSDK::ProcessJobRequest>& requests, AZStd::vector<AssetBuilderSDK::ProcessJobResponse>& responses, AssetBuilderSDK::JobCancelListener*)
+            {
+                return RunBatch(requests, responses);
+            };
+        }
+
+        AssetBuilderSDK::ProcessJobRequest CreateRequest(const QString& sourceFile, const QString& contents)
+        {
+            const QString fullPath = m_root.absoluteFilePath(sourceFile);
+            EXPECT_TRUE(UnitTestUtils::CreateDummyFile(fullPath, contents));
+
+            AssetBuilderSDK::ProcessJobRequest request;
+            request.m_sourceFile = sourceFile.toUtf8().constData();
+            request.m_fullPath = fullPath.toUtf8().constData();
+            request.m_jobId = ++m_lastJobId;
+            return request;
+        }
+
+        //! Runs the jobs on one thread each, the way the RCJobs of a builder run at the same time
+        void ProcessJobsInParallel(ProcessJobBatcher& batcher, const AZStd::vector<AssetBuilderSDK::ProcessJobRequest>& requests,
+            AZStd::vector<AssetBuilderSDK::ProcessJobResponse>& responses, AZStd::vector<BuilderRunJobOutcome>& outcomes)
+        {
+            responses.resize(requests.size());
+            outcomes.resize(requests.size(), BuilderRunJobOutcome::LostConnection);
+
+            AZStd::vector<AZStd::thread> threads;
+            for (size_t jobIndex = 0; jobIndex < requests.size(); ++jobIndex)
+            {
+                threads.emplace_back([&batcher, &requests, &responses, &outcomes, jobIndex]()
+                {
+                    outcomes[jobIndex] = batcher.ProcessJob(requests[jobIndex], responses[jobIndex], nullptr);
+                });
+            }
+            for (AZStd::thread& thread : threads)
+            {
+                thread.join();
+            }
+        }
+
+        QTemporaryDir m_tempDir;
+        QDir m_root;
+        AZ::u64 m_lastJobId = 0;
+        bool m_failBatches = false;
+        AZStd::mutex m_batchSizesMutex;
+        AZStd::vector<size_t> m_batchSizes;
+    };
+
+    TEST_F(ProcessJobBatcherTest, ProcessJob_BatchingDisabled_RunsEachJobOnItsOwn)
+    {
+        ProcessJobBatcher::Settings settings;
+        settings.m_maxSourceFileSize = 0;
+        settings.m_maxJobsPerBatch = 8;
+        settings.m_collectTimeMS = 10000;
+        ProcessJobBatcher batcher(settings, GetRunBatchFunction());
+
+        const AssetBuilderSDK::ProcessJobRequest first = CreateRequest("first.txt", "small");
+        const AssetBuilderSDK::ProcessJobRequest second = CreateRequest("second.txt", "small");
+        AssetBuilderSDK::ProcessJobResponse response;
+        EXPECT_EQ(batcher.ProcessJob(first, response, nullptr), BuilderRunJobOutcome::Ok);
+        EXPECT_EQ(batcher.ProcessJob(second, response, nullptr), BuilderRunJobOutcome::Ok);
+
+        EXPECT_EQ(m_batchSizes, AZStd::vector<size_t>({ 1, 1 }));
+        ASSERT_EQ(response.m_outputProducts.size(), 1);
+        EXPECT_EQ(response.m_outputProducts[0].m_productFileName, "second.txt");
+    }
+
+    TEST_F(ProcessJobBatcherTest, ProcessJob_LargeSourceFile_RunsOnItsOwn)
+    {
+        ProcessJobBatcher::Settings settings;
+        settings.m_maxSourceFileSize = 8;
+        settings.m_maxJobsPerBatch = 8;
+        settings.m_collectTimeMS = 10000;
+        ProcessJobBatcher batcher(settings, GetRunBatchFunction());
+
+        const AssetBuilderSDK::ProcessJobRequest request = CreateRequest("large.txt", "larger than the batched size");
+        AssetBuilderSDK::ProcessJobResponse response;
+        EXPECT_EQ(batcher.ProcessJob(request, response, nullptr), BuilderRunJobOutcome::Ok);
+
+        EXPECT_EQ(m_batchSizes, AZStd::vector<size_t>({ 1 }));
+        EXPECT_EQ(response.m_resultCode, AssetBuilderSDK::ProcessJobResult_Success);
+    }
+
+    TEST_F(ProcessJobBatcherTest, ProcessJob_SmallJobsAtTheSameTime_RunInOneBatch)
+    {
+        constexpr AZ::u32 JobCount = 4;
+
+        ProcessJobBatcher::Settings settings;
+        settings.m_maxSourceFileSize = 1024;
+        settings.m_maxJobsPerBatch = JobCount;
+        // long enough for every job to join, the batch runs as soon as it is full
+        settings.m_collectTimeMS = 60000;
+        ProcessJobBatcher batcher(settings, GetRunBatchFunction());
+
+        AZStd::vector<AssetBuilderSDK::ProcessJobRequest> requests;
+        for (AZ::u32 jobIndex = 0; jobIndex < JobCount; ++jobIndex)
+        {
+            requests.push_back(CreateRequest(QString("source%1.txt").arg(jobIndex), "small"));
+        }
+
+        AZStd::vector<AssetBuilderSDK::ProcessJobResponse> responses;
+        AZStd::vector<BuilderRunJobOutcome> outcomes;
+        ProcessJobsInParallel(batcher, requests, responses, outcomes);
+
+        EXPECT_EQ(m_batchSizes, AZStd::vector<size_t>({ JobCount }));
+        for (AZ::u32 jobIndex = 0; jobIndex < JobCount; ++jobIndex)
+        {
+            EXPECT_EQ(outcomes[jobIndex], BuilderRunJobOutcome::Ok);
+            EXPECT_EQ(responses[jobIndex].m_resultCode, AssetBuilderSDK::ProcessJobResult_Success);
+            ASSERT_EQ(responses[jobIndex].m_outputProducts.size(), 1);
+            EXPECT_EQ(responses[jobIndex].m_outputProducts[0].m_productFileName, requests[jobIndex].m_sourceFile);
+        }
+    }
+
+    TEST_F(ProcessJobBatcherTest, ProcessJob_BatchFails_RunsEachJobAgainOnItsOwn)
+    {
+        constexpr AZ::u32 JobCount = 2;
+        m_failBatches = true;
+
+        ProcessJobBatcher::Settings settings;
+        settings.m_maxSourceFileSize = 1024;
+        settings.m_maxJobsPerBatch = JobCount;
+        settings.m_collectTimeMS = 60000;
+        ProcessJobBatcher batcher(settings, GetRunBatchFunction());
+
+        AZStd::vector<AssetBuilderSDK::ProcessJobRequest> requests;
+        for (AZ::u32 jobIndex = 0; jobIndex < JobCount; ++jobIndex)
+        {
+            requests.push_back(CreateRequest(QString("source%1.txt").arg(jobIndex), "small"));
+        }
+
+        AZStd::vector<AssetBuilderSDK::ProcessJobResponse> responses;
+        AZStd::vector<BuilderRunJobOutcome> outcomes;
+        ProcessJobsInParallel(batcher, requests, responses, outcomes);
+
+        AZStd::sort(m_batchSizes.begin(), m_batchSizes.end());
+        EXPECT_EQ(m_batchSizes, AZStd::vector<size_t>({ 1, 1, JobCount }));
+        for (AZ::u32 jobIndex = 0; jobIndex < JobCount; ++jobIndex)
+        {
+            EXPECT_EQ(outcomes[jobIndex], BuilderRunJobOutcome::Ok);
+            ASSERT_EQ(responses[jobIndex].m_outputProducts.size(), 1);
+            EXPECT_EQ(responses[jobIndex].m_outputProducts[0].m_productFileName, requests[jobIndex].m_sourceFile);
+        }
+    }
+} // namespace AssetProcessor
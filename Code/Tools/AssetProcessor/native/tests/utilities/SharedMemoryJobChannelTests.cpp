@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "native/tests/AssetProcessorTest.h"
+#include <AssetBuilderSDK/SharedMemoryJobChannel.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Socket/AzSocket.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzTest/AzTest.h>
+
+namespace AssetProcessor
+{
+    using AssetBuilderSDK::SharedMemoryJobChannel;
+
+    namespace
+    {
+        AZStd::string UniqueChannelName()
+        {
+            return AZStd::string::format("JobChannelTest_%s", AZ::Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str());
+        }
+    }
+
+    class SharedMemoryJobChannelTest
+        : public AssetProcessorTest
+    {
+    };
+
+    //! Gives the tests access to the raw stream so they can write frames the public interface refuses to send.
+    class RawFrameJobChannel
+        : public SharedMemoryJobChannel
+    {
+    public:
+        bool SendFrameHeader(AZ::u32 type, AZ::u32 serial, AZ::u32 dataSize)
+        {
+            const FrameHeader header{ type, serial, dataSize };
+            return WriteBytes(reinterpret_cast<const char*>(&header), sizeof(header), AZStd::chrono::system_clock::now() + AZStd::chrono::seconds(1));
+        }
+    };
+
+#if AZ_TRAIT_SUPPORT_IPC
+
+    TEST_F(SharedMemoryJobChannelTest, Receive_MessageSentByOtherEnd_ReturnsMessage)
+    {
+        const AZStd::string name = UniqueChannelName();
+        SharedMemoryJobChannel host;
+        SharedMemoryJobChannel builder;
+        ASSERT_TRUE(host.Create(name.c_str(), 1024));
+        ASSERT_TRUE(builder.Open(name.c_str()));
+
+        const char request[] = "request";
+        ASSERT_TRUE(host.Send(1, 2, request, sizeof(request), 1000));
+
+        SharedMemoryJobChannel::Message message;
+        ASSERT_TRUE(builder.Receive(message, 1000));
+        EXPECT_EQ(message.m_type, 1u);
+        EXPECT_EQ(message.m_serial, 2u);
+        ASSERT_EQ(message.m_payload.size(), sizeof(request));
+        EXPECT_STREQ(message.m_payload.data(), request);
+
+        // each direction has its own ring buffer, nothing comes back to the sender.
+        EXPECT_FALSE(host.Receive(message, 0));
+
+        ASSERT_TRUE(builder.Send(3, 2, nullptr, 0, 1000));
+        ASSERT_TRUE(host.Receive(message, 1000));
+        EXPECT_EQ(message.m_type, 3u);
+        EXPECT_TRUE(message.m_payload.empty());
+    }
+
+    TEST_F(SharedMemoryJobChannelTest, Send_MessageLargerThanRingBuffer_IsStreamedThrough)
+    {
+        const AZStd::string name = UniqueChannelName();
+        SharedMemoryJobChannel host;
+        SharedMemoryJobChannel builder;
+        ASSERT_TRUE(host.Create(name.c_str(), 256));
+        ASSERT_TRUE(builder.Open(name.c_str()));
+
+        AZStd::vector<char> payload(64 * 1024);
+        for (size_t index = 0; index < payload.size(); ++index)
+        {
+            payload[index] = static_cast<char>(index % 251);
+        }
+
+        SharedMemoryJobChannel::Message message;
+        bool received = false;
+        AZStd::thread receiver([&builder, &message, &received]()
+        {
+            received = builder.Receive(message, 10000);
+        });
+
+        EXPECT_TRUE(host.Send(7, 1, payload.data(), static_cast<AZ::u32>(payload.size()), 10000));
+        receiver.join();
+
+        ASSERT_TRUE(received);
+        EXPECT_EQ(message.m_payload, payload);
+    }
+
+    TEST_F(SharedMemoryJobChannelTest, Send_NobodyReading_TimesOutAndStopsChannel)
+    {
+        const AZStd::string name = UniqueChannelName();
+        SharedMemoryJobChannel host;
+        ASSERT_TRUE(host.Create(name.c_str(), 256));
+
+        AZStd::vector<char> payload(1024);
+        EXPECT_FALSE(host.Send(1, 1, payload.data(), static_cast<AZ::u32>(payload.size()), 10));
+        EXPECT_FALSE(host.IsOpen());
+    }
+
+    TEST_F(SharedMemoryJobChannelTest, Receive_FrameLargerThanMaxMessageSize_ClosesChannel)
+    {
+        const AZStd::string name = UniqueChannelName();
+        RawFrameJobChannel host;
+        SharedMemoryJobChannel builder;
+        ASSERT_TRUE(host.Create(name.c_str(), 1024));
+        ASSERT_TRUE(builder.Open(name.c_str()));
+
+        ASSERT_TRUE(host.SendFrameHeader(1, 1, SharedMemoryJobChannel::MaxMessageSize + 1));
+
+        SharedMemoryJobChannel::Message message;
+        EXPECT_FALSE(builder.Receive(message, 1000));
+        EXPECT_FALSE(builder.IsOpen());
+        EXPECT_TRUE(message.m_payload.empty());
+    }
+
+    TEST_F(SharedMemoryJobChannelTest, Open_ChannelNotCreated_Fails)
+    {
+        SharedMemoryJobChannel builder;
+        EXPECT_FALSE(builder.Open(UniqueChannelName().c_str()));
+        EXPECT_FALSE(builder.IsOpen());
+    }
+#else
+    TEST_F(SharedMemoryJobChannelTest, Create_UnsupportedPlatform_Fails)
+    {
+        SharedMemoryJobChannel host;
+        EXPECT_FALSE(SharedMemoryJobChannel::IsSupported());
+        EXPECT_FALSE(host.Create(UniqueChannelName().c_str()));
+        EXPECT_FALSE(host.IsOpen());
+    }
+#endif // AZ_TRAIT_SUPPORT_IPC
+
+#if defined(HAVE_BENCHMARK)
+    namespace Benchmark
+    {
+        namespace
+        {
+            // sizes in the range of the serialized requests and responses of small jobs
+            constexpr AZ::u32 RequestSize = 2048;
+            constexpr AZ::u32 ResponseSize = 512;
+
+            //! The framing the socket connection uses for the builder messages, a header followed by the payload
+            struct SocketMessageHeader
+            {
+                AZ::u32 m_type = 0;
+                AZ::u32 m_serial = 0;
+                AZ::u32 m_size = 0;
+            };
+
+            bool SendAll(AZSOCKET socket, const char* data, AZ::u32 size)
+            {
+                while (size > 0)
+                {
+                    const AZ::s32 sent = AZ::AzSock::Send(socket, data, static_cast<AZ::s32>(size), 0);
+                    if (sent <= 0)
+                    {
+                        return false;
+                    }
+                    data += sent;
+                    size -= static_cast<AZ::u32>(sent);
+                }
+                return true;
+            }
+
+            bool ReceiveAll(AZSOCKET socket, char* data, AZ::u32 size)
+            {
+                while (size > 0)
+                {
+                    const AZ::s32 received = AZ::AzSock::Recv(socket, data, static_cast<AZ::s32>(size), 0);
+                    if (received <= 0)
+                    {
+                        return false;
+                    }
+                    data += received;
+                    size -= static_cast<AZ::u32>(received);
+                }
+                return true;
+            }
+
+            bool SendSocketMessage(AZSOCKET socket, AZ::u32 type, AZ::u32 serial, const AZStd::vector<char>& payload)
+            {
+                SocketMessageHeader header;
+                header.m_type = type;
+                header.m_serial = serial;
+                header.m_size = static_cast<AZ::u32>(payload.size());
+                return SendAll(socket, reinterpret_cast<const char*>(&header), sizeof(header)) && SendAll(socket, payload.data(), header.m_size);
+            }
+
+            bool ReceiveSocketMessage(AZSOCKET socket, SocketMessageHeader& header, AZStd::vector<char>& payload)
+            {
+                if (!ReceiveAll(socket, reinterpret_cast<char*>(&header), sizeof(header)))
+                {
+                    return false;
+                }
+                payload.resize_no_construct(header.m_size);
+                return ReceiveAll(socket, payload.data(), header.m_size);
+            }
+        }
+
+        //! Runs jobs against a synthetic builder which answers every request right away, through the shared memory channel and
+        //! through a loopback socket. The argument is the number of jobs sent before waiting for their responses.
+        class JobTransportBenchmarkFixture
+            : public UnitTest::AllocatorsBenchmarkFixture
+        {
+        public:
+            void SetUp(const ::benchmark::State& state) override
+            {
+                UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+                internalSetUp();
+            }
+            void SetUp(::benchmark::State& state) override
+            {
+                UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+                internalSetUp();
+            }
+
+            void TearDown(const ::benchmark::State& state) override
+            {
+                internalTearDown();
+                UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+            }
+            void TearDown(::benchmark::State& state) override
+            {
+                internalTearDown();
+                UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+            }
+
+        protected:
+            void internalSetUp()
+            {
+                m_request.resize(RequestSize);
+                AZ::AzSock::Startup();
+            }
+
+            void internalTearDown()
+            {
+                StopBuilder();
+                AZ::AzSock::Cleanup();
+                m_request = {};
+            }
+
+            bool StartSocketBuilder()
+            {
+                AZSOCKET listenSocket = AZ::AzSock::Socket();
+                AZ::AzSock::AzSocketAddress address;
+                address.SetAddress("127.0.0.1", 0);
+                if (!AZ::AzSock::IsAzSocketValid(listenSocket) || AZ::AzSock::SocketErrorOccured(AZ::AzSock::Bind(listenSocket, address)) ||
+                    AZ::AzSock::SocketErrorOccured(AZ::AzSock::Listen(listenSocket, 1)) ||
+                    AZ::AzSock::SocketErrorOccured(AZ::AzSock::GetSockName(listenSocket, address)))
+                {
+                    AZ::AzSock::CloseSocket(listenSocket);
+                    return false;
+                }
+
+                m_hostSocket = AZ::AzSock::Socket();
+                const bool connected = AZ::AzSock::IsAzSocketValid(m_hostSocket) && !AZ::AzSock::SocketErrorOccured(AZ::AzSock::Connect(m_hostSocket, address));
+                AZ::AzSock::AzSocketAddress builderAddress;
+                AZSOCKET builderSocket = connected ? AZ::AzSock::Accept(listenSocket, builderAddress) : AZ_SOCKET_INVALID;
+                AZ::AzSock::CloseSocket(listenSocket);
+                if (!AZ::AzSock::IsAzSocketValid(builderSocket))
+                {
+                    return false;
+                }
+                AZ::AzSock::EnableTCPNoDelay(m_hostSocket, true);
+                AZ::AzSock::EnableTCPNoDelay(builderSocket, true);
+
+                // answers until the host closes its end
+                m_builderThread = AZStd::thread([builderSocket]()
+                {
+                    const AZStd::vector<char> response(ResponseSize);
+                    SocketMessageHeader header;
+                    AZStd::vector<char> payload;
+                    while (ReceiveSocketMessage(builderSocket, header, payload) && SendSocketMessage(builderSocket, header.m_type, header.m_serial, response))
+                    {
+                    }
+                    AZ::AzSock::CloseSocket(builderSocket);
+                });
+                return true;
+            }
+
+#if AZ_TRAIT_SUPPORT_IPC
+            bool StartSharedMemoryBuilder()
+            {
+                const AZStd::string name = UniqueChannelName();
+                if (!m_hostChannel.Create(name.c_str()) || !m_builderChannel.Open(name.c_str()))
+                {
+                    return false;
+                }
+
+                m_builderRunning = true;
+                m_builderThread = AZStd::thread([this]()
+                {
+                    const AZStd::vector<char> response(ResponseSize);
+                    SharedMemoryJobChannel::Message message;
+                    while (m_builderRunning)
+                    {
+                        if (m_builderChannel.Receive(message, 10))
+                        {
+                            m_builderChannel.Send(message.m_type, message.m_serial, response.data(), ResponseSize, 1000);
+                        }
+                    }
+                });
+                return true;
+            }
+#endif // AZ_TRAIT_SUPPORT_IPC
+
+            void StopBuilder()
+            {
+                m_builderRunning = false;
+                if (AZ::AzSock::IsAzSocketValid(m_hostSocket))
+                {
+                    AZ::AzSock::CloseSocket(m_hostSocket);
+                    m_hostSocket = AZ_SOCKET_INVALID;
+                }
+                if (m_builderThread.joinable())
+                {
+                    m_builderThread.join();
+                }
+            }
+
+            AZStd::vector<char> m_request;
+            AZStd::thread m_builderThread;
+            AZStd::atomic_bool m_builderRunning{ false };
+            AZSOCKET m_hostSocket = AZ_SOCKET_INVALID;
+            SharedMemoryJobChannel m_hostChannel;
+            SharedMemoryJobChannel m_builderChannel;
+        };
+
+#if AZ_TRAIT_SUPPORT_IPC
+        BENCHMARK_DEFINE_F(JobTransportBenchmarkFixture, BM_SharedMemory_RunJobs)(benchmark::State& state)
+        {
+            if (!StartSharedMemoryBuilder())
+            {
+                state.SkipWithError("Failed to create the shared memory channel");
+                return;
+            }
+
+            const AZ::u32 batchSize = aznumeric_cast<AZ::u32>(state.range(0));
+            SharedMemoryJobChannel::Message message;
+            AZ::u32 serial = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (AZ::u32 jobIndex = 0; jobIndex < batchSize; ++jobIndex)
+                {
+                    m_hostChannel.Send(1, serial + jobIndex, m_request.data(), RequestSize, 1000);
+                }
+                for (AZ::u32 jobIndex = 0; jobIndex < batchSize; ++jobIndex)
+                {
+                    if (!m_hostChannel.Receive(message, 1000))
+                    {
+                        state.SkipWithError("The builder did not answer");
+                        return;
+                    }
+                }
+                serial += batchSize;
+            }
+
+            state.SetItemsProcessed(state.iterations() * batchSize);
+        }
+
+        BENCHMARK_REGISTER_F(JobTransportBenchmarkFixture, BM_SharedMemory_RunJobs)->Arg(1)->Arg(8)->Arg(32);
+#endif // AZ_TRAIT_SUPPORT_IPC
+
+        BENCHMARK_DEFINE_F(JobTransportBenchmarkFixture, BM_Socket_RunJobs)(benchmark::State& state)
+        {
+            if (!StartSocketBuilder())
+            {
+                state.SkipWithError("Failed to connect the loopback socket");
+                return;
+            }
+
+            const AZ::u32 batchSize = aznumeric_cast<AZ::u32>(state.range(0));
+            SocketMessageHeader header;
+            AZStd::vector<char> payload;
+            AZ::u32 serial = 0;
+            for ([[maybe_unused]] auto _ : state)
+            {
+                for (AZ::u32 jobIndex = 0; jobIndex < batchSize; ++jobIndex)
+                {
+                    SendSocketMessage(m_hostSocket, 1, serial + jobIndex, m_request);
+                }
+                for (AZ::u32 jobIndex = 0; jobIndex < batchSize; ++jobIndex)
+                {
+                    if (!ReceiveSocketMessage(m_hostSocket, header, payload))
+                    {
+                        state.SkipWithError("The builder did not answer");
+                        return;
+                    }
+                }
+                serial += batchSize;
+            }
+
+            state.SetItemsProcessed(state.iterations() * batchSize);
+        }
+
+        BENCHMARK_REGISTER_F(JobTransportBenchmarkFixture, BM_Socket_RunJobs)->Arg(1)->Arg(8)->Arg(32);
+    } // namespace Benchmark
+#endif // HAVE_BENCHMARK
+} // namespace AssetProcessor
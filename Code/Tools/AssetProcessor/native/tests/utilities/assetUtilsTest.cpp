@@ -623,3 +623,171 @@ TEST_F(AssetUtilitiesTest, CreateDir_InvalidDir_Timeout_Valid)
     ASSERT_FALSE(dir.exists());
 }
 
+
+TEST_F(AssetUtilitiesTest, GetFileHash_LargeFile_MatchesStreamedHash)
+{
+    SetUseFileHashOverride(true, true);
+
+    QTemporaryDir tempDir;
+    QString fileName = QDir(tempDir.path()).filePath("large.bin");
+    {
+        // Large enough to be memory mapped on platforms that support it, and not a multiple of the stream buffer size
+        QFile file(fileName);
+        ASSERT_TRUE(file.open(QIODevice::WriteOnly));
+        QByteArray block(aznumeric_cast<int>(FileHashBufferSize), 'a');
+        for (AZ::u64 written = 0; written <= FileHashMapMinimumSize; written += FileHashBufferSize)
+        {
+            block[0] = static_cast<char>(written / FileHashBufferSize);
+            file.write(block);
+        }
+        file.write("tail", 4);
+    }
+
+    AZ::IO::SizeType bytesRead = 0;
+    AZ::u64 hash = GetFileHash(fileName.toUtf8().constData(), true, &bytesRead);
+
+    // Any hashing delay forces the file to be streamed
+    AZ::IO::SizeType streamedBytesRead = 0;
+    AZ::u64 streamedHash = GetFileHash(fileName.toUtf8().constData(), true, &streamedBytesRead, /*hashMsDelay*/ 1);
+
+    EXPECT_NE(hash, 0);
+    EXPECT_EQ(hash, streamedHash);
+    EXPECT_EQ(bytesRead, streamedBytesRead);
+    EXPECT_EQ(bytesRead, QFileInfo(fileName).size());
+
+    SetUseFileHashOverride(false, false);
+}
+
+TEST_F(AssetUtilitiesTest, ComputeJobOutputCacheKey_FileHashingDisabled_IsEmpty)
+{
+    SetUseFileHashOverride(true, false);
+
+    AssetProcessor::JobDetails jobDetail;
+    jobDetail.m_extraInformationForFingerprinting = "extra info";
+    AssetBuilderSDK::ProcessJobRequest request;
+    request.m_platformInfo.m_identifier = "pc";
+
+    // modification times aren't content, so nothing is cached without file hashing.
+    EXPECT_TRUE(ComputeJobOutputCacheKey(jobDetail, request).isEmpty());
+
+    SetUseFileHashOverride(false, false);
+}
+
+TEST_F(AssetUtilitiesTest, ComputeJobOutputCacheKey_InputContentChanges_KeyChanges)
+{
+    SetUseFileHashOverride(true, true);
+
+    QTemporaryDir dir;
+    QDir tempPath(dir.path());
+    QString canonicalTempDirPath = AssetUtilities::NormalizeDirectoryPath(tempPath.canonicalPath());
+    UnitTestUtils::ScopedDir changeDir(canonicalTempDirPath);
+    tempPath = QDir(canonicalTempDirPath);
+    QString absoluteTestFilePath = tempPath.absoluteFilePath("basicfile.txt");
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(absoluteTestFilePath, "contents"));
+
+    AssetProcessor::JobDetails jobDetail;
+    jobDetail.m_fingerprintFiles.insert(AZStd::make_pair(absoluteTestFilePath.toUtf8().constData(), "basicfile.txt"));
+    AssetBuilderSDK::ProcessJobRequest request;
+    request.m_sourceFile = "basicfile.txt";
+    request.m_platformInfo.m_identifier = "pc";
+
+    QString key1 = ComputeJobOutputCacheKey(jobDetail, request);
+    EXPECT_EQ(key1.size(), 40);
+    EXPECT_EQ(ComputeJobOutputCacheKey(jobDetail, request), key1);
+
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(absoluteTestFilePath, "contents new"));
+    QString key2 = ComputeJobOutputCacheKey(jobDetail, request);
+    EXPECT_NE(key1, key2);
+
+    // the key is addressed by content, writing the original contents back gives the original key even though the file is newer.
+    UnitTestUtils::SleepForMinimumFileSystemTime();
+    EXPECT_TRUE(UnitTestUtils::CreateDummyFile(absoluteTestFilePath, "contents"));
+    EXPECT_EQ(ComputeJobOutputCacheKey(jobDetail, request), key1);
+
+    SetUseFileHashOverride(false, false);
+}
+
+TEST_F(AssetUtilitiesTest, ComputeJobOutputCacheKey_BuilderFingerprintChanges_KeyChanges)
+{
+    SetUseFileHashOverride(true, true);
+
+    AssetProcessor::JobDetails jobDetail;
+    jobDetail.m_assetBuilderDesc.m_analysisFingerprint = "builder version 1";
+    jobDetail.m_extraInformationForFingerprinting = "extra info";
+    AssetBuilderSDK::ProcessJobRequest request;
+    request.m_sourceFile = "basicfile.txt";
+    request.m_platformInfo.m_identifier = "pc";
+
+    QString key1 = ComputeJobOutputCacheKey(jobDetail, request);
+
+    jobDetail.m_assetBuilderDesc.m_analysisFingerprint = "builder version 2";
+    QString key2 = ComputeJobOutputCacheKey(jobDetail, request);
+
+    jobDetail.m_extraInformationForFingerprinting = "extra info2";
+    QString key3 = ComputeJobOutputCacheKey(jobDetail, request);
+
+    EXPECT_FALSE(key1.isEmpty());
+    EXPECT_NE(key1, key2);
+    EXPECT_NE(key2, key3);
+    EXPECT_NE(key3, key1);
+
+    SetUseFileHashOverride(false, false);
+}
+
+TEST_F(AssetUtilitiesTest, ComputeJobOutputCacheKey_PlatformChanges_KeyChanges)
+{
+    SetUseFileHashOverride(true, true);
+
+    AssetProcessor::JobDetails jobDetail;
+    jobDetail.m_extraInformationForFingerprinting = "extra info";
+    AssetBuilderSDK::ProcessJobRequest request;
+    request.m_sourceFile = "basicfile.txt";
+    request.m_platformInfo.m_identifier = "pc";
+
+    QString key1 = ComputeJobOutputCacheKey(jobDetail, request);
+
+    request.m_platformInfo.m_identifier = "android";
+    QString key2 = ComputeJobOutputCacheKey(jobDetail, request);
+
+    EXPECT_FALSE(key1.isEmpty());
+    EXPECT_NE(key1, key2);
+
+    SetUseFileHashOverride(false, false);
+}
+
+TEST_F(AssetUtilitiesTest, ComputeJobOutputCacheKey_JobDependencyFingerprint_AffectsOutcome)
+{
+    using namespace testing;
+    using ::testing::NiceMock;
+
+    SetUseFileHashOverride(true, true);
+
+    NiceMock<AssetUtilsTest::MockJobDependencyResponder> responder;
+    responder.BusConnect();
+
+    AssetProcessor::JobDetails jobDetail;
+    jobDetail.m_extraInformationForFingerprinting = "extra info";
+    AssetBuilderSDK::ProcessJobRequest request;
+    request.m_sourceFile = "basicfile.txt";
+    request.m_platformInfo.m_identifier = "pc";
+
+    AssetBuilderSDK::JobDependency jobDep("thing", "pc", AssetBuilderSDK::JobDependencyType::Order, AssetBuilderSDK::SourceFileDependency("basicfile2.txt", AZ::Uuid::CreateNull()));
+    AssetProcessor::JobDependencyInternal internalJobDep(jobDep);
+    internalJobDep.m_builderUuidList.insert(AZ::Uuid::CreateRandom());
+    jobDetail.m_jobDependencyList.push_back(internalJobDep);
+
+    EXPECT_CALL(responder, GetJobFingerprint(_))
+        .WillOnce(Return(0x12341234))
+        .WillOnce(Return(0x11111111))
+        .WillOnce(Return(0));
+
+    QString key1 = ComputeJobOutputCacheKey(jobDetail, request);
+    QString key2 = ComputeJobOutputCacheKey(jobDetail, request);
+    EXPECT_FALSE(key1.isEmpty());
+    EXPECT_NE(key1, key2);
+
+    // the outputs of the job it depends on aren't known yet, so neither are the outputs of this job.
+    EXPECT_TRUE(ComputeJobOutputCacheKey(jobDetail, request).isEmpty());
+
+    SetUseFileHashOverride(false, false);
+}
@@ -22,6 +22,7 @@
 #include <native/FileProcessor/FileProcessor.h>
 #include <native/utilities/ApplicationServer.h>
 #include <native/utilities/AssetServerHandler.h>
+#include <native/utilities/JobOutputCache.h>
 #include <native/InternalBuilders/SettingsRegistryBuilder.h>
 #include <AzToolsFramework/Application/Ticker.h>
 #include <AzToolsFramework/ToolsFileUtils/ToolsFileUtils.h>
@@ -178,6 +179,7 @@ void ApplicationManagerBase::InitAssetProcessorManager()
     const APCommandLineSwitch Command_acceptInput("acceptInput", "Enable external control messaging via the ControlRequestHandler, used with automated tests.");
     const APCommandLineSwitch Command_debugOutput("debugOutput", "When enabled, builders that support it will output debug information as product assets. Used primarily with scene files.");
     const APCommandLineSwitch Command_sortJobsByDBSourceName("sortJobsByDBSourceName", "When enabled, sorts pending jobs with equal priority and dependencies by database source name instead of job ID. Useful for automated tests to process assets in the same order each time.");
+    const APCommandLineSwitch Command_criticalPathScheduling("criticalPathScheduling", "When enabled, pending jobs are dispatched by the estimated length of the chain of jobs waiting on them, based on the durations of previous runs, so the longest chains start first.");
     const APCommandLineSwitch Command_truncatefingerprint("truncatefingerprint", "Truncates the fingerprint used for processed assets. Useful if you plan to compress product assets to share on another machine because some compression formats like zip will truncate file mod timestamps.");
     const APCommandLineSwitch Command_help("help", "Displays this message.");
     const APCommandLineSwitch Command_h("h", Command_help.m_helpText);
@@ -265,6 +267,11 @@ void ApplicationManagerBase::InitAssetProcessorManager()
         m_sortJobsByDBSourceName = true;
     }
 
+    if (commandLine->HasSwitch(Command_criticalPathScheduling.m_switch))
+    {
+        m_criticalPathScheduling = true;
+    }
+
     if (commandLine->HasSwitch(Command_truncatefingerprint.m_switch))
     {
         // Zip archive format uses 2 second precision truncated
@@ -303,6 +310,7 @@ void ApplicationManagerBase::InitAssetProcessorManager()
         AZ_TracePrintf("AssetProcessor", "\t%s : %s\n", Command_acceptInput.m_switch, Command_acceptInput.m_helpText);
         AZ_TracePrintf("AssetProcessor", "\t%s : %s\n", Command_debugOutput.m_switch, Command_debugOutput.m_helpText);
         AZ_TracePrintf("AssetProcessor", "\t%s : %s\n", Command_sortJobsByDBSourceName.m_switch, Command_sortJobsByDBSourceName.m_helpText);
+        AZ_TracePrintf("AssetProcessor", "\t%s : %s\n", Command_criticalPathScheduling.m_switch, Command_criticalPathScheduling.m_helpText);
         AZ_TracePrintf("AssetProcessor", "\t%s : %s\n", Command_truncatefingerprint.m_switch, Command_truncatefingerprint.m_helpText);
         AZ_TracePrintf("AssetProcessor", "\t%s : %s\n", Command_help.m_switch, Command_help.m_helpText);
         AZ_TracePrintf("AssetProcessor", "\t%s : %s\n", Command_h.m_switch, Command_h.m_helpText);
@@ -348,6 +356,8 @@ void ApplicationManagerBase::InitRCController()
         m_rcController->SetQueueSortOnDBSourceName();
     }
 
+    m_rcController->SetCriticalPathScheduling(m_criticalPathScheduling);
+
     QObject::connect(m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::AssetToProcess, m_rcController, &AssetProcessor::RCController::JobSubmitted);
     QObject::connect(m_rcController, &AssetProcessor::RCController::FileCompiled, m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::AssetProcessed, Qt::UniqueConnection);
     QObject::connect(m_rcController, &AssetProcessor::RCController::FileFailed, m_assetProcessorManager, &AssetProcessor::AssetProcessorManager::AssetFailed);
@@ -817,6 +827,7 @@ void ApplicationManagerBase::Destroy()
     DestroyConnectionManager();
     DestroyAssetServerHandler();
     DestroyRCController();
+    m_jobOutputCache.reset();
     DestroyAssetScanner();
     DestroyFileMonitor();
     ShutDownAssetDatabase();
@@ -1234,6 +1245,48 @@ void ApplicationManagerBase::DestroyAssetServerHandler()
     m_assetServerHandler = nullptr;
 }
 
+void ApplicationManagerBase::InitJobOutputCache()
+{
+    auto settingsRegistry = AZ::SettingsRegistry::Get();
+    if (!settingsRegistry)
+    {
+        return;
+    }
+
+    const auto jobOutputCacheKey = AZ::SettingsRegistryInterface::FixedValueString(AssetProcessor::AssetProcessorSettingsKey) + "/JobOutputCache";
+    bool enabled = false;
+    settingsRegistry->Get(enabled, jobOutputCacheKey + "/enabled");
+    if (!enabled)
+    {
+        return;
+    }
+
+    if (!AssetUtilities::ShouldUseFileHashing())
+    {
+        AZ_Warning(AssetProcessor::ConsoleChannel, false, "The job output cache requires file hashing, it is disabled because file hashing is off.\n");
+        return;
+    }
+
+    AZStd::string cacheFolder;
+    settingsRegistry->Get(cacheFolder, jobOutputCacheKey + "/cacheFolder");
+    QString cacheFolderPath = QString::fromUtf8(cacheFolder.c_str(), aznumeric_cast<int>(cacheFolder.size()));
+    if (cacheFolderPath.isEmpty())
+    {
+        QDir cacheRoot;
+        if (!AssetUtilities::ComputeProjectCacheRoot(cacheRoot))
+        {
+            return;
+        }
+        cacheFolderPath = cacheRoot.absoluteFilePath("JobOutputCache");
+    }
+
+    bool useHardLinks = false;
+    settingsRegistry->Get(useHardLinks, jobOutputCacheKey + "/useHardLinks");
+
+    AZ_TracePrintf(AssetProcessor::ConsoleChannel, "Job output cache enabled in %s.\n", cacheFolderPath.toUtf8().constData());
+    m_jobOutputCache = AZStd::make_unique<AssetProcessor::JobOutputCache>(cacheFolderPath, useHardLinks);
+}
+
 // IMPLEMENTATION OF -------------- AzToolsFramework::AssetDatabase::AssetDatabaseRequests::Bus::Listener
 bool ApplicationManagerBase::GetAssetDatabaseLocation(AZStd::string& location)
 {
@@ -1318,6 +1371,7 @@ bool ApplicationManagerBase::Activate()
     InitFileMonitor();
     InitAssetScanner();
     InitAssetServerHandler();
+    InitJobOutputCache();
     InitRCController();
 
     InitConnectionManager();
@@ -1584,29 +1638,44 @@ void ApplicationManagerBase::RegisterBuilderInformation(const AssetBuilderSDK::A
                 }
             };
 
-        // Also override the processJob function to run externally
-        modifiedBuilderDesc.m_processJobFunction = [builderFilePath](const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response)
+        // Also override the processJob function to run externally. Process jobs of small source files which run at the same time
+        // are sent to one builder together, see ProcessJobBatcher
+        auto runProcessJobs = [builderFilePath](const AZStd::vector<AssetBuilderSDK::ProcessJobRequest>& requests,
+            AZStd::vector<AssetBuilderSDK::ProcessJobResponse>& responses, AssetBuilderSDK::JobCancelListener* jobCancelListener)
             {
-                AssetBuilderSDK::JobCancelListener jobCancelListener(request.m_jobId);
-
                 AssetProcessor::BuilderRef builderRef;
                 AssetProcessor::BuilderManagerBus::BroadcastResult(builderRef, &AssetProcessor::BuilderManagerBusTraits::GetBuilder);
 
-                if (builderRef)
+                if (!builderRef)
                 {
-                    int retryCount = 0;
-                    AssetProcessor::BuilderRunJobOutcome result;
-
-                    do
-                    {
-                        retryCount++;
-                        result = builderRef->RunJob<AssetBuilderSDK::ProcessJobNetRequest, AssetBuilderSDK::ProcessJobNetResponse>(request, response, s_MaximumProcessJobsTimeSeconds, "process", builderFilePath, &jobCancelListener, request.m_tempDirPath);
-                    } while (result == AssetProcessor::BuilderRunJobOutcome::LostConnection && retryCount <= AssetProcessor::RetriesForJobNetworkError);
+                    AZ_Error("AssetProcessor", false, "Failed to retrieve a valid builder to process job");
+                    return AssetProcessor::BuilderRunJobOutcome::LostConnection;
                 }
-                else
+
+                AZStd::vector<AZStd::string> tempFolderPaths;
+                tempFolderPaths.reserve(requests.size());
+                for (const AssetBuilderSDK::ProcessJobRequest& request : requests)
                 {
-                    AZ_Error("AssetProcessor", false, "Failed to retrieve a valid builder to process job");
+                    tempFolderPaths.push_back(request.m_tempDirPath);
                 }
+
+                int retryCount = 0;
+                AssetProcessor::BuilderRunJobOutcome result;
+
+                do
+                {
+                    retryCount++;
+                    result = builderRef->RunJobBatch<AssetBuilderSDK::ProcessJobNetRequest, AssetBuilderSDK::ProcessJobNetResponse>(requests, responses, s_MaximumProcessJobsTimeSeconds, "process", builderFilePath, jobCancelListener, tempFolderPaths);
+                } while (result == AssetProcessor::BuilderRunJobOutcome::LostConnection && retryCount <= AssetProcessor::RetriesForJobNetworkError);
+
+                return result;
+            };
+
+        auto processJobBatcher = AZStd::make_shared<AssetProcessor::ProcessJobBatcher>(AssetProcessor::ProcessJobBatcher::LoadSettings(), AZStd::move(runProcessJobs));
+        modifiedBuilderDesc.m_processJobFunction = [processJobBatcher](const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response)
+            {
+                AssetBuilderSDK::JobCancelListener jobCancelListener(request.m_jobId);
+                processJobBatcher->ProcessJob(request, response, &jobCancelListener);
             };
     }
 
@@ -39,6 +39,7 @@ namespace AssetProcessor
     class FileProcessor;
     class FileStateBase;
     class FileStateCache;
+    class JobOutputCache;
     class InternalAssetBuilderInfo;
     class PlatformConfiguration;
     class RCController;
@@ -156,6 +157,7 @@ protected:
     void ShutDownAssetDatabase();
     void InitAssetServerHandler();
     void DestroyAssetServerHandler();
+    void InitJobOutputCache();
     void InitFileProcessor();
     void ShutDownFileProcessor();
     virtual void InitSourceControl() = 0;
@@ -210,6 +212,8 @@ protected:
 
     AZStd::unique_ptr<AssetProcessor::FileStateBase> m_fileStateCache;
 
+    AZStd::unique_ptr<AssetProcessor::JobOutputCache> m_jobOutputCache;
+
     AZStd::unique_ptr<AssetProcessor::FileProcessor> m_fileProcessor;
 
     AZStd::unique_ptr<AssetProcessor::BuilderConfigurationManager> m_builderConfig;
@@ -240,6 +244,7 @@ protected:
     // This switches that behavior to instead sort by the DB source name, which
     // allows automated tests to get deterministic behavior out of Asset Processor.
     bool m_sortJobsByDBSourceName = false;
+    bool m_criticalPathScheduling = false;
 
     unsigned int m_highestConnId = 0;
     AzToolsFramework::Ticker* m_ticker = nullptr; // for ticking the tickbus.
@@ -14,7 +14,9 @@
 #include <native/connection/connectionManager.h>
 #include <native/connection/connection.h>
 #include <native/utilities/AssetBuilderInfo.h>
+#include <native/utilities/PlatformConfiguration.h>
 #include <QCoreApplication>
+#include <QFileInfo>
 #include <AzCore/Settings/SettingsRegistryMergeUtils.h>
 
 namespace AssetProcessor
@@ -39,6 +41,11 @@ namespace AssetProcessor
         return m_connectionId > 0;
     }
 
+    bool Builder::IsUsingJobChannel() const
+    {
+        return m_jobChannel && m_jobChannel->IsOpen();
+    }
+
     bool Builder::WaitForConnection()
     {
         if (m_connectionId == 0)
@@ -155,7 +162,8 @@ namespace AssetProcessor
             return false;
         }
 
-        const AZStd::string params = BuildParams("resident", buildersFolder.c_str(), UuidString(), "", "");
+        AZStd::string params = BuildParams("resident", buildersFolder.c_str(), UuidString(), "", "");
+        params.append(CreateJobChannel());
 
         m_processWatcher = LaunchProcess(fullExePathString.c_str(), params);
 
@@ -166,7 +174,53 @@ namespace AssetProcessor
 
         m_tracePrinter = AZStd::make_unique<CommunicatorTracePrinter>(m_processWatcher->GetCommunicator(), "AssetBuilder");
 
-        return WaitForConnection();
+        if (!WaitForConnection())
+        {
+            return false;
+        }
+
+        ConfirmJobChannel();
+
+        return true;
+    }
+
+    AZStd::string Builder::CreateJobChannel()
+    {
+        if (m_jobChannelBufferSize == 0 || !AssetBuilderSDK::SharedMemoryJobChannel::IsSupported())
+        {
+            return {};
+        }
+
+        const AZStd::string channelName = AZStd::string::format("AssetBuilder_%s", UuidString().c_str());
+
+        m_jobChannel = AZStd::make_unique<AssetBuilderSDK::SharedMemoryJobChannel>();
+        if (!m_jobChannel->Create(channelName.c_str(), m_jobChannelBufferSize))
+        {
+            m_jobChannel = nullptr;
+            return {};
+        }
+
+        return AZStd::string::format(" -%s=%s", AssetBuilderSDK::SharedMemoryJobChannelParam, channelName.c_str());
+    }
+
+    void Builder::ConfirmJobChannel()
+    {
+        if (!m_jobChannel)
+        {
+            return;
+        }
+
+        // The builder sends a hello through the channel once it opened it, before it pings the Asset Processor through the socket.
+        // Builders which don't know about the channel never send it and keep receiving their jobs through the socket.
+        AssetBuilderSDK::SharedMemoryJobChannel::Message message;
+        if (m_jobChannel->Receive(message, 0) && message.m_type == AssetBuilderSDK::BuilderHelloRequest::MessageType())
+        {
+            AZ_TracePrintf(AssetProcessor::DebugChannel, "Builder %s receives its jobs through shared memory\n", UuidString().c_str());
+            return;
+        }
+
+        AZ_TracePrintf(AssetProcessor::DebugChannel, "Builder %s did not open its shared memory job channel, its jobs go through the socket\n", UuidString().c_str());
+        m_jobChannel = nullptr;
     }
 
     bool Builder::IsValid() const
@@ -262,7 +316,7 @@ namespace AssetProcessor
         return processWatcher;
     }
 
-    BuilderRunJobOutcome Builder::WaitForBuilderResponse(AssetBuilderSDK::JobCancelListener* jobCancelListener, AZ::u32 processTimeoutLimitInSeconds, AZStd::binary_semaphore* waitEvent) const
+    BuilderRunJobOutcome Builder::WaitForBuilderResponse(AssetBuilderSDK::JobCancelListener* jobCancelListener, AZ::u32 processTimeoutLimitInSeconds, const AZStd::function<bool()>& waitForResponse) const
     {
         AZ::u32 exitCode = 0;
         bool finishedOK = false;
@@ -272,7 +326,7 @@ namespace AssetProcessor
 
         while (!finishedOK)
         {
-            finishedOK = waitEvent->try_acquire_for(AZStd::chrono::milliseconds(s_MaximumSleepTimeMS));
+            finishedOK = waitForResponse();
 
             PumpCommunicator();
 
@@ -361,11 +415,168 @@ namespace AssetProcessor
 
     //////////////////////////////////////////////////////////////////////////
 
+    ProcessJobBatcher::ProcessJobBatcher(const Settings& settings, RunBatchFunction runBatch)
+        : m_settings(settings)
+        , m_runBatch(AZStd::move(runBatch))
+    {
+    }
+
+    ProcessJobBatcher::Settings ProcessJobBatcher::LoadSettings()
+    {
+        // batching is opt-in, see ProcessJob for how batched jobs share the cancel listener and job log of their first job
+        Settings settings;
+        settings.m_maxSourceFileSize = 0;
+        settings.m_maxJobsPerBatch = 8;
+        settings.m_collectTimeMS = 5;
+
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+        {
+            const auto builderTransportKey = AZ::SettingsRegistryInterface::FixedValueString(AssetProcessorSettingsKey) + "/BuilderTransport";
+            settingsRegistry->Get(settings.m_maxSourceFileSize, builderTransportKey + "/batchJobsSmallerThan");
+
+            AZ::u64 maxJobsPerBatch = settings.m_maxJobsPerBatch;
+            settingsRegistry->Get(maxJobsPerBatch, builderTransportKey + "/maxJobsPerBatch");
+            settings.m_maxJobsPerBatch = aznumeric_cast<AZ::u32>(AZStd::max<AZ::u64>(maxJobsPerBatch, 1));
+
+            AZ::u64 collectTimeMS = settings.m_collectTimeMS;
+            settingsRegistry->Get(collectTimeMS, builderTransportKey + "/batchCollectTimeMS");
+            settings.m_collectTimeMS = aznumeric_cast<AZ::u32>(collectTimeMS);
+        }
+
+        return settings;
+    }
+
+    bool ProcessJobBatcher::IsBatched(const AssetBuilderSDK::ProcessJobRequest& request) const
+    {
+        if (m_settings.m_maxSourceFileSize == 0 || m_settings.m_maxJobsPerBatch <= 1)
+        {
+            return false;
+        }
+
+        const QFileInfo sourceFileInfo(QString::fromUtf8(request.m_fullPath.c_str()));
+        return sourceFileInfo.exists() && aznumeric_cast<AZ::u64>(sourceFileInfo.size()) < m_settings.m_maxSourceFileSize;
+    }
+
+    BuilderRunJobOutcome ProcessJobBatcher::RunOnItsOwn(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response, AssetBuilderSDK::JobCancelListener* jobCancelListener)
+    {
+        AZStd::vector<AssetBuilderSDK::ProcessJobRequest> requests{ request };
+        AZStd::vector<AssetBuilderSDK::ProcessJobResponse> responses;
+        const BuilderRunJobOutcome outcome = m_runBatch(requests, responses, jobCancelListener);
+        if (outcome == BuilderRunJobOutcome::Ok && !responses.empty())
+        {
+            response = AZStd::move(responses.front());
+        }
+        return outcome;
+    }
+
+    BuilderRunJobOutcome ProcessJobBatcher::ProcessJob(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response, AssetBuilderSDK::JobCancelListener* jobCancelListener)
+    {
+        if (!IsBatched(request))
+        {
+            return RunOnItsOwn(request, response, jobCancelListener);
+        }
+
+        PendingJob job;
+        job.m_request = &request;
+        job.m_response = &response;
+
+        AZStd::unique_lock<AZStd::mutex> lock(m_mutex);
+        if (m_collectingBatch)
+        {
+            // join the batch another job is collecting and wait for that job to run it
+            m_collectingBatch->push_back(&job);
+            if (m_collectingBatch->size() >= m_settings.m_maxJobsPerBatch)
+            {
+                m_collectingBatch.reset();
+                m_batchChanged.notify_all();
+            }
+            m_batchChanged.wait(lock, [&job]() { return job.m_done; });
+        }
+        else
+        {
+            // collect the jobs which come in during the collect time, then run them on this thread
+            auto batch = AZStd::make_shared<Batch>();
+            batch->push_back(&job);
+            m_collectingBatch = batch;
+            m_batchChanged.wait_for(lock, AZStd::chrono::milliseconds(m_settings.m_collectTimeMS),
+                [this, &batch]() { return m_collectingBatch != batch; });
+            if (m_collectingBatch == batch)
+            {
+                m_collectingBatch.reset();
+            }
+            lock.unlock();
+
+            if (batch->size() == 1)
+            {
+                return RunOnItsOwn(request, response, jobCancelListener);
+            }
+
+            RunBatch(*batch, jobCancelListener);
+            lock.lock();
+        }
+
+        const BuilderRunJobOutcome outcome = job.m_outcome;
+        lock.unlock();
+
+        if (outcome != BuilderRunJobOutcome::Ok && !(jobCancelListener && jobCancelListener->IsCancelled()))
+        {
+            return RunOnItsOwn(request, response, jobCancelListener);
+        }
+        return outcome;
+    }
+
+    void ProcessJobBatcher::RunBatch(const Batch& batch, AssetBuilderSDK::JobCancelListener* jobCancelListener)
+    {
+        AZStd::vector<AssetBuilderSDK::ProcessJobRequest> requests;
+        requests.reserve(batch.size());
+        for (const PendingJob* job : batch)
+        {
+            requests.push_back(*job->m_request);
+        }
+
+        AZStd::vector<AssetBuilderSDK::ProcessJobResponse> responses;
+        BuilderRunJobOutcome outcome = m_runBatch(requests, responses, jobCancelListener);
+        if (outcome == BuilderRunJobOutcome::Ok && responses.size() != batch.size())
+        {
+            outcome = BuilderRunJobOutcome::ResponseFailure;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        for (size_t jobIndex = 0; jobIndex < batch.size(); ++jobIndex)
+        {
+            PendingJob* job = batch[jobIndex];
+            job->m_outcome = outcome;
+            if (outcome == BuilderRunJobOutcome::Ok)
+            {
+                *job->m_response = AZStd::move(responses[jobIndex]);
+            }
+            job->m_done = true;
+        }
+        m_batchChanged.notify_all();
+    }
+
+    //////////////////////////////////////////////////////////////////////////
+
     BuilderManager::BuilderManager(ConnectionManager* connectionManager)
     {
         using namespace AZStd::placeholders;
         connectionManager->RegisterService(AssetBuilderSDK::BuilderHelloRequest::MessageType(), AZStd::bind(&BuilderManager::IncomingBuilderPing, this, _1, _2, _3, _4, _5));
 
+        if (auto settingsRegistry = AZ::SettingsRegistry::Get(); settingsRegistry && AssetBuilderSDK::SharedMemoryJobChannel::IsSupported())
+        {
+            const auto builderTransportKey = AZ::SettingsRegistryInterface::FixedValueString(AssetProcessorSettingsKey) + "/BuilderTransport";
+            // shared memory is the default wherever the platform supports it
+#if AZ_TRAIT_SUPPORT_IPC
+            bool useSharedMemory = true;
+#else
+            bool useSharedMemory = false;
+#endif
+            settingsRegistry->Get(useSharedMemory, builderTransportKey + "/useSharedMemory");
+            AZ::u64 bufferSize = AssetBuilderSDK::SharedMemoryJobChannel::DefaultBufferSize;
+            settingsRegistry->Get(bufferSize, builderTransportKey + "/sharedMemoryBufferSize");
+            m_jobChannelBufferSize = useSharedMemory ? aznumeric_cast<AZ::u32>(bufferSize) : 0;
+        }
+
         // Setup a background thread to pump the idle builders so they don't get blocked trying to output to stdout/err
         m_pollingThread = AZStd::thread([this]()
                 {
@@ -483,7 +694,7 @@ namespace AssetProcessor
             return {};
         }
 
-        auto builder = AZStd::make_shared<Builder>(m_quitListener, builderUuid);
+        auto builder = AZStd::make_shared<Builder>(m_quitListener, builderUuid, m_jobChannelBufferSize);
 
         m_builders.insert({ builder->GetUuid(), builder });
 
@@ -9,8 +9,14 @@
 
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/parallel/binary_semaphore.h>
+#include <AzCore/std/parallel/condition_variable.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/parallel/semaphore.h>
+#include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/functional.h>
 #include <AzFramework/Process/ProcessWatcher.h>
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
+#include <AssetBuilderSDK/SharedMemoryJobChannel.h>
 #include <AzCore/std/smart_ptr/shared_ptr.h>
 #include <QString>
 #include <QByteArray>
@@ -27,6 +33,9 @@ namespace AssetProcessor
     //! Indicates if job request files should be created on success.  Can be useful for debugging
     static const bool s_createRequestFileForSuccessfulJob = false;
 
+    //! Time in milliseconds to wait for a job response between two pumps of the builder stdout/err
+    static const AZ::u32 s_jobResponsePollTimeMS = 10;
+
     //! This EBUS is used to request a free builder from the builder manager pool
     class BuilderManagerBusTraits
         : public AZ::EBusTraits
@@ -62,8 +71,10 @@ namespace AssetProcessor
         friend struct BuilderRef;
 
     public:
-        Builder(const AssetUtilities::QuitListener& quitListener, AZ::Uuid uuid)
+        //! jobChannelBufferSize is the size of the shared memory job channel created for the builder process, 0 to always use the socket
+        Builder(const AssetUtilities::QuitListener& quitListener, AZ::Uuid uuid, AZ::u32 jobChannelBufferSize = 0)
             : m_uuid(uuid),
+            m_jobChannelBufferSize(jobChannelBufferSize),
             m_quitListener(quitListener)
         {}
         ~Builder() = default;
@@ -80,6 +91,9 @@ namespace AssetProcessor
         //! Returns true if the builder exe has established a connection
         bool IsConnected() const;
 
+        //! Returns true if job requests go through the shared memory job channel instead of the socket
+        bool IsUsingJobChannel() const;
+
         //! Blocks waiting for the builder to establish a connection
         bool WaitForConnection();
 
@@ -95,7 +109,22 @@ namespace AssetProcessor
         template<typename TNetRequest, typename TNetResponse, typename TRequest, typename TResponse>
         BuilderRunJobOutcome RunJob(const TRequest& request, TResponse& response, AZ::u32 processTimeoutLimitInSeconds, const AZStd::string& task, const AZStd::string& modulePath, AssetBuilderSDK::JobCancelListener* jobCancelListener = nullptr, AZStd::string tempFolderPath = AZStd::string()) const;
 
+        //! Sends all the jobs over to the builder before waiting for any response, so a batch of small jobs costs a single round-trip.
+        //! The builder runs them in order. processTimeoutLimitInSeconds applies to each job and the first failure fails the whole batch.
+        //! tempFolderPaths has the folder each failed request is written to, a temporary folder is created when it is empty.
+        template<typename TNetRequest, typename TNetResponse, typename TRequest, typename TResponse>
+        BuilderRunJobOutcome RunJobBatch(const AZStd::vector<TRequest>& requests, AZStd::vector<TResponse>& responses, AZ::u32 processTimeoutLimitInSeconds, const AZStd::string& task, const AZStd::string& modulePath, AssetBuilderSDK::JobCancelListener* jobCancelListener = nullptr, const AZStd::vector<AZStd::string>& tempFolderPaths = {}) const;
+
     private:
+        //! Shared implementation of RunJob and RunJobBatch, tempFolderPaths is either nullptr or has one entry per job
+        template<typename TNetRequest, typename TNetResponse, typename TRequest, typename TResponse>
+        BuilderRunJobOutcome RunJobs(const TRequest* requests, TResponse* responses, size_t jobCount, AZ::u32 processTimeoutLimitInSeconds, const AZStd::string& task, const AZStd::string& modulePath, AssetBuilderSDK::JobCancelListener* jobCancelListener, const AZStd::string* tempFolderPaths) const;
+
+        //! Creates the shared memory job channel, returns the extra builder parameter to open it or an empty string to use the socket
+        AZStd::string CreateJobChannel();
+
+        //! Keeps the job channel if the builder confirmed it opened it, otherwise falls back to the socket
+        void ConfirmJobChannel();
 
         //! Starts the builder process and waits for it to connect
         bool Start();
@@ -107,7 +136,8 @@ namespace AssetProcessor
         AZStd::unique_ptr<AzFramework::ProcessWatcher> LaunchProcess(const char* fullExePath, const AZStd::string& params) const;
 
         //! Waits for the builder exe to send the job response and pumps stdout/err
-        BuilderRunJobOutcome WaitForBuilderResponse(AssetBuilderSDK::JobCancelListener* jobCancelListener, AZ::u32 processTimeoutLimitInSeconds, AZStd::binary_semaphore* waitEvent) const;
+        //! waitForResponse returns true once the response arrived, it is expected to block for a short time when it hasn't
+        BuilderRunJobOutcome WaitForBuilderResponse(AssetBuilderSDK::JobCancelListener* jobCancelListener, AZ::u32 processTimeoutLimitInSeconds, const AZStd::function<bool()>& waitForResponse) const;
 
         //! Writes the request out to disk for debug purposes and logs info on how to manually run the asset builder
         template<typename TRequest>
@@ -129,6 +159,14 @@ namespace AssetProcessor
         //! Optional communicator, only available if we have a process watcher
         AZStd::unique_ptr<CommunicatorTracePrinter> m_tracePrinter = nullptr;
 
+        const AZ::u32 m_jobChannelBufferSize = 0;
+
+        //! Optional shared memory transport for job requests, the socket is used when it isn't available
+        AZStd::unique_ptr<AssetBuilderSDK::SharedMemoryJobChannel> m_jobChannel = nullptr;
+
+        //! Serial numbers of the requests sent through the job channel
+        mutable AZStd::atomic<AZ::u32> m_jobChannelSerial = 0;
+
         const AssetUtilities::QuitListener& m_quitListener;
     };
 
@@ -155,6 +193,66 @@ namespace AssetProcessor
         AZStd::shared_ptr<Builder> m_builder = nullptr;
     };
 
+    //! Groups the process jobs of one builder which are run at the same time, and sends each group to a single builder process, so
+    //! a group of small jobs costs one round-trip. Only jobs with a source file smaller than Settings::m_maxSourceFileSize are
+    //! grouped, other jobs run on their own right away.
+    class ProcessJobBatcher
+    {
+    public:
+        struct Settings
+        {
+            //! Jobs with a source file of this size or larger run on their own, 0 disables batching
+            AZ::u64 m_maxSourceFileSize = 0;
+            AZ::u32 m_maxJobsPerBatch = 1;
+            //! Time the first job of a batch waits for other jobs to join it
+            AZ::u32 m_collectTimeMS = 0;
+        };
+
+        //! Runs the jobs on one builder and fills in one response per request
+        using RunBatchFunction = AZStd::function<BuilderRunJobOutcome(const AZStd::vector<AssetBuilderSDK::ProcessJobRequest>& requests,
+            AZStd::vector<AssetBuilderSDK::ProcessJobResponse>& responses, AssetBuilderSDK::JobCancelListener* jobCancelListener)>;
+
+        ProcessJobBatcher(const Settings& settings, RunBatchFunction runBatch);
+
+        AZ_DISABLE_COPY_MOVE(ProcessJobBatcher);
+
+        //! Reads the settings from the BuilderTransport section of the Asset Processor settings
+        static Settings LoadSettings();
+
+        //! Blocks until the job ran, on its own or in a batch. A batch runs on the thread of its first job, with the cancel listener
+        //! and the job log of that job. When a batch fails, every job of it that wasn't cancelled runs again on its own.
+        BuilderRunJobOutcome ProcessJob(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response, AssetBuilderSDK::JobCancelListener* jobCancelListener);
+
+    private:
+        struct PendingJob
+        {
+            const AssetBuilderSDK::ProcessJobRequest* m_request = nullptr;
+            AssetBuilderSDK::ProcessJobResponse* m_response = nullptr;
+            BuilderRunJobOutcome m_outcome = BuilderRunJobOutcome::Ok;
+            bool m_done = false;
+        };
+
+        using Batch = AZStd::vector<PendingJob*>;
+
+        bool IsBatched(const AssetBuilderSDK::ProcessJobRequest& request) const;
+
+        BuilderRunJobOutcome RunOnItsOwn(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response, AssetBuilderSDK::JobCancelListener* jobCancelListener);
+
+        //! Runs the jobs of the batch and wakes up the threads waiting for them
+        void RunBatch(const Batch& batch, AssetBuilderSDK::JobCancelListener* jobCancelListener);
+
+        const Settings m_settings;
+        const RunBatchFunction m_runBatch;
+
+        AZStd::mutex m_mutex;
+
+        //! Signaled when the collecting batch is full and when the jobs of a batch are done
+        AZStd::condition_variable m_batchChanged;
+
+        //! The batch jobs join until it is full or its collect time is over. Must be locked before accessing
+        AZStd::shared_ptr<Batch> m_collectingBatch;
+    };
+
     //! Manages the builder pool
     class BuilderManager
         : public BuilderManagerBus::Handler
@@ -189,6 +287,9 @@ namespace AssetProcessor
         //! Indicates if we allow builders to connect that we haven't started up ourselves.  Useful for debugging
         bool m_allowUnmanagedBuilderConnections = false;
 
+        //! Size of the shared memory job channel of new builders, 0 when the socket is used for job requests
+        AZ::u32 m_jobChannelBufferSize = 0;
+
         //! Responsible for going through all the idle builders and pumping their communicators so they don't stall
         AZStd::thread m_pollingThread;
 
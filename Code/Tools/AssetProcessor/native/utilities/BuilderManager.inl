@@ -13,49 +13,149 @@ namespace AssetProcessor
     template<typename TNetRequest, typename TNetResponse, typename TRequest, typename TResponse>
     BuilderRunJobOutcome Builder::RunJob(const TRequest& request, TResponse& response, AZ::u32 processTimeoutLimitInSeconds, const AZStd::string& task, const AZStd::string& modulePath, AssetBuilderSDK::JobCancelListener* jobCancelListener /*= nullptr*/, AZStd::string tempFolderPath /*= AZStd::string()*/) const
     {
-        TNetRequest netRequest;
-        TNetResponse netResponse;
-        netRequest.m_request = request;
+        return RunJobs<TNetRequest, TNetResponse>(&request, &response, 1, processTimeoutLimitInSeconds, task, modulePath, jobCancelListener, &tempFolderPath);
+    }
 
-        AZ::u32 type;
-        QByteArray data;
-        AZStd::binary_semaphore wait;
+    template<typename TNetRequest, typename TNetResponse, typename TRequest, typename TResponse>
+    BuilderRunJobOutcome Builder::RunJobBatch(const AZStd::vector<TRequest>& requests, AZStd::vector<TResponse>& responses, AZ::u32 processTimeoutLimitInSeconds, const AZStd::string& task, const AZStd::string& modulePath, AssetBuilderSDK::JobCancelListener* jobCancelListener /*= nullptr*/, const AZStd::vector<AZStd::string>& tempFolderPaths /*= {}*/) const
+    {
+        responses.clear();
+        responses.resize(requests.size());
 
-        unsigned int serial;
-        AssetProcessor::ConnectionBus::EventResult(serial, m_connectionId, &AssetProcessor::ConnectionBusTraits::SendRequest, netRequest, [&](AZ::u32 msgType, QByteArray msgData)
+        if (requests.empty())
         {
-            type = msgType;
-            data = msgData;
-            wait.release();
-        });
+            return BuilderRunJobOutcome::Ok;
+        }
+
+        const AZStd::string* jobTempFolderPaths = tempFolderPaths.size() == requests.size() ? tempFolderPaths.data() : nullptr;
+        return RunJobs<TNetRequest, TNetResponse>(requests.data(), responses.data(), requests.size(), processTimeoutLimitInSeconds, task, modulePath, jobCancelListener, jobTempFolderPaths);
+    }
 
-        BuilderRunJobOutcome result = WaitForBuilderResponse(jobCancelListener, processTimeoutLimitInSeconds, &wait);
+    template<typename TNetRequest, typename TNetResponse, typename TRequest, typename TResponse>
+    BuilderRunJobOutcome Builder::RunJobs(const TRequest* requests, TResponse* responses, size_t jobCount, AZ::u32 processTimeoutLimitInSeconds, const AZStd::string& task, const AZStd::string& modulePath, AssetBuilderSDK::JobCancelListener* jobCancelListener, const AZStd::string* tempFolderPaths) const
+    {
+        // all the requests are sent before waiting for the first response, the builder queues them up and answers in order
+        AZStd::vector<AZ::u32> responseTypes(jobCount, 0);
+        AZStd::vector<QByteArray> socketResponses;
+        AZStd::vector<AZStd::vector<char>> channelResponses;
+        BuilderRunJobOutcome result = BuilderRunJobOutcome::Ok;
 
-        if (result != BuilderRunJobOutcome::Ok)
+        const bool useJobChannel = IsUsingJobChannel();
+        if (useJobChannel)
         {
-            // Clear out the response handler so it doesn't get triggered after the variables go out of scope (also to clean up the memory)
-            AssetProcessor::ConnectionBus::Event(m_connectionId, &AssetProcessor::ConnectionBusTraits::RemoveResponseHandler, serial);
-            return result;
-        }
+            channelResponses.resize(jobCount);
+            const AZ::u32 firstSerial = m_jobChannelSerial.fetch_add(aznumeric_cast<AZ::u32>(jobCount));
 
-        AZ_Assert(type == netRequest.GetMessageType(), "Response type does not match");
+            for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+            {
+                TNetRequest netRequest;
+                netRequest.m_request = requests[jobIndex];
 
-        if (!AZ::Utils::LoadObjectFromBufferInPlace(data.data(), data.length(), netResponse))
+                if (!m_jobChannel->SendNetMessage(netRequest, firstSerial + aznumeric_cast<AZ::u32>(jobIndex), processTimeoutLimitInSeconds * 1000))
+                {
+                    AZ_Error("Builder", false, "Failed to send the job request through the shared memory job channel");
+                    TerminateProcess(AZ::u32(-1)); // The builder may be left with a partial request, it can't go back in the pool.
+                    return BuilderRunJobOutcome::LostConnection;
+                }
+            }
+
+            AssetBuilderSDK::SharedMemoryJobChannel::Message message;
+            for (size_t jobIndex = 0; jobIndex < jobCount && result == BuilderRunJobOutcome::Ok; ++jobIndex)
+            {
+                const AZ::u32 serial = firstSerial + aznumeric_cast<AZ::u32>(jobIndex);
+
+                result = WaitForBuilderResponse(jobCancelListener, processTimeoutLimitInSeconds, [&]()
+                {
+                    if (!m_jobChannel->IsOpen())
+                    {
+                        // the builder is gone, wait for its process to be detected as terminated.
+                        AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(s_jobResponsePollTimeMS));
+                        return false;
+                    }
+
+                    while (m_jobChannel->Receive(message, s_jobResponsePollTimeMS))
+                    {
+                        if (message.m_serial == serial)
+                        {
+                            responseTypes[jobIndex] = message.m_type;
+                            channelResponses[jobIndex].swap(message.m_payload);
+                            return true;
+                        }
+                        AZ_Warning("Builder", false, "Discarding unexpected response %u received through the shared memory job channel", message.m_serial);
+                    }
+                    return false;
+                });
+            }
+
+            if (result != BuilderRunJobOutcome::Ok)
+            {
+                return result;
+            }
+        }
+        else
         {
-            AZ_Error("Builder", false, "Failed to deserialize processJobs response");
-            return BuilderRunJobOutcome::FailedToDecodeResponse;
+            socketResponses.resize(jobCount);
+            AZStd::vector<unsigned int> serials(jobCount, 0);
+            AZStd::semaphore responseEvent;
+
+            for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+            {
+                TNetRequest netRequest;
+                netRequest.m_request = requests[jobIndex];
+
+                AssetProcessor::ConnectionBus::EventResult(serials[jobIndex], m_connectionId, &AssetProcessor::ConnectionBusTraits::SendRequest, netRequest, [&responseTypes, &socketResponses, &responseEvent, jobIndex](AZ::u32 msgType, QByteArray msgData)
+                {
+                    responseTypes[jobIndex] = msgType;
+                    socketResponses[jobIndex] = msgData;
+                    responseEvent.release();
+                });
+            }
+
+            for (size_t jobIndex = 0; jobIndex < jobCount && result == BuilderRunJobOutcome::Ok; ++jobIndex)
+            {
+                result = WaitForBuilderResponse(jobCancelListener, processTimeoutLimitInSeconds, [&responseEvent]()
+                {
+                    return responseEvent.try_acquire_for(AZStd::chrono::milliseconds(s_jobResponsePollTimeMS));
+                });
+            }
+
+            if (result != BuilderRunJobOutcome::Ok)
+            {
+                // Clear out the response handlers so they don't get triggered after the variables go out of scope (also to clean up the memory)
+                for (unsigned int serial : serials)
+                {
+                    AssetProcessor::ConnectionBus::Event(m_connectionId, &AssetProcessor::ConnectionBusTraits::RemoveResponseHandler, serial);
+                }
+                return result;
+            }
         }
 
-        if (!netResponse.m_response.Succeeded() || s_createRequestFileForSuccessfulJob)
+        for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
         {
-            // we write the request out to disk for failure or debugging 
-            if (!DebugWriteRequestFile(tempFolderPath.c_str(), request, task, modulePath))
+            AZ_Assert(responseTypes[jobIndex] == TNetRequest::MessageType(), "Response type does not match");
+
+            TNetResponse netResponse;
+            const bool decoded = useJobChannel
+                ? AZ::Utils::LoadObjectFromBufferInPlace(channelResponses[jobIndex].data(), channelResponses[jobIndex].size(), netResponse)
+                : AZ::Utils::LoadObjectFromBufferInPlace(socketResponses[jobIndex].data(), socketResponses[jobIndex].length(), netResponse);
+
+            if (!decoded)
             {
-                return BuilderRunJobOutcome::FailedToWriteDebugRequest;
+                AZ_Error("Builder", false, "Failed to deserialize processJobs response");
+                return BuilderRunJobOutcome::FailedToDecodeResponse;
             }
-        }
 
-        response = AZStd::move(netResponse.m_response);
+            if (!netResponse.m_response.Succeeded() || s_createRequestFileForSuccessfulJob)
+            {
+                // we write the request out to disk for failure or debugging 
+                if (!DebugWriteRequestFile(tempFolderPaths ? tempFolderPaths[jobIndex].c_str() : "", requests[jobIndex], task, modulePath))
+                {
+                    return BuilderRunJobOutcome::FailedToWriteDebugRequest;
+                }
+            }
+
+            responses[jobIndex] = AZStd::move(netResponse.m_response);
+        }
 
         return result;
     }
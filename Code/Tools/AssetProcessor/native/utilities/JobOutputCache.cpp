@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <native/utilities/JobOutputCache.h>
+#include <native/assetprocessor.h>
+
+#include <QDir>
+#include <QDirIterator>
+#include <QFile>
+#include <QFileInfo>
+#include <QUuid>
+
+#if defined(AZ_PLATFORM_WINDOWS)
+#   include <windows.h>
+#else
+#   include <unistd.h>
+#endif
+
+namespace AssetProcessor
+{
+    namespace
+    {
+        bool CreateHardLink(const QString& existingFile, const QString& newFile)
+        {
+#if defined(AZ_PLATFORM_WINDOWS)
+            const QString nativeExistingFile = QDir::toNativeSeparators(existingFile);
+            const QString nativeNewFile = QDir::toNativeSeparators(newFile);
+            return ::CreateHardLinkW(reinterpret_cast<LPCWSTR>(nativeNewFile.utf16()), reinterpret_cast<LPCWSTR>(nativeExistingFile.utf16()), nullptr) != FALSE;
+#else
+            return ::link(existingFile.toUtf8().constData(), newFile.toUtf8().constData()) == 0;
+#endif
+        }
+
+        bool CopyFileCreatingPath(const QString& sourceFile, const QString& targetFile)
+        {
+            if (!QDir().mkpath(QFileInfo(targetFile).absolutePath()))
+            {
+                return false;
+            }
+            return QFile::copy(sourceFile, targetFile);
+        }
+    }
+
+    JobOutputCache::JobOutputCache(const QString& cacheFolder, bool useHardLinks)
+        : m_cacheFolder(QDir::cleanPath(cacheFolder))
+        , m_useHardLinks(useHardLinks)
+    {
+        AZ::Interface<IJobOutputCacheRequests>::Register(this);
+    }
+
+    JobOutputCache::~JobOutputCache()
+    {
+        AZ::Interface<IJobOutputCacheRequests>::Unregister(this);
+
+        const Statistics statistics = GetStatistics();
+        AZ_TracePrintf(AssetProcessor::DebugChannel, "Job output cache: %llu hits, %llu misses, %llu stores, %llu failed stores.\n",
+            static_cast<unsigned long long>(statistics.m_hits), static_cast<unsigned long long>(statistics.m_misses),
+            static_cast<unsigned long long>(statistics.m_stores), static_cast<unsigned long long>(statistics.m_storeFailures));
+    }
+
+    QString JobOutputCache::GetEntryFolder(const QString& key) const
+    {
+        return QDir(m_cacheFolder).filePath(QString("%1/%2").arg(key.left(2), key));
+    }
+
+    JobOutputCache::Statistics JobOutputCache::GetStatistics() const
+    {
+        Statistics statistics;
+        statistics.m_hits = m_hits;
+        statistics.m_misses = m_misses;
+        statistics.m_stores = m_stores;
+        statistics.m_storeFailures = m_storeFailures;
+        return statistics;
+    }
+
+    bool JobOutputCache::PlaceFile(const QString& entryFile, const QString& targetFile) const
+    {
+        if (m_useHardLinks && QDir().mkpath(QFileInfo(targetFile).absolutePath()) && CreateHardLink(entryFile, targetFile))
+        {
+            return true;
+        }
+        // hard links can't cross volumes and aren't supported by every file system, copy instead.
+        return CopyFileCreatingPath(entryFile, targetFile);
+    }
+
+    bool JobOutputCache::RetrieveJobResult(const QString& key, const QString& tempFolder)
+    {
+        if (key.isEmpty())
+        {
+            return false;
+        }
+
+        const QString entryFolder = GetEntryFolder(key);
+        if (!QFileInfo(entryFolder).isDir())
+        {
+            ++m_misses;
+            return false;
+        }
+
+        QDir entryDir(entryFolder);
+        QDir tempDir(tempFolder);
+        QStringList placedFiles;
+        QDirIterator entryIterator(entryFolder, QDir::Files | QDir::Hidden | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+        while (entryIterator.hasNext())
+        {
+            const QString entryFile = entryIterator.next();
+            const QString targetFile = tempDir.absoluteFilePath(entryDir.relativeFilePath(entryFile));
+            if (!PlaceFile(entryFile, targetFile))
+            {
+                AZ_Warning(AssetProcessor::DebugChannel, false, "Job output cache: failed to retrieve %s into %s.\n", entryFile.toUtf8().constData(), targetFile.toUtf8().constData());
+                // leave the temp folder as it was so the job can run normally.
+                for (const QString& placedFile : placedFiles)
+                {
+                    QFile::remove(placedFile);
+                }
+                ++m_misses;
+                return false;
+            }
+            placedFiles.append(targetFile);
+        }
+
+        ++m_hits;
+        AZ_TracePrintf(AssetProcessor::DebugChannel, "Job output cache: retrieved %d files for key %s.\n", placedFiles.size(), key.toUtf8().constData());
+        return true;
+    }
+
+    bool JobOutputCache::StoreJobResult(const QString& key, const QString& tempFolder, const QString& sourceFolder, const AZStd::vector<AZStd::string>& sourceFileList)
+    {
+        if (key.isEmpty())
+        {
+            return false;
+        }
+
+        const QString entryFolder = GetEntryFolder(key);
+        if (QFileInfo(entryFolder).isDir())
+        {
+            // another job with identical inputs stored it already.
+            return true;
+        }
+
+        // the files are written to a folder unique to this store and renamed into place once complete.
+        const QString stagingFolder = QString("%1.%2").arg(entryFolder, QUuid::createUuid().toString(QUuid::WithoutBraces));
+        QDir stagingDir(stagingFolder);
+        QDir tempDir(tempFolder);
+        QDir sourceDir(sourceFolder);
+
+        bool success = QDir().mkpath(stagingFolder);
+        QDirIterator tempIterator(tempFolder, QDir::Files | QDir::Hidden | QDir::NoDotAndDotDot, QDirIterator::Subdirectories);
+        while (success && tempIterator.hasNext())
+        {
+            const QString tempFile = tempIterator.next();
+            success = CopyFileCreatingPath(tempFile, stagingDir.absoluteFilePath(tempDir.relativeFilePath(tempFile)));
+        }
+
+        for (auto sourceFileIter = sourceFileList.begin(); success && sourceFileIter != sourceFileList.end(); ++sourceFileIter)
+        {
+            QString relativeSourceFile = QDir::fromNativeSeparators(QString::fromUtf8(sourceFileIter->c_str()));
+            while (relativeSourceFile.startsWith('/'))
+            {
+                relativeSourceFile.remove(0, 1);
+            }
+            success = CopyFileCreatingPath(sourceDir.absoluteFilePath(relativeSourceFile), stagingDir.absoluteFilePath(relativeSourceFile));
+        }
+
+        // losing a rename race to another Asset Processor storing the same entry is fine, its content is identical.
+        success = success && (QDir().rename(stagingFolder, entryFolder) || QFileInfo(entryFolder).isDir());
+
+        if (stagingDir.exists())
+        {
+            stagingDir.removeRecursively();
+        }
+
+        if (!success)
+        {
+            AZ_Warning(AssetProcessor::DebugChannel, false, "Job output cache: failed to store the outputs of %s under key %s.\n", tempFolder.toUtf8().constData(), key.toUtf8().constData());
+            ++m_storeFailures;
+            return false;
+        }
+
+        ++m_stores;
+        return true;
+    }
+} // namespace AssetProcessor
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Interface/Interface.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/string/string.h>
+#include <QString>
+
+namespace AssetProcessor
+{
+    //! Interface to the local, content addressed cache of job outputs.
+    //! Jobs are looked up by the key computed by AssetUtilities::ComputeJobOutputCacheKey before being sent to a builder,
+    //! and the content of their temp folder is stored under that key once they succeed.
+    struct IJobOutputCacheRequests
+    {
+        AZ_RTTI(IJobOutputCacheRequests, "{6F0E2B0C-5D8A-4E0B-9C57-2A6B0D4C9E31}");
+
+        IJobOutputCacheRequests() = default;
+        virtual ~IJobOutputCacheRequests() = default;
+
+        //! Copies the files stored for the key into the temp folder of a job. Returns false on a miss,
+        //! in which case the temp folder is left as it was.
+        virtual bool RetrieveJobResult(const QString& key, const QString& tempFolder) = 0;
+        //! Stores every file of the temp folder of a successful job under the key, along with the files of sourceFileList,
+        //! which are relative to sourceFolder (copy jobs output files which never go through the temp folder).
+        virtual bool StoreJobResult(const QString& key, const QString& tempFolder, const QString& sourceFolder, const AZStd::vector<AZStd::string>& sourceFileList) = 0;
+
+        AZ_DISABLE_COPY_MOVE(IJobOutputCacheRequests);
+    };
+
+    //! Job output cache storing each entry uncompressed in its own folder, <cache folder>/<first 2 characters of the key>/<key>.
+    //! Entries are written to a temporary folder and renamed into place so they are never seen half written, which also makes
+    //! it safe for several Asset Processors to share the same cache folder.
+    class JobOutputCache
+        : public IJobOutputCacheRequests
+    {
+    public:
+        struct Statistics
+        {
+            AZ::u64 m_hits = 0;
+            AZ::u64 m_misses = 0;
+            AZ::u64 m_stores = 0;
+            AZ::u64 m_storeFailures = 0;
+        };
+
+        //! useHardLinks makes retrieved files hard links to the cache entry instead of copies when the file system allows it.
+        //! It saves time and disk space but relies on nothing modifying products in place afterwards, so it is off by default.
+        explicit JobOutputCache(const QString& cacheFolder, bool useHardLinks = false);
+        ~JobOutputCache() override;
+
+        //////////////////////////////////////////////////////////////////////////
+        // IJobOutputCacheRequests
+        bool RetrieveJobResult(const QString& key, const QString& tempFolder) override;
+        bool StoreJobResult(const QString& key, const QString& tempFolder, const QString& sourceFolder, const AZStd::vector<AZStd::string>& sourceFileList) override;
+        //////////////////////////////////////////////////////////////////////////
+
+        QString GetEntryFolder(const QString& key) const;
+        Statistics GetStatistics() const;
+
+    protected:
+        bool PlaceFile(const QString& entryFile, const QString& targetFile) const;
+
+        QString m_cacheFolder;
+        bool m_useHardLinks = false;
+
+        AZStd::atomic<AZ::u64> m_hits{ 0 };
+        AZStd::atomic<AZ::u64> m_misses{ 0 };
+        AZStd::atomic<AZ::u64> m_stores{ 0 };
+        AZStd::atomic<AZ::u64> m_storeFailures{ 0 };
+    };
+} // namespace AssetProcessor
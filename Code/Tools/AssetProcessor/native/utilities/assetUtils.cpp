@@ -9,6 +9,7 @@
 
 #include <AzCore/Component/ComponentApplication.h>
 #include <AzCore/Math/Sha1.h>
+#include <AzCore/std/sort.h>
 
 #include "native/utilities/PlatformConfiguration.h"
 #include "native/AssetManager/FileStateCache.h"
@@ -38,6 +39,7 @@
 #include <AzFramework/Platform/PlatformDefaults.h>
 #include <AzToolsFramework/UI/Logging/LogLine.h>
 #include <xxhash/xxhash.h>
+#include <AssetProcessor_Traits_Platform.h>
 
 #if defined(AZ_PLATFORM_WINDOWS)
 #   include <windows.h>
@@ -67,6 +69,50 @@ namespace AssetUtilsInternal
     // changing number
     static AZStd::atomic_int g_randomNumberSequentialSeed;
 
+    // Hashes a file by mapping it in memory, which saves copying it chunk by chunk through a buffer.
+    // Returns false if the file should be streamed instead: the platform doesn't map files, the file is small,
+    // the path is an alias that QFile can't resolve, or the file could not be mapped.
+    bool GetMappedFileHash(const char* filePath, AZ::u64& hashOut, AZ::IO::SizeType* bytesReadOut)
+    {
+        if constexpr (!ASSETPROCESSOR_TRAIT_MAP_FILES_FOR_HASHING)
+        {
+            return false;
+        }
+
+        if (filePath[0] == '@')
+        {
+            return false;
+        }
+
+        QFile file(QString::fromUtf8(filePath));
+        if (!file.open(QIODevice::ReadOnly))
+        {
+            return false;
+        }
+
+        const qint64 fileSize = file.size();
+        if (fileSize < aznumeric_cast<qint64>(AssetUtilities::FileHashMapMinimumSize))
+        {
+            return false;
+        }
+
+        uchar* fileData = file.map(0, fileSize);
+        if (!fileData)
+        {
+            return false;
+        }
+
+        // Same result as feeding the file to XXH64_update in chunks with a seed of 0
+        hashOut = XXH64(fileData, aznumeric_cast<size_t>(fileSize), 0);
+        file.unmap(fileData);
+
+        if (bytesReadOut)
+        {
+            *bytesReadOut += aznumeric_cast<AZ::IO::SizeType>(fileSize);
+        }
+        return true;
+    }
+
     bool FileCopyMoveWithTimeout(QString sourceFile, QString outputFile, bool isCopy, unsigned int waitTimeInSeconds)
     {
         bool failureOccurredOnce = false; // used for logging.
@@ -1137,6 +1183,85 @@ namespace AssetUtilities
         return digest[0]; // we only currently use 32-bit hashes.  This could be extended if collisions still occur.
     }
 
+    QString ComputeJobOutputCacheKey(const AssetProcessor::JobDetails& jobDetail, const AssetBuilderSDK::ProcessJobRequest& processJobRequest)
+    {
+        if (!ShouldUseFileHashing())
+        {
+            return QString();
+        }
+
+        // everything which can change the outputs of the job goes into the key, identity first and then content.
+        // fields are separated by colons, as in GenerateFingerprint.
+        AZStd::string keyString = AZStd::string::format("%s:%s:%s:%s:%s:%s:%s",
+            jobDetail.m_assetBuilderDesc.m_busId.ToString<AZStd::string>().c_str(),
+            jobDetail.m_assetBuilderDesc.m_analysisFingerprint.c_str(),
+            jobDetail.m_extraInformationForFingerprinting.c_str(),
+            processJobRequest.m_platformInfo.m_identifier.c_str(),
+            processJobRequest.m_jobDescription.m_jobKey.c_str(),
+            processJobRequest.m_sourceFile.c_str(),
+            processJobRequest.m_sourceFileUUID.ToString<AZStd::string>().c_str());
+
+        // the parameter map is unordered, sort it so the same parameters always produce the same key.
+        AZStd::vector<AZStd::pair<AZ::u32, AZStd::string>> jobParameters(
+            processJobRequest.m_jobDescription.m_jobParameters.begin(), processJobRequest.m_jobDescription.m_jobParameters.end());
+        AZStd::sort(jobParameters.begin(), jobParameters.end());
+        for (const auto& jobParameter : jobParameters)
+        {
+            keyString.append(AZStd::string::format(":%u=%s", jobParameter.first, jobParameter.second.c_str()));
+        }
+
+        auto* fileStateInterface = AZ::Interface<AssetProcessor::IFileStateRequests>::Get();
+        for (const auto& fingerprintFile : jobDetail.m_fingerprintFiles)
+        {
+            const QString absolutePath = QString::fromUtf8(fingerprintFile.first.c_str());
+            AssetProcessor::FileStateInfo fileStateInfo;
+            if (!fileStateInterface || !fileStateInterface->GetFileInfo(absolutePath, &fileStateInfo))
+            {
+                keyString.append(AZStd::string::format(":-:-:%s", fingerprintFile.second.c_str()));
+                continue;
+            }
+
+            // served from the file state cache, which hashes each file once and keeps the hash until the file changes.
+            AssetProcessor::IFileStateRequests::FileHash fileHash = 0;
+            if (!fileStateInterface->GetHash(absolutePath, &fileHash))
+            {
+                fileHash = GetFileHash(fingerprintFile.first.c_str(), true);
+            }
+            keyString.append(AZStd::string::format(":%llx:%llu:%s",
+                static_cast<unsigned long long>(fileHash),
+                static_cast<unsigned long long>(fileStateInfo.m_fileSize), fingerprintFile.second.c_str()));
+        }
+
+        for (const AssetProcessor::JobDependencyInternal& jobDependencyInternal : jobDetail.m_jobDependencyList)
+        {
+            if (jobDependencyInternal.m_jobDependency.m_type == AssetBuilderSDK::JobDependencyType::OrderOnce)
+            {
+                continue;
+            }
+            AssetProcessor::JobDesc jobDesc(jobDependencyInternal.m_jobDependency.m_sourceFile.m_sourceFileDependencyPath,
+                jobDependencyInternal.m_jobDependency.m_jobKey, jobDependencyInternal.m_jobDependency.m_platformIdentifier);
+
+            for (const AZ::Uuid& builderUuid : jobDependencyInternal.m_builderUuidList)
+            {
+                AZ::u32 dependentJobFingerprint = 0;
+                AssetProcessor::ProcessingJobInfoBus::BroadcastResult(dependentJobFingerprint, &AssetProcessor::ProcessingJobInfoBusTraits::GetJobFingerprint, AssetProcessor::JobIndentifier(jobDesc, builderUuid));
+                if (dependentJobFingerprint == 0)
+                {
+                    // the outputs of the other job aren't known, so neither are ours.
+                    return QString();
+                }
+                keyString.append(AZStd::string::format(":%u", dependentJobFingerprint));
+            }
+        }
+
+        AZ::Sha1 sha;
+        sha.ProcessBytes(keyString.data(), keyString.size());
+        AZ::u32 digest[5];
+        sha.GetDigest(digest);
+
+        return QString::asprintf("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+    }
+
     std::uint64_t AdjustTimestamp(QDateTime timestamp, int overridePrecision)
     {
         if (timestamp.isDaylightTime())
@@ -1181,6 +1306,13 @@ namespace AssetUtilities
             }
         }
 
+        // The artificial delay used by unit tests is applied per streamed chunk, so it always streams
+        AZ::u64 mappedHash = 0;
+        if (hashMsDelay <= 0 && AssetUtilsInternal::GetMappedFileHash(filePath, mappedHash, bytesReadOut))
+        {
+            return mappedHash;
+        }
+
         char buffer[FileHashBufferSize];
 
         constexpr bool ErrorOnReadFailure = true;
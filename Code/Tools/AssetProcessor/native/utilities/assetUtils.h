@@ -234,11 +234,19 @@ namespace AssetUtilities
     //! interrogate a given file, which is specified as a full path name, and generate a fingerprint for it.
     unsigned int GenerateFingerprint(const AssetProcessor::JobDetails& jobDetail);
 
+    //! Computes the key of a job in the local job output cache, a hex encoded SHA1 of the content of every fingerprinted file,
+    //! the builder, its version and analysis fingerprint, the job parameters and the fingerprints of the jobs it depends on.
+    //! Unlike GenerateFingerprint it never uses modification times, so it returns an empty string (meaning the job can't be
+    //! cached) when file hashing is disabled or when the fingerprint of a job it depends on isn't known yet.
+    QString ComputeJobOutputCacheKey(const AssetProcessor::JobDetails& jobDetail, const AssetBuilderSDK::ProcessJobRequest& processJobRequest);
+
     //! Returns a hash of the contents of the specified file
     // hashMsDelay is only for automated tests to test that writing to a file while it's hashing does not cause a crash.
     // hashMsDelay is not used in non-unit test builds.
     AZ::u64 GetFileHash(const char* filePath, bool force = false, AZ::IO::SizeType* bytesReadOut = nullptr, int hashMsDelay = 0);
     inline constexpr AZ::u64 FileHashBufferSize = 1024 * 64;
+    //! Files at least this large are memory mapped rather than streamed when hashed, on platforms where that is safe
+    inline constexpr AZ::u64 FileHashMapMinimumSize = 1024 * 1024;
 
     //! Adjusts a timestamp to fix timezone settings and account for any precision adjustment needed
     AZ::u64 AdjustTimestamp(QDateTime timestamp);
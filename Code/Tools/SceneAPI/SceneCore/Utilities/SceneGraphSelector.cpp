@@ -11,6 +11,7 @@
 #include <SceneAPI/SceneCore/Utilities/SceneGraphSelector.h>
 #include <AzCore/std/containers/set.h>
 #include <AzCore/Math/Transform.h>
+#include <AzCore/std/string/conversions.h>
 #include <SceneAPI/SceneCore/DataTypes/ManifestBase/ISceneNodeSelectionList.h>
 #include <SceneAPI/SceneCore/DataTypes/GraphData/IMeshData.h>
 
@@ -51,6 +52,31 @@ namespace AZ
                 return index;
             }
 
+            AZStd::string SceneGraphSelector::GetGeneratedLodMeshName(AZStd::string_view meshName, size_t lod)
+            {
+                return AZStd::string::format("%.*s%.*s%zu", AZ_STRING_ARG(meshName), AZ_STRING_ARG(GeneratedLodMeshSuffix), lod);
+            }
+
+            bool SceneGraphSelector::ParseGeneratedLodMeshName(AZStd::string_view name, AZStd::string_view& sourceMeshName, size_t& lod)
+            {
+                const size_t lodStart = name.find_last_not_of("0123456789") + 1;
+                if (lodStart == 0 || lodStart == name.size())
+                {
+                    return false;
+                }
+
+                AZStd::string_view prefix = name.substr(0, lodStart);
+                if (!prefix.ends_with(GeneratedLodMeshSuffix))
+                {
+                    return false;
+                }
+                prefix.remove_suffix(GeneratedLodMeshSuffix.size());
+
+                sourceMeshName = prefix;
+                lod = static_cast<size_t>(AZStd::stoull(AZStd::string(name.substr(lodStart))));
+                return true;
+            }
+
             AZStd::vector<AZStd::string> SceneGraphSelector::GenerateTargetNodes(const Containers::SceneGraph& graph, const DataTypes::ISceneNodeSelectionList& list, NodeFilterFunction nodeFilter, NodeRemapFunction nodeRemap)
             {
                 AZStd::vector<AZStd::string> targetNodes;
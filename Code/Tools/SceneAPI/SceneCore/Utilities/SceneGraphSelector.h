@@ -19,6 +19,8 @@ namespace AZ::SceneAPI::DataTypes { class ISceneNodeSelectionList; }
 namespace AZ::SceneAPI::Utilities
 {
     inline constexpr AZStd::string_view OptimizedMeshSuffix = "_optimized";
+    // Meshes with generated levels of detail get a sibling node for each level, named with this suffix followed by the level.
+    inline constexpr AZStd::string_view GeneratedLodMeshSuffix = "_generated_lod";
 
     // SceneGraphSelector provides utilities including converting selected and unselected node lists
     // in the MeshGroup into the final target node list.
@@ -46,6 +48,11 @@ namespace AZ::SceneAPI::Utilities
         }
         SCENE_CORE_API static Containers::SceneGraph::NodeIndex RemapToOptimizedMesh(const Containers::SceneGraph& graph, const Containers::SceneGraph::NodeIndex& index);
 
+        // Returns the name or path of the node that holds the generated level of detail of a mesh, where level 1 is the first one after the mesh itself.
+        SCENE_CORE_API static AZStd::string GetGeneratedLodMeshName(AZStd::string_view meshName, size_t lod);
+        // Returns true if the name or path is of a generated level of detail mesh node, along with the name or path of its source mesh and its level.
+        SCENE_CORE_API static bool ParseGeneratedLodMeshName(AZStd::string_view name, AZStd::string_view& sourceMeshName, size_t& lod);
+
     private:
         static void CopySelectionToSet(AZStd::set<AZStd::string>& selected, AZStd::set<AZStd::string>& unselected, const DataTypes::ISceneNodeSelectionList& list);
         static void CorrectRootNode(const Containers::SceneGraph& graph, AZStd::set<AZStd::string>& selected, AZStd::set<AZStd::string>& unselected);
@@ -20,6 +20,7 @@
 #include <SceneAPI/SceneData/Rules/BlendShapeRule.h>
 #include <SceneAPI/SceneData/Rules/CommentRule.h>
 #include <SceneAPI/SceneData/Rules/LodRule.h>
+#include <SceneAPI/SceneData/Rules/LodGenerationRule.h>
 #include <SceneAPI/SceneData/Rules/MaterialRule.h>
 #include <SceneAPI/SceneData/Rules/StaticMeshAdvancedRule.h>
 #include <SceneAPI/SceneData/Rules/SkeletonProxyRule.h>
@@ -67,6 +68,10 @@ namespace AZ
                     {
                         modifiers.push_back(SceneData::LodRule::TYPEINFO_Uuid());
                     }
+                    if (existingRules.find(SceneData::LodGenerationRule::TYPEINFO_Uuid()) == existingRules.end())
+                    {
+                        modifiers.push_back(SceneData::LodGenerationRule::TYPEINFO_Uuid());
+                    }
                     if (existingRules.find(SceneData::MaterialRule::TYPEINFO_Uuid()) == existingRules.end())
                     {
                         modifiers.push_back(SceneData::MaterialRule::TYPEINFO_Uuid());
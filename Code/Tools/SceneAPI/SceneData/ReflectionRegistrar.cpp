@@ -14,6 +14,7 @@
 #include <SceneAPI/SceneData/Rules/BlendShapeRule.h>
 #include <SceneAPI/SceneData/Rules/CommentRule.h>
 #include <SceneAPI/SceneData/Rules/LodRule.h>
+#include <SceneAPI/SceneData/Rules/LodGenerationRule.h>
 #include <SceneAPI/SceneData/Rules/StaticMeshAdvancedRule.h>
 #include <SceneAPI/SceneData/Rules/SkinMeshAdvancedRule.h>
 #include <SceneAPI/SceneData/Rules/MaterialRule.h>
@@ -65,6 +66,7 @@ namespace AZ
             SceneData::BlendShapeRule::Reflect(context);
             SceneData::CommentRule::Reflect(context);
             SceneData::LodRule::Reflect(context);
+            SceneData::LodGenerationRule::Reflect(context);
             SceneData::StaticMeshAdvancedRule::Reflect(context);
             SceneData::MaterialRule::Reflect(context);
             SceneData::ScriptProcessorRule::Reflect(context);
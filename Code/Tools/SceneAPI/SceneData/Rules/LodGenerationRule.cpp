@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/RTTI/ReflectContext.h>
+#include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Serialization/EditContext.h>
+#include <SceneAPI/SceneData/Rules/LodGenerationRule.h>
+
+namespace AZ
+{
+    namespace SceneAPI
+    {
+        namespace SceneData
+        {
+            LodGenerationRule::LodGenerationRule()
+                : DataTypes::IRule()
+            {
+                // Each level halves the triangle count of the previous one and allows twice the error
+                m_lods.push_back({ 0.5f, 0.01f });
+                m_lods.push_back({ 0.25f, 0.02f });
+                m_lods.push_back({ 0.125f, 0.04f });
+            }
+
+            size_t LodGenerationRule::GetLodCount() const
+            {
+                return m_lods.size();
+            }
+
+            const LodGenerationLevel& LodGenerationRule::GetLod(size_t index) const
+            {
+                return m_lods[index];
+            }
+
+            void LodGenerationRule::Reflect(ReflectContext* context)
+            {
+                SerializeContext* serializeContext = azrtti_cast<SerializeContext*>(context);
+                if (!serializeContext)
+                {
+                    return;
+                }
+
+                serializeContext->Class<LodGenerationLevel>()->Version(1)
+                    ->Field("triangleRatio", &LodGenerationLevel::m_triangleRatio)
+                    ->Field("maxError", &LodGenerationLevel::m_maxError);
+
+                serializeContext->Class<LodGenerationRule, DataTypes::IRule>()->Version(1)
+                    ->Field("lods", &LodGenerationRule::m_lods);
+
+                EditContext* editContext = serializeContext->GetEditContext();
+                if (editContext)
+                {
+                    editContext->Class<LodGenerationLevel>("Generated level of detail", "Simplification targets of a generated level of detail.")
+                        ->ClassElement(Edit::ClassElements::EditorData, "")
+                            ->Attribute("AutoExpand", true)
+                        ->DataElement(Edit::UIHandlers::Default, &LodGenerationLevel::m_triangleRatio, "Triangle ratio",
+                            "Fraction of the triangles of the source mesh to keep. Simplification stops earlier when the error target is reached.")
+                            ->Attribute(Edit::Attributes::Min, 0.0f)
+                            ->Attribute(Edit::Attributes::Max, 1.0f)
+                            ->Attribute(Edit::Attributes::Step, 0.05f)
+                        ->DataElement(Edit::UIHandlers::Default, &LodGenerationLevel::m_maxError, "Max error",
+                            "Largest distance the surface is allowed to move, as a fraction of the size of the mesh.")
+                            ->Attribute(Edit::Attributes::Min, 0.0f)
+                            ->Attribute(Edit::Attributes::Max, 1.0f)
+                            ->Attribute(Edit::Attributes::Step, 0.001f)
+                            ->Attribute(Edit::Attributes::Decimals, 4)
+                            ->Attribute(Edit::Attributes::DisplayDecimals, 4);
+
+                    editContext->Class<LodGenerationRule>("Level of Detail Generation",
+                        "Generate the levels of detail of the meshes in this group by simplifying them. Ignored when the group has authored levels of detail.")
+                        ->ClassElement(Edit::ClassElements::EditorData, "")
+                            ->Attribute("AutoExpand", true)
+                            ->Attribute(Edit::Attributes::NameLabelOverride, "")
+                        ->DataElement(Edit::UIHandlers::Default, &LodGenerationRule::m_lods, "Levels of detail",
+                            "The simplification targets of each generated level of detail, starting with the first level after the source mesh.");
+                }
+            }
+        } // SceneData
+    } // SceneAPI
+} // AZ
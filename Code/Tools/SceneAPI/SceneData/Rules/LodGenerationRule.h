@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Memory/Memory.h>
+#include <AzCore/RTTI/TypeInfo.h>
+#include <AzCore/std/containers/fixed_vector.h>
+#include <SceneAPI/SceneCore/DataTypes/Rules/IRule.h>
+#include <SceneAPI/SceneData/SceneDataConfiguration.h>
+#include <SceneAPI/SceneData/Rules/LodRule.h>
+
+namespace AZ
+{
+    class ReflectContext;
+
+    namespace SceneAPI
+    {
+        namespace SceneData
+        {
+            // Simplification targets of a single generated level of detail.
+            struct LodGenerationLevel
+            {
+                AZ_TYPE_INFO(LodGenerationLevel, "{9B156A8A-B86C-4A23-B6F0-760691C9A19B}");
+
+                // Fraction of the triangles of the source mesh to keep.
+                float m_triangleRatio = 0.5f;
+                // Largest distance the surface is allowed to move, as a fraction of the size of the mesh.
+                float m_maxError = 0.01f;
+            };
+
+            // Generates the levels of detail of the meshes in the group by simplifying the meshes, for groups without authored levels of detail.
+            class SCENE_DATA_CLASS LodGenerationRule
+                : public DataTypes::IRule
+            {
+            public:
+                AZ_RTTI(LodGenerationRule, "{A30F3885-1122-49E2-860F-92099F2E4D14}", DataTypes::IRule);
+                AZ_CLASS_ALLOCATOR(LodGenerationRule, AZ::SystemAllocator, 0)
+
+                SCENE_DATA_API LodGenerationRule();
+                SCENE_DATA_API ~LodGenerationRule() override = default;
+
+                SCENE_DATA_API size_t GetLodCount() const;
+                // Returns the targets of a generated level, where index 0 is the first level after the source mesh.
+                SCENE_DATA_API const LodGenerationLevel& GetLod(size_t index) const;
+
+                static void Reflect(ReflectContext* context);
+
+            protected:
+                AZStd::fixed_vector<LodGenerationLevel, LodRule::m_maxLods> m_lods;
+            };
+        } // SceneData
+    } // SceneAPI
+} // AZ
@@ -53,6 +53,8 @@ set(FILES
     Rules/CommentRule.cpp
     Rules/LodRule.h
     Rules/LodRule.cpp
+    Rules/LodGenerationRule.h
+    Rules/LodGenerationRule.cpp
     Rules/CoordinateSystemRule.h
     Rules/CoordinateSystemRule.cpp
     Rules/StaticMeshAdvancedRule.h
@@ -290,10 +290,12 @@ namespace ImageProcessingAtom
         //passing compress option
         ICompressor::EQuality quality = ICompressor::eQuality_Normal;
         AZ::Vector3 weights = AZ::Vector3(0.3333f, 0.3334f, 0.3333f);
+        AZ::u32 minBlocksPerTile = CompressOption().minBlocksPerTile;
         if (compressOption)
         {
             quality = compressOption->compressQuality;
             weights = compressOption->rgbWeight;
+            minBlocksPerTile = compressOption->minBlocksPerTile;
         }
 
         //do some clamp for float
@@ -328,29 +330,32 @@ namespace ImageProcessingAtom
             }
         }
 
-        const uint32 mipCount = dstImage->GetMipCount();
-        for (uint32 dwMip = 0; dwMip < mipCount; ++dwMip)
-        {
-            uint32 dwLocalWidth = srcImage->GetWidth(dwMip);
-            uint32 dwLocalHeight = srcImage->GetHeight(dwMip);
+        //compress all mips in tiles of block rows. Tiles with perceptual weights still run one after another,
+        //because the squish weights are global.
+        const uint32 blockSize = 4;
+        CompressTiles(srcImage, dstImage->GetMipCount(), blockSize, blockSize, minBlocksPerTile,
+            [&srcImage, &dstImage, fmtSrc, fmtDst, quality, &weights, blockSize](const CompressionTile& tile)
+            {
+                const uint32 dwFirstRow = tile.firstBlockRow * blockSize;
+                uint32 dwLocalWidth = srcImage->GetWidth(tile.mip);
+                uint32 dwLocalHeight = AZStd::min(tile.blockRowCount * blockSize, srcImage->GetHeight(tile.mip) - dwFirstRow);
 
-            uint8* pSrcMem;
-            uint32 dwSrcPitch;
-            srcImage->GetImagePointer(dwMip, pSrcMem, dwSrcPitch);
+                uint8* pSrcMem;
+                uint32 dwSrcPitch;
+                srcImage->GetImagePointer(tile.mip, pSrcMem, dwSrcPitch);
 
-            uint8* pDstMem;
-            uint32 dwDstPitch;
-            dstImage->GetImagePointer(dwMip, pDstMem, dwDstPitch);
+                uint8* pDstMem;
+                uint32 dwDstPitch;
+                dstImage->GetImagePointer(tile.mip, pDstMem, dwDstPitch);
 
-            {
                 CrySquisherCallbackUserData userData;
                 userData.m_pImageObject = dstImage;
                 userData.m_dstOffset = 0;
-                userData.m_dstMem = pDstMem;
+                userData.m_dstMem = pDstMem + tile.firstBlockRow * dwDstPitch;
 
                 CryTextureSquisher::CompressorParameters compress;
 
-                compress.srcBuffer = pSrcMem;
+                compress.srcBuffer = pSrcMem + dwFirstRow * dwSrcPitch;
                 compress.width = dwLocalWidth;
                 compress.height = dwLocalHeight;
                 compress.pitch = dwSrcPitch;
@@ -385,8 +390,7 @@ namespace ImageProcessingAtom
                 compress.preset = GetCompressPreset(fmtDst, fmtSrc);
 
                 CryTextureSquisher::Compress(compress);
-            }
-        } // for: all mips
+            });
 
         return dstImage;
     }
@@ -7,7 +7,12 @@
  */
 
 
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/PlatformIncl.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/thread.h>
 #include <Compressors/ASTCCompressor.h>
 #include <Compressors/CTSquisher.h>
 #include <Compressors/ISPCTextureCompressor.h>
@@ -46,4 +51,60 @@ namespace ImageProcessingAtom
     ICompressor::~ICompressor()
     {
     }
+
+    void ICompressor::CompressTiles(IImageObjectPtr image, AZ::u32 mipCount, AZ::u32 blockWidth, AZ::u32 blockHeight, AZ::u32 minBlocksPerTile,
+        const CompressTileFunction& compressTile)
+    {
+        //there need to be a few tiles per thread to balance the load of the slow presets
+        const AZ::u32 tilesPerThread = 4;
+        const AZ::u32 threadCount = AZStd::max(AZStd::thread::hardware_concurrency(), 1u);
+
+        AZ::u64 blockCount = 0;
+        for (AZ::u32 mip = 0; mip < mipCount; ++mip)
+        {
+            const AZ::u64 blocksInRow = (image->GetWidth(mip) + blockWidth - 1) / blockWidth;
+            const AZ::u64 blockRows = (image->GetHeight(mip) + blockHeight - 1) / blockHeight;
+            blockCount += blocksInRow * blockRows;
+        }
+        const AZ::u64 blocksPerTile = AZStd::max<AZ::u64>(minBlocksPerTile, blockCount / (threadCount * tilesPerThread));
+
+        //all mips are split at once, so the small mips don't wait for each other
+        AZStd::vector<CompressionTile> tiles;
+        for (AZ::u32 mip = 0; mip < mipCount; ++mip)
+        {
+            const AZ::u32 blocksInRow = (image->GetWidth(mip) + blockWidth - 1) / blockWidth;
+            const AZ::u32 blockRows = (image->GetHeight(mip) + blockHeight - 1) / blockHeight;
+            const AZ::u32 blockRowsPerTile = aznumeric_cast<AZ::u32>(AZStd::max<AZ::u64>(1, blocksPerTile / blocksInRow));
+
+            for (AZ::u32 firstBlockRow = 0; firstBlockRow < blockRows; firstBlockRow += blockRowsPerTile)
+            {
+                CompressionTile tile;
+                tile.mip = mip;
+                tile.firstBlockRow = firstBlockRow;
+                tile.blockRowCount = AZStd::min(blockRowsPerTile, blockRows - firstBlockRow);
+                tiles.push_back(tile);
+            }
+        }
+
+        if (tiles.size() <= 1)
+        {
+            for (const CompressionTile& tile : tiles)
+            {
+                compressTile(tile);
+            }
+            return;
+        }
+
+        AZ::JobCompletion jobCompletion;
+        for (const CompressionTile& tile : tiles)
+        {
+            AZ::Job* tileJob = AZ::CreateJobFunction([&compressTile, &tile]()
+                {
+                    compressTile(tile);
+                }, true, nullptr);  //auto-deletes
+            tileJob->SetDependent(&jobCompletion);
+            tileJob->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
 }; // namespace ImageProcessingAtom
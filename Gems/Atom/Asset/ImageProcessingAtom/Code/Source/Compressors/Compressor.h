@@ -11,6 +11,7 @@
 #include <BuilderSettings/ImageProcessingDefines.h>
 #include <Atom/ImageProcessing/PixelFormats.h>
 #include <Atom/ImageProcessing/ImageObject.h>
+#include <AzCore/std/function/function_template.h>
 
 namespace ImageProcessingAtom
 {
@@ -39,8 +40,20 @@ namespace ImageProcessingAtom
             //required for CTSquisher
             AZ::Vector3 rgbWeight = AZ::Vector3(0.3333f, 0.3334f, 0.3333f);
             bool discardAlpha = false;
+            //tiles need enough blocks to hide the job overhead of the fast presets.
+            //raising it to the maximum compresses every mip as a single tile
+            AZ::u32 minBlocksPerTile = 256;
         };
 
+        //a range of whole block rows of one mip level, which can be compressed independently of the rest of the image
+        struct CompressionTile
+        {
+            AZ::u32 mip = 0;
+            AZ::u32 firstBlockRow = 0;
+            AZ::u32 blockRowCount = 0;
+        };
+        using CompressTileFunction = AZStd::function<void(const CompressionTile& tile)>;
+
     public:
         //compress the source image to desired compressed pixel format
         virtual IImageObjectPtr CompressImage(IImageObjectPtr srcImage, EPixelFormat fmtDst, const CompressOption* compressOption) const = 0;
@@ -53,5 +66,11 @@ namespace ImageProcessingAtom
         static ICompressorPtr FindCompressor(EPixelFormat fmt, ColorSpace colorSpace, bool isCompressing);
 
         virtual ~ICompressor() = 0;
+
+    protected:
+        //split the first mipCount mips of the image into tiles of block rows and compress them concurrently with the job system.
+        //every tile only writes its own blocks, so the output doesn't depend on the tiling or on the order the tiles finish in.
+        static void CompressTiles(IImageObjectPtr image, AZ::u32 mipCount, AZ::u32 blockWidth, AZ::u32 blockHeight, AZ::u32 minBlocksPerTile,
+            const CompressTileFunction& compressTile);
     };
 }; // namespace ImageProcessingAtom
@@ -155,10 +155,12 @@ namespace ImageProcessingAtom
         // Get quality setting and alpha setting
         ICompressor::EQuality quality = ICompressor::eQuality_Normal;
         bool discardAlpha = false;
+        AZ::u32 minBlocksPerTile = CompressOption().minBlocksPerTile;
         if (compressOption)
         {
             quality = compressOption->compressQuality;
             discardAlpha = compressOption->discardAlpha;
+            minBlocksPerTile = compressOption->minBlocksPerTile;
         }
 
         // Get the compression profile
@@ -182,68 +184,83 @@ namespace ImageProcessingAtom
             }
         }
 
-        // Allocate the destination image
-        IImageObjectPtr destinationImage(sourceImage->AllocateImage(destinationFormat));
-
-        // Compress the images per mip
-        const uint32 mipCount = destinationImage->GetMipCount();
-        for (uint32_t mip = 0; mip < mipCount; mip++)
+        // Get the encoder settings of the destination format once, they are shared by all tiles
+        bc6h_enc_settings bc6hSettings = {};
+        bc7_enc_settings bc7Settings = {};
+        switch (destinationFormat)
         {
-            // Create rgba_surface as input
-            uint32 sourcePitch = 0;
-            AZ::u8* sourceImageData = nullptr;
-            sourceImage->GetImagePointer(mip, sourceImageData, sourcePitch);
-            rgba_surface sourceSurface = {};
-            {
-                sourceSurface.ptr = sourceImageData;
-                sourceSurface.width = sourceImage->GetWidth(mip);
-                sourceSurface.height = sourceImage->GetHeight(mip);
-                sourceSurface.stride = static_cast<int32_t>(sourcePitch);
-            }
-
-            // Get the mip image destination pointer
-            uint32_t destinationPitch = 0;
-            AZ::u8* destinationImageData = nullptr;
-            destinationImage->GetImagePointer(mip, destinationImageData, destinationPitch);
-
-            // Compress with the correct function, depending on the destination format
-            switch (destinationFormat)
-            {
-            case ePixelFormat_BC3:
-                CompressBlocksBC3(&sourceSurface, destinationImageData);
-                break;
-            case ePixelFormat_BC6UH:
-            {
-                // Get the profile setter
-                bc6h_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC6();
-                setProfile(&settings);
-
-                // Compress with BC6 half precision
-                CompressBlocksBC6H(&sourceSurface, destinationImageData, &settings);
-            }
+        case ePixelFormat_BC3:
             break;
-            case ePixelFormat_BC7:
-            case ePixelFormat_BC7t:
-            {
-                // Get the profile setter
-                bc7_enc_settings settings = {};
-                const auto setProfile = compressionProfile->GetBC7(discardAlpha);
-                setProfile(&settings);
+        case ePixelFormat_BC6UH:
+        {
+            const auto setProfile = compressionProfile->GetBC6();
+            setProfile(&bc6hSettings);
+        }
+        break;
+        case ePixelFormat_BC7:
+        case ePixelFormat_BC7t:
+        {
+            const auto setProfile = compressionProfile->GetBC7(discardAlpha);
+            setProfile(&bc7Settings);
+        }
+        break;
+        default:
+        {
+            // No valid pixel format
+            AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
+            return nullptr;
+        }
+        break;
+        }
 
-                // Compress with BC7
-                CompressBlocksBC7(&sourceSurface, destinationImageData, &settings);
-            }
-            break;
-            default:
+        // Allocate the destination image
+        IImageObjectPtr destinationImage(sourceImage->AllocateImage(destinationFormat));
+
+        // Compress the mips in tiles of block rows, the ISPC kernels are vectorized but single threaded
+        const PixelFormatInfo* destinationFormatInfo = CPixelFormats::GetInstance().GetPixelFormatInfo(destinationFormat);
+        const uint32 blockWidth = destinationFormatInfo->blockWidth;
+        const uint32 blockHeight = destinationFormatInfo->blockHeight;
+        CompressTiles(sourceImage, destinationImage->GetMipCount(), blockWidth, blockHeight, minBlocksPerTile,
+            [&sourceImage, &destinationImage, destinationFormat, blockHeight, &bc6hSettings, &bc7Settings](const CompressionTile& tile)
             {
-                // No valid pixel format
-                AZ_Assert(false, "Unhandled pixel format %d", destinationFormat);
-                return nullptr;
-            }
-            break;
-            }
-        }
+                // Create rgba_surface of the tile rows as input
+                uint32 sourcePitch = 0;
+                AZ::u8* sourceImageData = nullptr;
+                sourceImage->GetImagePointer(tile.mip, sourceImageData, sourcePitch);
+                const uint32 firstRow = tile.firstBlockRow * blockHeight;
+                rgba_surface sourceSurface = {};
+                {
+                    sourceSurface.ptr = sourceImageData + firstRow * sourcePitch;
+                    sourceSurface.width = sourceImage->GetWidth(tile.mip);
+                    sourceSurface.height = AZStd::min(tile.blockRowCount * blockHeight, sourceImage->GetHeight(tile.mip) - firstRow);
+                    sourceSurface.stride = static_cast<int32_t>(sourcePitch);
+                }
+
+                // Get the destination pointer of the tile's first block row
+                uint32_t destinationPitch = 0;
+                AZ::u8* destinationImageData = nullptr;
+                destinationImage->GetImagePointer(tile.mip, destinationImageData, destinationPitch);
+                destinationImageData += tile.firstBlockRow * destinationPitch;
+
+                // Compress with the correct function, depending on the destination format
+                switch (destinationFormat)
+                {
+                case ePixelFormat_BC3:
+                    CompressBlocksBC3(&sourceSurface, destinationImageData);
+                    break;
+                case ePixelFormat_BC6UH:
+                    // Compress with BC6 half precision
+                    CompressBlocksBC6H(&sourceSurface, destinationImageData, &bc6hSettings);
+                    break;
+                case ePixelFormat_BC7:
+                case ePixelFormat_BC7t:
+                    // Compress with BC7
+                    CompressBlocksBC7(&sourceSurface, destinationImageData, &bc7Settings);
+                    break;
+                default:
+                    break;
+                }
+            });
 
         return destinationImage;
     }
@@ -7,8 +7,12 @@
  */
 
 
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/SimdMath.h>
 #include <AzCore/Memory/OSAllocator.h>
 #include <AzCore/base.h>
+#include <AzCore/std/parallel/thread.h>
 #include <Atom/ImageProcessing/ImageObject.h>
 #include <Processing/ImageConvert.h>
 #include <Processing/ImageToProcess.h>
@@ -203,24 +207,34 @@ namespace ImageProcessingAtom
         DataType*** rows;
     };
 
+    /* #################################################################################################################### \
+     */
+    #define filterTStrides(filterVxNNum)                                                            \
+        /* addition of c-pointers already takes care of datatype-sizes */                           \
+        [[maybe_unused]] const signed long int dy = /*parm->mirror ? -1 :*/ 1;                      \
+        [[maybe_unused]] const unsigned int stridei = parm->incols  * 1 * 1;                        \
+        [[maybe_unused]] const unsigned int stridet = parm->subcols * 1 * 1;                        \
+        [[maybe_unused]] const unsigned int strideo = parm->outcols * 1 * 1;                        \
+        /* offset and shift calculations still require the unmodified values */                     \
+        [[maybe_unused]] const unsigned int strideiraw = parm->incols;                              \
+        [[maybe_unused]] const unsigned int stridetraw = parm->subcols;                             \
+        [[maybe_unused]] const unsigned int strideoraw = parm->outcols;                             \
+        [[maybe_unused]] const unsigned int cstZero = 0;                                            \
+                                                                                                    \
+        int srcPos, dstPos;                                                                         \
+        [[maybe_unused]] const bool of = true;                                                      \
+        [[maybe_unused]] const bool nc = false;
+
+    #define filterFTStrides(filterVxNNum) \
+        filterTStrides(filterVxNNum)
+
     /* #################################################################################################################### \
      */
     #define filterTVariables(filterVxNNum, dtyp, wtyp, reps)                                                                                                                                   \
-        /* addition of c-pointers already takes care of datatype-sizes */                                                                                                                      \
-        const signed long int dy = /*parm->mirror ? -1 :*/ 1;                                                                                                                                  \
-        const unsigned int stridei = parm->incols  * 1 * 1;                                                                                                                                    \
-        [[maybe_unused]] const unsigned int stridet = parm->subcols * 1 * 1;                                                                                                                   \
-        [[maybe_unused]] const unsigned int strideo = parm->outcols * 1 * 1;                                                                                                                   \
-        /* offset and shift calculations still require the unmodified values */                                                                                                                \
-        const unsigned int strideiraw = parm->incols;                                                                                                                                          \
-        [[maybe_unused]] const unsigned int stridetraw = parm->subcols;                                                                                                                        \
-        const unsigned int strideoraw = parm->outcols;                                                                                                                                         \
-                                                                                                                                                                                               \
         class Plane2D<dtyp> tmp(tmpcols, tmprows, 4);                                                                                                                                          \
         dtyp*** t = (dtyp***)tmp;                                                                                                                                                              \
-        int srcPos, dstPos;                                                                                                                                                                    \
-        bool plusminush = false; [[maybe_unused]] const bool of = true;                                                                                                                        \
-        bool plusminusv = false; [[maybe_unused]] const bool nc = false;                                                                                                                       \
+        bool plusminush = false;                                                                                                                                                               \
+        bool plusminusv = false;                                                                                                                                                               \
         FilterWeights<wtyp>* fwh = calculateFilterWeights<wtyp>(parm->resample.colrem, parm->caged ? 0 : 0 - parm->region.subtop, parm->caged ? srccols : parm->subrows - parm->region.subtop, \
             parm->resample.colquo,               0,               dstcols, reps, parm->resample.colblur, parm->resample.wf, parm->resample.operation != eWindowEvaluation_Sum, plusminush);    \
         FilterWeights<wtyp>* fwv = calculateFilterWeights<wtyp>(parm->resample.rowrem, parm->caged ? 0 : 0 - parm->region.intop, parm->caged ? srcrows : parm->inrows  - parm->region.intop,   \
@@ -245,59 +259,45 @@ namespace ImageProcessingAtom
 
     /* #################################################################################################################### \
      */
-    #define filter4xNf(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip, init, next, fetch, store, exit, op, pm, hv, dtyp, atyp) \
-        init(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip);                                                                  \
-                                                                                                                                     \
-        dstPos = 0; do {                                                                                                             \
-            FilterWeights<signed short>& fw = *(hv + dstPos);                                                                        \
-            const signed short* w = fw.weights;                                                                                      \
-                                                                                                                                     \
-            next(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip);                                                              \
-                                                                                                                                     \
-            atyp res0 = (op != eWindowEvaluation_Min ? 0 : 32768);                                                                   \
-            atyp res1 = (op != eWindowEvaluation_Min ? 0 : 32768);                                                                   \
-            atyp res2 = (op != eWindowEvaluation_Min ? 0 : 32768);                                                                   \
-            atyp res3 = (op != eWindowEvaluation_Min ? 0 : 32768);                                                                   \
-                                                                                                                                     \
-            srcPos = fw.first; do {                                                                                                  \
-                /* get value */                                                                                                      \
-                fetch(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip);                                                         \
-                                                                                                                                     \
-                /* build result using sign inverted weights [32767,-32768] */                                                        \
-                if constexpr (op == eWindowEvaluation_Sum) {                                                                         \
-                    res0 -= ((atyp)_0 * *w);                                                                                         \
-                    res1 -= ((atyp)_1 * *w);                                                                                         \
-                    res2 -= ((atyp)_2 * *w);                                                                                         \
-                    res3 -= ((atyp)_3 * *w++);                                                                                       \
-                }                                                                                                                    \
-                else if constexpr (op == eWindowEvaluation_Max) {                                                                    \
-                    res0 = maximum(res0, -(atyp)_0 * *w);                                                                            \
-                    res1 = maximum(res1, -(atyp)_1 * *w);                                                                            \
-                    res2 = maximum(res2, -(atyp)_2 * *w);                                                                            \
-                    res3 = maximum(res3, -(atyp)_3 * *w++);                                                                          \
-                }                                                                                                                    \
-                else if constexpr (op == eWindowEvaluation_Min) {                                                                    \
-                    res0 = (atyp)32768.0 - maximum((atyp)32768.0 - res0, -(atyp)(1.0f - _0) * *w);                                   \
-                    res1 = (atyp)32768.0 - maximum((atyp)32768.0 - res1, -(atyp)(1.0f - _1) * *w);                                   \
-                    res2 = (atyp)32768.0 - maximum((atyp)32768.0 - res2, -(atyp)(1.0f - _2) * *w);                                   \
-                    res3 = (atyp)32768.0 - maximum((atyp)32768.0 - res3, -(atyp)(1.0f - _3) * *w++);                                 \
-                }                                                                                                                    \
-            } while (++srcPos < fw.last);                                                                                            \
-                                                                                                                                     \
-            /*  dtyp _0 = ldexp((dtyp)res0, -15);   */                                                                               \
-            /*  dtyp _1 = ldexp((dtyp)res1, -15);   */                                                                               \
-            /*  dtyp _2 = ldexp((dtyp)res2, -15);   */                                                                               \
-            /*  dtyp _3 = ldexp((dtyp)res3, -15);   */                                                                               \
-                                                                                                                                     \
-            dtyp _0 = (dtyp)res0 * (dtyp)(1.0 / 32768.0);                                                                            \
-            dtyp _1 = (dtyp)res1 * (dtyp)(1.0 / 32768.0);                                                                            \
-            dtyp _2 = (dtyp)res2 * (dtyp)(1.0 / 32768.0);                                                                            \
-            dtyp _3 = (dtyp)res3 * (dtyp)(1.0 / 32768.0);                                                                            \
-                                                                                                                                     \
-            /* put value */                                                                                                          \
-            store(srcOffs, srcSize, srcSkip, dstOffs,   dstSize, dstSkip);                                                           \
-        } while (++dstPos < (signed)dstSize);                                                                                        \
-                                                                                                                                     \
+    #define filter4xNf(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip, init, next, fetch, store, exit, op, pm, hv, dtyp, atyp)   \
+        init(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip);                                                                    \
+                                                                                                                                       \
+        dstPos = 0; do {                                                                                                               \
+            FilterWeights<signed short>& fw = *(hv + dstPos);                                                                          \
+            const signed short* w = fw.weights;                                                                                        \
+                                                                                                                                       \
+            next(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip);                                                                \
+                                                                                                                                       \
+            /* all four channels are accumulated at once, min accumulates the inverted values with max */                              \
+            AZ::Simd::Vec4::FloatType res = AZ::Simd::Vec4::ZeroFloat();                                                               \
+                                                                                                                                       \
+            srcPos = fw.first; do {                                                                                                    \
+                /* get value */                                                                                                        \
+                fetch(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip);                                                           \
+                                                                                                                                       \
+                /* build result using sign inverted weights [32767,-32768] */                                                          \
+                const AZ::Simd::Vec4::FloatType weight = AZ::Simd::Vec4::Splat(-(atyp)*w++);                                           \
+                if constexpr (op == eWindowEvaluation_Sum) {                                                                           \
+                    res = AZ::Simd::Vec4::Madd(_v, weight, res);                                                                       \
+                }                                                                                                                      \
+                else if constexpr (op == eWindowEvaluation_Max) {                                                                      \
+                    res = AZ::Simd::Vec4::Max(res, AZ::Simd::Vec4::Mul(_v, weight));                                                   \
+                }                                                                                                                      \
+                else if constexpr (op == eWindowEvaluation_Min) {                                                                      \
+                    res = AZ::Simd::Vec4::Max(res, AZ::Simd::Vec4::Mul(AZ::Simd::Vec4::Sub(AZ::Simd::Vec4::Splat(1.0f), _v), weight)); \
+                }                                                                                                                      \
+            } while (++srcPos < fw.last);                                                                                              \
+                                                                                                                                       \
+            if constexpr (op == eWindowEvaluation_Min) {                                                                               \
+                res = AZ::Simd::Vec4::Sub(AZ::Simd::Vec4::Splat((atyp)32768.0), res);                                                  \
+            }                                                                                                                          \
+                                                                                                                                       \
+            const AZ::Simd::Vec4::FloatType _v = AZ::Simd::Vec4::Mul(res, AZ::Simd::Vec4::Splat((dtyp)(1.0 / 32768.0)));               \
+                                                                                                                                       \
+            /* put value */                                                                                                            \
+            store(srcOffs, srcSize, srcSkip, dstOffs,   dstSize, dstSkip);                                                             \
+        } while (++dstPos < (signed)dstSize);                                                                                          \
+                                                                                                                                       \
         exit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip);
 
     #define filterF4xNHor(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip, init, next, fetch, store, exit, op, pm) \
@@ -308,57 +308,56 @@ namespace ImageProcessingAtom
 
     /* #################################################################################################################### \
      */
-    #define resampleF4xNFromPlane(stride)    \
-        float _0, _1, _2, _3;                \
-                                             \
-        _0 = (*i0)[ix], i0 += (stride) * dy; \
-        _1 = (*i1)[ix], i1 += (stride) * dy; \
-        _2 = (*i2)[ix], i2 += (stride) * dy; \
-        _3 = (*i3)[ix], i3 += (stride) * dy;
+    #define resampleF4xNFromPlane(stride)                                                                               \
+        const AZ::Simd::Vec4::FloatType _v = AZ::Simd::Vec4::LoadImmediate((*i0)[ix], (*i1)[ix], (*i2)[ix], (*i3)[ix]); \
+                                                                                                                        \
+        i0 += (stride) * dy;                                                                                            \
+        i1 += (stride) * dy;                                                                                            \
+        i2 += (stride) * dy;                                                                                            \
+        i3 += (stride) * dy;
 
     /* ******************************************************************************************************************** \
      */
-    #define resampleF4xNFromStream(stride, instream) \
-        float _0, _1, _2, _3;                        \
-                                                     \
-        _0 = instream[0];                            \
-        _1 = instream[1];                            \
-        _2 = instream[2];                            \
-        _3 = instream[3], instream += (stride) * 4;
+    #define resampleF4xNFromStream(stride, instream)                                  \
+        const AZ::Simd::Vec4::FloatType _v = AZ::Simd::Vec4::LoadUnaligned(instream); \
+                                                                                      \
+        instream += (stride) * 4;
 
     /* ******************************************************************************************************************** \
      */
-    #define resampleF4xNFromStreamSwapped(stride, instream) \
-        float _0, _1, _2, _3;                               \
-                                                            \
-        _3 = instream[0];                                   \
-        _2 = instream[1];                                   \
-        _1 = instream[2];                                   \
-        _0 = instream[3], instream += (stride) * 4;
+    #define resampleF4xNFromStreamSwapped(stride, instream)                                                                     \
+        const AZ::Simd::Vec4::FloatType _v = AZ::Simd::Vec4::LoadImmediate(instream[3], instream[2], instream[1], instream[0]); \
+                                                                                                                                \
+        instream += (stride) * 4;
 
     /* #################################################################################################################### \
      */
-    #define resampleF4xNToPlane(stride) \
-        (*o0)[ox] = _0;                 \
-        (*o1)[ox] = _1;                 \
-        (*o2)[ox] = _2;                 \
-        (*o3)[ox] = _3, ox += (1) * 1;
+    #define resampleF4xNToPlane(stride)         \
+        float _s[4];                            \
+        AZ::Simd::Vec4::StoreUnaligned(_s, _v); \
+                                                \
+        (*o0)[ox] = _s[0];                      \
+        (*o1)[ox] = _s[1];                      \
+        (*o2)[ox] = _s[2];                      \
+        (*o3)[ox] = _s[3], ox += (1) * 1;
 
     /* ******************************************************************************************************************** \
      */
-    #define resampleF4xNToStream(stride, outstream) \
-        outstream[0] = _0;                          \
-        outstream[1] = _1;                          \
-        outstream[2] = _2;                          \
-        outstream[3] = _3, outstream += (1) * 4;
+    #define resampleF4xNToStream(stride, outstream)    \
+        AZ::Simd::Vec4::StoreUnaligned(outstream, _v); \
+                                                       \
+        outstream += (1) * 4;
 
     /* ******************************************************************************************************************** \
      */
     #define resampleF4xNToStreamSwapped(stride, outstream) \
-        outstream[0] = _3;                                 \
-        outstream[1] = _2;                                 \
-        outstream[2] = _1;                                 \
-        outstream[3] = _0, outstream += (1) * 4;
+        float _s[4];                                       \
+        AZ::Simd::Vec4::StoreUnaligned(_s, _v);            \
+                                                           \
+        outstream[0] = _s[3];                              \
+        outstream[1] = _s[2];                              \
+        outstream[2] = _s[1];                              \
+        outstream[3] = _s[0], outstream += (1) * 4;
 
     /* #################################################################################################################### \
      */
@@ -539,6 +538,7 @@ namespace ImageProcessingAtom
     #      define allCAdvPMULInStreamPointer        allF4AdvPMULStreamPointer
     #      define allCAdvNMULInStreamPointer        allF4AdvNMULStreamPointer
     #      define allCAdvADDMOutStreamPointer       allF4AdvADDMStreamPointer
+    #      define allCAdvPMULOutStreamPointer       allF4AdvPMULStreamPointer
     #      define allCAdvSSUBOutStreamPointer       allF4AdvSSUBStreamPointer
 
     #      define   getCxNFromStreamSwapped     /*filterF4xNFromStreamSwapped*/
@@ -570,6 +570,7 @@ namespace ImageProcessingAtom
     #    define histoCVariables         /*histoFTVariables*/
 
     #    define filterCVariables        filterFTVariables
+    #    define filterCStrides          filterFTStrides
 
     #  define   orderedTInitLoop()          /*orderedTInitLoop*/
     #  define   hiloTInitLoop()             /*hiloTInitLoop*/
@@ -751,7 +752,140 @@ namespace ImageProcessingAtom
     }
 
     /* #################################################################################################################### \
-     * multi-threadable if needed
+     */
+    #define filterRowInit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
+        allTInitFixedOutPlaneReferences(cstZero, srcOffs, -, o, t);
+
+    #define filterRowNext(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip)                                                 \
+        /* every in/out-put may swap */                                                                                         \
+        allCInitSwappableInPlaneReferences(parm->region.inleft, srcOffs, parm->region.intop, fw.first, parm->inrows, i, false); \
+        /* because the filter moves back and forth, we always have to reposition from 0 */                                      \
+        allCAdvPMULInStreamPointer(srcSkip##raw, fw.first, i);
+
+    #define filterRowFetch(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
+        /* vertical stride, horizontal fetch */                                  \
+        /* getCxNFromStreamSwapped(srcSkip, i); Expands to nothing */            \
+        getCxNFromStream(srcSkip, i);                                            \
+        getCxNFromPlane(1);                                                      \
+                                                                                 \
+        /*srcPos++;*/
+
+    #define filterRowStore(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip)         \
+        /* because the filter moves back and forth, we always have to reposition to 0 */ \
+        allCAdvNMULInStreamPointer(srcSkip##raw, fw.last, i);                            \
+                                                                                         \
+        /* horizontal stride, vertical store */                                          \
+        putTxNToPlane(1);                                                                \
+                                                                                         \
+        /*dstPos++;*/
+
+    #define filterRowExit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
+        allCAdvPADDInStreamPointer(orderedNum, i);
+
+    /* #################################################################################################################### \
+     * 1st pass, "i" points to the first row of the source-region, only the rows [firstRow, lastRow) of "t" are written
+     */
+    template<int operation>
+    static void FilterVertical(const float* i, float*** t, FilterWeights<signed short>* fwv, const struct prcparm* parm,
+        [[maybe_unused]] const unsigned int srcrows, const unsigned int dstrows, const unsigned int firstRow, const unsigned int lastRow)
+    {
+        filterCStrides(orderedNum);
+
+        allCAdvPADDInStreamPointer(firstRow, i);
+
+        for (unsigned int tmprow = firstRow; tmprow < lastRow; tmprow += orderedNum)
+        {
+            filterVer(tmprow, srcrows, stridei,
+                tmprow, dstrows, stridet, filterRowInit, filterRowNext, filterRowFetch, filterRowStore, filterRowExit, operation, of);
+        }
+    }
+
+    /* #################################################################################################################### \
+     */
+    #define filterColInit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
+        allCInitSwappableOutPlaneReferences(parm->region.outleft, cstZero, parm->region.outtop, srcOffs, parm->outrows, o, false);
+
+    #define filterColNext(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
+        /* every in/out-put may swap */                                         \
+        allTInitFixedInPlaneReferences(srcOffs, parm->region.subtop + fw.first, -, i, t);
+
+    #define filterColFetch(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
+        /* vertical stride, horizontal fetch */                                  \
+        getTxNFromPlane(1);                                                      \
+                                                                                 \
+        /*srcPos++;*/
+
+    #define filterColStore(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
+        comcpyCCheckHiLo();                                                      \
+        comcpyCCoVar();                                                          \
+        comcpyCHistogram();                                                      \
+                                                                                 \
+        /* horizontal stride, vertical store */                                  \
+        /* putCxNToStreamSwapped(dstSkip, o); Expands to nothing */              \
+        putCxNToStream(dstSkip, o);                                              \
+        putCxNToPlane(1);                                                        \
+                                                                                 \
+        /*dstPos++;*/
+
+    #define filterColExit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
+        allCAdvSSUBOutStreamPointer(dstSkip##raw, orderedShift, dstPos, o);
+
+    /* #################################################################################################################### \
+     * 2nd pass, "o" points to the first row of the destination-region, only the rows [firstRow, lastRow) of "o" are written
+     */
+    template<int operation>
+    static void FilterHorizontal(float* o, float*** t, FilterWeights<signed short>* fwh, const struct prcparm* parm,
+        [[maybe_unused]] const unsigned int srccols, const unsigned int dstcols, const unsigned int firstRow, const unsigned int lastRow)
+    {
+        filterCStrides(orderedNum);
+
+        allCAdvPMULOutStreamPointer(firstRow, strideoraw, o);
+
+        for (unsigned int dstrow = firstRow; dstrow < lastRow; dstrow += orderedNum)
+        {
+            filterHor(dstrow, srccols, stridet,
+                dstrow, dstcols, strideo, filterColInit, filterColNext, filterColFetch, filterColStore, filterColExit, operation, of);
+        }
+    }
+
+    /* #################################################################################################################### \
+     * the rows of a pass don't depend on each other, so the pass is split into row-ranges which are filtered as jobs
+     */
+    static const unsigned int MinRowsPerJob = 16;
+    static const unsigned int JobsPerThread = 4;
+
+    template<typename RowRangeFunction>
+    static void ForEachRowRange(const unsigned int rows, const RowRangeFunction& rowRangeFunction)
+    {
+        const unsigned int threads = AZStd::max(AZStd::thread::hardware_concurrency(), 1u);
+        const unsigned int jobs = AZStd::min(threads * JobsPerThread, rows / MinRowsPerJob);
+
+        if (jobs <= 1)
+        {
+            rowRangeFunction(0, rows);
+            return;
+        }
+
+        AZ::JobCompletion jobCompletion;
+        for (unsigned int job = 0; job < jobs; ++job)
+        {
+            /* round to the row-granularity, the last job takes the remainder */
+            const unsigned int firstRow = ((rows * job) / jobs) & (~(orderedNum - 1));
+            const unsigned int lastRow = (job == jobs - 1) ? rows : ((rows * (job + 1)) / jobs) & (~(orderedNum - 1));
+
+            AZ::JobContext* jobContext = nullptr;
+            AZ::Job* rowRangeJob = AZ::CreateJobFunction([&rowRangeFunction, firstRow, lastRow]()
+                {
+                    rowRangeFunction(firstRow, lastRow);
+                }, true, jobContext);
+            rowRangeJob->SetDependent(&jobCompletion);
+            rowRangeJob->Start();
+        }
+        jobCompletion.StartAndWaitForCompletion();
+    }
+
+    /* #################################################################################################################### \
+     * both passes are multi-threaded, the 2nd pass starts after the 1st pass completed all rows
      */
     static void RunAlgorithm(const float* i, float* o, struct prcparm* parm)
     {
@@ -760,7 +894,6 @@ namespace ImageProcessingAtom
         const unsigned int srccols = parm->docols * parm->resample.colrem / parm->resample.colquo;
         const unsigned int dstrows = parm->dorows;
         const unsigned int dstcols = parm->docols;
-        const unsigned int cstZero = 0;
 
         /* temporary buffer region */
         parm->subrows        = srccols;
@@ -822,68 +955,21 @@ namespace ImageProcessingAtom
          */
         allCAdvADDMInStreamPointer(parm->region.inleft, parm->region.intop, parm->incols, i);
 
-    #define filterRowInit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        allTInitFixedOutPlaneReferences(cstZero, srcOffs, -, o, t);
-
-    #define filterRowNext(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip)                                                 \
-        /* every in/out-put may swap */                                                                                         \
-        allCInitSwappableInPlaneReferences(parm->region.inleft, srcOffs, parm->region.intop, fw.first, parm->inrows, i, false); \
-        /* because the filter moves back and forth, we always have to reposition from 0 */                                      \
-        allCAdvPMULInStreamPointer(srcSkip##raw, fw.first, i);
-
-    #define filterRowFetch(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        /* vertical stride, horizontal fetch */                                  \
-        /* getCxNFromStreamSwapped(srcSkip, i); Expands to nothing */            \
-        getCxNFromStream(srcSkip, i);                                            \
-        getCxNFromPlane(1);                                                      \
-                                                                                 \
-        /*srcPos++;*/
-
-    #define filterRowStore(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip)         \
-        /* because the filter moves back and forth, we always have to reposition to 0 */ \
-        allCAdvNMULInStreamPointer(srcSkip##raw, fw.last, i);                            \
-                                                                                         \
-        /* horizontal stride, vertical store */                                          \
-        putTxNToPlane(1);                                                                \
-                                                                                         \
-        /*dstPos++;*/
-
-    #define filterRowExit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        allCAdvPADDInStreamPointer(orderedNum, i);
-
-        if (parm->resample.operation == eWindowEvaluation_Sum)
-        {
-            loopEnter(tmprow, tmprows, orderedNum);
-
-            {
-                filterVer(tmprow, srcrows, stridei,
-                    tmprow, dstrows, stridet, filterRowInit, filterRowNext, filterRowFetch, filterRowStore, filterRowExit, eWindowEvaluation_Sum, of);
-            }
-
-            loopLeave(tmprow, tmprows, orderedNum);
-        }
-        else if (parm->resample.operation == eWindowEvaluation_Max)
-        {
-            loopEnter(tmprow, tmprows, orderedNum);
-
-            {
-                filterVer(tmprow, srcrows, stridei,
-                    tmprow, dstrows, stridet, filterRowInit, filterRowNext, filterRowFetch, filterRowStore, filterRowExit, eWindowEvaluation_Max, of);
-            }
-
-            loopLeave(tmprow, tmprows, orderedNum);
-        }
-        else if (parm->resample.operation == eWindowEvaluation_Min)
-        {
-            loopEnter(tmprow, tmprows, orderedNum);
-
+        ForEachRowRange(tmprows, [&](const unsigned int firstRow, const unsigned int lastRow)
             {
-                filterVer(tmprow, srcrows, stridei,
-                    tmprow, dstrows, stridet, filterRowInit, filterRowNext, filterRowFetch, filterRowStore, filterRowExit, eWindowEvaluation_Min, of);
-            }
-
-            loopLeave(tmprow, tmprows, orderedNum);
-        }
+                if (parm->resample.operation == eWindowEvaluation_Sum)
+                {
+                    FilterVertical<eWindowEvaluation_Sum>(i, t, fwv, parm, srcrows, dstrows, firstRow, lastRow);
+                }
+                else if (parm->resample.operation == eWindowEvaluation_Max)
+                {
+                    FilterVertical<eWindowEvaluation_Max>(i, t, fwv, parm, srcrows, dstrows, firstRow, lastRow);
+                }
+                else if (parm->resample.operation == eWindowEvaluation_Min)
+                {
+                    FilterVertical<eWindowEvaluation_Min>(i, t, fwv, parm, srcrows, dstrows, firstRow, lastRow);
+                }
+            });
 
         /* 1st resampling end
          * --------------------------------------------------------------------------------------------
@@ -916,67 +1002,21 @@ namespace ImageProcessingAtom
          */
         allCAdvADDMOutStreamPointer(parm->region.outleft, parm->region.outtop, parm->outcols, o);
 
-    #define filterColInit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        allCInitSwappableOutPlaneReferences(parm->region.outleft, cstZero, parm->region.outtop, srcOffs, parm->outrows, o, false);
-
-    #define filterColNext(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        /* every in/out-put may swap */                                         \
-        allTInitFixedInPlaneReferences(srcOffs, parm->region.subtop + fw.first, -, i, t);
-
-    #define filterColFetch(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        /* vertical stride, horizontal fetch */                                  \
-        getTxNFromPlane(1);                                                      \
-                                                                                 \
-        /*srcPos++;*/
-
-    #define filterColStore(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        comcpyCCheckHiLo();                                                      \
-        comcpyCCoVar();                                                          \
-        comcpyCHistogram();                                                      \
-                                                                                 \
-        /* horizontal stride, vertical store */                                  \
-        /* putCxNToStreamSwapped(dstSkip, o); Expands to nothing */              \
-        putCxNToStream(dstSkip, o);                                              \
-        putCxNToPlane(1);                                                        \
-                                                                                 \
-        /*dstPos++;*/
-
-    #define filterColExit(srcOffs, srcSize, srcSkip, dstOffs, dstSize, dstSkip) \
-        allCAdvSSUBOutStreamPointer(dstSkip##raw, orderedShift, dstPos, o);
-
-        if (parm->resample.operation == eWindowEvaluation_Sum)
-        {
-            loopEnter(dstrow, dstrows, orderedNum);
-
+        ForEachRowRange(dstrows, [&](const unsigned int firstRow, const unsigned int lastRow)
             {
-                filterHor(dstrow, srccols, stridet,
-                    dstrow, dstcols, strideo, filterColInit, filterColNext, filterColFetch, filterColStore, filterColExit, eWindowEvaluation_Sum, of);
-            }
-
-            loopLeave(dstrow, dstrows, orderedNum);
-        }
-        else if (parm->resample.operation == eWindowEvaluation_Max)
-        {
-            loopEnter(dstrow, dstrows, orderedNum);
-
-            {
-                filterHor(dstrow, srccols, stridet,
-                    dstrow, dstcols, strideo, filterColInit, filterColNext, filterColFetch, filterColStore, filterColExit, eWindowEvaluation_Max, of);
-            }
-
-            loopLeave(dstrow, dstrows, orderedNum);
-        }
-        else if (parm->resample.operation == eWindowEvaluation_Min)
-        {
-            loopEnter(dstrow, dstrows, orderedNum);
-
-            {
-                filterHor(dstrow, srccols, stridet,
-                    dstrow, dstcols, strideo, filterColInit, filterColNext, filterColFetch, filterColStore, filterColExit, eWindowEvaluation_Min, of);
-            }
-
-            loopLeave(dstrow, dstrows, orderedNum);
-        }
+                if (parm->resample.operation == eWindowEvaluation_Sum)
+                {
+                    FilterHorizontal<eWindowEvaluation_Sum>(o, t, fwh, parm, srccols, dstcols, firstRow, lastRow);
+                }
+                else if (parm->resample.operation == eWindowEvaluation_Max)
+                {
+                    FilterHorizontal<eWindowEvaluation_Max>(o, t, fwh, parm, srccols, dstcols, firstRow, lastRow);
+                }
+                else if (parm->resample.operation == eWindowEvaluation_Min)
+                {
+                    FilterHorizontal<eWindowEvaluation_Min>(o, t, fwh, parm, srccols, dstcols, firstRow, lastRow);
+                }
+            });
 
         /* 2nd resampling end
          * --------------------------------------------------------------------------------------------
@@ -998,81 +1038,6 @@ namespace ImageProcessingAtom
         filterCCleanUp(orderedNum);
     }
 
-    // TODO: not working yet, debug and enable
-    //static void SplitAlgorithm(const void* i, void* o, struct prcparm* templ, int threads = 8)
-    //{
-    //    struct prcparm fraction[32];
-    //    int t, istart = 0, sstart = 0, ostart = 0;
-    //    const bool scaler = true;
-
-    //    int theight = 0;
-
-    //    /* prepare data to be emitted to the threads */
-    //    for (t = 0; t < threads; t++)
-    //    {
-    //        fraction[t] = *templ;
-
-    //        /* adjust the processing-region according to the available threads */
-    //        {
-    //#undef  split       /* only prefix-threads need aligned transpose (for not trashing suffix-thread data) */
-    //#define split(rows) !scaler                                         \
-    //    ? ((rows * (t + 1)) / threads) & (~(t != threads - 1 ? 15 : 0)) \
-    //    : ((rows * (t + 1)) / threads) & (~0)
-
-    //            /* area covered */
-    //            const int  inrows = (fraction[t].regional ? fraction[t].region.inrows  : fraction[t].inrows);
-    //            const int  incols = (fraction[t].regional ? fraction[t].region.incols  : fraction[t].incols);
-    //            const int subrows = (fraction[t].regional ? fraction[t].region.subrows : fraction[t].subrows);
-    //            const int subcols = (fraction[t].regional ? fraction[t].region.subcols : fraction[t].subcols);
-    //            const int outrows = (fraction[t].regional ? fraction[t].region.outrows : fraction[t].outrows);
-    //            const int outcols = (fraction[t].regional ? fraction[t].region.outcols : fraction[t].outcols);
-
-    //            /* splitting blocks */
-    //            const int istop = split(inrows), sstop = split(subrows), ostop = split(outrows);
-    //            const int irows = istop - istart, srows = sstop - sstart, orows = ostop - ostart;
-    //            const int icols = incols, scols = subcols, ocols = outcols;
-
-    //            AZ_Assert(irows > 0, "%s: Expect row count to be above zero!", __FUNCTION__);
-    //            AZ_Assert(orows > 0, "%s: Expect row count to be above zero!", __FUNCTION__);
-    //            AZ_Assert(icols > 0, "%s: Expect column count to be above zero!", __FUNCTION__);
-    //            AZ_Assert(ocols > 0, "%s: Expect column count to be above zero!", __FUNCTION__);
-
-    //            /* now we are regional */
-    //            fraction[t].regional       = true;
-
-    //            /* take previous regionality into account */
-    //            fraction[t].region.intop += istart;
-    //            fraction[t].region.subtop += sstart;
-    //            fraction[t].region.outtop += ostart;
-    //            fraction[t].region.inrows = irows;
-    //            fraction[t].region.subrows = srows;
-    //            fraction[t].region.outrows = orows;
-
-    //            /* take previous regionality into account */
-    //            fraction[t].region.inleft += 0;
-    //            fraction[t].region.subleft += 0;
-    //            fraction[t].region.outleft += 0;
-    //            fraction[t].region.incols  = icols;
-    //            fraction[t].region.subcols  = scols;
-    //            fraction[t].region.outcols  = ocols;
-
-    //            /* advance block */
-    //            istart = istop;
-    //            sstart = sstop;
-    //            ostart = ostop;
-
-    //            /* check */
-    //            theight += irows;
-    //        }
-
-    //        // the algorithm supports "i" and "o" pointing to the same memory
-    //        CheckBoundaries((float*)i, (float*)o, &fraction[t]);
-    //        RunAlgorithm((float*)i, (float*)o, &fraction[t]);
-    //    }
-
-    //    AZ_Assert(theight >= (templ->regional ? templ->region.inrows : templ->inrows), "%s: Invalid height!", __FUNCTION__);
-    //}
-
     /* #################################################################################################################### \
      */
     void FilterImage(int filterIndex, int filterOp, float blurH, float blurV, const IImageObjectPtr srcImg, int srcMip,
@@ -1232,9 +1197,6 @@ namespace ImageProcessingAtom
                 break;
             }
 
-            // TODO: not working yet, debug and enable
-            //      SplitAlgorithm(pSrcMem, pDestMem, &parm);
-
             // the algorithm supports "pSrcMem" and "pDestMem" pointing to the same memory
             CheckBoundaries((float*)pSrcMem, (float*)pDestMem, &parm);
             RunAlgorithm((float*)pSrcMem, (float*)pDestMem, &parm);
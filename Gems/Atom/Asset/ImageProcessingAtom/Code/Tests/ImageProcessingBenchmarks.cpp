@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <AzCore/AzCore_Traits_Platform.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobManager.h>
+#include <AzCore/Memory/PoolAllocator.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/std/parallel/thread.h>
+
+#include <Atom/ImageProcessing/ImageObject.h>
+#include <Compressors/Compressor.h>
+#include <Processing/ImageConvert.h>
+#include <Processing/ImageToProcess.h>
+#include <Processing/PixelFormatInfo.h>
+
+namespace UnitTest
+{
+    using namespace ImageProcessingAtom;
+
+    // Sets up the job system the image processing runs its jobs on
+    class ImageProcessingBenchmark
+        : public AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp(state);
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown();
+            AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        virtual void internalSetUp([[maybe_unused]] const ::benchmark::State& state)
+        {
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Create();
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Create();
+
+            AZ::JobManagerDesc jobManagerDesc;
+            AZ::JobManagerThreadDesc threadDesc;
+#if AZ_TRAIT_SET_JOB_PROCESSOR_ID
+            threadDesc.m_cpuId = 0; // Don't set processors IDs on windows
+#endif // AZ_TRAIT_SET_JOB_PROCESSOR_ID
+
+            const AZ::u32 numWorkerThreads = AZStd::thread::hardware_concurrency();
+            for (AZ::u32 i = 0; i < numWorkerThreads; ++i)
+            {
+                jobManagerDesc.m_workerThreads.push_back(threadDesc);
+#if AZ_TRAIT_SET_JOB_PROCESSOR_ID
+                threadDesc.m_cpuId++;
+#endif // AZ_TRAIT_SET_JOB_PROCESSOR_ID
+            }
+
+            m_jobManager = aznew AZ::JobManager(jobManagerDesc);
+            m_jobContext = aznew AZ::JobContext(*m_jobManager);
+            AZ::JobContext::SetGlobalContext(m_jobContext);
+        }
+
+        virtual void internalTearDown()
+        {
+            CPixelFormats::DestroyInstance();
+
+            AZ::JobContext::SetGlobalContext(nullptr);
+            delete m_jobContext;
+            delete m_jobManager;
+
+            AZ::AllocatorInstance<AZ::ThreadPoolAllocator>::Destroy();
+            AZ::AllocatorInstance<AZ::PoolAllocator>::Destroy();
+        }
+
+        // a gradient with some high frequencies, so the filters and compressors don't work on constant values
+        static IImageObjectPtr CreateTestImage(AZ::u32 width, AZ::u32 height, AZ::u32 maxMipCount)
+        {
+            IImageObjectPtr image(IImageObject::CreateImage(width, height, maxMipCount, ePixelFormat_R32G32B32A32F));
+            for (AZ::u32 mip = 0; mip < image->GetMipCount(); ++mip)
+            {
+                const AZ::u32 mipWidth = image->GetWidth(mip);
+                const AZ::u32 mipHeight = image->GetHeight(mip);
+
+                AZ::u8* mem;
+                AZ::u32 pitch;
+                image->GetImagePointer(mip, mem, pitch);
+                for (AZ::u32 y = 0; y < mipHeight; ++y)
+                {
+                    float* pixel = reinterpret_cast<float*>(mem + y * pitch);
+                    for (AZ::u32 x = 0; x < mipWidth; ++x, pixel += 4)
+                    {
+                        pixel[0] = static_cast<float>(x) / mipWidth;
+                        pixel[1] = static_cast<float>(y) / mipHeight;
+                        pixel[2] = static_cast<float>((x ^ y) & 1);
+                        pixel[3] = 1.0f;
+                    }
+                }
+            }
+            return image;
+        }
+
+        AZ::JobManager* m_jobManager = nullptr;
+        AZ::JobContext* m_jobContext = nullptr;
+    };
+
+    static void ImageSizes(benchmark::internal::Benchmark* benchmark)
+    {
+        benchmark
+            ->Args({ 256, 256 })
+            ->Args({ 1024, 1024 })
+            ->Args({ 2048, 2048 })
+            ->Args({ 4096, 4096 })
+            ->Args({ 4096, 1024 })
+            ->Args({ 1024, 4096 })
+            ->ArgNames({ "width", "height" })
+            ->Unit(benchmark::kMillisecond)
+            ->UseRealTime();
+    }
+
+    // Generates the first mip of R32G32B32A32F images, which is the format all mip chains are filtered in
+    class ImageFilterBenchmark
+        : public ImageProcessingBenchmark
+    {
+    protected:
+        void internalSetUp(const ::benchmark::State& state) override
+        {
+            ImageProcessingBenchmark::internalSetUp(state);
+
+            const AZ::u32 width = aznumeric_cast<AZ::u32>(state.range(0));
+            const AZ::u32 height = aznumeric_cast<AZ::u32>(state.range(1));
+            m_srcImage = CreateTestImage(width, height, 1);
+            m_dstImage = IImageObjectPtr(IImageObject::CreateImage(width / 2, height / 2, 1, ePixelFormat_R32G32B32A32F));
+        }
+
+        void internalTearDown() override
+        {
+            m_srcImage = nullptr;
+            m_dstImage = nullptr;
+
+            ImageProcessingBenchmark::internalTearDown();
+        }
+
+        void FilterFirstMip(::benchmark::State& state, MipGenType filterType, MipGenEvalType evalType)
+        {
+            for ([[maybe_unused]] auto _ : state)
+            {
+                FilterImage(filterType, evalType, 0, 0, m_srcImage, 0, m_dstImage, 0, nullptr, nullptr);
+            }
+
+            state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(1));
+        }
+
+        IImageObjectPtr m_srcImage;
+        IImageObjectPtr m_dstImage;
+    };
+
+    BENCHMARK_DEFINE_F(ImageFilterBenchmark, FilterImage_Box_Sum)(benchmark::State& state)
+    {
+        FilterFirstMip(state, MipGenType::box, MipGenEvalType::sum);
+    }
+
+    BENCHMARK_DEFINE_F(ImageFilterBenchmark, FilterImage_BlackmanHarris_Sum)(benchmark::State& state)
+    {
+        FilterFirstMip(state, MipGenType::blackmanHarris, MipGenEvalType::sum);
+    }
+
+    BENCHMARK_DEFINE_F(ImageFilterBenchmark, FilterImage_KaiserSinc_Sum)(benchmark::State& state)
+    {
+        FilterFirstMip(state, MipGenType::kaiserSinc, MipGenEvalType::sum);
+    }
+
+    BENCHMARK_DEFINE_F(ImageFilterBenchmark, FilterImage_BlackmanHarris_Max)(benchmark::State& state)
+    {
+        FilterFirstMip(state, MipGenType::blackmanHarris, MipGenEvalType::max);
+    }
+
+    BENCHMARK_DEFINE_F(ImageFilterBenchmark, FilterImage_BlackmanHarris_Min)(benchmark::State& state)
+    {
+        FilterFirstMip(state, MipGenType::blackmanHarris, MipGenEvalType::min);
+    }
+
+    BENCHMARK_REGISTER_F(ImageFilterBenchmark, FilterImage_Box_Sum)->Apply(ImageSizes);
+    BENCHMARK_REGISTER_F(ImageFilterBenchmark, FilterImage_BlackmanHarris_Sum)->Apply(ImageSizes);
+    BENCHMARK_REGISTER_F(ImageFilterBenchmark, FilterImage_KaiserSinc_Sum)->Apply(ImageSizes);
+    BENCHMARK_REGISTER_F(ImageFilterBenchmark, FilterImage_BlackmanHarris_Max)->Apply(ImageSizes);
+    BENCHMARK_REGISTER_F(ImageFilterBenchmark, FilterImage_BlackmanHarris_Min)->Apply(ImageSizes);
+
+    // Compresses a whole mip chain with the compressor that the image builder would pick for the format
+    class ImageCompressorBenchmark
+        : public ImageProcessingBenchmark
+    {
+    protected:
+        void internalSetUp(const ::benchmark::State& state) override
+        {
+            ImageProcessingBenchmark::internalSetUp(state);
+
+            const AZ::u32 size = aznumeric_cast<AZ::u32>(state.range(0));
+            m_srcImage = CreateTestImage(size, size, CPixelFormats::GetInstance().ComputeMaxMipCount(ePixelFormat_R32G32B32A32F, size, size));
+        }
+
+        void internalTearDown() override
+        {
+            m_srcImage = nullptr;
+
+            ImageProcessingBenchmark::internalTearDown();
+        }
+
+        void CompressMipChain(::benchmark::State& state, EPixelFormat compressedFormat)
+        {
+            ICompressorPtr compressor = ICompressor::FindCompressor(compressedFormat, ColorSpace::autoSelect, true);
+            if (!compressor)
+            {
+                state.SkipWithError("No compressor for the format");
+                return;
+            }
+
+            ImageToProcess imageToProcess(m_srcImage);
+            imageToProcess.ConvertFormatUncompressed(compressor->GetSuggestedUncompressedFormat(compressedFormat, ePixelFormat_R8G8B8A8));
+            const IImageObjectPtr uncompressedImage = imageToProcess.Get();
+
+            ICompressor::CompressOption compressOption;
+            compressOption.compressQuality = static_cast<ICompressor::EQuality>(state.range(1));
+
+            for ([[maybe_unused]] auto _ : state)
+            {
+                IImageObjectPtr compressedImage = compressor->CompressImage(uncompressedImage, compressedFormat, &compressOption);
+                benchmark::DoNotOptimize(compressedImage.get());
+            }
+
+            state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+        }
+
+        IImageObjectPtr m_srcImage;
+    };
+
+    static void CompressorSizesAndQualities(benchmark::internal::Benchmark* benchmark)
+    {
+        for (const int64_t size : { 512, 2048 })
+        {
+            for (const int64_t quality : { ICompressor::eQuality_Fast, ICompressor::eQuality_Normal, ICompressor::eQuality_Slow })
+            {
+                benchmark->Args({ size, quality });
+            }
+        }
+        benchmark
+            ->ArgNames({ "size", "quality" })
+            ->Unit(benchmark::kMillisecond)
+            ->UseRealTime();
+    }
+
+    BENCHMARK_DEFINE_F(ImageCompressorBenchmark, CompressImage_BC1)(benchmark::State& state)
+    {
+        CompressMipChain(state, ePixelFormat_BC1);
+    }
+
+    BENCHMARK_DEFINE_F(ImageCompressorBenchmark, CompressImage_BC3)(benchmark::State& state)
+    {
+        CompressMipChain(state, ePixelFormat_BC3);
+    }
+
+    BENCHMARK_DEFINE_F(ImageCompressorBenchmark, CompressImage_BC4)(benchmark::State& state)
+    {
+        CompressMipChain(state, ePixelFormat_BC4);
+    }
+
+    BENCHMARK_DEFINE_F(ImageCompressorBenchmark, CompressImage_BC5)(benchmark::State& state)
+    {
+        CompressMipChain(state, ePixelFormat_BC5);
+    }
+
+    BENCHMARK_DEFINE_F(ImageCompressorBenchmark, CompressImage_BC6UH)(benchmark::State& state)
+    {
+        CompressMipChain(state, ePixelFormat_BC6UH);
+    }
+
+    BENCHMARK_DEFINE_F(ImageCompressorBenchmark, CompressImage_BC7)(benchmark::State& state)
+    {
+        CompressMipChain(state, ePixelFormat_BC7);
+    }
+
+    BENCHMARK_DEFINE_F(ImageCompressorBenchmark, CompressImage_ASTC_4x4)(benchmark::State& state)
+    {
+        CompressMipChain(state, ePixelFormat_ASTC_4x4);
+    }
+
+    BENCHMARK_DEFINE_F(ImageCompressorBenchmark, CompressImage_ASTC_6x6)(benchmark::State& state)
+    {
+        CompressMipChain(state, ePixelFormat_ASTC_6x6);
+    }
+
+    BENCHMARK_REGISTER_F(ImageCompressorBenchmark, CompressImage_BC1)->Apply(CompressorSizesAndQualities);
+    BENCHMARK_REGISTER_F(ImageCompressorBenchmark, CompressImage_BC3)->Apply(CompressorSizesAndQualities);
+    BENCHMARK_REGISTER_F(ImageCompressorBenchmark, CompressImage_BC4)->Apply(CompressorSizesAndQualities);
+    BENCHMARK_REGISTER_F(ImageCompressorBenchmark, CompressImage_BC5)->Apply(CompressorSizesAndQualities);
+    BENCHMARK_REGISTER_F(ImageCompressorBenchmark, CompressImage_BC6UH)->Apply(CompressorSizesAndQualities);
+    BENCHMARK_REGISTER_F(ImageCompressorBenchmark, CompressImage_BC7)->Apply(CompressorSizesAndQualities);
+    BENCHMARK_REGISTER_F(ImageCompressorBenchmark, CompressImage_ASTC_4x4)->Apply(CompressorSizesAndQualities);
+    BENCHMARK_REGISTER_F(ImageCompressorBenchmark, CompressImage_ASTC_6x6)->Apply(CompressorSizesAndQualities);
+} // namespace UnitTest
+
+#endif // HAVE_BENCHMARK
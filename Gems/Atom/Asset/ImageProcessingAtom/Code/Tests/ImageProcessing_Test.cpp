@@ -40,6 +40,8 @@
 #include <ImageLoader/ImageLoaders.h>
 
 #include <Compressors/Compressor.h>
+#include <Compressors/CTSquisher.h>
+#include <Compressors/ISPCTextureCompressor.h>
 
 #include <Converters/Cubemap.h>
 
@@ -806,6 +808,59 @@ namespace UnitTest
             }
         }
     }
+
+
+    TEST_F(ImageProcessingTest, TestCompressTiles_SameOutputAsSingleTilePerMip)
+    {
+        //sizes with odd block counts, and mip chains which end in a single row of blocks
+        const AZStd::pair<AZ::u32, AZ::u32> imageSizes[] = { {208, 112}, {256, 64}, {60, 36} };
+
+        struct CompressorAndFormat
+        {
+            ICompressorPtr compressor;
+            EPixelFormat format;
+        };
+        const CompressorAndFormat compressorAndFormats[] = {
+            { ICompressorPtr(new ISPCCompressor()), ePixelFormat_BC7 },
+            { ICompressorPtr(new CTSquisher()), ePixelFormat_BC1 },
+            { ICompressorPtr(new CTSquisher()), ePixelFormat_BC3 } };
+
+        for (const auto& [width, height] : imageSizes)
+        {
+            //fill every mip with noise so neighboring blocks compress differently
+            IImageObjectPtr srcImage(IImageObject::CreateImage(width, height, (std::numeric_limits<AZ::u32>::max)(), ePixelFormat_R8G8B8A8));
+            AZ::u32 seed = width * height;
+            for (AZ::u32 mip = 0; mip < srcImage->GetMipCount(); ++mip)
+            {
+                AZ::u8* mem = nullptr;
+                AZ::u32 pitch = 0;
+                srcImage->GetImagePointer(mip, mem, pitch);
+                for (AZ::u32 i = 0; i < srcImage->GetMipBufSize(mip); ++i)
+                {
+                    seed = seed * 1664525u + 1013904223u;
+                    mem[i] = static_cast<AZ::u8>(seed >> 24);
+                }
+            }
+
+            for (const CompressorAndFormat& compressorAndFormat : compressorAndFormats)
+            {
+                //split the mips into as many tiles as the thread count allows
+                ICompressor::CompressOption tiledOption;
+                tiledOption.compressQuality = ICompressor::eQuality_Fast;
+                tiledOption.minBlocksPerTile = 1;
+                IImageObjectPtr tiledImage = compressorAndFormat.compressor->CompressImage(srcImage, compressorAndFormat.format, &tiledOption);
+
+                ICompressor::CompressOption singleTileOption = tiledOption;
+                singleTileOption.minBlocksPerTile = (std::numeric_limits<AZ::u32>::max)();
+                IImageObjectPtr singleTileImage = compressorAndFormat.compressor->CompressImage(srcImage, compressorAndFormat.format, &singleTileOption);
+
+                ASSERT_TRUE(tiledImage);
+                ASSERT_TRUE(singleTileImage);
+                EXPECT_TRUE(tiledImage->CompareImage(singleTileImage))
+                    << compressorAndFormat.compressor->GetName() << " " << width << "x" << height;
+            }
+        }
+    }
         
     TEST_F(ImageProcessingTest, Test_ConvertAllAstc_Success)
     {
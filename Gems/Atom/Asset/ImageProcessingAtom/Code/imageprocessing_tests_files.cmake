@@ -7,5 +7,6 @@
 #
 
 set(FILES
+    Tests/ImageProcessingBenchmarks.cpp
     Tests/ImageProcessing_Test.cpp
 )
@@ -38,17 +38,25 @@
 #include <AzFramework/Platform/PlatformDefaults.h>
 
 #include <AzCore/Asset/AssetManager.h>
+#include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/JSON/document.h>
 #include <AzCore/IO/FileIO.h>
 #include <AzCore/IO/IOUtils.h>
 #include <AzCore/IO/SystemFile.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Settings/SettingsRegistry.h>
 #include <AzCore/std/algorithm.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/thread.h>
 #include <AzCore/std/string/string.h>
 #include <AzCore/std/sort.h>
 #include <AzCore/Serialization/Json/JsonSerialization.h>
 
 #include "ShaderAssetBuilder.h"
 #include "ShaderBuilderUtility.h"
+#include "ShaderVariantCompileCache.h"
 #include "SrgLayoutUtility.h"
 #include "AzslData.h"
 #include "AzslCompiler.h"
@@ -629,6 +637,94 @@ namespace AZ
             return hlslSourceOutcome.TakeValue();
         }
 
+        AZStd::shared_ptr<const ShaderVariantAssetBuilder::SupervariantBuildData> ShaderVariantAssetBuilder::GetSupervariantBuildData(
+            RHI::ShaderPlatformInterface* shaderPlatformInterface, const AssetBuilderSDK::PlatformInfo& platformInfo,
+            const AzslCompiler& azslCompiler, const AZStd::string& shaderSourceFileFullPath,
+            const RPI::SupervariantIndex supervariantIndex, const bool platformUsesRegisterSpaces) const
+        {
+            auto hlslSourcePathOutcome = ShaderBuilderUtility::ObtainBuildArtifactPathFromShaderAssetBuilder(
+                shaderPlatformInterface->GetAPIUniqueIndex(), platformInfo.m_identifier, shaderSourceFileFullPath, supervariantIndex.GetIndex(),
+                AZ::RPI::ShaderAssetSubId::GeneratedHlslSource);
+            if (!hlslSourcePathOutcome.IsSuccess())
+            {
+                AZ_Error(ShaderVariantAssetBuilderName, false, "%s", hlslSourcePathOutcome.GetError().c_str());
+                return nullptr;
+            }
+            const AZ::u64 hlslModificationTime = IO::FileIOBase::GetInstance()->ModificationTime(hlslSourcePathOutcome.GetValue().c_str());
+
+            const AZStd::string buildDataKey = AZStd::string::format(
+                "%s_%u_%u", platformInfo.m_identifier.c_str(), shaderPlatformInterface->GetAPIUniqueIndex(), supervariantIndex.GetIndex());
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_supervariantBuildDataMutex);
+                if (m_supervariantBuildDataShaderPath != shaderSourceFileFullPath)
+                {
+                    m_supervariantBuildData.clear();
+                    m_supervariantBuildDataShaderPath = shaderSourceFileFullPath;
+                }
+
+                auto buildDataIt = m_supervariantBuildData.find(buildDataKey);
+                if (buildDataIt != m_supervariantBuildData.end() && buildDataIt->second->m_hlslModificationTime == hlslModificationTime)
+                {
+                    return buildDataIt->second;
+                }
+            }
+
+            auto buildData = AZStd::make_shared<SupervariantBuildData>();
+            buildData->m_hlslModificationTime = hlslModificationTime;
+
+            // 1- ShaderOptionsGroupLayout
+            buildData->m_shaderOptionGroupLayout = LoadShaderOptionsGroupLayoutFromShaderAssetBuilder(
+                shaderPlatformInterface, platformInfo, azslCompiler, shaderSourceFileFullPath, supervariantIndex);
+            if (!buildData->m_shaderOptionGroupLayout)
+            {
+                return nullptr;
+            }
+
+            // 2- entryFunctions, only validated, the entry points come from the .shader file.
+            AzslFunctions azslFunctions;
+            LoadShaderFunctionsFromShaderAssetBuilder(
+                shaderPlatformInterface, platformInfo, azslCompiler, shaderSourceFileFullPath, supervariantIndex, azslFunctions);
+            if (azslFunctions.empty())
+            {
+                return nullptr;
+            }
+
+            // 3- hlslCode
+            buildData->m_hlslSourceContent = LoadHlslFileFromShaderAssetBuilder(
+                shaderPlatformInterface, platformInfo, shaderSourceFileFullPath, supervariantIndex, buildData->m_hlslSourcePath);
+            if (buildData->m_hlslSourceContent.empty() || buildData->m_hlslSourcePath.empty())
+            {
+                return nullptr;
+            }
+
+            // 4- SRG layouts, for the platforms that build the pipeline layout before compiling.
+            if (shaderPlatformInterface->VariantCompilationRequiresSrgLayoutData())
+            {
+                if (!LoadSrgLayoutListFromShaderAssetBuilder(
+                        shaderPlatformInterface, platformInfo, azslCompiler, shaderSourceFileFullPath, supervariantIndex,
+                        platformUsesRegisterSpaces, buildData->m_srgLayoutList, buildData->m_rootConstantData))
+                {
+                    return nullptr;
+                }
+
+                if (!LoadBindingDependenciesFromShaderAssetBuilder(
+                        shaderPlatformInterface, platformInfo, azslCompiler, shaderSourceFileFullPath, supervariantIndex,
+                        buildData->m_bindingDependencies))
+                {
+                    return nullptr;
+                }
+            }
+
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(m_supervariantBuildDataMutex);
+                if (m_supervariantBuildDataShaderPath == shaderSourceFileFullPath)
+                {
+                    m_supervariantBuildData[buildDataKey] = buildData;
+                }
+            }
+            return buildData;
+        }
+
         void ShaderVariantAssetBuilder::ProcessShaderVariantTreeJob(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response) const
         {
             AZStd::string variantListFullPath;
@@ -774,14 +870,41 @@ namespace AZ
             // to all the supervariants of this shader.
             buildOptions.m_compilerArguments.Merge(shaderSourceDescriptor.m_compiler);
 
-            //! The ShaderOptionGroupLayout is common across all RHIs & Supervariants
-            RPI::Ptr<RPI::ShaderOptionGroupLayout> shaderOptionGroupLayout = nullptr;
+            MapOfStringToStageType shaderEntryPoints;
+            if (shaderSourceDescriptor.m_programSettings.m_entryPoints.empty())
+            {
+                AZ_Error(ShaderVariantAssetBuilderName, false,  "ProgramSettings must specify entry points.");
+                response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
+                return;
+            }
+
+            for (const auto& entryPoint : shaderSourceDescriptor.m_programSettings.m_entryPoints)
+            {
+                shaderEntryPoints[entryPoint.m_name] = entryPoint.m_type;
+            }
 
-            // Generate shaders for each of those ShaderPlatformInterfaces.
-            for (RHI::ShaderPlatformInterface* shaderPlatformInterface : platformInterfaces)
+            struct PlatformInterfaceResult
             {
+                AZStd::vector<AssetBuilderSDK::JobProduct> m_outputProducts;
+                AssetBuilderSDK::ProcessJobResultCode m_resultCode = AssetBuilderSDK::ProcessJobResult_Success;
+            };
+            AZStd::vector<PlatformInterfaceResult> platformInterfaceResults(platformInterfaces.size());
+
+            // Generate shaders for one of the ShaderPlatformInterfaces.
+            // Some platforms keep the SRG layouts of the last pipeline layout they built for the compilation that follows,
+            // so the supervariants of one ShaderPlatformInterface are always processed in order, by the same thread.
+            auto processPlatformInterface = [&](size_t platformInterfaceIndex)
+            {
+                RHI::ShaderPlatformInterface* shaderPlatformInterface = platformInterfaces[platformInterfaceIndex];
+                PlatformInterfaceResult& result = platformInterfaceResults[platformInterfaceIndex];
+
                 AZ_TraceContext("ShaderPlatformInterface", shaderPlatformInterface->GetAPIName().GetCStr());
 
+                AZStd::string azslcCompilerParameters =
+                    shaderPlatformInterface->GetAzslCompilerParameters(buildOptions.m_compilerArguments);
+                const bool platformUsesRegisterSpaces =
+                    (AzFramework::StringFunc::Find(azslcCompilerParameters, "--use-spaces") != AZStd::string::npos);
+
                 // Loop through all the Supervariants.
                 uint32_t supervariantIndexCounter = 0;
                 for (const auto& supervariantInfo : supervariantList)
@@ -792,7 +915,7 @@ namespace AZ
                     // the shader variant data.
                     if (jobCancelListener.IsCancelled())
                     {
-                        response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Cancelled;
+                        result.m_resultCode = AssetBuilderSDK::ProcessJobResult_Cancelled;
                         return;
                     }
 
@@ -802,96 +925,32 @@ namespace AZ
                         shaderStemNamePrefix += supervariantInfo.m_name.GetStringView();
                     }
 
-                    // We need these additional pieces of information To build a shader variant asset:
-                    // 1- ShaderOptionsGroupLayout (Need to load it once, because it's the same acrosss all supervariants +  RHIs)
-                    // 2- entryFunctions
-                    // 3- hlsl code.
-
-                    // 1- ShaderOptionsGroupLayout
-                    if (!shaderOptionGroupLayout)
-                    {
-                        shaderOptionGroupLayout =
-                            LoadShaderOptionsGroupLayoutFromShaderAssetBuilder(
-                                shaderPlatformInterface, request.m_platformInfo, azslc, shaderSourceFileFullPath, supervariantIndex);
-                        if (!shaderOptionGroupLayout)
-                        {
-                            response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
-                            return;
-                        }
-                    }
-
-                    // 2- entryFunctions.
-                    AzslFunctions azslFunctions;
-                    LoadShaderFunctionsFromShaderAssetBuilder(
-                        shaderPlatformInterface, request.m_platformInfo, azslc, shaderSourceFileFullPath, supervariantIndex,  azslFunctions);
-                    if (azslFunctions.empty())
+                    // The ShaderOptionsGroupLayout, the hlsl code and the SRG layouts are the same for every variant
+                    // of the shader, so they are only loaded for the first variant job.
+                    AZStd::shared_ptr<const SupervariantBuildData> buildData = GetSupervariantBuildData(
+                        shaderPlatformInterface, request.m_platformInfo, azslc, shaderSourceFileFullPath, supervariantIndex,
+                        platformUsesRegisterSpaces);
+                    if (!buildData)
                     {
-                        response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
+                        result.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
                         return;
                     }
-                    MapOfStringToStageType shaderEntryPoints;
-                    if (shaderSourceDescriptor.m_programSettings.m_entryPoints.empty())
-                    {
-                        AZ_Error(ShaderVariantAssetBuilderName, false,  "ProgramSettings must specify entry points.");
-                        response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
-                        return;
-                    }
-
-                    for (const auto& entryPoint : shaderSourceDescriptor.m_programSettings.m_entryPoints)
-                    {
-                        shaderEntryPoints[entryPoint.m_name] = entryPoint.m_type;
-                    }
 
-                    // 3- hlslCode
-                    AZStd::string hlslSourcePath;
-                    AZStd::string hlslCode = LoadHlslFileFromShaderAssetBuilder(
-                        shaderPlatformInterface, request.m_platformInfo, shaderSourceFileFullPath, supervariantIndex, hlslSourcePath);
-                    if (hlslCode.empty() || hlslSourcePath.empty())
-                    {
-                        response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
-                        return;
-                    }
-                    
                     //! It is important to keep this refcounted pointer outside of the if block to prevent it from being destroyed.
                     RHI::Ptr<RHI::PipelineLayoutDescriptor> pipelineLayoutDescriptor;
                     if (shaderPlatformInterface->VariantCompilationRequiresSrgLayoutData())
                     {
-                        AZStd::string azslcCompilerParameters =
-                            shaderPlatformInterface->GetAzslCompilerParameters(buildOptions.m_compilerArguments);
-                        const bool platformUsesRegisterSpaces =
-                            (AzFramework::StringFunc::Find(azslcCompilerParameters, "--use-spaces") != AZStd::string::npos);
-                    
-                        RPI::ShaderResourceGroupLayoutList srgLayoutList;
-                        RootConstantData rootConstantData;
-                        if (!LoadSrgLayoutListFromShaderAssetBuilder(
-                            shaderPlatformInterface, request.m_platformInfo, azslc, shaderSourceFileFullPath, supervariantIndex,
-                            platformUsesRegisterSpaces,
-                            srgLayoutList,
-                            rootConstantData))
-                        {
-                            response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
-                            return;
-                        }
-                        
-                        BindingDependencies bindingDependencies;
-                        if (!LoadBindingDependenciesFromShaderAssetBuilder(
-                            shaderPlatformInterface, request.m_platformInfo, azslc, shaderSourceFileFullPath, supervariantIndex,
-                            bindingDependencies))
-                        {
-                            response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
-                            return;
-                        }
-                        
+                        BindingDependencies bindingDependencies = buildData->m_bindingDependencies;
                         pipelineLayoutDescriptor =
                             ShaderBuilderUtility::BuildPipelineLayoutDescriptorForApi(
-                                ShaderVariantAssetBuilderName, srgLayoutList, shaderEntryPoints, buildOptions.m_compilerArguments, rootConstantData,
-                                shaderPlatformInterface, bindingDependencies);
+                                ShaderVariantAssetBuilderName, buildData->m_srgLayoutList, shaderEntryPoints, buildOptions.m_compilerArguments,
+                                buildData->m_rootConstantData, shaderPlatformInterface, bindingDependencies);
                         if (!pipelineLayoutDescriptor)
                         {
                             AZ_Error(
                                 ShaderVariantAssetBuilderName, false, "Failed to build pipeline layout descriptor for api=[%s]",
                                 shaderPlatformInterface->GetAPIName().GetCStr());
-                            response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
+                            result.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
                             return;
                         }
                     }
@@ -902,11 +961,11 @@ namespace AZ
                         *shaderPlatformInterface, request.m_platformInfo, buildOptions.m_compilerArguments, request.m_tempDirPath,
                         shaderVariantAssetBuildTimestamp,
                         shaderSourceDescriptor,
-                        *shaderOptionGroupLayout.get(),
+                        *buildData->m_shaderOptionGroupLayout.get(),
                         shaderEntryPoints,
                         Uuid::CreateRandom(),
                         shaderStemNamePrefix,
-                        hlslSourcePath, hlslCode
+                        buildData->m_hlslSourcePath, buildData->m_hlslSourceContent
                     };
 
                     AZStd::optional<RHI::ShaderPlatformInterface::ByProducts> outputByproducts;
@@ -914,7 +973,7 @@ namespace AZ
                     if (!shaderVariantAssetOutcome.IsSuccess())
                     {
                         AZ_Error(ShaderVariantAssetBuilderName, false, "%s\n", shaderVariantAssetOutcome.GetError().c_str());
-                        response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
+                        result.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
                         return;
                     }
                     Data::Asset<RPI::ShaderVariantAsset> shaderVariantAsset = shaderVariantAssetOutcome.TakeValue();
@@ -929,10 +988,10 @@ namespace AZ
                             request.m_tempDirPath, *shaderPlatformInterface, productSubID,
                             assetProduct))
                     {
-                        response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
+                        result.m_resultCode = AssetBuilderSDK::ProcessJobResult_Failed;
                         return;
                     }
-                    response.m_outputProducts.push_back(assetProduct);
+                    result.m_outputProducts.push_back(assetProduct);
 
                     if (outputByproducts)
                     {
@@ -946,12 +1005,64 @@ namespace AZ
                             jobProduct.m_productSubID = RPI::ShaderVariantAsset::MakeAssetProductSubId(
                                 shaderPlatformInterface->GetAPIUniqueIndex(), supervariantIndex.GetIndex(), shaderVariantAsset->GetStableId(),
                                 subProductType++);
-                            response.m_outputProducts.push_back(AZStd::move(jobProduct));
+                            result.m_outputProducts.push_back(AZStd::move(jobProduct));
                         }
                     }
                     supervariantIndexCounter++;
                 } // End of supervariant for block
-                
+            };
+
+            // Each ShaderPlatformInterface is compiled by its own job, within the thread budget. Shader compilers run as
+            // separate processes, so this mostly overlaps their runs.
+            AZ::u64 threadBudget = AZStd::thread::hardware_concurrency();
+            if (auto settingsRegistry = AZ::SettingsRegistry::Get())
+            {
+                settingsRegistry->Get(threadBudget, VariantCompilationThreadBudgetRegistryKey);
+            }
+            const size_t jobCount = AZStd::clamp<size_t>(aznumeric_cast<size_t>(threadBudget), 1, platformInterfaces.size());
+            if (jobCount == 1)
+            {
+                for (size_t platformInterfaceIndex = 0; platformInterfaceIndex < platformInterfaces.size(); ++platformInterfaceIndex)
+                {
+                    processPlatformInterface(platformInterfaceIndex);
+                }
+            }
+            else
+            {
+                AZStd::atomic<size_t> nextPlatformInterfaceIndex{ 0 };
+                AZ::JobCompletion jobCompletion;
+                for (size_t jobIndex = 0; jobIndex < jobCount; ++jobIndex)
+                {
+                    AZ::Job* compileJob = AZ::CreateJobFunction([&]()
+                        {
+                            for (size_t platformInterfaceIndex = nextPlatformInterfaceIndex++; platformInterfaceIndex < platformInterfaces.size();
+                                 platformInterfaceIndex = nextPlatformInterfaceIndex++)
+                            {
+                                processPlatformInterface(platformInterfaceIndex);
+                            }
+                        }, true, nullptr);
+                    compileJob->SetDependent(&jobCompletion);
+                    compileJob->Start();
+                }
+                jobCompletion.StartAndWaitForCompletion();
+            }
+
+            // The products are reported in the order of the ShaderPlatformInterfaces, whichever job finished first.
+            for (size_t platformInterfaceIndex = 0; platformInterfaceIndex < platformInterfaces.size(); ++platformInterfaceIndex)
+            {
+                PlatformInterfaceResult& result = platformInterfaceResults[platformInterfaceIndex];
+                if (result.m_resultCode != AssetBuilderSDK::ProcessJobResult_Success)
+                {
+                    if (result.m_resultCode == AssetBuilderSDK::ProcessJobResult_Failed)
+                    {
+                        AZ_Error(ShaderVariantAssetBuilderName, false, "Failed to build the shader variant for api=[%s]",
+                            platformInterfaces[platformInterfaceIndex]->GetAPIName().GetCStr());
+                    }
+                    response.m_resultCode = result.m_resultCode;
+                    return;
+                }
+                response.m_outputProducts.insert(
+                    response.m_outputProducts.end(), result.m_outputProducts.begin(), result.m_outputProducts.end());
             }
 
             response.m_resultCode = AssetBuilderSDK::ProcessJobResult_Success;
@@ -1048,13 +1159,16 @@ namespace AZ
             }
 
             AZStd::string variantShaderSourcePath;
+            AZStd::string variantShaderSourceString;
+            AZStd::string_view variantShaderSource = creationContext.m_hlslSourceContent;
             // Check if we need to prepend any code prefix
             if (!hlslCodeToPrependForVariant.empty())
             {
                 // Prepend any shader code prefix that we should apply to this variant
                 // and save it back to a file.
-                AZStd::string variantShaderSourceString(hlslCodeToPrependForVariant);
+                variantShaderSourceString = hlslCodeToPrependForVariant;
                 variantShaderSourceString += creationContext.m_hlslSourceContent;
+                variantShaderSource = variantShaderSourceString;
 
                 AZStd::string shaderAssetName = AZStd::string::format(
                     "%s_%s_%u.hlsl", creationContext.m_shaderStemNamePrefix.c_str(),
@@ -1099,6 +1213,19 @@ namespace AZ
 
                 auto assetBuilderShaderType = ShaderBuilderUtility::ToAssetBuilderShaderType(shaderStageType);
 
+                // Variants that compile the same hlsl, in a previous build or in this one, share the compiled function.
+                const AZStd::string compileCacheKey = ShaderVariantCompileCache::MakeKey(
+                    creationContext.m_shaderPlatformInterface, creationContext.m_platformInfo, variantShaderSource, shaderEntryName,
+                    assetBuilderShaderType, creationContext.m_shaderCompilerArguments);
+                RHI::Ptr<RHI::ShaderStageFunction> cachedShaderStageFunction =
+                    ShaderVariantCompileCache::Load(creationContext.m_shaderPlatformInterface, compileCacheKey);
+                if (cachedShaderStageFunction)
+                {
+                    variantCreator.SetShaderFunction(ToRHIShaderStage(assetBuilderShaderType), cachedShaderStageFunction);
+                    AZ_TracePrintf(ShaderVariantAssetBuilderName, "Reused shader function compiled from identical source [%s].", compileCacheKey.c_str());
+                    continue;
+                }
+
                 // Compile HLSL to the platform specific shader.
                 RHI::ShaderPlatformInterface::StageDescriptor descriptor;
                 bool shaderWasCompiled = creationContext.m_shaderPlatformInterface.CompilePlatformInternal(
@@ -1114,6 +1241,10 @@ namespace AZ
 
                 RHI::Ptr<RHI::ShaderStageFunction> shaderStageFunction = creationContext.m_shaderPlatformInterface.CreateShaderStageFunction(descriptor);
                 variantCreator.SetShaderFunction(ToRHIShaderStage(assetBuilderShaderType), shaderStageFunction);
+                if (shaderStageFunction)
+                {
+                    ShaderVariantCompileCache::Store(creationContext.m_shaderPlatformInterface, compileCacheKey, *shaderStageFunction);
+                }
 
                 if (descriptor.m_byProducts.m_dynamicBranchCount != AZ::RHI::ShaderPlatformInterface::ByProducts::UnknownDynamicBranchCount)
                 {
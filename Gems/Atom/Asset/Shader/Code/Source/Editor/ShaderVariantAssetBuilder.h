@@ -11,6 +11,9 @@
 #include <AzCore/base.h>
 #include <AssetBuilderSDK/AssetBuilderBusses.h>
 #include <AssetBuilderSDK/AssetBuilderSDK.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/shared_ptr.h>
 
 #include <Atom/RHI.Reflect/Base.h>
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
@@ -56,6 +59,10 @@ namespace AZ
 
             static constexpr char ShaderVariantAssetBuilderJobKey[] = "Shader Variant Asset";
 
+            //! Maximum number of RHIs whose shader variants are compiled at the same time within one job.
+            //! Defaults to the number of hardware threads.
+            static constexpr char VariantCompilationThreadBudgetRegistryKey[] = "/O3DE/Atom/Shaders/BuildVariantsThreadBudget";
+
             ShaderVariantAssetBuilder() = default;
             ~ShaderVariantAssetBuilder() = default;
 
@@ -87,6 +94,22 @@ namespace AZ
             static constexpr uint32_t ShaderVariantJobVariantParam = 3;
             static constexpr uint32_t ShouldExitEarlyFromProcessJobParam = 4;
 
+            //! What ProcessShaderVariantJob loads from the ShaderAssetBuilder products to compile variants of one
+            //! supervariant for one RHI. It is the same for every variant of the shader.
+            struct SupervariantBuildData
+            {
+                //! Modification time of the hlsl product. All the products of a supervariant are written by the same
+                //! ShaderAssetBuilder job, so this tells whether the data is still up to date.
+                AZ::u64 m_hlslModificationTime = 0;
+                RPI::Ptr<RPI::ShaderOptionGroupLayout> m_shaderOptionGroupLayout;
+                AZStd::string m_hlslSourcePath;
+                AZStd::string m_hlslSourceContent;
+                //! Only loaded for platforms that need the SRG layouts to compile variants.
+                RPI::ShaderResourceGroupLayoutList m_srgLayoutList;
+                RootConstantData m_rootConstantData;
+                BindingDependencies m_bindingDependencies;
+            };
+
             //! Called from ProcessJob when the job is supposed to create a ShaderVariantTreeAsset.
             void ProcessShaderVariantTreeJob(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response) const;
 
@@ -94,9 +117,22 @@ namespace AZ
             //! supported by the platform.
             void ProcessShaderVariantJob(const AssetBuilderSDK::ProcessJobRequest& request, AssetBuilderSDK::ProcessJobResponse& response) const;
 
+            //! Returns the build data of a supervariant, loading it from the ShaderAssetBuilder products when it is not
+            //! cached yet or the products changed. Returns nullptr if the products could not be loaded.
+            AZStd::shared_ptr<const SupervariantBuildData> GetSupervariantBuildData(
+                RHI::ShaderPlatformInterface* shaderPlatformInterface, const AssetBuilderSDK::PlatformInfo& platformInfo,
+                const AzslCompiler& azslCompiler, const AZStd::string& shaderSourceFileFullPath,
+                const RPI::SupervariantIndex supervariantIndex, const bool platformUsesRegisterSpaces) const;
+
             static AZStd::string GetShaderVariantTreeAssetJobKey() { return AZStd::string::format("%s_varianttree", ShaderVariantAssetBuilderJobKey); }
             static AZStd::string GetShaderVariantAssetJobKey(RPI::ShaderVariantStableId variantStableId) { return AZStd::string::format("%s_variant_%u", ShaderVariantAssetBuilderJobKey, variantStableId.GetIndex()); }
 
+            //! The asset processor hands the variant jobs of a shader to the builder one after the other, so the build
+            //! data is kept for the shader of the last job only.
+            mutable AZStd::mutex m_supervariantBuildDataMutex;
+            mutable AZStd::string m_supervariantBuildDataShaderPath;
+            mutable AZStd::unordered_map<AZStd::string, AZStd::shared_ptr<const SupervariantBuildData>> m_supervariantBuildData;
+
         };
 
     } // ShaderBuilder
@@ -0,0 +1,315 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ShaderVariantCompileCache.h"
+
+#include <Atom/RHI.Edit/ShaderCompilerArguments.h>
+#include <Atom/RHI.Edit/Utils.h>
+
+#include <AzCore/Component/ComponentApplicationBus.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/IO/Path/Path.h>
+#include <AzCore/IO/SystemFile.h>
+#include <AzCore/Math/Sha1.h>
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/Serialization/Utils.h>
+#include <AzCore/Settings/SettingsRegistry.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace ShaderBuilder
+    {
+        namespace ShaderVariantCompileCache
+        {
+            static constexpr char ShaderVariantCompileCacheName[] = "ShaderVariantCompileCache";
+
+            //! Bump this version when the content of the cache files or the way the keys are made changes.
+            static constexpr uint32_t CacheVersion = 2;
+
+            static constexpr char CacheFolder[] = "@user@/Atom/ShaderVariantCache";
+
+            static void HashString(Sha1& sha, AZStd::string_view value)
+            {
+                // The size goes first so consecutive strings can't shift into each other
+                const uint64_t size = value.size();
+                sha.ProcessBytes(&size, sizeof(size));
+                sha.ProcessBytes(value.data(), value.size());
+            }
+
+            template<typename T>
+            static void HashValue(Sha1& sha, const T& value)
+            {
+                static_assert(AZStd::is_trivially_copyable_v<T>, "Only plain values can be hashed by their bytes");
+                sha.ProcessBytes(&value, sizeof(value));
+            }
+
+            static AZStd::optional<IO::FixedMaxPath> ResolveCompilerFilePath(AZStd::string_view compilerFile)
+            {
+                IO::FixedMaxPath compilerFilePath(compilerFile);
+                if (compilerFilePath.IsRelative())
+                {
+                    const char* executableFolder = nullptr;
+                    ComponentApplicationBus::BroadcastResult(executableFolder, &ComponentApplicationBus::Events::GetExecutableFolder);
+                    if (!executableFolder)
+                    {
+                        return AZStd::nullopt;
+                    }
+                    compilerFilePath = IO::FixedMaxPath(executableFolder) / compilerFile;
+                }
+                return compilerFilePath;
+            }
+
+            //! Returns false if one of the compiler files can't be found, the compilation is then not cached.
+            static bool HashCompilerFiles(
+                Sha1& sha, const RHI::ShaderPlatformInterface& shaderPlatformInterface, const AssetBuilderSDK::PlatformInfo& platformInfo)
+            {
+                const RHI::ShaderPlatformInterface::CompilerFiles compilerFiles = shaderPlatformInterface.GetCompilerFiles(platformInfo);
+                if (compilerFiles.m_executables.empty())
+                {
+                    return false;
+                }
+
+                // The executables are large, so they are told apart by their size and modification time rather than their content.
+                // Replacing a compiler, like a 3rdParty package upgrade does, changes both.
+                for (const AZStd::string& executable : compilerFiles.m_executables)
+                {
+                    const AZStd::optional<IO::FixedMaxPath> executablePath = ResolveCompilerFilePath(executable);
+                    if (!executablePath || !IO::SystemFile::Exists(executablePath->c_str()))
+                    {
+                        return false;
+                    }
+                    HashString(sha, executablePath->Native());
+                    HashValue(sha, static_cast<uint64_t>(IO::SystemFile::Length(executablePath->c_str())));
+                    HashValue(sha, static_cast<uint64_t>(IO::SystemFile::ModificationTime(executablePath->c_str())));
+                }
+
+                for (const AZStd::string& header : compilerFiles.m_prependedHeaders)
+                {
+                    const AZStd::optional<IO::FixedMaxPath> headerPath = ResolveCompilerFilePath(header);
+                    if (!headerPath)
+                    {
+                        return false;
+                    }
+                    const Outcome<AZStd::string, AZStd::string> headerContent = RHI::LoadFileString(headerPath->c_str());
+                    if (!headerContent.IsSuccess())
+                    {
+                        return false;
+                    }
+                    HashString(sha, headerContent.GetValue());
+                }
+
+                return true;
+            }
+
+            static AZStd::optional<IO::FixedMaxPath> GetCacheFolderPath()
+            {
+                IO::FileIOBase* fileIO = IO::FileIOBase::GetInstance();
+                if (!fileIO || !fileIO->GetAlias("@user@"))
+                {
+                    return AZStd::nullopt;
+                }
+
+                IO::FixedMaxPath cacheFolderPath;
+                if (!fileIO->ResolvePath(cacheFolderPath, IO::PathView(CacheFolder)))
+                {
+                    return AZStd::nullopt;
+                }
+                return cacheFolderPath;
+            }
+
+            static AZStd::optional<IO::FixedMaxPath> GetCacheFilePath(const RHI::ShaderPlatformInterface& shaderPlatformInterface, const AZStd::string& key)
+            {
+                AZStd::optional<IO::FixedMaxPath> cacheFilePath = GetCacheFolderPath();
+                if (!cacheFilePath)
+                {
+                    return AZStd::nullopt;
+                }
+
+                // The first two characters of the key split the files over subfolders, so no folder gets too large to list
+                *cacheFilePath /= shaderPlatformInterface.GetAPIName().GetStringView();
+                *cacheFilePath /= AZStd::string_view(key).substr(0, 2);
+                *cacheFilePath /= AZStd::string::format("%s.bin", key.c_str());
+                return cacheFilePath;
+            }
+
+            AZStd::string MakeKey(
+                const RHI::ShaderPlatformInterface& shaderPlatformInterface, const AssetBuilderSDK::PlatformInfo& platformInfo,
+                AZStd::string_view hlslSource, AZStd::string_view entryFunctionName, RHI::ShaderHardwareStage shaderStage,
+                const RHI::ShaderCompilerArguments& shaderCompilerArguments)
+            {
+                if (shaderPlatformInterface.BuildHasDebugInfo(shaderCompilerArguments))
+                {
+                    return {};
+                }
+
+                Sha1 sha;
+                HashValue(sha, CacheVersion);
+                HashString(sha, platformInfo.m_identifier);
+                HashString(sha, shaderPlatformInterface.GetAPIName().GetStringView());
+                HashValue(sha, shaderPlatformInterface.GetAPIUniqueIndex());
+                if (!HashCompilerFiles(sha, shaderPlatformInterface, platformInfo))
+                {
+                    return {};
+                }
+                HashString(sha, entryFunctionName);
+                HashValue(sha, shaderStage);
+
+                HashValue(sha, shaderCompilerArguments.m_disableWarnings);
+                HashValue(sha, shaderCompilerArguments.m_warningAsError);
+                HashValue(sha, shaderCompilerArguments.m_disableOptimizations);
+                HashValue(sha, shaderCompilerArguments.m_optimizationLevel);
+                HashValue(sha, shaderCompilerArguments.m_defaultMatrixOrder);
+                HashString(sha, shaderCompilerArguments.m_dxcAdditionalFreeArguments);
+
+                // The hlsl produced by the ShaderAssetBuilder declares the shader resource groups as well, so it also
+                // covers the SRG layouts that some platforms need at compile time.
+                HashString(sha, hlslSource);
+
+                AZ::u32 digest[5];
+                sha.GetDigest(digest);
+                return AZStd::string::format("%08x%08x%08x%08x%08x", digest[0], digest[1], digest[2], digest[3], digest[4]);
+            }
+
+            RHI::Ptr<RHI::ShaderStageFunction> Load(
+                const RHI::ShaderPlatformInterface& shaderPlatformInterface, const AZStd::string& key, SerializeContext* serializeContext)
+            {
+                if (key.empty())
+                {
+                    return nullptr;
+                }
+
+                const AZStd::optional<IO::FixedMaxPath> cacheFilePath = GetCacheFilePath(shaderPlatformInterface, key);
+                if (!cacheFilePath || !IO::FileIOBase::GetInstance()->Exists(cacheFilePath->c_str()))
+                {
+                    return nullptr;
+                }
+
+                // A file that can't be read back is treated like a missing one, it will be overwritten after the compilation.
+                return RHI::Ptr<RHI::ShaderStageFunction>(Utils::LoadObjectFromFile<RHI::ShaderStageFunction>(cacheFilePath->c_str(), serializeContext));
+            }
+
+            void Store(
+                const RHI::ShaderPlatformInterface& shaderPlatformInterface, const AZStd::string& key,
+                const RHI::ShaderStageFunction& shaderStageFunction, SerializeContext* serializeContext)
+            {
+                if (key.empty())
+                {
+                    return;
+                }
+
+                // Builder processes come and go, so pruning once per process keeps the cache close to its limit
+                static AZStd::atomic_bool s_pruned{ false };
+                if (!s_pruned.exchange(true))
+                {
+                    AZ::u64 sizeLimitMB = DefaultSizeLimitMB;
+                    if (auto settingsRegistry = SettingsRegistry::Get())
+                    {
+                        settingsRegistry->Get(sizeLimitMB, SizeLimitRegistryKey);
+                    }
+                    Prune(sizeLimitMB * 1024 * 1024);
+                }
+
+                const AZStd::optional<IO::FixedMaxPath> cacheFilePath = GetCacheFilePath(shaderPlatformInterface, key);
+                if (!cacheFilePath)
+                {
+                    return;
+                }
+
+                IO::FileIOBase* fileIO = IO::FileIOBase::GetInstance();
+                fileIO->CreatePath(IO::FixedMaxPath(cacheFilePath->ParentPath()).c_str());
+
+                // Several asset builders may compile the same function at the same time, so each of them writes its own
+                // file and moves it in place. Whoever comes second finds the file already there, with the same content.
+                const AZStd::string temporaryExtension = AZStd::string::format("%s.tmp", Uuid::CreateRandom().ToString<AZStd::string>(false, false).c_str());
+                IO::FixedMaxPath temporaryFilePath = *cacheFilePath;
+                temporaryFilePath.ReplaceExtension(IO::PathView(temporaryExtension));
+                if (!Utils::SaveObjectToFile(
+                        temporaryFilePath.c_str(), DataStream::ST_BINARY, &shaderStageFunction, azrtti_typeid(shaderStageFunction), serializeContext))
+                {
+                    AZ_Warning(ShaderVariantCompileCacheName, false, "Failed to write the shader variant compile cache file \"%s\"", temporaryFilePath.c_str());
+                    fileIO->Remove(temporaryFilePath.c_str());
+                    return;
+                }
+
+                if (!fileIO->Rename(temporaryFilePath.c_str(), cacheFilePath->c_str()))
+                {
+                    fileIO->Remove(temporaryFilePath.c_str());
+                }
+            }
+
+            void Prune(AZ::u64 sizeLimit)
+            {
+                const AZStd::optional<IO::FixedMaxPath> cacheFolderPath = GetCacheFolderPath();
+                if (!cacheFolderPath)
+                {
+                    return;
+                }
+
+                struct CacheFile
+                {
+                    AZStd::string m_path;
+                    AZ::u64 m_modificationTime = 0;
+                    AZ::u64 m_size = 0;
+                };
+                AZStd::vector<CacheFile> cacheFiles;
+                AZ::u64 cacheSize = 0;
+
+                // The files are at <api>/<first two characters of the key>/<key>.bin
+                IO::FileIOBase* fileIO = IO::FileIOBase::GetInstance();
+                fileIO->FindFiles(cacheFolderPath->c_str(), "*", [&](const char* apiFolderPath)
+                {
+                    if (fileIO->IsDirectory(apiFolderPath))
+                    {
+                        fileIO->FindFiles(apiFolderPath, "*", [&](const char* keyFolderPath)
+                        {
+                            if (fileIO->IsDirectory(keyFolderPath))
+                            {
+                                fileIO->FindFiles(keyFolderPath, "*.bin", [&](const char* filePath)
+                                {
+                                    CacheFile cacheFile;
+                                    cacheFile.m_path = filePath;
+                                    cacheFile.m_modificationTime = fileIO->ModificationTime(filePath);
+                                    fileIO->Size(filePath, cacheFile.m_size);
+                                    cacheSize += cacheFile.m_size;
+                                    cacheFiles.push_back(AZStd::move(cacheFile));
+                                    return true;
+                                });
+                            }
+                            return true;
+                        });
+                    }
+                    return true;
+                });
+
+                if (cacheSize <= sizeLimit)
+                {
+                    return;
+                }
+
+                // A compiler upgrade leaves all the older files unused, so the oldest files go first
+                AZStd::sort(cacheFiles.begin(), cacheFiles.end(), [](const CacheFile& lhs, const CacheFile& rhs)
+                {
+                    return lhs.m_modificationTime < rhs.m_modificationTime;
+                });
+
+                for (const CacheFile& cacheFile : cacheFiles)
+                {
+                    if (cacheSize <= sizeLimit)
+                    {
+                        break;
+                    }
+                    // Another builder may be pruning at the same time, the file is gone either way
+                    fileIO->Remove(cacheFile.m_path.c_str());
+                    cacheSize -= cacheFile.m_size;
+                }
+            }
+        } // ShaderVariantCompileCache namespace
+    } // ShaderBuilder namespace
+} // AZ
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AssetBuilderSDK/AssetBuilderSDK.h>
+
+#include <Atom/RHI.Edit/ShaderPlatformInterface.h>
+#include <Atom/RHI.Reflect/ShaderStageFunction.h>
+
+namespace AZ
+{
+    class SerializeContext;
+
+    namespace ShaderBuilder
+    {
+        //! Keeps the shader stage functions compiled for shader variants on disk, under @user@/Atom/ShaderVariantCache.
+        //! A function is stored under a hash of everything that is handed to the platform shader compiler, so a
+        //! variant whose hlsl didn't change since the last build, or that is byte identical to another variant,
+        //! is not compiled again. Changing a shader variant list rebuilds every variant in it, and in practice
+        //! most of them come out of this cache.
+        namespace ShaderVariantCompileCache
+        {
+            //! The size, in megabytes, the cache is pruned down to once per builder process.
+            static constexpr char SizeLimitRegistryKey[] = "/O3DE/Atom/Shaders/ShaderVariantCompileCacheSizeLimitMB";
+            static constexpr AZ::u64 DefaultSizeLimitMB = 2048;
+
+            //! Returns the key of the compilation of @entryFunctionName from @hlslSource, or an empty string if the result
+            //! must not be cached. Builds with debug information are never cached because they produce byproduct files.
+            //! The key also covers the compiler files of the platform interface (see ShaderPlatformInterface::GetCompilerFiles),
+            //! the path, size and modification time of the compiler executables and the content of the prepended headers.
+            //! Platform interfaces that don't name their compiler executables are never cached.
+            AZStd::string MakeKey(
+                const RHI::ShaderPlatformInterface& shaderPlatformInterface, const AssetBuilderSDK::PlatformInfo& platformInfo,
+                AZStd::string_view hlslSource, AZStd::string_view entryFunctionName, RHI::ShaderHardwareStage shaderStage,
+                const RHI::ShaderCompilerArguments& shaderCompilerArguments);
+
+            //! Returns the function stored under @key, or nullptr if there is none.
+            RHI::Ptr<RHI::ShaderStageFunction> Load(
+                const RHI::ShaderPlatformInterface& shaderPlatformInterface, const AZStd::string& key,
+                SerializeContext* serializeContext = nullptr);
+
+            //! Stores @shaderStageFunction under @key. Failing to write the cache is not an error, the function
+            //! is compiled again next time. The first call in a process prunes the cache to the size in @SizeLimitRegistryKey.
+            void Store(
+                const RHI::ShaderPlatformInterface& shaderPlatformInterface, const AZStd::string& key,
+                const RHI::ShaderStageFunction& shaderStageFunction, SerializeContext* serializeContext = nullptr);
+
+            //! Removes the oldest files of the cache, of all platform interfaces, until it's no larger than @sizeLimit bytes.
+            void Prune(AZ::u64 sizeLimit);
+        } // ShaderVariantCompileCache namespace
+    } // ShaderBuilder namespace
+} // AZ
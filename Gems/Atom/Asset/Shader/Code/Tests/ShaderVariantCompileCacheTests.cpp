@@ -0,0 +1,322 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <AzCore/Utils/Utils.h>
+#include <AzFramework/IO/LocalFileIO.h>
+
+#include <AssetBuilderSDK/AssetBuilderSDK.h>
+
+#include "Common/ShaderBuilderTestFixture.h"
+
+#include <ShaderVariantCompileCache.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+
+    class TestShaderStageFunction
+        : public RHI::ShaderStageFunction
+    {
+    public:
+        AZ_RTTI(TestShaderStageFunction, "{3F0B65D2-7C4A-4E61-9B1D-2A8E5C9F4B17}", RHI::ShaderStageFunction);
+        AZ_CLASS_ALLOCATOR(TestShaderStageFunction, SystemAllocator, 0);
+
+        static void Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<TestShaderStageFunction, RHI::ShaderStageFunction>()
+                    ->Version(1)
+                    ->Field("m_byteCode", &TestShaderStageFunction::m_byteCode);
+            }
+        }
+
+        TestShaderStageFunction() = default;
+        TestShaderStageFunction(RHI::ShaderStage shaderStage, AZStd::vector<uint8_t> byteCode)
+            : RHI::ShaderStageFunction(shaderStage)
+            , m_byteCode(AZStd::move(byteCode))
+        {
+        }
+
+        AZStd::vector<uint8_t> m_byteCode;
+
+    private:
+        RHI::ResultCode FinalizeInternal() override
+        {
+            SetHash(TypeHash64(m_byteCode.data(), m_byteCode.size()));
+            return RHI::ResultCode::Success;
+        }
+    };
+
+    // Only the functions the compile cache calls do something
+    class TestShaderPlatformInterface
+        : public RHI::ShaderPlatformInterface
+    {
+    public:
+        TestShaderPlatformInterface()
+            : RHI::ShaderPlatformInterface(0)
+        {
+        }
+
+        RHI::APIType GetAPIType() const override { return RHI::APIType("TestRHI"); }
+        Name GetAPIName() const override { return Name("testrhi"); }
+        RHI::Ptr<RHI::PipelineLayoutDescriptor> CreatePipelineLayoutDescriptor() override { return nullptr; }
+        RHI::Ptr<RHI::ShaderStageFunction> CreateShaderStageFunction(const StageDescriptor&) override { return nullptr; }
+        bool IsShaderStageForRaster(RHI::ShaderHardwareStage) const override { return true; }
+        bool IsShaderStageForCompute(RHI::ShaderHardwareStage) const override { return false; }
+        bool IsShaderStageForRayTracing(RHI::ShaderHardwareStage) const override { return false; }
+        bool CompilePlatformInternal(
+            const AssetBuilderSDK::PlatformInfo&, const AZStd::string&, const AZStd::string&, RHI::ShaderHardwareStage,
+            const AZStd::string&, StageDescriptor&, const RHI::ShaderCompilerArguments&) const override
+        {
+            return false;
+        }
+        AZStd::string GetAzslCompilerParameters(const RHI::ShaderCompilerArguments&) const override { return {}; }
+        AZStd::string GetAzslCompilerWarningParameters(const RHI::ShaderCompilerArguments&) const override { return {}; }
+        bool BuildHasDebugInfo(const RHI::ShaderCompilerArguments& shaderCompilerArguments) const override
+        {
+            return shaderCompilerArguments.m_generateDebugInfo;
+        }
+        const char* GetAzslHeader(const AssetBuilderSDK::PlatformInfo&) const override { return nullptr; }
+        bool BuildPipelineLayoutDescriptor(
+            RHI::Ptr<RHI::PipelineLayoutDescriptor>, const ShaderResourceGroupInfoList&, const RootConstantsInfo&,
+            const RHI::ShaderCompilerArguments&) override
+        {
+            return true;
+        }
+
+        CompilerFiles GetCompilerFiles(const AssetBuilderSDK::PlatformInfo&) const override { return m_compilerFiles; }
+
+        CompilerFiles m_compilerFiles;
+    };
+
+    class ShaderVariantCompileCacheTests
+        : public ShaderBuilderTestFixture
+    {
+    protected:
+        void SetUp() override
+        {
+            ShaderBuilderTestFixture::SetUp();
+
+            m_priorFileIO = IO::FileIOBase::GetInstance();
+            IO::FileIOBase::SetInstance(nullptr);
+            m_localFileIO = AZStd::make_unique<IO::LocalFileIO>();
+            IO::FileIOBase::SetInstance(m_localFileIO.get());
+            m_localFileIO->SetAlias("@user@", m_tempDirectory.GetDirectory());
+
+            m_serializeContext = AZStd::make_unique<SerializeContext>();
+            RHI::ShaderStageFunction::Reflect(m_serializeContext.get());
+            TestShaderStageFunction::Reflect(m_serializeContext.get());
+
+            m_platformInfo.m_identifier = "pc";
+
+            Utils::WriteFile("compiler version 1", GetCompilerPath());
+            Utils::WriteFile("#define PLATFORM_VALUE 1", GetHeaderPath());
+            m_platformInterface = AZStd::make_unique<TestShaderPlatformInterface>();
+            m_platformInterface->m_compilerFiles.m_executables.push_back(GetCompilerPath());
+            m_platformInterface->m_compilerFiles.m_prependedHeaders.push_back(GetHeaderPath());
+        }
+
+        void TearDown() override
+        {
+            m_platformInterface.reset();
+
+            m_serializeContext->EnableRemoveReflection();
+            TestShaderStageFunction::Reflect(m_serializeContext.get());
+            RHI::ShaderStageFunction::Reflect(m_serializeContext.get());
+            m_serializeContext.reset();
+
+            IO::FileIOBase::SetInstance(nullptr);
+            m_localFileIO.reset();
+            IO::FileIOBase::SetInstance(m_priorFileIO);
+
+            ShaderBuilderTestFixture::TearDown();
+        }
+
+        AZStd::string GetCompilerPath() const
+        {
+            return m_tempDirectory.Resolve("compiler.exe");
+        }
+
+        AZStd::string GetHeaderPath() const
+        {
+            return m_tempDirectory.Resolve("PlatformHeader.hlsli");
+        }
+
+        AZStd::string MakeKey(AZStd::string_view hlslSource = "float4 MainVS() : SV_Position { return 0; }") const
+        {
+            return ShaderBuilder::ShaderVariantCompileCache::MakeKey(
+                *m_platformInterface, m_platformInfo, hlslSource, "MainVS", RHI::ShaderHardwareStage::Vertex, m_compilerArguments);
+        }
+
+        RHI::Ptr<TestShaderStageFunction> StoreFunction(const AZStd::string& key, AZStd::vector<uint8_t> byteCode)
+        {
+            RHI::Ptr<TestShaderStageFunction> function = aznew TestShaderStageFunction(RHI::ShaderStage::Vertex, AZStd::move(byteCode));
+            function->Finalize();
+            ShaderBuilder::ShaderVariantCompileCache::Store(*m_platformInterface, key, *function, m_serializeContext.get());
+            return function;
+        }
+
+        RHI::Ptr<RHI::ShaderStageFunction> LoadFunction(const AZStd::string& key)
+        {
+            return ShaderBuilder::ShaderVariantCompileCache::Load(*m_platformInterface, key, m_serializeContext.get());
+        }
+
+        AZ::Test::ScopedAutoTempDirectory m_tempDirectory;
+        IO::FileIOBase* m_priorFileIO = nullptr;
+        AZStd::unique_ptr<IO::LocalFileIO> m_localFileIO;
+        AZStd::unique_ptr<SerializeContext> m_serializeContext;
+
+        AZStd::unique_ptr<TestShaderPlatformInterface> m_platformInterface;
+        AssetBuilderSDK::PlatformInfo m_platformInfo;
+        RHI::ShaderCompilerArguments m_compilerArguments;
+    };
+
+    TEST_F(ShaderVariantCompileCacheTests, MakeKey_SameInput_SameKey)
+    {
+        const AZStd::string key = MakeKey();
+        EXPECT_FALSE(key.empty());
+        EXPECT_EQ(key, MakeKey());
+    }
+
+    TEST_F(ShaderVariantCompileCacheTests, MakeKey_SourceChanged_KeyChanges)
+    {
+        EXPECT_NE(MakeKey("float4 MainVS() : SV_Position { return 0; }"), MakeKey("float4 MainVS() : SV_Position { return 1; }"));
+    }
+
+    TEST_F(ShaderVariantCompileCacheTests, MakeKey_EntryPointOrStageChanged_KeyChanges)
+    {
+        const AZStd::string hlslSource = "float4 MainVS() : SV_Position { return 0; }";
+        const AZStd::string key = MakeKey(hlslSource);
+        EXPECT_NE(key, ShaderBuilder::ShaderVariantCompileCache::MakeKey(
+            *m_platformInterface, m_platformInfo, hlslSource, "MainPS", RHI::ShaderHardwareStage::Vertex, m_compilerArguments));
+        EXPECT_NE(key, ShaderBuilder::ShaderVariantCompileCache::MakeKey(
+            *m_platformInterface, m_platformInfo, hlslSource, "MainVS", RHI::ShaderHardwareStage::Fragment, m_compilerArguments));
+    }
+
+    TEST_F(ShaderVariantCompileCacheTests, MakeKey_CompilerArgumentsChanged_KeyChanges)
+    {
+        const AZStd::string key = MakeKey();
+
+        m_compilerArguments.m_disableOptimizations = true;
+        const AZStd::string disableOptimizationsKey = MakeKey();
+        EXPECT_NE(key, disableOptimizationsKey);
+        m_compilerArguments.m_disableOptimizations = false;
+
+        m_compilerArguments.m_optimizationLevel = 3;
+        const AZStd::string optimizationLevelKey = MakeKey();
+        EXPECT_NE(key, optimizationLevelKey);
+        m_compilerArguments.m_optimizationLevel = RHI::ShaderCompilerArguments::LevelUnset;
+
+        m_compilerArguments.m_defaultMatrixOrder = RHI::MatrixOrder::Row;
+        const AZStd::string matrixOrderKey = MakeKey();
+        EXPECT_NE(key, matrixOrderKey);
+        m_compilerArguments.m_defaultMatrixOrder = RHI::MatrixOrder::Default;
+
+        m_compilerArguments.m_dxcAdditionalFreeArguments = "-Zpr";
+        const AZStd::string freeArgumentsKey = MakeKey();
+        EXPECT_NE(key, freeArgumentsKey);
+        m_compilerArguments.m_dxcAdditionalFreeArguments.clear();
+
+        m_compilerArguments.m_warningAsError = true;
+        const AZStd::string warningAsErrorKey = MakeKey();
+        EXPECT_NE(key, warningAsErrorKey);
+        m_compilerArguments.m_warningAsError = false;
+
+        EXPECT_EQ(key, MakeKey());
+    }
+
+    TEST_F(ShaderVariantCompileCacheTests, MakeKey_PlatformChanged_KeyChanges)
+    {
+        const AZStd::string key = MakeKey();
+        m_platformInfo.m_identifier = "android";
+        EXPECT_NE(key, MakeKey());
+    }
+
+    TEST_F(ShaderVariantCompileCacheTests, MakeKey_CompilerExecutableReplaced_KeyChanges)
+    {
+        const AZStd::string key = MakeKey();
+        Utils::WriteFile("compiler version 1.1", GetCompilerPath());
+        EXPECT_NE(key, MakeKey());
+    }
+
+    TEST_F(ShaderVariantCompileCacheTests, MakeKey_PrependedHeaderChanged_KeyChanges)
+    {
+        const AZStd::string key = MakeKey();
+        Utils::WriteFile("#define PLATFORM_VALUE 2", GetHeaderPath());
+        EXPECT_NE(key, MakeKey());
+    }
+
+    TEST_F(ShaderVariantCompileCacheTests, MakeKey_DebugInfo_NotCached)
+    {
+        m_compilerArguments.m_generateDebugInfo = true;
+        EXPECT_TRUE(MakeKey().empty());
+    }
+
+    TEST_F(ShaderVariantCompileCacheTests, MakeKey_NoCompilerExecutables_NotCached)
+    {
+        m_platformInterface->m_compilerFiles.m_executables.clear();
+        EXPECT_TRUE(MakeKey().empty());
+    }
+
+    TEST_F(ShaderVariantCompileCacheTests, MakeKey_MissingCompilerExecutable_NotCached)
+    {
+        m_platformInterface->m_compilerFiles.m_executables.push_back(m_tempDirectory.Resolve("missing.exe"));
+        EXPECT_TRUE(MakeKey().empty());
+    }
+
+    TEST_F(ShaderVariantCompileCacheTests, StoreLoad_RoundTrip_SameFunction)
+    {
+        const AZStd::string key = MakeKey();
+        RHI::Ptr<TestShaderStageFunction> storedFunction = StoreFunction(key, { 0xD, 0xE, 0xA, 0xD, 0xB, 0xE, 0xE, 0xF });
+
+        RHI::Ptr<RHI::ShaderStageFunction> loadedFunction = LoadFunction(key);
+        ASSERT_TRUE(loadedFunction);
+        TestShaderStageFunction* loadedTestFunction = azrtti_cast<TestShaderStageFunction*>(loadedFunction.get());
+        ASSERT_NE(loadedTestFunction, nullptr);
+        EXPECT_EQ(loadedTestFunction->m_byteCode, storedFunction->m_byteCode);
+        EXPECT_EQ(loadedTestFunction->GetShaderStage(), RHI::ShaderStage::Vertex);
+        EXPECT_EQ(loadedTestFunction->GetHash(), storedFunction->GetHash());
+    }
+
+    TEST_F(ShaderVariantCompileCacheTests, Load_UnknownOrEmptyKey_ReturnsNull)
+    {
+        StoreFunction(MakeKey(), { 1, 2, 3 });
+
+        EXPECT_FALSE(LoadFunction(MakeKey("float4 MainVS() : SV_Position { return 2; }")));
+        EXPECT_FALSE(LoadFunction(""));
+    }
+
+    TEST_F(ShaderVariantCompileCacheTests, Load_CompilerReplacedAfterStore_ReturnsNull)
+    {
+        StoreFunction(MakeKey(), { 1, 2, 3 });
+        Utils::WriteFile("compiler version 2.0", GetCompilerPath());
+
+        EXPECT_FALSE(LoadFunction(MakeKey()));
+    }
+
+    TEST_F(ShaderVariantCompileCacheTests, Prune_UnderAndOverSizeLimit_RemovesFilesOnlyOverLimit)
+    {
+        const AZStd::string firstKey = MakeKey("float4 MainVS() : SV_Position { return 0; }");
+        const AZStd::string secondKey = MakeKey("float4 MainVS() : SV_Position { return 1; }");
+        StoreFunction(firstKey, { 1, 2, 3 });
+        StoreFunction(secondKey, { 4, 5, 6 });
+
+        ShaderBuilder::ShaderVariantCompileCache::Prune(AZStd::numeric_limits<AZ::u64>::max());
+        EXPECT_TRUE(LoadFunction(firstKey));
+        EXPECT_TRUE(LoadFunction(secondKey));
+
+        ShaderBuilder::ShaderVariantCompileCache::Prune(0);
+        EXPECT_FALSE(LoadFunction(firstKey));
+        EXPECT_FALSE(LoadFunction(secondKey));
+    }
+} // namespace UnitTest
@@ -27,6 +27,8 @@ set(FILES
     Source/Editor/AzslCompiler.h
     Source/Editor/ShaderVariantAssetBuilder.cpp
     Source/Editor/ShaderVariantAssetBuilder.h
+    Source/Editor/ShaderVariantCompileCache.cpp
+    Source/Editor/ShaderVariantCompileCache.h
     Source/Editor/AtomShaderConfig.cpp
     Source/Editor/AtomShaderConfig.h
     Source/Editor/PrecompiledShaderBuilder.cpp
@@ -12,4 +12,5 @@ set(FILES
     Tests/SupervariantCmdArgumentTests.cpp
     Tests/McppBinderTests.cpp
     Tests/ShaderBuilderUtilityTests.cpp
+    Tests/ShaderVariantCompileCacheTests.cpp
 )
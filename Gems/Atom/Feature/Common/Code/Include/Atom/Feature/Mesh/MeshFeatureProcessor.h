@@ -9,7 +9,9 @@
 #pragma once
 
 #include <Atom/Feature/Mesh/MeshFeatureProcessorInterface.h>
+#include <Atom/Feature/Mesh/MeshUpdateQueue.h>
 #include <Atom/RPI.Public/Culling.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/MeshDrawPacket.h>
 #include <Atom/RPI.Public/Shader/ShaderSystemInterface.h>
 #include <Atom/Feature/Material/MaterialAssignment.h>
@@ -29,6 +31,7 @@ namespace AZ
     {
         class TransformServiceFeatureProcessor;
         class RayTracingFeatureProcessor;
+        class MeshFeatureProcessor;
 
         class MeshDataInstance
         {
@@ -86,6 +89,9 @@ namespace AZ
             void UpdateObjectSrg();
             bool MaterialRequiresForwardPassIblSpecular(Data::Instance<RPI::Material> material) const;
             void SetVisible(bool isVisible);
+            void UpdateTrackedMaterials();
+            void ClearTrackedMaterials();
+            void UpdateStreamingImages();
 
             using DrawPacketList = AZStd::vector<RPI::MeshDrawPacket>;
 
@@ -102,8 +108,14 @@ namespace AZ
             Data::Instance<RPI::ShaderResourceGroup> m_shaderResourceGroup;
             AZStd::unique_ptr<MeshLoader> m_meshLoader;
             RPI::Scene* m_scene = nullptr;
+            MeshFeatureProcessor* m_featureProcessor = nullptr;
             RHI::DrawItemSortKey m_sortKey;
 
+            //! The distinct materials used by the draw packets, registered with the feature processor so the mesh is queued for update when one of them changes.
+            AZStd::vector<Data::Instance<RPI::Material>> m_trackedMaterials;
+            //! The distinct streaming images of the tracked materials, which get a target mip each frame the mesh is visible.
+            AZStd::vector<Data::Instance<RPI::StreamingImage>> m_streamingImages;
+
             TransformServiceFeatureProcessorInterface::ObjectId m_objectId;
 
             Aabb m_aabb = Aabb::CreateNull();
@@ -120,6 +132,8 @@ namespace AZ
         class MeshFeatureProcessor final
             : public MeshFeatureProcessorInterface
         {
+            friend class MeshDataInstance;
+
         public:
 
             AZ_RTTI(AZ::Render::MeshFeatureProcessor, "{6E3DFA1D-22C7-4738-A3AE-1E10AB88B29B}", MeshFeatureProcessorInterface);
@@ -134,7 +148,7 @@ namespace AZ
             void Activate() override;
             //! Releases GPU resources.
             void Deactivate() override;
-            //! Updates GPU buffers with latest data from render proxies
+            //! Updates GPU buffers with latest data from render proxies. Only the meshes queued for update since the last call are visited.
             void Simulate(const FeatureProcessor::SimulatePacket& packet) override;
 
             // RPI::SceneNotificationBus overrides ...
@@ -153,7 +167,7 @@ namespace AZ
             Data::Instance<RPI::Model> GetModel(const MeshHandle& meshHandle) const override;
             Data::Asset<RPI::ModelAsset> GetModelAsset(const MeshHandle& meshHandle) const override;
             Data::Instance<RPI::ShaderResourceGroup> GetObjectSrg(const MeshHandle& meshHandle) const override;
-            void QueueObjectSrgForCompile(const MeshHandle& meshHandle) const override;
+            void QueueObjectSrgForCompile(const MeshHandle& meshHandle) override;
             void SetMaterialAssignmentMap(const MeshHandle& meshHandle, const Data::Instance<RPI::Material>& material) override;
             void SetMaterialAssignmentMap(const MeshHandle& meshHandle, const MaterialAssignmentMap& materials) override;
             const MaterialAssignmentMap& GetMaterialAssignmentMap(const MeshHandle& meshHandle) const override;
@@ -193,9 +207,22 @@ namespace AZ
             // RPI::SceneNotificationBus::Handler overrides...
             void OnRenderPipelineAdded(RPI::RenderPipelinePtr pipeline) override;
             void OnRenderPipelineRemoved(RPI::RenderPipeline* pipeline) override;
-                        
+
+            //! Adds the mesh to the list of meshes that Simulate() will update on the next frame.
+            void QueueMeshUpdate(MeshDataInstance& meshData);
+            //! Sets the target mip of the streaming images of the meshes that passed culling last frame, from the screen coverage of
+            //! the most detailed lod each mesh was drawn with.
+            void ReportStreamingImageTargetMips();
+
             AZStd::concurrency_checker m_meshDataChecker;
             StableDynamicArray<MeshDataInstance> m_meshData;
+            //! Meshes whose transform, material, lod configuration or visibility changed since the last Simulate(), and the
+            //! materials of each mesh.
+            MeshUpdateQueue<MeshDataInstance, RPI::Material> m_meshUpdateQueue;
+            //! The meshes Simulate() is updating, kept to reuse the allocation.
+            AZStd::vector<MeshDataInstance*> m_meshesToUpdate;
+            //! The meshes that passed culling since the last Simulate(), added by the culling jobs.
+            RPI::VisibleCullableList m_visibleMeshes;
             TransformServiceFeatureProcessor* m_transformService;
             RayTracingFeatureProcessor* m_rayTracingFeatureProcessor = nullptr;
             AZ::RPI::ShaderSystemInterface::GlobalShaderOptionUpdatedEvent::Handler m_handleGlobalShaderOptionUpdate;
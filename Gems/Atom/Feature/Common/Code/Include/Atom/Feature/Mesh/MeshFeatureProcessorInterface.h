@@ -68,7 +68,7 @@ namespace AZ
             //! Simulate, or it will create a race between updating the data and the call to Compile
             virtual Data::Instance<RPI::ShaderResourceGroup> GetObjectSrg(const MeshHandle& meshHandle) const = 0;
             //! Queues the object srg for compile.
-            virtual void QueueObjectSrgForCompile(const MeshHandle& meshHandle) const = 0;
+            virtual void QueueObjectSrgForCompile(const MeshHandle& meshHandle) = 0;
             //! Sets the MaterialAssignmentMap for a meshHandle, using just a single material for the DefaultMaterialAssignmentId.
             //! Note if there is already a material assignment map, this will replace the entire map with just a single material.
             virtual void SetMaterialAssignmentMap(const MeshHandle& meshHandle, const Data::Instance<RPI::Material>& material) = 0;
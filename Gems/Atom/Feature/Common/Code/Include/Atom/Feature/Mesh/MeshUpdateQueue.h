@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ::Render
+{
+    //! MeshUpdateQueue keeps the meshes that need to be updated on the next frame, and the materials the meshes use so the meshes
+    //! are queued again when one of their materials changes.
+    //!
+    //! Meshes can be queued from any thread. MaterialType needs a ChangeId type, a DEFAULT_CHANGE_ID value, GetCurrentChangeId()
+    //! and NeedsCompile(), like RPI::Material.
+    template<typename MeshType, typename MaterialType>
+    class MeshUpdateQueue
+    {
+    public:
+        //! Queues the mesh for the next TakeQueuedMeshes(). A mesh that is already queued is only queued once.
+        void QueueMesh(MeshType* mesh);
+
+        //! Removes the mesh from the queue, e.g. when the mesh is released.
+        void RemoveMesh(MeshType* mesh);
+
+        bool IsQueued(const MeshType* mesh) const;
+
+        //! Moves the queued meshes to the end of the given list. Meshes queued after this call are queued for the next call.
+        void TakeQueuedMeshes(AZStd::vector<MeshType*>& meshes);
+
+        //! Queues the mesh whenever the material changes, until UntrackMaterial() is called for the same mesh and material.
+        void TrackMaterial(MaterialType* material, MeshType* mesh);
+        void UntrackMaterial(MaterialType* material, MeshType* mesh);
+
+        //! Queues the meshes of every tracked material whose change id changed since the last call.
+        //! A material that still needs to be compiled is checked again on the next call, see RPI::MeshDrawPacket::Update().
+        void QueueMeshesWithChangedMaterials();
+
+        //! Removes every mesh and material.
+        void Clear();
+
+    private:
+        struct TrackedMaterial
+        {
+            //! The change id of the material when its meshes were last queued
+            typename MaterialType::ChangeId m_changeId = MaterialType::DEFAULT_CHANGE_ID;
+            AZStd::unordered_set<MeshType*> m_meshes;
+        };
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::vector<MeshType*> m_queuedMeshes;
+        AZStd::unordered_set<const MeshType*> m_queuedMeshSet;
+        AZStd::unordered_map<MaterialType*, TrackedMaterial> m_trackedMaterials;
+    };
+
+    template<typename MeshType, typename MaterialType>
+    void MeshUpdateQueue<MeshType, MaterialType>::QueueMesh(MeshType* mesh)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_queuedMeshSet.insert(mesh).second)
+        {
+            m_queuedMeshes.push_back(mesh);
+        }
+    }
+
+    template<typename MeshType, typename MaterialType>
+    void MeshUpdateQueue<MeshType, MaterialType>::RemoveMesh(MeshType* mesh)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        if (m_queuedMeshSet.erase(mesh) > 0)
+        {
+            m_queuedMeshes.erase(AZStd::find(m_queuedMeshes.begin(), m_queuedMeshes.end(), mesh));
+        }
+    }
+
+    template<typename MeshType, typename MaterialType>
+    bool MeshUpdateQueue<MeshType, MaterialType>::IsQueued(const MeshType* mesh) const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_queuedMeshSet.contains(mesh);
+    }
+
+    template<typename MeshType, typename MaterialType>
+    void MeshUpdateQueue<MeshType, MaterialType>::TakeQueuedMeshes(AZStd::vector<MeshType*>& meshes)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        meshes.insert(meshes.end(), m_queuedMeshes.begin(), m_queuedMeshes.end());
+        m_queuedMeshes.clear();
+        m_queuedMeshSet.clear();
+    }
+
+    template<typename MeshType, typename MaterialType>
+    void MeshUpdateQueue<MeshType, MaterialType>::TrackMaterial(MaterialType* material, MeshType* mesh)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_trackedMaterials[material].m_meshes.insert(mesh);
+    }
+
+    template<typename MeshType, typename MaterialType>
+    void MeshUpdateQueue<MeshType, MaterialType>::UntrackMaterial(MaterialType* material, MeshType* mesh)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        auto trackedMaterialIter = m_trackedMaterials.find(material);
+        if (trackedMaterialIter != m_trackedMaterials.end())
+        {
+            trackedMaterialIter->second.m_meshes.erase(mesh);
+            if (trackedMaterialIter->second.m_meshes.empty())
+            {
+                m_trackedMaterials.erase(trackedMaterialIter);
+            }
+        }
+    }
+
+    template<typename MeshType, typename MaterialType>
+    void MeshUpdateQueue<MeshType, MaterialType>::QueueMeshesWithChangedMaterials()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        for (auto& [material, trackedMaterial] : m_trackedMaterials)
+        {
+            if (!material->NeedsCompile() && trackedMaterial.m_changeId != material->GetCurrentChangeId())
+            {
+                trackedMaterial.m_changeId = material->GetCurrentChangeId();
+                for (MeshType* mesh : trackedMaterial.m_meshes)
+                {
+                    if (m_queuedMeshSet.insert(mesh).second)
+                    {
+                        m_queuedMeshes.push_back(mesh);
+                    }
+                }
+            }
+        }
+    }
+
+    template<typename MeshType, typename MaterialType>
+    void MeshUpdateQueue<MeshType, MaterialType>::Clear()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_queuedMeshes.clear();
+        m_queuedMeshSet.clear();
+        m_trackedMaterials.clear();
+    }
+} // namespace AZ::Render
@@ -29,14 +29,19 @@
 #include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/Math/ShapeIntersection.h>
+#include <AzCore/Math/MathIntrinsics.h>
 #include <AzCore/RTTI/TypeInfo.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Asset/AssetCommon.h>
+#include <AzCore/std/algorithm.h>
 
 namespace AZ
 {
     namespace Render
     {
+        // The number of queued meshes updated by each job in Simulate()
+        static constexpr size_t MeshUpdateBatchSize = 128;
+
         void MeshFeatureProcessor::Reflect(ReflectContext* context)
         {
             if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
@@ -72,6 +77,8 @@ namespace AZ
             );
             m_transformService = nullptr;
             m_forceRebuildDrawPackets = false;
+            m_meshUpdateQueue.Clear();
+            m_visibleMeshes.Reset(0);
         }
 
         void MeshFeatureProcessor::Simulate(const FeatureProcessor::SimulatePacket& packet)
@@ -81,38 +88,67 @@ namespace AZ
 
             AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
 
-            const auto iteratorRanges = m_meshData.GetParallelRanges();
+            ReportStreamingImageTargetMips();
+
+            const bool forceRebuildDrawPackets = m_forceRebuildDrawPackets;
+            m_forceRebuildDrawPackets = false;
+
+            if (forceRebuildDrawPackets)
+            {
+                for (MeshDataInstance& meshDataInstance : m_meshData)
+                {
+                    m_meshUpdateQueue.QueueMesh(&meshDataInstance);
+                }
+            }
+            else
+            {
+                // Material properties can impact which shader is used, which impacts the SRG in the draw packet, so the meshes
+                // using a material that changed need to check their draw packets.
+                AZ_PROFILE_SCOPE(AzRender, "MeshFeatureProcessor: QueueMeshesWithChangedMaterials");
+                m_meshUpdateQueue.QueueMeshesWithChangedMaterials();
+            }
+
+            m_meshUpdateQueue.TakeQueuedMeshes(m_meshesToUpdate);
+            if (m_meshesToUpdate.empty())
+            {
+                return;
+            }
+
             AZ::JobCompletion jobCompletion;
-            for (const auto& iteratorRange : iteratorRanges)
+            for (size_t batchStart = 0; batchStart < m_meshesToUpdate.size(); batchStart += MeshUpdateBatchSize)
             {
-                const auto jobLambda = [&]() -> void
+                const size_t batchEnd = AZStd::min(batchStart + MeshUpdateBatchSize, m_meshesToUpdate.size());
+                const auto jobLambda = [this, batchStart, batchEnd, forceRebuildDrawPackets]() -> void
                 {
-                    for (auto meshDataIter = iteratorRange.first; meshDataIter != iteratorRange.second; ++meshDataIter)
+                    for (size_t meshIndex = batchStart; meshIndex < batchEnd; ++meshIndex)
                     {
-                        if (!meshDataIter->m_model)
+                        MeshDataInstance* meshDataInstance = m_meshesToUpdate[meshIndex];
+                        if (!meshDataInstance->m_model)
                         {
-                            continue;   // model not loaded yet
+                            continue;   // model not loaded yet, Init() queues the mesh again
                         }
 
-                        if (!meshDataIter->m_visible)
+                        // hidden meshes are skipped until SetVisible() queues them again, but their bounds are kept up to date
+                        if (meshDataInstance->m_visible)
                         {
-                            continue;
+                            if (meshDataInstance->m_objectSrgNeedsUpdate)
+                            {
+                                meshDataInstance->UpdateObjectSrg();
+                            }
+
+                            meshDataInstance->UpdateDrawPackets(forceRebuildDrawPackets);
+                            // the mesh is queued whenever one of its materials changes, which may have swapped an image
+                            meshDataInstance->UpdateStreamingImages();
+
+                            if (meshDataInstance->m_cullableNeedsRebuild)
+                            {
+                                meshDataInstance->BuildCullable();
+                            }
                         }
 
-                        if (meshDataIter->m_objectSrgNeedsUpdate)
+                        if (meshDataInstance->m_cullBoundsNeedsUpdate)
                         {
-                            meshDataIter->UpdateObjectSrg();
-                        }
-
-                        // [GFX TODO] [ATOM-1357] Currently all of the draw packets have to be checked for material ID changes because
-                        // material properties can impact which actual shader is used, which impacts the SRG in the draw packet.
-                        // This is scheduled to be optimized so the work is only done on draw packets that need it instead of having
-                        // to check every one.
-                        meshDataIter->UpdateDrawPackets(m_forceRebuildDrawPackets);
-
-                        if (meshDataIter->m_cullableNeedsRebuild)
-                        {
-                            meshDataIter->BuildCullable();
+                            meshDataInstance->UpdateCullBounds(m_transformService);
                         }
                     }
                 };
@@ -122,16 +158,10 @@ namespace AZ
             }
             jobCompletion.StartAndWaitForCompletion();
 
-            m_forceRebuildDrawPackets = false;
+            // The jobs staged the updated cullables, register them with the visibility scene in one pass
+            GetParentScene()->GetCullingScene()->FlushQueuedCullables();
 
-            // CullingSystem::RegisterOrUpdateCullable() is not threadsafe, so need to do those updates in a single thread
-            for (MeshDataInstance& meshDataInstance : m_meshData)
-            {
-                if (meshDataInstance.m_model && meshDataInstance.m_cullBoundsNeedsUpdate)
-                {
-                    meshDataInstance.UpdateCullBounds(m_transformService);
-                }
-            }
+            m_meshesToUpdate.clear();
         }
 
         void MeshFeatureProcessor::OnBeginPrepareRender()
@@ -155,10 +185,13 @@ namespace AZ
 
             meshDataHandle->m_descriptor = descriptor;
             meshDataHandle->m_scene = GetParentScene();
+            meshDataHandle->m_featureProcessor = this;
             meshDataHandle->m_materialAssignments = materials;
             meshDataHandle->m_objectId = m_transformService->ReserveObjectId();
             meshDataHandle->m_originalModelAsset = descriptor.m_modelAsset;
             meshDataHandle->m_meshLoader = AZStd::make_unique<MeshDataInstance::MeshLoader>(descriptor.m_modelAsset, &*meshDataHandle);
+            meshDataHandle->m_cullable.m_visibleList = &m_visibleMeshes;
+            meshDataHandle->m_cullable.m_visibleListUserData = &*meshDataHandle;
 
             return meshDataHandle;
         }
@@ -183,6 +216,11 @@ namespace AZ
                 m_transformService->ReleaseObjectId(meshHandle->m_objectId);
 
                 AZStd::concurrency_check_scope scopeCheck(m_meshDataChecker);
+                m_meshUpdateQueue.RemoveMesh(&*meshHandle);
+                if (meshHandle->m_cullable.m_visibleLods != 0)
+                {
+                    m_visibleMeshes.Remove(&*meshHandle);
+                }
                 m_meshData.erase(meshHandle);
 
                 return true;
@@ -220,11 +258,12 @@ namespace AZ
             return meshHandle.IsValid() ? meshHandle->m_shaderResourceGroup : nullptr;
         }
 
-        void MeshFeatureProcessor::QueueObjectSrgForCompile(const MeshHandle& meshHandle) const
+        void MeshFeatureProcessor::QueueObjectSrgForCompile(const MeshHandle& meshHandle)
         {
             if (meshHandle.IsValid())
             {
                 meshHandle->m_objectSrgNeedsUpdate = true;
+                QueueMeshUpdate(*meshHandle);
             }
         }
 
@@ -254,6 +293,7 @@ namespace AZ
                 }
 
                 meshHandle->m_objectSrgNeedsUpdate = true;
+                QueueMeshUpdate(*meshHandle);
             }
         }
 
@@ -277,6 +317,7 @@ namespace AZ
                 MeshDataInstance& meshData = *meshHandle;
                 meshData.m_cullBoundsNeedsUpdate = true;
                 meshData.m_objectSrgNeedsUpdate = true;
+                QueueMeshUpdate(meshData);
 
                 m_transformService->SetTransformForId(meshHandle->m_objectId, transform, nonUniformScale);
 
@@ -296,6 +337,7 @@ namespace AZ
                 meshData.m_aabb = localAabb;
                 meshData.m_cullBoundsNeedsUpdate = true;
                 meshData.m_objectSrgNeedsUpdate = true;
+                QueueMeshUpdate(meshData);
             }
         };
 
@@ -364,6 +406,7 @@ namespace AZ
             if (meshHandle.IsValid())
             {
                 meshHandle->SetMeshLodConfiguration(meshLodConfig);
+                QueueMeshUpdate(*meshHandle);
             }
         }
 
@@ -443,7 +486,11 @@ namespace AZ
                     {
                         meshHandle->BuildDrawPacketList(modelLodIndex);
                     }
+                    meshHandle->UpdateTrackedMaterials();
+                    meshHandle->m_cullableNeedsRebuild = true;
                 }
+
+                QueueMeshUpdate(*meshHandle);
             }
         }
 
@@ -470,8 +517,68 @@ namespace AZ
                 if (meshInstance.m_descriptor.m_useForwardPassIblSpecular)
                 {
                     meshInstance.m_objectSrgNeedsUpdate = true;
+                    QueueMeshUpdate(meshInstance);
+                }
+            }
+        }
+
+        void MeshFeatureProcessor::QueueMeshUpdate(MeshDataInstance& meshData)
+        {
+            m_meshUpdateQueue.QueueMesh(&meshData);
+        }
+
+        void MeshFeatureProcessor::ReportStreamingImageTargetMips()
+        {
+            AZ_PROFILE_SCOPE(AzRender, "MeshFeatureProcessor: ReportStreamingImageTargetMips");
+            // The streaming image controllers rank the images reported this frame ahead of the images that weren't seen.
+            // Culling only ever sets m_isVisible and m_visibleLods, so they are cleared here for the next frame.
+            auto reportMesh = [](MeshDataInstance& meshDataInstance)
+            {
+                RPI::Cullable& cullable = meshDataInstance.m_cullable;
+                const uint32_t visibleLods = cullable.m_visibleLods.exchange(0);
+                cullable.m_isVisible = false;
+                if (visibleLods == 0)
+                {
+                    return;
+                }
+
+                // Each mip halves the size of a texture, so the mesh needs one mip less for every halving of the screen coverage
+                // of the most detailed lod it was drawn with in any view.
+                const size_t lodIndex = az_ctz_u32(visibleLods);
+                const auto& lods = cullable.m_lodData.m_lods;
+                const float screenCoverageMax = lodIndex < lods.size() ? lods[lodIndex].m_screenCoverageMax : 1.0f;
+                const uint16_t targetMip = screenCoverageMax > 0.0f
+                    ? aznumeric_cast<uint16_t>(AZStd::GetMax(0.0f, floorf(-log2f(screenCoverageMax))))
+                    : 0;
+
+                for (const Data::Instance<RPI::StreamingImage>& streamingImage : meshDataInstance.m_streamingImages)
+                {
+                    streamingImage->SetTargetMip(targetMip);
+                }
+            };
+
+            if (m_visibleMeshes.HasOverflowed())
+            {
+                // More meshes became visible than the list was sized for, which can only happen when meshes were acquired since the
+                // last frame, so go over all of them this once.
+                for (MeshDataInstance& meshDataInstance : m_meshData)
+                {
+                    reportMesh(meshDataInstance);
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < m_visibleMeshes.GetCount(); ++i)
+                {
+                    // Entries of meshes released since culling are null.
+                    if (void* userData = m_visibleMeshes.GetUserData(i))
+                    {
+                        reportMesh(*static_cast<MeshDataInstance*>(userData));
+                    }
                 }
             }
+
+            m_visibleMeshes.Reset(m_meshData.size());
         }
 
         // MeshDataInstance::MeshLoader...
@@ -606,6 +713,8 @@ namespace AZ
             m_scene->GetCullingScene()->UnregisterCullable(m_cullable);
 
             RemoveRayTracingData();
+            ClearTrackedMaterials();
+            m_streamingImages.clear();
 
             m_drawPacketListsByLod.clear();
             m_materialAssignments.clear();
@@ -622,6 +731,7 @@ namespace AZ
             {
                 BuildDrawPacketList(modelLodIndex);
             }
+            UpdateTrackedMaterials();
 
             if (m_shaderResourceGroup)
             {
@@ -641,6 +751,7 @@ namespace AZ
             m_cullableNeedsRebuild = true;
             m_cullBoundsNeedsUpdate = true;
             m_objectSrgNeedsUpdate = true;
+            m_featureProcessor->QueueMeshUpdate(*this);
         }
 
         void MeshDataInstance::BuildDrawPacketList(size_t modelLodIndex)
@@ -1023,6 +1134,8 @@ namespace AZ
         void MeshDataInstance::SetMeshLodConfiguration(RPI::Cullable::LodConfiguration meshLodConfig)
         {
             m_cullable.m_lodData.m_lodConfiguration = meshLodConfig;
+            // the screen coverage of each lod is computed from the configuration when the cullable is built
+            m_cullableNeedsRebuild = true;
         }
 
         RPI::Cullable::LodConfiguration MeshDataInstance::GetMeshLodConfiguration() const
@@ -1143,7 +1256,7 @@ namespace AZ
             m_cullable.m_cullData.m_visibilityEntry.m_boundingVolume = localAabb.GetTransformedAabb(localToWorld);
             m_cullable.m_cullData.m_visibilityEntry.m_userData = &m_cullable;
             m_cullable.m_cullData.m_visibilityEntry.m_typeFlags = AzFramework::VisibilityEntry::TYPE_RPI_Cullable;
-            m_scene->GetCullingScene()->RegisterOrUpdateCullable(m_cullable);
+            m_scene->GetCullingScene()->QueueRegisterOrUpdateCullable(m_cullable);
 
             m_cullBoundsNeedsUpdate = false;
         }
@@ -1241,6 +1354,60 @@ namespace AZ
         {
             m_visible = isVisible;
             m_cullable.m_isHidden = !isVisible;
+
+            // hidden meshes are skipped by Simulate(), so whatever changed while the mesh was hidden is applied once it is visible again
+            if (isVisible)
+            {
+                m_featureProcessor->QueueMeshUpdate(*this);
+            }
+        }
+
+        void MeshDataInstance::UpdateTrackedMaterials()
+        {
+            ClearTrackedMaterials();
+            for (DrawPacketList& drawPacketList : m_drawPacketListsByLod)
+            {
+                for (RPI::MeshDrawPacket& drawPacket : drawPacketList)
+                {
+                    Data::Instance<RPI::Material> material = drawPacket.GetMaterial();
+                    if (material && AZStd::find(m_trackedMaterials.begin(), m_trackedMaterials.end(), material) == m_trackedMaterials.end())
+                    {
+                        m_featureProcessor->m_meshUpdateQueue.TrackMaterial(material.get(), this);
+                        m_trackedMaterials.push_back(AZStd::move(material));
+                    }
+                }
+            }
+        }
+
+        void MeshDataInstance::ClearTrackedMaterials()
+        {
+            for (const Data::Instance<RPI::Material>& material : m_trackedMaterials)
+            {
+                m_featureProcessor->m_meshUpdateQueue.UntrackMaterial(material.get(), this);
+            }
+            m_trackedMaterials.clear();
+        }
+
+        void MeshDataInstance::UpdateStreamingImages()
+        {
+            m_streamingImages.clear();
+            for (const Data::Instance<RPI::Material>& material : m_trackedMaterials)
+            {
+                for (const RPI::MaterialPropertyValue& propertyValue : material->GetPropertyValues())
+                {
+                    if (!propertyValue.Is<Data::Instance<RPI::Image>>())
+                    {
+                        continue;
+                    }
+
+                    Data::Instance<RPI::StreamingImage> streamingImage =
+                        azrtti_cast<RPI::StreamingImage*>(propertyValue.GetValue<Data::Instance<RPI::Image>>().get());
+                    if (streamingImage && AZStd::find(m_streamingImages.begin(), m_streamingImages.end(), streamingImage) == m_streamingImages.end())
+                    {
+                        m_streamingImages.push_back(AZStd::move(streamingImage));
+                    }
+                }
+            }
         }
     } // namespace Render
 } // namespace AZ
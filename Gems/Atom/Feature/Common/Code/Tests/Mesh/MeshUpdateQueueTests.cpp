@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/UnitTest/TestTypes.h>
+#include <Atom/Feature/Mesh/MeshUpdateQueue.h>
+
+namespace UnitTest
+{
+    using namespace AZ;
+    using namespace AZ::Render;
+
+    struct TestMesh
+    {
+        int m_id = 0;
+    };
+
+    //! Has the parts of RPI::Material that MeshUpdateQueue uses
+    struct TestMaterial
+    {
+        using ChangeId = size_t;
+        static constexpr ChangeId DEFAULT_CHANGE_ID = 0;
+
+        ChangeId GetCurrentChangeId() const
+        {
+            return m_changeId;
+        }
+
+        bool NeedsCompile() const
+        {
+            return m_needsCompile;
+        }
+
+        ChangeId m_changeId = DEFAULT_CHANGE_ID;
+        bool m_needsCompile = false;
+    };
+
+    using TestMeshUpdateQueue = MeshUpdateQueue<TestMesh, TestMaterial>;
+
+    class MeshUpdateQueueTests
+        : public UnitTest::AllocatorsTestFixture
+    {
+    public:
+        void SetUp() override
+        {
+            UnitTest::AllocatorsTestFixture::SetUp();
+        }
+
+        void TearDown() override
+        {
+            UnitTest::AllocatorsTestFixture::TearDown();
+        }
+
+    protected:
+        AZStd::vector<TestMesh*> TakeQueuedMeshes(TestMeshUpdateQueue& queue)
+        {
+            AZStd::vector<TestMesh*> meshes;
+            queue.TakeQueuedMeshes(meshes);
+            return meshes;
+        }
+    };
+
+    TEST_F(MeshUpdateQueueTests, QueueMesh_QueuedTwice_ReturnedOnce)
+    {
+        TestMeshUpdateQueue queue;
+        TestMesh meshA{ 1 };
+        TestMesh meshB{ 2 };
+
+        queue.QueueMesh(&meshA);
+        queue.QueueMesh(&meshB);
+        queue.QueueMesh(&meshA);
+
+        EXPECT_TRUE(queue.IsQueued(&meshA));
+        EXPECT_EQ(TakeQueuedMeshes(queue), AZStd::vector<TestMesh*>({ &meshA, &meshB }));
+        EXPECT_FALSE(queue.IsQueued(&meshA));
+        EXPECT_TRUE(TakeQueuedMeshes(queue).empty());
+    }
+
+    TEST_F(MeshUpdateQueueTests, QueueMesh_QueuedAfterTake_ReturnedByNextTake)
+    {
+        TestMeshUpdateQueue queue;
+        TestMesh mesh;
+
+        queue.QueueMesh(&mesh);
+        EXPECT_EQ(TakeQueuedMeshes(queue), AZStd::vector<TestMesh*>({ &mesh }));
+
+        queue.QueueMesh(&mesh);
+        EXPECT_EQ(TakeQueuedMeshes(queue), AZStd::vector<TestMesh*>({ &mesh }));
+    }
+
+    TEST_F(MeshUpdateQueueTests, RemoveMesh_ReleasedWhileQueued_NotReturned)
+    {
+        TestMeshUpdateQueue queue;
+        TestMesh meshA{ 1 };
+        TestMesh meshB{ 2 };
+        TestMesh meshC{ 3 };
+
+        queue.QueueMesh(&meshA);
+        queue.QueueMesh(&meshB);
+        queue.QueueMesh(&meshC);
+        queue.RemoveMesh(&meshB);
+        // removing a mesh that isn't queued does nothing
+        queue.RemoveMesh(&meshB);
+
+        EXPECT_FALSE(queue.IsQueued(&meshB));
+        EXPECT_EQ(TakeQueuedMeshes(queue), AZStd::vector<TestMesh*>({ &meshA, &meshC }));
+    }
+
+    TEST_F(MeshUpdateQueueTests, QueueMeshesWithChangedMaterials_MaterialChanged_QueuesItsMeshesOnce)
+    {
+        TestMeshUpdateQueue queue;
+        TestMesh meshA{ 1 };
+        TestMesh meshB{ 2 };
+        TestMesh meshC{ 3 };
+        TestMaterial changedMaterial;
+        TestMaterial unchangedMaterial;
+
+        queue.TrackMaterial(&changedMaterial, &meshA);
+        queue.TrackMaterial(&changedMaterial, &meshB);
+        queue.TrackMaterial(&unchangedMaterial, &meshC);
+        // meshA is already queued for another change
+        queue.QueueMesh(&meshA);
+
+        changedMaterial.m_changeId = 1;
+        queue.QueueMeshesWithChangedMaterials();
+
+        AZStd::vector<TestMesh*> meshes = TakeQueuedMeshes(queue);
+        ASSERT_EQ(meshes.size(), 2);
+        EXPECT_EQ(meshes[0], &meshA);
+        EXPECT_EQ(meshes[1], &meshB);
+
+        // the change was already seen
+        queue.QueueMeshesWithChangedMaterials();
+        EXPECT_TRUE(TakeQueuedMeshes(queue).empty());
+    }
+
+    TEST_F(MeshUpdateQueueTests, QueueMeshesWithChangedMaterials_MaterialNeedsCompile_QueuesMeshesOnceCompiled)
+    {
+        TestMeshUpdateQueue queue;
+        TestMesh mesh;
+        TestMaterial material;
+        queue.TrackMaterial(&material, &mesh);
+
+        material.m_changeId = 1;
+        material.m_needsCompile = true;
+        queue.QueueMeshesWithChangedMaterials();
+        EXPECT_TRUE(TakeQueuedMeshes(queue).empty());
+
+        material.m_needsCompile = false;
+        queue.QueueMeshesWithChangedMaterials();
+        EXPECT_EQ(TakeQueuedMeshes(queue), AZStd::vector<TestMesh*>({ &mesh }));
+    }
+
+    TEST_F(MeshUpdateQueueTests, QueueMeshesWithChangedMaterials_MaterialUntracked_DoesNotQueueMesh)
+    {
+        TestMeshUpdateQueue queue;
+        TestMesh meshA{ 1 };
+        TestMesh meshB{ 2 };
+        TestMaterial material;
+        queue.TrackMaterial(&material, &meshA);
+        queue.TrackMaterial(&material, &meshB);
+        queue.UntrackMaterial(&material, &meshA);
+
+        material.m_changeId = 1;
+        queue.QueueMeshesWithChangedMaterials();
+        EXPECT_EQ(TakeQueuedMeshes(queue), AZStd::vector<TestMesh*>({ &meshB }));
+
+        queue.UntrackMaterial(&material, &meshB);
+        material.m_changeId = 2;
+        queue.QueueMeshesWithChangedMaterials();
+        EXPECT_TRUE(TakeQueuedMeshes(queue).empty());
+    }
+
+    TEST_F(MeshUpdateQueueTests, Clear_QueuedMeshAndTrackedMaterial_NothingQueued)
+    {
+        TestMeshUpdateQueue queue;
+        TestMesh meshA{ 1 };
+        TestMesh meshB{ 2 };
+        TestMaterial material;
+        queue.QueueMesh(&meshA);
+        queue.TrackMaterial(&material, &meshB);
+
+        queue.Clear();
+
+        material.m_changeId = 1;
+        queue.QueueMeshesWithChangedMaterials();
+        EXPECT_TRUE(TakeQueuedMeshes(queue).empty());
+    }
+} // namespace UnitTest
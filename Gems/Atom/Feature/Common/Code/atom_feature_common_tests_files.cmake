@@ -12,6 +12,7 @@ set(FILES
     Tests/CoreLights/ShadowmapAtlasTest.cpp
     Tests/IndexedDataVectorTests.cpp
     Tests/IndexableListTests.cpp
+    Tests/Mesh/MeshUpdateQueueTests.cpp
     Tests/SparseVectorTests.cpp
     Tests/SkinnedMesh/SkinnedMeshDispatchItemTests.cpp
     Tests/Decals/DecalTextureArrayTests.cpp
@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/containers/vector.h>
 
 #include <Atom/RHI.Reflect/PipelineLayoutDescriptor.h>
 
@@ -138,6 +139,19 @@ namespace AZ
             //! Get the filename of include file to prefix shader programs with
             virtual const char* GetAzslHeader(const AssetBuilderSDK::PlatformInfo& platform) const = 0;
 
+            //! The files, besides the shader source, that decide the byte code CompilePlatformInternal() produces.
+            //! Relative paths are relative to the executable folder, like the ones given to ExecuteShaderCompiler().
+            struct CompilerFiles
+            {
+                AZStd::vector<AZStd::string> m_executables; //!< The shader compiler executables that are run.
+                AZStd::vector<AZStd::string> m_prependedHeaders; //!< The headers that are prepended to the shader source.
+            };
+
+            //! Returns the files CompilePlatformInternal() uses for @platform. Byte code that was compiled earlier is
+            //! only valid as long as these files didn't change. An empty list of executables means the
+            //! compiled byte code must not be reused.
+            virtual CompilerFiles GetCompilerFiles([[maybe_unused]] const AssetBuilderSDK::PlatformInfo& platform) const { return {}; }
+
             //! Builds additional platform specific data to the pipeline layout descriptor.
             //! Will be called before CompilePlatformInternal().
             virtual bool BuildPipelineLayoutDescriptor(
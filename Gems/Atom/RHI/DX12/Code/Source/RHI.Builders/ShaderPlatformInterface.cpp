@@ -27,6 +27,9 @@ namespace AZ
         static const char* PlatformShaderHeader = "Builders/ShaderHeaders/Platform/Windows/DX12/PlatformHeader.hlsli";
         static const char* AzslShaderHeader = "Builders/ShaderHeaders/Platform/Windows/DX12/AzslcHeader.azsli";
 
+        // Shader compiler executable
+        static const char* DxcRelativePath = "Builders/DirectXShaderCompiler/dxc.exe";
+
         ShaderPlatformInterface::ShaderPlatformInterface(uint32_t apiUniqueIndex)
             : RHI::ShaderPlatformInterface(apiUniqueIndex), m_apiName{ DX12ApiName }
         {
@@ -204,6 +207,15 @@ namespace AZ
             return AzslShaderHeader;
         }
 
+        RHI::ShaderPlatformInterface::CompilerFiles ShaderPlatformInterface::GetCompilerFiles(const AssetBuilderSDK::PlatformInfo& platform) const
+        {
+            AZ_UNUSED(platform);
+            CompilerFiles compilerFiles;
+            compilerFiles.m_executables.push_back(DxcRelativePath);
+            compilerFiles.m_prependedHeaders.push_back(PlatformShaderHeader);
+            return compilerFiles;
+        }
+
         bool ShaderPlatformInterface::CompileHLSLShader(
             const AZStd::string& shaderSourceFile,
             const AZStd::string& tempFolder,
@@ -213,9 +225,6 @@ namespace AZ
             AZStd::vector<uint8_t>& compiledShader,
             ByProducts& byProducts) const
         {
-            // Shader compiler executable
-            static const char* dxcRelativePath = "Builders/DirectXShaderCompiler/dxc.exe";
-
             // NOTE:
             // Running DX12 on PC with DXIL shaders requires modern GPUs and at least Windows 10 Build 1803 or later for Shader Model 6.2
             // https://github.com/Microsoft/DirectXShaderCompiler/wiki/Running-Shaders
@@ -318,7 +327,7 @@ namespace AZ
                                                                  );
 
             // Run Shader Compiler
-            if (!RHI::ExecuteShaderCompiler(dxcRelativePath, dxcCommandOptions, shaderSourceFile, "DXC"))
+            if (!RHI::ExecuteShaderCompiler(DxcRelativePath, dxcCommandOptions, shaderSourceFile, "DXC"))
             {
                 return false;
             }
@@ -55,6 +55,8 @@ namespace AZ
 
             const char* GetAzslHeader(const AssetBuilderSDK::PlatformInfo& platform) const override;
 
+            CompilerFiles GetCompilerFiles(const AssetBuilderSDK::PlatformInfo& platform) const override;
+
         private:
             ShaderPlatformInterface() = delete;
 
@@ -182,6 +182,14 @@ namespace AZ
             }
         }
 
+        RHI::ShaderPlatformInterface::CompilerFiles ShaderPlatformInterface::GetCompilerFiles(
+            [[maybe_unused]] const AssetBuilderSDK::PlatformInfo& platform) const
+        {
+            // The Metal byte code comes out of the metal compiler that xcrun picks from the selected Xcode, and there is no
+            // file here that tells which one it is. So no executables are returned and compiled functions are never reused.
+            return {};
+        }
+
        bool ShaderPlatformInterface::CompilePlatformInternal(
            const AssetBuilderSDK::PlatformInfo& platform,
            const AZStd::string& shaderSourcePath,
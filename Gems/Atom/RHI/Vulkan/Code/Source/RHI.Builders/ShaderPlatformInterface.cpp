@@ -28,6 +28,9 @@ namespace AZ
         static const char* AndroidPlatformShaderHeader = "Builders/ShaderHeaders/Platform/Android/Vulkan/PlatformHeader.hlsli";
         static const char* WindowsAzslShaderHeader = "Builders/ShaderHeaders/Platform/Windows/Vulkan/AzslcHeader.azsli";
         static const char* AndroidAzslShaderHeader = "Builders/ShaderHeaders/Platform/Android/Vulkan/AzslcHeader.azsli";
+
+        // Shader compiler executable
+        static const char* DxcRelativePath = AZ_TRAIT_ATOM_SHADERBUILDER_DXC;
     
         RHI::APIType ShaderPlatformInterface::GetAPIType() const
         {
@@ -124,6 +127,14 @@ namespace AZ
             }
         }
 
+        RHI::ShaderPlatformInterface::CompilerFiles ShaderPlatformInterface::GetCompilerFiles(const AssetBuilderSDK::PlatformInfo& platform) const
+        {
+            CompilerFiles compilerFiles;
+            compilerFiles.m_executables.push_back(DxcRelativePath);
+            compilerFiles.m_prependedHeaders.push_back(platform.HasTag("mobile") ? AndroidPlatformShaderHeader : WindowsPlatformShaderHeader);
+            return compilerFiles;
+        }
+
         // Takes in HLSL source file path and then compiles the HLSL to bytecode and
         // appends it to the AZ::Vulkan::ShaderStageDescriptor inside the provided outputAsset.
         bool ShaderPlatformInterface::CompilePlatformInternal(
@@ -180,9 +191,6 @@ namespace AZ
             const AssetBuilderSDK::PlatformInfo& platform,
             ByProducts& byProducts) const
         {
-            // Shader compiler executable
-            static const char* dxcRelativePath = AZ_TRAIT_ATOM_SHADERBUILDER_DXC;
-
             // -Fo "Output file"
             AZStd::string shaderOutputFile;
             AzFramework::StringFunc::Path::GetFileName(shaderSourceFile.c_str(), shaderOutputFile);
@@ -301,7 +309,7 @@ namespace AZ
             //       therefore, the debug data is probably embedded in the spirv blob.
 
             // Run Shader Compiler
-            if (!RHI::ExecuteShaderCompiler(dxcRelativePath, dxcCommandOptions, shaderSourceFile, "DXC"))
+            if (!RHI::ExecuteShaderCompiler(DxcRelativePath, dxcCommandOptions, shaderSourceFile, "DXC"))
             {
                 return false;
             }
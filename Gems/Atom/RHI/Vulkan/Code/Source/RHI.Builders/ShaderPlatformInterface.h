@@ -57,6 +57,8 @@ namespace AZ
 
             const char* GetAzslHeader(const AssetBuilderSDK::PlatformInfo& platform) const override;
 
+            CompilerFiles GetCompilerFiles(const AssetBuilderSDK::PlatformInfo& platform) const override;
+
         private:
             ShaderPlatformInterface() = delete;
 
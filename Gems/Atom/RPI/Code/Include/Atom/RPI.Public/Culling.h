@@ -13,8 +13,11 @@
 #include <AzCore/base.h>
 #include <AzCore/RTTI/RTTI.h>
 #include <AzCore/Interface/Interface.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/atomic.h>
 #include <AzCore/std/parallel/mutex.h>
 
 #include <AzCore/Console/IConsole.h>
@@ -49,6 +52,7 @@ namespace AZ
     namespace RPI
     {
         class Scene;
+        class VisibleCullableList;
 
         struct Cullable
         {
@@ -113,6 +117,15 @@ namespace AZ
             //! This flag must be manually cleared by the Cullable object every frame.
             bool m_isVisible = false;
 
+            //! Bit n is set if lod n was added to any view in the previous frame, for the first 32 lods.
+            //! The culling jobs of all views write to it at once.  Like m_isVisible, it must be manually cleared by the Cullable object every frame.
+            AZStd::atomic_uint32_t m_visibleLods{ 0 };
+
+            //! Optional list that m_visibleListUserData is added to when the first lod of the object is added to a view in a frame,
+            //! so that the owner can visit the visible objects without checking every one of them.
+            VisibleCullableList* m_visibleList = nullptr;
+            void* m_visibleListUserData = nullptr;
+
             //! Flag indicating if the object is hidden, i.e., was specifically marked as
             //! something that shouldn't be rendered, regardless of its actual position relative to the camera
             bool m_isHidden = false;
@@ -137,6 +150,30 @@ namespace AZ
 #endif
         };
 
+        //! The objects that passed culling in the previous frame, for the Cullables that point to this list.
+        //! Objects are added from the culling jobs; everything else must happen while culling isn't running.
+        class VisibleCullableList
+        {
+        public:
+            //! Empties the list, making room for capacity objects.  Objects added past the capacity are counted but not stored,
+            //! see HasOverflowed().
+            void Reset(size_t capacity);
+
+            //! Thread safe.
+            void Add(void* userData);
+
+            //! Replaces the object with nullptr, e.g. when the object is released before the list is read.
+            void Remove(void* userData);
+
+            size_t GetCount() const { return AZStd::min(m_count.load(), m_userData.size()); }
+            void* GetUserData(size_t index) const { return m_userData[index]; }
+            bool HasOverflowed() const { return m_count.load() > m_userData.size(); }
+
+        private:
+            AZStd::vector<void*> m_userData;
+            AZStd::atomic_size_t m_count{ 0 };
+        };
+
         class CullingDebugContext
         {
         public:
@@ -215,7 +252,8 @@ namespace AZ
         };
 
         //! Selects an lod (based on size-in-screnspace) and adds the appropriate DrawPackets to the view.
-        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view);
+        //! If addedLods isn't null, bit n of it is set for each lod n that was added, for the first 32 lods.
+        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view, uint32_t* addedLods = nullptr);
 
         //! Centralized manager for culling-related processing for a given scene.
         //! There is one CullingScene owned by each Scene, so external systems (such as FeatureProcessors) should
@@ -271,6 +309,14 @@ namespace AZ
             //! Is not threadsafe, so call this from the main thread outside of Begin/EndCulling()
             void RegisterOrUpdateCullable(Cullable& cullable);
 
+            //! Stages a Cullable to be registered or updated by the next call to FlushQueuedCullables().
+            //! Is threadsafe, each thread writes to its own staging buffer, so FeatureProcessors can update cull bounds from their jobs.
+            void QueueRegisterOrUpdateCullable(Cullable& cullable);
+
+            //! Registers or updates all of the Cullables staged by QueueRegisterOrUpdateCullable() in a single pass over the visibility scene.
+            //! Is not threadsafe, so call this from the main thread outside of Begin/EndCulling(). BeginCulling() flushes anything left.
+            void FlushQueuedCullables();
+
             //! Removes a Cullable from the underlying visibility system(s).
             //! Must be called once for each cullable object on de-initialization.
             //! Is not threadsafe, so call this from the main thread outside of Begin/EndCulling()
@@ -291,6 +337,14 @@ namespace AZ
             void BeginCullingTaskGraph(const AZStd::vector<ViewPtr>& views);
             void BeginCullingJobs(const AZStd::vector<ViewPtr>& views);
             void ProcessCullablesCommon(const Scene& scene, View& view, AZ::Frustum& frustum, void*& maskedOcclusionCulling);
+            void RemoveQueuedCullable(Cullable& cullable);
+
+            struct CullableStagingBuffer
+            {
+                AZStd::mutex m_mutex;
+                AZStd::vector<AzFramework::VisibilityEntry*> m_entries;
+            };
+            static constexpr size_t CullableStagingBufferCount = 16;
 
             const Scene* m_parentScene = nullptr;
             AzFramework::IVisibilityScene* m_visScene = nullptr;
@@ -298,6 +352,12 @@ namespace AZ
             AZStd::concurrency_checker m_cullDataConcurrencyCheck;
             OcclusionPlaneVector m_occlusionPlanes;
             AZ::TaskGraphActiveInterface* m_taskGraphActive = nullptr;
+
+            //! Threads are assigned a staging buffer round robin, so they only contend when there are more threads than buffers
+            AZStd::array<CullableStagingBuffer, CullableStagingBufferCount> m_cullableStagingBuffers;
+            AZStd::atomic_bool m_hasQueuedCullables{ false };
+            //! The entries of all staging buffers, gathered by FlushQueuedCullables()
+            AZStd::vector<AzFramework::VisibilityEntry*> m_queuedCullableEntries;
         };
         
 
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Reflect/Image/BudgetedStreamingImageControllerAsset.h>
+
+#include <Atom/RPI.Public/Image/StreamingImageController.h>
+#include <Atom/RPI.Public/Image/StreamingImageContext.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
+
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/parallel/mutex.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! A streaming image controller which keeps the resident mips of its pool within a memory budget.
+        //!
+        //! Each update, the controller computes the mip chain each image wants from the target mips reported through
+        //! StreamingImage::SetTargetMip() (by feature processors, based on visibility, distance, lod, etc.). Images
+        //! are then ranked: images requested this cycle come first, most detailed request first, followed by images
+        //! which never reported a target, and last by images that were requested before but not this cycle, most
+        //! recently used first. Walking that ranking, each image is granted the most detailed mip chain that fits
+        //! in what is left of the budget. Images granted less than what they have are trimmed right away, and
+        //! images granted more are expanded in priority order, up to a maximum number of images per update.
+        class BudgetedStreamingImageController final
+            : public StreamingImageController
+        {
+            friend class ImageSystem;
+        public:
+            AZ_RTTI(BudgetedStreamingImageController, "{A1E64C2D-9B38-4F75-8E0A-63D2C7B91F54}", StreamingImageController)
+
+            static Data::Instance<BudgetedStreamingImageController> FindOrCreate(const Data::Asset<BudgetedStreamingImageControllerAsset>& asset);
+
+            //! Statistics of the last update of the controller.
+            struct Statistics
+            {
+                size_t m_imageCount = 0;
+                size_t m_memoryBudgetInBytes = 0;
+                //! The memory used by the mips that are resident on the GPU
+                size_t m_residentSizeInBytes = 0;
+                //! The memory the images would use if every image got the mips it requested
+                size_t m_requestedSizeInBytes = 0;
+                //! The memory the images will use once the granted mips are resident
+                size_t m_grantedSizeInBytes = 0;
+                //! The number of images with less detailed mips resident than requested
+                uint32_t m_imagesBelowRequestedMipCount = 0;
+                uint32_t m_mipExpandCount = 0;
+                uint32_t m_mipTrimCount = 0;
+            };
+
+            //! Overrides the memory budget of the asset. Zero falls back to the budget of the RHI pool, and if that
+            //! is zero as well the images aren't limited.
+            void SetMemoryBudget(size_t memoryBudgetInBytes);
+            size_t GetMemoryBudget() const;
+
+            Statistics GetStatistics() const;
+
+        private:
+            class BudgetedStreamingImageContext
+                : public StreamingImageContext
+            {
+            public:
+                AZ_CLASS_ALLOCATOR(BudgetedStreamingImageContext, AZ::ThreadPoolAllocator, 0);
+
+                // Whether a target mip was ever requested for the image
+                bool m_hasRequestedMip = false;
+            };
+
+            // The mip chains wanted by an image and granted to it by the budget, see UpdateInternal()
+            struct ImageRequest
+            {
+                StreamingImage* m_image = nullptr;
+                size_t m_lastAccessTimestamp = 0;
+                uint32_t m_priorityClass = 0;
+                size_t m_currentMipChain = 0;
+                size_t m_requestedMipChain = 0;
+                size_t m_grantedMipChain = 0;
+            };
+
+            // Standard init for InstanceData subclass
+            BudgetedStreamingImageController() = default;
+            static Data::Instance<BudgetedStreamingImageController> CreateInternal(Data::AssetData* assetData);
+            RHI::ResultCode Init(BudgetedStreamingImageControllerAsset& imageControllerAsset);
+
+            ///////////////////////////////////////////////////////////////////
+            // StreamingImageController Overrides
+            StreamingImageContextPtr CreateContextInternal() override;
+            void UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts) override;
+            ///////////////////////////////////////////////////////////////////
+
+            // Returns the memory used by the mip chains from the given one down to the tail.
+            static size_t GetSizeInBytes(const StreamingImage& image, size_t mipChainIndex);
+
+            AZStd::atomic_size_t m_memoryBudgetInBytes = { 0 };
+            uint32_t m_maxMipExpandsPerUpdate = 0;
+
+            // Reused every update to avoid reallocating
+            AZStd::vector<ImageRequest> m_imageRequests;
+
+            mutable AZStd::mutex m_statisticsMutex;
+            Statistics m_statistics;
+        };
+    }
+}
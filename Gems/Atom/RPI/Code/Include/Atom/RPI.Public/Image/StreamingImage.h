@@ -115,6 +115,18 @@ namespace AZ
             //! Returns the most detailed mip level currently resident in memory, where a value of 0 is the highest detailed mip.
             uint16_t GetResidentMipLevel();
 
+            //! Returns the number of mip chains in the image. The last one is the tail, which is always resident.
+            size_t GetMipChainCount() const;
+
+            //! Returns the index of the mip chain which contains the mip level. The mip level is clamped to the last mip.
+            size_t GetMipChainIndex(uint16_t mipLevel) const;
+
+            //! Returns the most detailed mip chain that is either resident or queued for streaming.
+            size_t GetStreamingMipChainLevel() const;
+
+            //! Returns the GPU memory needed by the mips of the mip chain, across all array slices.
+            size_t GetMipChainSizeInBytes(size_t mipChainIndex) const;
+
         private:
             StreamingImage() = default;
 
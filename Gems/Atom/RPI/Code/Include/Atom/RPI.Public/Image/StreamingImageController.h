@@ -69,6 +69,9 @@ namespace AZ
             void QueueExpandToMipChainLevel(StreamingImage* image, size_t mipChainIndex);
             void TrimToMipChainLevel(StreamingImage* image, size_t mipChainIndex);
 
+            //! Returns the RHI pool the controller streams images into.
+            const RHI::StreamingImagePool* GetRHIPool() const;
+
         private:
 
             ///////////////////////////////////////////////////////////////////
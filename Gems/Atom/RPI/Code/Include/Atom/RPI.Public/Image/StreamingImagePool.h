@@ -51,6 +51,10 @@ namespace AZ
 
             const RHI::StreamingImagePool* GetRHIPool() const;
 
+            //! Returns the controller which manages streaming on the pool, e.g. to adjust the budget of a
+            //! BudgetedStreamingImageController at runtime.
+            StreamingImageController* GetController();
+
         private:
             StreamingImagePool() = default;
 
@@ -7,6 +7,8 @@
  */
 #pragma once
 
+#include <AzCore/IO/IStreamerTypes.h>
+#include <AzCore/std/chrono/clocks.h>
 #include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/parallel/mutex.h>
 #include <Atom/RPI.Reflect/Shader/ShaderAsset.h>
@@ -24,6 +26,11 @@ namespace AZ
          * A helper class used by ShaderSystem to manage asynchronous loading of ShaderVariantTreeAssets
          * and ShaderVariantAssets.
          * The notifications of assets being loaded & ready are dispatched via ShaderVariantFinderNotificationBus.
+         *
+         * The service thread sleeps until a request is queued or a ShaderVariantTreeAsset becomes ready, and then
+         * queues all the loads it can with the AssetManager at once, so independent trees and variants load
+         * concurrently. Variants requested by draw items, and the trees they need, are loaded with a higher
+         * priority; within a priority the most requested assets go first.
          */
         class ShaderVariantAsyncLoader final
             : public AZ::Interface<IShaderVariantFinder>::Registrar
@@ -71,7 +78,34 @@ namespace AZ
             void Reset() override;
             ///////////////////////////////////////////////////////////////////
 
+            struct Statistics
+            {
+                //! Requests waiting on the service thread, e.g. for their ShaderVariantTreeAsset or for the asset to be built.
+                size_t m_pendingShaderVariantByIdRequestCount = 0;
+                size_t m_pendingShaderVariantTreeRequestCount = 0;
+                size_t m_pendingShaderVariantRequestCount = 0;
+                //! Assets queued for loading with the AssetManager which are not ready yet.
+                size_t m_loadingAssetCount = 0;
+                //! Assets which became ready, and the time between their first request and when they were ready.
+                size_t m_readyAssetCount = 0;
+                AZStd::chrono::milliseconds m_lastRequestToReadyTime{ 0 };
+                AZStd::chrono::milliseconds m_maxRequestToReadyTime{ 0 };
+                AZStd::chrono::milliseconds m_totalRequestToReadyTime{ 0 };
+            };
+
+            Statistics GetStatistics() const;
+
         private:
+            struct PendingRequest
+            {
+                //! When the asset was first requested.
+                AZStd::chrono::system_clock::time_point m_requestTime;
+                //! How many times the asset was requested while pending.
+                uint32_t m_requestCount = 1;
+                IO::IStreamerTypes::Priority m_priority = IO::IStreamerTypes::s_priorityMedium;
+
+                void Merge(const PendingRequest& other);
+            };
 
             ///////////////////////////////////////////////////////////////////////
             // AZ::Data::AssetBus::Handler overrides
@@ -89,30 +123,42 @@ namespace AZ
 
             void QueueShaderVariantTreeForLoading(
                 const TupleShaderAssetAndShaderVariantId& shaderAndVariantTuple,
-                AZStd::unordered_set<Data::AssetId>& shaderVariantTreePendingRequests);
+                const PendingRequest& request,
+                AZStd::unordered_map<Data::AssetId, PendingRequest>& shaderVariantTreePendingRequests);
 
             //! This is a helper method called from the service thread.
             //! Returns true if a valid AssetId for the corresponding ShaderVariantTreeAsset is registered
             //! in the asset database AND a request to load such asset is properly queued.
-            bool TryToLoadShaderVariantTreeAsset(const Data::AssetId& shaderAssetId);
+            bool TryToLoadShaderVariantTreeAsset(const Data::AssetId& shaderAssetId, const PendingRequest& request);
+
+            bool TryToLoadShaderVariantAsset(const Data::AssetId& shaderVariantAssetId, const PendingRequest& request);
 
-            bool TryToLoadShaderVariantAsset(const Data::AssetId& shaderVariantAssetId);
+            //! Updates the latency statistics when a requested asset is ready. m_mutex must be locked.
+            void RecordAssetReady(const Data::AssetId& assetId);
 
 
             //! A thread that runs forever servicing shader variant and trees load requests.
             AZStd::thread m_serviceThread;
             AZStd::atomic_bool m_isServiceShutdown;
-            AZStd::mutex m_mutex;
+            mutable AZStd::mutex m_mutex;
             AZStd::condition_variable m_workCondition;
 
-            //! This is a list of AssetId of ShaderVariantAsset.
-            AZStd::vector<TupleShaderAssetAndShaderVariantId> m_newShaderVariantPendingRequests;
+            //! Set when a ShaderVariantTreeAsset is ready, so the service thread resolves the requests waiting on it.
+            bool m_hasNewShaderVariantTrees = false;
+
+            //! This is a list of ShaderAsset and ShaderVariantId requests.
+            AZStd::vector<AZStd::pair<TupleShaderAssetAndShaderVariantId, PendingRequest>> m_newShaderVariantPendingRequests;
 
             //! This is a list of AssetId of ShaderAsset (Do not confuse with the AssetId ShaderVariantTreeAsset).
-            AZStd::vector<Data::AssetId> m_shaderVariantTreePendingRequests;
+            AZStd::vector<AZStd::pair<Data::AssetId, PendingRequest>> m_shaderVariantTreePendingRequests;
 
             //! This is a list of AssetId of ShaderVariantAsset.
-            AZStd::vector<Data::AssetId> m_shaderVariantPendingRequests;
+            AZStd::vector<AZStd::pair<Data::AssetId, PendingRequest>> m_shaderVariantPendingRequests;
+
+            //! When each asset queued for loading with the AssetManager was first requested.
+            AZStd::unordered_map<Data::AssetId, AZStd::chrono::system_clock::time_point> m_loadRequestTimes;
+
+            Statistics m_statistics;
 
             struct ShaderVariantCollection
             {
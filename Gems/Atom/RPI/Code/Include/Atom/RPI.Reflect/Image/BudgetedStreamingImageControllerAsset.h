@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Reflect/Image/StreamingImageControllerAsset.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        //! Configuration of a BudgetedStreamingImageController.
+        class BudgetedStreamingImageControllerAsset
+            : public StreamingImageControllerAsset
+        {
+        public:
+            AZ_RTTI(BudgetedStreamingImageControllerAsset, "{4C9E2F1B-7E35-4D8A-9B0C-2A61F3D85E47}", StreamingImageControllerAsset);
+            AZ_CLASS_ALLOCATOR(BudgetedStreamingImageControllerAsset, SystemAllocator, 0);
+
+            static const Data::AssetId BuiltInAssetId;
+
+            static void Reflect(AZ::ReflectContext* context);
+
+            BudgetedStreamingImageControllerAsset();
+            BudgetedStreamingImageControllerAsset(const Data::AssetId& assetId, size_t memoryBudgetInBytes, uint32_t maxMipExpandsPerUpdate);
+
+            //! The GPU memory the resident mips of all images of the pool may use. Zero uses the budget of the pool.
+            size_t GetMemoryBudgetInBytes() const;
+
+            //! The maximum number of images the controller starts expanding in a single update.
+            uint32_t GetMaxMipExpandsPerUpdate() const;
+
+        private:
+            AZ::u64 m_memoryBudgetInBytes = 0;
+            uint32_t m_maxMipExpandsPerUpdate = 20;
+        };
+    }
+}
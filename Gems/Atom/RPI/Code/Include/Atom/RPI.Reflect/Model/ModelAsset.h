@@ -21,7 +21,7 @@ namespace AZ
 
     namespace RPI
     {
-        class ModelKdTree;
+        class ModelBvh;
 
         //! Contains a set of RPI::ModelLodAsset objects.
         //! Serialized to a .azmodel file.
@@ -90,7 +90,7 @@ namespace AZ
             AZStd::fixed_vector<Data::Asset<ModelLodAsset>, ModelLodAsset::LodCountMax> m_lodAssets;
 
             // mutable method
-            void BuildKdTree() const;
+            void BuildBvh() const;
             bool BruteForceRayIntersect(
                 const AZ::Vector3& rayStart, const AZ::Vector3& rayDir, float& distanceNormalized, AZ::Vector3& normal) const;
 
@@ -105,9 +105,9 @@ namespace AZ
             AZ::Name m_positionName{ "POSITION" };
             // there is a tradeoff between memory use and performance but anywhere under a few thousand triangles or so remains under a few milliseconds per ray cast
             static const AZ::u32 s_minimumModelTriangleCountToOptimize = 100;
-            mutable AZStd::unique_ptr<ModelKdTree> m_kdTree;
-            volatile mutable bool m_isKdTreeCalculationRunning = false;
-            mutable AZStd::mutex m_kdTreeLock;
+            mutable AZStd::unique_ptr<ModelBvh> m_bvh;
+            volatile mutable bool m_isBvhCalculationRunning = false;
+            mutable AZStd::mutex m_bvhLock;
             mutable AZStd::optional<AZStd::size_t> m_modelTriangleCount;
             
             // Lists all of the material slots that are used by this LOD.
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <Atom/RPI.Reflect/Model/ModelAsset.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
+
+namespace AZ
+{
+    class Job;
+
+    namespace RPI
+    {
+        //! Bounding volume hierarchy over the triangles of a single model, used for ray intersection queries.
+        //! May contain triangles from multiple meshes, if a model contains multiple meshes.
+        //!
+        //! The hierarchy is built top down with binned surface area heuristic splits, on the job system when a job context
+        //! is available. The binary tree is then collapsed into nodes with four children, whose bounds are stored as
+        //! structures of arrays so a ray is tested against all four children at once with SIMD.
+        class ModelBvh
+        {
+        public:
+            //! A ray to intersect with the model, and the result of the intersection.
+            struct Ray
+            {
+                //! The starting point of the ray.
+                AZ::Vector3 m_raySrc = AZ::Vector3::CreateZero();
+                //! The direction and length of the ray (magnitude is encoded in the direction).
+                AZ::Vector3 m_rayDir = AZ::Vector3::CreateZero();
+
+                //! The normalized distance of the nearest intersection (in the range 0.0-1.0), valid if m_hit is true.
+                float m_distanceNormalized = AZStd::numeric_limits<float>::max();
+                //! The surface normal at the nearest intersection, valid if m_hit is true.
+                AZ::Vector3 m_normal = AZ::Vector3::CreateZero();
+                bool m_hit = false;
+            };
+
+            ModelBvh() = default;
+
+            bool Build(const ModelAsset* model);
+
+            //! Return if a ray intersected the model.
+            //! @param raySrc The starting point of the ray.
+            //! @param rayDir The direction and length of the ray (magnitude is encoded in the direction).
+            //! @param[out] The normalized distance of the intersection (in the range 0.0-1.0) - to calculate the actual
+            //! distance, multiply distanceNormalized by the magnitude of rayDir.
+            //! @param[out] The surface normal of the intersection with the model.
+            //! @return Return true if there was an intersection with the model, false otherwise.
+            bool RayIntersection(
+                const AZ::Vector3& raySrc, const AZ::Vector3& rayDir, float& distanceNormalized, AZ::Vector3& normal) const;
+
+            //! Intersects a batch of rays with the model, and fills in the results of each ray.
+            //! Rays are traversed in packets, so that each node is fetched once for all of the rays of a packet that reach it.
+            //! Coherent rays, such as those of neighboring pixels, benefit the most.
+            //! @return The number of rays that intersected the model.
+            uint32_t RayIntersections(AZStd::vector<Ray>& rays) const;
+
+            //! Number of rays traversed together by RayIntersections.
+            static constexpr uint32_t PacketSize = 4;
+
+            uint32_t GetTriangleCount() const
+            {
+                return aznumeric_cast<uint32_t>(m_triangles.size());
+            }
+
+            uint32_t GetNodeCount() const
+            {
+                return aznumeric_cast<uint32_t>(m_nodes.size());
+            }
+
+        private:
+            static constexpr uint32_t BinCount = 16;
+            static constexpr uint32_t MaxTrianglesInLeaf = 8;
+            // Deeper binary nodes are made leaves, which bounds the traversal stack
+            static constexpr uint32_t MaxDepth = 64;
+            // Ranges with more triangles than this are built in their own job
+            static constexpr uint32_t MinTrianglesPerBuildJob = 4 * 1024;
+
+            struct Triangle
+            {
+                AZ::Vector3 m_vertices[3];
+            };
+
+            enum class ChildType : uint8_t
+            {
+                Empty,
+                Node,
+                Leaf
+            };
+
+            //! Four children of an inner node, with the bounds of each child in a separate lane.
+            struct alignas(16) Node
+            {
+                float m_minX[4];
+                float m_minY[4];
+                float m_minZ[4];
+                float m_maxX[4];
+                float m_maxY[4];
+                float m_maxZ[4];
+                //! Index into m_nodes for child nodes, into m_leaves for leaves.
+                uint32_t m_children[4];
+                ChildType m_childTypes[4];
+            };
+
+            struct Leaf
+            {
+                uint32_t m_firstTriangle = 0;
+                uint32_t m_triangleCount = 0;
+            };
+
+            //! Binary node of the hierarchy while it is being built.
+            struct BuildNode
+            {
+                AZ::Aabb m_bounds = AZ::Aabb::CreateNull();
+                AZStd::unique_ptr<BuildNode> m_children[2];
+                uint32_t m_firstTriangle = 0;
+                uint32_t m_triangleCount = 0;
+
+                bool IsLeaf() const
+                {
+                    return m_children[0] == nullptr;
+                }
+            };
+
+            struct BuildTriangle
+            {
+                AZ::Aabb m_bounds;
+                AZ::Vector3 m_centroid;
+                uint32_t m_triangleIndex;
+            };
+
+            void BuildRecursively(
+                BuildNode* node, AZStd::vector<BuildTriangle>& buildTriangles, uint32_t first, uint32_t count, uint32_t depth, AZ::Job* job);
+            static uint32_t FindSplit(
+                AZStd::vector<BuildTriangle>& buildTriangles, uint32_t first, uint32_t count, const AZ::Aabb& bounds, const AZ::Aabb& centroidBounds);
+            uint32_t Flatten(const BuildNode& node);
+            void SetChild(uint32_t nodeIndex, uint32_t lane, const BuildNode& child);
+
+            void IntersectLeaf(const Leaf& leaf, const AZ::Vector3& raySrc, const AZ::Vector3& rayEnd, float& distanceNormalized, AZ::Vector3& normal) const;
+
+            AZStd::vector<Node> m_nodes;
+            AZStd::vector<Leaf> m_leaves;
+            //! Triangles in the order of the leaves, so that each leaf is a contiguous range.
+            AZStd::vector<Triangle> m_triangles;
+        };
+    } // namespace RPI
+} // namespace AZ
@@ -21,6 +21,8 @@ namespace AZ
 
         //! Spatial structure for a single model.
         //! May contain indices pointing to triangles from multiple meshes, if a model contains multiple meshes.
+        //! Deprecated. ModelAsset uses ModelBvh for ray intersection, which builds and traverses faster. ModelKdTree is only kept
+        //! as the baseline of the ModelBvh tests and benchmarks, and will be removed with them.
         class ModelKdTree
         {
         public:
@@ -40,6 +40,7 @@
 #include <SceneAPI/SceneCore/Utilities/SceneGraphSelector.h>
 #include <SceneAPI/SceneCore/Utilities/Reporting.h>
 #include <SceneAPI/SceneData/Groups/MeshGroup.h>
+#include <SceneAPI/SceneData/Rules/LodGenerationRule.h>
 #include <SceneAPI/SceneData/Rules/StaticMeshAdvancedRule.h>
 #include <SceneAPI/SceneCore/Containers/Utilities/SceneUtilities.h>
 #include <SceneAPI/SceneCore/Containers/Utilities/Filters.h>
@@ -191,10 +192,16 @@ namespace AZ
             // these nodes, first filter for the non-optimized mesh nodes, then remap
             // from the non-optimized one to the optimized one. This callable is used
             // to filter for mesh nodes that are not the optimized ones.
+            // The generated levels of detail are filtered out as well, they are added
+            // to the lods of the mesh they were generated from below.
             const auto isNonOptimizedMesh = [](const SceneAPI::Containers::SceneGraph& graph, SceneAPI::Containers::SceneGraph::NodeIndex& index)
             {
+                const AZStd::string_view name{graph.GetNodeName(index).GetName(), graph.GetNodeName(index).GetNameLength()};
+                AZStd::string_view sourceMeshName;
+                size_t generatedLod = 0;
                 return SceneAPI::Utilities::SceneGraphSelector::IsMesh(graph, index) &&
-                    !AZStd::string_view{graph.GetNodeName(index).GetName(), graph.GetNodeName(index).GetNameLength()}.ends_with(SceneAPI::Utilities::OptimizedMeshSuffix);
+                    !name.ends_with(SceneAPI::Utilities::OptimizedMeshSuffix) &&
+                    !SceneAPI::Utilities::SceneGraphSelector::ParseGeneratedLodMeshName(name, sourceMeshName, generatedLod);
             };
 
             if (lodRule)
@@ -213,6 +220,30 @@ namespace AZ
             AZStd::vector<AZStd::string> selectedMeshPaths = SceneAPI::Utilities::SceneGraphSelector::GenerateTargetNodes(sceneGraph,
                 context.m_group.GetSceneNodeSelectionList(), isNonOptimizedMesh, SceneAPI::Utilities::SceneGraphSelector::RemapToOptimizedMesh);
 
+            // The levels of detail generated from the selected meshes by the LodGenerationRule,
+            // remapped to their optimized mesh nodes as well, along with their lod index.
+            AZStd::vector<AZStd::pair<AZStd::string, uint32_t>> generatedLodMeshPaths;
+            if (context.m_group.GetRuleContainerConst().FindFirstByType<SceneAPI::SceneData::LodGenerationRule>())
+            {
+                const AZStd::vector<AZStd::string> sourceMeshPaths = SceneAPI::Utilities::SceneGraphSelector::GenerateTargetNodes(sceneGraph,
+                    context.m_group.GetSceneNodeSelectionList(), isNonOptimizedMesh);
+                for (const AZStd::string& sourceMeshPath : sourceMeshPaths)
+                {
+                    for (uint32_t lod = 1;; ++lod)
+                    {
+                        const SceneAPI::Containers::SceneGraph::NodeIndex generatedLodIndex =
+                            sceneGraph.Find(SceneAPI::Utilities::SceneGraphSelector::GetGeneratedLodMeshName(sourceMeshPath, lod));
+                        if (!generatedLodIndex.IsValid())
+                        {
+                            break;
+                        }
+                        const SceneAPI::Containers::SceneGraph::Name& generatedLodName = sceneGraph.GetNodeName(
+                            SceneAPI::Utilities::SceneGraphSelector::RemapToOptimizedMesh(sceneGraph, generatedLodIndex));
+                        generatedLodMeshPaths.emplace_back(AZStd::string(generatedLodName.GetPath(), generatedLodName.GetPathLength()), lod);
+                    }
+                }
+            }
+
             // Iterate over the downwards, breadth-first view into the scene.
             // First we have to split the source mesh data up by lod.
             for (const auto& viewIt : view)
@@ -224,7 +255,13 @@ namespace AZ
                     const AZStd::string meshName(viewIt.first.GetName(), viewIt.first.GetNameLength());
 
                     uint32_t lodIndex = 0; // Default to the 0th LOD if nothing is found
-                    if (lodRule)
+                    const auto generatedLodMeshPathIt = AZStd::find_if(generatedLodMeshPaths.begin(), generatedLodMeshPaths.end(),
+                        [&meshPath](const AZStd::pair<AZStd::string, uint32_t>& generatedLodMeshPath) { return generatedLodMeshPath.first == meshPath; });
+                    if (generatedLodMeshPathIt != generatedLodMeshPaths.end())
+                    {
+                        lodIndex = generatedLodMeshPathIt->second;
+                    }
+                    else if (lodRule)
                     {
                         // The LodRule contains the objects for Lod1 through LodN. Objects at Lod0 are not include in the LodRule
                         for (size_t lod = 0; lod < selectedMeshPathsByLod.size(); ++lod)
@@ -308,6 +345,10 @@ namespace AZ
                     {
                         sourceMeshName.remove_suffix(SceneAPI::Utilities::OptimizedMeshSuffix.size());
                     }
+                    // Generated levels of detail are named after the mesh they were generated from,
+                    // like the levels of detail that were authored in the source scene.
+                    size_t generatedLod = 0;
+                    SceneAPI::Utilities::SceneGraphSelector::ParseGeneratedLodMeshName(sourceMeshName, sourceMeshName, generatedLod);
                     sourceMesh.m_name = sourceMeshName;
 
                     const auto node = sceneGraph.Find(meshPath);
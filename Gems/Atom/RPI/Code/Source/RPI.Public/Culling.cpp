@@ -17,6 +17,7 @@
 #include <AzCore/Math/MatrixUtils.h>
 #include <AzCore/Math/ShapeIntersection.h>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/parallel/lock.h>
 #include <AzCore/Casting/numeric_cast.h>
 #include <AzCore/Debug/EventTrace.h>
@@ -201,6 +202,31 @@ namespace AZ
             }
         }
 
+        void VisibleCullableList::Reset(size_t capacity)
+        {
+            m_userData.resize_no_construct(capacity);
+            m_count = 0;
+        }
+
+        void VisibleCullableList::Add(void* userData)
+        {
+            const size_t index = m_count.fetch_add(1);
+            if (index < m_userData.size())
+            {
+                m_userData[index] = userData;
+            }
+        }
+
+        void VisibleCullableList::Remove(void* userData)
+        {
+            auto end = m_userData.begin() + GetCount();
+            auto itr = AZStd::find(m_userData.begin(), end, userData);
+            if (itr != end)
+            {
+                *itr = nullptr;
+            }
+        }
+
         CullingDebugContext::~CullingDebugContext()
         {
             AZStd::lock_guard<AZStd::mutex> lock(m_perViewCullStatsMutex);
@@ -258,10 +284,62 @@ namespace AZ
             // results depending on a race condition if you happen to update before or after
             // the culling system starts Enumerating, so use soft_lock_shared here
             m_cullDataConcurrencyCheck.soft_lock_shared();
+            RemoveQueuedCullable(cullable);
             m_visScene->RemoveEntry(cullable.m_cullData.m_visibilityEntry);
             m_cullDataConcurrencyCheck.soft_unlock_shared();
         }
 
+        void CullingScene::QueueRegisterOrUpdateCullable(Cullable& cullable)
+        {
+            static AZStd::atomic<size_t> s_nextStagingBufferIndex{ 0 };
+            static thread_local size_t s_stagingBufferIndex = s_nextStagingBufferIndex++ % CullableStagingBufferCount;
+
+            CullableStagingBuffer& stagingBuffer = m_cullableStagingBuffers[s_stagingBufferIndex];
+            AZStd::lock_guard<AZStd::mutex> lock(stagingBuffer.m_mutex);
+            stagingBuffer.m_entries.push_back(&cullable.m_cullData.m_visibilityEntry);
+            m_hasQueuedCullables = true;
+        }
+
+        void CullingScene::FlushQueuedCullables()
+        {
+            if (!m_hasQueuedCullables)
+            {
+                return;
+            }
+
+            AZ_PROFILE_SCOPE(RPI, "CullingScene: FlushQueuedCullables");
+            m_queuedCullableEntries.clear();
+            for (CullableStagingBuffer& stagingBuffer : m_cullableStagingBuffers)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(stagingBuffer.m_mutex);
+                m_queuedCullableEntries.insert(m_queuedCullableEntries.end(), stagingBuffer.m_entries.begin(), stagingBuffer.m_entries.end());
+                stagingBuffer.m_entries.clear();
+            }
+            m_hasQueuedCullables = false;
+
+            m_cullDataConcurrencyCheck.soft_lock_shared();
+            m_visScene->InsertOrUpdateEntries(m_queuedCullableEntries);
+            m_cullDataConcurrencyCheck.soft_unlock_shared();
+            m_queuedCullableEntries.clear();
+        }
+
+        void CullingScene::RemoveQueuedCullable(Cullable& cullable)
+        {
+            if (!m_hasQueuedCullables)
+            {
+                return;
+            }
+
+            // the cullable is going away, so it must not be registered again by the next flush
+            for (CullableStagingBuffer& stagingBuffer : m_cullableStagingBuffers)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(stagingBuffer.m_mutex);
+                stagingBuffer.m_entries.erase(
+                    AZStd::remove(stagingBuffer.m_entries.begin(), stagingBuffer.m_entries.end(), &cullable.m_cullData.m_visibilityEntry),
+                    stagingBuffer.m_entries.end());
+            }
+        }
+
         uint32_t CullingScene::GetNumCullables() const
         {
             return m_visScene->GetEntryCount();
@@ -306,6 +384,15 @@ namespace AZ
                     AzFramework::VisibilityEntry* visibleEntry);
 #endif
 
+        static void MarkVisibleLods(Cullable& cullable, uint32_t addedLods)
+        {
+            // only the first view to add a lod of the object this frame adds it to the visible list
+            if (addedLods != 0 && cullable.m_visibleLods.fetch_or(addedLods) == 0 && cullable.m_visibleList)
+            {
+                cullable.m_visibleList->Add(cullable.m_visibleListUserData);
+            }
+        }
+
         static void ProcessWorklist(const AZStd::shared_ptr<WorklistData>& worklistData, const WorkListType& worklist)
         {
             AZ_PROFILE_SCOPE(RPI, "AddObjectsToViewJob: Process");
@@ -349,9 +436,11 @@ namespace AZ
                                 if (TestOcclusionCulling(worklistData, visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
 #endif
                                 {
-                                    numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view);
+                                    uint32_t addedLods = 0;
+                                    numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view, &addedLods);
                                     ++numVisibleCullables;
                                     c->m_isVisible = true;
+                                    MarkVisibleLods(*c, addedLods);
                                 }
                             }
                         }
@@ -385,9 +474,11 @@ namespace AZ
                                 if (TestOcclusionCulling(worklistData, visibleEntry) == MaskedOcclusionCulling::CullingResult::VISIBLE)
 #endif
                                 {
-                                    numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view);
+                                    uint32_t addedLods = 0;
+                                    numDrawPackets += AddLodDataToView(c->m_cullData.m_boundingSphere.GetCenter(), c->m_lodData, *worklistData->m_view, &addedLods);
                                     ++numVisibleCullables;
                                     c->m_isVisible = true;
+                                    MarkVisibleLods(*c, addedLods);
                                 }
                             }
                         }
@@ -716,7 +807,7 @@ namespace AZ
         }
 
 
-        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view)
+        uint32_t AddLodDataToView(const Vector3& pos, const Cullable::LodData& lodData, RPI::View& view, uint32_t* addedLods)
         {
 #ifdef AZ_CULL_PROFILE_DETAILED
             AZ_PROFILE_SCOPE(RPI, "AddLodDataToView");
@@ -734,8 +825,12 @@ namespace AZ
 
             uint32_t numVisibleDrawPackets = 0;
 
-            auto addLodToDrawPacket = [&](const Cullable::LodData::Lod& lod)
+            auto addLodToDrawPacket = [&](const Cullable::LodData::Lod& lod, size_t lodIndex)
             {
+                if (addedLods && lodIndex < 32 && !lod.m_drawPackets.empty())
+                {
+                    *addedLods |= 1u << lodIndex;
+                }
 #ifdef AZ_CULL_PROFILE_VERBOSE
                 AZ_PROFILE_SCOPE(RPI, "add draw packets: %zu", lod.m_drawPackets.size());
 #endif
@@ -751,17 +846,18 @@ namespace AZ
                 case Cullable::LodType::SpecificLod:
                     if (lodData.m_lodConfiguration.m_lodOverride < lodData.m_lods.size())
                     {
-                        addLodToDrawPacket(lodData.m_lods.at(lodData.m_lodConfiguration.m_lodOverride));
+                        addLodToDrawPacket(lodData.m_lods.at(lodData.m_lodConfiguration.m_lodOverride), lodData.m_lodConfiguration.m_lodOverride);
                     }
                     break;
                 case Cullable::LodType::ScreenCoverage:
                 default:
-                    for (const Cullable::LodData::Lod& lod : lodData.m_lods)
+                    for (size_t lodIndex = 0; lodIndex < lodData.m_lods.size(); ++lodIndex)
                     {
+                        const Cullable::LodData::Lod& lod = lodData.m_lods[lodIndex];
                         // Note that this supports overlapping lod ranges (to suport cross-fading lods, for example)
                         if (approxScreenPercentage >= lod.m_screenCoverageMin && approxScreenPercentage <= lod.m_screenCoverageMax)
                         {
-                            addLodToDrawPacket(lod);
+                            addLodToDrawPacket(lod, lodIndex);
                         }
                     }
                     break;
@@ -838,6 +934,7 @@ namespace AZ
         void CullingScene::BeginCulling(const AZStd::vector<ViewPtr>& views)
         {
             AZ_PROFILE_SCOPE(RPI, "CullingScene: BeginCulling");
+            FlushQueuedCullables();
             m_cullDataConcurrencyCheck.soft_lock();
 
             m_debugCtx.ResetCullStats();
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Public/Image/BudgetedStreamingImageController.h>
+#include <Atom/RPI.Public/Image/StreamingImage.h>
+
+#include <Atom/RHI/StreamingImagePool.h>
+
+#include <AtomCore/Instance/InstanceDatabase.h>
+
+#include <AzCore/Debug/EventTrace.h>
+#include <AzCore/std/sort.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        namespace
+        {
+            // The ranking of images, see BudgetedStreamingImageController
+            enum PriorityClass : uint32_t
+            {
+                PriorityClassUnused = 0,
+                PriorityClassNoFeedback,
+                PriorityClassRequested
+            };
+        }
+
+        Data::Instance<BudgetedStreamingImageController> BudgetedStreamingImageController::FindOrCreate(const Data::Asset<BudgetedStreamingImageControllerAsset>& asset)
+        {
+            return azrtti_cast<BudgetedStreamingImageController*>(
+                Data::InstanceDatabase<StreamingImageController>::Instance().FindOrCreate(
+                    Data::InstanceId::CreateFromAssetId(asset.GetId()),
+                    asset));
+        }
+
+        Data::Instance<BudgetedStreamingImageController> BudgetedStreamingImageController::CreateInternal(Data::AssetData* assetData)
+        {
+            BudgetedStreamingImageControllerAsset* specificAsset = azrtti_cast<BudgetedStreamingImageControllerAsset*>(assetData);
+            if (!specificAsset)
+            {
+                AZ_Error("BudgetedStreamingImageController", false, "BudgetedStreamingImageController instance requires a BudgetedStreamingImageControllerAsset.");
+                return nullptr;
+            }
+
+            Data::Instance<BudgetedStreamingImageController> instance = aznew BudgetedStreamingImageController();
+
+            const RHI::ResultCode resultCode = instance->Init(*specificAsset);
+            if (resultCode == RHI::ResultCode::Success)
+            {
+                return instance;
+            }
+
+            return nullptr;
+        }
+
+        RHI::ResultCode BudgetedStreamingImageController::Init(BudgetedStreamingImageControllerAsset& imageControllerAsset)
+        {
+            m_memoryBudgetInBytes = imageControllerAsset.GetMemoryBudgetInBytes();
+            m_maxMipExpandsPerUpdate = imageControllerAsset.GetMaxMipExpandsPerUpdate();
+            return RHI::ResultCode::Success;
+        }
+
+        void BudgetedStreamingImageController::SetMemoryBudget(size_t memoryBudgetInBytes)
+        {
+            m_memoryBudgetInBytes = memoryBudgetInBytes;
+        }
+
+        size_t BudgetedStreamingImageController::GetMemoryBudget() const
+        {
+            const size_t memoryBudgetInBytes = m_memoryBudgetInBytes;
+            if (memoryBudgetInBytes == 0 && GetRHIPool())
+            {
+                return aznumeric_cast<size_t>(GetRHIPool()->GetDescriptor().m_budgetInBytes);
+            }
+            return memoryBudgetInBytes;
+        }
+
+        BudgetedStreamingImageController::Statistics BudgetedStreamingImageController::GetStatistics() const
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_statisticsMutex);
+            return m_statistics;
+        }
+
+        StreamingImageContextPtr BudgetedStreamingImageController::CreateContextInternal()
+        {
+            return aznew BudgetedStreamingImageContext();
+        }
+
+        size_t BudgetedStreamingImageController::GetSizeInBytes(const StreamingImage& image, size_t mipChainIndex)
+        {
+            size_t sizeInBytes = 0;
+            for (size_t chainIndex = mipChainIndex; chainIndex < image.GetMipChainCount(); ++chainIndex)
+            {
+                sizeInBytes += image.GetMipChainSizeInBytes(chainIndex);
+            }
+            return sizeInBytes;
+        }
+
+        void BudgetedStreamingImageController::UpdateInternal(size_t timestamp, const StreamingImageContextList& contexts)
+        {
+            AZ_PROFILE_SCOPE(RPI, "BudgetedStreamingImageController: Update");
+            AZ_UNUSED(timestamp);
+
+            Statistics statistics;
+            statistics.m_memoryBudgetInBytes = GetMemoryBudget();
+
+            // Gather what each image wants. Images which are not streamable can't change, so they only count against the budget.
+            size_t fixedSizeInBytes = 0;
+            m_imageRequests.clear();
+            for (const StreamingImageContext& streamingContext : contexts)
+            {
+                StreamingImage* image = streamingContext.TryGetImage();
+                if (!image)
+                {
+                    continue;
+                }
+
+                ++statistics.m_imageCount;
+                const size_t tailMipChain = image->GetMipChainCount() - 1;
+                const size_t residentMipChain = image->GetMipChainIndex(image->GetResidentMipLevel());
+                statistics.m_residentSizeInBytes += GetSizeInBytes(*image, residentMipChain);
+
+                if (!image->IsStreamable())
+                {
+                    const size_t sizeInBytes = GetSizeInBytes(*image, residentMipChain);
+                    fixedSizeInBytes += sizeInBytes;
+                    statistics.m_requestedSizeInBytes += sizeInBytes;
+                    continue;
+                }
+
+                // Contexts are only ever created by CreateContextInternal()
+                BudgetedStreamingImageContext& context = const_cast<BudgetedStreamingImageContext&>(
+                    static_cast<const BudgetedStreamingImageContext&>(streamingContext));
+
+                ImageRequest request;
+                request.m_image = image;
+                request.m_lastAccessTimestamp = context.GetLastAccessTimestamp();
+                request.m_currentMipChain = image->GetStreamingMipChainLevel();
+
+                // The target mip is reset after every update, so a valid target means the image was requested this cycle.
+                const uint16_t targetMip = context.GetTargetMip();
+                if (targetMip != RHI::Limits::Image::MipCountMax)
+                {
+                    context.m_hasRequestedMip = true;
+                    request.m_priorityClass = PriorityClassRequested;
+                    request.m_requestedMipChain = image->GetMipChainIndex(targetMip);
+                }
+                else if (!context.m_hasRequestedMip)
+                {
+                    // Without any feedback the image streams in fully, as long as the budget allows.
+                    request.m_priorityClass = PriorityClassNoFeedback;
+                    request.m_requestedMipChain = 0;
+                }
+                else
+                {
+                    // Not used this cycle: keep what is there, but it is the first to go when the budget is short.
+                    request.m_priorityClass = PriorityClassUnused;
+                    request.m_requestedMipChain = request.m_currentMipChain;
+                }
+
+                // The tail is always resident
+                fixedSizeInBytes += image->GetMipChainSizeInBytes(tailMipChain);
+                statistics.m_requestedSizeInBytes += GetSizeInBytes(*image, request.m_requestedMipChain);
+                if (residentMipChain > request.m_requestedMipChain)
+                {
+                    ++statistics.m_imagesBelowRequestedMipCount;
+                }
+
+                m_imageRequests.push_back(request);
+            }
+
+            AZStd::sort(m_imageRequests.begin(), m_imageRequests.end(),
+                [](const ImageRequest& lhs, const ImageRequest& rhs)
+                {
+                    if (lhs.m_priorityClass != rhs.m_priorityClass)
+                    {
+                        return lhs.m_priorityClass > rhs.m_priorityClass;
+                    }
+                    if (lhs.m_requestedMipChain != rhs.m_requestedMipChain)
+                    {
+                        return lhs.m_requestedMipChain < rhs.m_requestedMipChain;
+                    }
+                    return lhs.m_lastAccessTimestamp > rhs.m_lastAccessTimestamp;
+                });
+
+            // Grant each image, in priority order, the most detailed mip chain that fits in the remaining budget.
+            const bool hasBudget = statistics.m_memoryBudgetInBytes > 0;
+            size_t remainingBudget = hasBudget && statistics.m_memoryBudgetInBytes > fixedSizeInBytes ? statistics.m_memoryBudgetInBytes - fixedSizeInBytes : 0;
+            statistics.m_grantedSizeInBytes = fixedSizeInBytes;
+            for (ImageRequest& request : m_imageRequests)
+            {
+                const size_t tailMipChain = request.m_image->GetMipChainCount() - 1;
+                const size_t tailSizeInBytes = request.m_image->GetMipChainSizeInBytes(tailMipChain);
+
+                request.m_grantedMipChain = tailMipChain;
+                for (size_t mipChain = request.m_requestedMipChain; mipChain < tailMipChain; ++mipChain)
+                {
+                    const size_t sizeInBytes = GetSizeInBytes(*request.m_image, mipChain) - tailSizeInBytes;
+                    if (!hasBudget || sizeInBytes <= remainingBudget)
+                    {
+                        request.m_grantedMipChain = mipChain;
+                        remainingBudget -= hasBudget ? sizeInBytes : 0;
+                        statistics.m_grantedSizeInBytes += sizeInBytes;
+                        break;
+                    }
+                }
+            }
+
+            // Trim first, so the memory is released before any expansion lands.
+            for (const ImageRequest& request : m_imageRequests)
+            {
+                if (request.m_grantedMipChain > request.m_currentMipChain)
+                {
+                    TrimToMipChainLevel(request.m_image, request.m_grantedMipChain);
+                    ++statistics.m_mipTrimCount;
+                }
+            }
+
+            for (const ImageRequest& request : m_imageRequests)
+            {
+                if (statistics.m_mipExpandCount >= m_maxMipExpandsPerUpdate)
+                {
+                    break;
+                }
+
+                if (request.m_grantedMipChain < request.m_currentMipChain)
+                {
+                    QueueExpandToMipChainLevel(request.m_image, request.m_grantedMipChain);
+                    ++statistics.m_mipExpandCount;
+                }
+            }
+
+            // Don't hold on to the images outside of the update
+            m_imageRequests.clear();
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_statisticsMutex);
+            m_statistics = statistics;
+        }
+    }
+}
@@ -8,6 +8,7 @@
 
 #include <Atom/RPI.Public/Image/AttachmentImage.h>
 #include <Atom/RPI.Public/Image/AttachmentImagePool.h>
+#include <Atom/RPI.Public/Image/BudgetedStreamingImageController.h>
 #include <Atom/RPI.Public/Image/ImageSystem.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/Image/StreamingImagePool.h>
@@ -53,6 +54,7 @@ namespace AZ
             StreamingImagePoolAsset::Reflect(context);
             StreamingImageControllerAsset::Reflect(context);
             DefaultStreamingImageControllerAsset::Reflect(context);
+            BudgetedStreamingImageControllerAsset::Reflect(context);
             AttachmentImageAsset::Reflect(context);
         }
 
@@ -65,6 +67,9 @@ namespace AZ
             assetHandlers.emplace_back(MakeAssetHandler<BuiltInAssetHandler>(
                 azrtti_typeid<DefaultStreamingImageControllerAsset>(),
                 []() { return aznew DefaultStreamingImageControllerAsset(); }));
+            assetHandlers.emplace_back(MakeAssetHandler<BuiltInAssetHandler>(
+                azrtti_typeid<BudgetedStreamingImageControllerAsset>(),
+                []() { return aznew BudgetedStreamingImageControllerAsset(); }));
         }
 
         void ImageSystem::Init(const ImageSystemDescriptor& desc)
@@ -131,7 +136,14 @@ namespace AZ
             // Register streaming image controller instance database.
             {
                 Data::InstanceHandler<StreamingImageController> handler;
-                handler.m_createFunction = DefaultStreamingImageController::CreateInternal;
+                handler.m_createFunction = [](Data::AssetData* controllerAsset) -> Data::Instance<StreamingImageController>
+                {
+                    if (azrtti_cast<BudgetedStreamingImageControllerAsset*>(controllerAsset))
+                    {
+                        return BudgetedStreamingImageController::CreateInternal(controllerAsset);
+                    }
+                    return DefaultStreamingImageController::CreateInternal(controllerAsset);
+                };
                 Data::InstanceDatabase<StreamingImageController>::Create(azrtti_typeid<StreamingImageControllerAsset>(), handler);
             }
 
@@ -250,6 +250,40 @@ namespace AZ
             return static_cast<uint16_t>(m_image->GetResidentMipLevel());
         }
 
+        size_t StreamingImage::GetMipChainCount() const
+        {
+            return m_mipChains.size();
+        }
+
+        size_t StreamingImage::GetMipChainIndex(uint16_t mipLevel) const
+        {
+            const RHI::ImageDescriptor& descriptor = m_imageAsset->GetImageDescriptor();
+            return m_imageAsset->GetMipChainIndex(AZStd::min<size_t>(mipLevel, descriptor.m_mipLevels - 1));
+        }
+
+        size_t StreamingImage::GetStreamingMipChainLevel() const
+        {
+            return m_state.m_streamingTarget;
+        }
+
+        size_t StreamingImage::GetMipChainSizeInBytes(size_t mipChainIndex) const
+        {
+            AZ_Assert(mipChainIndex < m_mipChains.size(), "Exceeded number of mip chains.");
+
+            const RHI::ImageDescriptor& descriptor = m_imageAsset->GetImageDescriptor();
+            const size_t mipLevelBegin = m_imageAsset->GetMipLevel(mipChainIndex);
+            const size_t mipLevelEnd = mipLevelBegin + m_imageAsset->GetMipCount(mipChainIndex);
+
+            size_t sizeInBytes = 0;
+            for (size_t mipLevel = mipLevelBegin; mipLevel < mipLevelEnd; ++mipLevel)
+            {
+                const RHI::ImageSubresourceLayout layout =
+                    RHI::GetImageSubresourceLayout(descriptor, RHI::ImageSubresource(static_cast<uint16_t>(mipLevel), 0));
+                sizeInBytes += static_cast<size_t>(layout.m_bytesPerImage) * layout.m_size.m_depth;
+            }
+            return sizeInBytes * descriptor.m_arraySize;
+        }
+
         RHI::ResultCode StreamingImage::TrimToMipChainLevel(size_t mipChainIndex)
         {
             AZ_Assert(mipChainIndex < m_mipChains.size(), "Exceeded number of mip chains.");
@@ -101,5 +101,10 @@ namespace AZ
         {
             return m_pool.get();
         }
+
+        StreamingImageController* StreamingImagePool::GetController()
+        {
+            return m_controller.get();
+        }
     }
 }
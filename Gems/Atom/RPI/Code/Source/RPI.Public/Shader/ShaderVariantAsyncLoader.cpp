@@ -9,6 +9,7 @@
 #include <Atom/RPI.Public/Shader/Metrics/ShaderMetricsSystem.h>
 
 #include <AzCore/Component/TickBus.h>
+#include <AzCore/std/sort.h>
 
 #include <Atom/RHI/Factory.h>
 
@@ -31,57 +32,122 @@ namespace AZ
                 });
         }
 
-        void ShaderVariantAsyncLoader::ThreadServiceLoop()
+        namespace
         {
-            AZStd::unordered_set<ShaderVariantAsyncLoader::TupleShaderAssetAndShaderVariantId> newShaderVariantPendingRequests;
-            AZStd::unordered_set<Data::AssetId> shaderVariantTreePendingRequests;
-            AZStd::unordered_set<Data::AssetId> shaderVariantPendingRequests;
-            while (true)
+            // Requests for assets which are not in the catalog yet (e.g. still being built by the Asset Processor) are
+            // retried at this interval. Everything else wakes up the service thread as soon as it happens.
+            constexpr AZStd::chrono::milliseconds BlockedRequestRetryInterval(500);
+
+            // Returns the keys of the pending requests, the ones to service first at the front.
+            template<typename RequestMap>
+            AZStd::vector<typename RequestMap::key_type> GetKeysByPriority(const RequestMap& requests)
             {
-                //We'll wait here until there's work to do or this service has been shutdown.
+                AZStd::vector<const typename RequestMap::value_type*> sortedRequests;
+                sortedRequests.reserve(requests.size());
+                for (const auto& request : requests)
                 {
-                    AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
-                    m_workCondition.wait(lock, [&]
+                    sortedRequests.push_back(&request);
+                }
+
+                AZStd::sort(sortedRequests.begin(), sortedRequests.end(),
+                    [](const auto* lhs, const auto* rhs)
+                    {
+                        if (lhs->second.m_priority != rhs->second.m_priority)
+                        {
+                            return lhs->second.m_priority > rhs->second.m_priority;
+                        }
+                        if (lhs->second.m_requestCount != rhs->second.m_requestCount)
                         {
-                            return m_isServiceShutdown.load() ||
-                                !m_newShaderVariantPendingRequests.empty() ||
-                                !m_shaderVariantTreePendingRequests.empty() ||
-                                !m_shaderVariantPendingRequests.empty() ||
-                                !newShaderVariantPendingRequests.empty() ||
-                                !shaderVariantTreePendingRequests.empty() ||
-                                !shaderVariantPendingRequests.empty();
+                            return lhs->second.m_requestCount > rhs->second.m_requestCount;
                         }
-                    );
+                        return lhs->second.m_requestTime < rhs->second.m_requestTime;
+                    });
+
+                AZStd::vector<typename RequestMap::key_type> keys;
+                keys.reserve(sortedRequests.size());
+                for (const auto* request : sortedRequests)
+                {
+                    keys.push_back(request->first);
                 }
+                return keys;
+            }
 
-                if (m_isServiceShutdown.load())
+            template<typename RequestMap, typename Key, typename Request>
+            void AddPendingRequest(RequestMap& requests, const Key& key, const Request& request)
+            {
+                auto insertResult = requests.emplace(key, request);
+                if (!insertResult.second)
                 {
-                    break;
+                    insertResult.first->second.Merge(request);
                 }
+            }
+        }
+
+        void ShaderVariantAsyncLoader::PendingRequest::Merge(const PendingRequest& other)
+        {
+            m_requestTime = AZStd::min(m_requestTime, other.m_requestTime);
+            m_requestCount += other.m_requestCount;
+            m_priority = AZStd::max(m_priority, other.m_priority);
+        }
+
+        void ShaderVariantAsyncLoader::ThreadServiceLoop()
+        {
+            AZStd::unordered_map<ShaderVariantAsyncLoader::TupleShaderAssetAndShaderVariantId, PendingRequest> newShaderVariantPendingRequests;
+            AZStd::unordered_map<Data::AssetId, PendingRequest> shaderVariantTreePendingRequests;
+            AZStd::unordered_map<Data::AssetId, PendingRequest> shaderVariantPendingRequests;
+            while (true)
+            {
+                const bool hasBlockedRequests =
+                    !newShaderVariantPendingRequests.empty() ||
+                    !shaderVariantTreePendingRequests.empty() ||
+                    !shaderVariantPendingRequests.empty();
 
                 {
-                    //Move pending requests to the local lists.
+                    // We'll wait here until there's new work to do, a shader variant tree became ready (which may unblock
+                    // requests by variant id) or this service has been shutdown. Requests that are still blocked are
+                    // retried after an interval.
                     AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
+                    auto hasWork = [&]
+                    {
+                        return m_isServiceShutdown.load() ||
+                            m_hasNewShaderVariantTrees ||
+                            !m_newShaderVariantPendingRequests.empty() ||
+                            !m_shaderVariantTreePendingRequests.empty() ||
+                            !m_shaderVariantPendingRequests.empty();
+                    };
+                    if (hasBlockedRequests)
+                    {
+                        m_workCondition.wait_for(lock, BlockedRequestRetryInterval, hasWork);
+                    }
+                    else
+                    {
+                        m_workCondition.wait(lock, hasWork);
+                    }
+
+                    if (m_isServiceShutdown.load())
+                    {
+                        break;
+                    }
 
-                    AZStd::for_each(
-                        m_newShaderVariantPendingRequests.begin(), m_newShaderVariantPendingRequests.end(),
-                        [&](const ShaderVariantAsyncLoader::TupleShaderAssetAndShaderVariantId& tuple) {
-                            newShaderVariantPendingRequests.insert(tuple);
-                        });
+                    // Move pending requests to the local lists.
+                    m_hasNewShaderVariantTrees = false;
+
+                    for (const auto& [tuple, request] : m_newShaderVariantPendingRequests)
+                    {
+                        AddPendingRequest(newShaderVariantPendingRequests, tuple, request);
+                    }
                     m_newShaderVariantPendingRequests.clear();
 
-                    AZStd::for_each(m_shaderVariantTreePendingRequests.begin(), m_shaderVariantTreePendingRequests.end(),
-                        [&](const Data::AssetId& assetId)
-                        {
-                            shaderVariantTreePendingRequests.insert(assetId);
-                        });
+                    for (const auto& [assetId, request] : m_shaderVariantTreePendingRequests)
+                    {
+                        AddPendingRequest(shaderVariantTreePendingRequests, assetId, request);
+                    }
                     m_shaderVariantTreePendingRequests.clear();
 
-                    AZStd::for_each(m_shaderVariantPendingRequests.begin(), m_shaderVariantPendingRequests.end(),
-                        [&](const Data::AssetId& assetId)
-                        {
-                            shaderVariantPendingRequests.insert(assetId);
-                        });
+                    for (const auto& [assetId, request] : m_shaderVariantPendingRequests)
+                    {
+                        AddPendingRequest(shaderVariantPendingRequests, assetId, request);
+                    }
                     m_shaderVariantPendingRequests.clear();
                 }
 
@@ -89,13 +155,14 @@ namespace AZ
                 auto tupleItor = newShaderVariantPendingRequests.begin();
                 while (tupleItor != newShaderVariantPendingRequests.end())
                 {
-                    auto shaderVariantTreeAsset = GetShaderVariantTreeAsset(tupleItor->m_shaderAsset.GetId());
+                    const TupleShaderAssetAndShaderVariantId& tuple = tupleItor->first;
+                    auto shaderVariantTreeAsset = GetShaderVariantTreeAsset(tuple.m_shaderAsset.GetId());
                     if (shaderVariantTreeAsset)
                     {
                         AZ_Assert(shaderVariantTreeAsset.IsReady(), "shaderVariantTreeAsset is not ready!");
                         // Get the stableId from the variant tree.
                         auto searchResult = shaderVariantTreeAsset->FindVariantStableId(
-                            tupleItor->m_shaderAsset->GetShaderOptionGroupLayout(), tupleItor->m_shaderVariantId);
+                            tuple.m_shaderAsset->GetShaderOptionGroupLayout(), tuple.m_shaderVariantId);
                         if (searchResult.IsRoot())
                         {
                             tupleItor = newShaderVariantPendingRequests.erase(tupleItor);
@@ -103,49 +170,47 @@ namespace AZ
                         }
 
                         // Record the request for metrics.
-                        ShaderMetricsSystem::Get()->RequestShaderVariant(tupleItor->m_shaderAsset.Get(),  tupleItor->m_shaderVariantId, searchResult);
+                        ShaderMetricsSystem::Get()->RequestShaderVariant(tuple.m_shaderAsset.Get(), tuple.m_shaderVariantId, searchResult);
 
                         uint32_t shaderVariantProductSubId = ShaderVariantAsset::MakeAssetProductSubId(
-                            RHI::Factory::Get().GetAPIUniqueIndex(), tupleItor->m_supervariantIndex.GetIndex(), searchResult.GetStableId());
+                            RHI::Factory::Get().GetAPIUniqueIndex(), tuple.m_supervariantIndex.GetIndex(), searchResult.GetStableId());
                         Data::AssetId shaderVariantAssetId(shaderVariantTreeAsset.GetId().m_guid, shaderVariantProductSubId);
-                        shaderVariantPendingRequests.insert(shaderVariantAssetId);
+                        AddPendingRequest(shaderVariantPendingRequests, shaderVariantAssetId, tupleItor->second);
                         tupleItor = newShaderVariantPendingRequests.erase(tupleItor);
                         continue;
                     }
                     // If we are here the shaderVariantTreeAsset is not ready, but maybe it is already queued for loading,
                     // but we try to queue it anyways.
-                    QueueShaderVariantTreeForLoading(*tupleItor, shaderVariantTreePendingRequests);
+                    QueueShaderVariantTreeForLoading(tuple, tupleItor->second, shaderVariantTreePendingRequests);
                     tupleItor++;
                 }
 
-
-                auto variantTreeItor = shaderVariantTreePendingRequests.begin();
-                while (variantTreeItor != shaderVariantTreePendingRequests.end())
+                // Queue all the loads in one go, most wanted first, so the AssetManager can load them concurrently.
+                for (const Data::AssetId& shaderAssetId : GetKeysByPriority(shaderVariantTreePendingRequests))
                 {
-                    if (TryToLoadShaderVariantTreeAsset(*variantTreeItor))
-                    {
-                        variantTreeItor = shaderVariantTreePendingRequests.erase(variantTreeItor);
-                    }
-                    else
+                    auto variantTreeItor = shaderVariantTreePendingRequests.find(shaderAssetId);
+                    if (TryToLoadShaderVariantTreeAsset(shaderAssetId, variantTreeItor->second))
                     {
-                        variantTreeItor++;
+                        shaderVariantTreePendingRequests.erase(variantTreeItor);
                     }
                 }
 
-                auto variantItor = shaderVariantPendingRequests.begin();
-                while (variantItor != shaderVariantPendingRequests.end())
+                for (const Data::AssetId& shaderVariantAssetId : GetKeysByPriority(shaderVariantPendingRequests))
                 {
-                    if (TryToLoadShaderVariantAsset(*variantItor))
+                    auto variantItor = shaderVariantPendingRequests.find(shaderVariantAssetId);
+                    if (TryToLoadShaderVariantAsset(shaderVariantAssetId, variantItor->second))
                     {
-                        variantItor = shaderVariantPendingRequests.erase(variantItor);
-                    }
-                    else
-                    {
-                        variantItor++;
+                        shaderVariantPendingRequests.erase(variantItor);
                     }
                 }
 
-                AZStd::this_thread::sleep_for(AZStd::chrono::milliseconds(1000));
+                {
+                    AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
+                    m_statistics.m_pendingShaderVariantByIdRequestCount = newShaderVariantPendingRequests.size();
+                    m_statistics.m_pendingShaderVariantTreeRequestCount = shaderVariantTreePendingRequests.size();
+                    m_statistics.m_pendingShaderVariantRequestCount = shaderVariantPendingRequests.size();
+                    m_statistics.m_loadingAssetCount = m_loadRequestTimes.size();
+                }
             }
         }
 
@@ -170,6 +235,35 @@ namespace AZ
             m_shaderVariantPendingRequests.clear();
             m_shaderVariantData.clear();
             m_shaderAssetIdToShaderVariantTreeAssetId.clear();
+            m_loadRequestTimes.clear();
+            m_hasNewShaderVariantTrees = false;
+            m_statistics = {};
+        }
+
+        ShaderVariantAsyncLoader::Statistics ShaderVariantAsyncLoader::GetStatistics() const
+        {
+            AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
+            return m_statistics;
+        }
+
+        void ShaderVariantAsyncLoader::RecordAssetReady(const Data::AssetId& assetId)
+        {
+            auto findIt = m_loadRequestTimes.find(assetId);
+            if (findIt == m_loadRequestTimes.end())
+            {
+                // Reloads, or assets that were ready when they were requested.
+                return;
+            }
+
+            const auto requestToReadyTime =
+                AZStd::chrono::duration_cast<AZStd::chrono::milliseconds>(AZStd::chrono::system_clock::now() - findIt->second);
+            m_loadRequestTimes.erase(findIt);
+
+            ++m_statistics.m_readyAssetCount;
+            m_statistics.m_lastRequestToReadyTime = requestToReadyTime;
+            m_statistics.m_maxRequestToReadyTime = AZStd::max(m_statistics.m_maxRequestToReadyTime, requestToReadyTime);
+            m_statistics.m_totalRequestToReadyTime += requestToReadyTime;
+            m_statistics.m_loadingAssetCount = m_loadRequestTimes.size();
         }
 
 
@@ -186,7 +280,9 @@ namespace AZ
             {
                 AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
                 TupleShaderAssetAndShaderVariantId tuple = {shaderAsset, shaderVariantId, supervariantIndex};
-                m_newShaderVariantPendingRequests.push_back(tuple);
+                // These come from draw items resolving the variant they render with, so they go first.
+                m_newShaderVariantPendingRequests.emplace_back(
+                    tuple, PendingRequest{ AZStd::chrono::system_clock::now(), 1, IO::IStreamerTypes::s_priorityHigh });
             }
             m_workCondition.notify_one();
             return true;
@@ -207,7 +303,8 @@ namespace AZ
             Data::AssetId shaderVariantAssetId(shaderVariantTreeAssetId.m_guid, shaderVariantProductSubId);
             {
                 AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
-                m_shaderVariantPendingRequests.push_back(shaderVariantAssetId);
+                m_shaderVariantPendingRequests.emplace_back(
+                    shaderVariantAssetId, PendingRequest{ AZStd::chrono::system_clock::now(), 1, IO::IStreamerTypes::s_priorityMedium });
             }
             m_workCondition.notify_one();
             return true;
@@ -222,7 +319,9 @@ namespace AZ
 
             {
                 AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
-                m_shaderVariantTreePendingRequests.push_back(shaderAssetId);
+                // Every variant of the shader waits on the tree.
+                m_shaderVariantTreePendingRequests.emplace_back(
+                    shaderAssetId, PendingRequest{ AZStd::chrono::system_clock::now(), 1, IO::IStreamerTypes::s_priorityHigh });
             }
             m_workCondition.notify_one();
             return true;
@@ -386,6 +485,8 @@ namespace AZ
                     ShaderVariantCollection& shaderVariantCollection = findIt->second;
                     shaderAssetId = shaderVariantCollection.m_shaderAssetId;
                     shaderVariantCollection.m_shaderVariantTree = shaderVariantTreeAsset;
+                    RecordAssetReady(shaderVariantTreeAsset.GetId());
+                    m_hasNewShaderVariantTrees = true;
                 }
                 else
                 {
@@ -395,6 +496,9 @@ namespace AZ
                 }
             }
 
+            // Requests by variant id waiting on this tree can be resolved now.
+            m_workCondition.notify_one();
+
             AZ::TickBus::QueueFunction([shaderAssetId, shaderVariantTreeAsset]()
                 {
                     ShaderVariantFinderNotificationBus::Event(
@@ -419,6 +523,7 @@ namespace AZ
                     shaderAssetId = shaderVariantCollection.m_shaderAssetId;
                     auto& shaderVariantMap = shaderVariantCollection.m_shaderVariantsMap;
                     shaderVariantMap.emplace(shaderVariantAsset.GetId(), shaderVariantAsset);
+                    RecordAssetReady(shaderVariantAsset.GetId());
                 }
                 else
                 {
@@ -449,6 +554,7 @@ namespace AZ
                     ShaderVariantCollection& shaderVariantCollection = findIt->second;
                     shaderAssetId = shaderVariantCollection.m_shaderAssetId;
                     m_shaderVariantData.erase(findIt);
+                    m_loadRequestTimes.erase(shaderVariantTreeAsset.GetId());
                 }
                 else
                 {
@@ -473,6 +579,7 @@ namespace AZ
 
             {
                 AZStd::unique_lock<decltype(m_mutex)> lock(m_mutex);
+                m_loadRequestTimes.erase(shaderVariantAsset.GetId());
                 Data::AssetId shaderVariantTreeAssetId(shaderVariantAsset.GetId().m_guid, 0);
                 auto findIt = m_shaderVariantData.find(shaderVariantTreeAssetId);
                 if (findIt != m_shaderVariantData.end())
@@ -499,19 +606,22 @@ namespace AZ
 
         void ShaderVariantAsyncLoader::QueueShaderVariantTreeForLoading(
             const TupleShaderAssetAndShaderVariantId& shaderAndVariantTuple,
-            AZStd::unordered_set<Data::AssetId>& shaderVariantTreePendingRequests)
+            const PendingRequest& request,
+            AZStd::unordered_map<Data::AssetId, PendingRequest>& shaderVariantTreePendingRequests)
         {
             auto shaderAssetId = shaderAndVariantTuple.m_shaderAsset.GetId();
-            if (shaderVariantTreePendingRequests.count(shaderAndVariantTuple.m_shaderAsset.GetId()))
+            auto pendingIt = shaderVariantTreePendingRequests.find(shaderAssetId);
+            if (pendingIt != shaderVariantTreePendingRequests.end())
             {
-                // Already queued.
+                // Already queued, but the tree is as urgent as the variants waiting on it.
+                pendingIt->second.m_priority = AZStd::max(pendingIt->second.m_priority, request.m_priority);
                 return;
             }
 
             Data::AssetId shaderVariantTreeAssetId = ShaderVariantTreeAsset::GetShaderVariantTreeAssetIdFromShaderAssetId(shaderAssetId);
             if (!shaderVariantTreeAssetId.IsValid())
             {
-                shaderVariantTreePendingRequests.insert(shaderAssetId);
+                shaderVariantTreePendingRequests.emplace(shaderAssetId, request);
                 return;
             }
 
@@ -524,10 +634,10 @@ namespace AZ
                     return;
                 }
             }
-            shaderVariantTreePendingRequests.insert(shaderAssetId);
+            shaderVariantTreePendingRequests.emplace(shaderAssetId, request);
         }
 
-        bool ShaderVariantAsyncLoader::TryToLoadShaderVariantTreeAsset(const Data::AssetId& shaderAssetId)
+        bool ShaderVariantAsyncLoader::TryToLoadShaderVariantTreeAsset(const Data::AssetId& shaderAssetId, const PendingRequest& request)
         {
             Data::AssetId shaderVariantTreeAssetId = ShaderVariantTreeAsset::GetShaderVariantTreeAssetIdFromShaderAssetId(shaderAssetId);
             if (!shaderVariantTreeAssetId.IsValid())
@@ -561,7 +671,10 @@ namespace AZ
             Data::AssetBus::MultiHandler::BusDisconnect(shaderVariantTreeAssetId);
 
             //Let's queue the asset for loading.
-            shaderVariantTreeAsset = Data::AssetManager::Instance().GetAsset<AZ::RPI::ShaderVariantTreeAsset>(shaderVariantTreeAssetId, AZ::Data::AssetLoadBehavior::QueueLoad);
+            Data::AssetLoadParameters loadParameters;
+            loadParameters.m_priority = request.m_priority;
+            shaderVariantTreeAsset = Data::AssetManager::Instance().GetAsset<AZ::RPI::ShaderVariantTreeAsset>(
+                shaderVariantTreeAssetId, AZ::Data::AssetLoadBehavior::QueueLoad, loadParameters);
             if (shaderVariantTreeAsset.IsError())
             {
                 // The asset doesn't exist in the database yet. Return false in hope to retry later.
@@ -586,13 +699,14 @@ namespace AZ
                     collection.m_shaderAssetId = shaderAssetId;
                     collection.m_shaderVariantTree = shaderVariantTreeAsset;
                 }
+                m_loadRequestTimes.emplace(shaderVariantTreeAssetId, request.m_requestTime);
             }
 
             Data::AssetBus::MultiHandler::BusConnect(shaderVariantTreeAssetId);
             return true;
         }
 
-        bool ShaderVariantAsyncLoader::TryToLoadShaderVariantAsset(const Data::AssetId& shaderVariantAssetId)
+        bool ShaderVariantAsyncLoader::TryToLoadShaderVariantAsset(const Data::AssetId& shaderVariantAssetId, const PendingRequest& request)
         {
             // Will be used to address the notification bus.
             Data::AssetId shaderAssetId;
@@ -643,7 +757,10 @@ namespace AZ
             }
 
             // Let's queue the asset for loading.
-            shaderVariantAsset = Data::AssetManager::Instance().GetAsset<AZ::RPI::ShaderVariantAsset>(shaderVariantAssetId, AZ::Data::AssetLoadBehavior::QueueLoad);
+            Data::AssetLoadParameters loadParameters;
+            loadParameters.m_priority = request.m_priority;
+            shaderVariantAsset = Data::AssetManager::Instance().GetAsset<AZ::RPI::ShaderVariantAsset>(
+                shaderVariantAssetId, AZ::Data::AssetLoadBehavior::QueueLoad, loadParameters);
             if (shaderVariantAsset.IsError())
             {
                 // The asset exists (we just checked GetAssetInfoById above) but some error occurred.
@@ -659,6 +776,7 @@ namespace AZ
                     ShaderVariantCollection& shaderVariantCollection = findIt->second;
                     auto& shaderVariantMap = shaderVariantCollection.m_shaderVariantsMap;
                     shaderVariantMap.emplace(shaderVariantAssetId, shaderVariantAsset);
+                    m_loadRequestTimes.emplace(shaderVariantAssetId, request.m_requestTime);
                 }
                 else
                 {
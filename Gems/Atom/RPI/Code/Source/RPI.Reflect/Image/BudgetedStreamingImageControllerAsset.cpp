@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Reflect/Image/BudgetedStreamingImageControllerAsset.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Serialization/SerializeContext.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        const Data::AssetId BudgetedStreamingImageControllerAsset::BuiltInAssetId("{8F0D6A53-1C7B-4E29-A4D6-5B3E9C2F7A18}");
+
+        BudgetedStreamingImageControllerAsset::BudgetedStreamingImageControllerAsset()
+        {
+            m_status = AssetStatus::Ready;
+        }
+
+        BudgetedStreamingImageControllerAsset::BudgetedStreamingImageControllerAsset(
+            const Data::AssetId& assetId, size_t memoryBudgetInBytes, uint32_t maxMipExpandsPerUpdate)
+            : m_memoryBudgetInBytes(memoryBudgetInBytes)
+            , m_maxMipExpandsPerUpdate(maxMipExpandsPerUpdate)
+        {
+            m_assetId = assetId;
+            m_status = AssetStatus::Ready;
+        }
+
+        void BudgetedStreamingImageControllerAsset::Reflect(ReflectContext* context)
+        {
+            if (auto* serializeContext = azrtti_cast<SerializeContext*>(context))
+            {
+                serializeContext->Class<BudgetedStreamingImageControllerAsset, StreamingImageControllerAsset>()
+                    ->Version(0)
+                    ->Field("m_memoryBudgetInBytes", &BudgetedStreamingImageControllerAsset::m_memoryBudgetInBytes)
+                    ->Field("m_maxMipExpandsPerUpdate", &BudgetedStreamingImageControllerAsset::m_maxMipExpandsPerUpdate)
+                    ;
+            }
+        }
+
+        size_t BudgetedStreamingImageControllerAsset::GetMemoryBudgetInBytes() const
+        {
+            return aznumeric_cast<size_t>(m_memoryBudgetInBytes);
+        }
+
+        uint32_t BudgetedStreamingImageControllerAsset::GetMaxMipExpandsPerUpdate() const
+        {
+            return m_maxMipExpandsPerUpdate;
+        }
+    }
+}
@@ -7,7 +7,7 @@
  */
 
 #include <Atom/RPI.Reflect/Model/ModelAsset.h>
-#include <Atom/RPI.Reflect/Model/ModelKdTree.h>
+#include <Atom/RPI.Reflect/Model/ModelBvh.h>
 #include <AzCore/Asset/AssetSerializer.h>
 #include <AzCore/Debug/EventTrace.h>
 #include <AzCore/Jobs/JobFunction.h>
@@ -41,12 +41,12 @@ namespace AZ
 
         ModelAsset::ModelAsset()
         {
-            // c-tor and d-tor have to be defined in .cpp in order to have AZStd::unique_ptr<ModelKdTree> without having to include the header of KDTree
+            // c-tor and d-tor have to be defined in .cpp in order to have AZStd::unique_ptr<ModelBvh> without having to include the header of ModelBvh
         }
 
         ModelAsset::~ModelAsset()
         {
-            // c-tor and d-tor have to be defined in .cpp in order to have AZStd::unique_ptr<ModelKdTree> without having to include the header of KDTree
+            // c-tor and d-tor have to be defined in .cpp in order to have AZStd::unique_ptr<ModelBvh> without having to include the header of ModelBvh
         }
 
         const Name& ModelAsset::GetName() const
@@ -103,31 +103,31 @@ namespace AZ
                 m_modelTriangleCount = CalculateTriangleCount();
             }
 
-            // check the total vertex count for this model and skip kd-tree if the model is simple enough
+            // check the total vertex count for this model and skip the bvh if the model is simple enough
             if (*m_modelTriangleCount > s_minimumModelTriangleCountToOptimize)
             {
-                if (!m_kdTree)
+                if (!m_bvh)
                 {
-                    BuildKdTree();
+                    BuildBvh();
 
                     AZ_WarningOnce("Model", false, "ray intersection against a model that is still creating spatial information");
                     return allowBruteForce ? BruteForceRayIntersect(rayStart, rayDir, distanceNormalized, normal) : false;
                 }
                 else
                 {
-                    return m_kdTree->RayIntersection(rayStart, rayDir, distanceNormalized, normal);
+                    return m_bvh->RayIntersection(rayStart, rayDir, distanceNormalized, normal);
                 }
             }
 
             return BruteForceRayIntersect(rayStart, rayDir, distanceNormalized, normal);
         }
 
-        void ModelAsset::BuildKdTree() const
+        void ModelAsset::BuildBvh() const
         {
-            AZStd::lock_guard<AZStd::mutex> lock(m_kdTreeLock);
-            if (m_isKdTreeCalculationRunning == false)
+            AZStd::lock_guard<AZStd::mutex> lock(m_bvhLock);
+            if (m_isBvhCalculationRunning == false)
             {
-                m_isKdTreeCalculationRunning = true;
+                m_isBvhCalculationRunning = true;
 
                 // ModelAsset can go away while the job is queued up or is in progress, keep it alive until the job is done
                 const_cast<ModelAsset*>(this)->Acquire();
@@ -139,12 +139,12 @@ namespace AZ
                 {
                     AZ_TRACE_METHOD();
 
-                    AZStd::unique_ptr<ModelKdTree> tree = AZStd::make_unique<ModelKdTree>();
-                    tree->Build(this);
+                    AZStd::unique_ptr<ModelBvh> bvh = AZStd::make_unique<ModelBvh>();
+                    bvh->Build(this);
 
-                    AZStd::lock_guard<AZStd::mutex> jobLock(m_kdTreeLock);
-                    m_isKdTreeCalculationRunning = false;
-                    m_kdTree = AZStd::move(tree);
+                    AZStd::lock_guard<AZStd::mutex> jobLock(m_bvhLock);
+                    m_isBvhCalculationRunning = false;
+                    m_bvh = AZStd::move(bvh);
 
                     const_cast<ModelAsset*>(this)->Release();
                 };
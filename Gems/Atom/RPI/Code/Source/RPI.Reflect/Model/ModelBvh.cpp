@@ -0,0 +1,628 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Atom/RPI.Reflect/Model/ModelBvh.h>
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Math/IntersectSegment.h>
+#include <AzCore/Math/SimdMath.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/fixed_vector.h>
+
+namespace AZ
+{
+    namespace RPI
+    {
+        namespace
+        {
+            using TriangleIndices = AZStd::tuple<uint32_t, uint32_t, uint32_t>;
+
+            // Boxes are culled against the end of the ray and the nearest hit with a little slack, so that a triangle lying
+            // exactly on a face of its box is not lost to rounding in the slab test
+            constexpr float BoxCullingEpsilon = 1.0e-4f;
+
+            // Per ray values of the slab test, splatted once so each node is tested against four children at once
+            struct SimdRay
+            {
+                Simd::Vec4::FloatType m_originX;
+                Simd::Vec4::FloatType m_originY;
+                Simd::Vec4::FloatType m_originZ;
+                Simd::Vec4::FloatType m_inverseDirX;
+                Simd::Vec4::FloatType m_inverseDirY;
+                Simd::Vec4::FloatType m_inverseDirZ;
+
+                SimdRay(const AZ::Vector3& raySrc, const AZ::Vector3& rayDir)
+                {
+                    // Avoid infinities in the slab test, which turn into NaNs when a ray starts on the plane of a slab
+                    const auto safeInverse = [](float value)
+                    {
+                        constexpr float MinDirection = 1.0e-20f;
+                        return 1.0f / (AZ::GetAbs(value) < MinDirection ? (value < 0.0f ? -MinDirection : MinDirection) : value);
+                    };
+
+                    m_originX = Simd::Vec4::Splat(raySrc.GetX());
+                    m_originY = Simd::Vec4::Splat(raySrc.GetY());
+                    m_originZ = Simd::Vec4::Splat(raySrc.GetZ());
+                    m_inverseDirX = Simd::Vec4::Splat(safeInverse(rayDir.GetX()));
+                    m_inverseDirY = Simd::Vec4::Splat(safeInverse(rayDir.GetY()));
+                    m_inverseDirZ = Simd::Vec4::Splat(safeInverse(rayDir.GetZ()));
+                }
+            };
+
+            template<typename NodeType>
+            void IntersectChildren(
+                const NodeType& node, const SimdRay& ray, float maxDistanceNormalized, float (&outNearDistances)[4], int32_t (&outHits)[4])
+            {
+                using namespace Simd;
+
+                const Vec4::FloatType minX = Vec4::Mul(Vec4::Sub(Vec4::LoadAligned(node.m_minX), ray.m_originX), ray.m_inverseDirX);
+                const Vec4::FloatType maxX = Vec4::Mul(Vec4::Sub(Vec4::LoadAligned(node.m_maxX), ray.m_originX), ray.m_inverseDirX);
+                const Vec4::FloatType minY = Vec4::Mul(Vec4::Sub(Vec4::LoadAligned(node.m_minY), ray.m_originY), ray.m_inverseDirY);
+                const Vec4::FloatType maxY = Vec4::Mul(Vec4::Sub(Vec4::LoadAligned(node.m_maxY), ray.m_originY), ray.m_inverseDirY);
+                const Vec4::FloatType minZ = Vec4::Mul(Vec4::Sub(Vec4::LoadAligned(node.m_minZ), ray.m_originZ), ray.m_inverseDirZ);
+                const Vec4::FloatType maxZ = Vec4::Mul(Vec4::Sub(Vec4::LoadAligned(node.m_maxZ), ray.m_originZ), ray.m_inverseDirZ);
+
+                const Vec4::FloatType nearDistance = Vec4::Max(
+                    Vec4::Max(Vec4::Min(minX, maxX), Vec4::Min(minY, maxY)),
+                    Vec4::Max(Vec4::Min(minZ, maxZ), Vec4::ZeroFloat()));
+                const Vec4::FloatType farDistance = Vec4::Min(
+                    Vec4::Min(Vec4::Max(minX, maxX), Vec4::Max(minY, maxY)),
+                    Vec4::Min(Vec4::Max(minZ, maxZ), Vec4::Splat(maxDistanceNormalized + BoxCullingEpsilon)));
+
+                Vec4::StoreAligned(outNearDistances, nearDistance);
+                Vec4::StoreAligned(outHits, Vec4::CastToInt(Vec4::CmpLtEq(nearDistance, farDistance)));
+            }
+        }
+
+        bool ModelBvh::Build(const ModelAsset* model)
+        {
+            AZ_PROFILE_SCOPE(RPI, "ModelBvh: Build");
+
+            if (model == nullptr)
+            {
+                return false;
+            }
+
+            m_nodes.clear();
+            m_leaves.clear();
+            m_triangles.clear();
+
+            AZStd::vector<Triangle> triangles;
+            const ModelLodAsset* lodAsset = model->GetLodAssets().empty() ? nullptr : model->GetLodAssets()[0].Get();
+            if (lodAsset)
+            {
+                for (const ModelLodAsset::Mesh& mesh : lodAsset->GetMeshes())
+                {
+                    const AZStd::array_view<float> positionBuffer = mesh.GetSemanticBufferTyped<float>(AZ::Name{ "POSITION" });
+                    AZ_Warning("ModelBvh", !positionBuffer.empty(), "Could not find position buffers in a mesh");
+                    const size_t vertexCount = positionBuffer.size() / 3;
+
+                    const auto getPosition = [&positionBuffer](uint32_t index)
+                    {
+                        return AZ::Vector3(positionBuffer[index * 3 + 0], positionBuffer[index * 3 + 1], positionBuffer[index * 3 + 2]);
+                    };
+
+                    // The view returned by GetIndexBufferTyped returns a tuple<uint32_t, uint32_t, uint32_t>, in order to
+                    // read 3 values at a time from the raw index buffer. The cast results in the order of the indices being
+                    // reversed, which is why they are read [third, second, first] here.
+                    for (const auto& [thirdIndex, secondIndex, firstIndex] : mesh.GetIndexBufferTyped<TriangleIndices>())
+                    {
+                        if (firstIndex >= vertexCount || secondIndex >= vertexCount || thirdIndex >= vertexCount)
+                        {
+                            continue;
+                        }
+                        triangles.push_back({ { getPosition(firstIndex), getPosition(secondIndex), getPosition(thirdIndex) } });
+                    }
+                }
+            }
+
+            if (triangles.empty())
+            {
+                return true;
+            }
+
+            const uint32_t triangleCount = aznumeric_cast<uint32_t>(triangles.size());
+            AZStd::vector<BuildTriangle> buildTriangles;
+            buildTriangles.reserve(triangleCount);
+            for (uint32_t triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex)
+            {
+                const Triangle& triangle = triangles[triangleIndex];
+                AZ::Aabb bounds = AZ::Aabb::CreateFromPoint(triangle.m_vertices[0]);
+                bounds.AddPoint(triangle.m_vertices[1]);
+                bounds.AddPoint(triangle.m_vertices[2]);
+                buildTriangles.push_back({ bounds, bounds.GetCenter(), triangleIndex });
+            }
+
+            BuildNode root;
+            JobContext* jobContext = JobContext::GetGlobalContext();
+            if (jobContext && triangleCount > MinTrianglesPerBuildJob)
+            {
+                Job* rootJob = CreateJobFunction(
+                    [this, &root, &buildTriangles, triangleCount](Job& job)
+                    {
+                        BuildRecursively(&root, buildTriangles, 0, triangleCount, 0, &job);
+                    },
+                    true, jobContext);
+                rootJob->StartAndWaitForCompletion();
+            }
+            else
+            {
+                BuildRecursively(&root, buildTriangles, 0, triangleCount, 0, nullptr);
+            }
+
+            // Leaves refer to ranges of the build triangles, store the triangles in that order
+            m_triangles.reserve(triangleCount);
+            for (const BuildTriangle& buildTriangle : buildTriangles)
+            {
+                m_triangles.push_back(triangles[buildTriangle.m_triangleIndex]);
+            }
+
+            if (root.IsLeaf())
+            {
+                m_nodes.emplace_back();
+                SetChild(0, 0, root);
+                for (uint32_t lane = 1; lane < 4; ++lane)
+                {
+                    m_nodes[0].m_childTypes[lane] = ChildType::Empty;
+                }
+            }
+            else
+            {
+                Flatten(root);
+            }
+
+            return true;
+        }
+
+        void ModelBvh::BuildRecursively(
+            BuildNode* node, AZStd::vector<BuildTriangle>& buildTriangles, uint32_t first, uint32_t count, uint32_t depth, AZ::Job* job)
+        {
+            AZ::Aabb bounds = AZ::Aabb::CreateNull();
+            AZ::Aabb centroidBounds = AZ::Aabb::CreateNull();
+            for (uint32_t index = first; index < first + count; ++index)
+            {
+                bounds.AddAabb(buildTriangles[index].m_bounds);
+                centroidBounds.AddPoint(buildTriangles[index].m_centroid);
+            }
+
+            node->m_bounds = bounds;
+            node->m_firstTriangle = first;
+            node->m_triangleCount = count;
+
+            if (count <= 2 || depth >= MaxDepth)
+            {
+                return;
+            }
+
+            uint32_t leftCount = FindSplit(buildTriangles, first, count, bounds, centroidBounds);
+            if (leftCount == 0)
+            {
+                if (count <= MaxTrianglesInLeaf)
+                {
+                    return;
+                }
+
+                // No split is better than a leaf, but the leaf would be too large: split at the median centroid instead
+                const AZ::Vector3 centroidExtents = centroidBounds.GetExtents();
+                const int32_t axis = centroidExtents.GetX() >= centroidExtents.GetY()
+                    ? (centroidExtents.GetX() >= centroidExtents.GetZ() ? 0 : 2)
+                    : (centroidExtents.GetY() >= centroidExtents.GetZ() ? 1 : 2);
+                leftCount = count / 2;
+                std::nth_element(
+                    buildTriangles.begin() + first, buildTriangles.begin() + first + leftCount, buildTriangles.begin() + first + count,
+                    [axis](const BuildTriangle& lhs, const BuildTriangle& rhs)
+                    {
+                        return lhs.m_centroid.GetElement(axis) < rhs.m_centroid.GetElement(axis);
+                    });
+            }
+
+            node->m_children[0] = AZStd::make_unique<BuildNode>();
+            node->m_children[1] = AZStd::make_unique<BuildNode>();
+
+            const uint32_t childFirst[2] = { first, first + leftCount };
+            const uint32_t childCount[2] = { leftCount, count - leftCount };
+
+            // The two halves of the range are disjoint, so they are built in parallel while they are large enough to be worth a job
+            if (job && count > MinTrianglesPerBuildJob)
+            {
+                for (uint32_t childIndex = 0; childIndex < 2; ++childIndex)
+                {
+                    BuildNode* child = node->m_children[childIndex].get();
+                    const uint32_t childRangeFirst = childFirst[childIndex];
+                    const uint32_t childRangeCount = childCount[childIndex];
+                    job->StartAsChild(CreateJobFunction(
+                        [this, child, &buildTriangles, childRangeFirst, childRangeCount, depth](Job& childJob)
+                        {
+                            BuildRecursively(child, buildTriangles, childRangeFirst, childRangeCount, depth + 1, &childJob);
+                        },
+                        true, job->GetContext()));
+                }
+                job->WaitForChildren();
+            }
+            else
+            {
+                for (uint32_t childIndex = 0; childIndex < 2; ++childIndex)
+                {
+                    BuildRecursively(
+                        node->m_children[childIndex].get(), buildTriangles, childFirst[childIndex], childCount[childIndex], depth + 1, nullptr);
+                }
+            }
+        }
+
+        uint32_t ModelBvh::FindSplit(
+            AZStd::vector<BuildTriangle>& buildTriangles, uint32_t first, uint32_t count, const AZ::Aabb& bounds, const AZ::Aabb& centroidBounds)
+        {
+            const float parentArea = bounds.GetSurfaceArea();
+            if (parentArea <= 0.0f)
+            {
+                return 0;
+            }
+
+            // Cost of a triangle test relative to a traversal step is 1, so the cost of a leaf is its triangle count
+            constexpr float TraversalCost = 1.0f;
+            float bestCost = aznumeric_cast<float>(count);
+            int32_t bestAxis = -1;
+            uint32_t bestBin = 0;
+
+            for (int32_t axis = 0; axis < 3; ++axis)
+            {
+                const float centroidMin = centroidBounds.GetMin().GetElement(axis);
+                const float centroidExtent = centroidBounds.GetMax().GetElement(axis) - centroidMin;
+                if (centroidExtent <= 0.0f)
+                {
+                    continue;
+                }
+
+                const float binScale = BinCount / centroidExtent;
+                AZStd::array<AZ::Aabb, BinCount> binBounds;
+                AZStd::array<uint32_t, BinCount> binCounts;
+                binBounds.fill(AZ::Aabb::CreateNull());
+                binCounts.fill(0);
+
+                for (uint32_t index = first; index < first + count; ++index)
+                {
+                    const float offset = (buildTriangles[index].m_centroid.GetElement(axis) - centroidMin) * binScale;
+                    const uint32_t bin = AZStd::min(aznumeric_cast<uint32_t>(offset), BinCount - 1);
+                    binBounds[bin].AddAabb(buildTriangles[index].m_bounds);
+                    ++binCounts[bin];
+                }
+
+                // Sweep from the right to get the cost of the right side of each split, then from the left to evaluate them
+                AZStd::array<float, BinCount> rightCosts;
+                AZ::Aabb rightBounds = AZ::Aabb::CreateNull();
+                uint32_t rightCount = 0;
+                for (uint32_t bin = BinCount - 1; bin > 0; --bin)
+                {
+                    rightBounds.AddAabb(binBounds[bin]);
+                    rightCount += binCounts[bin];
+                    rightCosts[bin] = rightCount ? rightBounds.GetSurfaceArea() * rightCount : 0.0f;
+                }
+
+                AZ::Aabb leftBounds = AZ::Aabb::CreateNull();
+                uint32_t leftCount = 0;
+                for (uint32_t bin = 0; bin < BinCount - 1; ++bin)
+                {
+                    leftBounds.AddAabb(binBounds[bin]);
+                    leftCount += binCounts[bin];
+                    if (leftCount == 0 || leftCount == count)
+                    {
+                        continue;
+                    }
+
+                    const float cost = TraversalCost + (leftBounds.GetSurfaceArea() * leftCount + rightCosts[bin + 1]) / parentArea;
+                    if (cost < bestCost)
+                    {
+                        bestCost = cost;
+                        bestAxis = axis;
+                        bestBin = bin;
+                    }
+                }
+            }
+
+            if (bestAxis < 0)
+            {
+                return 0;
+            }
+
+            const float centroidMin = centroidBounds.GetMin().GetElement(bestAxis);
+            const float binScale = BinCount / (centroidBounds.GetMax().GetElement(bestAxis) - centroidMin);
+            const auto middle = std::partition(
+                buildTriangles.begin() + first, buildTriangles.begin() + first + count,
+                [=](const BuildTriangle& buildTriangle)
+                {
+                    const float offset = (buildTriangle.m_centroid.GetElement(bestAxis) - centroidMin) * binScale;
+                    return AZStd::min(aznumeric_cast<uint32_t>(offset), BinCount - 1) <= bestBin;
+                });
+
+            const uint32_t leftCount = aznumeric_cast<uint32_t>(middle - (buildTriangles.begin() + first));
+            return leftCount == count ? 0 : leftCount;
+        }
+
+        uint32_t ModelBvh::Flatten(const BuildNode& node)
+        {
+            // Collapse up to three levels of the binary tree into one node, always opening the child with the largest area
+            AZStd::fixed_vector<const BuildNode*, 4> children{ node.m_children[0].get(), node.m_children[1].get() };
+            while (children.size() < 4)
+            {
+                size_t openIndex = children.size();
+                float largestArea = -1.0f;
+                for (size_t childIndex = 0; childIndex < children.size(); ++childIndex)
+                {
+                    const float area = children[childIndex]->m_bounds.GetSurfaceArea();
+                    if (!children[childIndex]->IsLeaf() && area > largestArea)
+                    {
+                        openIndex = childIndex;
+                        largestArea = area;
+                    }
+                }
+
+                if (openIndex == children.size())
+                {
+                    break;
+                }
+
+                const BuildNode* opened = children[openIndex];
+                children[openIndex] = opened->m_children[0].get();
+                children.push_back(opened->m_children[1].get());
+            }
+
+            const uint32_t nodeIndex = aznumeric_cast<uint32_t>(m_nodes.size());
+            m_nodes.emplace_back();
+
+            for (uint32_t lane = 0; lane < 4; ++lane)
+            {
+                if (lane < children.size())
+                {
+                    SetChild(nodeIndex, lane, *children[lane]);
+                }
+                else
+                {
+                    Node& emptyNode = m_nodes[nodeIndex];
+                    emptyNode.m_minX[lane] = emptyNode.m_minY[lane] = emptyNode.m_minZ[lane] = 0.0f;
+                    emptyNode.m_maxX[lane] = emptyNode.m_maxY[lane] = emptyNode.m_maxZ[lane] = 0.0f;
+                    emptyNode.m_children[lane] = 0;
+                    emptyNode.m_childTypes[lane] = ChildType::Empty;
+                }
+            }
+
+            return nodeIndex;
+        }
+
+        void ModelBvh::SetChild(uint32_t nodeIndex, uint32_t lane, const BuildNode& child)
+        {
+            uint32_t childIndex = 0;
+            ChildType childType = ChildType::Leaf;
+            if (child.IsLeaf())
+            {
+                childIndex = aznumeric_cast<uint32_t>(m_leaves.size());
+                m_leaves.push_back({ child.m_firstTriangle, child.m_triangleCount });
+            }
+            else
+            {
+                // Flattening the child grows m_nodes, so the node is only referenced after it returns
+                childIndex = Flatten(child);
+                childType = ChildType::Node;
+            }
+
+            Node& node = m_nodes[nodeIndex];
+            const AZ::Vector3& min = child.m_bounds.GetMin();
+            const AZ::Vector3& max = child.m_bounds.GetMax();
+            node.m_minX[lane] = min.GetX();
+            node.m_minY[lane] = min.GetY();
+            node.m_minZ[lane] = min.GetZ();
+            node.m_maxX[lane] = max.GetX();
+            node.m_maxY[lane] = max.GetY();
+            node.m_maxZ[lane] = max.GetZ();
+            node.m_children[lane] = childIndex;
+            node.m_childTypes[lane] = childType;
+        }
+
+        void ModelBvh::IntersectLeaf(
+            const Leaf& leaf, const AZ::Vector3& raySrc, const AZ::Vector3& rayEnd, float& distanceNormalized, AZ::Vector3& normal) const
+        {
+            for (uint32_t triangleIndex = leaf.m_firstTriangle; triangleIndex < leaf.m_firstTriangle + leaf.m_triangleCount; ++triangleIndex)
+            {
+                const Triangle& triangle = m_triangles[triangleIndex];
+
+                float hitDistanceNormalized;
+                AZ::Vector3 intersectionNormal;
+                if (Intersect::IntersectSegmentTriangleCCW(
+                        raySrc, rayEnd, triangle.m_vertices[0], triangle.m_vertices[1], triangle.m_vertices[2], intersectionNormal,
+                        hitDistanceNormalized))
+                {
+                    if (distanceNormalized > hitDistanceNormalized)
+                    {
+                        normal = intersectionNormal;
+                        distanceNormalized = hitDistanceNormalized;
+                    }
+                }
+            }
+        }
+
+        bool ModelBvh::RayIntersection(
+            const AZ::Vector3& raySrc, const AZ::Vector3& rayDir, float& distanceNormalized, AZ::Vector3& normal) const
+        {
+            if (m_nodes.empty())
+            {
+                return false;
+            }
+
+            struct StackEntry
+            {
+                uint32_t m_nodeIndex;
+                float m_nearDistance;
+            };
+            // Each level of the tree pushes at most four children in place of the popped node
+            AZStd::fixed_vector<StackEntry, 3 * MaxDepth + 4> stack;
+            stack.push_back({ 0, 0.0f });
+
+            const SimdRay simdRay(raySrc, rayDir);
+            const AZ::Vector3 rayEnd = raySrc + rayDir;
+            float nearestDistanceNormalized = AZStd::numeric_limits<float>::max();
+
+            while (!stack.empty())
+            {
+                const StackEntry entry = stack.back();
+                stack.pop_back();
+
+                if (entry.m_nearDistance > nearestDistanceNormalized + BoxCullingEpsilon)
+                {
+                    continue;
+                }
+
+                const Node& node = m_nodes[entry.m_nodeIndex];
+                alignas(16) float nearDistances[4];
+                alignas(16) int32_t hits[4];
+                IntersectChildren(node, simdRay, AZStd::min(nearestDistanceNormalized, 1.0f), nearDistances, hits);
+
+                // Visit the children nearest first, so that the nearest hit culls as much of the rest as possible
+                AZStd::fixed_vector<uint32_t, 4> hitLanes;
+                for (uint32_t lane = 0; lane < 4; ++lane)
+                {
+                    if (hits[lane] && node.m_childTypes[lane] != ChildType::Empty)
+                    {
+                        auto position = hitLanes.end();
+                        while (position != hitLanes.begin() && nearDistances[*(position - 1)] > nearDistances[lane])
+                        {
+                            --position;
+                        }
+                        hitLanes.insert(position, lane);
+                    }
+                }
+
+                // Leaves are tested right away in near to far order, child nodes are pushed far to near so the nearest is popped first
+                for (const uint32_t lane : hitLanes)
+                {
+                    if (node.m_childTypes[lane] == ChildType::Leaf)
+                    {
+                        IntersectLeaf(m_leaves[node.m_children[lane]], raySrc, rayEnd, nearestDistanceNormalized, normal);
+                    }
+                }
+                for (auto lane = hitLanes.rbegin(); lane != hitLanes.rend(); ++lane)
+                {
+                    if (node.m_childTypes[*lane] == ChildType::Node)
+                    {
+                        stack.push_back({ node.m_children[*lane], nearDistances[*lane] });
+                    }
+                }
+            }
+
+            if (nearestDistanceNormalized < AZStd::numeric_limits<float>::max())
+            {
+                distanceNormalized = nearestDistanceNormalized;
+                return true;
+            }
+
+            return false;
+        }
+
+        uint32_t ModelBvh::RayIntersections(AZStd::vector<Ray>& rays) const
+        {
+            AZ_PROFILE_SCOPE(RPI, "ModelBvh: RayIntersections");
+
+            for (Ray& ray : rays)
+            {
+                ray.m_distanceNormalized = AZStd::numeric_limits<float>::max();
+                ray.m_hit = false;
+            }
+
+            if (m_nodes.empty())
+            {
+                return 0;
+            }
+
+            struct StackEntry
+            {
+                uint32_t m_nodeIndex;
+                //! Bit per ray of the packet whose ray reached the node.
+                uint32_t m_activeRays;
+            };
+
+            uint32_t hitCount = 0;
+            for (size_t packetBegin = 0; packetBegin < rays.size(); packetBegin += PacketSize)
+            {
+                const uint32_t packetRayCount = aznumeric_cast<uint32_t>(AZStd::min<size_t>(PacketSize, rays.size() - packetBegin));
+                Ray* packet = rays.data() + packetBegin;
+
+                AZStd::fixed_vector<SimdRay, PacketSize> simdRays;
+                AZStd::fixed_vector<AZ::Vector3, PacketSize> rayEnds;
+                for (uint32_t rayIndex = 0; rayIndex < packetRayCount; ++rayIndex)
+                {
+                    simdRays.emplace_back(packet[rayIndex].m_raySrc, packet[rayIndex].m_rayDir);
+                    rayEnds.push_back(packet[rayIndex].m_raySrc + packet[rayIndex].m_rayDir);
+                }
+
+                AZStd::fixed_vector<StackEntry, 3 * MaxDepth + 4> stack;
+                stack.push_back({ 0, (1u << packetRayCount) - 1 });
+
+                while (!stack.empty())
+                {
+                    const StackEntry entry = stack.back();
+                    stack.pop_back();
+
+                    // Each node is fetched once and its children are tested against every ray of the packet that reached it
+                    const Node& node = m_nodes[entry.m_nodeIndex];
+                    uint32_t laneRays[4] = { 0, 0, 0, 0 };
+                    for (uint32_t rayIndex = 0; rayIndex < packetRayCount; ++rayIndex)
+                    {
+                        if ((entry.m_activeRays & (1u << rayIndex)) == 0)
+                        {
+                            continue;
+                        }
+
+                        alignas(16) float nearDistances[4];
+                        alignas(16) int32_t hits[4];
+                        IntersectChildren(
+                            node, simdRays[rayIndex], AZStd::min(packet[rayIndex].m_distanceNormalized, 1.0f), nearDistances, hits);
+                        for (uint32_t lane = 0; lane < 4; ++lane)
+                        {
+                            if (hits[lane])
+                            {
+                                laneRays[lane] |= 1u << rayIndex;
+                            }
+                        }
+                    }
+
+                    for (uint32_t lane = 0; lane < 4; ++lane)
+                    {
+                        if (laneRays[lane] == 0 || node.m_childTypes[lane] == ChildType::Empty)
+                        {
+                            continue;
+                        }
+
+                        if (node.m_childTypes[lane] == ChildType::Node)
+                        {
+                            stack.push_back({ node.m_children[lane], laneRays[lane] });
+                            continue;
+                        }
+
+                        const Leaf& leaf = m_leaves[node.m_children[lane]];
+                        for (uint32_t rayIndex = 0; rayIndex < packetRayCount; ++rayIndex)
+                        {
+                            if (laneRays[lane] & (1u << rayIndex))
+                            {
+                                Ray& ray = packet[rayIndex];
+                                IntersectLeaf(leaf, ray.m_raySrc, rayEnds[rayIndex], ray.m_distanceNormalized, ray.m_normal);
+                            }
+                        }
+                    }
+                }
+
+                for (uint32_t rayIndex = 0; rayIndex < packetRayCount; ++rayIndex)
+                {
+                    Ray& ray = packet[rayIndex];
+                    ray.m_hit = ray.m_distanceNormalized < AZStd::numeric_limits<float>::max();
+                    hitCount += ray.m_hit ? 1 : 0;
+                }
+            }
+
+            return hitCount;
+        }
+    } // namespace RPI
+} // namespace AZ
@@ -16,12 +16,14 @@
 #include <Atom/RPI.Reflect/Image/StreamingImagePoolAsset.h>
 #include <Atom/RPI.Reflect/Image/StreamingImagePoolAssetCreator.h>
 #include <Atom/RPI.Reflect/Image/DefaultStreamingImageControllerAsset.h>
+#include <Atom/RPI.Reflect/Image/BudgetedStreamingImageControllerAsset.h>
 #include <Atom/RPI.Reflect/Asset/BuiltInAssetHandler.h>
 
 #include <Atom/RPI.Public/Image/ImageSystemInterface.h>
 #include <Atom/RPI.Public/Image/StreamingImage.h>
 #include <Atom/RPI.Public/Image/StreamingImagePool.h>
 #include <Atom/RPI.Public/Image/DefaultStreamingImageController.h>
+#include <Atom/RPI.Public/Image/BudgetedStreamingImageController.h>
 
 #include <AtomCore/Instance/InstanceDatabase.h>
 
@@ -413,17 +415,24 @@ namespace UnitTest
         {
             using namespace AZ;
 
+            return BuildImagePoolAsset(budgetInBytes,
+                Data::AssetManager::Instance().GetAsset<RPI::DefaultStreamingImageControllerAsset>(
+                    m_testControllerAssetId,
+                    Data::AssetLoadBehavior::PreLoad));
+        }
+
+        AZ::Data::Asset<AZ::RPI::StreamingImagePoolAsset> BuildImagePoolAsset(
+            size_t budgetInBytes, const AZ::Data::Asset<AZ::RPI::StreamingImageControllerAsset>& controllerAsset)
+        {
+            using namespace AZ;
+
             RPI::StreamingImagePoolAssetCreator assetCreator;
 
             assetCreator.Begin(Data::AssetId(Uuid::CreateRandom()));
 
             assetCreator.SetPoolDescriptor(AZStd::make_unique<TestStreamingImagePoolDescriptor>(budgetInBytes));
 
-            assetCreator.SetControllerAsset(
-                Data::AssetManager::Instance().GetAsset<RPI::DefaultStreamingImageControllerAsset>(
-                    m_testControllerAssetId,
-                    Data::AssetLoadBehavior::PreLoad)
-            );
+            assetCreator.SetControllerAsset(controllerAsset);
 
             Data::Asset<RPI::StreamingImagePoolAsset> poolAsset;
             EXPECT_TRUE(assetCreator.End(poolAsset));
@@ -434,6 +443,11 @@ namespace UnitTest
         }
 
         AZ::Data::Asset<AZ::RPI::StreamingImageAsset> BuildTestImage()
+        {
+            return BuildTestImage(m_defaultPool->GetAssetId());
+        }
+
+        AZ::Data::Asset<AZ::RPI::StreamingImageAsset> BuildTestImage(const AZ::Data::AssetId& poolAssetId)
         {
             using namespace AZ;
 
@@ -460,7 +474,7 @@ namespace UnitTest
             assetCreator.AddMipChainAsset(*mipHead.Get());
             assetCreator.AddMipChainAsset(*mipMiddle.Get());
             assetCreator.AddMipChainAsset(*mipTail.Get());
-            assetCreator.SetPoolAssetId(m_defaultPool->GetAssetId());
+            assetCreator.SetPoolAssetId(poolAssetId);
 
             Data::Asset<RPI::StreamingImageAsset> imageAsset;
             EXPECT_TRUE(assetCreator.End(imageAsset));
@@ -726,4 +740,114 @@ namespace UnitTest
 
         RPI::ImageSystemInterface::Get()->Update();
     }
+
+    TEST_F(StreamingImageTests, BudgetedControllerGrantsRequestedMipsWithinBudget)
+    {
+        using namespace AZ;
+
+        Data::Asset<RPI::StreamingImageAsset> imageAsset = BuildTestImage();
+        Data::Instance<RPI::StreamingImage> sizeImage = RPI::StreamingImage::FindOrCreate(imageAsset);
+        const size_t tailSize = sizeImage->GetMipChainSizeInBytes(2);
+        const size_t middleSize = sizeImage->GetMipChainSizeInBytes(1);
+        const size_t headSize = sizeImage->GetMipChainSizeInBytes(0);
+        EXPECT_GT(headSize, middleSize);
+        EXPECT_GT(middleSize, tailSize);
+
+        // Enough for one image at full detail, and the middle mip chain of another.
+        const size_t budgetInBytes = 2 * tailSize + headSize + middleSize + middleSize;
+
+        Data::Asset<RPI::BudgetedStreamingImageControllerAsset> controllerAsset(
+            aznew RPI::BudgetedStreamingImageControllerAsset(Data::AssetId(Uuid::CreateRandom()), budgetInBytes, 20),
+            Data::AssetLoadBehavior::PreLoad);
+
+        Data::Asset<RPI::StreamingImagePoolAsset> poolAsset = BuildImagePoolAsset(16 * 1024 * 1024, controllerAsset);
+        Data::Instance<RPI::StreamingImagePool> pool = RPI::StreamingImagePool::FindOrCreate(poolAsset);
+        ASSERT_NE(pool.get(), nullptr);
+
+        auto* controller = azrtti_cast<RPI::BudgetedStreamingImageController*>(pool->GetController());
+        ASSERT_NE(controller, nullptr);
+        EXPECT_EQ(controller->GetMemoryBudget(), budgetInBytes);
+
+        Data::Asset<RPI::StreamingImageAsset> imageAssetA = BuildTestImage(pool->GetAssetId());
+        Data::Asset<RPI::StreamingImageAsset> imageAssetB = BuildTestImage(pool->GetAssetId());
+        Data::Instance<RPI::StreamingImage> imageA = RPI::StreamingImage::FindOrCreate(imageAssetA);
+        Data::Instance<RPI::StreamingImage> imageB = RPI::StreamingImage::FindOrCreate(imageAssetB);
+
+        // A wants full detail, B only the middle mip chain. Both fit.
+        imageA->SetTargetMip(0);
+        imageB->SetTargetMip(static_cast<uint16_t>(imageAssetB->GetMipLevel(1)));
+        RPI::ImageSystemInterface::Get()->Update();
+
+        EXPECT_EQ(imageA->GetRHIImage()->GetResidentMipLevel(), 0);
+        EXPECT_EQ(imageB->GetRHIImage()->GetResidentMipLevel(), imageAssetB->GetMipLevel(1));
+
+        // Now B wants full detail and A isn't used. A has to give up its head mip chain to make room for B.
+        imageB->SetTargetMip(0);
+        RPI::ImageSystemInterface::Get()->Update();
+
+        EXPECT_EQ(imageB->GetRHIImage()->GetResidentMipLevel(), 0);
+        EXPECT_EQ(imageA->GetRHIImage()->GetResidentMipLevel(), imageAssetA->GetMipLevel(1));
+
+        const RPI::BudgetedStreamingImageController::Statistics statistics = controller->GetStatistics();
+        EXPECT_EQ(statistics.m_imageCount, 2u);
+        EXPECT_EQ(statistics.m_memoryBudgetInBytes, budgetInBytes);
+        EXPECT_LE(statistics.m_grantedSizeInBytes, budgetInBytes);
+        EXPECT_EQ(statistics.m_mipTrimCount, 1u);
+        EXPECT_EQ(statistics.m_mipExpandCount, 1u);
+
+        // Without an override the controller falls back to the budget of the pool, which fits both images.
+        controller->SetMemoryBudget(0);
+        EXPECT_EQ(controller->GetMemoryBudget(), 16u * 1024 * 1024);
+        imageA->SetTargetMip(0);
+        imageB->SetTargetMip(0);
+        RPI::ImageSystemInterface::Get()->Update();
+
+        EXPECT_EQ(imageA->GetRHIImage()->GetResidentMipLevel(), 0);
+        EXPECT_EQ(imageB->GetRHIImage()->GetResidentMipLevel(), 0);
+    }
+
+    TEST_F(StreamingImageTests, BudgetedControllerGrantsMipsInFeedbackOrder)
+    {
+        using namespace AZ;
+
+        Data::Asset<RPI::StreamingImageAsset> imageAsset = BuildTestImage();
+        Data::Instance<RPI::StreamingImage> sizeImage = RPI::StreamingImage::FindOrCreate(imageAsset);
+        const size_t tailSize = sizeImage->GetMipChainSizeInBytes(2);
+        const size_t middleSize = sizeImage->GetMipChainSizeInBytes(1);
+        const size_t headSize = sizeImage->GetMipChainSizeInBytes(0);
+
+        // Enough for one image at full detail, the other only keeps its tail.
+        const size_t budgetInBytes = 2 * tailSize + headSize + middleSize;
+
+        Data::Asset<RPI::BudgetedStreamingImageControllerAsset> controllerAsset(
+            aznew RPI::BudgetedStreamingImageControllerAsset(Data::AssetId(Uuid::CreateRandom()), budgetInBytes, 20),
+            Data::AssetLoadBehavior::PreLoad);
+
+        Data::Asset<RPI::StreamingImagePoolAsset> poolAsset = BuildImagePoolAsset(16 * 1024 * 1024, controllerAsset);
+        Data::Instance<RPI::StreamingImagePool> pool = RPI::StreamingImagePool::FindOrCreate(poolAsset);
+        ASSERT_NE(pool.get(), nullptr);
+
+        Data::Asset<RPI::StreamingImageAsset> imageAssetA = BuildTestImage(pool->GetAssetId());
+        Data::Asset<RPI::StreamingImageAsset> imageAssetB = BuildTestImage(pool->GetAssetId());
+        Data::Instance<RPI::StreamingImage> imageA = RPI::StreamingImage::FindOrCreate(imageAssetA);
+        Data::Instance<RPI::StreamingImage> imageB = RPI::StreamingImage::FindOrCreate(imageAssetB);
+        const uint16_t tailMipA = static_cast<uint16_t>(imageAssetA->GetMipLevel(2));
+        const uint16_t tailMipB = static_cast<uint16_t>(imageAssetB->GetMipLevel(2));
+
+        // Both want full detail, but the feedback ranks A first because B asks for less.
+        imageA->SetTargetMip(0);
+        imageB->SetTargetMip(static_cast<uint16_t>(imageAssetB->GetMipLevel(1)));
+        RPI::ImageSystemInterface::Get()->Update();
+
+        EXPECT_EQ(imageA->GetRHIImage()->GetResidentMipLevel(), 0);
+        EXPECT_EQ(imageB->GetRHIImage()->GetResidentMipLevel(), tailMipB);
+
+        // The feedback flips, so B is granted the budget and A is trimmed to its tail.
+        imageA->SetTargetMip(static_cast<uint16_t>(imageAssetA->GetMipLevel(1)));
+        imageB->SetTargetMip(0);
+        RPI::ImageSystemInterface::Get()->Update();
+
+        EXPECT_EQ(imageB->GetRHIImage()->GetResidentMipLevel(), 0);
+        EXPECT_EQ(imageA->GetRHIImage()->GetResidentMipLevel(), tailMipA);
+    }
 }
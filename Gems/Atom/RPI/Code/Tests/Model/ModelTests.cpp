@@ -10,6 +10,7 @@
 #include <Atom/RPI.Reflect/Model/ModelAssetCreator.h>
 #include <Atom/RPI.Reflect/Model/ModelLodAssetCreator.h>
 #include <Atom/RPI.Reflect/Model/ModelAsset.h>
+#include <Atom/RPI.Reflect/Model/ModelBvh.h>
 #include <Atom/RPI.Reflect/Model/ModelKdTree.h>
 #include <Atom/RPI.Reflect/Model/ModelLodAsset.h>
 #include <Atom/RPI.Reflect/ResourcePoolAssetCreator.h>
@@ -1306,4 +1307,324 @@ namespace UnitTest
         EXPECT_THAT(t, testing::FloatEq(1.0f));
         EXPECT_THAT(normal, IsClose(AZ::Vector3::CreateAxisY()));
     }
+
+    class BvhIntersectsParameterizedFixture
+        : public ModelTests
+        , public ::testing::WithParamInterface<IntersectParams>
+    {
+    };
+
+    TEST_P(BvhIntersectsParameterizedFixture, BvhIntersects)
+    {
+        TestMesh mesh(
+            TwoSeparatedPlanesPositions.data(), TwoSeparatedPlanesPositions.size(), TwoSeparatedPlanesIndices.data(),
+            TwoSeparatedPlanesIndices.size());
+
+        AZ::RPI::ModelBvh bvh;
+        ASSERT_TRUE(bvh.Build(mesh.GetModel().Get()));
+
+        float distance = AZStd::numeric_limits<float>::max();
+        AZ::Vector3 normal;
+
+        EXPECT_THAT(
+            bvh.RayIntersection(
+                AZ::Vector3(GetParam().xpos, GetParam().ypos, GetParam().zpos),
+                AZ::Vector3(GetParam().xdir, GetParam().ydir, GetParam().zdir), distance, normal),
+            testing::Eq(GetParam().expectedShouldIntersect));
+        EXPECT_THAT(distance, testing::FloatEq(GetParam().expectedDistance));
+    }
+
+    INSTANTIATE_TEST_CASE_P(BvhIntersectsPlane, BvhIntersectsParameterizedFixture, ::testing::ValuesIn(KdTreeIntersectTestData));
+
+    class BvhIntersectsFixture
+        : public ModelTests
+    {
+    public:
+        void SetUp() override
+        {
+            ModelTests::SetUp();
+
+            m_mesh = AZStd::make_unique<TestMesh>(
+                TwoSeparatedPlanesPositions.data(), TwoSeparatedPlanesPositions.size(), TwoSeparatedPlanesIndices.data(),
+                TwoSeparatedPlanesIndices.size());
+
+            m_bvh = AZStd::make_unique<AZ::RPI::ModelBvh>();
+            ASSERT_TRUE(m_bvh->Build(m_mesh->GetModel().Get()));
+        }
+
+        void TearDown() override
+        {
+            m_bvh.reset();
+            m_mesh.reset();
+
+            ModelTests::TearDown();
+        }
+
+        AZStd::unique_ptr<TestMesh> m_mesh;
+        AZStd::unique_ptr<AZ::RPI::ModelBvh> m_bvh;
+    };
+
+    TEST_F(BvhIntersectsFixture, BvhIntersectionReturnsNormalizedDistance)
+    {
+        float t = AZStd::numeric_limits<float>::max();
+        AZ::Vector3 normal;
+
+        constexpr float rayLength = 100.0f;
+        EXPECT_THAT(
+            m_bvh->RayIntersection(AZ::Vector3::CreateZero(), AZ::Vector3::CreateAxisZ(-rayLength), t, normal), testing::Eq(true));
+        EXPECT_THAT(t, testing::FloatEq(0.005f));
+    }
+
+    TEST_F(BvhIntersectsFixture, BvhIntersectionDoesNotScaleRayByStartingDistance)
+    {
+        float t = 10.0f; // starting distance (used to check it is not read from initially by RayIntersection)
+        AZ::Vector3 normal;
+
+        EXPECT_THAT(
+            m_bvh->RayIntersection(AZ::Vector3::CreateAxisZ(5.0f), -AZ::Vector3::CreateAxisZ(), t, normal), testing::Eq(false));
+    }
+
+    TEST_F(BvhIntersectsFixture, BvhRayIntersectionsMatchesRayIntersection)
+    {
+        AZStd::vector<AZ::RPI::ModelBvh::Ray> rays;
+        for (const IntersectParams& params : KdTreeIntersectTestData)
+        {
+            AZ::RPI::ModelBvh::Ray ray;
+            ray.m_raySrc = AZ::Vector3(params.xpos, params.ypos, params.zpos);
+            ray.m_rayDir = AZ::Vector3(params.xdir, params.ydir, params.zdir);
+            rays.push_back(ray);
+        }
+        // A ray that misses, in the middle of a packet
+        AZ::RPI::ModelBvh::Ray missingRay;
+        missingRay.m_raySrc = AZ::Vector3::CreateAxisZ(5.0f);
+        missingRay.m_rayDir = -AZ::Vector3::CreateAxisZ();
+        rays.insert(rays.begin() + 1, missingRay);
+
+        EXPECT_EQ(m_bvh->RayIntersections(rays), aznumeric_cast<uint32_t>(rays.size() - 1));
+
+        for (const AZ::RPI::ModelBvh::Ray& ray : rays)
+        {
+            float distance = AZStd::numeric_limits<float>::max();
+            AZ::Vector3 normal;
+            EXPECT_EQ(ray.m_hit, m_bvh->RayIntersection(ray.m_raySrc, ray.m_rayDir, distance, normal));
+            if (ray.m_hit)
+            {
+                EXPECT_THAT(ray.m_distanceNormalized, testing::FloatEq(distance));
+                EXPECT_THAT(ray.m_normal, IsClose(normal));
+            }
+        }
+    }
+
+    //! A wavy grid of GridSize * GridSize * 2 triangles, large enough for the bvh to be built with jobs,
+    //! and the rays of neighboring pixels of a camera above it, so ray packets are coherent.
+    class WavyGrid
+    {
+    public:
+        static constexpr uint32_t GridSize = 128;
+        static constexpr uint32_t RayCount = 16 * 1024;
+
+        WavyGrid()
+        {
+            AZStd::vector<float> positions;
+            AZStd::vector<uint32_t> indices;
+            for (uint32_t y = 0; y <= GridSize; ++y)
+            {
+                for (uint32_t x = 0; x <= GridSize; ++x)
+                {
+                    const float px = aznumeric_cast<float>(x) / GridSize * 2.0f - 1.0f;
+                    const float py = aznumeric_cast<float>(y) / GridSize * 2.0f - 1.0f;
+                    positions.insert(positions.end(), { px, py, 0.1f * AZ::Sin(px * 10.0f) * AZ::Cos(py * 10.0f) });
+                }
+            }
+            for (uint32_t y = 0; y < GridSize; ++y)
+            {
+                for (uint32_t x = 0; x < GridSize; ++x)
+                {
+                    const uint32_t corner = y * (GridSize + 1) + x;
+                    indices.insert(indices.end(), { corner, corner + 1, corner + GridSize + 2 });
+                    indices.insert(indices.end(), { corner, corner + GridSize + 2, corner + GridSize + 1 });
+                }
+            }
+            m_mesh = AZStd::make_unique<TestMesh>(positions.data(), positions.size(), indices.data(), indices.size());
+
+            m_rays.resize(RayCount);
+            const AZ::Vector3 cameraPosition(0.013f, -2.0f, 2.0f);
+            constexpr uint32_t RaysPerRow = 128;
+            for (uint32_t rayIndex = 0; rayIndex < RayCount; ++rayIndex)
+            {
+                const float u = aznumeric_cast<float>(rayIndex % RaysPerRow) / RaysPerRow * 2.0f - 1.0f;
+                const float v = aznumeric_cast<float>(rayIndex / RaysPerRow) / (RayCount / RaysPerRow) * 2.0f - 1.0f;
+                m_rays[rayIndex].m_raySrc = cameraPosition;
+                m_rays[rayIndex].m_rayDir = (AZ::Vector3(u * 1.2f, v * 1.2f, 0.0f) - cameraPosition) * 2.0f;
+            }
+        }
+
+        AZStd::unique_ptr<TestMesh> m_mesh;
+        AZStd::vector<AZ::RPI::ModelBvh::Ray> m_rays;
+    };
+
+    TEST_F(ModelTests, BvhRayIntersection_WavyGrid_FindsSameHitsAsKdTree)
+    {
+        WavyGrid grid;
+
+        AZ::RPI::ModelKdTree kdTree;
+        ASSERT_TRUE(kdTree.Build(grid.m_mesh->GetModel().Get()));
+        AZ::RPI::ModelBvh bvh;
+        ASSERT_TRUE(bvh.Build(grid.m_mesh->GetModel().Get()));
+        EXPECT_EQ(bvh.GetTriangleCount(), WavyGrid::GridSize * WavyGrid::GridSize * 2);
+
+        EXPECT_GT(bvh.RayIntersections(grid.m_rays), 0u);
+        for (const AZ::RPI::ModelBvh::Ray& ray : grid.m_rays)
+        {
+            float kdTreeDistance = AZStd::numeric_limits<float>::max();
+            float bvhDistance = AZStd::numeric_limits<float>::max();
+            AZ::Vector3 normal;
+            kdTree.RayIntersection(ray.m_raySrc, ray.m_rayDir, kdTreeDistance, normal);
+            bvh.RayIntersection(ray.m_raySrc, ray.m_rayDir, bvhDistance, normal);
+
+            EXPECT_THAT(bvhDistance, testing::FloatEq(kdTreeDistance));
+            EXPECT_THAT(ray.m_distanceNormalized, testing::FloatEq(kdTreeDistance));
+        }
+    }
+
+#ifdef HAVE_BENCHMARK
+    //! Sets up the RPI the way RPITestFixture does for the tests, so the benchmarks can create models
+    class ModelBenchmarkEnvironment
+        : public RPITestFixture
+    {
+    public:
+        using RPITestFixture::SetUp;
+        using RPITestFixture::TearDown;
+
+        void TestBody() override {}
+    };
+
+    //! Compares the build and query times of the bvh and the kd-tree on the wavy grid
+    class ModelBvhBenchmark
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void internalSetUp()
+        {
+            m_environment = AZStd::make_unique<ModelBenchmarkEnvironment>();
+            m_environment->SetUp();
+            m_grid = AZStd::make_unique<WavyGrid>();
+        }
+
+        void internalTearDown()
+        {
+            m_grid.reset();
+            m_environment->TearDown();
+            m_environment.reset();
+        }
+
+        const AZ::RPI::ModelAsset* GetModel() const
+        {
+            return m_grid->m_mesh->GetModel().Get();
+        }
+
+        AZStd::unique_ptr<ModelBenchmarkEnvironment> m_environment;
+        AZStd::unique_ptr<WavyGrid> m_grid;
+    };
+
+    BENCHMARK_DEFINE_F(ModelBvhBenchmark, BM_KdTreeBuild)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::RPI::ModelKdTree kdTree;
+            kdTree.Build(GetModel());
+        }
+
+        state.SetItemsProcessed(state.iterations() * WavyGrid::GridSize * WavyGrid::GridSize * 2);
+    }
+
+    BENCHMARK_DEFINE_F(ModelBvhBenchmark, BM_BvhBuild)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::RPI::ModelBvh bvh;
+            bvh.Build(GetModel());
+        }
+
+        state.SetItemsProcessed(state.iterations() * WavyGrid::GridSize * WavyGrid::GridSize * 2);
+    }
+
+    BENCHMARK_DEFINE_F(ModelBvhBenchmark, BM_KdTreeRayIntersection)(benchmark::State& state)
+    {
+        AZ::RPI::ModelKdTree kdTree;
+        kdTree.Build(GetModel());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZ::RPI::ModelBvh::Ray& ray : m_grid->m_rays)
+            {
+                float distance = AZStd::numeric_limits<float>::max();
+                AZ::Vector3 normal;
+                benchmark::DoNotOptimize(kdTree.RayIntersection(ray.m_raySrc, ray.m_rayDir, distance, normal));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * WavyGrid::RayCount);
+    }
+
+    BENCHMARK_DEFINE_F(ModelBvhBenchmark, BM_BvhRayIntersection)(benchmark::State& state)
+    {
+        AZ::RPI::ModelBvh bvh;
+        bvh.Build(GetModel());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            for (const AZ::RPI::ModelBvh::Ray& ray : m_grid->m_rays)
+            {
+                float distance = AZStd::numeric_limits<float>::max();
+                AZ::Vector3 normal;
+                benchmark::DoNotOptimize(bvh.RayIntersection(ray.m_raySrc, ray.m_rayDir, distance, normal));
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations() * WavyGrid::RayCount);
+    }
+
+    BENCHMARK_DEFINE_F(ModelBvhBenchmark, BM_BvhRayIntersections)(benchmark::State& state)
+    {
+        AZ::RPI::ModelBvh bvh;
+        bvh.Build(GetModel());
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            benchmark::DoNotOptimize(bvh.RayIntersections(m_grid->m_rays));
+        }
+
+        state.SetItemsProcessed(state.iterations() * WavyGrid::RayCount);
+    }
+
+    BENCHMARK_REGISTER_F(ModelBvhBenchmark, BM_KdTreeBuild)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(ModelBvhBenchmark, BM_BvhBuild)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(ModelBvhBenchmark, BM_KdTreeRayIntersection)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(ModelBvhBenchmark, BM_BvhRayIntersection)->Unit(benchmark::kMillisecond);
+    BENCHMARK_REGISTER_F(ModelBvhBenchmark, BM_BvhRayIntersections)->Unit(benchmark::kMillisecond);
+#endif
 } // namespace UnitTest
@@ -41,6 +41,7 @@ set(FILES
     Include/Atom/RPI.Public/DynamicDraw/DynamicDrawInterface.h
     Include/Atom/RPI.Public/Image/AttachmentImage.h
     Include/Atom/RPI.Public/Image/AttachmentImagePool.h
+    Include/Atom/RPI.Public/Image/BudgetedStreamingImageController.h
     Include/Atom/RPI.Public/Image/DefaultStreamingImageController.h
     Include/Atom/RPI.Public/Image/ImageSystem.h
     Include/Atom/RPI.Public/Image/ImageSystemInterface.h
@@ -121,6 +122,7 @@ set(FILES
     Source/RPI.Public/DynamicDraw/DynamicDrawSystem.cpp
     Source/RPI.Public/Image/AttachmentImage.cpp
     Source/RPI.Public/Image/AttachmentImagePool.cpp
+    Source/RPI.Public/Image/BudgetedStreamingImageController.cpp
     Source/RPI.Public/Image/DefaultStreamingImageController.cpp
     Source/RPI.Public/Image/ImageSystem.cpp
     Source/RPI.Public/Image/StreamingImage.cpp
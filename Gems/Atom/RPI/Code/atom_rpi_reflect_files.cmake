@@ -19,6 +19,7 @@ set(FILES
     Include/Atom/RPI.Reflect/Buffer/BufferAssetCreator.h
     Include/Atom/RPI.Reflect/Buffer/BufferAssetView.h
     Include/Atom/RPI.Reflect/Model/ModelAsset.h
+    Include/Atom/RPI.Reflect/Model/ModelBvh.h
     Include/Atom/RPI.Reflect/Model/ModelKdTree.h
     Include/Atom/RPI.Reflect/Model/ModelLodAsset.h
     Include/Atom/RPI.Reflect/Model/ModelLodIndex.h
@@ -37,6 +38,7 @@ set(FILES
     Include/Atom/RPI.Reflect/Asset/BuiltInAssetHandler.h
     Include/Atom/RPI.Reflect/Image/AttachmentImageAsset.h
     Include/Atom/RPI.Reflect/Image/AttachmentImageAssetCreator.h
+    Include/Atom/RPI.Reflect/Image/BudgetedStreamingImageControllerAsset.h
     Include/Atom/RPI.Reflect/Image/DefaultStreamingImageControllerAsset.h
     Include/Atom/RPI.Reflect/Image/Image.h
     Include/Atom/RPI.Reflect/Image/ImageAsset.h
@@ -104,6 +106,7 @@ set(FILES
     Source/RPI.Reflect/Buffer/BufferAssetCreator.cpp
     Source/RPI.Reflect/Buffer/BufferAssetView.cpp
     Source/RPI.Reflect/Model/ModelAsset.cpp
+    Source/RPI.Reflect/Model/ModelBvh.cpp
     Source/RPI.Reflect/Model/ModelKdTree.cpp
     Source/RPI.Reflect/Model/ModelLodAsset.cpp
     Source/RPI.Reflect/Model/ModelAssetCreator.cpp
@@ -118,6 +121,7 @@ set(FILES
     Source/RPI.Reflect/ResourcePoolAssetCreator.cpp
     Source/RPI.Reflect/Image/AttachmentImageAsset.cpp
     Source/RPI.Reflect/Image/AttachmentImageAssetCreator.cpp
+    Source/RPI.Reflect/Image/BudgetedStreamingImageControllerAsset.cpp
     Source/RPI.Reflect/Image/DefaultStreamingImageControllerAsset.cpp
     Source/RPI.Reflect/Image/Image.cpp
     Source/RPI.Reflect/Image/ImageAsset.cpp
@@ -39,6 +39,23 @@ namespace PhysX
         bool operator!=(const WindConfiguration& other) const;
     };
 
+    //! Settings of the cache of cooked PhysX data created at runtime (convex meshes, triangle meshes and heightfields).
+    class CookedDataCacheConfiguration
+    {
+    public:
+        AZ_CLASS_ALLOCATOR_DECL
+        AZ_TYPE_INFO(PhysX::CookedDataCacheConfiguration, "{0E2B5E0C-5E8B-4C55-9E0F-6C8F1B4D2A71}");
+        static void Reflect(AZ::ReflectContext* context);
+
+        bool m_enabled = true; //!< Re-use previously cooked data for identical geometry and cooking params.
+        AZ::u32 m_maxMemoryMegabytes = 64; //!< Budget of the in memory cache, least recently used entries are evicted first.
+        bool m_diskCacheEnabled = false; //!< Also store cooked data on disk so it survives across sessions.
+        AZStd::string m_diskCachePath = "@user@/PhysX/CookedDataCache"; //!< Folder of the on disk cache, aliases are resolved.
+
+        bool operator==(const CookedDataCacheConfiguration& other) const;
+        bool operator!=(const CookedDataCacheConfiguration& other) const;
+    };
+
     //! Contains global physics settings.
     //! Used to initialize the Physics System.
     struct PhysXSystemConfiguration : public AzPhysics::SystemConfiguration
@@ -50,6 +67,7 @@ namespace PhysX
         static PhysXSystemConfiguration CreateDefault();
 
         WindConfiguration m_windConfiguration; //!< Wind configuration for PhysX.
+        CookedDataCacheConfiguration m_cookedDataCacheConfiguration; //!< Runtime cooked data cache configuration.
 
         bool operator==(const PhysXSystemConfiguration& other) const;
         bool operator!=(const PhysXSystemConfiguration& other) const;
@@ -69,6 +69,8 @@ namespace UnitTest
         MOCK_CONST_METHOD1(UpdateHeights, AZStd::vector<float>(const AZ::Aabb& dirtyRegion));
         MOCK_CONST_METHOD1(UpdateHeightsAndMaterials, AZStd::vector<Physics::HeightMaterialPoint>(const AZ::Aabb& dirtyRegion));
         MOCK_CONST_METHOD0(GetHeightfieldAabb, AZ::Aabb());
+        MOCK_CONST_METHOD5(GetHeightfieldIndicesFromRegion, void(const AZ::Aabb&, size_t&, size_t&, size_t&, size_t&));
+        MOCK_CONST_METHOD4(GetHeightsAndMaterialsInRegion, AZStd::vector<Physics::HeightMaterialPoint>(size_t, size_t, size_t, size_t));
     };
 
 } // namespace UnitTest
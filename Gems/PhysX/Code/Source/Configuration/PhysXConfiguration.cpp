@@ -40,6 +40,7 @@ namespace PhysX
     }
 
     AZ_CLASS_ALLOCATOR_IMPL(WindConfiguration, AZ::SystemAllocator, 0);
+    AZ_CLASS_ALLOCATOR_IMPL(CookedDataCacheConfiguration, AZ::SystemAllocator, 0);
     AZ_CLASS_ALLOCATOR_IMPL(PhysXSystemConfiguration, AZ::SystemAllocator, 0);
 
     /*static*/ void WindConfiguration::Reflect(AZ::ReflectContext* context)
@@ -82,16 +83,66 @@ namespace PhysX
         return !(*this == other);
     }
 
+    /*static*/ void CookedDataCacheConfiguration::Reflect(AZ::ReflectContext* context)
+    {
+        if (auto* serialize = azrtti_cast<AZ::SerializeContext*>(context))
+        {
+            serialize->Class<PhysX::CookedDataCacheConfiguration>()
+                ->Version(1)
+                ->Field("Enabled", &CookedDataCacheConfiguration::m_enabled)
+                ->Field("MaxMemoryMegabytes", &CookedDataCacheConfiguration::m_maxMemoryMegabytes)
+                ->Field("DiskCacheEnabled", &CookedDataCacheConfiguration::m_diskCacheEnabled)
+                ->Field("DiskCachePath", &CookedDataCacheConfiguration::m_diskCachePath)
+                ;
+
+            if (AZ::EditContext* editContext = serialize->GetEditContext())
+            {
+                editContext->Class<PhysX::CookedDataCacheConfiguration>("Cooked Data Cache", "Cache of PhysX data cooked at runtime.")
+                    ->ClassElement(AZ::Edit::ClassElements::EditorData, "")
+                    ->Attribute(AZ::Edit::Attributes::AutoExpand, true)
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &CookedDataCacheConfiguration::m_enabled,
+                        "Enabled",
+                        "Re-use previously cooked data for colliders created at runtime with identical geometry.")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &CookedDataCacheConfiguration::m_maxMemoryMegabytes,
+                        "Memory budget (MB)",
+                        "Maximum size of the in memory cache. Least recently used entries are evicted first.")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &CookedDataCacheConfiguration::m_diskCacheEnabled,
+                        "Disk cache",
+                        "Also store cooked data on disk so it can be re-used in later sessions.")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &CookedDataCacheConfiguration::m_diskCachePath,
+                        "Disk cache folder",
+                        "Folder of the on disk cache.")
+                    ;
+            }
+        }
+    }
+
+    bool CookedDataCacheConfiguration::operator==(const CookedDataCacheConfiguration& other) const
+    {
+        return m_enabled == other.m_enabled &&
+            m_maxMemoryMegabytes == other.m_maxMemoryMegabytes &&
+            m_diskCacheEnabled == other.m_diskCacheEnabled &&
+            m_diskCachePath == other.m_diskCachePath
+            ;
+    }
+
+    bool CookedDataCacheConfiguration::operator!=(const CookedDataCacheConfiguration& other) const
+    {
+        return !(*this == other);
+    }
+
     /*static*/ void PhysXSystemConfiguration::Reflect(AZ::ReflectContext* context)
     {
         AzPhysics::SystemConfiguration::Reflect(context);
         WindConfiguration::Reflect(context);
+        CookedDataCacheConfiguration::Reflect(context);
 
         if (auto* serializeContext = azdynamic_cast<AZ::SerializeContext*>(context))
         {
             serializeContext->Class<PhysX::PhysXSystemConfiguration, AzPhysics::SystemConfiguration>()
                 ->Version(2, &PhysXInternal::PhysXSystemConfigurationConverter)
                 ->Field("WindConfiguration", &PhysXSystemConfiguration::m_windConfiguration)
+                ->Field("CookedDataCacheConfiguration", &PhysXSystemConfiguration::m_cookedDataCacheConfiguration)
                 ;
 
             if (AZ::EditContext* editContext = serializeContext->GetEditContext())
@@ -115,7 +166,8 @@ namespace PhysX
     bool PhysXSystemConfiguration::operator==(const PhysXSystemConfiguration& other) const
     {
         return AzPhysics::SystemConfiguration::operator==(other) &&
-            m_windConfiguration == other.m_windConfiguration
+            m_windConfiguration == other.m_windConfiguration &&
+            m_cookedDataCacheConfiguration == other.m_cookedDataCacheConfiguration
             ;
     }
 
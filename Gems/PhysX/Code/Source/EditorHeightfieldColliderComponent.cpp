@@ -12,6 +12,7 @@
 #include <AzFramework/Physics/Configuration/StaticRigidBodyConfiguration.h>
 #include <AzFramework/Physics/Shape.h>
 #include <Source/HeightfieldColliderComponent.h>
+#include <Source/RigidBodyStatic.h>
 #include <Source/Utils.h>
 #include <System/PhysXSystem.h>
 
@@ -153,9 +154,12 @@ namespace PhysX
             { AZStd::make_shared<Physics::ColliderConfiguration>(m_colliderConfig), m_shapeConfig });
     }
 
-    void EditorHeightfieldColliderComponent::OnHeightfieldDataChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion)
+    void EditorHeightfieldColliderComponent::OnHeightfieldDataChanged(const AZ::Aabb& dirtyRegion)
     {
-        RefreshHeightfield();
+        if (!UpdateHeightfieldRegion(dirtyRegion))
+        {
+            RefreshHeightfield();
+        }
     }
 
     void EditorHeightfieldColliderComponent::ClearHeightfield()
@@ -212,6 +216,32 @@ namespace PhysX
         Physics::ColliderComponentEventBus::Event(GetEntityId(), &Physics::ColliderComponentEvents::OnColliderChanged);
     }
 
+    bool EditorHeightfieldColliderComponent::UpdateHeightfieldRegion(const AZ::Aabb& dirtyRegion)
+    {
+        auto* body = azdynamic_cast<PhysX::StaticRigidBody*>(GetSimulatedBody());
+        if (!body || body->GetShapeCount() != 1)
+        {
+            return false;
+        }
+
+        // A heightfield that moved needs a new rigid body.
+        AZ::Transform transform = AZ::Transform::CreateIdentity();
+        Physics::HeightfieldProviderRequestsBus::EventResult(
+            transform, GetEntityId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldTransform);
+        if (!transform.IsClose(body->GetTransform()))
+        {
+            return false;
+        }
+
+        if (!Utils::UpdateHeightfieldShapeRegion(GetEntityId(), dirtyRegion, *m_shapeConfig, *body->GetShape(0)))
+        {
+            return false;
+        }
+
+        Physics::ColliderComponentEventBus::Event(GetEntityId(), &Physics::ColliderComponentEvents::OnColliderChanged);
+        return true;
+    }
+
     AZ::u32 EditorHeightfieldColliderComponent::OnConfigurationChanged()
     {
         RefreshHeightfield();
@@ -77,7 +77,7 @@ namespace PhysX
         AzPhysics::SceneQueryHit RayCast(const AzPhysics::RayCastRequest& request) override;
 
         // Physics::HeightfieldProviderNotificationBus
-        void OnHeightfieldDataChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion) override;
+        void OnHeightfieldDataChanged(const AZ::Aabb& dirtyRegion) override;
 
     private:
         AZ::u32 OnConfigurationChanged();
@@ -86,6 +86,7 @@ namespace PhysX
         void InitHeightfieldShapeConfiguration();
         void InitStaticRigidBody();
         void RefreshHeightfield();
+        bool UpdateHeightfieldRegion(const AZ::Aabb& dirtyRegion);
 
         DebugDraw::Collider m_colliderDebugDraw; //!< Handles drawing the collider
         AzPhysics::SceneInterface* m_sceneInterface{ nullptr };
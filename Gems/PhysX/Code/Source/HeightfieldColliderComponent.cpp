@@ -86,9 +86,12 @@ namespace PhysX
         ClearHeightfield();
     }
 
-    void HeightfieldColliderComponent::OnHeightfieldDataChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion)
+    void HeightfieldColliderComponent::OnHeightfieldDataChanged(const AZ::Aabb& dirtyRegion)
     {
-        RefreshHeightfield();
+        if (!UpdateHeightfieldRegion(dirtyRegion))
+        {
+            RefreshHeightfield();
+        }
     }
 
     void HeightfieldColliderComponent::ClearHeightfield()
@@ -150,6 +153,34 @@ namespace PhysX
         Physics::ColliderComponentEventBus::Event(GetEntityId(), &Physics::ColliderComponentEvents::OnColliderChanged);
     }
 
+    bool HeightfieldColliderComponent::UpdateHeightfieldRegion(const AZ::Aabb& dirtyRegion)
+    {
+        AzPhysics::SimulatedBody* body = GetSimulatedBody();
+        AZStd::shared_ptr<Physics::Shape> shape = GetHeightfieldShape();
+        if (!body || !shape)
+        {
+            return false;
+        }
+
+        // A heightfield that moved needs a new rigid body.
+        AZ::Transform transform = AZ::Transform::CreateIdentity();
+        Physics::HeightfieldProviderRequestsBus::EventResult(
+            transform, GetEntityId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldTransform);
+        if (!transform.IsClose(body->GetTransform()))
+        {
+            return false;
+        }
+
+        Physics::HeightfieldShapeConfiguration& configuration = static_cast<Physics::HeightfieldShapeConfiguration&>(*m_shapeConfig.second);
+        if (!Utils::UpdateHeightfieldShapeRegion(GetEntityId(), dirtyRegion, configuration, *shape))
+        {
+            return false;
+        }
+
+        Physics::ColliderComponentEventBus::Event(GetEntityId(), &Physics::ColliderComponentEvents::OnColliderChanged);
+        return true;
+    }
+
     void HeightfieldColliderComponent::SetShapeConfiguration(const AzPhysics::ShapeColliderPair& shapeConfig)
     {
         if (GetEntity()->GetState() == AZ::Entity::State::Active)
@@ -87,7 +87,7 @@ namespace PhysX
         AzPhysics::SceneQueryHit RayCast(const AzPhysics::RayCastRequest& request) override;
 
         // HeightfieldProviderNotificationBus
-        void OnHeightfieldDataChanged([[maybe_unused]] const AZ::Aabb& dirtyRegion) override;
+        void OnHeightfieldDataChanged(const AZ::Aabb& dirtyRegion) override;
 
     private:
         AZStd::shared_ptr<Physics::Shape> GetHeightfieldShape();
@@ -96,6 +96,7 @@ namespace PhysX
         void InitHeightfieldShapeConfiguration();
         void InitStaticRigidBody();
         void RefreshHeightfield();
+        bool UpdateHeightfieldRegion(const AZ::Aabb& dirtyRegion);
 
         AzPhysics::ShapeColliderPair m_shapeConfig;
         AzPhysics::SimulatedBodyHandle m_staticRigidBodyHandle = AzPhysics::InvalidSimulatedBodyHandle;
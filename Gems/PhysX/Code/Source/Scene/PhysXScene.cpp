@@ -8,6 +8,10 @@
 #include <Scene/PhysXScene.h>
 
 #include <AzCore/Debug/ProfilerBus.h>
+#include <AzCore/Jobs/JobCompletion.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Jobs/JobFunction.h>
+#include <AzCore/Jobs/JobManager.h>
 #include <AzCore/std/containers/variant.h>
 #include <AzCore/std/containers/vector.h>
 #include <AzCore/std/smart_ptr/make_shared.h>
@@ -452,6 +456,36 @@ namespace PhysX
             }
             return results;
         }
+
+        //helper to take a copy of a request so it can outlive the caller's instance while an async query is in flight.
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> CloneSceneQueryRequest(const AzPhysics::SceneQueryRequest* request)
+        {
+            if (auto* raycastRequest = azrtti_cast<const AzPhysics::RayCastRequest*>(request))
+            {
+                return AZStd::make_shared<AzPhysics::RayCastRequest>(*raycastRequest);
+            }
+            else if (auto* shapecastRequest = azrtti_cast<const AzPhysics::ShapeCastRequest*>(request))
+            {
+                return AZStd::make_shared<AzPhysics::ShapeCastRequest>(*shapecastRequest);
+            }
+            else if (auto* overlapRequest = azrtti_cast<const AzPhysics::OverlapRequest*>(request))
+            {
+                return AZStd::make_shared<AzPhysics::OverlapRequest>(*overlapRequest);
+            }
+            return nullptr;
+        }
+
+        //helper to get the number of jobs a batch of scene queries should be split into. Returns 1 if the batch should run serially.
+        size_t GetSceneQueryBatchJobCount(size_t numRequests, size_t minRequestsPerJob)
+        {
+            AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+            if (jobContext == nullptr || numRequests < 2 * minRequestsPerJob)
+            {
+                return 1;
+            }
+            const size_t numWorkers = AZStd::max<size_t>(jobContext->GetJobManager().GetNumWorkerThreads(), 1);
+            return AZStd::min(numWorkers, numRequests / minRequestsPerJob);
+        }
     }
 
     PhysXScene::PhysXScene(const AzPhysics::SceneConfiguration& config, const AzPhysics::SceneHandle& sceneHandle)
@@ -494,6 +528,9 @@ namespace PhysX
     {
         m_physicsSystemConfigChanged.Disconnect();
 
+        // Make sure no async scene query jobs are still referencing this scene.
+        FlushAsyncSceneQueries();
+
         s_overlapBuffer.swap({});
         s_rayCastBuffer.swap({});
         s_sweepBuffer.swap({});
@@ -552,6 +589,10 @@ namespace PhysX
     {
         AZ_PROFILE_SCOPE(Physics, "PhysXScene::FinishSimulation");
 
+        // Async scene queries are completed and their callbacks dispatched before the simulation results are fetched,
+        // so the hits always reflect the state of the scene at the start of the step.
+        FlushAsyncSceneQueries();
+
         if (!IsEnabled())
         {
             return;
@@ -950,27 +991,162 @@ namespace PhysX
 
     AzPhysics::SceneQueryHitsList PhysXScene::QuerySceneBatch(const AzPhysics::SceneQueryRequests& requests)
     {
-        AzPhysics::SceneQueryHitsList results;
-        results.reserve(requests.size());
-        for (auto& request : requests)
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::QuerySceneBatch");
+
+        AzPhysics::SceneQueryHitsList results(requests.size());
+
+        const size_t numJobs = Internal::GetSceneQueryBatchJobCount(requests.size(), MinBatchQueriesPerJob);
+        if (numJobs <= 1)
         {
-            results.emplace_back(QueryScene(request.get()));
+            for (size_t i = 0; i < requests.size(); ++i)
+            {
+                results[i] = QueryScene(requests[i].get());
+            }
+            return results;
+        }
+
+        // Each job writes into its own slice of the results, and uses the thread local hit buffers of the worker it runs on.
+        const size_t requestsPerJob = (requests.size() + numJobs - 1) / numJobs;
+        AZ::JobCompletion jobCompletion;
+        for (size_t jobStart = 0; jobStart < requests.size(); jobStart += requestsPerJob)
+        {
+            const size_t jobEnd = AZStd::min(jobStart + requestsPerJob, requests.size());
+            const auto jobLambda = [this, &requests, &results, jobStart, jobEnd]() -> void
+            {
+                for (size_t i = jobStart; i < jobEnd; ++i)
+                {
+                    results[i] = QueryScene(requests[i].get());
+                }
+            };
+            AZ::Job* queryJob = AZ::CreateJobFunction(jobLambda, true); // Auto-deletes
+            queryJob->SetDependent(&jobCompletion);
+            queryJob->Start();
         }
+        jobCompletion.StartAndWaitForCompletion();
+
         return results;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsync([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequest* request, [[maybe_unused]] AzPhysics::SceneQuery::AsyncCallback callback)
+    [[nodiscard]] bool PhysXScene::QuerySceneAsync(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequest* request, AzPhysics::SceneQuery::AsyncCallback callback)
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        if (request == nullptr || !callback)
+        {
+            return false;
+        }
+
+        // Take a copy of the request as the caller is free to release it once this returns.
+        AZStd::shared_ptr<AzPhysics::SceneQueryRequest> requestCopy = Internal::CloneSceneQueryRequest(request);
+        if (requestCopy == nullptr)
+        {
+            AZ_Warning("Physx", false, "Unknown Scene Query request type.");
+            return false;
+        }
+
+        const auto jobLambda = [this, requestId, requestCopy, callback]() -> void
+        {
+            AsyncQueryResult result;
+            result.m_requestId = requestId;
+            result.m_callback = callback;
+            result.m_hits.emplace_back(QueryScene(requestCopy.get()));
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueryResultsMutex);
+            m_asyncQueryResults.emplace_back(AZStd::move(result));
+        };
+
+        if (AZ::JobContext::GetGlobalContext() == nullptr)
+        {
+            // without a JobManager (tools, some tests) run the query inline, FlushAsyncSceneQueries still delivers the callback.
+            jobLambda();
+            return true;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueryDispatchMutex);
+        if (m_asyncQueryCompletion == nullptr)
+        {
+            m_asyncQueryCompletion = AZStd::make_unique<AZ::JobCompletion>();
+        }
+        AZ::Job* queryJob = AZ::CreateJobFunction(jobLambda, true); // Auto-deletes
+        queryJob->SetDependent(m_asyncQueryCompletion.get());
+        queryJob->Start();
+        return true;
+    }
+
+    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch(AzPhysics::SceneQuery::AsyncRequestId requestId,
+        const AzPhysics::SceneQueryRequests& requests, AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    {
+        if (!callback)
+        {
+            return false;
+        }
+
+        // The requests are shared pointers, so the copy of the list keeps them alive while the query is in flight.
+        const auto jobLambda = [this, requestId, requests, callback]() -> void
+        {
+            AsyncQueryResult result;
+            result.m_requestId = requestId;
+            result.m_batchCallback = callback;
+            // Run the batch serially on this worker rather than blocking it on nested jobs, separate async batches already run concurrently.
+            result.m_hits.reserve(requests.size());
+            for (const auto& request : requests)
+            {
+                result.m_hits.emplace_back(QueryScene(request.get()));
+            }
+
+            AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueryResultsMutex);
+            m_asyncQueryResults.emplace_back(AZStd::move(result));
+        };
+
+        if (AZ::JobContext::GetGlobalContext() == nullptr)
+        {
+            // without a JobManager (tools, some tests) run the query inline, FlushAsyncSceneQueries still delivers the callback.
+            jobLambda();
+            return true;
+        }
+
+        AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueryDispatchMutex);
+        if (m_asyncQueryCompletion == nullptr)
+        {
+            m_asyncQueryCompletion = AZStd::make_unique<AZ::JobCompletion>();
+        }
+        AZ::Job* queryJob = AZ::CreateJobFunction(jobLambda, true); // Auto-deletes
+        queryJob->SetDependent(m_asyncQueryCompletion.get());
+        queryJob->Start();
+        return true;
     }
 
-    [[nodiscard]] bool PhysXScene::QuerySceneAsyncBatch([[maybe_unused]] AzPhysics::SceneQuery::AsyncRequestId requestId,
-        [[maybe_unused]] const AzPhysics::SceneQueryRequests& requests, [[maybe_unused]] AzPhysics::SceneQuery::AsyncBatchCallback callback)
+    void PhysXScene::FlushAsyncSceneQueries()
     {
-        AZ_Warning("Physx", false, "Currently unimplemented."); // LYN-2306
-        return false;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueryDispatchMutex);
+            // there is no completion when no jobs were issued since the last flush, queries run inline may still have results.
+            if (m_asyncQueryCompletion != nullptr)
+            {
+                AZ_PROFILE_SCOPE(Physics, "PhysXScene::WaitForAsyncSceneQueries");
+                m_asyncQueryCompletion->StartAndWaitForCompletion();
+                m_asyncQueryCompletion.reset();
+            }
+        }
+
+        AZStd::vector<AsyncQueryResult> completedQueries;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_asyncQueryResultsMutex);
+            completedQueries.swap(m_asyncQueryResults);
+        }
+
+        // Callbacks are dispatched in completion order, callers identify their results by the request id.
+        AZ_PROFILE_SCOPE(Physics, "PhysXScene::DispatchAsyncSceneQueries");
+        for (AsyncQueryResult& result : completedQueries)
+        {
+            if (result.m_batchCallback)
+            {
+                result.m_batchCallback(result.m_requestId, AZStd::move(result.m_hits));
+            }
+            else if (result.m_callback)
+            {
+                result.m_callback(result.m_requestId, AZStd::move(result.m_hits.front()));
+            }
+        }
     }
 
     void PhysXScene::SuppressCollisionEvents(
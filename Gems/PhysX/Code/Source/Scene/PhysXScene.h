@@ -12,10 +12,17 @@
 #include <AzFramework/Physics/Common/PhysicsEvents.h>
 #include <AzFramework/Physics/Common/PhysicsSimulatedBody.h>
 #include <AzFramework/Physics/Configuration/SceneConfiguration.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/unique_ptr.h>
 
 #include <Scene/PhysXSceneSimulationEventCallback.h>
 #include <Scene/PhysXSceneSimulationFilterCallback.h>
 
+namespace AZ
+{
+    class JobCompletion;
+}
+
 namespace physx
 {
     class PxControllerManager;
@@ -90,6 +97,9 @@ namespace PhysX
 
         void UpdateAzProfilerDataPoints();
 
+        //! Waits for all in flight async scene queries and dispatches their callbacks on the calling thread.
+        void FlushAsyncSceneQueries();
+
         bool m_isEnabled = true;
         AzPhysics::SceneConfiguration m_config;
         AzPhysics::SceneHandle m_sceneHandle;
@@ -112,6 +122,22 @@ namespace PhysX
         AZ::u64 m_shapecastBufferSize = 32; //!< Maximum number of hits that can be returned from a shapecast.
         AZ::u64 m_overlapBufferSize = 32; //!< Maximum number of overlaps that can be returned from an overlap query.
 
+        //! Minimum number of requests processed by a single job when a batch query is split across the job system.
+        static constexpr size_t MinBatchQueriesPerJob = 16;
+
+        //! A completed async scene query waiting for its callback to be dispatched.
+        struct AsyncQueryResult
+        {
+            AzPhysics::SceneQuery::AsyncRequestId m_requestId;
+            AzPhysics::SceneQuery::AsyncBatchCallback m_batchCallback; //!< Set for batch requests.
+            AzPhysics::SceneQuery::AsyncCallback m_callback; //!< Set for single requests.
+            AzPhysics::SceneQueryHitsList m_hits;
+        };
+        AZStd::unique_ptr<AZ::JobCompletion> m_asyncQueryCompletion; //!< Dependent of every in flight async query job, waited on in FlushAsyncSceneQueries.
+        AZStd::mutex m_asyncQueryDispatchMutex; //!< Guards m_asyncQueryCompletion.
+        AZStd::vector<AsyncQueryResult> m_asyncQueryResults; //!< Results of async queries completed since the last flush.
+        AZStd::mutex m_asyncQueryResultsMutex; //!< Guards m_asyncQueryResults.
+
         SceneSimulationFilterCallback m_collisionFilterCallback; //!< Handles the filtering of collision pairs reported from PhysX.
         SceneSimulationEventCallback m_simulationEventCallback; //!< Handles the collision and trigger events reported from PhysX.
         physx::PxScene* m_pxScene = nullptr; //!< The physx scene
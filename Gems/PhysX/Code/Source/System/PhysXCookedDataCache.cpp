@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <System/PhysXCookedDataCache.h>
+
+#include <AzCore/Debug/Profiler.h>
+#include <AzCore/IO/FileIO.h>
+#include <AzCore/std/chrono/clocks.h>
+#include <AzCore/std/hash.h>
+
+#include <xxhash/xxhash.h>
+
+namespace PhysX
+{
+    namespace CookedDataCacheInternal
+    {
+        //! Header written in front of the cooked data in the on disk cache files.
+        struct DiskCacheHeader
+        {
+            static constexpr AZ::u32 ExpectedMagic = 0x44435850; // "PXCD"
+            static constexpr AZ::u32 ExpectedVersion = 2;
+
+            AZ::u32 m_magic = ExpectedMagic;
+            AZ::u32 m_version = ExpectedVersion;
+            AZ::u32 m_dataType = 0;
+            AZ::u32 m_padding = 0;
+            AZ::u64 m_geometryHashLow = 0;
+            AZ::u64 m_geometryHashHigh = 0;
+            AZ::u64 m_cookingParamsHash = 0;
+            AZ::u64 m_dataSize = 0;
+            AZ::u64 m_dataHash = 0; //!< Hash of the cooked data, catches truncated or corrupted files.
+        };
+
+        constexpr const char* DiskCacheFileExtension = ".pxcooked";
+        constexpr AZ::u64 BytesInMegabyte = 1024 * 1024;
+        //! Offset applied to the seed of the high half of the geometry hash so both halves are independent.
+        constexpr AZ::u64 HighHashSeedOffset = 0x9E3779B97F4A7C15ull;
+    } // namespace CookedDataCacheInternal
+
+    CookedDataCache::CookedDataCache(AZ::u64 cookingParamsHash)
+        : m_cookingParamsHash(cookingParamsHash)
+    {
+    }
+
+    void CookedDataCache::UpdateConfiguration(const CookedDataCacheConfiguration& config)
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        m_config = config;
+        EvictLocked(m_config.m_enabled ? m_config.m_maxMemoryMegabytes * CookedDataCacheInternal::BytesInMegabyte : 0);
+    }
+
+    bool CookedDataCache::GetOrCook(
+        DataType dataType, const GeometryHash& geometryHash, const CookFunction& cookFunction, AZStd::vector<AZ::u8>& cookedData)
+    {
+        AZ_PROFILE_FUNCTION(Physics);
+
+        const CacheKey key{ dataType, geometryHash };
+        bool diskCacheEnabled = false;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            if (m_config.m_enabled)
+            {
+                if (auto entryIt = m_entries.find(key); entryIt != m_entries.end())
+                {
+                    m_lru.splice(m_lru.begin(), m_lru, entryIt->second.m_lruPosition);
+                    cookedData = entryIt->second.m_cookedData;
+                    m_statistics.m_memoryHits++;
+                    return true;
+                }
+                diskCacheEnabled = m_config.m_diskCacheEnabled;
+            }
+        }
+
+        if (diskCacheEnabled && ReadFromDisk(key, cookedData))
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_statistics.m_diskHits++;
+            InsertLocked(key, cookedData);
+            return true;
+        }
+
+        // Cook outside of the lock, other threads can keep using the cache meanwhile.
+        const auto cookStart = AZStd::chrono::high_resolution_clock::now();
+        cookedData.clear();
+        const bool cooked = cookFunction(cookedData);
+        const auto cookTime = AZStd::chrono::microseconds(AZStd::chrono::high_resolution_clock::now() - cookStart);
+
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            m_statistics.m_misses++;
+            m_statistics.m_totalCookTimeMicroseconds += cookTime.count();
+            if (!cooked)
+            {
+                m_statistics.m_cookFailures++;
+                return false;
+            }
+            InsertLocked(key, cookedData);
+        }
+
+        if (diskCacheEnabled)
+        {
+            WriteToDisk(key, cookedData);
+        }
+        return true;
+    }
+
+    void CookedDataCache::Clear()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        EvictLocked(0);
+    }
+
+    CookedDataCache::Statistics CookedDataCache::GetStatistics() const
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        return m_statistics;
+    }
+
+    void CookedDataCache::ResetStatistics()
+    {
+        AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+        // Memory usage and entry count describe the current content rather than a history, so they are kept.
+        const AZ::u64 memoryUsageBytes = m_statistics.m_memoryUsageBytes;
+        const AZ::u64 numEntries = m_statistics.m_numEntries;
+        m_statistics = Statistics();
+        m_statistics.m_memoryUsageBytes = memoryUsageBytes;
+        m_statistics.m_numEntries = numEntries;
+    }
+
+    /*static*/ CookedDataCache::GeometryHash CookedDataCache::HashGeometry(const void* data, size_t size)
+    {
+        return HashGeometry(data, size, GeometryHash());
+    }
+
+    /*static*/ CookedDataCache::GeometryHash CookedDataCache::HashGeometry(const void* data, size_t size, const GeometryHash& seed)
+    {
+        GeometryHash hash;
+        hash.m_low = XXH64(data, size, seed.m_low);
+        hash.m_high = XXH64(data, size, seed.m_high + CookedDataCacheInternal::HighHashSeedOffset);
+        return hash;
+    }
+
+    size_t CookedDataCache::CacheKeyHasher::operator()(const CacheKey& key) const
+    {
+        size_t hash = static_cast<size_t>(key.m_geometryHash.m_low);
+        AZStd::hash_combine(hash, key.m_geometryHash.m_high, static_cast<AZ::u8>(key.m_dataType));
+        return hash;
+    }
+
+    void CookedDataCache::InsertLocked(const CacheKey& key, const AZStd::vector<AZ::u8>& cookedData)
+    {
+        if (!m_config.m_enabled)
+        {
+            return;
+        }
+
+        const AZ::u64 budgetBytes = m_config.m_maxMemoryMegabytes * CookedDataCacheInternal::BytesInMegabyte;
+        if (cookedData.size() > budgetBytes)
+        {
+            return; // would evict everything else and still not fit.
+        }
+
+        if (auto entryIt = m_entries.find(key); entryIt != m_entries.end())
+        {
+            // Another thread cooked the same geometry meanwhile, keep the existing entry.
+            m_lru.splice(m_lru.begin(), m_lru, entryIt->second.m_lruPosition);
+            return;
+        }
+
+        m_lru.push_front(key);
+        CacheEntry& entry = m_entries[key];
+        entry.m_cookedData = cookedData;
+        entry.m_lruPosition = m_lru.begin();
+        m_statistics.m_memoryUsageBytes += cookedData.size();
+        m_statistics.m_numEntries = m_entries.size();
+
+        EvictLocked(budgetBytes);
+    }
+
+    void CookedDataCache::EvictLocked(AZ::u64 budgetBytes)
+    {
+        while (m_statistics.m_memoryUsageBytes > budgetBytes && !m_lru.empty())
+        {
+            const CacheKey evictedKey = m_lru.back();
+            m_lru.pop_back();
+            if (auto entryIt = m_entries.find(evictedKey); entryIt != m_entries.end())
+            {
+                m_statistics.m_memoryUsageBytes -= entryIt->second.m_cookedData.size();
+                m_entries.erase(entryIt);
+            }
+        }
+        m_statistics.m_numEntries = m_entries.size();
+    }
+
+    AZStd::string CookedDataCache::GetDiskCacheFilePath(const CacheKey& key) const
+    {
+        AZStd::string diskCachePath;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(m_mutex);
+            diskCachePath = m_config.m_diskCachePath;
+        }
+        size_t fileKey = static_cast<size_t>(key.m_geometryHash.m_low);
+        AZStd::hash_combine(fileKey, m_cookingParamsHash, static_cast<AZ::u8>(key.m_dataType));
+        return AZStd::string::format("%s/%016llx%s", diskCachePath.c_str(), static_cast<unsigned long long>(fileKey),
+            CookedDataCacheInternal::DiskCacheFileExtension);
+    }
+
+    bool CookedDataCache::ReadFromDisk(const CacheKey& key, AZStd::vector<AZ::u8>& cookedData) const
+    {
+        AZ_PROFILE_FUNCTION(Physics);
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        if (fileIO == nullptr)
+        {
+            return false;
+        }
+
+        const AZStd::string filePath = GetDiskCacheFilePath(key);
+        if (!fileIO->Exists(filePath.c_str()))
+        {
+            return false;
+        }
+
+        AZ::IO::FileIOStream fileStream(filePath.c_str(), AZ::IO::OpenMode::ModeRead | AZ::IO::OpenMode::ModeBinary);
+        if (!fileStream.IsOpen())
+        {
+            return false;
+        }
+
+        CookedDataCacheInternal::DiskCacheHeader header;
+        if (fileStream.Read(sizeof(header), &header) != sizeof(header) ||
+            header.m_magic != CookedDataCacheInternal::DiskCacheHeader::ExpectedMagic ||
+            header.m_version != CookedDataCacheInternal::DiskCacheHeader::ExpectedVersion ||
+            header.m_dataSize != fileStream.GetLength() - sizeof(header))
+        {
+            AZ_Warning("PhysX", false, "Ignoring invalid cooked data cache file '%s'.", filePath.c_str());
+            return false;
+        }
+
+        // The file name only holds a 64 bit hash, a file written for other geometry or cooking params is a miss.
+        if (header.m_dataType != static_cast<AZ::u32>(key.m_dataType) ||
+            header.m_geometryHashLow != key.m_geometryHash.m_low ||
+            header.m_geometryHashHigh != key.m_geometryHash.m_high ||
+            header.m_cookingParamsHash != m_cookingParamsHash)
+        {
+            return false;
+        }
+
+        cookedData.resize_no_construct(header.m_dataSize);
+        if (fileStream.Read(header.m_dataSize, cookedData.data()) != header.m_dataSize ||
+            XXH64(cookedData.data(), cookedData.size(), 0) != header.m_dataHash)
+        {
+            AZ_Warning("PhysX", false, "Ignoring corrupted cooked data cache file '%s'.", filePath.c_str());
+            cookedData.clear();
+            return false;
+        }
+        return true;
+    }
+
+    void CookedDataCache::WriteToDisk(const CacheKey& key, const AZStd::vector<AZ::u8>& cookedData) const
+    {
+        AZ_PROFILE_FUNCTION(Physics);
+
+        AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
+        if (fileIO == nullptr)
+        {
+            return;
+        }
+
+        // Write to a temporary file first so a concurrent reader never sees a partially written entry.
+        const AZStd::string filePath = GetDiskCacheFilePath(key);
+        const AZStd::string tempFilePath = filePath + ".tmp";
+        {
+            AZ::IO::FileIOStream fileStream(tempFilePath.c_str(),
+                AZ::IO::OpenMode::ModeWrite | AZ::IO::OpenMode::ModeBinary | AZ::IO::OpenMode::ModeCreatePath);
+            if (!fileStream.IsOpen())
+            {
+                AZ_Warning("PhysX", false, "Unable to write cooked data cache file '%s'.", tempFilePath.c_str());
+                return;
+            }
+
+            CookedDataCacheInternal::DiskCacheHeader header;
+            header.m_dataType = static_cast<AZ::u32>(key.m_dataType);
+            header.m_geometryHashLow = key.m_geometryHash.m_low;
+            header.m_geometryHashHigh = key.m_geometryHash.m_high;
+            header.m_cookingParamsHash = m_cookingParamsHash;
+            header.m_dataSize = cookedData.size();
+            header.m_dataHash = XXH64(cookedData.data(), cookedData.size(), 0);
+            if (fileStream.Write(sizeof(header), &header) != sizeof(header) ||
+                fileStream.Write(cookedData.size(), cookedData.data()) != cookedData.size())
+            {
+                AZ_Warning("PhysX", false, "Unable to write cooked data cache file '%s'.", tempFilePath.c_str());
+                fileStream.Close();
+                fileIO->Remove(tempFilePath.c_str());
+                return;
+            }
+        }
+
+        if (fileIO->Exists(filePath.c_str()))
+        {
+            fileIO->Remove(filePath.c_str());
+        }
+        if (!fileIO->Rename(tempFilePath.c_str(), filePath.c_str()))
+        {
+            fileIO->Remove(tempFilePath.c_str());
+        }
+    }
+} // namespace PhysX
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/std/containers/list.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/functional.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
+
+#include <PhysX/Configuration/PhysXConfiguration.h>
+
+namespace PhysX
+{
+    //! Content hashed cache of data cooked by PhysX at runtime.
+    //! Entries are keyed by the type of the cooked object, a hash of the source geometry and a hash of the
+    //! cooking params, so re-creating the same collider (e.g. re-activating a level or respawning the same
+    //! geometry) skips cooking. Entries live in memory up to a budget and can optionally be persisted on disk.
+    //! All functions are thread safe, cooking itself is done outside of the cache lock.
+    class CookedDataCache
+    {
+    public:
+        //! Type of the cooked PhysX object, part of the cache key.
+        enum class DataType : AZ::u8
+        {
+            ConvexMesh,
+            TriangleMesh,
+            HeightField
+        };
+
+        //! Counters reported by GetStatistics.
+        struct Statistics
+        {
+            AZ::u64 m_memoryHits = 0; //!< Requests served from the in memory cache.
+            AZ::u64 m_diskHits = 0; //!< Requests served from the on disk cache.
+            AZ::u64 m_misses = 0; //!< Requests which had to be cooked.
+            AZ::u64 m_cookFailures = 0; //!< Requests for which cooking failed, failures are not cached.
+            AZ::u64 m_totalCookTimeMicroseconds = 0; //!< Total time spent cooking on cache misses.
+            AZ::u64 m_memoryUsageBytes = 0; //!< Size of the cooked data currently held in memory.
+            AZ::u64 m_numEntries = 0; //!< Number of entries currently held in memory.
+        };
+
+        //! 128 bit hash of the source geometry, see HashGeometry.
+        //! Both halves are compared on lookup so two different meshes never share an entry, even if their 64 bit
+        //! file name on disk collides.
+        struct GeometryHash
+        {
+            AZ::u64 m_low = 0;
+            AZ::u64 m_high = 0;
+
+            bool operator==(const GeometryHash& other) const
+            {
+                return m_low == other.m_low && m_high == other.m_high;
+            }
+            bool operator!=(const GeometryHash& other) const
+            {
+                return !(*this == other);
+            }
+        };
+
+        //! Function cooking the data on a cache miss. Returns false if cooking failed.
+        using CookFunction = AZStd::function<bool(AZStd::vector<AZ::u8>& cookedData)>;
+
+        explicit CookedDataCache(AZ::u64 cookingParamsHash = 0);
+
+        //! Apply new settings. Entries exceeding a reduced memory budget are evicted, disabling the cache clears it.
+        void UpdateConfiguration(const CookedDataCacheConfiguration& config);
+
+        //! Get the cooked data for the given geometry, from the cache if present or by calling cookFunction otherwise.
+        //! @param dataType Type of the cooked object.
+        //! @param geometryHash Hash of everything the cooked output depends on besides the cooking params, see HashGeometry.
+        //! @param cookFunction Function cooking the data on a miss.
+        //! @param cookedData Receives the cooked data.
+        //! @return Returns false if the data was not in the cache and cooking failed.
+        bool GetOrCook(DataType dataType, const GeometryHash& geometryHash, const CookFunction& cookFunction, AZStd::vector<AZ::u8>& cookedData);
+
+        //! Remove all entries from the in memory cache. The on disk cache is left untouched.
+        void Clear();
+
+        Statistics GetStatistics() const;
+        void ResetStatistics();
+
+        //! Hash a buffer of source geometry, the seed allows chaining several buffers into one hash.
+        static GeometryHash HashGeometry(const void* data, size_t size);
+        static GeometryHash HashGeometry(const void* data, size_t size, const GeometryHash& seed);
+
+    private:
+        //! Full key of an entry. The cooking params hash is the same for all entries of a cache so it is not part of it.
+        struct CacheKey
+        {
+            DataType m_dataType = DataType::ConvexMesh;
+            GeometryHash m_geometryHash;
+
+            bool operator==(const CacheKey& other) const
+            {
+                return m_dataType == other.m_dataType && m_geometryHash == other.m_geometryHash;
+            }
+        };
+        struct CacheKeyHasher
+        {
+            size_t operator()(const CacheKey& key) const;
+        };
+        using LruList = AZStd::list<CacheKey>;
+        struct CacheEntry
+        {
+            AZStd::vector<AZ::u8> m_cookedData;
+            LruList::iterator m_lruPosition;
+        };
+
+        //! Name of the on disk cache file. It is only 64 bits strong, the full key is stored in the file and verified on read.
+        AZStd::string GetDiskCacheFilePath(const CacheKey& key) const;
+        bool ReadFromDisk(const CacheKey& key, AZStd::vector<AZ::u8>& cookedData) const;
+        void WriteToDisk(const CacheKey& key, const AZStd::vector<AZ::u8>& cookedData) const;
+
+        //! Inserts or refreshes an entry and evicts the least recently used entries above the memory budget. Expects m_mutex to be held.
+        void InsertLocked(const CacheKey& key, const AZStd::vector<AZ::u8>& cookedData);
+        void EvictLocked(AZ::u64 budgetBytes);
+
+        const AZ::u64 m_cookingParamsHash;
+        CookedDataCacheConfiguration m_config;
+
+        mutable AZStd::mutex m_mutex;
+        AZStd::unordered_map<CacheKey, CacheEntry, CacheKeyHasher> m_entries;
+        LruList m_lru; //!< Most recently used keys are at the front.
+        Statistics m_statistics;
+    };
+} // namespace PhysX
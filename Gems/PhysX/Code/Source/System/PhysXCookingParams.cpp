@@ -7,6 +7,8 @@
  */
 #include <System/PhysXCookingParams.h>
 
+#include <AzCore/std/hash.h>
+
 namespace PhysX
 {
     namespace PxCooking
@@ -37,5 +39,25 @@ namespace PhysX
 
             return params;
         }
+
+        AZ::u64 HashCookingParams(const physx::PxCookingParams& params)
+        {
+            size_t hash = 0;
+            AZStd::hash_combine(hash,
+                static_cast<AZ::u32>(PX_PHYSICS_VERSION),
+                params.areaTestEpsilon,
+                params.planeTolerance,
+                static_cast<AZ::u32>(params.convexMeshCookingType),
+                params.suppressTriangleMeshRemapTable,
+                params.buildTriangleAdjacencies,
+                params.buildGPUData,
+                params.scale.length,
+                params.scale.speed,
+                static_cast<AZ::u32>(params.meshPreprocessParams),
+                params.meshWeldTolerance,
+                static_cast<AZ::u32>(params.midphaseDesc.getType()),
+                params.gaussMapLimit);
+            return static_cast<AZ::u64>(hash);
+        }
     }
 }
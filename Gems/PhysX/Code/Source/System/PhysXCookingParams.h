@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include <AzCore/base.h>
 #include <PxPhysicsAPI.h>
 
 namespace PhysX
@@ -20,5 +21,9 @@ namespace PhysX
         //! Return PxCookingParams better suited for use at edit-time, these parameters will
         //! increase cooking time but improve accuracy/precision.
         physx::PxCookingParams GetEditTimeCookingParams();
+
+        //! Return a hash of the PxCookingParams values which affect the cooked output, together with the PhysX version.
+        //! Used to key cached cooked data so it is never re-used across different cooking setups.
+        AZ::u64 HashCookingParams(const physx::PxCookingParams& params);
     }
 }
@@ -11,6 +11,7 @@
 #include <Scene/PhysXScene.h>
 #include <System/PhysXSystem.h>
 #include <System/PhysXAllocator.h>
+#include <System/PhysXCookingParams.h>
 #include <System/PhysXCpuDispatcher.h>
 #include <PhysX/Debug/PhysXDebugConfiguration.h>
 
@@ -61,7 +62,8 @@ namespace PhysX
     }
     
     PhysXSystem::PhysXSystem(PhysXSettingsRegistryManager* registryManager, const physx::PxCookingParams& cookingParams)
-        : m_registryManager(*registryManager)
+        : m_cookedDataCache(PxCooking::HashCookingParams(cookingParams))
+        , m_registryManager(*registryManager)
         , m_materialLibraryAssetHelper(
             [this](const AZ::Data::Asset<Physics::MaterialLibraryAsset>& materialLibrary)
             {
@@ -96,6 +98,7 @@ namespace PhysX
         {
             m_systemConfig = *physXConfig;
         }
+        m_cookedDataCache.UpdateConfiguration(m_systemConfig.m_cookedDataCacheConfiguration);
 
         AzFramework::AssetCatalogEventBus::Handler::BusConnect();
 
@@ -385,6 +388,7 @@ namespace PhysX
         {
             const bool newMaterialLibrary = m_systemConfig.m_materialLibraryAsset != physXConfig->m_materialLibraryAsset;
             m_systemConfig = (*physXConfig);
+            m_cookedDataCache.UpdateConfiguration(m_systemConfig.m_cookedDataCacheConfiguration);
             m_configChangeEvent.Signal(physXConfig);
 
             //LYN-1146 -- Restarting the simulation if required
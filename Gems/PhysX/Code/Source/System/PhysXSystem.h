@@ -18,6 +18,7 @@
 #include <Debug/PhysXDebug.h>
 #include <Scene/PhysXSceneInterface.h>
 #include <System/PhysXAllocator.h>
+#include <System/PhysXCookedDataCache.h>
 #include <System/PhysXSdkCallbacks.h>
 
 #include <PhysX/Configuration/PhysXConfiguration.h>
@@ -80,6 +81,8 @@ namespace PhysX
             AZ_Assert(m_cpuDispatcher, "PhysX CPU dispatcher was not created");
             return m_cpuDispatcher;
         }
+        //! Cache of data cooked at runtime, shared by all the runtime cooking paths.
+        CookedDataCache& GetCookedDataCache() { return m_cookedDataCache; }
         void SetCollisionLayerName(int index, const AZStd::string& layerName);
         void CreateCollisionGroup(const AZStd::string& groupName, const AzPhysics::CollisionGroup& group);
         //TEMP -- until these are fully moved over here
@@ -114,6 +117,8 @@ namespace PhysX
 
         physx::PxCpuDispatcher* m_cpuDispatcher = nullptr;
 
+        CookedDataCache m_cookedDataCache;
+
         enum class State : AZ::u8
         {
             Uninitialized = 0,
@@ -26,6 +26,27 @@
 
 namespace PhysX
 {
+    namespace Internal
+    {
+        //! Hashes the x, y, z components of a strided array of points, ignoring any padding in between.
+        CookedDataCache::GeometryHash HashPoints(const void* points, AZ::u32 pointCount, AZ::u32 pointStride)
+        {
+            constexpr size_t PointSize = sizeof(float) * 3;
+            if (pointStride == PointSize)
+            {
+                return CookedDataCache::HashGeometry(points, PointSize * pointCount);
+            }
+
+            AZStd::vector<float> packedPoints(pointCount * 3);
+            const AZ::u8* pointBytes = static_cast<const AZ::u8*>(points);
+            for (AZ::u32 i = 0; i < pointCount; ++i)
+            {
+                memcpy(&packedPoints[i * 3], pointBytes + i * pointStride, PointSize);
+            }
+            return CookedDataCache::HashGeometry(packedPoints.data(), packedPoints.size() * sizeof(float));
+        }
+    } // namespace Internal
+
     bool SystemComponent::VersionConverter(AZ::SerializeContext& context,
         AZ::SerializeContext::DataElementNode& classElement)
     {
@@ -244,9 +265,23 @@ namespace PhysX
         // we provide points only, therefore the PxConvexFlag::eCOMPUTE_CONVEX flag must be specified
         desc.flags = physx::PxConvexFlag::eCOMPUTE_CONVEX;
 
-        //TEMP until this in moved over
-        physx::PxConvexMesh* convex = m_physXSystem->GetPxCooking()->createConvexMesh(desc,
-            m_physXSystem->GetPxPhysics()->getPhysicsInsertionCallback());
+        // Cook through the cooked data cache so creating the same convex again skips cooking.
+        const CookedDataCache::GeometryHash geometryHash = Internal::HashPoints(vertices, vertexNum, vertexStride);
+        AZStd::vector<AZ::u8> cookedData;
+        const bool cooked = m_physXSystem->GetCookedDataCache().GetOrCook(CookedDataCache::DataType::ConvexMesh, geometryHash,
+            [this, &desc](AZStd::vector<AZ::u8>& result)
+            {
+                physx::PxDefaultMemoryOutputStream memoryStream;
+                if (!m_physXSystem->GetPxCooking()->cookConvexMesh(desc, memoryStream))
+                {
+                    return false;
+                }
+                result.assign(memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+                return true;
+            },
+            cookedData);
+
+        physx::PxConvexMesh* convex = cooked ? CreateConvexMeshFromCooked(cookedData.data(), aznumeric_cast<AZ::u32>(cookedData.size())) : nullptr;
         AZ_Error("PhysX", convex, "Error. Unable to create convex mesh");
 
         return convex;
@@ -261,8 +296,31 @@ namespace PhysX
         desc.samples.data = samples;
         desc.samples.stride = sizeof(physx::PxHeightFieldSample);
 
-        physx::PxHeightField* heightfield =
-            m_physXSystem->GetPxCooking()->createHeightField(desc, m_physXSystem->GetPxPhysics()->getPhysicsInsertionCallback());
+        // Cook through the cooked data cache so re-creating the same heightfield skips cooking.
+        CookedDataCache::GeometryHash geometryHash = CookedDataCache::HashGeometry(&numRows, sizeof(numRows));
+        geometryHash = CookedDataCache::HashGeometry(&numColumns, sizeof(numColumns), geometryHash);
+        geometryHash = CookedDataCache::HashGeometry(samples, sizeof(physx::PxHeightFieldSample) * numRows * numColumns, geometryHash);
+
+        AZStd::vector<AZ::u8> cookedData;
+        const bool cooked = m_physXSystem->GetCookedDataCache().GetOrCook(CookedDataCache::DataType::HeightField, geometryHash,
+            [this, &desc](AZStd::vector<AZ::u8>& result)
+            {
+                physx::PxDefaultMemoryOutputStream memoryStream;
+                if (!m_physXSystem->GetPxCooking()->cookHeightField(desc, memoryStream))
+                {
+                    return false;
+                }
+                result.assign(memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+                return true;
+            },
+            cookedData);
+
+        physx::PxHeightField* heightfield = nullptr;
+        if (cooked)
+        {
+            physx::PxDefaultMemoryInputData inpStream(cookedData.data(), aznumeric_cast<physx::PxU32>(cookedData.size()));
+            heightfield = m_physXSystem->GetPxPhysics()->createHeightField(inpStream);
+        }
         AZ_Error("PhysX", heightfield, "Error. Unable to create heightfield");
 
         return heightfield;
@@ -299,13 +357,25 @@ namespace PhysX
 
     bool SystemComponent::CookConvexMeshToMemory(const AZ::Vector3* vertices, AZ::u32 vertexCount, AZStd::vector<AZ::u8>& result)
     {
-        physx::PxDefaultMemoryOutputStream memoryStream;
-        
-        bool cookingResult = Utils::CookConvexToPxOutputStream(vertices, vertexCount, memoryStream);
+        const CookedDataCache::GeometryHash geometryHash = Internal::HashPoints(vertices, vertexCount, sizeof(AZ::Vector3));
+
+        AZStd::vector<AZ::u8> cookedData;
+        bool cookingResult = m_physXSystem->GetCookedDataCache().GetOrCook(CookedDataCache::DataType::ConvexMesh, geometryHash,
+            [vertices, vertexCount](AZStd::vector<AZ::u8>& cooked)
+            {
+                physx::PxDefaultMemoryOutputStream memoryStream;
+                if (!Utils::CookConvexToPxOutputStream(vertices, vertexCount, memoryStream))
+                {
+                    return false;
+                }
+                cooked.assign(memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+                return true;
+            },
+            cookedData);
         
         if(cookingResult)
         {
-            result.insert(result.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+            result.insert(result.end(), cookedData.begin(), cookedData.end());
         }
         
         return cookingResult;
@@ -314,12 +384,29 @@ namespace PhysX
     bool SystemComponent::CookTriangleMeshToMemory(const AZ::Vector3* vertices, AZ::u32 vertexCount,
         const AZ::u32* indices, AZ::u32 indexCount, AZStd::vector<AZ::u8>& result)
     {
-        physx::PxDefaultMemoryOutputStream memoryStream;
-        bool cookingResult = Utils::CookTriangleMeshToToPxOutputStream(vertices, vertexCount, indices, indexCount, memoryStream);
+        // The counts are hashed too so the split between vertices and indices is part of the hash.
+        CookedDataCache::GeometryHash geometryHash = Internal::HashPoints(vertices, vertexCount, sizeof(AZ::Vector3));
+        geometryHash = CookedDataCache::HashGeometry(indices, sizeof(AZ::u32) * indexCount, geometryHash);
+        const AZ::u32 counts[] = { vertexCount, indexCount };
+        geometryHash = CookedDataCache::HashGeometry(counts, sizeof(counts), geometryHash);
+
+        AZStd::vector<AZ::u8> cookedData;
+        bool cookingResult = m_physXSystem->GetCookedDataCache().GetOrCook(CookedDataCache::DataType::TriangleMesh, geometryHash,
+            [vertices, vertexCount, indices, indexCount](AZStd::vector<AZ::u8>& cooked)
+            {
+                physx::PxDefaultMemoryOutputStream memoryStream;
+                if (!Utils::CookTriangleMeshToToPxOutputStream(vertices, vertexCount, indices, indexCount, memoryStream))
+                {
+                    return false;
+                }
+                cooked.assign(memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+                return true;
+            },
+            cookedData);
 
         if (cookingResult)
         {
-            result.insert(result.end(), memoryStream.getData(), memoryStream.getData() + memoryStream.getSize());
+            result.insert(result.end(), cookedData.begin(), cookedData.end());
         }
 
         return cookingResult;
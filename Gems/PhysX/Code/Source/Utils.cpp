@@ -10,6 +10,7 @@
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Component/NonUniformScaleBus.h>
 #include <AzCore/Casting/lossy_cast.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/EBus/Results.h>
 #include <AzCore/Interface/Interface.h>
 #include <AzCore/RTTI/BehaviorContext.h>
@@ -66,6 +67,111 @@ namespace PhysX
             }
         }
 
+        namespace Internal
+        {
+            //! Returns the factor converting floating-point heights within the heightfield bounds to the int16 heights used by PhysX.
+            float GetHeightfieldScaleFactor(const Physics::HeightfieldShapeConfiguration& heightfieldConfig)
+            {
+                const float minHeightBounds = heightfieldConfig.GetMinHeightBounds();
+                const float maxHeightBounds = heightfieldConfig.GetMaxHeightBounds();
+                const float halfBounds{ (maxHeightBounds - minHeightBounds) / 2.0f };
+
+                // We're making the assumption right now that the min/max bounds are centered around 0.
+                // If we ever want to allow off-center bounds, we'll need to fix up the float-to-int16 height math below
+                // to account for it.
+                AZ_Assert(
+                    AZ::IsClose(-halfBounds, minHeightBounds) && AZ::IsClose(halfBounds, maxHeightBounds),
+                    "Min/Max height bounds aren't centered around 0, the height conversions below will be incorrect.");
+
+                AZ_Assert(
+                    maxHeightBounds >= minHeightBounds,
+                    "Max height bounds is less than min height bounds, the height conversions below will be incorrect.");
+
+                // To convert our floating-point heights to fixed-point representation inside of an int16, we need a scale factor
+                // for the conversion.  The scale factor is used to map the most important bits of our floating-point height to the
+                // full 16-bit range.
+                // Note that the scaleFactor choice here affects overall precision.  For each bit that the integer part of our max
+                // height uses, that's one less bit for the fractional part.
+                return (maxHeightBounds <= minHeightBounds) ? 1.0f : AZStd::numeric_limits<int16_t>::max() / halfBounds;
+            }
+
+            //! Converts the sample at (row, col) of the heightfield configuration to its PhysX representation.
+            //! The PhysX sample also depends on the samples below and to the right of it, which provide the quad materials.
+            physx::PxHeightFieldSample CreatePxHeightfieldSample(
+                const Physics::HeightfieldShapeConfiguration& heightfieldConfig, float scaleFactor, int32_t row, int32_t col)
+            {
+                [[maybe_unused]] constexpr uint8_t physxMaximumMaterialIndex = 0x7f;
+
+                const AZStd::vector<Physics::HeightMaterialPoint>& samples = heightfieldConfig.GetSamples();
+                const int32_t numCols = heightfieldConfig.GetNumColumns();
+                const int32_t numRows = heightfieldConfig.GetNumRows();
+                const float minHeightBounds = heightfieldConfig.GetMinHeightBounds();
+                const float maxHeightBounds = heightfieldConfig.GetMaxHeightBounds();
+
+                const bool lastRowIndex = (row == (numRows - 1));
+                const bool lastColumnIndex = (col == (numCols - 1));
+
+                auto GetIndex = [numCols](int32_t row, int32_t col)
+                {
+                    return (row * numCols) + col;
+                };
+
+                const Physics::HeightMaterialPoint& currentSample = samples[GetIndex(row, col)];
+                physx::PxHeightFieldSample currentPhysxSample;
+                AZ_Assert(currentSample.m_materialIndex < physxMaximumMaterialIndex, "MaterialIndex must be less than 128");
+                currentPhysxSample.height = azlossy_cast<physx::PxI16>(
+                    AZ::GetClamp(currentSample.m_height, minHeightBounds, maxHeightBounds) * scaleFactor);
+                if (lastRowIndex || lastColumnIndex)
+                {
+                    // In PhysX, the material indices refer to the quad down and to the right of the sample.
+                    // If we're in the last row or last column, there aren't any quads down or to the right,
+                    // so just clear these out.
+                    currentPhysxSample.materialIndex0 = 0;
+                    currentPhysxSample.materialIndex1 = 0;
+                }
+                else
+                {
+                    // Our source data is providing one material index per vertex, but PhysX wants one material index
+                    // per triangle.  The heuristic that we'll go with for selecting the material index is to choose
+                    // the material for the vertex that's not on the diagonal of each triangle.
+                    // Ex:  A *---* B
+                    //        | / |      For this, we'll use A for index0 and D for index1.
+                    //      C *---* D
+                    //
+                    // Ex:  A *---* B
+                    //        | \ |      For this, we'll use C for index0 and B for index1.
+                    //      C *---* D
+                    //
+                    // This is a pretty arbitrary choice, so the heuristic might need to be revisited over time if this
+                    // causes incorrect or unpredictable physics material mappings.
+
+                    switch (currentSample.m_quadMeshType)
+                    {
+                    case Physics::QuadMeshType::SubdivideUpperLeftToBottomRight:
+                        currentPhysxSample.materialIndex0 = samples[GetIndex(row + 1, col)].m_materialIndex;
+                        currentPhysxSample.materialIndex1 = samples[GetIndex(row, col + 1)].m_materialIndex;
+                        // Set the tesselation flag to say that we need to go from UL to BR
+                        currentPhysxSample.materialIndex0.setBit();
+                        break;
+                    case Physics::QuadMeshType::SubdivideBottomLeftToUpperRight:
+                        currentPhysxSample.materialIndex0 = currentSample.m_materialIndex;
+                        currentPhysxSample.materialIndex1 = samples[GetIndex(row + 1, col + 1)].m_materialIndex;
+                        break;
+                    case Physics::QuadMeshType::Hole:
+                        currentPhysxSample.materialIndex0 = physx::PxHeightFieldMaterial::eHOLE;
+                        currentPhysxSample.materialIndex1 = physx::PxHeightFieldMaterial::eHOLE;
+                        break;
+                    default:
+                        AZ_Warning("PhysX Heightfield", false, "Unhandled case in CreatePxGeometryFromConfig");
+                        currentPhysxSample.materialIndex0 = 0;
+                        currentPhysxSample.materialIndex1 = 0;
+                        break;
+                    }
+                }
+                return currentPhysxSample;
+            }
+        } // namespace Internal
+
         void CreatePxGeometryFromHeightfield(
             Physics::HeightfieldShapeConfiguration& heightfieldConfig, physx::PxGeometryHolder& pxGeometry)
         {
@@ -79,31 +185,9 @@ namespace PhysX
             const float rowScale = gridSpacing.GetX();
             const float colScale = gridSpacing.GetY();
 
-            const float minHeightBounds = heightfieldConfig.GetMinHeightBounds();
-            const float maxHeightBounds = heightfieldConfig.GetMaxHeightBounds();
-            const float halfBounds{ (maxHeightBounds - minHeightBounds) / 2.0f };
-
-            // We're making the assumption right now that the min/max bounds are centered around 0.
-            // If we ever want to allow off-center bounds, we'll need to fix up the float-to-int16 height math below
-            // to account for it.
-            AZ_Assert(
-                AZ::IsClose(-halfBounds, minHeightBounds) && AZ::IsClose(halfBounds, maxHeightBounds),
-                "Min/Max height bounds aren't centered around 0, the height conversions below will be incorrect.");
-
-            AZ_Assert(
-                maxHeightBounds >= minHeightBounds,
-                "Max height bounds is less than min height bounds, the height conversions below will be incorrect.");
-
-            // To convert our floating-point heights to fixed-point representation inside of an int16, we need a scale factor
-            // for the conversion.  The scale factor is used to map the most important bits of our floating-point height to the
-            // full 16-bit range.
-            // Note that the scaleFactor choice here affects overall precision.  For each bit that the integer part of our max
-            // height uses, that's one less bit for the fractional part.
-            const float scaleFactor = (maxHeightBounds <= minHeightBounds) ? 1.0f : AZStd::numeric_limits<int16_t>::max() / halfBounds;
+            const float scaleFactor = Internal::GetHeightfieldScaleFactor(heightfieldConfig);
             const float heightScale{ 1.0f / scaleFactor };
 
-            [[maybe_unused]] constexpr uint8_t physxMaximumMaterialIndex = 0x7f;
-
             // Delete the cached heightfield object if it is there, and create a new one and save in the shape configuration
             heightfieldConfig.SetCachedNativeHeightfield(nullptr);
 
@@ -116,71 +200,9 @@ namespace PhysX
 
                 for (int32_t row = 0; row < numRows; row++)
                 {
-                    const bool lastRowIndex = (row == (numRows - 1));
-
                     for (int32_t col = 0; col < numCols; col++)
                     {
-                        const bool lastColumnIndex = (col == (numCols - 1));
-
-                        auto GetIndex = [numCols](int32_t row, int32_t col)
-                        {
-                            return (row * numCols) + col;
-                        };
-
-                        const int32_t sampleIndex = GetIndex(row, col);
-
-                        const Physics::HeightMaterialPoint& currentSample = samples[sampleIndex];
-                        physx::PxHeightFieldSample& currentPhysxSample = physxSamples[sampleIndex];
-                        AZ_Assert(currentSample.m_materialIndex < physxMaximumMaterialIndex, "MaterialIndex must be less than 128");
-                        currentPhysxSample.height = azlossy_cast<physx::PxI16>(
-                            AZ::GetClamp(currentSample.m_height, minHeightBounds, maxHeightBounds) * scaleFactor);
-                        if (lastRowIndex || lastColumnIndex)
-                        {
-                            // In PhysX, the material indices refer to the quad down and to the right of the sample.
-                            // If we're in the last row or last column, there aren't any quads down or to the right,
-                            // so just clear these out.
-                            currentPhysxSample.materialIndex0 = 0;
-                            currentPhysxSample.materialIndex1 = 0;
-                        }
-                        else
-                        {
-                            // Our source data is providing one material index per vertex, but PhysX wants one material index
-                            // per triangle.  The heuristic that we'll go with for selecting the material index is to choose
-                            // the material for the vertex that's not on the diagonal of each triangle.
-                            // Ex:  A *---* B
-                            //        | / |      For this, we'll use A for index0 and D for index1.
-                            //      C *---* D
-                            //
-                            // Ex:  A *---* B
-                            //        | \ |      For this, we'll use C for index0 and B for index1.
-                            //      C *---* D
-                            //
-                            // This is a pretty arbitrary choice, so the heuristic might need to be revisited over time if this
-                            // causes incorrect or unpredictable physics material mappings.
-
-                            switch (currentSample.m_quadMeshType)
-                            {
-                            case Physics::QuadMeshType::SubdivideUpperLeftToBottomRight:
-                                currentPhysxSample.materialIndex0 = samples[GetIndex(row + 1, col)].m_materialIndex;
-                                currentPhysxSample.materialIndex1 = samples[GetIndex(row, col + 1)].m_materialIndex;
-                                // Set the tesselation flag to say that we need to go from UL to BR
-                                currentPhysxSample.materialIndex0.setBit();
-                                break;
-                            case Physics::QuadMeshType::SubdivideBottomLeftToUpperRight:
-                                currentPhysxSample.materialIndex0 = currentSample.m_materialIndex;
-                                currentPhysxSample.materialIndex1 = samples[GetIndex(row + 1, col + 1)].m_materialIndex;
-                                break;
-                            case Physics::QuadMeshType::Hole:
-                                currentPhysxSample.materialIndex0 = physx::PxHeightFieldMaterial::eHOLE;
-                                currentPhysxSample.materialIndex1 = physx::PxHeightFieldMaterial::eHOLE;
-                                break;
-                            default:
-                                AZ_Warning("PhysX Heightfield", false, "Unhandled case in CreatePxGeometryFromConfig");
-                                currentPhysxSample.materialIndex0 = 0;
-                                currentPhysxSample.materialIndex1 = 0;
-                                break;
-                            }
-                        }
+                        physxSamples[(row * numCols) + col] = Internal::CreatePxHeightfieldSample(heightfieldConfig, scaleFactor, row, col);
                     }
                 }
 
@@ -1562,6 +1584,107 @@ namespace PhysX
 
             return configuration;
         }
+
+        bool UpdateHeightfieldShapeRegion(
+            AZ::EntityId entityId, const AZ::Aabb& dirtyRegion, Physics::HeightfieldShapeConfiguration& configuration,
+            Physics::Shape& shape)
+        {
+            AZ_PROFILE_FUNCTION(Physics);
+
+            auto* pxShape = static_cast<physx::PxShape*>(shape.GetNativePointer());
+            if (!dirtyRegion.IsValid() || pxShape == nullptr)
+            {
+                return false;
+            }
+
+            // The samples can only be modified in place if the layout of the heightfield is unchanged.
+            AZ::Vector2 gridSpacing(1.0f);
+            Physics::HeightfieldProviderRequestsBus::EventResult(
+                gridSpacing, entityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldGridSpacing);
+
+            int32_t numRows = 0;
+            int32_t numColumns = 0;
+            Physics::HeightfieldProviderRequestsBus::Event(
+                entityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldGridSize, numColumns, numRows);
+
+            float minHeightBounds = 0.0f;
+            float maxHeightBounds = 0.0f;
+            Physics::HeightfieldProviderRequestsBus::Event(
+                entityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldHeightBounds, minHeightBounds, maxHeightBounds);
+
+            if (!gridSpacing.IsClose(configuration.GetGridResolution()) || numRows != configuration.GetNumRows() ||
+                numColumns != configuration.GetNumColumns() || !AZ::IsClose(minHeightBounds, configuration.GetMinHeightBounds()) ||
+                !AZ::IsClose(maxHeightBounds, configuration.GetMaxHeightBounds()) ||
+                configuration.GetSamples().size() != aznumeric_cast<size_t>(numRows) * aznumeric_cast<size_t>(numColumns))
+            {
+                return false;
+            }
+
+            size_t startColumn = 0;
+            size_t startRow = 0;
+            size_t regionColumns = 0;
+            size_t regionRows = 0;
+            Physics::HeightfieldProviderRequestsBus::Event(
+                entityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion, dirtyRegion,
+                startColumn, startRow, regionColumns, regionRows);
+
+            if (regionColumns == 0 || regionRows == 0)
+            {
+                // The change doesn't affect this heightfield.
+                return true;
+            }
+
+            AZStd::vector<Physics::HeightMaterialPoint> samples;
+            Physics::HeightfieldProviderRequestsBus::EventResult(
+                samples, entityId, &Physics::HeightfieldProviderRequestsBus::Events::GetHeightsAndMaterialsInRegion, startColumn,
+                startRow, regionColumns, regionRows);
+
+            if (samples.size() != regionColumns * regionRows)
+            {
+                return false;
+            }
+
+            configuration.ModifySamples(startColumn, startRow, regionColumns, regionRows, samples);
+
+            // The PhysX sample at (row, col) holds the materials of the quad down and to the right of it, so the samples
+            // directly above and to the left of the region change too.
+            const int32_t firstRow = AZStd::max(aznumeric_cast<int32_t>(startRow) - 1, 0);
+            const int32_t firstColumn = AZStd::max(aznumeric_cast<int32_t>(startColumn) - 1, 0);
+            const int32_t endRow = aznumeric_cast<int32_t>(startRow + regionRows);
+            const int32_t endColumn = aznumeric_cast<int32_t>(startColumn + regionColumns);
+
+            const float scaleFactor = Internal::GetHeightfieldScaleFactor(configuration);
+            AZStd::vector<physx::PxHeightFieldSample> physxSamples;
+            physxSamples.reserve((endRow - firstRow) * (endColumn - firstColumn));
+            for (int32_t row = firstRow; row < endRow; row++)
+            {
+                for (int32_t col = firstColumn; col < endColumn; col++)
+                {
+                    physxSamples.push_back(Internal::CreatePxHeightfieldSample(configuration, scaleFactor, row, col));
+                }
+            }
+
+            physx::PxHeightFieldDesc subfieldDesc;
+            subfieldDesc.format = physx::PxHeightFieldFormat::eS16_TM;
+            subfieldDesc.nbColumns = endColumn - firstColumn;
+            subfieldDesc.nbRows = endRow - firstRow;
+            subfieldDesc.samples.data = physxSamples.data();
+            subfieldDesc.samples.stride = sizeof(physx::PxHeightFieldSample);
+
+            physx::PxScene* pxScene = pxShape->getActor() ? pxShape->getActor()->getScene() : nullptr;
+            PHYSX_SCENE_WRITE_LOCK(pxScene);
+
+            physx::PxHeightFieldGeometry heightfieldGeometry;
+            if (!pxShape->getHeightFieldGeometry(heightfieldGeometry) || heightfieldGeometry.heightField == nullptr ||
+                !heightfieldGeometry.heightField->modifySamples(firstColumn, firstRow, subfieldDesc))
+            {
+                return false;
+            }
+
+            // Shapes only pick up the modified samples once their geometry is set again.
+            pxShape->setGeometry(heightfieldGeometry);
+            return true;
+        }
     } // namespace Utils
 
     namespace ReflectionUtils
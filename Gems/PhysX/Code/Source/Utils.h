@@ -190,6 +190,15 @@ namespace PhysX
 
         Physics::HeightfieldShapeConfiguration CreateHeightfieldShapeConfiguration(AZ::EntityId entityId);
 
+        //! Refreshes an existing heightfield shape in place for the region of the heightfield provider's data that changed.
+        //! Only the samples overlapping the region are requested from the provider, copied into the shape configuration
+        //! and applied to the native heightfield.
+        //! @return false if the heightfield can't be updated in place (e.g. its size or height bounds changed) and has to be
+        //! recreated with CreateHeightfieldShapeConfiguration instead.
+        bool UpdateHeightfieldShapeRegion(
+            AZ::EntityId entityId, const AZ::Aabb& dirtyRegion, Physics::HeightfieldShapeConfiguration& configuration,
+            Physics::Shape& shape);
+
         namespace Geometry
         {
             using PointList = AZStd::vector<AZ::Vector3>;
@@ -13,6 +13,7 @@
 #include <AzTest/AzTest.h>
 #include <AzFramework/Physics/RigidBodyBus.h>
 #include <AzFramework/Physics/ShapeConfiguration.h>
+#include <AzFramework/Physics/Configuration/SystemConfiguration.h>
 #include <Tests/PhysXGenericTestFixture.h>
 #include <Tests/PhysXTestCommon.h>
 #include <Benchmarks/PhysXBenchmarksCommon.h>
@@ -226,6 +227,106 @@ namespace PhysX::Benchmarks
         Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
     }
 
+    //! Helper to build one raycast request towards each of the spawned boxes.
+    static AzPhysics::SceneQueryRequests CreateRaycastRequestsToBoxes(const std::vector<AZ::Vector3>& boxes)
+    {
+        AzPhysics::SceneQueryRequests requests;
+        requests.reserve(boxes.size());
+        for (const AZ::Vector3& box : boxes)
+        {
+            auto request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = box.GetNormalized();
+            request->m_distance = 2000.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+        return requests;
+    }
+
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastSerialLoopRandomBoxes)(benchmark::State& state)
+    {
+        // Baseline for BM_RaycastBatchRandomBoxes, issuing the same requests one at a time.
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastRequestsToBoxes(m_boxes);
+
+        AZStd::vector<int64_t> executionTimes;
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            auto start = std::chrono::system_clock::now();
+
+            for (const auto& request : requests)
+            {
+                AzPhysics::SceneQueryHits result = sceneInterface->QueryScene(m_testSceneHandle, request.get());
+                benchmark::DoNotOptimize(result);
+            }
+
+            auto timeElasped = std::chrono::nanoseconds(std::chrono::system_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+        }
+
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+        state.SetItemsProcessed(state.iterations() * requests.size());
+    }
+
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)(benchmark::State& state)
+    {
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastRequestsToBoxes(m_boxes);
+
+        AZStd::vector<int64_t> executionTimes;
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        for (auto _ : state)
+        {
+            auto start = std::chrono::system_clock::now();
+
+            AzPhysics::SceneQueryHitsList result = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+            auto timeElasped = std::chrono::nanoseconds(std::chrono::system_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+
+            benchmark::DoNotOptimize(result);
+        }
+
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+        state.SetItemsProcessed(state.iterations() * requests.size());
+    }
+
+    BENCHMARK_DEFINE_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastAsyncBatchRandomBoxes)(benchmark::State& state)
+    {
+        // Measures the time from issuing the requests to receiving the callback, which includes one scene update
+        // as async query callbacks are dispatched when the scene finishes its simulation step.
+        const AzPhysics::SceneQueryRequests requests = CreateRaycastRequestsToBoxes(m_boxes);
+
+        AZStd::vector<int64_t> executionTimes;
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        AzPhysics::SceneQuery::AsyncRequestId requestId = 0;
+        for (auto _ : state)
+        {
+            auto start = std::chrono::system_clock::now();
+
+            size_t numHits = 0;
+            [[maybe_unused]] const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, requestId++, requests,
+                [&numHits](AzPhysics::SceneQuery::AsyncRequestId, AzPhysics::SceneQueryHitsList hits)
+                {
+                    numHits = hits.size();
+                });
+            TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+
+            auto timeElasped = std::chrono::nanoseconds(std::chrono::system_clock::now() - start);
+            executionTimes.emplace_back(timeElasped.count());
+
+            benchmark::DoNotOptimize(numHits);
+        }
+
+        Utils::ReportPercentiles(state, executionTimes);
+        Utils::ReportStandardDeviationAndMeanCounters(state, executionTimes);
+        state.SetItemsProcessed(state.iterations() * requests.size());
+    }
+
     BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastRandomBoxes)
         ->RangeMultiplier(2)
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[0])
@@ -250,5 +351,23 @@ namespace PhysX::Benchmarks
         ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
         ->Unit(::benchmark::kNanosecond)
         ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastSerialLoopRandomBoxes)
+        ->RangeMultiplier(2)
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[2])
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
+        ->Unit(::benchmark::kMicrosecond)
+        ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastBatchRandomBoxes)
+        ->RangeMultiplier(2)
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[2])
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
+        ->Unit(::benchmark::kMicrosecond)
+        ;
+    BENCHMARK_REGISTER_F(PhysXSceneQueryBenchmarkFixture, BM_RaycastAsyncBatchRandomBoxes)
+        ->RangeMultiplier(2)
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[2])
+        ->Ranges(SceneQueryConstants::BenchmarkConfigs[3])
+        ->Unit(::benchmark::kMicrosecond)
+        ;
 }
 #endif
@@ -211,5 +211,68 @@ namespace PhysXEditorTests
         CleanupHeightfieldComponent();
     }
 
+    TEST_F(PhysXEditorFixture, HeightfieldColliderComponentHeightfieldDataChangedInRegionUpdatesHeightfieldInPlace)
+    {
+        EntityPtr editorEntity = SetupHeightfieldComponent();
+        NiceMock<UnitTest::MockPhysXHeightfieldProvider> mockShapeRequests(editorEntity->GetId());
+        SetupMockMethods(mockShapeRequests);
+        editorEntity->Activate();
+
+        EntityPtr gameEntity = TestCreateActiveGameEntityFromEditorEntity(editorEntity.get());
+        NiceMock<UnitTest::MockPhysXHeightfieldProvider> mockShapeRequests2(gameEntity->GetId());
+        SetupMockMethods(mockShapeRequests2);
+        gameEntity->Activate();
+
+        AzPhysics::SimulatedBody* staticBody = nullptr;
+        AzPhysics::SimulatedBodyComponentRequestsBus::EventResult(
+            staticBody, gameEntity->GetId(), &AzPhysics::SimulatedBodyComponentRequests::GetSimulatedBody);
+        const auto* pxRigidStatic = static_cast<const physx::PxRigidStatic*>(staticBody->GetNativePointer());
+
+        auto getHeightfield = [pxRigidStatic]()
+        {
+            PHYSX_SCENE_READ_LOCK(pxRigidStatic->getScene());
+            physx::PxShape* shape = nullptr;
+            pxRigidStatic->getShapes(&shape, 1, 0);
+            physx::PxHeightFieldGeometry heightfieldGeometry;
+            shape->getHeightFieldGeometry(heightfieldGeometry);
+            return heightfieldGeometry.heightField;
+        };
+        physx::PxHeightField* heightfield = getHeightfield();
+
+        // The region update is done by the runtime collider of the game entity, the editor entity only provides the setup.
+        // Only the center sample changes.
+        const float newHeight = -2.0f;
+        ON_CALL(mockShapeRequests2, GetHeightfieldIndicesFromRegion)
+            .WillByDefault(
+                []([[maybe_unused]] const AZ::Aabb& region, size_t& startColumn, size_t& startRow, size_t& numColumns, size_t& numRows)
+                {
+                    startColumn = 1;
+                    startRow = 1;
+                    numColumns = 1;
+                    numRows = 1;
+                });
+        ON_CALL(mockShapeRequests2, GetHeightsAndMaterialsInRegion)
+            .WillByDefault(Return(AZStd::vector<Physics::HeightMaterialPoint>{
+                { newHeight, Physics::QuadMeshType::SubdivideUpperLeftToBottomRight } }));
+
+        Physics::HeightfieldProviderNotificationBus::Event(
+            gameEntity->GetId(), &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged,
+            AZ::Aabb::CreateFromMinMax(AZ::Vector3(1.0f), AZ::Vector3(2.0f)));
+
+        // The existing heightfield is modified rather than recreated.
+        EXPECT_EQ(getHeightfield(), heightfield);
+
+        const float scaleFactor = AZStd::numeric_limits<int16_t>::max() / 3.0f;
+        const AZStd::vector<Physics::HeightMaterialPoint> samples = GetSamples();
+        {
+            PHYSX_SCENE_READ_LOCK(pxRigidStatic->getScene());
+            EXPECT_EQ(heightfield->getSample(1, 1).height, azlossy_cast<physx::PxI16>(newHeight * scaleFactor));
+            EXPECT_EQ(heightfield->getSample(0, 0).height, azlossy_cast<physx::PxI16>(samples[0].m_height * scaleFactor));
+            EXPECT_EQ(heightfield->getSample(2, 2).height, azlossy_cast<physx::PxI16>(samples[8].m_height * scaleFactor));
+        }
+
+        CleanupHeightfieldComponent();
+    }
+
 } // namespace PhysXEditorTests
 
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+#include <AzTest/AzTest.h>
+#include <AzTest/Utils.h>
+#include <AzFramework/IO/LocalFileIO.h>
+#include <AzFramework/Physics/SystemBus.h>
+
+#include <System/PhysXCookedDataCache.h>
+#include <System/PhysXSystem.h>
+
+namespace PhysX
+{
+    class PhysXCookedDataCacheFixture
+        : public testing::Test
+    {
+    public:
+        //! Returns a cook function producing numBytes bytes of fake cooked data and counting its invocations.
+        CookedDataCache::CookFunction MakeCookFunction(size_t numBytes, bool succeed = true)
+        {
+            return [this, numBytes, succeed](AZStd::vector<AZ::u8>& cookedData)
+            {
+                m_numCooks++;
+                cookedData.assign(numBytes, static_cast<AZ::u8>(m_numCooks));
+                return succeed;
+            };
+        }
+
+        static CookedDataCache::GeometryHash MakeHash(AZ::u64 low, AZ::u64 high = 0)
+        {
+            CookedDataCache::GeometryHash hash;
+            hash.m_low = low;
+            hash.m_high = high;
+            return hash;
+        }
+
+        CookedDataCacheConfiguration MakeConfig(AZ::u32 maxMemoryMegabytes = 1)
+        {
+            CookedDataCacheConfiguration config;
+            config.m_enabled = true;
+            config.m_maxMemoryMegabytes = maxMemoryMegabytes;
+            config.m_diskCacheEnabled = false;
+            return config;
+        }
+
+        int m_numCooks = 0;
+    };
+
+    TEST_F(PhysXCookedDataCacheFixture, GetOrCook_SameGeometry_CooksOnce)
+    {
+        CookedDataCache cache;
+        cache.UpdateConfiguration(MakeConfig());
+
+        AZStd::vector<AZ::u8> first;
+        AZStd::vector<AZ::u8> second;
+        EXPECT_TRUE(cache.GetOrCook(CookedDataCache::DataType::ConvexMesh, MakeHash(1234), MakeCookFunction(64), first));
+        EXPECT_TRUE(cache.GetOrCook(CookedDataCache::DataType::ConvexMesh, MakeHash(1234), MakeCookFunction(64), second));
+
+        EXPECT_EQ(m_numCooks, 1);
+        EXPECT_EQ(first, second);
+
+        const CookedDataCache::Statistics stats = cache.GetStatistics();
+        EXPECT_EQ(stats.m_misses, 1);
+        EXPECT_EQ(stats.m_memoryHits, 1);
+        EXPECT_EQ(stats.m_numEntries, 1);
+        EXPECT_EQ(stats.m_memoryUsageBytes, 64);
+    }
+
+    TEST_F(PhysXCookedDataCacheFixture, GetOrCook_DifferentDataTypeOrCookingParams_CooksAgain)
+    {
+        CookedDataCache cache(1);
+        cache.UpdateConfiguration(MakeConfig());
+        CookedDataCache otherParamsCache(2);
+        otherParamsCache.UpdateConfiguration(MakeConfig());
+
+        AZStd::vector<AZ::u8> cookedData;
+        EXPECT_TRUE(cache.GetOrCook(CookedDataCache::DataType::ConvexMesh, MakeHash(1234), MakeCookFunction(64), cookedData));
+        EXPECT_TRUE(cache.GetOrCook(CookedDataCache::DataType::TriangleMesh, MakeHash(1234), MakeCookFunction(64), cookedData));
+        EXPECT_TRUE(otherParamsCache.GetOrCook(CookedDataCache::DataType::ConvexMesh, MakeHash(1234), MakeCookFunction(64), cookedData));
+
+        EXPECT_EQ(m_numCooks, 3);
+    }
+
+    TEST_F(PhysXCookedDataCacheFixture, GetOrCook_CookingFails_ResultIsNotCached)
+    {
+        CookedDataCache cache;
+        cache.UpdateConfiguration(MakeConfig());
+
+        AZStd::vector<AZ::u8> cookedData;
+        EXPECT_FALSE(cache.GetOrCook(CookedDataCache::DataType::ConvexMesh, MakeHash(1234), MakeCookFunction(64, false), cookedData));
+        EXPECT_TRUE(cache.GetOrCook(CookedDataCache::DataType::ConvexMesh, MakeHash(1234), MakeCookFunction(64), cookedData));
+
+        EXPECT_EQ(m_numCooks, 2);
+        EXPECT_EQ(cache.GetStatistics().m_cookFailures, 1);
+    }
+
+    TEST_F(PhysXCookedDataCacheFixture, GetOrCook_OverMemoryBudget_EvictsLeastRecentlyUsed)
+    {
+        CookedDataCache cache;
+        cache.UpdateConfiguration(MakeConfig(1));
+
+        // Each entry uses 40% of the 1MB budget, so only two fit.
+        const size_t entrySize = 1024 * 1024 * 4 / 10;
+        AZStd::vector<AZ::u8> cookedData;
+        cache.GetOrCook(CookedDataCache::DataType::ConvexMesh, MakeHash(1), MakeCookFunction(entrySize), cookedData);
+        cache.GetOrCook(CookedDataCache::DataType::ConvexMesh, MakeHash(2), MakeCookFunction(entrySize), cookedData);
+        cache.GetOrCook(CookedDataCache::DataType::ConvexMesh, MakeHash(1), MakeCookFunction(entrySize), cookedData); // refresh 1
+        cache.GetOrCook(CookedDataCache::DataType::ConvexMesh, MakeHash(3), MakeCookFunction(entrySize), cookedData); // evicts 2
+        EXPECT_EQ(m_numCooks, 3);
+        EXPECT_EQ(cache.GetStatistics().m_numEntries, 2);
+
+        cache.GetOrCook(CookedDataCache::DataType::ConvexMesh, MakeHash(1), MakeCookFunction(entrySize), cookedData);
+        EXPECT_EQ(m_numCooks, 3);
+        cache.GetOrCook(CookedDataCache::DataType::ConvexMesh, MakeHash(2), MakeCookFunction(entrySize), cookedData);
+        EXPECT_EQ(m_numCooks, 4);
+    }
+
+    TEST_F(PhysXCookedDataCacheFixture, GetOrCook_CacheDisabled_AlwaysCooks)
+    {
+        CookedDataCache cache;
+        CookedDataCacheConfiguration config = MakeConfig();
+        config.m_enabled = false;
+        cache.UpdateConfiguration(config);
+
+        AZStd::vector<AZ::u8> cookedData;
+        EXPECT_TRUE(cache.GetOrCook(CookedDataCache::DataType::HeightField, MakeHash(1234), MakeCookFunction(64), cookedData));
+        EXPECT_TRUE(cache.GetOrCook(CookedDataCache::DataType::HeightField, MakeHash(1234), MakeCookFunction(64), cookedData));
+
+        EXPECT_EQ(m_numCooks, 2);
+        EXPECT_EQ(cache.GetStatistics().m_numEntries, 0);
+    }
+
+    TEST_F(PhysXCookedDataCacheFixture, GetOrCook_DifferentHighGeometryHash_CooksAgain)
+    {
+        CookedDataCache cache;
+        cache.UpdateConfiguration(MakeConfig());
+
+        AZStd::vector<AZ::u8> first;
+        AZStd::vector<AZ::u8> second;
+        EXPECT_TRUE(cache.GetOrCook(CookedDataCache::DataType::ConvexMesh, MakeHash(1234, 1), MakeCookFunction(64), first));
+        EXPECT_TRUE(cache.GetOrCook(CookedDataCache::DataType::ConvexMesh, MakeHash(1234, 2), MakeCookFunction(64), second));
+
+        EXPECT_EQ(m_numCooks, 2);
+        EXPECT_NE(first, second);
+    }
+
+    TEST_F(PhysXCookedDataCacheFixture, GetOrCook_DiskCacheFileNameCollision_CooksAgain)
+    {
+        AZStd::unique_ptr<AZ::IO::FileIOBase> fileIO;
+        AZ::IO::FileIOBase* previousFileIO = AZ::IO::FileIOBase::GetInstance();
+        if (previousFileIO == nullptr)
+        {
+            fileIO = AZStd::make_unique<AZ::IO::LocalFileIO>();
+            AZ::IO::FileIOBase::SetInstance(fileIO.get());
+        }
+
+        {
+            AZ::Test::ScopedAutoTempDirectory tempDirectory;
+            CookedDataCacheConfiguration config = MakeConfig();
+            config.m_diskCacheEnabled = true;
+            config.m_diskCachePath = tempDirectory.GetDirectory();
+
+            // Same low half means the same file name on disk, the header must tell the two apart.
+            AZStd::vector<AZ::u8> first;
+            AZStd::vector<AZ::u8> second;
+            AZStd::vector<AZ::u8> secondAgain;
+            {
+                CookedDataCache cache;
+                cache.UpdateConfiguration(config);
+                EXPECT_TRUE(cache.GetOrCook(CookedDataCache::DataType::TriangleMesh, MakeHash(1234, 1), MakeCookFunction(64), first));
+            }
+            {
+                CookedDataCache cache;
+                cache.UpdateConfiguration(config);
+                EXPECT_TRUE(cache.GetOrCook(CookedDataCache::DataType::TriangleMesh, MakeHash(1234, 2), MakeCookFunction(64), second));
+                EXPECT_EQ(cache.GetStatistics().m_diskHits, 0);
+            }
+            {
+                CookedDataCache cache;
+                cache.UpdateConfiguration(config);
+                EXPECT_TRUE(cache.GetOrCook(CookedDataCache::DataType::TriangleMesh, MakeHash(1234, 2), MakeCookFunction(64), secondAgain));
+                EXPECT_EQ(cache.GetStatistics().m_diskHits, 1);
+            }
+
+            EXPECT_EQ(m_numCooks, 2);
+            EXPECT_NE(first, second);
+            EXPECT_EQ(second, secondAgain);
+        }
+
+        if (fileIO)
+        {
+            AZ::IO::FileIOBase::SetInstance(nullptr);
+        }
+    }
+
+    TEST_F(PhysXCookedDataCacheFixture, CookConvexMeshToMemory_SameVertices_HitsCache)
+    {
+        PhysXSystem* physXSystem = GetPhysXSystem();
+        ASSERT_NE(physXSystem, nullptr);
+        CookedDataCache& cache = physXSystem->GetCookedDataCache();
+        cache.ResetStatistics();
+
+        const AZStd::vector<AZ::Vector3> vertices = {
+            AZ::Vector3(0.0f, 0.0f, 0.0f), AZ::Vector3(1.0f, 0.0f, 0.0f), AZ::Vector3(0.0f, 1.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 1.0f), AZ::Vector3(1.0f, 1.0f, 1.0f)
+        };
+
+        AZStd::vector<AZ::u8> first;
+        AZStd::vector<AZ::u8> second;
+        bool cooked = false;
+        Physics::SystemRequestBus::BroadcastResult(cooked, &Physics::SystemRequests::CookConvexMeshToMemory,
+            vertices.data(), aznumeric_cast<AZ::u32>(vertices.size()), first);
+        EXPECT_TRUE(cooked);
+        Physics::SystemRequestBus::BroadcastResult(cooked, &Physics::SystemRequests::CookConvexMeshToMemory,
+            vertices.data(), aznumeric_cast<AZ::u32>(vertices.size()), second);
+        EXPECT_TRUE(cooked);
+
+        EXPECT_EQ(first, second);
+        const CookedDataCache::Statistics stats = cache.GetStatistics();
+        EXPECT_GE(stats.m_memoryHits, 1);
+    }
+} // namespace PhysX
@@ -7,6 +7,8 @@
  */
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
+#include <AzCore/Jobs/JobContext.h>
+#include <AzCore/Math/MathUtils.h>
 
 #include <AzTest/AzTest.h>
 #include <Tests/PhysXTestCommon.h>
@@ -1009,4 +1011,176 @@ namespace PhysX
             }
         }
     }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneBatch_LargeBatch_ReturnsExpectedHitsInRequestOrder)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        //setup bodies, enough requests are made for the batch to be split across jobs
+        constexpr AZ::u32 numBodies = 128;
+        AZStd::vector<AZ::Vector3> positions;
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        for (AZ::u32 i = 0; i < numBodies; ++i)
+        {
+            const float angle = AZ::Constants::TwoPi * aznumeric_cast<float>(i) / aznumeric_cast<float>(numBodies);
+            positions.emplace_back(AZ::Vector3(cosf(angle), sinf(angle), 0.0f) * 50.0f);
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, positions.back(), 0.5f));
+        }
+
+        //create the raycast requests
+        AzPhysics::SceneQueryRequests requests;
+        for (const AZ::Vector3& targetPos : positions)
+        {
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = targetPos.GetNormalized();
+            request->m_distance = 200.0f;
+
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        //run query
+        AzPhysics::SceneQueryHitsList results = sceneInterface->QuerySceneBatch(m_testSceneHandle, requests);
+
+        //verify each result from each request has the expected targeted simulated body
+        ASSERT_EQ(results.size(), requests.size());
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            ASSERT_EQ(results[i].m_hits.size(), 1);
+            EXPECT_TRUE(results[i].m_hits[0].m_bodyHandle == simBodies[i]);
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_CallbackDispatchedOnSceneUpdate)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AzPhysics::SimulatedBodyHandle sphereHandle =
+            TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3::CreateZero();
+        request.m_direction = AZ::Vector3::CreateAxisX(1.0f);
+        request.m_distance = 200.0f;
+
+        const AzPhysics::SceneQuery::AsyncRequestId requestId = 42;
+        int callbackCount = 0;
+        AzPhysics::SceneQueryHits asyncResults;
+        const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, requestId, &request,
+            [&callbackCount, &asyncResults, requestId](AzPhysics::SceneQuery::AsyncRequestId id, AzPhysics::SceneQueryHits hits)
+            {
+                EXPECT_EQ(id, requestId);
+                asyncResults = AZStd::move(hits);
+                callbackCount++;
+            });
+        EXPECT_TRUE(queued);
+
+        //the callback is only dispatched at the end of the next simulation step
+        EXPECT_EQ(callbackCount, 0);
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+
+        EXPECT_EQ(callbackCount, 1);
+        ASSERT_EQ(asyncResults.m_hits.size(), 1);
+        EXPECT_TRUE(asyncResults.m_hits[0].m_bodyHandle == sphereHandle);
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsyncBatch_CallbackDispatchedOnSceneUpdate)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AZStd::vector<AZ::Vector3> positions = {
+            AZ::Vector3(10.0f, 0.0f, 0.0f),
+            AZ::Vector3(0.0f, 10.0f, 0.0f),
+            AZ::Vector3(0.0f, 0.0f, 10.0f)
+        };
+
+        AZStd::vector<AzPhysics::SimulatedBodyHandle> simBodies;
+        AzPhysics::SceneQueryRequests requests;
+        for (const AZ::Vector3& pos : positions)
+        {
+            simBodies.emplace_back(TestUtils::AddSphereToScene(m_testSceneHandle, pos, 1.0f));
+
+            AZStd::shared_ptr<AzPhysics::RayCastRequest> request = AZStd::make_shared<AzPhysics::RayCastRequest>();
+            request->m_start = AZ::Vector3::CreateZero();
+            request->m_direction = pos.GetNormalized();
+            request->m_distance = 200.0f;
+            requests.emplace_back(AZStd::move(request));
+        }
+
+        int callbackCount = 0;
+        AzPhysics::SceneQueryHitsList asyncResults;
+        const bool queued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, 1, requests,
+            [&callbackCount, &asyncResults](AzPhysics::SceneQuery::AsyncRequestId, AzPhysics::SceneQueryHitsList hits)
+            {
+                asyncResults = AZStd::move(hits);
+                callbackCount++;
+            });
+        EXPECT_TRUE(queued);
+
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+
+        EXPECT_EQ(callbackCount, 1);
+        ASSERT_EQ(asyncResults.size(), requests.size());
+        for (size_t i = 0; i < asyncResults.size(); i++)
+        {
+            ASSERT_EQ(asyncResults[i].m_hits.size(), 1);
+            EXPECT_TRUE(asyncResults[i].m_hits[0].m_bodyHandle == simBodies[i]);
+        }
+    }
+
+    TEST_F(PhysXSceneQueryFixture, QuerySceneAsync_NoJobContext_CallbackDispatchedOnSceneUpdate)
+    {
+        auto* sceneInterface = AZ::Interface<AzPhysics::SceneInterface>::Get();
+
+        const AzPhysics::SimulatedBodyHandle sphereHandle =
+            TestUtils::AddSphereToScene(m_testSceneHandle, AZ::Vector3(10.0f, 0.0f, 0.0f), 1.0f);
+
+        AzPhysics::RayCastRequest request;
+        request.m_start = AZ::Vector3::CreateZero();
+        request.m_direction = AZ::Vector3::CreateAxisX(1.0f);
+        request.m_distance = 200.0f;
+
+        AzPhysics::SceneQueryRequests requests;
+        requests.emplace_back(AZStd::make_shared<AzPhysics::RayCastRequest>(request));
+
+        //tools and some tests run without a JobManager, the queries run inline then.
+        AZ::JobContext* jobContext = AZ::JobContext::GetGlobalContext();
+        AZ::JobContext::SetGlobalContext(nullptr);
+
+        int callbackCount = 0;
+        AzPhysics::SceneQueryHits asyncResults;
+        const bool queued = sceneInterface->QuerySceneAsync(m_testSceneHandle, 1, &request,
+            [&callbackCount, &asyncResults](AzPhysics::SceneQuery::AsyncRequestId, AzPhysics::SceneQueryHits hits)
+            {
+                asyncResults = AZStd::move(hits);
+                callbackCount++;
+            });
+        int batchCallbackCount = 0;
+        AzPhysics::SceneQueryHitsList asyncBatchResults;
+        const bool batchQueued = sceneInterface->QuerySceneAsyncBatch(m_testSceneHandle, 2, requests,
+            [&batchCallbackCount, &asyncBatchResults](AzPhysics::SceneQuery::AsyncRequestId, AzPhysics::SceneQueryHitsList hits)
+            {
+                asyncBatchResults = AZStd::move(hits);
+                batchCallbackCount++;
+            });
+
+        AZ::JobContext::SetGlobalContext(jobContext);
+
+        EXPECT_TRUE(queued);
+        EXPECT_TRUE(batchQueued);
+
+        //the callbacks are still only dispatched at the end of the next simulation step
+        EXPECT_EQ(callbackCount, 0);
+        EXPECT_EQ(batchCallbackCount, 0);
+        TestUtils::UpdateScene(m_testSceneHandle, AzPhysics::SystemConfiguration::DefaultFixedTimestep, 1);
+
+        EXPECT_EQ(callbackCount, 1);
+        ASSERT_EQ(asyncResults.m_hits.size(), 1);
+        EXPECT_TRUE(asyncResults.m_hits[0].m_bodyHandle == sphereHandle);
+
+        EXPECT_EQ(batchCallbackCount, 1);
+        ASSERT_EQ(asyncBatchResults.size(), 1);
+        ASSERT_EQ(asyncBatchResults[0].m_hits.size(), 1);
+        EXPECT_TRUE(asyncBatchResults[0].m_hits[0].m_bodyHandle == sphereHandle);
+    }
 }
@@ -124,6 +124,8 @@ set(FILES
     Source/Scene/PhysXSceneSimulationFilterCallback.cpp
     Source/System/PhysXAllocator.h
     Source/System/PhysXAllocator.cpp
+    Source/System/PhysXCookedDataCache.h
+    Source/System/PhysXCookedDataCache.cpp
     Source/System/PhysXCookingParams.h
     Source/System/PhysXCookingParams.cpp
     Source/System/PhysXCpuDispatcher.cpp
@@ -25,6 +25,7 @@ set(FILES
     Tests/PhysXSceneTests.cpp
     Tests/PhysXSceneQueryTests.cpp
     Tests/PhysXSystemTests.cpp
+    Tests/PhysXCookedDataCacheTests.cpp
     Tests/PhysXTestFixtures.h
     Tests/PhysXTestFixtures.cpp
     Tests/PhysXTestUtil.h
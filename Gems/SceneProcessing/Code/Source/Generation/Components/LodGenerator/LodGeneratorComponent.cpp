@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <Generation/Components/LodGenerator/LodGeneratorComponent.h>
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/Debug/Trace.h>
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/string/string.h>
+
+#include <SceneAPI/SceneCore/Containers/Scene.h>
+#include <SceneAPI/SceneCore/Containers/Utilities/Filters.h>
+#include <SceneAPI/SceneCore/DataTypes/GraphData/IBlendShapeData.h>
+#include <SceneAPI/SceneCore/DataTypes/GraphData/IMeshData.h>
+#include <SceneAPI/SceneCore/DataTypes/GraphData/IMeshVertexBitangentData.h>
+#include <SceneAPI/SceneCore/DataTypes/GraphData/IMeshVertexColorData.h>
+#include <SceneAPI/SceneCore/DataTypes/GraphData/IMeshVertexTangentData.h>
+#include <SceneAPI/SceneCore/DataTypes/GraphData/IMeshVertexUVData.h>
+#include <SceneAPI/SceneCore/DataTypes/GraphData/ISkinWeightData.h>
+#include <SceneAPI/SceneCore/DataTypes/Groups/IMeshGroup.h>
+#include <SceneAPI/SceneCore/DataTypes/Rules/ILodRule.h>
+#include <SceneAPI/SceneCore/Events/GenerateEventContext.h>
+#include <SceneAPI/SceneCore/Utilities/Reporting.h>
+#include <SceneAPI/SceneCore/Utilities/SceneGraphSelector.h>
+#include <SceneAPI/SceneData/GraphData/MeshData.h>
+#include <SceneAPI/SceneData/GraphData/MeshVertexBitangentData.h>
+#include <SceneAPI/SceneData/GraphData/MeshVertexColorData.h>
+#include <SceneAPI/SceneData/GraphData/MeshVertexTangentData.h>
+#include <SceneAPI/SceneData/GraphData/MeshVertexUVData.h>
+#include <SceneAPI/SceneData/GraphData/SkinWeightData.h>
+#include <SceneAPI/SceneData/Rules/LodGenerationRule.h>
+
+#include <Generation/Components/LodGenerator/MeshSimplifier.h>
+#include <Generation/Components/MeshOptimizer/MeshOptimizerComponent.h>
+
+namespace AZ::SceneGenerationComponents
+{
+    using AZ::SceneAPI::Containers::SceneGraph;
+    using AZ::SceneAPI::DataTypes::IBlendShapeData;
+    using AZ::SceneAPI::DataTypes::IGraphObject;
+    using AZ::SceneAPI::DataTypes::ILodRule;
+    using AZ::SceneAPI::DataTypes::IMeshData;
+    using AZ::SceneAPI::DataTypes::IMeshGroup;
+    using AZ::SceneAPI::DataTypes::IMeshVertexBitangentData;
+    using AZ::SceneAPI::DataTypes::IMeshVertexColorData;
+    using AZ::SceneAPI::DataTypes::IMeshVertexTangentData;
+    using AZ::SceneAPI::DataTypes::IMeshVertexUVData;
+    using AZ::SceneAPI::DataTypes::ISkinWeightData;
+    using AZ::SceneAPI::Events::GenerateLODEventContext;
+    using AZ::SceneAPI::Events::ProcessingResult;
+    using AZ::SceneAPI::SceneCore::GenerationComponent;
+    using AZ::SceneAPI::SceneData::LodGenerationLevel;
+    using AZ::SceneAPI::SceneData::LodGenerationRule;
+    using AZ::SceneAPI::Utilities::SceneGraphSelector;
+    using AZ::SceneData::GraphData::MeshData;
+    using AZ::SceneData::GraphData::MeshVertexBitangentData;
+    using AZ::SceneData::GraphData::MeshVertexColorData;
+    using AZ::SceneData::GraphData::MeshVertexTangentData;
+    using AZ::SceneData::GraphData::MeshVertexUVData;
+    using AZ::SceneData::GraphData::SkinWeightData;
+    using NodeIndex = AZ::SceneAPI::Containers::SceneGraph::NodeIndex;
+
+    LodGeneratorComponent::LodGeneratorComponent()
+    {
+        BindToCall(&LodGeneratorComponent::GenerateLods);
+    }
+
+    void LodGeneratorComponent::Reflect(AZ::ReflectContext* context)
+    {
+        auto* serializeContext = azrtti_cast<AZ::SerializeContext*>(context);
+        if (serializeContext)
+        {
+            serializeContext->Class<LodGeneratorComponent, GenerationComponent>()->Version(1);
+        }
+    }
+
+    ProcessingResult LodGeneratorComponent::GenerateLods(GenerateLODEventContext& context) const
+    {
+        SceneGraph& graph = context.GetScene().GetGraph();
+
+        // The levels are only generated from the meshes the user selected, not from the levels or the optimized meshes
+        // that are added to the graph next to them.
+        const auto isSourceMesh = [](const SceneGraph& graph, NodeIndex& index)
+        {
+            if (!SceneGraphSelector::IsMesh(graph, index))
+            {
+                return false;
+            }
+            const AZStd::string_view name{ graph.GetNodeName(index).GetName(), graph.GetNodeName(index).GetNameLength() };
+            AZStd::string_view sourceMeshName;
+            size_t lod = 0;
+            return !name.ends_with(SceneAPI::Utilities::OptimizedMeshSuffix) &&
+                !SceneGraphSelector::ParseGeneratedLodMeshName(name, sourceMeshName, lod);
+        };
+
+        const auto meshGroups = SceneAPI::Containers::MakeDerivedFilterView<IMeshGroup>(context.GetScene().GetManifest().GetValueStorage());
+        for (const IMeshGroup& meshGroup : meshGroups)
+        {
+            const LodGenerationRule* lodGenerationRule = meshGroup.GetRuleContainerConst().FindFirstByType<LodGenerationRule>().get();
+            if (!lodGenerationRule || lodGenerationRule->GetLodCount() == 0)
+            {
+                continue;
+            }
+
+            const ILodRule* lodRule = meshGroup.GetRuleContainerConst().FindFirstByType<ILodRule>().get();
+            if (lodRule && lodRule->GetLodCount() > 0)
+            {
+                AZ_TracePrintf(AZ::SceneAPI::Utilities::WarningWindow, "Mesh group '%s' has authored levels of detail, they are used instead of generated ones.",
+                    meshGroup.GetName().c_str());
+                continue;
+            }
+
+            const AZStd::vector<AZStd::string> meshPaths = SceneGraphSelector::GenerateTargetNodes(graph, meshGroup.GetSceneNodeSelectionList(), isSourceMesh);
+            for (const AZStd::string& meshPath : meshPaths)
+            {
+                const NodeIndex nodeIndex = graph.Find(meshPath);
+                const IMeshData* mesh = azrtti_cast<const IMeshData*>(graph.GetNodeContent(nodeIndex).get());
+                if (!mesh || mesh->GetFaceCount() == 0)
+                {
+                    continue;
+                }
+
+                if (graph.Find(SceneGraphSelector::GetGeneratedLodMeshName(meshPath, 1)).IsValid())
+                {
+                    AZ_TracePrintf(AZ::SceneAPI::Utilities::LogWindow, "Levels of detail of mesh '%s' already exist, there must be multiple mesh groups that have selected this mesh. Skipping the additional ones.", meshPath.c_str());
+                    continue;
+                }
+
+                // The levels would need simplified blend shapes that move the same vertices
+                if (MeshOptimizerComponent::HasAnyBlendShapeChild(graph, nodeIndex))
+                {
+                    AZ_TracePrintf(AZ::SceneAPI::Utilities::WarningWindow, "Mesh '%s' has blend shapes, levels of detail are not generated for it.", meshPath.c_str());
+                    continue;
+                }
+
+                GenerateMeshLods(graph, nodeIndex, *mesh, *lodGenerationRule);
+            }
+        }
+
+        return ProcessingResult::Success;
+    }
+
+    // Copy the data of the vertices that remain in a level of detail from the node of the source mesh
+    template<class DataType, class GetFunction, class AppendFunction>
+    static AZStd::shared_ptr<DataType> RemapVertexData(
+        const IGraphObject* source, const AZStd::vector<AZ::u32>& sourceVertices, GetFunction getValue, AppendFunction appendValue)
+    {
+        auto data = AZStd::make_shared<DataType>();
+        data->CloneAttributesFrom(source);
+        data->ReserveContainerSpace(sourceVertices.size());
+        for (const AZ::u32 sourceVertex : sourceVertices)
+        {
+            appendValue(*data, getValue(sourceVertex));
+        }
+        return data;
+    }
+
+    void LodGeneratorComponent::GenerateMeshLods(SceneGraph& graph, const NodeIndex& nodeIndex, const IMeshData& mesh, const LodGenerationRule& lodGenerationRule)
+    {
+        const AZ::u32 vertexCount = mesh.GetVertexCount();
+        const AZ::u32 faceCount = mesh.GetFaceCount();
+
+        AZStd::vector<AZ::Vector3> positions(vertexCount);
+        AZStd::vector<AZ::Vector3> normals(mesh.HasNormalData() ? vertexCount : 0);
+        AZ::Aabb bounds = AZ::Aabb::CreateNull();
+        for (AZ::u32 vertex = 0; vertex < vertexCount; ++vertex)
+        {
+            positions[vertex] = mesh.GetPosition(vertex);
+            bounds.AddPoint(positions[vertex]);
+            if (!normals.empty())
+            {
+                normals[vertex] = mesh.GetNormal(vertex);
+            }
+        }
+
+        AZStd::vector<AZ::u32> indices;
+        AZStd::vector<AZ::u32> materialIds;
+        indices.reserve(faceCount * 3);
+        materialIds.reserve(faceCount);
+        for (AZ::u32 face = 0; face < faceCount; ++face)
+        {
+            const IMeshData::Face& faceInfo = mesh.GetFaceInfo(face);
+            indices.insert(indices.end(), AZStd::begin(faceInfo.vertexIndex), AZStd::end(faceInfo.vertexIndex));
+            materialIds.emplace_back(mesh.GetFaceMaterialId(face));
+        }
+
+        // The errors in the rule are relative to the size of the mesh
+        const float meshSize = bounds.IsValid() ? bounds.GetExtents().GetLength() : 0.0f;
+        AZStd::vector<LodGenerator::SimplificationTarget> targets;
+        for (size_t lod = 0; lod < lodGenerationRule.GetLodCount(); ++lod)
+        {
+            const LodGenerationLevel& level = lodGenerationRule.GetLod(lod);
+            targets.push_back({ static_cast<size_t>(level.m_triangleRatio * faceCount), level.m_maxError * meshSize });
+        }
+
+        const AZStd::vector<LodGenerator::SimplifiedMesh> simplifiedMeshes = LodGenerator::SimplifyMesh(indices, positions, normals, materialIds, targets);
+
+        const AZStd::string meshName{ graph.GetNodeName(nodeIndex).GetName(), graph.GetNodeName(nodeIndex).GetNameLength() };
+
+        AZStd::vector<NodeIndex> childNodeIndices;
+        for (NodeIndex childNodeIndex = graph.GetNodeChild(nodeIndex); childNodeIndex.IsValid(); childNodeIndex = graph.GetNodeSibling(childNodeIndex))
+        {
+            childNodeIndices.emplace_back(childNodeIndex);
+        }
+
+        size_t lod = 0;
+        size_t previousTriangleCount = faceCount;
+        for (const LodGenerator::SimplifiedMesh& simplifiedMesh : simplifiedMeshes)
+        {
+            const size_t triangleCount = simplifiedMesh.m_sourceTriangles.size();
+            if (triangleCount == previousTriangleCount || triangleCount == 0)
+            {
+                // The error target stopped the simplification before it removed any more triangles
+                continue;
+            }
+            previousTriangleCount = triangleCount;
+            ++lod;
+
+            // Only the vertices that are still referenced are kept, in the order of their first use
+            AZStd::vector<AZ::u32> vertexRemap(vertexCount, AZStd::numeric_limits<AZ::u32>::max());
+            AZStd::vector<AZ::u32> sourceVertices;
+            AZStd::vector<AZ::u32> lodIndices(simplifiedMesh.m_indices.size());
+            for (size_t index = 0; index < simplifiedMesh.m_indices.size(); ++index)
+            {
+                const AZ::u32 sourceVertex = simplifiedMesh.m_indices[index];
+                if (vertexRemap[sourceVertex] == AZStd::numeric_limits<AZ::u32>::max())
+                {
+                    vertexRemap[sourceVertex] = aznumeric_cast<AZ::u32>(sourceVertices.size());
+                    sourceVertices.emplace_back(sourceVertex);
+                }
+                lodIndices[index] = vertexRemap[sourceVertex];
+            }
+
+            auto lodMesh = AZStd::make_shared<MeshData>();
+            lodMesh->CloneAttributesFrom(&mesh);
+            for (const AZ::u32 sourceVertex : sourceVertices)
+            {
+                lodMesh->AddPosition(positions[sourceVertex]);
+                if (!normals.empty())
+                {
+                    lodMesh->AddNormal(normals[sourceVertex]);
+                }
+                lodMesh->SetVertexIndexToControlPointIndexMap(
+                    aznumeric_caster(lodMesh->GetVertexCount() - 1), mesh.GetControlPointIndex(aznumeric_caster(sourceVertex)));
+            }
+            for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+            {
+                lodMesh->AddFace(lodIndices[triangle * 3 + 0], lodIndices[triangle * 3 + 1], lodIndices[triangle * 3 + 2],
+                    materialIds[simplifiedMesh.m_sourceTriangles[triangle]]);
+            }
+
+            const AZStd::string lodName = SceneGraphSelector::GetGeneratedLodMeshName(meshName, lod);
+            const NodeIndex lodNodeIndex = graph.AddChild(graph.GetNodeParent(nodeIndex), lodName.c_str(), AZStd::move(lodMesh));
+
+            for (const NodeIndex& childNodeIndex : childNodeIndices)
+            {
+                const AZStd::shared_ptr<IGraphObject> childNode = graph.GetNodeContent(childNodeIndex);
+                const IGraphObject* child = childNode.get();
+
+                AZStd::shared_ptr<IGraphObject> lodChildNode;
+                if (const auto* uvData = azrtti_cast<const IMeshVertexUVData*>(child))
+                {
+                    lodChildNode = RemapVertexData<MeshVertexUVData>(child, sourceVertices,
+                        [uvData](AZ::u32 vertex) { return uvData->GetUV(vertex); },
+                        [](MeshVertexUVData& data, const AZ::Vector2& uv) { data.AppendUV(uv); });
+                }
+                else if (const auto* tangentData = azrtti_cast<const IMeshVertexTangentData*>(child))
+                {
+                    lodChildNode = RemapVertexData<MeshVertexTangentData>(child, sourceVertices,
+                        [tangentData](AZ::u32 vertex) { return tangentData->GetTangent(vertex); },
+                        [](MeshVertexTangentData& data, const AZ::Vector4& tangent) { data.AppendTangent(tangent); });
+                }
+                else if (const auto* bitangentData = azrtti_cast<const IMeshVertexBitangentData*>(child))
+                {
+                    lodChildNode = RemapVertexData<MeshVertexBitangentData>(child, sourceVertices,
+                        [bitangentData](AZ::u32 vertex) { return bitangentData->GetBitangent(vertex); },
+                        [](MeshVertexBitangentData& data, const AZ::Vector3& bitangent) { data.AppendBitangent(bitangent); });
+                }
+                else if (const auto* colorData = azrtti_cast<const IMeshVertexColorData*>(child))
+                {
+                    lodChildNode = RemapVertexData<MeshVertexColorData>(child, sourceVertices,
+                        [colorData](AZ::u32 vertex) { return colorData->GetColor(vertex); },
+                        [](MeshVertexColorData& data, const AZ::SceneAPI::DataTypes::Color& color) { data.AppendColor(color); });
+                }
+                else if (const auto* skinWeightData = azrtti_cast<const ISkinWeightData*>(child))
+                {
+                    auto lodSkinWeightData = AZStd::make_shared<SkinWeightData>();
+                    lodSkinWeightData->ResizeContainerSpace(sourceVertices.size());
+                    for (size_t vertex = 0; vertex < sourceVertices.size(); ++vertex)
+                    {
+                        if (sourceVertices[vertex] >= skinWeightData->GetVertexCount())
+                        {
+                            continue;
+                        }
+                        for (size_t link = 0; link < skinWeightData->GetLinkCount(sourceVertices[vertex]); ++link)
+                        {
+                            const ISkinWeightData::Link& sourceLink = skinWeightData->GetLink(sourceVertices[vertex], link);
+                            const int boneId = lodSkinWeightData->GetBoneId(skinWeightData->GetBoneName(sourceLink.boneId));
+                            lodSkinWeightData->AppendLink(vertex, { boneId, sourceLink.weight });
+                        }
+                    }
+                    lodChildNode = AZStd::move(lodSkinWeightData);
+                }
+                else if (azrtti_istypeof<IMeshData>(child) || azrtti_istypeof<IBlendShapeData>(child))
+                {
+                    continue;
+                }
+                else
+                {
+                    // Data that does not depend on the vertices, such as materials, is shared with the source mesh
+                    lodChildNode = childNode;
+                }
+
+                const AZStd::string childName{ graph.GetNodeName(childNodeIndex).GetName(), graph.GetNodeName(childNodeIndex).GetNameLength() };
+                const NodeIndex lodChildNodeIndex = graph.AddChild(lodNodeIndex, childName.c_str(), AZStd::move(lodChildNode));
+                if (graph.IsNodeEndPoint(childNodeIndex))
+                {
+                    graph.MakeEndPoint(lodChildNodeIndex);
+                }
+            }
+
+            AZ_TracePrintf(AZ::SceneAPI::Utilities::LogWindow, "Generated level of detail %zu of mesh '%s': %zu of %u triangles, %zu of %u vertices, error %0.5f",
+                lod, meshName.c_str(), triangleCount, faceCount, sourceVertices.size(), vertexCount, simplifiedMesh.m_error);
+        }
+    }
+} // namespace AZ::SceneGenerationComponents
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Component/Component.h>
+#include <AzCore/RTTI/RTTI.h>
+#include <SceneAPI/SceneCore/Components/GenerationComponent.h>
+#include <SceneAPI/SceneCore/Containers/SceneGraph.h>
+#include <SceneAPI/SceneCore/Events/ProcessingResult.h>
+
+namespace AZ { class ReflectContext; }
+namespace AZ::SceneAPI::DataTypes { class IMeshData; }
+namespace AZ::SceneAPI::Events { class GenerateLODEventContext; }
+namespace AZ::SceneAPI::SceneData { class LodGenerationRule; }
+
+namespace AZ::SceneGenerationComponents
+{
+    // Generates the levels of detail of the meshes in mesh groups that have a LodGenerationRule and no authored levels
+    // of detail. Each level is added as a sibling of the source mesh, so it goes through tangent generation and mesh
+    // optimization like the source mesh does.
+    class LodGeneratorComponent
+        : public AZ::SceneAPI::SceneCore::GenerationComponent
+    {
+    public:
+        AZ_COMPONENT(LodGeneratorComponent, "{42D91F4A-F659-4D7B-81CF-2BFB44082485}", AZ::SceneAPI::SceneCore::GenerationComponent)
+
+        LodGeneratorComponent();
+
+        static void Reflect(AZ::ReflectContext* context);
+
+        AZ::SceneAPI::Events::ProcessingResult GenerateLods(AZ::SceneAPI::Events::GenerateLODEventContext& context) const;
+
+    private:
+        static void GenerateMeshLods(
+            AZ::SceneAPI::Containers::SceneGraph& graph,
+            const AZ::SceneAPI::Containers::SceneGraph::NodeIndex& nodeIndex,
+            const AZ::SceneAPI::DataTypes::IMeshData& mesh,
+            const AZ::SceneAPI::SceneData::LodGenerationRule& lodGenerationRule);
+    };
+} // namespace AZ::SceneGenerationComponents
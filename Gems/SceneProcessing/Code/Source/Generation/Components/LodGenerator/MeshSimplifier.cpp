@@ -0,0 +1,614 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/queue.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/sort.h>
+#include <Generation/Components/LodGenerator/MeshSimplifier.h>
+
+namespace AZ::LodGenerator
+{
+    namespace SimplifierInternal
+    {
+        static constexpr AZ::u32 s_invalidIndex = AZStd::numeric_limits<AZ::u32>::max();
+        // smallest cosine of the angle a triangle is allowed to rotate by in a collapse, which rejects folds and flips
+        static constexpr float s_minTriangleNormalDot = 0.2f;
+        // smallest cosine of the angle between the normals of a vertex and the vertex it collapses into
+        static constexpr float s_minVertexNormalDot = 0.5f;
+        // weight of the planes that keep the borders of open meshes in place, relative to the planes of the triangles
+        static constexpr float s_borderWeight = 10.0f;
+
+        enum class VertexKind : AZ::u8
+        {
+            Manifold, // can collapse into any neighbor
+            Border, // can only collapse along the border of the mesh
+            Locked // never collapses
+        };
+
+        // sum of the squared distances to a set of weighted planes
+        struct Quadric
+        {
+            float m_a00 = 0.0f, m_a11 = 0.0f, m_a22 = 0.0f, m_a01 = 0.0f, m_a02 = 0.0f, m_a12 = 0.0f;
+            float m_b0 = 0.0f, m_b1 = 0.0f, m_b2 = 0.0f;
+            float m_c = 0.0f;
+            float m_weight = 0.0f;
+
+            static Quadric CreateFromPlane(const AZ::Vector3& normal, float distance, float weight)
+            {
+                const float x = normal.GetX();
+                const float y = normal.GetY();
+                const float z = normal.GetZ();
+
+                Quadric quadric;
+                quadric.m_a00 = weight * x * x;
+                quadric.m_a11 = weight * y * y;
+                quadric.m_a22 = weight * z * z;
+                quadric.m_a01 = weight * x * y;
+                quadric.m_a02 = weight * x * z;
+                quadric.m_a12 = weight * y * z;
+                quadric.m_b0 = weight * x * distance;
+                quadric.m_b1 = weight * y * distance;
+                quadric.m_b2 = weight * z * distance;
+                quadric.m_c = weight * distance * distance;
+                quadric.m_weight = weight;
+                return quadric;
+            }
+
+            Quadric& operator+=(const Quadric& other)
+            {
+                m_a00 += other.m_a00;
+                m_a11 += other.m_a11;
+                m_a22 += other.m_a22;
+                m_a01 += other.m_a01;
+                m_a02 += other.m_a02;
+                m_a12 += other.m_a12;
+                m_b0 += other.m_b0;
+                m_b1 += other.m_b1;
+                m_b2 += other.m_b2;
+                m_c += other.m_c;
+                m_weight += other.m_weight;
+                return *this;
+            }
+
+            // weighted average of the squared distances of the position to the planes
+            float GetError(const AZ::Vector3& position) const
+            {
+                const float x = position.GetX();
+                const float y = position.GetY();
+                const float z = position.GetZ();
+
+                const float error =
+                    m_a00 * x * x + m_a11 * y * y + m_a22 * z * z +
+                    2.0f * (m_a01 * x * y + m_a02 * x * z + m_a12 * y * z) +
+                    2.0f * (m_b0 * x + m_b1 * y + m_b2 * z) +
+                    m_c;
+                return m_weight > 0.0f ? AZStd::max(error, 0.0f) / m_weight : 0.0f;
+            }
+        };
+
+        struct Collapse
+        {
+            float m_error;
+            AZ::u32 m_vertex;
+            AZ::u32 m_target;
+            AZ::u32 m_stamp;
+        };
+
+        struct CollapseGreater
+        {
+            bool operator()(const Collapse& lhs, const Collapse& rhs) const
+            {
+                return lhs.m_error > rhs.m_error;
+            }
+        };
+
+        class Simplifier
+        {
+        public:
+            Simplifier(
+                const AZStd::vector<AZ::u32>& indices,
+                const AZStd::vector<AZ::Vector3>& positions,
+                const AZStd::vector<AZ::Vector3>& normals,
+                const AZStd::vector<AZ::u32>& triangleGroups)
+                : m_indices(indices)
+                , m_positions(positions)
+                , m_normals(normals)
+                , m_triangleCount(indices.size() / 3)
+            {
+                GeneratePoints();
+                GenerateVertexTriangles();
+                ClassifyVertices(triangleGroups);
+                GenerateQuadrics();
+
+                m_isVertexCollapsed.resize(m_positions.size(), false);
+                m_isTriangleRemoved.resize(indices.size() / 3, false);
+                m_vertexStamps.resize(m_positions.size(), 0);
+                for (AZ::u32 vertex = 0; vertex < m_positions.size(); ++vertex)
+                {
+                    PushBestCollapse(vertex);
+                }
+            }
+
+            SimplifiedMesh Simplify(const SimplificationTarget& target)
+            {
+                const float maxError = target.m_maxError * target.m_maxError;
+                while (m_triangleCount > target.m_triangleCount && !m_collapses.empty())
+                {
+                    const Collapse collapse = m_collapses.top();
+                    if (m_isVertexCollapsed[collapse.m_vertex] || m_isVertexCollapsed[collapse.m_target] ||
+                        m_vertexStamps[collapse.m_vertex] != collapse.m_stamp)
+                    {
+                        m_collapses.pop();
+                        continue;
+                    }
+                    if (collapse.m_error > maxError)
+                    {
+                        // keep the collapse for the next level, which may allow a larger error
+                        break;
+                    }
+                    m_collapses.pop();
+
+                    if (!CanCollapse(collapse.m_vertex, collapse.m_target))
+                    {
+                        ++m_vertexStamps[collapse.m_vertex];
+                        PushBestCollapse(collapse.m_vertex);
+                        continue;
+                    }
+
+                    ApplyCollapse(collapse.m_vertex, collapse.m_target);
+                    m_maxError = AZStd::max(m_maxError, collapse.m_error);
+                }
+
+                SimplifiedMesh result;
+                result.m_indices.reserve(m_triangleCount * 3);
+                result.m_sourceTriangles.reserve(m_triangleCount);
+                for (AZ::u32 triangle = 0; triangle < m_isTriangleRemoved.size(); ++triangle)
+                {
+                    if (!m_isTriangleRemoved[triangle])
+                    {
+                        result.m_indices.insert(result.m_indices.end(), &m_indices[triangle * 3], &m_indices[triangle * 3] + 3);
+                        result.m_sourceTriangles.emplace_back(triangle);
+                    }
+                }
+                result.m_error = AZStd::sqrt(m_maxError);
+                return result;
+            }
+
+        private:
+            // vertices with the same position share a point, so the mesh is connected across the seams in its attributes
+            void GeneratePoints()
+            {
+                const AZ::u32 vertexCount = aznumeric_cast<AZ::u32>(m_positions.size());
+
+                AZStd::vector<AZ::u32> sortedVertices(vertexCount);
+                for (AZ::u32 vertex = 0; vertex < vertexCount; ++vertex)
+                {
+                    sortedVertices[vertex] = vertex;
+                }
+                const auto isLess = [this](AZ::u32 lhs, AZ::u32 rhs)
+                {
+                    const AZ::Vector3& lhsPosition = m_positions[lhs];
+                    const AZ::Vector3& rhsPosition = m_positions[rhs];
+                    if (lhsPosition.GetX() != rhsPosition.GetX())
+                    {
+                        return lhsPosition.GetX() < rhsPosition.GetX();
+                    }
+                    if (lhsPosition.GetY() != rhsPosition.GetY())
+                    {
+                        return lhsPosition.GetY() < rhsPosition.GetY();
+                    }
+                    return lhsPosition.GetZ() < rhsPosition.GetZ();
+                };
+                AZStd::sort(sortedVertices.begin(), sortedVertices.end(), isLess);
+
+                m_vertexPoints.resize(vertexCount);
+                m_pointVertexOffsets.clear();
+                for (AZ::u32 i = 0; i < vertexCount; ++i)
+                {
+                    if (i == 0 || isLess(sortedVertices[i - 1], sortedVertices[i]))
+                    {
+                        m_pointVertexOffsets.emplace_back(i);
+                    }
+                    m_vertexPoints[sortedVertices[i]] = aznumeric_cast<AZ::u32>(m_pointVertexOffsets.size() - 1);
+                }
+                m_pointVertexOffsets.emplace_back(vertexCount);
+                m_pointVertices = AZStd::move(sortedVertices);
+            }
+
+            void GenerateVertexTriangles()
+            {
+                m_vertexTriangles.resize(m_positions.size());
+                for (AZ::u32 triangle = 0; triangle < m_indices.size() / 3; ++triangle)
+                {
+                    for (AZ::u32 corner = 0; corner < 3; ++corner)
+                    {
+                        m_vertexTriangles[m_indices[triangle * 3 + corner]].emplace_back(triangle);
+                    }
+                }
+            }
+
+            static AZ::u64 GetEdgeKey(AZ::u32 fromPoint, AZ::u32 toPoint)
+            {
+                return (static_cast<AZ::u64>(fromPoint) << 32) | toPoint;
+            }
+
+            void ClassifyVertices(const AZStd::vector<AZ::u32>& triangleGroups)
+            {
+                const size_t pointCount = m_pointVertexOffsets.size() - 1;
+                const size_t triangleCount = m_indices.size() / 3;
+
+                AZStd::unordered_map<AZ::u64, AZ::u32> edgeCounts;
+                for (AZ::u32 triangle = 0; triangle < triangleCount; ++triangle)
+                {
+                    for (AZ::u32 corner = 0; corner < 3; ++corner)
+                    {
+                        const AZ::u32 fromPoint = m_vertexPoints[m_indices[triangle * 3 + corner]];
+                        const AZ::u32 toPoint = m_vertexPoints[m_indices[triangle * 3 + (corner + 1) % 3]];
+                        ++edgeCounts[GetEdgeKey(fromPoint, toPoint)];
+                    }
+                }
+
+                AZStd::vector<AZ::u32> outgoingBorderEdges(pointCount, 0);
+                AZStd::vector<AZ::u32> incomingBorderEdges(pointCount, 0);
+                AZStd::vector<bool> isPointLocked(pointCount, false);
+                AZStd::vector<AZ::u32> pointGroups(pointCount, s_invalidIndex);
+                for (AZ::u32 triangle = 0; triangle < triangleCount; ++triangle)
+                {
+                    const AZ::u32 group = triangleGroups.empty() ? 0 : triangleGroups[triangle];
+                    for (AZ::u32 corner = 0; corner < 3; ++corner)
+                    {
+                        const AZ::u32 fromPoint = m_vertexPoints[m_indices[triangle * 3 + corner]];
+                        const AZ::u32 toPoint = m_vertexPoints[m_indices[triangle * 3 + (corner + 1) % 3]];
+
+                        if (fromPoint == toPoint || edgeCounts[GetEdgeKey(fromPoint, toPoint)] > 1)
+                        {
+                            // degenerate triangles and edges shared by more than two triangles
+                            isPointLocked[fromPoint] = true;
+                            isPointLocked[toPoint] = true;
+                        }
+                        else if (edgeCounts.find(GetEdgeKey(toPoint, fromPoint)) == edgeCounts.end())
+                        {
+                            ++outgoingBorderEdges[fromPoint];
+                            ++incomingBorderEdges[toPoint];
+                        }
+
+                        if (pointGroups[fromPoint] == s_invalidIndex)
+                        {
+                            pointGroups[fromPoint] = group;
+                        }
+                        else if (pointGroups[fromPoint] != group)
+                        {
+                            isPointLocked[fromPoint] = true;
+                        }
+                    }
+                }
+
+                m_vertexKinds.resize(m_positions.size(), VertexKind::Locked);
+                for (AZ::u32 vertex = 0; vertex < m_positions.size(); ++vertex)
+                {
+                    const AZ::u32 point = m_vertexPoints[vertex];
+                    const AZ::u32 wedgeCount = m_pointVertexOffsets[point + 1] - m_pointVertexOffsets[point];
+                    if (isPointLocked[point] || wedgeCount > 1 || m_vertexTriangles[vertex].empty())
+                    {
+                        m_vertexKinds[vertex] = VertexKind::Locked;
+                    }
+                    else if (outgoingBorderEdges[point] == 0 && incomingBorderEdges[point] == 0)
+                    {
+                        m_vertexKinds[vertex] = VertexKind::Manifold;
+                    }
+                    else if (outgoingBorderEdges[point] == 1 && incomingBorderEdges[point] == 1)
+                    {
+                        m_vertexKinds[vertex] = VertexKind::Border;
+                    }
+                    else
+                    {
+                        m_vertexKinds[vertex] = VertexKind::Locked;
+                    }
+                }
+
+                m_edgeCounts = AZStd::move(edgeCounts);
+            }
+
+            void GenerateQuadrics()
+            {
+                m_pointQuadrics.resize(m_pointVertexOffsets.size() - 1);
+                for (AZ::u32 triangle = 0; triangle < m_indices.size() / 3; ++triangle)
+                {
+                    AZ::u32 points[3];
+                    AZ::Vector3 positions[3];
+                    for (AZ::u32 corner = 0; corner < 3; ++corner)
+                    {
+                        points[corner] = m_vertexPoints[m_indices[triangle * 3 + corner]];
+                        positions[corner] = m_positions[m_indices[triangle * 3 + corner]];
+                    }
+
+                    AZ::Vector3 normal = (positions[1] - positions[0]).Cross(positions[2] - positions[0]);
+                    const float area = normal.NormalizeWithLength() * 0.5f;
+                    if (area <= 0.0f)
+                    {
+                        continue;
+                    }
+
+                    const Quadric quadric = Quadric::CreateFromPlane(normal, -normal.Dot(positions[0]), area);
+                    for (AZ::u32 corner = 0; corner < 3; ++corner)
+                    {
+                        m_pointQuadrics[points[corner]] += quadric;
+                    }
+
+                    // the plane through each border edge that is perpendicular to the triangle keeps the border in place
+                    for (AZ::u32 corner = 0; corner < 3; ++corner)
+                    {
+                        const AZ::u32 next = (corner + 1) % 3;
+                        if (m_edgeCounts.find(GetEdgeKey(points[next], points[corner])) != m_edgeCounts.end())
+                        {
+                            continue;
+                        }
+
+                        AZ::Vector3 edge = positions[next] - positions[corner];
+                        const float edgeLength = edge.NormalizeWithLength();
+                        const AZ::Vector3 borderNormal = edge.Cross(normal);
+                        const Quadric borderQuadric = Quadric::CreateFromPlane(
+                            borderNormal, -borderNormal.Dot(positions[corner]), s_borderWeight * edgeLength * edgeLength);
+                        m_pointQuadrics[points[corner]] += borderQuadric;
+                        m_pointQuadrics[points[next]] += borderQuadric;
+                    }
+                }
+            }
+
+            bool TriangleHasPoint(AZ::u32 triangle, AZ::u32 point) const
+            {
+                return m_vertexPoints[m_indices[triangle * 3 + 0]] == point ||
+                    m_vertexPoints[m_indices[triangle * 3 + 1]] == point ||
+                    m_vertexPoints[m_indices[triangle * 3 + 2]] == point;
+            }
+
+            // add the points of the triangles of a point to the list
+            void GatherNeighborPoints(AZ::u32 point, AZStd::vector<AZ::u32>& neighbors) const
+            {
+                for (AZ::u32 i = m_pointVertexOffsets[point]; i < m_pointVertexOffsets[point + 1]; ++i)
+                {
+                    for (const AZ::u32 triangle : m_vertexTriangles[m_pointVertices[i]])
+                    {
+                        for (AZ::u32 corner = 0; corner < 3; ++corner)
+                        {
+                            const AZ::u32 neighbor = m_vertexPoints[m_indices[triangle * 3 + corner]];
+                            if (neighbor != point && AZStd::find(neighbors.begin(), neighbors.end(), neighbor) == neighbors.end())
+                            {
+                                neighbors.emplace_back(neighbor);
+                            }
+                        }
+                    }
+                }
+            }
+
+            bool CanCollapse(AZ::u32 vertex, AZ::u32 target) const
+            {
+                const AZ::u32 point = m_vertexPoints[vertex];
+                const AZ::u32 targetPoint = m_vertexPoints[target];
+                if (point == targetPoint)
+                {
+                    return false;
+                }
+
+                if (!m_normals.empty() && m_normals[vertex].Dot(m_normals[target]) < s_minVertexNormalDot)
+                {
+                    return false;
+                }
+
+                // the triangles on the edge are removed, and all of them have to reference the target vertex, since the
+                // other triangles of the vertex will reference the target in its place
+                AZ::u32 edgeTriangleCount = 0;
+                for (const AZ::u32 triangle : m_vertexTriangles[vertex])
+                {
+                    if (!TriangleHasPoint(triangle, targetPoint))
+                    {
+                        continue;
+                    }
+                    if (m_indices[triangle * 3 + 0] != target && m_indices[triangle * 3 + 1] != target && m_indices[triangle * 3 + 2] != target)
+                    {
+                        return false;
+                    }
+                    ++edgeTriangleCount;
+                }
+
+                const AZ::u32 expectedEdgeTriangleCount = m_vertexKinds[vertex] == VertexKind::Border ? 1 : 2;
+                if (edgeTriangleCount != expectedEdgeTriangleCount)
+                {
+                    return false;
+                }
+
+                // the vertices can only share the neighbors opposite to the edge, otherwise the collapse creates a fold
+                // or an edge that is shared by more than two triangles
+                AZStd::vector<AZ::u32> neighbors;
+                GatherNeighborPoints(point, neighbors);
+                AZStd::vector<AZ::u32> targetNeighbors;
+                GatherNeighborPoints(targetPoint, targetNeighbors);
+                const size_t sharedNeighborCount = AZStd::count_if(neighbors.begin(), neighbors.end(), [&targetNeighbors](AZ::u32 neighbor)
+                {
+                    return AZStd::find(targetNeighbors.begin(), targetNeighbors.end(), neighbor) != targetNeighbors.end();
+                });
+                if (sharedNeighborCount != edgeTriangleCount)
+                {
+                    return false;
+                }
+
+                // the remaining triangles must not flip or fold over
+                const AZ::Vector3& targetPosition = m_positions[target];
+                for (const AZ::u32 triangle : m_vertexTriangles[vertex])
+                {
+                    if (TriangleHasPoint(triangle, targetPoint))
+                    {
+                        continue;
+                    }
+
+                    AZ::Vector3 positions[3];
+                    AZ::Vector3 collapsedPositions[3];
+                    for (AZ::u32 corner = 0; corner < 3; ++corner)
+                    {
+                        const AZ::u32 cornerVertex = m_indices[triangle * 3 + corner];
+                        positions[corner] = m_positions[cornerVertex];
+                        collapsedPositions[corner] = cornerVertex == vertex ? targetPosition : positions[corner];
+                    }
+
+                    const AZ::Vector3 normal = (positions[1] - positions[0]).Cross(positions[2] - positions[0]);
+                    const AZ::Vector3 collapsedNormal = (collapsedPositions[1] - collapsedPositions[0]).Cross(collapsedPositions[2] - collapsedPositions[0]);
+                    const float lengths = AZStd::sqrt(normal.GetLengthSq() * collapsedNormal.GetLengthSq());
+                    if (lengths <= 0.0f || normal.Dot(collapsedNormal) < s_minTriangleNormalDot * lengths)
+                    {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
+            void PushBestCollapse(AZ::u32 vertex)
+            {
+                if (m_vertexKinds[vertex] == VertexKind::Locked || m_isVertexCollapsed[vertex])
+                {
+                    return;
+                }
+
+                const Quadric& quadric = m_pointQuadrics[m_vertexPoints[vertex]];
+
+                Collapse best{ AZStd::numeric_limits<float>::max(), vertex, s_invalidIndex, m_vertexStamps[vertex] };
+                for (const AZ::u32 triangle : m_vertexTriangles[vertex])
+                {
+                    for (AZ::u32 corner = 0; corner < 3; ++corner)
+                    {
+                        const AZ::u32 target = m_indices[triangle * 3 + corner];
+                        if (target == vertex || target == best.m_target)
+                        {
+                            continue;
+                        }
+
+                        const float error = quadric.GetError(m_positions[target]);
+                        if (error < best.m_error && CanCollapse(vertex, target))
+                        {
+                            best.m_error = error;
+                            best.m_target = target;
+                        }
+                    }
+                }
+
+                if (best.m_target != s_invalidIndex)
+                {
+                    m_collapses.push(best);
+                }
+            }
+
+            void RemoveVertexTriangle(AZ::u32 vertex, AZ::u32 triangle)
+            {
+                AZStd::vector<AZ::u32>& triangles = m_vertexTriangles[vertex];
+                const auto it = AZStd::find(triangles.begin(), triangles.end(), triangle);
+                if (it != triangles.end())
+                {
+                    *it = triangles.back();
+                    triangles.pop_back();
+                }
+            }
+
+            void ApplyCollapse(AZ::u32 vertex, AZ::u32 target)
+            {
+                const AZ::u32 targetPoint = m_vertexPoints[target];
+                m_pointQuadrics[targetPoint] += m_pointQuadrics[m_vertexPoints[vertex]];
+
+                for (const AZ::u32 triangle : m_vertexTriangles[vertex])
+                {
+                    if (TriangleHasPoint(triangle, targetPoint))
+                    {
+                        m_isTriangleRemoved[triangle] = true;
+                        --m_triangleCount;
+                        for (AZ::u32 corner = 0; corner < 3; ++corner)
+                        {
+                            const AZ::u32 cornerVertex = m_indices[triangle * 3 + corner];
+                            if (cornerVertex != vertex)
+                            {
+                                RemoveVertexTriangle(cornerVertex, triangle);
+                            }
+                        }
+                    }
+                    else
+                    {
+                        for (AZ::u32 corner = 0; corner < 3; ++corner)
+                        {
+                            if (m_indices[triangle * 3 + corner] == vertex)
+                            {
+                                m_indices[triangle * 3 + corner] = target;
+                            }
+                        }
+                        m_vertexTriangles[target].emplace_back(triangle);
+                    }
+                }
+                m_vertexTriangles[vertex].clear();
+                m_isVertexCollapsed[vertex] = true;
+
+                // the neighborhood of the target changed, so the collapses of the vertices around it have to be evaluated again
+                AZStd::vector<AZ::u32> neighbors;
+                GatherNeighborPoints(targetPoint, neighbors);
+                neighbors.emplace_back(targetPoint);
+                for (const AZ::u32 neighbor : neighbors)
+                {
+                    for (AZ::u32 i = m_pointVertexOffsets[neighbor]; i < m_pointVertexOffsets[neighbor + 1]; ++i)
+                    {
+                        const AZ::u32 neighborVertex = m_pointVertices[i];
+                        ++m_vertexStamps[neighborVertex];
+                        PushBestCollapse(neighborVertex);
+                    }
+                }
+            }
+
+            AZStd::vector<AZ::u32> m_indices;
+            const AZStd::vector<AZ::Vector3>& m_positions;
+            const AZStd::vector<AZ::Vector3>& m_normals;
+
+            AZStd::vector<AZ::u32> m_vertexPoints;
+            // the vertices of each point are the range [m_pointVertexOffsets[point], m_pointVertexOffsets[point + 1]) of m_pointVertices
+            AZStd::vector<AZ::u32> m_pointVertices;
+            AZStd::vector<AZ::u32> m_pointVertexOffsets;
+            AZStd::vector<AZStd::vector<AZ::u32>> m_vertexTriangles;
+            AZStd::vector<VertexKind> m_vertexKinds;
+            AZStd::unordered_map<AZ::u64, AZ::u32> m_edgeCounts;
+            AZStd::vector<Quadric> m_pointQuadrics;
+
+            AZStd::vector<bool> m_isVertexCollapsed;
+            AZStd::vector<bool> m_isTriangleRemoved;
+            // collapses in the queue are out of date when the stamp of their vertex changed
+            AZStd::vector<AZ::u32> m_vertexStamps;
+            AZStd::priority_queue<Collapse, AZStd::vector<Collapse>, CollapseGreater> m_collapses;
+
+            size_t m_triangleCount = 0;
+            float m_maxError = 0.0f;
+        };
+    } // namespace SimplifierInternal
+
+    AZStd::vector<SimplifiedMesh> SimplifyMesh(
+        const AZStd::vector<AZ::u32>& indices,
+        const AZStd::vector<AZ::Vector3>& positions,
+        const AZStd::vector<AZ::Vector3>& normals,
+        const AZStd::vector<AZ::u32>& triangleGroups,
+        const AZStd::vector<SimplificationTarget>& targets)
+    {
+        AZ_Assert(normals.empty() || normals.size() == positions.size(), "There must be a normal for each vertex, or none");
+        AZ_Assert(triangleGroups.empty() || triangleGroups.size() == indices.size() / 3, "There must be a group for each triangle, or none");
+
+        SimplifierInternal::Simplifier simplifier(indices, positions, normals, triangleGroups);
+
+        AZStd::vector<SimplifiedMesh> results;
+        results.reserve(targets.size());
+        for (const SimplificationTarget& target : targets)
+        {
+            results.emplace_back(simplifier.Simplify(target));
+        }
+        return results;
+    }
+} // namespace AZ::LodGenerator
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::LodGenerator
+{
+    struct SimplificationTarget
+    {
+        // simplification stops when the mesh has this many triangles or less
+        size_t m_triangleCount = 0;
+        // or when the next collapse would move the surface further than this distance
+        float m_maxError = 0.0f;
+    };
+
+    struct SimplifiedMesh
+    {
+        // triangle list that references the vertices of the source mesh
+        AZStd::vector<AZ::u32> m_indices;
+        // the source triangle of each triangle, to look up per face data such as material ids
+        AZStd::vector<AZ::u32> m_sourceTriangles;
+        // largest distance the surface moved
+        float m_error = 0.0f;
+    };
+
+    // simplify a triangle list with quadric error metric edge collapses, to each of the targets in turn
+    // Every level continues from the previous one, so the targets should have decreasing triangle counts and increasing errors.
+    // Vertices are collapsed into one of their neighbors and never moved, so all the attributes of the remaining vertices are
+    // kept as they are, such as normals, UVs and skin weights. Vertices that share a position with other vertices, which
+    // are the seams in the UVs or normals, and vertices between triangles of different groups, such as materials, are never
+    // collapsed. Vertices on the border of an open mesh only collapse along the border.
+    AZStd::vector<SimplifiedMesh> SimplifyMesh(
+        const AZStd::vector<AZ::u32>& indices,
+        const AZStd::vector<AZ::Vector3>& positions,
+        const AZStd::vector<AZ::Vector3>& normals,
+        const AZStd::vector<AZ::u32>& triangleGroups,
+        const AZStd::vector<SimplificationTarget>& targets);
+} // namespace AZ::LodGenerator
@@ -261,6 +261,36 @@ namespace AZ::MeshBuilder
         jobCompletion.StartAndWaitForCompletion();
     }
 
+    AZStd::pair<VertexCacheStatistics, VertexCacheStatistics> MeshBuilder::OptimizeSubMeshVertexCaches(const MeshBuilderVertexAttributeLayerVector3* positionLayer)
+    {
+        AZStd::vector<AZStd::pair<VertexCacheStatistics, VertexCacheStatistics>> subMeshStatistics(m_subMeshes.size());
+
+        AZ::JobCompletion jobCompletion;
+
+        for (size_t subMeshIndex = 0; subMeshIndex < m_subMeshes.size(); ++subMeshIndex)
+        {
+            AZ::JobContext* jobContext = nullptr;
+            AZ::Job* job = AZ::CreateJobFunction([this, subMeshIndex, positionLayer, &subMeshStatistics]()
+            {
+                AZ_PROFILE_SCOPE(Animation, "MeshBuilder::OptimizeSubMeshVertexCaches::SubMeshJob");
+                subMeshStatistics[subMeshIndex] = m_subMeshes[subMeshIndex]->OptimizeVertexCache(positionLayer);
+            }, true, jobContext);
+
+            job->SetDependent(&jobCompletion);
+            job->Start();
+        }
+
+        jobCompletion.StartAndWaitForCompletion();
+
+        AZStd::pair<VertexCacheStatistics, VertexCacheStatistics> statistics;
+        for (const auto& [before, after] : subMeshStatistics)
+        {
+            statistics.first += before;
+            statistics.second += after;
+        }
+        return statistics;
+    }
+
     void MeshBuilder::SetSkinningInfo(AZStd::unique_ptr<MeshBuilderSkinningInfo> skinningInfo)
     {
         m_skinningInfo = AZStd::move(skinningInfo);
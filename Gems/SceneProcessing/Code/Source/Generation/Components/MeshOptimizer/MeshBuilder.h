@@ -94,6 +94,10 @@ namespace AZ::MeshBuilder
 
         void GenerateSubMeshVertexOrders();
 
+        // optimize the triangle and vertex order of all submeshes, see MeshBuilderSubMesh::OptimizeVertexCache()
+        // Returns the vertex cache statistics of all submeshes combined, before and after the optimization.
+        AZStd::pair<VertexCacheStatistics, VertexCacheStatistics> OptimizeSubMeshVertexCaches(const MeshBuilderVertexAttributeLayerVector3* positionLayer);
+
         void AddSubMeshVertex(size_t orgVtx, SubMeshVertex&& vtx);
         size_t GetNumSubMeshVertices(size_t orgVtx) const;
         const SubMeshVertex& GetSubMeshVertex(size_t orgVtx, size_t index) const { return m_vertices[orgVtx][index]; }
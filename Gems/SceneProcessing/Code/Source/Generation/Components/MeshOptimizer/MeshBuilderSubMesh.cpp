@@ -8,6 +8,7 @@
 
 #include <AzCore/Memory/SystemAllocator.h>
 #include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/algorithm.h>
 #include "MeshBuilder.h"
 #include "MeshBuilderSkinningInfo.h"
 #include "MeshBuilderSubMesh.h"
@@ -47,6 +48,62 @@ namespace AZ::MeshBuilder
         }
     }
 
+    AZStd::pair<VertexCacheStatistics, VertexCacheStatistics> MeshBuilderSubMesh::OptimizeVertexCache(const MeshBuilderVertexAttributeLayerVector3* positionLayer)
+    {
+        AZ_Assert(m_vertexOrder.size() == m_numVertices, "Call GenerateVertexOrder() first");
+
+        const size_t numIndices = m_indices.size();
+        AZStd::vector<AZ::u32> indices(numIndices);
+        for (size_t i = 0; i < numIndices; ++i)
+        {
+            indices[i] = aznumeric_cast<AZ::u32>(GetIndex(i));
+        }
+
+        const VertexCacheStatistics before = AnalyzeVertexCache(indices, m_numVertices);
+
+        // the optimizers work on triangle lists only
+        const bool isTriangleList = AZStd::all_of(m_polyVertexCounts.begin(), m_polyVertexCounts.end(), [](AZ::u8 count)
+        {
+            return count == 3;
+        });
+        if (!isTriangleList || m_numVertices == 0)
+        {
+            return { before, before };
+        }
+
+        AZStd::vector<AZ::u32> optimizedIndices = AZ::MeshBuilder::OptimizeVertexCache(indices, m_numVertices);
+
+        if (positionLayer)
+        {
+            AZStd::vector<AZ::Vector3> positions(m_numVertices);
+            for (size_t i = 0; i < m_numVertices; ++i)
+            {
+                positions[i] = positionLayer->GetVertexValue(m_vertexOrder[i].mOrgVtx, m_vertexOrder[i].mDuplicateNr);
+            }
+            optimizedIndices = OptimizeOverdraw(optimizedIndices, positions);
+        }
+
+        // renumber the vertices in the order the triangles first use them, so the vertex fetches stay local
+        const AZStd::vector<AZ::u32> remap = GenerateVertexFetchRemap(optimizedIndices, m_numVertices);
+
+        for (size_t i = 0; i < numIndices; ++i)
+        {
+            m_indices[i] = m_vertexOrder[optimizedIndices[i]];
+            optimizedIndices[i] = remap[optimizedIndices[i]];
+        }
+
+        AZStd::vector<MeshBuilderVertexLookup> vertexOrder(m_numVertices);
+        for (size_t i = 0; i < m_numVertices; ++i)
+        {
+            const MeshBuilderVertexLookup& vertex = m_vertexOrder[i];
+            m_mesh->SetRealVertexNrForSubMeshVertex(this, vertex.mOrgVtx, vertex.mDuplicateNr, remap[i]);
+            vertexOrder[remap[i]] = vertex;
+        }
+        m_vertexOrder = AZStd::move(vertexOrder);
+
+        return { before, AnalyzeVertexCache(optimizedIndices, m_numVertices) };
+    }
+
     // add a polygon to the submesh
     void MeshBuilderSubMesh::AddPolygon(const AZStd::vector<MeshBuilderVertexLookup>& indices, const AZStd::vector<size_t>& jointList)
     {
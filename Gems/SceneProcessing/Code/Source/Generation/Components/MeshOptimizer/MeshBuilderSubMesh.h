@@ -9,7 +9,9 @@
 #pragma once
 
 #include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utils.h>
 #include "MeshBuilderVertexAttributeLayers.h"
+#include "MeshBuilderVertexCache.h"
 
 namespace AZ::MeshBuilder
 {
@@ -38,6 +40,11 @@ namespace AZ::MeshBuilder
 
         void GenerateVertexOrder();
 
+        // reorder the triangles and vertices for the post transform vertex cache and for vertex fetch locality
+        // When a position layer is given, the triangles are also sorted to reduce overdraw. Call after GenerateVertexOrder().
+        // Returns the vertex cache statistics before and after the optimization.
+        AZStd::pair<VertexCacheStatistics, VertexCacheStatistics> OptimizeVertexCache(const MeshBuilderVertexAttributeLayerVector3* positionLayer);
+
         void SetJoints(const AZStd::vector<size_t>& jointList) { m_jointList = jointList; }
         const AZStd::vector<size_t>& GetJoints() const { return m_jointList; }
 
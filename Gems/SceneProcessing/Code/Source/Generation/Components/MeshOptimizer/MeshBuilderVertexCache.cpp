@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Casting/numeric_cast.h>
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/limits.h>
+#include <AzCore/std/math.h>
+#include <AzCore/std/sort.h>
+#include "MeshBuilderVertexCache.h"
+
+namespace AZ::MeshBuilder
+{
+    namespace VertexCacheInternal
+    {
+        // the cache size the triangle order is optimized for, see Tom Forsyth, "Linear-Speed Vertex Cache Optimisation"
+        static constexpr size_t s_cacheSize = 32;
+        static constexpr float s_cacheDecayPower = 1.5f;
+        static constexpr float s_lastTriangleScore = 0.75f;
+        static constexpr float s_valenceBoostScale = 2.0f;
+        static constexpr AZ::u32 s_invalidTriangle = AZStd::numeric_limits<AZ::u32>::max();
+
+        float CalcVertexScore(int cachePosition, AZ::u32 remainingTriangles)
+        {
+            if (remainingTriangles == 0)
+            {
+                // the vertex is not used by any triangle that is left to add, its score is never read
+                return 0.0f;
+            }
+
+            float score = 0.0f;
+            if (cachePosition >= 0)
+            {
+                if (cachePosition < 3)
+                {
+                    // the vertices of the last triangle get a fixed score, so the next triangle does not favor its vertices
+                    // in the order they were added
+                    score = s_lastTriangleScore;
+                }
+                else
+                {
+                    const float scaler = 1.0f / (s_cacheSize - 3);
+                    score = AZStd::pow(1.0f - (cachePosition - 3) * scaler, s_cacheDecayPower);
+                }
+            }
+
+            // boost vertices with few triangles left, so that lone triangles are not left behind
+            return score + s_valenceBoostScale / AZStd::sqrt(static_cast<float>(remainingTriangles));
+        }
+    } // namespace VertexCacheInternal
+
+    VertexCacheStatistics AnalyzeVertexCache(const AZStd::vector<AZ::u32>& indices, size_t vertexCount, size_t cacheSize)
+    {
+        VertexCacheStatistics statistics;
+        statistics.m_triangleCount = indices.size() / 3;
+
+        // a vertex is in the FIFO cache if less than cacheSize misses happened since it was added
+        AZStd::vector<size_t> cacheTimestamps(vertexCount, 0);
+        size_t timestamp = cacheSize + 1;
+        AZStd::vector<bool> isUsed(vertexCount, false);
+
+        for (const AZ::u32 index : indices)
+        {
+            if (timestamp - cacheTimestamps[index] > cacheSize)
+            {
+                cacheTimestamps[index] = timestamp++;
+                ++statistics.m_cacheMissCount;
+            }
+
+            if (!isUsed[index])
+            {
+                isUsed[index] = true;
+                ++statistics.m_vertexCount;
+            }
+        }
+
+        return statistics;
+    }
+
+    AZStd::vector<AZ::u32> OptimizeVertexCache(const AZStd::vector<AZ::u32>& indices, size_t vertexCount)
+    {
+        using namespace VertexCacheInternal;
+
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount == 0)
+        {
+            return indices;
+        }
+
+        // build the list of triangles that use each vertex
+        // The triangles that are not added yet are kept at the start of the range of each vertex.
+        AZStd::vector<AZ::u32> remainingTriangles(vertexCount, 0);
+        for (const AZ::u32 index : indices)
+        {
+            ++remainingTriangles[index];
+        }
+
+        AZStd::vector<AZ::u32> adjacencyOffsets(vertexCount + 1, 0);
+        for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+        {
+            adjacencyOffsets[vertex + 1] = adjacencyOffsets[vertex] + remainingTriangles[vertex];
+        }
+
+        AZStd::vector<AZ::u32> adjacency(indices.size());
+        {
+            AZStd::vector<AZ::u32> insertPositions(adjacencyOffsets.begin(), adjacencyOffsets.end() - 1);
+            for (size_t index = 0; index < indices.size(); ++index)
+            {
+                adjacency[insertPositions[indices[index]]++] = aznumeric_cast<AZ::u32>(index / 3);
+            }
+        }
+
+        AZStd::vector<float> vertexScores(vertexCount);
+        for (size_t vertex = 0; vertex < vertexCount; ++vertex)
+        {
+            vertexScores[vertex] = CalcVertexScore(-1, remainingTriangles[vertex]);
+        }
+
+        AZStd::vector<float> triangleScores(triangleCount);
+        AZ::u32 bestTriangle = s_invalidTriangle;
+        float bestScore = -1.0f;
+        for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+        {
+            triangleScores[triangle] =
+                vertexScores[indices[triangle * 3 + 0]] + vertexScores[indices[triangle * 3 + 1]] + vertexScores[indices[triangle * 3 + 2]];
+            if (triangleScores[triangle] > bestScore)
+            {
+                bestScore = triangleScores[triangle];
+                bestTriangle = aznumeric_cast<AZ::u32>(triangle);
+            }
+        }
+
+        AZStd::vector<bool> isTriangleAdded(triangleCount, false);
+        AZStd::array<AZ::u32, s_cacheSize + 3> cache;
+        AZStd::array<AZ::u32, s_cacheSize + 3> newCache;
+        size_t cacheCount = 0;
+        size_t nextInputTriangle = 0;
+
+        AZStd::vector<AZ::u32> result;
+        result.reserve(indices.size());
+
+        for (size_t addedTriangleCount = 0; addedTriangleCount < triangleCount; ++addedTriangleCount)
+        {
+            if (bestTriangle == s_invalidTriangle)
+            {
+                // none of the triangles of the cached vertices are left, continue with the next triangle in input order
+                // instead of searching all of them for the best score, to keep the optimization linear
+                while (isTriangleAdded[nextInputTriangle])
+                {
+                    ++nextInputTriangle;
+                }
+                bestTriangle = aznumeric_cast<AZ::u32>(nextInputTriangle);
+            }
+
+            const AZ::u32* triangleIndices = &indices[bestTriangle * 3];
+            result.insert(result.end(), triangleIndices, triangleIndices + 3);
+            isTriangleAdded[bestTriangle] = true;
+
+            size_t newCacheCount = 0;
+            for (size_t corner = 0; corner < 3; ++corner)
+            {
+                const AZ::u32 vertex = triangleIndices[corner];
+
+                // remove the triangle from the remaining triangles of the vertex
+                const auto remainingBegin = adjacency.begin() + adjacencyOffsets[vertex];
+                const auto remainingEnd = remainingBegin + remainingTriangles[vertex];
+                AZStd::swap(*AZStd::find(remainingBegin, remainingEnd, bestTriangle), *(remainingEnd - 1));
+                --remainingTriangles[vertex];
+
+                if (AZStd::find(newCache.begin(), newCache.begin() + newCacheCount, vertex) == newCache.begin() + newCacheCount)
+                {
+                    newCache[newCacheCount++] = vertex;
+                }
+            }
+
+            // the vertices of the triangle move to the front of the LRU cache, and push the others back
+            for (size_t cacheIndex = 0; cacheIndex < cacheCount; ++cacheIndex)
+            {
+                const AZ::u32 vertex = cache[cacheIndex];
+                if (vertex != triangleIndices[0] && vertex != triangleIndices[1] && vertex != triangleIndices[2])
+                {
+                    newCache[newCacheCount++] = vertex;
+                }
+            }
+
+            // update the scores of the vertices that moved in the cache, including the ones pushed out of it, and of their triangles
+            for (size_t cacheIndex = 0; cacheIndex < newCacheCount; ++cacheIndex)
+            {
+                const AZ::u32 vertex = newCache[cacheIndex];
+                const int cachePosition = cacheIndex < s_cacheSize ? aznumeric_cast<int>(cacheIndex) : -1;
+
+                const float score = CalcVertexScore(cachePosition, remainingTriangles[vertex]);
+                const float scoreDelta = score - vertexScores[vertex];
+                vertexScores[vertex] = score;
+
+                const AZ::u32 remainingBegin = adjacencyOffsets[vertex];
+                for (AZ::u32 adjacent = remainingBegin; adjacent < remainingBegin + remainingTriangles[vertex]; ++adjacent)
+                {
+                    triangleScores[adjacency[adjacent]] += scoreDelta;
+                }
+            }
+
+            cacheCount = AZStd::min(newCacheCount, s_cacheSize);
+            AZStd::copy(newCache.begin(), newCache.begin() + cacheCount, cache.begin());
+
+            // the next triangle is the best one that uses a cached vertex
+            bestTriangle = s_invalidTriangle;
+            bestScore = -1.0f;
+            for (size_t cacheIndex = 0; cacheIndex < cacheCount; ++cacheIndex)
+            {
+                const AZ::u32 vertex = cache[cacheIndex];
+                const AZ::u32 remainingBegin = adjacencyOffsets[vertex];
+                for (AZ::u32 adjacent = remainingBegin; adjacent < remainingBegin + remainingTriangles[vertex]; ++adjacent)
+                {
+                    const AZ::u32 triangle = adjacency[adjacent];
+                    if (triangleScores[triangle] > bestScore)
+                    {
+                        bestScore = triangleScores[triangle];
+                        bestTriangle = triangle;
+                    }
+                }
+            }
+        }
+
+        return result;
+    }
+
+    AZStd::vector<AZ::u32> OptimizeOverdraw(const AZStd::vector<AZ::u32>& indices, const AZStd::vector<AZ::Vector3>& positions, float threshold)
+    {
+        const size_t triangleCount = indices.size() / 3;
+        if (triangleCount < 2 || positions.empty())
+        {
+            return indices;
+        }
+
+        // split the triangle list into clusters
+        // A new cluster only starts at a triangle whose vertices all miss the cache, where the cache is effectively
+        // restarted anyway, and only when the current cluster is as efficient as the whole list within the threshold.
+        constexpr size_t cacheSize = 16;
+        const float maxClusterAcmr = AnalyzeVertexCache(indices, positions.size(), cacheSize).GetAcmr() * threshold;
+
+        AZStd::vector<size_t> clusterStarts{ 0 };
+        AZStd::vector<size_t> cacheTimestamps(positions.size(), 0);
+        size_t timestamp = cacheSize + 1;
+        size_t clusterMissCount = 0;
+        size_t clusterTriangleCount = 0;
+        for (size_t triangle = 0; triangle < triangleCount; ++triangle)
+        {
+            size_t missCount = 0;
+            for (size_t corner = 0; corner < 3; ++corner)
+            {
+                const AZ::u32 index = indices[triangle * 3 + corner];
+                if (timestamp - cacheTimestamps[index] > cacheSize)
+                {
+                    cacheTimestamps[index] = timestamp++;
+                    ++missCount;
+                }
+            }
+
+            if (missCount == 3 && clusterTriangleCount > 0 &&
+                static_cast<float>(clusterMissCount) <= maxClusterAcmr * clusterTriangleCount)
+            {
+                clusterStarts.emplace_back(triangle);
+                clusterMissCount = 0;
+                clusterTriangleCount = 0;
+            }
+
+            clusterMissCount += missCount;
+            ++clusterTriangleCount;
+        }
+        clusterStarts.emplace_back(triangleCount);
+
+        const size_t clusterCount = clusterStarts.size() - 1;
+        if (clusterCount < 2)
+        {
+            return indices;
+        }
+
+        // area weighted centroid and normal of each cluster
+        AZStd::vector<AZ::Vector3> clusterCentroids(clusterCount, AZ::Vector3::CreateZero());
+        AZStd::vector<AZ::Vector3> clusterNormals(clusterCount, AZ::Vector3::CreateZero());
+        AZ::Vector3 meshCentroid = AZ::Vector3::CreateZero();
+        float meshArea = 0.0f;
+        for (size_t cluster = 0; cluster < clusterCount; ++cluster)
+        {
+            float clusterArea = 0.0f;
+            for (size_t triangle = clusterStarts[cluster]; triangle < clusterStarts[cluster + 1]; ++triangle)
+            {
+                const AZ::Vector3& position0 = positions[indices[triangle * 3 + 0]];
+                const AZ::Vector3& position1 = positions[indices[triangle * 3 + 1]];
+                const AZ::Vector3& position2 = positions[indices[triangle * 3 + 2]];
+
+                const AZ::Vector3 normal = (position1 - position0).Cross(position2 - position0);
+                const float area = normal.GetLength();
+
+                clusterNormals[cluster] += normal;
+                clusterCentroids[cluster] += (position0 + position1 + position2) * (area / 3.0f);
+                clusterArea += area;
+            }
+
+            meshCentroid += clusterCentroids[cluster];
+            meshArea += clusterArea;
+            if (clusterArea > 0.0f)
+            {
+                clusterCentroids[cluster] /= clusterArea;
+            }
+        }
+        if (meshArea > 0.0f)
+        {
+            meshCentroid /= meshArea;
+        }
+
+        // draw the clusters that face away from the center first
+        AZStd::vector<float> clusterSortKeys(clusterCount);
+        AZStd::vector<size_t> clusterOrder(clusterCount);
+        for (size_t cluster = 0; cluster < clusterCount; ++cluster)
+        {
+            clusterSortKeys[cluster] = (clusterCentroids[cluster] - meshCentroid).Dot(clusterNormals[cluster].GetNormalizedSafe());
+            clusterOrder[cluster] = cluster;
+        }
+        AZStd::stable_sort(clusterOrder.begin(), clusterOrder.end(), [&clusterSortKeys](size_t lhs, size_t rhs)
+        {
+            return clusterSortKeys[lhs] > clusterSortKeys[rhs];
+        });
+
+        AZStd::vector<AZ::u32> result;
+        result.reserve(indices.size());
+        for (const size_t cluster : clusterOrder)
+        {
+            result.insert(result.end(), indices.begin() + clusterStarts[cluster] * 3, indices.begin() + clusterStarts[cluster + 1] * 3);
+        }
+        return result;
+    }
+
+    AZStd::vector<AZ::u32> GenerateVertexFetchRemap(const AZStd::vector<AZ::u32>& indices, size_t vertexCount)
+    {
+        constexpr AZ::u32 unassigned = AZStd::numeric_limits<AZ::u32>::max();
+        AZStd::vector<AZ::u32> remap(vertexCount, unassigned);
+
+        AZ::u32 nextVertex = 0;
+        for (const AZ::u32 index : indices)
+        {
+            if (remap[index] == unassigned)
+            {
+                remap[index] = nextVertex++;
+            }
+        }
+
+        for (AZ::u32& newVertex : remap)
+        {
+            if (newVertex == unassigned)
+            {
+                newVertex = nextVertex++;
+            }
+        }
+
+        return remap;
+    }
+} // namespace AZ::MeshBuilder
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/base.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/std/containers/vector.h>
+
+namespace AZ::MeshBuilder
+{
+    // Post transform vertex cache behavior of a triangle list, simulated with a FIFO cache
+    struct VertexCacheStatistics
+    {
+        size_t m_cacheMissCount = 0;
+        size_t m_triangleCount = 0;
+        size_t m_vertexCount = 0;
+
+        // average cache miss ratio: vertices transformed per triangle, between 0.5 for a perfect grid and 3
+        float GetAcmr() const { return m_triangleCount ? static_cast<float>(m_cacheMissCount) / m_triangleCount : 0.0f; }
+        // average transform to vertex ratio: how many times each vertex is transformed, 1 is optimal
+        float GetAtvr() const { return m_vertexCount ? static_cast<float>(m_cacheMissCount) / m_vertexCount : 0.0f; }
+
+        VertexCacheStatistics& operator+=(const VertexCacheStatistics& other)
+        {
+            m_cacheMissCount += other.m_cacheMissCount;
+            m_triangleCount += other.m_triangleCount;
+            m_vertexCount += other.m_vertexCount;
+            return *this;
+        }
+    };
+
+    // simulate a FIFO vertex cache of the given size over the triangle list
+    VertexCacheStatistics AnalyzeVertexCache(const AZStd::vector<AZ::u32>& indices, size_t vertexCount, size_t cacheSize = 16);
+
+    // reorder the triangles for post transform vertex cache reuse, with Tom Forsyth's linear-speed vertex cache optimization
+    AZStd::vector<AZ::u32> OptimizeVertexCache(const AZStd::vector<AZ::u32>& indices, size_t vertexCount);
+
+    // reorder a cache optimized triangle list to reduce overdraw
+    // The list is split into clusters that keep their cache efficiency within the threshold of the whole list, and the
+    // clusters facing away from the center of the mesh are drawn first, so they occlude the rest from most view directions.
+    AZStd::vector<AZ::u32> OptimizeOverdraw(const AZStd::vector<AZ::u32>& indices, const AZStd::vector<AZ::Vector3>& positions, float threshold = 1.05f);
+
+    // get the new number of each vertex, so that the vertices are numbered in the order the triangles first use them
+    // Vertices that are not used by any triangle are numbered last.
+    AZStd::vector<AZ::u32> GenerateVertexFetchRemap(const AZStd::vector<AZ::u32>& indices, size_t vertexCount);
+} // namespace AZ::MeshBuilder
@@ -24,6 +24,7 @@
 #include <AzCore/std/smart_ptr/unique_ptr.h>
 #include <AzCore/std/string/string_view.h>
 #include <AzCore/std/typetraits/add_pointer.h>
+#include <AzCore/std/typetraits/is_same.h>
 #include <AzCore/std/typetraits/remove_cvref.h>
 #include <AzCore/std/utils.h>
 
@@ -359,10 +360,15 @@ namespace AZ::SceneGenerationComponents
 
             const AZStd::string_view nodePath(graph.GetNodeName(nodeIndex).GetPath(), graph.GetNodeName(nodeIndex).GetPathLength());
 
+            // Generated levels of detail are optimized for the mesh groups that selected their source mesh
+            AZStd::string_view selectedNodePath = nodePath;
+            size_t generatedLod = 0;
+            SceneAPI::Utilities::SceneGraphSelector::ParseGeneratedLodMeshName(nodePath, selectedNodePath, generatedLod);
+
             for (const IMeshGroup& meshGroup : meshGroups)
             {
                 // Skip meshes that are not used by this mesh group
-                if (AZStd::find(selectedNodes.at(&meshGroup).cbegin(), selectedNodes.at(&meshGroup).cend(), nodePath) == selectedNodes.at(&meshGroup).cend())
+                if (AZStd::find(selectedNodes.at(&meshGroup).cbegin(), selectedNodes.at(&meshGroup).cend(), selectedNodePath) == selectedNodes.at(&meshGroup).cend())
                 {
                     continue;
                 }
@@ -578,6 +584,19 @@ namespace AZ::SceneGenerationComponents
 
         meshBuilder.GenerateSubMeshVertexOrders();
 
+        // The triangle order of blend shapes has to match the base mesh. The vertex cache order only depends on the
+        // topology, which they share, but the overdraw order depends on the positions, so it is skipped for them.
+        [[maybe_unused]] const auto [cacheStatisticsBefore, cacheStatisticsAfter] = meshBuilder.OptimizeSubMeshVertexCaches(hasBlendShapes ? nullptr : posLayer);
+        if constexpr (AZStd::is_same_v<MeshDataType, IMeshData>)
+        {
+            AZ_TracePrintf(AZ::SceneAPI::Utilities::LogWindow, "Optimized vertex cache: ACMR %0.3f -> %0.3f, ATVR %0.3f -> %0.3f",
+                cacheStatisticsBefore.GetAcmr(),
+                cacheStatisticsAfter.GetAcmr(),
+                cacheStatisticsBefore.GetAtvr(),
+                cacheStatisticsAfter.GetAtvr()
+            );
+        }
+
         // Create the resulting nodes
         struct ResultingType
         {
@@ -17,6 +17,7 @@
 #include <Generation/Components/TangentGenerator/TangentGenerateComponent.h>
 #include <Generation/Components/TangentGenerator/TangentPreExportComponent.h>
 #include <Generation/Components/MeshOptimizer/MeshOptimizerComponent.h>
+#include <Generation/Components/LodGenerator/LodGeneratorComponent.h>
 #include <Source/SceneProcessingModule.h>
 
 namespace AZ
@@ -45,6 +46,7 @@ namespace AZ
                     AZ::SceneGenerationComponents::TangentPreExportComponent::CreateDescriptor(),
                     AZ::SceneGenerationComponents::TangentGenerateComponent::CreateDescriptor(),
                     AZ::SceneGenerationComponents::MeshOptimizerComponent::CreateDescriptor(),
+                    AZ::SceneGenerationComponents::LodGeneratorComponent::CreateDescriptor(),
                 });
 
                 // This is an internal Amazon gem, so register it's components for metrics tracking, otherwise the name of the component won't get sent back.
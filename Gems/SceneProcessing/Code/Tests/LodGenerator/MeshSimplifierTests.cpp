@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Aabb.h>
+#include <AzCore/std/algorithm.h>
+#include <Generation/Components/LodGenerator/MeshSimplifier.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace AZ::LodGenerator
+{
+    class MeshSimplifierFixture
+        : public UnitTest::ScopedAllocatorSetupFixture
+    {
+    public:
+        static constexpr AZ::u32 s_gridSize = 17;
+
+        // triangle list of a grid of s_gridSize by s_gridSize vertices
+        static AZStd::vector<AZ::u32> GenerateGridIndices()
+        {
+            AZStd::vector<AZ::u32> indices;
+            for (AZ::u32 row = 0; row < (s_gridSize - 1); ++row)
+            {
+                for (AZ::u32 column = 0; column < (s_gridSize - 1); ++column)
+                {
+                    const AZ::u32 vertex1 = row * s_gridSize + column;
+                    const AZ::u32 vertex2 = vertex1 + 1;
+                    const AZ::u32 vertex3 = vertex2 + s_gridSize;
+                    const AZ::u32 vertex4 = vertex1 + s_gridSize;
+                    indices.insert(indices.end(), { vertex1, vertex2, vertex3, vertex1, vertex3, vertex4 });
+                }
+            }
+            return indices;
+        }
+
+        // grid over [-1, 1] in x and y, bent into a paraboloid by the curvature
+        static void GenerateGridVertices(float curvature, AZStd::vector<AZ::Vector3>& positions, AZStd::vector<AZ::Vector3>& normals)
+        {
+            for (AZ::u32 row = 0; row < s_gridSize; ++row)
+            {
+                for (AZ::u32 column = 0; column < s_gridSize; ++column)
+                {
+                    const float x = static_cast<float>(column) / (s_gridSize - 1) * 2.0f - 1.0f;
+                    const float y = static_cast<float>(row) / (s_gridSize - 1) * 2.0f - 1.0f;
+                    positions.emplace_back(x, y, curvature * (x * x + y * y));
+                    normals.emplace_back(AZ::Vector3(-2.0f * curvature * x, -2.0f * curvature * y, 1.0f).GetNormalized());
+                }
+            }
+        }
+
+        static AZ::Aabb GetBounds(const AZStd::vector<AZ::u32>& indices, const AZStd::vector<AZ::Vector3>& positions)
+        {
+            AZ::Aabb bounds = AZ::Aabb::CreateNull();
+            for (const AZ::u32 index : indices)
+            {
+                bounds.AddPoint(positions[index]);
+            }
+            return bounds;
+        }
+    };
+
+    TEST_F(MeshSimplifierFixture, SimplifyMesh_Plane_ReachesTriangleCountsWithoutError)
+    {
+        const AZStd::vector<AZ::u32> indices = GenerateGridIndices();
+        AZStd::vector<AZ::Vector3> positions;
+        AZStd::vector<AZ::Vector3> normals;
+        GenerateGridVertices(0.0f, positions, normals);
+
+        const size_t triangleCount = indices.size() / 3;
+        const AZStd::vector<SimplifiedMesh> lods = SimplifyMesh(indices, positions, normals, {}, { { triangleCount / 4, 0.001f }, { triangleCount / 16, 0.001f } });
+        ASSERT_EQ(lods.size(), 2);
+
+        EXPECT_LE(lods[0].m_sourceTriangles.size(), triangleCount / 4);
+        EXPECT_LE(lods[1].m_sourceTriangles.size(), triangleCount / 16);
+        for (const SimplifiedMesh& lod : lods)
+        {
+            EXPECT_EQ(lod.m_indices.size(), lod.m_sourceTriangles.size() * 3);
+            EXPECT_NEAR(lod.m_error, 0.0f, 1e-5f);
+
+            // the border of the plane does not move
+            EXPECT_TRUE(GetBounds(lod.m_indices, positions).GetMin().IsClose(AZ::Vector3(-1.0f, -1.0f, 0.0f)));
+            EXPECT_TRUE(GetBounds(lod.m_indices, positions).GetMax().IsClose(AZ::Vector3(1.0f, 1.0f, 0.0f)));
+        }
+    }
+
+    TEST_F(MeshSimplifierFixture, SimplifyMesh_CurvedSurface_StopsAtMaxError)
+    {
+        const AZStd::vector<AZ::u32> indices = GenerateGridIndices();
+        AZStd::vector<AZ::Vector3> positions;
+        AZStd::vector<AZ::Vector3> normals;
+        GenerateGridVertices(0.5f, positions, normals);
+
+        constexpr float maxError = 0.01f;
+        const AZStd::vector<SimplifiedMesh> lods = SimplifyMesh(indices, positions, normals, {}, { { 0, maxError }, { 0, maxError * 5.0f } });
+        ASSERT_EQ(lods.size(), 2);
+
+        EXPECT_GT(lods[0].m_sourceTriangles.size(), lods[1].m_sourceTriangles.size());
+        EXPECT_LT(lods[0].m_sourceTriangles.size(), indices.size() / 3);
+        EXPECT_LE(lods[0].m_error, maxError);
+        EXPECT_LE(lods[1].m_error, maxError * 5.0f);
+    }
+
+    TEST_F(MeshSimplifierFixture, SimplifyMesh_TriangleGroups_KeepsVerticesBetweenGroups)
+    {
+        const AZStd::vector<AZ::u32> indices = GenerateGridIndices();
+        AZStd::vector<AZ::Vector3> positions;
+        AZStd::vector<AZ::Vector3> normals;
+        GenerateGridVertices(0.0f, positions, normals);
+
+        // the left and right half of the grid have different materials
+        constexpr AZ::u32 groupColumn = s_gridSize / 2;
+        AZStd::vector<AZ::u32> triangleGroups;
+        for (size_t index = 0; index < indices.size(); index += 3)
+        {
+            triangleGroups.emplace_back(indices[index] % s_gridSize < groupColumn ? 0 : 1);
+        }
+
+        const AZStd::vector<SimplifiedMesh> lods = SimplifyMesh(indices, positions, normals, triangleGroups, { { 0, 0.001f } });
+        ASSERT_EQ(lods.size(), 1);
+
+        for (AZ::u32 row = 0; row < s_gridSize; ++row)
+        {
+            const AZ::u32 vertex = row * s_gridSize + groupColumn;
+            EXPECT_NE(AZStd::find(lods[0].m_indices.begin(), lods[0].m_indices.end(), vertex), lods[0].m_indices.end());
+        }
+        for (size_t triangle = 0; triangle < lods[0].m_sourceTriangles.size(); ++triangle)
+        {
+            for (size_t corner = 0; corner < 3; ++corner)
+            {
+                // triangles stay on their side of the material border
+                const AZ::u32 column = lods[0].m_indices[triangle * 3 + corner] % s_gridSize;
+                if (triangleGroups[lods[0].m_sourceTriangles[triangle]] == 0)
+                {
+                    EXPECT_LE(column, groupColumn);
+                }
+                else
+                {
+                    EXPECT_GE(column, groupColumn);
+                }
+            }
+        }
+    }
+
+    TEST_F(MeshSimplifierFixture, SimplifyMesh_SeamVertices_AreKept)
+    {
+        // two quads that share an edge, with separate vertices on each side of it like a UV seam. Collapsing the seam
+        // vertices along the border would not move the surface, but it would tear the seam open.
+        const AZStd::vector<AZ::Vector3> positions{
+            AZ::Vector3(0.0f, 0.0f, 0.0f), AZ::Vector3(1.0f, 0.0f, 0.0f), AZ::Vector3(1.0f, 1.0f, 0.0f), AZ::Vector3(0.0f, 1.0f, 0.0f),
+            AZ::Vector3(1.0f, 0.0f, 0.0f), AZ::Vector3(2.0f, 0.0f, 0.0f), AZ::Vector3(2.0f, 1.0f, 0.0f), AZ::Vector3(1.0f, 1.0f, 0.0f),
+        };
+        const AZStd::vector<AZ::u32> indices{ 0, 1, 2, 0, 2, 3, 4, 5, 6, 4, 6, 7 };
+
+        const AZStd::vector<SimplifiedMesh> lods = SimplifyMesh(indices, positions, {}, {}, { { 0, 0.001f } });
+        ASSERT_EQ(lods.size(), 1);
+        EXPECT_EQ(lods[0].m_indices, indices);
+    }
+} // namespace AZ::LodGenerator
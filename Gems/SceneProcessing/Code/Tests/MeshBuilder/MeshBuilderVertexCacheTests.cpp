@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/std/algorithm.h>
+#include <AzCore/std/containers/array.h>
+#include <AzCore/std/sort.h>
+#include <Generation/Components/MeshOptimizer/MeshBuilderVertexCache.h>
+#include <AzCore/UnitTest/TestTypes.h>
+
+namespace AZ::MeshBuilder
+{
+    class MeshBuilderVertexCacheFixture
+        : public UnitTest::ScopedAllocatorSetupFixture
+    {
+    public:
+        // triangle list of a grid, in the row by row order that thrashes the vertex cache for wide grids
+        static AZStd::vector<AZ::u32> GenerateGridIndices(AZ::u32 numRows, AZ::u32 numColumns)
+        {
+            AZStd::vector<AZ::u32> indices;
+            for (AZ::u32 row = 0; row < (numRows - 1); ++row)
+            {
+                for (AZ::u32 column = 0; column < (numColumns - 1); ++column)
+                {
+                    const AZ::u32 vertex1 = row * numColumns + column;
+                    const AZ::u32 vertex2 = vertex1 + 1;
+                    const AZ::u32 vertex3 = vertex2 + numColumns;
+                    const AZ::u32 vertex4 = vertex1 + numColumns;
+                    indices.insert(indices.end(), { vertex1, vertex2, vertex3, vertex1, vertex3, vertex4 });
+                }
+            }
+            return indices;
+        }
+
+        static AZStd::vector<AZ::Vector3> GenerateGridPositions(AZ::u32 numRows, AZ::u32 numColumns)
+        {
+            AZStd::vector<AZ::Vector3> positions;
+            for (AZ::u32 row = 0; row < numRows; ++row)
+            {
+                for (AZ::u32 column = 0; column < numColumns; ++column)
+                {
+                    positions.emplace_back(static_cast<float>(column), static_cast<float>(row), 0.0f);
+                }
+            }
+            return positions;
+        }
+
+        // the triangles of the list, rotated so their smallest index is first, in sorted order
+        static AZStd::vector<AZStd::array<AZ::u32, 3>> GetSortedTriangles(const AZStd::vector<AZ::u32>& indices)
+        {
+            AZStd::vector<AZStd::array<AZ::u32, 3>> triangles;
+            for (size_t i = 0; i < indices.size(); i += 3)
+            {
+                AZStd::array<AZ::u32, 3> triangle{ indices[i], indices[i + 1], indices[i + 2] };
+                while (triangle[0] > triangle[1] || triangle[0] > triangle[2])
+                {
+                    triangle = { triangle[1], triangle[2], triangle[0] };
+                }
+                triangles.emplace_back(triangle);
+            }
+            AZStd::sort(triangles.begin(), triangles.end(), [](const AZStd::array<AZ::u32, 3>& lhs, const AZStd::array<AZ::u32, 3>& rhs)
+            {
+                return AZStd::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+            });
+            return triangles;
+        }
+    };
+
+    TEST_F(MeshBuilderVertexCacheFixture, AnalyzeVertexCache_SingleTriangle_ThreeMisses)
+    {
+        const VertexCacheStatistics statistics = AnalyzeVertexCache({ 0, 1, 2 }, 3);
+        EXPECT_EQ(statistics.m_cacheMissCount, 3);
+        EXPECT_FLOAT_EQ(statistics.GetAcmr(), 3.0f);
+        EXPECT_FLOAT_EQ(statistics.GetAtvr(), 1.0f);
+    }
+
+    TEST_F(MeshBuilderVertexCacheFixture, OptimizeVertexCache_WideGrid_LowersAcmr)
+    {
+        constexpr AZ::u32 numRows = 64;
+        constexpr AZ::u32 numColumns = 64;
+        const AZStd::vector<AZ::u32> indices = GenerateGridIndices(numRows, numColumns);
+
+        const AZStd::vector<AZ::u32> optimizedIndices = OptimizeVertexCache(indices, numRows * numColumns);
+        ASSERT_EQ(optimizedIndices.size(), indices.size());
+        EXPECT_EQ(GetSortedTriangles(optimizedIndices), GetSortedTriangles(indices));
+
+        const VertexCacheStatistics before = AnalyzeVertexCache(indices, numRows * numColumns);
+        const VertexCacheStatistics after = AnalyzeVertexCache(optimizedIndices, numRows * numColumns);
+        EXPECT_LT(after.GetAcmr(), before.GetAcmr());
+        EXPECT_LT(after.GetAcmr(), 0.8f);
+        EXPECT_GE(after.GetAtvr(), 1.0f);
+    }
+
+    TEST_F(MeshBuilderVertexCacheFixture, OptimizeOverdraw_KeepsTriangles)
+    {
+        constexpr AZ::u32 numRows = 32;
+        constexpr AZ::u32 numColumns = 32;
+        const AZStd::vector<AZ::u32> indices = OptimizeVertexCache(GenerateGridIndices(numRows, numColumns), numRows * numColumns);
+
+        const AZStd::vector<AZ::u32> overdrawIndices = OptimizeOverdraw(indices, GenerateGridPositions(numRows, numColumns));
+        ASSERT_EQ(overdrawIndices.size(), indices.size());
+        EXPECT_EQ(GetSortedTriangles(overdrawIndices), GetSortedTriangles(indices));
+    }
+
+    TEST_F(MeshBuilderVertexCacheFixture, GenerateVertexFetchRemap_NumbersVerticesInOrderOfFirstUse)
+    {
+        // vertex 1 is not used
+        const AZStd::vector<AZ::u32> indices{ 3, 0, 4, 4, 0, 2 };
+        const AZStd::vector<AZ::u32> remap = GenerateVertexFetchRemap(indices, 5);
+
+        const AZStd::vector<AZ::u32> expectedRemap{ 1, 4, 3, 0, 2 };
+        EXPECT_EQ(remap, expectedRemap);
+    }
+} // namespace AZ::MeshBuilder
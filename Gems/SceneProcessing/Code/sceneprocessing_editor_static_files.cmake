@@ -29,8 +29,14 @@ set(FILES
     Source/Generation/Components/MeshOptimizer/MeshBuilderSubMesh.h
     Source/Generation/Components/MeshOptimizer/MeshBuilderVertexAttributeLayers.cpp
     Source/Generation/Components/MeshOptimizer/MeshBuilderVertexAttributeLayers.h
+    Source/Generation/Components/MeshOptimizer/MeshBuilderVertexCache.cpp
+    Source/Generation/Components/MeshOptimizer/MeshBuilderVertexCache.h
     Source/Generation/Components/MeshOptimizer/MeshOptimizerComponent.cpp
     Source/Generation/Components/MeshOptimizer/MeshOptimizerComponent.h
+    Source/Generation/Components/LodGenerator/LodGeneratorComponent.cpp
+    Source/Generation/Components/LodGenerator/LodGeneratorComponent.h
+    Source/Generation/Components/LodGenerator/MeshSimplifier.cpp
+    Source/Generation/Components/LodGenerator/MeshSimplifier.h
     Source/Config/SettingsObjects/SoftNameSetting.h
     Source/Config/SettingsObjects/SoftNameSetting.cpp
     Source/Config/SettingsObjects/NodeSoftNameSetting.h
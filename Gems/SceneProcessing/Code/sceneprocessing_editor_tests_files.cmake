@@ -8,8 +8,10 @@
 
 set(FILES
     Tests/InitSceneAPIFixture.h
+    Tests/LodGenerator/MeshSimplifierTests.cpp
     Tests/MeshBuilder/MeshOptimizerComponentTests.cpp
     Tests/MeshBuilder/MeshBuilderTests.cpp
+    Tests/MeshBuilder/MeshBuilderVertexCacheTests.cpp
     Tests/MeshBuilder/MeshVerticesTests.cpp
     Tests/MeshBuilder/SkinInfluencesTests.cpp
     Tests/MeshOptimizer/HasBlendshapes.cpp
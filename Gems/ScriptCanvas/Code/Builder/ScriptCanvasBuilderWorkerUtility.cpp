@@ -27,6 +27,7 @@
 #include <ScriptCanvas/Core/Node.h>
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
 #include <ScriptCanvas/Results/ErrorText.h>
+#include <ScriptCanvas/Translation/GraphToCPlusPlus.h>
 #include <ScriptCanvas/Utils/BehaviorContextUtils.h>
 #include <Source/Components/SceneComponent.h>
 
@@ -564,6 +565,7 @@ namespace ScriptCanvasBuilder
 
         input.runtimeDataOut.m_input = AZStd::move(translation.m_runtimeInputs);
         input.runtimeDataOut.m_debugMap = AZStd::move(translation.m_debugMap);
+        input.runtimeDataOut.m_nativeFingerprint = ScriptCanvas::Translation::GraphToCPlusPlus::GetFingerprint(translation.m_text);
         input.interfaceOut = AZStd::move(translation.m_subgraphInterface);
 
         return AZ::Success();
@@ -680,6 +682,13 @@ namespace ScriptCanvasBuilder
     ScriptCanvas::Translation::Result TranslateToLua(ScriptCanvas::Grammar::Request& request)
     {
         request.translationTargetFlags = ScriptCanvas::Translation::TargetFlags::Lua;
+
+        // the C++ output is saved to the user cache, to be built into a gem, the Lua output remains the job product either way
+        if (ScriptCanvas::Grammar::g_translateToNative)
+        {
+            request.translationTargetFlags |= ScriptCanvas::Translation::TargetFlags::Cpp | ScriptCanvas::Translation::TargetFlags::Hpp;
+        }
+
         return ScriptCanvas::Translation::ParseAndTranslateGraph(request);
     }
 }
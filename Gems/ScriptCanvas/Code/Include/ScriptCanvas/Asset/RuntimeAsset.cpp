@@ -17,6 +17,7 @@ namespace ScriptCanvasRuntimeAssetCpp
     {
         AddDependencies = 3,
         ChangeScriptRequirementToAsset,
+        AddNativeFingerprint,
 
         // add description above
         Current
@@ -59,6 +60,7 @@ namespace ScriptCanvas
             m_script = AZStd::move(other.m_script);
             m_requiredAssets = AZStd::move(other.m_requiredAssets);
             m_requiredScriptEvents = AZStd::move(other.m_requiredScriptEvents);
+            m_nativeFingerprint = other.m_nativeFingerprint;
         }
 
         return *this;
@@ -77,6 +79,7 @@ namespace ScriptCanvas
                 ->Field("script", &RuntimeData::m_script)
                 ->Field("requiredAssets", &RuntimeData::m_requiredAssets)
                 ->Field("requiredScriptEvents", &RuntimeData::m_requiredScriptEvents)
+                ->Field("nativeFingerprint", &RuntimeData::m_nativeFingerprint)
                 ;
         }
 
@@ -70,6 +70,8 @@ namespace ScriptCanvas
         AZ::Data::Asset<AZ::ScriptAsset> m_script;
         AZStd::vector<AZ::Data::Asset<RuntimeAsset>> m_requiredAssets;
         AZStd::vector<AZ::Data::Asset<ScriptEvents::ScriptEventsAsset>> m_requiredScriptEvents;
+        // identifies the version of the graph, native C++ generated from another version is not executed
+        AZ::u32 m_nativeFingerprint = 0;
 
         // populate all on initial load at run time
         AZStd::vector<Execution::CloneSource> m_cloneSources;
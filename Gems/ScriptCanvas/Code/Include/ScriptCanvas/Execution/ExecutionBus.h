@@ -67,6 +67,20 @@ namespace ScriptCanvas
 
         using PerformanceReportByAsset = AZStd::unordered_map<AZ::Data::AssetId, PerformanceTrackingReport>;
 
+        struct PerformanceNodeReport
+        {
+            AZ_TYPE_INFO(PerformanceNodeReport, "{6C1E35E4-8E0B-4C59-A1E2-2F7D9B3A5C41}");
+            AZ_CLASS_ALLOCATOR(PerformanceNodeReport, AZ::SystemAllocator, 0);
+
+            AZ::u64 callCount = 0;
+            AZStd::sys_time_t executionTime = 0;
+
+            PerformanceNodeReport& operator+=(const PerformanceNodeReport& rhs);
+        };
+
+        // keyed by the id of the node
+        using PerformanceReportByNode = AZStd::unordered_map<AZ::EntityId, PerformanceNodeReport>;
+
         struct PerformanceReport
         {
             AZ_TYPE_INFO(PerformanceReport, "{D0FFBFFA-6662-44D4-A25E-65C65D4B422A}");
@@ -74,6 +88,7 @@ namespace ScriptCanvas
 
             PerformanceTrackingReport tracking;
             PerformanceReportByAsset byAsset;
+            PerformanceReportByNode byNode;
         };
 
         void FinalizePerformanceReport(PerformanceKey key, const AZ::Data::AssetId& assetId);
@@ -44,6 +44,13 @@ namespace ScriptCanvas
             return *this;
         }
 
+        PerformanceNodeReport& PerformanceNodeReport::operator+=(const PerformanceNodeReport& rhs)
+        {
+            callCount += rhs.callCount;
+            executionTime += rhs.executionTime;
+            return *this;
+        }
+
         PerformanceScope::PerformanceScope(const PerformanceKey& key, const AZ::Data::AssetId& assetId)
             : m_key(key)
             , m_assetId(assetId)
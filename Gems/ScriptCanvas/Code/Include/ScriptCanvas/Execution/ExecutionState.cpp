@@ -14,6 +14,7 @@
 #include "Interpreted/ExecutionStateInterpretedPure.h"
 #include "Interpreted/ExecutionStateInterpretedPerActivation.h"
 #include "Interpreted/ExecutionStateInterpretedSingleton.h"
+#include "Native/ExecutionStateNative.h"
 
 #include "ExecutionState.h"
 
@@ -39,6 +40,12 @@ namespace ScriptCanvas
             return AZStd::make_shared<ExecutionStateInterpretedPure>(config);
 
         case Grammar::ExecutionStateSelection::InterpretedPureOnGraphStart:
+            // a gem may have built in the C++ translation of the graph, otherwise fall back to the Lua one
+            if (ExecutionStateNativeOnGraphStart::IsAvailable(config))
+            {
+                return AZStd::make_shared<ExecutionStateNativeOnGraphStart>(config);
+            }
+
             return AZStd::make_shared<ExecutionStateInterpretedPureOnGraphStart>(config);
 
         case Grammar::ExecutionStateSelection::InterpretedObject:
@@ -108,6 +115,7 @@ namespace ScriptCanvas
         ExecutionStateInterpretedPure::Reflect(reflectContext);
         ExecutionStateInterpretedPureOnGraphStart::Reflect(reflectContext);
         ExecutionStateInterpretedSingleton::Reflect(reflectContext);
+        ExecutionStateNativeOnGraphStart::Reflect(reflectContext);
     }
 
     ExecutionStatePtr ExecutionState::SharedFromThis()
@@ -26,6 +26,7 @@
 #include "ExecutionInterpretedDebugAPI.h"
 #include "ExecutionInterpretedEBusAPI.h"
 #include "ExecutionInterpretedOut.h"
+#include "ExecutionInterpretedThunks.h"
 
 namespace ExecutionInterpretedAPICpp
 {
@@ -484,6 +485,7 @@ namespace ScriptCanvas
             RegisterCloningAPI(lua);
             RegisterDebugAPI(lua);
             RegisterEBusHandlerAPI(lua);
+            RegisterInterpretedThunks(lua);
             lua_gc(lua, LUA_GCCOLLECT, 0);
         }
 
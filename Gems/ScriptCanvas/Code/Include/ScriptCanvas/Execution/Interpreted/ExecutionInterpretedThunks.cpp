@@ -0,0 +1,472 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ExecutionInterpretedThunks.h"
+
+#include <AzCore/Math/Quaternion.h>
+#include <AzCore/Math/Vector2.h>
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/Math/Vector4.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/Script/lua/lua.h>
+#include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/smart_ptr/make_shared.h>
+#include <AzCore/std/time.h>
+#include <AzCore/std/tuple.h>
+#include <AzCore/std/typetraits/remove_cvref.h>
+#include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
+
+namespace ExecutionInterpretedThunksCpp
+{
+    using namespace ScriptCanvas::Execution;
+
+#if defined(SCRIPT_CANVAS_PERFORMANCE_TRACKING_ENABLED)
+    struct Counters
+    {
+        AZ::u64 m_callCount = 0;
+        AZ::u64 m_executionTimeTicks = 0;
+    };
+
+    // The calls one thread made through the tracked globals since the last collection, by the id of the node that made them.
+    // Only the owning thread adds to them, so the mutex is only contended while the counters are collected. Collection zeroes
+    // the counters in place, so the counters of the last node stay valid and repeated calls of one node skip the map lookup.
+    struct ThreadCounters
+    {
+        AZStd::mutex m_mutex;
+        AZStd::unordered_map<AZ::EntityId, Counters> m_counters;
+        AZ::EntityId m_lastNodeId;
+        Counters* m_lastCounters = nullptr;
+    };
+
+    struct ThreadCountersRegistry
+    {
+        AZStd::mutex m_mutex;
+        AZStd::vector<AZStd::shared_ptr<ThreadCounters>> m_threads;
+    };
+
+    ThreadCountersRegistry& GetThreadCountersRegistry()
+    {
+        static ThreadCountersRegistry s_registry;
+        return s_registry;
+    }
+
+    ThreadCounters& GetThreadCounters()
+    {
+        // shared with the registry, so the calls of a thread that exited are still collected
+        static thread_local AZStd::shared_ptr<ThreadCounters> t_threadCounters = []()
+        {
+            auto threadCounters = AZStd::make_shared<ThreadCounters>();
+            ThreadCountersRegistry& registry = GetThreadCountersRegistry();
+            AZStd::lock_guard<AZStd::mutex> lock(registry.m_mutex);
+            registry.m_threads.push_back(threadCounters);
+            return threadCounters;
+        }();
+        return *t_threadCounters;
+    }
+
+    void CountCall(const AZ::EntityId& nodeId, AZStd::sys_time_t durationTicks)
+    {
+        ThreadCounters& threadCounters = GetThreadCounters();
+        AZStd::lock_guard<AZStd::mutex> lock(threadCounters.m_mutex);
+        if (!threadCounters.m_lastCounters || threadCounters.m_lastNodeId != nodeId)
+        {
+            threadCounters.m_lastNodeId = nodeId;
+            threadCounters.m_lastCounters = &threadCounters.m_counters[nodeId];
+        }
+        ++threadCounters.m_lastCounters->m_callCount;
+        threadCounters.m_lastCounters->m_executionTimeTicks += durationTicks;
+    }
+
+    class CountingScope
+    {
+    public:
+        explicit CountingScope(const AZ::EntityId& nodeId)
+            : m_nodeId(nodeId)
+            , m_startTicks(AZStd::GetTimeNowTicks())
+        {}
+
+        ~CountingScope()
+        {
+            CountCall(m_nodeId, AZStd::GetTimeNowTicks() - m_startTicks);
+        }
+
+    private:
+        AZ::EntityId m_nodeId;
+        AZStd::sys_time_t m_startTicks;
+    };
+#endif
+
+    // Tracked thunks take the id of the node making the call first, as a string since Lua numbers can't hold every id.
+    AZ::EntityId ReadNodeId(lua_State* lua)
+    {
+        const char* nodeId = lua_tostring(lua, 1);
+        return nodeId ? AZ::EntityId(strtoull(nodeId, nullptr, 10)) : AZ::EntityId();
+    }
+
+    // Lua: nodeId, function, args...
+    // Calls any function, usually a method reflected through the BehaviorContext that has no thunk, and returns all of its results.
+    int TrackedCall(lua_State* lua)
+    {
+#if defined(SCRIPT_CANVAS_PERFORMANCE_TRACKING_ENABLED)
+        // not a CountingScope, script errors leave lua_call with a long jump that would skip its destructor
+        const AZ::EntityId nodeId = ReadNodeId(lua);
+        const AZStd::sys_time_t startTicks = AZStd::GetTimeNowTicks();
+#endif
+        lua_call(lua, lua_gettop(lua) - 2, LUA_MULTRET);
+#if defined(SCRIPT_CANVAS_PERFORMANCE_TRACKING_ENABLED)
+        CountCall(nodeId, AZStd::GetTimeNowTicks() - startTicks);
+#endif
+        // everything above the node id is a result
+        return lua_gettop(lua) - 1;
+    }
+
+    // Native types (numbers, booleans...) are read by value, reflected classes by pointer to the value held by Lua.
+    template<typename T, bool isNative = AZ::ScriptValue<T>::isNativeValueType>
+    struct Argument
+    {
+        T m_value{};
+
+        bool Read(lua_State* lua, int index)
+        {
+            m_value = AZ::ScriptValue<T>::StackRead(lua, index);
+            return true;
+        }
+
+        T& Get()
+        {
+            return m_value;
+        }
+    };
+
+    template<typename T>
+    struct Argument<T, false>
+    {
+        T* m_pointer = nullptr;
+
+        bool Read(lua_State* lua, int index)
+        {
+            m_pointer = AZ::ScriptValue<T*>::StackRead(lua, index);
+            return m_pointer != nullptr;
+        }
+
+        T& Get()
+        {
+            return *m_pointer;
+        }
+    };
+
+    template<typename T>
+    using ArgumentOf = Argument<AZStd::remove_cvref_t<T>>;
+
+    template<typename T>
+    void PushResult(lua_State* lua, T&& result)
+    {
+        using ValueType = AZStd::remove_cvref_t<T>;
+
+        if constexpr (AZ::ScriptValue<ValueType>::isNativeValueType)
+        {
+            AZ::ScriptValue<ValueType>::StackPush(lua, result);
+        }
+        else
+        {
+            // the result is a temporary, Lua gets its own copy of it
+            AZ::Internal::LuaClassToStack(lua, &result, azrtti_typeid<ValueType>(), AZ::ObjectToLua::ByValue);
+        }
+    }
+
+    template<typename Result, typename Function>
+    int CallAndPushResult(lua_State* lua, Function&& function)
+    {
+        if constexpr (AZStd::is_void_v<Result>)
+        {
+            function();
+            return 0;
+        }
+        else
+        {
+            PushResult(lua, function());
+            return 1;
+        }
+    }
+
+    int ReportArgumentError(lua_State* lua, const char* thunkName, int index)
+    {
+        AZ::ScriptContext::FromNativeContext(lua)->Error(AZ::ScriptContext::ErrorType::Error, true
+            , "%s: argument %d is nil or is not of the expected type", thunkName, index);
+        return 0;
+    }
+
+    template<typename T>
+    AZ::Uuid GetTypeId()
+    {
+        if constexpr (AZStd::is_void_v<T>)
+        {
+            return AZ::Uuid::CreateNull();
+        }
+        else
+        {
+            return azrtti_typeid<AZStd::remove_cvref_t<T>>();
+        }
+    }
+
+    template<auto t_function, typename = decltype(t_function)>
+    struct Thunk;
+
+    // Lua: args...
+    template<auto t_function, typename Result, typename... Args>
+    struct Thunk<t_function, Result(*)(Args...)>
+    {
+        static int Call(lua_State* lua)
+        {
+            return Call(lua, 1, AZStd::make_index_sequence<sizeof...(Args)>{});
+        }
+
+        // Lua: nodeId, args...
+        static int CallTracked(lua_State* lua)
+        {
+#if defined(SCRIPT_CANVAS_PERFORMANCE_TRACKING_ENABLED)
+            CountingScope scope(ReadNodeId(lua));
+#endif
+            return Call(lua, 2, AZStd::make_index_sequence<sizeof...(Args)>{});
+        }
+
+        template<size_t... Indices>
+        static int Call(lua_State* lua, int firstIndex, AZStd::index_sequence<Indices...>)
+        {
+            AZStd::tuple<ArgumentOf<Args>...> arguments;
+            int badArgument = 0;
+            if (!((AZStd::get<Indices>(arguments).Read(lua, aznumeric_cast<int>(Indices) + firstIndex) || (badArgument = aznumeric_cast<int>(Indices) + firstIndex, false)) && ...))
+            {
+                return ReportArgumentError(lua, "InterpretedThunk", badArgument);
+            }
+
+            return CallAndPushResult<Result>(lua, [&]() -> Result { return t_function(AZStd::get<Indices>(arguments).Get()...); });
+        }
+
+        static AZStd::vector<AZ::Uuid> GetArgumentTypes()
+        {
+            return { GetTypeId<Args>()... };
+        }
+    };
+
+    // Lua: this, args...
+    template<auto t_function, typename Result, typename Class, typename... Args>
+    struct MemberThunk
+    {
+        static int Call(lua_State* lua)
+        {
+            return Call(lua, 1, AZStd::make_index_sequence<sizeof...(Args)>{});
+        }
+
+        // Lua: nodeId, this, args...
+        static int CallTracked(lua_State* lua)
+        {
+#if defined(SCRIPT_CANVAS_PERFORMANCE_TRACKING_ENABLED)
+            CountingScope scope(ReadNodeId(lua));
+#endif
+            return Call(lua, 2, AZStd::make_index_sequence<sizeof...(Args)>{});
+        }
+
+        template<size_t... Indices>
+        static int Call(lua_State* lua, int firstIndex, AZStd::index_sequence<Indices...>)
+        {
+            Argument<Class, false> self;
+            if (!self.Read(lua, firstIndex))
+            {
+                return ReportArgumentError(lua, "InterpretedThunk", firstIndex);
+            }
+
+            AZStd::tuple<ArgumentOf<Args>...> arguments;
+            int badArgument = 0;
+            if (!((AZStd::get<Indices>(arguments).Read(lua, aznumeric_cast<int>(Indices) + firstIndex + 1) || (badArgument = aznumeric_cast<int>(Indices) + firstIndex + 1, false)) && ...))
+            {
+                return ReportArgumentError(lua, "InterpretedThunk", badArgument);
+            }
+
+            return CallAndPushResult<Result>(lua, [&]() -> Result { return (self.Get().*t_function)(AZStd::get<Indices>(arguments).Get()...); });
+        }
+
+        static AZStd::vector<AZ::Uuid> GetArgumentTypes()
+        {
+            return { GetTypeId<Class>(), GetTypeId<Args>()... };
+        }
+    };
+
+    template<auto t_function, typename Result, typename Class, typename... Args>
+    struct Thunk<t_function, Result(Class::*)(Args...)>
+        : MemberThunk<t_function, Result, Class, Args...>
+    {};
+
+    template<auto t_function, typename Result, typename Class, typename... Args>
+    struct Thunk<t_function, Result(Class::*)(Args...) const>
+        : MemberThunk<t_function, Result, Class, Args...>
+    {};
+
+    template<typename>
+    struct ResultOf;
+
+    template<typename Result, typename... Args>
+    struct ResultOf<Result(*)(Args...)> { using Type = Result; };
+
+    template<typename Result, typename Class, typename... Args>
+    struct ResultOf<Result(Class::*)(Args...)> { using Type = Result; };
+
+    template<typename Result, typename Class, typename... Args>
+    struct ResultOf<Result(Class::*)(Args...) const> { using Type = Result; };
+
+    using ThunksByName = AZStd::unordered_map<AZStd::string, InterpretedThunk>;
+
+    template<auto t_function>
+    void AddThunk(ThunksByName& thunks, const char* className, const char* methodName)
+    {
+        InterpretedThunk thunk;
+        thunk.m_name = AZStd::string::format("%s.%s", className, methodName);
+        thunk.m_globalName = AZStd::string::format("%s%s_%s", ScriptCanvas::Grammar::k_InterpretedThunkPrefix, className, methodName);
+        thunk.m_trackedGlobalName = AZStd::string::format("%s%s_%s", ScriptCanvas::Grammar::k_InterpretedTrackedThunkPrefix, className, methodName);
+        thunk.m_function = &Thunk<t_function>::Call;
+        thunk.m_trackedFunction = &Thunk<t_function>::CallTracked;
+        thunk.m_argumentTypes = Thunk<t_function>::GetArgumentTypes();
+        thunk.m_resultType = GetTypeId<typename ResultOf<decltype(t_function)>::Type>();
+        thunks.emplace(thunk.m_name, AZStd::move(thunk));
+    }
+
+    // the arithmetic the vector classes reflect under the same names
+    template<typename VectorType>
+    void AddVectorThunks(ThunksByName& thunks, const char* className)
+    {
+        AddThunk<static_cast<VectorType(VectorType::*)(const VectorType&) const>(&VectorType::operator+)>(thunks, className, "Add");
+        AddThunk<static_cast<VectorType(VectorType::*)(const VectorType&) const>(&VectorType::operator-)>(thunks, className, "Subtract");
+        AddThunk<static_cast<VectorType(VectorType::*)(float) const>(&VectorType::operator*)>(thunks, className, "MultiplyFloat");
+        AddThunk<static_cast<VectorType(VectorType::*)(float) const>(&VectorType::operator/)>(thunks, className, "DivideFloat");
+        AddThunk<&VectorType::Dot>(thunks, className, "Dot");
+        AddThunk<&VectorType::GetLength>(thunks, className, "GetLength");
+        AddThunk<&VectorType::GetLengthSq>(thunks, className, "GetLengthSq");
+        AddThunk<&VectorType::GetNormalized>(thunks, className, "GetNormalized");
+    }
+
+    // Thunks are only provided for methods that are called often enough, per tick, for the generic call to be noticeable.
+    // The registry is built once and never modified, so that every Lua context binds the same thunks the graphs were
+    // translated against.
+    const ThunksByName& GetThunks()
+    {
+        static const ThunksByName s_thunks = []()
+        {
+            ThunksByName thunks;
+            AddVectorThunks<AZ::Vector2>(thunks, "Vector2");
+            AddVectorThunks<AZ::Vector3>(thunks, "Vector3");
+            AddVectorThunks<AZ::Vector4>(thunks, "Vector4");
+
+            AddThunk<&AZ::Vector2::GetDistance>(thunks, "Vector2", "GetDistance");
+            AddThunk<&AZ::Vector2::GetDistanceSq>(thunks, "Vector2", "GetDistanceSq");
+            AddThunk<&AZ::Vector3::Cross>(thunks, "Vector3", "Cross");
+            AddThunk<&AZ::Vector3::GetDistance>(thunks, "Vector3", "GetDistance");
+            AddThunk<&AZ::Vector3::GetDistanceSq>(thunks, "Vector3", "GetDistanceSq");
+
+            AddThunk<&AZ::Quaternion::Dot>(thunks, "Quaternion", "Dot");
+            AddThunk<&AZ::Quaternion::GetConjugate>(thunks, "Quaternion", "GetConjugate");
+            AddThunk<&AZ::Quaternion::GetLength>(thunks, "Quaternion", "GetLength");
+            AddThunk<&AZ::Quaternion::GetLengthSq>(thunks, "Quaternion", "GetLengthSq");
+            AddThunk<&AZ::Quaternion::GetNormalized>(thunks, "Quaternion", "GetNormalized");
+            return thunks;
+        }();
+
+        return s_thunks;
+    }
+}
+
+namespace ScriptCanvas
+{
+    namespace Execution
+    {
+        const InterpretedThunk* FindInterpretedThunk(AZStd::string_view className, AZStd::string_view methodName, const AZ::BehaviorMethod& method)
+        {
+            using namespace ExecutionInterpretedThunksCpp;
+
+            const ThunksByName& thunks = GetThunks();
+            auto iter = thunks.find(AZStd::string::format("%.*s.%.*s", aznumeric_cast<int>(className.size()), className.data()
+                , aznumeric_cast<int>(methodName.size()), methodName.data()));
+            if (iter == thunks.end())
+            {
+                return nullptr;
+            }
+
+            const InterpretedThunk& thunk = iter->second;
+
+            if (method.GetNumArguments() != thunk.m_argumentTypes.size())
+            {
+                return nullptr;
+            }
+
+            for (size_t index = 0; index < thunk.m_argumentTypes.size(); ++index)
+            {
+                const AZ::BehaviorParameter* argument = method.GetArgument(index);
+                if (!argument || argument->m_typeId != thunk.m_argumentTypes[index])
+                {
+                    return nullptr;
+                }
+            }
+
+            if (method.HasResult() != !thunk.m_resultType.IsNull()
+                || (method.HasResult() && method.GetResult()->m_typeId != thunk.m_resultType))
+            {
+                return nullptr;
+            }
+
+            return &thunk;
+        }
+
+        void RegisterInterpretedThunks(lua_State* lua)
+        {
+            for (const auto& iter : ExecutionInterpretedThunksCpp::GetThunks())
+            {
+                lua_register(lua, iter.second.m_globalName.c_str(), iter.second.m_function);
+                lua_register(lua, iter.second.m_trackedGlobalName.c_str(), iter.second.m_trackedFunction);
+            }
+
+            lua_register(lua, Grammar::k_InterpretedTrackedCallName, &ExecutionInterpretedThunksCpp::TrackedCall);
+        }
+
+#if defined(SCRIPT_CANVAS_PERFORMANCE_TRACKING_ENABLED)
+        void CollectInterpretedThunkReports(PerformanceReportByNode& reports)
+        {
+            using namespace ExecutionInterpretedThunksCpp;
+
+            AZStd::vector<AZStd::shared_ptr<ThreadCounters>> threads;
+            {
+                ThreadCountersRegistry& registry = GetThreadCountersRegistry();
+                AZStd::lock_guard<AZStd::mutex> lock(registry.m_mutex);
+                threads = registry.m_threads;
+                // a thread that exited released its reference, only the registry and the copy above still hold its counters
+                AZStd::erase_if(registry.m_threads, [](const AZStd::shared_ptr<ThreadCounters>& threadCounters) { return threadCounters.use_count() == 2; });
+            }
+
+            const AZStd::sys_time_t ticksPerMicrosecond = AZStd::max<AZStd::sys_time_t>(AZStd::GetTimeTicksPerSecond() / 1000000, 1);
+            for (const AZStd::shared_ptr<ThreadCounters>& threadCounters : threads)
+            {
+                AZStd::lock_guard<AZStd::mutex> lock(threadCounters->m_mutex);
+                for (auto& iter : threadCounters->m_counters)
+                {
+                    if (iter.second.m_callCount == 0)
+                    {
+                        continue;
+                    }
+
+                    PerformanceNodeReport report;
+                    report.callCount = iter.second.m_callCount;
+                    report.executionTime = aznumeric_cast<AZStd::sys_time_t>(iter.second.m_executionTimeTicks) / ticksPerMicrosecond;
+                    reports[iter.first] += report;
+                    iter.second = Counters();
+                }
+            }
+        }
+#endif
+    }
+}
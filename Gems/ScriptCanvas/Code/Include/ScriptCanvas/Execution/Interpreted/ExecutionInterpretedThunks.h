@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/Math/Uuid.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/string/string.h>
+#include <ScriptCanvas/Execution/ExecutionBus.h>
+
+struct lua_State;
+
+namespace AZ
+{
+    class BehaviorMethod;
+}
+
+namespace ScriptCanvas
+{
+    namespace Execution
+    {
+        // A thunk calls one reflected method directly from Lua. It is instantiated from the C++ signature of the method, so
+        // it reads the arguments straight off of the Lua stack into their native types and pushes the result, instead of
+        // going through BehaviorMethod::Call with BehaviorValueParameter arrays and per call conversions.
+        //
+        // Thunks are bound into every Lua context by RegisterAPI, and graphs call them in place of the method when they
+        // are translated, if the signature of the thunk matches the reflected method.
+        struct InterpretedThunk
+        {
+            // Class.Method
+            AZStd::string m_name;
+            // the global the thunk is registered under in Lua
+            AZStd::string m_globalName;
+            int(*m_function)(lua_State*) = nullptr;
+            // the global of the thunk the performance configuration calls, which takes the id of the calling node first
+            // and counts the calls of each node
+            AZStd::string m_trackedGlobalName;
+            int(*m_trackedFunction)(lua_State*) = nullptr;
+            // for member methods the first argument is the class
+            AZStd::vector<AZ::Uuid> m_argumentTypes;
+            // null for methods that return nothing
+            AZ::Uuid m_resultType = AZ::Uuid::CreateNull();
+        };
+
+        // Returns the thunk for the method, or nullptr if there is none or its signature does not match the reflected one.
+        const InterpretedThunk* FindInterpretedThunk(AZStd::string_view className, AZStd::string_view methodName, const AZ::BehaviorMethod& method);
+
+        // Registers the thunks, and the tracked call global through which the performance configuration calls the methods
+        // without a thunk, so that every method call of a graph is counted for its node.
+        void RegisterInterpretedThunks(lua_State* lua);
+
+#if defined(SCRIPT_CANVAS_PERFORMANCE_TRACKING_ENABLED)
+        // Adds the calls each node made through the tracked thunks and the tracked call since the last collection to the reports,
+        // and restarts the counts.
+        void CollectInterpretedThunkReports(PerformanceReportByNode& reports);
+#endif
+    }
+}
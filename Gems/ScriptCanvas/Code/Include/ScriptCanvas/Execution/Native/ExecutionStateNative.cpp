@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include "ExecutionStateNative.h"
+
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <ScriptCanvas/Asset/RuntimeAsset.h>
+#include <ScriptCanvas/Execution/NativeHostDefinitions.h>
+#include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
+
+namespace ScriptCanvas
+{
+    AZStd::string ExecutionStateNativeOnGraphStart::GetRegisteredName(const AZ::Data::AssetId& assetId)
+    {
+        return assetId.m_guid.ToString<AZStd::string>();
+    }
+
+    bool ExecutionStateNativeOnGraphStart::IsAvailable(const ExecutionStateConfig& config)
+    {
+        return IsAvailable(config.asset.GetId(), config.runtimeData.m_nativeFingerprint);
+    }
+
+    bool ExecutionStateNativeOnGraphStart::IsAvailable(const AZ::Data::AssetId& assetId, AZ::u32 fingerprint)
+    {
+        if (!Grammar::g_executeNativeGraphs)
+        {
+            return false;
+        }
+
+        const AZStd::string registeredName = GetRegisteredName(assetId);
+        AZ::u32 registeredFingerprint = 0;
+        if (!GetNativeGraphStartFingerprint(registeredName, registeredFingerprint))
+        {
+            return false;
+        }
+
+        if (registeredFingerprint != fingerprint)
+        {
+            static AZStd::mutex s_reportedMutex;
+            static AZStd::unordered_set<AZStd::string> s_reported;
+
+            AZStd::lock_guard<AZStd::mutex> lock(s_reportedMutex);
+            if (s_reported.insert(registeredName).second)
+            {
+                AZ_Warning("ScriptCanvas", false, "The native C++ registered for graph %s was generated from another version of the graph"
+                    " (fingerprint 0x%08x, the built graph is 0x%08x), the graph executes interpreted. Translate the graph again with"
+                    " g_translateToNative and rebuild the gem that registers it.", registeredName.c_str(), registeredFingerprint, fingerprint);
+            }
+
+            return false;
+        }
+
+        return true;
+    }
+
+    ExecutionStateNativeOnGraphStart::ExecutionStateNativeOnGraphStart(const ExecutionStateConfig& config)
+        : ExecutionState(config)
+        , m_registeredName(GetRegisteredName(config.asset.GetId()))
+    {}
+
+    void ExecutionStateNativeOnGraphStart::Execute()
+    {
+        if (!CallNativeGraphStart(m_registeredName, RuntimeContext(GetScriptCanvasId())))
+        {
+            AZ_Error("ScriptCanvas", false, "Native start function of graph %s was unregistered after the graph was created", m_registeredName.c_str());
+        }
+    }
+
+    ExecutionMode ExecutionStateNativeOnGraphStart::GetExecutionMode() const
+    {
+        return ExecutionMode::Native;
+    }
+
+    void ExecutionStateNativeOnGraphStart::Initialize()
+    {}
+
+    void ExecutionStateNativeOnGraphStart::StopExecution()
+    {}
+
+    void ExecutionStateNativeOnGraphStart::Reflect(AZ::ReflectContext* reflectContext)
+    {
+        if (auto behaviorContext = azrtti_cast<AZ::BehaviorContext*>(reflectContext))
+        {
+            behaviorContext->Class<ExecutionStateNativeOnGraphStart>()
+                ;
+        }
+    }
+}
@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#pragma once
+
+#include <AzCore/std/string/string.h>
+#include <ScriptCanvas/Execution/ExecutionState.h>
+
+namespace ScriptCanvas
+{
+    //! Executes a pure on graph start graph through the C++ translation of it that a gem registered with
+    //! RegisterNativeGraphStart, under the string of the graph source asset guid. The registration carries the fingerprint of
+    //! the graph the C++ was generated from, when it doesn't match the built graph the graph executes interpreted.
+    class ExecutionStateNativeOnGraphStart
+        : public ExecutionState
+    {
+    public:
+        AZ_RTTI(ExecutionStateNativeOnGraphStart, "{5B0A3F4E-7C21-4D6B-9E8A-2F1C6D3B8A47}", ExecutionState);
+        AZ_CLASS_ALLOCATOR(ExecutionStateNativeOnGraphStart, AZ::SystemAllocator, 0);
+
+        static void Reflect(AZ::ReflectContext* reflectContext);
+
+        //! Returns the name a graph's native start function is registered under.
+        static AZStd::string GetRegisteredName(const AZ::Data::AssetId& assetId);
+
+        //! Returns true if the graph can execute natively.
+        static bool IsAvailable(const ExecutionStateConfig& config);
+
+        //! Returns true if native execution is enabled, and a start function generated from the graph version with the
+        //! fingerprint is registered for the asset. Warns once per asset when the registered function is out of date.
+        static bool IsAvailable(const AZ::Data::AssetId& assetId, AZ::u32 fingerprint);
+
+        ExecutionStateNativeOnGraphStart(const ExecutionStateConfig& config);
+
+        void Execute() override;
+
+        ExecutionMode GetExecutionMode() const override;
+
+        void Initialize() override;
+
+        void StopExecution() override;
+
+    private:
+        AZStd::string m_registeredName;
+    };
+}
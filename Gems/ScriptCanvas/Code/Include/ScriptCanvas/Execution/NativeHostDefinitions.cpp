@@ -7,14 +7,37 @@
  */
 
 #include "NativeHostDefinitions.h"
+
+#include <AzCore/Component/ComponentApplicationBus.h>
 #include <AzCore/std/containers/unordered_map.h>
+#include <AzCore/std/parallel/lock.h>
+#include <AzCore/std/parallel/mutex.h>
+#include <AzCore/std/string/string.h>
 
 namespace NativeHostDefinitionsCPP
 {
     using namespace ScriptCanvas;
 
-    using FunctionMap = AZStd::unordered_map<AZStd::string, GraphStartFunction>;
-    FunctionMap s_functionMap;
+    struct RegisteredGraphStart
+    {
+        GraphStartFunction m_function = nullptr;
+        AZ::u32 m_fingerprint = 0;
+    };
+
+    using FunctionMap = AZStd::unordered_map<AZStd::string, RegisteredGraphStart>;
+
+    // graphs register from gem modules, which may happen before or after the statics of this module are initialized
+    FunctionMap& GetFunctionMap()
+    {
+        static FunctionMap s_functionMap;
+        return s_functionMap;
+    }
+
+    AZStd::mutex& GetFunctionMapMutex()
+    {
+        static AZStd::mutex s_functionMapMutex;
+        return s_functionMapMutex;
+    }
 }
 
 namespace ScriptCanvas
@@ -23,24 +46,61 @@ namespace ScriptCanvas
     {
         using namespace NativeHostDefinitionsCPP;
 
-        auto iter = s_functionMap.find(name);
-        if (iter != s_functionMap.end())
+        GraphStartFunction function = nullptr;
+        {
+            AZStd::lock_guard<AZStd::mutex> lock(GetFunctionMapMutex());
+            auto& functionMap = GetFunctionMap();
+            auto iter = functionMap.find(name);
+            if (iter != functionMap.end())
+            {
+                function = iter->second.m_function;
+            }
+        }
+
+        if (function)
         {
-            iter->second(context);
+            function(context);
             return true;
         }
 
         return false;
     }
 
-    bool RegisterNativeGraphStart(AZStd::string_view name, GraphStartFunction function)
+    bool IsNativeGraphStartRegistered(AZStd::string_view name)
+    {
+        using namespace NativeHostDefinitionsCPP;
+
+        AZStd::lock_guard<AZStd::mutex> lock(GetFunctionMapMutex());
+        auto& functionMap = GetFunctionMap();
+        return functionMap.find(name) != functionMap.end();
+    }
+
+    bool GetNativeGraphStartFingerprint(AZStd::string_view name, AZ::u32& fingerprint)
+    {
+        using namespace NativeHostDefinitionsCPP;
+
+        AZStd::lock_guard<AZStd::mutex> lock(GetFunctionMapMutex());
+        auto& functionMap = GetFunctionMap();
+        auto iter = functionMap.find(name);
+        if (iter != functionMap.end())
+        {
+            fingerprint = iter->second.m_fingerprint;
+            return true;
+        }
+
+        return false;
+    }
+
+    bool RegisterNativeGraphStart(AZStd::string_view name, GraphStartFunction function, AZ::u32 fingerprint)
     {
         using namespace NativeHostDefinitionsCPP;
         
-        auto iter = s_functionMap.find(name);
-        if (iter == s_functionMap.end())
+        AZStd::lock_guard<AZStd::mutex> lock(GetFunctionMapMutex());
+        auto& functionMap = GetFunctionMap();
+        auto iter = functionMap.find(name);
+        if (iter == functionMap.end())
         {
-            s_functionMap.insert({ name, function });
+            functionMap.insert({ name, RegisteredGraphStart{ function, fingerprint } });
             return true;
         }
         
@@ -52,14 +112,59 @@ namespace ScriptCanvas
     {
         using namespace NativeHostDefinitionsCPP;
         
-        auto iter = s_functionMap.find(name);
-        if (iter != s_functionMap.end())
+        AZStd::lock_guard<AZStd::mutex> lock(GetFunctionMapMutex());
+        auto& functionMap = GetFunctionMap();
+        auto iter = functionMap.find(name);
+        if (iter != functionMap.end())
         {
-            s_functionMap.erase(iter);
+            functionMap.erase(iter);
             return true;
         }
 
         return false;
     }
 
+    NativeMethod::NativeMethod(const char* className, const char* methodName)
+        : m_className(className)
+        , m_methodName(methodName)
+    {}
+
+    const AZ::BehaviorMethod* NativeMethod::Get() const
+    {
+        if (!m_isResolved.load(AZStd::memory_order_acquire))
+        {
+            // a race here only means the method is looked up more than once
+            m_method.store(Find(), AZStd::memory_order_relaxed);
+            m_isResolved.store(true, AZStd::memory_order_release);
+            AZ_Error("ScriptCanvas", m_method.load(AZStd::memory_order_relaxed), "Native graph method %s%s%s is not in the BehaviorContext"
+                , m_className, m_className[0] ? "::" : "", m_methodName);
+        }
+
+        return m_method.load(AZStd::memory_order_relaxed);
+    }
+
+    const AZ::BehaviorMethod* NativeMethod::Find() const
+    {
+        AZ::BehaviorContext* behaviorContext = nullptr;
+        AZ::ComponentApplicationBus::BroadcastResult(behaviorContext, &AZ::ComponentApplicationRequests::GetBehaviorContext);
+        if (!behaviorContext)
+        {
+            return nullptr;
+        }
+
+        if (m_className[0] == '\0')
+        {
+            auto methodIter = behaviorContext->m_methods.find(m_methodName);
+            return methodIter != behaviorContext->m_methods.end() ? methodIter->second : nullptr;
+        }
+
+        auto classIter = behaviorContext->m_classes.find(m_className);
+        if (classIter == behaviorContext->m_classes.end())
+        {
+            return nullptr;
+        }
+
+        auto methodIter = classIter->second->m_methods.find(m_methodName);
+        return methodIter != classIter->second->m_methods.end() ? methodIter->second : nullptr;
+    }
 }
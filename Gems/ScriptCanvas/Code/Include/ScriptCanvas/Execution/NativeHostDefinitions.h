@@ -6,8 +6,14 @@
  *
  */
 
+#pragma once
+
 #include "NativeHostDeclarations.h"
 
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/parallel/atomic.h>
+#include <AzCore/std/string/string_view.h>
+
 namespace ScriptCanvas
 {
     typedef void (*GraphStartFunction)(const RuntimeContext&);
@@ -15,10 +21,154 @@ namespace ScriptCanvas
     using GraphStartFunction = void(*)(const RuntimeContext&);
 
     bool CallNativeGraphStart(AZStd::string_view name, const RuntimeContext& context);
+
+    bool IsNativeGraphStartRegistered(AZStd::string_view name);
+
+    //! Returns false if name isn't registered. The fingerprint identifies the version of the graph the function was generated from.
+    bool GetNativeGraphStartFingerprint(AZStd::string_view name, AZ::u32& fingerprint);
     
-    bool RegisterNativeGraphStart(AZStd::string_view name, GraphStartFunction function);
+    bool RegisterNativeGraphStart(AZStd::string_view name, GraphStartFunction function, AZ::u32 fingerprint = 0);
     
     // this may never have to be necessary
     bool UnregisterNativeGraphStart(AZStd::string_view name);
 
+    //! A BehaviorContext method called by the C++ generated from a graph. The method is looked up once, on the first call,
+    //! after that every call goes straight to BehaviorMethod::Invoke, with no script marshaling in between.
+    //! The generated code passes arguments of the exact types of the method parameters, BehaviorMethod doesn't convert them.
+    class NativeMethod
+    {
+    public:
+        //! className is empty for free methods.
+        NativeMethod(const char* className, const char* methodName);
+
+        //! Returns nullptr, and reports an error once, if the method isn't in the BehaviorContext.
+        const AZ::BehaviorMethod* Get() const;
+
+        template<typename... Args>
+        bool Invoke(Args&&... args) const
+        {
+            const AZ::BehaviorMethod* method = Get();
+            return method && method->Invoke(AZStd::forward<Args>(args)...);
+        }
+
+        template<typename R, typename... Args>
+        bool InvokeResult(R& result, Args&&... args) const
+        {
+            const AZ::BehaviorMethod* method = Get();
+            return method && method->InvokeResult(result, AZStd::forward<Args>(args)...);
+        }
+
+    private:
+        const AZ::BehaviorMethod* Find() const;
+
+        const char* m_className;
+        const char* m_methodName;
+        mutable AZStd::atomic<const AZ::BehaviorMethod*> m_method{ nullptr };
+        mutable AZStd::atomic_bool m_isResolved{ false };
+    };
+
+    namespace Internal
+    {
+        template<typename BehaviorMethodType>
+        class NativeFunctionBase
+        {
+        public:
+            NativeFunctionBase(const char* className, const char* methodName)
+                : m_method(className, methodName)
+            {}
+
+            //! Returns nullptr if the method isn't in the BehaviorContext, or wasn't reflected with the signature of the function.
+            const BehaviorMethodType* Get() const
+            {
+                if (!m_isResolved.load(AZStd::memory_order_acquire))
+                {
+                    // a race here only means the method is looked up more than once
+                    m_function.store(dynamic_cast<const BehaviorMethodType*>(m_method.Get()), AZStd::memory_order_relaxed);
+                    m_isResolved.store(true, AZStd::memory_order_release);
+                }
+
+                return m_function.load(AZStd::memory_order_relaxed);
+            }
+
+        protected:
+            NativeMethod m_method;
+
+        private:
+            mutable AZStd::atomic<const BehaviorMethodType*> m_function{ nullptr };
+            mutable AZStd::atomic_bool m_isResolved{ false };
+        };
+    }
+
+    //! A BehaviorContext method the C++ generated from a graph calls through the function pointer the BehaviorMethod holds,
+    //! which skips BehaviorMethod::Invoke and its argument checks. FunctionPointer is the type the translator spells from the
+    //! method parameters. If the method was reflected with another type, for example with a non const reference parameter
+    //! that the parameter traits don't tell apart from a const one, calls go through NativeMethod instead.
+    template<typename FunctionPointer>
+    class NativeFunction;
+
+    template<typename R, typename... Args>
+    class NativeFunction<R(*)(Args...)>
+        : public Internal::NativeFunctionBase<AZ::Internal::BehaviorMethodImpl<R(Args...)>>
+    {
+    public:
+        using Internal::NativeFunctionBase<AZ::Internal::BehaviorMethodImpl<R(Args...)>>::NativeFunctionBase;
+
+        template<typename... CallArgs>
+        bool Invoke(CallArgs&&... args) const
+        {
+            if (auto function = this->Get())
+            {
+                function->m_functionPtr(AZStd::forward<CallArgs>(args)...);
+                return true;
+            }
+
+            return this->m_method.Invoke(AZStd::forward<CallArgs>(args)...);
+        }
+
+        template<typename Result, typename... CallArgs>
+        bool InvokeResult(Result& result, CallArgs&&... args) const
+        {
+            if (auto function = this->Get())
+            {
+                result = function->m_functionPtr(AZStd::forward<CallArgs>(args)...);
+                return true;
+            }
+
+            return this->m_method.InvokeResult(result, AZStd::forward<CallArgs>(args)...);
+        }
+    };
+
+    //! Const member functions are reflected as non const ones, the first argument is the object the function is called on.
+    //! Like BehaviorMethod::Invoke, the function is called on the object whether or not the object is const.
+    template<typename R, typename C, typename... Args>
+    class NativeFunction<R(C::*)(Args...)>
+        : public Internal::NativeFunctionBase<AZ::Internal::BehaviorMethodImpl<R(C::*)(Args...)>>
+    {
+    public:
+        using Internal::NativeFunctionBase<AZ::Internal::BehaviorMethodImpl<R(C::*)(Args...)>>::NativeFunctionBase;
+
+        template<typename Object, typename... CallArgs>
+        bool Invoke(Object&& object, CallArgs&&... args) const
+        {
+            if (auto function = this->Get())
+            {
+                (const_cast<C&>(static_cast<const C&>(object)).*(function->m_functionPtr))(AZStd::forward<CallArgs>(args)...);
+                return true;
+            }
+
+            return this->m_method.Invoke(AZStd::forward<Object>(object), AZStd::forward<CallArgs>(args)...);
+        }
+
+        template<typename Result, typename Object, typename... CallArgs>
+        bool InvokeResult(Result& result, Object&& object, CallArgs&&... args) const
+        {
+            if (auto function = this->Get())
+            {
+                result = (const_cast<C&>(static_cast<const C&>(object)).*(function->m_functionPtr))(AZStd::forward<CallArgs>(args)...);
+                return true;
+            }
+
+            return this->m_method.InvokeResult(result, AZStd::forward<Object>(object), AZStd::forward<CallArgs>(args)...);
+        }
+    };
 }
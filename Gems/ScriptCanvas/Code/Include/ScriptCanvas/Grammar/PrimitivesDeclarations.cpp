@@ -13,10 +13,13 @@ namespace ScriptCanvas
     namespace Grammar
     {
         AZ_CVAR(bool, g_disableParseOnGraphValidation, false, {}, AZ::ConsoleFunctorFlags::Null, "In case parsing the graph is interfering with opening a graph, disable parsing on validation");
+        AZ_CVAR(bool, g_executeNativeGraphs, true, {}, AZ::ConsoleFunctorFlags::Null, "Execute graphs with native C++ registered by a gem in place of their interpreted Lua.");
         AZ_CVAR(bool, g_printAbstractCodeModel, true, {}, AZ::ConsoleFunctorFlags::Null, "Print out the Abstract Code Model at the end of parsing for debug purposes.");
         AZ_CVAR(bool, g_printAbstractCodeModelAtPrefabTime, false, {}, AZ::ConsoleFunctorFlags::Null, "Print out the Abstract Code Model at the end of parsing (at prefab time) for debug purposes.");
         AZ_CVAR(bool, g_saveRawTranslationOuputToFile, true, {}, AZ::ConsoleFunctorFlags::Null, "Save out the raw result of translation for debug purposes.");
         AZ_CVAR(bool, g_saveRawTranslationOuputToFileAtPrefabTime, false, {}, AZ::ConsoleFunctorFlags::Null, "Save out the raw result of translation (at prefab time) for debug purposes.");
+        AZ_CVAR(bool, g_translateToNative, false, {}, AZ::ConsoleFunctorFlags::Null, "Also translate graphs to C++ when building them, the .h and .cpp are saved to @usercache@/ScriptCanvasNativeOutput/ to be built into a gem.");
+        AZ_CVAR(bool, g_useInterpretedThunks, true, {}, AZ::ConsoleFunctorFlags::Null, "Translate calls to reflected methods that have a typed thunk into calls to the thunk, instead of calls through the BehaviorContext.");
 
         SettingsCache::SettingsCache()
         {
@@ -105,6 +105,9 @@ namespace ScriptCanvas
         constexpr const char* k_InitializeExecutionOutByRequiredCountName = "InitializeExecutionOutByRequiredCount";
         constexpr const char* k_InterpretedConfigurationPerformance = "SCRIPT_CANVAS_GLOBAL_PERFORMANCE";
         constexpr const char* k_InterpretedConfigurationRelease = "SCRIPT_CANVAS_GLOBAL_RELEASE";
+        constexpr const char* k_InterpretedThunkPrefix = "SCRIPT_CANVAS_THUNK_";
+        constexpr const char* k_InterpretedTrackedThunkPrefix = "SCRIPT_CANVAS_TRACKED_THUNK_";
+        constexpr const char* k_InterpretedTrackedCallName = "SCRIPT_CANVAS_TRACKED_CALL";
 
         constexpr const char* k_NodeableCallInterpretedOut = "ExecutionOut";
         constexpr const char* k_NodeableUserBaseClassName = "Nodeable";
@@ -243,10 +246,13 @@ namespace ScriptCanvas
         using VariableWriteHandlingByVariable = AZStd::unordered_map<VariableConstPtr, VariableWriteHandlingSet>;
 
         AZ_CVAR_EXTERNED(bool, g_disableParseOnGraphValidation);
+        AZ_CVAR_EXTERNED(bool, g_executeNativeGraphs);
         AZ_CVAR_EXTERNED(bool, g_printAbstractCodeModel);
         AZ_CVAR_EXTERNED(bool, g_printAbstractCodeModelAtPrefabTime);
         AZ_CVAR_EXTERNED(bool, g_saveRawTranslationOuputToFile);
         AZ_CVAR_EXTERNED(bool, g_saveRawTranslationOuputToFileAtPrefabTime);
+        AZ_CVAR_EXTERNED(bool, g_translateToNative);
+        AZ_CVAR_EXTERNED(bool, g_useInterpretedThunks);
 
         class SettingsCache
         {
@@ -62,6 +62,10 @@ namespace ScriptCanvas
         constexpr const char* MultipleFunctionCallFromSingleSlotUnused = "Multiple function slot left an input slot unused.";
         constexpr const char* MultipleSimulaneousInputValues = "Multiple values routed to the same single input with no way to discern which to take.";
         constexpr const char* MultipleStartNodes = "Multiple Start nodes in a single graph. Only one is allowed.";
+        constexpr const char* NativeUnsupportedArgument = "Native translation can't pass this input to the method, the graph will execute interpreted.";
+        constexpr const char* NativeUnsupportedGraph = "Native translation only supports graphs made of functions, without event handlers, nodeables or member variables, the graph will execute interpreted.";
+        constexpr const char* NativeUnsupportedNode = "Native translation doesn't support this node, the graph will execute interpreted.";
+        constexpr const char* NativeUnsupportedType = "Native translation doesn't support this data type, the graph will execute interpreted.";
         constexpr const char* NoChildrenAfterRoot = "No children after parsing function root";
         constexpr const char* NoChildrenInExtraction = "No children found in property extraction node";
         constexpr const char* NoDataPresent = "Could not construct from graph, no graph data was present";
@@ -8,8 +8,358 @@
 
 #include "GraphToCPlusPlus.h"
 
+#include <AzCore/Math/Crc.h>
+#include <AzCore/std/sort.h>
+#include <ScriptCanvas/Core/Node.h>
+#include <ScriptCanvas/Data/Data.h>
+#include <ScriptCanvas/Debugger/ValidationEvents/ParsingValidation/ParsingValidations.h>
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
+#include <ScriptCanvas/Grammar/ParsingUtilities.h>
 #include <ScriptCanvas/Grammar/Primitives.h>
+#include <ScriptCanvas/Grammar/PrimitivesExecution.h>
+#include <ScriptCanvas/Libraries/Core/Method.h>
+#include <ScriptCanvas/Results/ErrorText.h>
+
+#include <cmath>
+
+namespace GraphToCPlusPlusCpp
+{
+    using namespace ScriptCanvas;
+
+    // names that can't be used as is in the generated code, either C++ keywords or names the generated code relies on
+    const char* k_reservedNames[] =
+    {
+        "AZ", "AZStd", "Data", "Register", "ScriptCanvas", "Unregister", "alignas", "alignof", "and", "asm", "auto", "bool",
+        "break", "case", "catch", "char", "class", "const", "constexpr", "const_cast", "context", "continue", "decltype",
+        "default", "delete", "do", "double", "dynamic_cast", "else", "enum", "explicit", "export", "extern", "false", "float",
+        "for", "friend", "goto", "if", "inline", "int", "long", "mutable", "namespace", "new", "noexcept", "not", "nullptr",
+        "operator", "or", "private", "protected", "public", "register", "reinterpret_cast", "return", "short", "signed",
+        "sizeof", "static", "static_assert", "static_cast", "struct", "switch", "template", "this", "throw", "true", "try",
+        "typedef", "typeid", "typename", "union", "unsigned", "using", "virtual", "void", "volatile", "while", "xor",
+    };
+
+    AZStd::string ToNativeName(AZStd::string_view name)
+    {
+        AZStd::string nativeName = Grammar::ToIdentifier(name);
+
+        for (const char* reservedName : k_reservedNames)
+        {
+            if (nativeName == reservedName)
+            {
+                nativeName.append("_");
+                break;
+            }
+        }
+
+        return nativeName;
+    }
+
+    const char* GetNativeTypeName(const Data::Type& type)
+    {
+        switch (type.GetType())
+        {
+        case Data::eType::AABB:
+            return "Data::AABBType";
+        case Data::eType::Boolean:
+            return "Data::BooleanType";
+        case Data::eType::Color:
+            return "Data::ColorType";
+        case Data::eType::CRC:
+            return "Data::CRCType";
+        case Data::eType::EntityID:
+            return "Data::EntityIDType";
+        case Data::eType::Matrix3x3:
+            return "Data::Matrix3x3Type";
+        case Data::eType::Matrix4x4:
+            return "Data::Matrix4x4Type";
+        case Data::eType::Number:
+            return "Data::NumberType";
+        case Data::eType::OBB:
+            return "Data::OBBType";
+        case Data::eType::Plane:
+            return "Data::PlaneType";
+        case Data::eType::Quaternion:
+            return "Data::QuaternionType";
+        case Data::eType::String:
+            return "Data::StringType";
+        case Data::eType::Transform:
+            return "Data::TransformType";
+        case Data::eType::Vector2:
+            return "Data::Vector2Type";
+        case Data::eType::Vector3:
+            return "Data::Vector3Type";
+        case Data::eType::Vector4:
+            return "Data::Vector4Type";
+        default:
+            return nullptr;
+        }
+    }
+
+    // BehaviorMethod doesn't convert arguments, so a graph Number passed to a method of another arithmetic type is cast
+    const char* GetNativeArithmeticTypeName(const AZ::Uuid& typeId)
+    {
+        if (typeId == azrtti_typeid<float>())
+        {
+            return "float";
+        }
+        else if (typeId == azrtti_typeid<double>())
+        {
+            return "double";
+        }
+        else if (typeId == azrtti_typeid<AZ::s8>())
+        {
+            return "AZ::s8";
+        }
+        else if (typeId == azrtti_typeid<AZ::u8>())
+        {
+            return "AZ::u8";
+        }
+        else if (typeId == azrtti_typeid<AZ::s16>())
+        {
+            return "AZ::s16";
+        }
+        else if (typeId == azrtti_typeid<AZ::u16>())
+        {
+            return "AZ::u16";
+        }
+        else if (typeId == azrtti_typeid<AZ::s32>())
+        {
+            return "AZ::s32";
+        }
+        else if (typeId == azrtti_typeid<AZ::u32>())
+        {
+            return "AZ::u32";
+        }
+        else if (typeId == azrtti_typeid<AZ::s64>())
+        {
+            return "AZ::s64";
+        }
+        else if (typeId == azrtti_typeid<AZ::u64>())
+        {
+            return "AZ::u64";
+        }
+
+        return nullptr;
+    }
+
+    // spells a BehaviorContext parameter type as the reflected function declares it, as far as the parameter traits tell
+    bool ToNativeParameterTypeName(const AZ::BehaviorParameter& parameter, AZStd::string& typeName)
+    {
+        if (parameter.m_traits & AZ::BehaviorParameter::TR_POINTER)
+        {
+            return false;
+        }
+
+        const char* name = GetNativeArithmeticTypeName(parameter.m_typeId);
+        if (!name)
+        {
+            name = GetNativeTypeName(Data::FromAZType(parameter.m_typeId));
+        }
+
+        if (!name)
+        {
+            return false;
+        }
+
+        // the traits don't tell a const reference from a non const one, the far more common const reference is assumed
+        typeName = (parameter.m_traits & AZ::BehaviorParameter::TR_REFERENCE) ? AZStd::string::format("const %s&", name) : AZStd::string(name);
+        return true;
+    }
+
+    // spells the type of the function pointer a BehaviorMethod holds, returns false if the parameter traits don't allow it
+    bool ToNativeFunctionPointerType(const AZ::BehaviorMethod& method, AZStd::string& functionPointerType)
+    {
+        AZStd::string resultType = "void";
+        if (method.HasResult() && !ToNativeParameterTypeName(*method.GetResult(), resultType))
+        {
+            return false;
+        }
+
+        size_t argumentIndex = 0;
+        AZStd::string classType;
+
+        if (method.IsMember())
+        {
+            const char* name = GetNativeTypeName(Data::FromAZType(method.GetArgument(0)->m_typeId));
+            if (!name)
+            {
+                return false;
+            }
+
+            classType = name;
+            ++argumentIndex;
+        }
+
+        AZStd::string argumentTypes;
+
+        for (; argumentIndex < method.GetNumArguments(); ++argumentIndex)
+        {
+            AZStd::string argumentType;
+            if (!ToNativeParameterTypeName(*method.GetArgument(argumentIndex), argumentType))
+            {
+                return false;
+            }
+
+            argumentTypes.append(argumentTypes.empty() ? "" : ", ");
+            argumentTypes.append(argumentType);
+        }
+
+        functionPointerType = classType.empty()
+            ? AZStd::string::format("%s(*)(%s)", resultType.c_str(), argumentTypes.c_str())
+            : AZStd::string::format("%s(%s::*)(%s)", resultType.c_str(), classType.c_str(), argumentTypes.c_str());
+        return true;
+    }
+
+    AZStd::string ToFloatLiteral(double value, bool isSinglePrecision)
+    {
+        AZStd::string literal = AZStd::string::format(isSinglePrecision ? "%.9g" : "%.17g", value);
+
+        if (literal.find_first_of(".e") == AZStd::string::npos)
+        {
+            literal.append(".0");
+        }
+
+        if (isSinglePrecision)
+        {
+            literal.append("f");
+        }
+
+        return literal;
+    }
+
+    AZStd::string ToStringLiteral(const AZStd::string& value)
+    {
+        AZStd::string literal("\"");
+
+        for (char character : value)
+        {
+            switch (character)
+            {
+            case '"':
+                literal.append("\\\"");
+                break;
+            case '\\':
+                literal.append("\\\\");
+                break;
+            case '\n':
+                literal.append("\\n");
+                break;
+            case '\r':
+                literal.append("\\r");
+                break;
+            case '\t':
+                literal.append("\\t");
+                break;
+            default:
+                literal.push_back(character);
+                break;
+            }
+        }
+
+        literal.push_back('"');
+        return literal;
+    }
+
+    template<typename t_Vector>
+    AZStd::string ToVectorValueString(const char* typeName, const t_Vector& vector, int elementCount)
+    {
+        AZStd::string valueString = AZStd::string::format("%s(", typeName);
+
+        for (int index = 0; index < elementCount; ++index)
+        {
+            valueString.append(index == 0 ? "" : ", ");
+            valueString.append(ToFloatLiteral(vector.GetElement(index), true));
+        }
+
+        valueString.append(")");
+        return valueString;
+    }
+
+    // returns false for values that have no literal form in the generated code
+    bool ToNativeValueString(const Datum& datum, AZStd::string& valueString)
+    {
+        const Data::Type& type = datum.GetType();
+
+        switch (type.GetType())
+        {
+        case Data::eType::Boolean:
+            valueString = *datum.GetAs<Data::BooleanType>() ? "true" : "false";
+            return true;
+
+        case Data::eType::Number:
+        {
+            const Data::NumberType number = *datum.GetAs<Data::NumberType>();
+            if (!std::isfinite(number))
+            {
+                return false;
+            }
+
+            valueString = ToFloatLiteral(number, false);
+            return true;
+        }
+
+        case Data::eType::String:
+            valueString = ToStringLiteral(*datum.GetAs<Data::StringType>());
+            return true;
+
+        case Data::eType::Vector2:
+            valueString = ToVectorValueString(GetNativeTypeName(type), *datum.GetAs<Data::Vector2Type>(), 2);
+            return true;
+
+        case Data::eType::Vector3:
+            valueString = ToVectorValueString(GetNativeTypeName(type), *datum.GetAs<Data::Vector3Type>(), 3);
+            return true;
+
+        case Data::eType::Vector4:
+            valueString = ToVectorValueString(GetNativeTypeName(type), *datum.GetAs<Data::Vector4Type>(), 4);
+            return true;
+
+        case Data::eType::Quaternion:
+            valueString = ToVectorValueString(GetNativeTypeName(type), *datum.GetAs<Data::QuaternionType>(), 4);
+            return true;
+
+        case Data::eType::Color:
+        {
+            const Data::ColorType& color = *datum.GetAs<Data::ColorType>();
+            valueString = AZStd::string::format("Data::ColorType(%s, %s, %s, %s)"
+                , ToFloatLiteral(color.GetR(), true).c_str()
+                , ToFloatLiteral(color.GetG(), true).c_str()
+                , ToFloatLiteral(color.GetB(), true).c_str()
+                , ToFloatLiteral(color.GetA(), true).c_str());
+            return true;
+        }
+
+        case Data::eType::CRC:
+            valueString = AZStd::string::format("Data::CRCType(%uu)", static_cast<AZ::u32>(*datum.GetAs<Data::CRCType>()));
+            return true;
+
+        case Data::eType::EntityID:
+            // entity ids are only meaningful at runtime, unless unset
+            if (datum.GetAs<Data::EntityIDType>()->IsValid())
+            {
+                return false;
+            }
+
+            valueString = "Data::EntityIDType()";
+            return true;
+
+        case Data::eType::Matrix3x3:
+        case Data::eType::Matrix4x4:
+        case Data::eType::Transform:
+            if (!datum.IsDefaultValue())
+            {
+                return false;
+            }
+
+            valueString = AZStd::string::format("%s::CreateIdentity()", GetNativeTypeName(type));
+            return true;
+
+        default:
+            return false;
+        }
+    }
+}
 
 namespace ScriptCanvas
 {
@@ -29,43 +379,192 @@ namespace ScriptCanvas
             return configuration;
         }
 
-        GraphToCPlusPlus::GraphToCPlusPlus(const Grammar::AbstractCodeModel& model)
-            : GraphToX(CreateCPlusPluseConfig(), model) 
+        GraphToCPlusPlus::GraphToCPlusPlus(const Grammar::AbstractCodeModel& model, AZ::u32 fingerprint)
+            : GraphToX(CreateCPlusPluseConfig(), model)
+            , m_fingerprint(fingerprint)
         {
-            WriteHeaderDotH();
-            WriteHeaderDotCPP();
-            
-            TranslateDependenciesDotH();
-            TranslateDependenciesDotCPP();
-                        
-            TranslateNamespaceOpen();
+            MarkTranslationStart();
+
+            if (IsGraphSupported())
             {
-                TranslateClassOpen();
+                WriteHeaderDotH();
+                WriteHeaderDotCPP();
+
+                TranslateDependenciesDotH();
+                TranslateDependenciesDotCPP();
+
+                TranslateNamespaceOpen();
                 {
-                    TranslateVariables();
-                    TranslateHandlers();
-                    TranslateConstruction();
-                    TranslateDestruction();
-                    TranslateStartNode();
+                    TranslateClassOpen();
+                    {
+                        TranslateFunctions();
+                        TranslateRegistration();
+                    }
+                    TranslateClassClose();
                 }
-                TranslateClassClose();
+                TranslateNamespaceClose();
+            }
+
+            MarkTranslationStop();
+        }
+
+        AZStd::string GraphToCPlusPlus::FindMethodHandle(const AZStd::string& className, const AZStd::string& methodName, const AZ::BehaviorMethod& behaviorMethod)
+        {
+            const AZStd::string key = className + "::" + methodName;
+
+            auto iter = m_methodHandles.find(key);
+            if (iter != m_methodHandles.end())
+            {
+                return iter->second;
             }
-            TranslateNamespaceClose();
+
+            AZStd::string handle = AZStd::string::format("s_method%zu_%s", m_methodHandles.size(), Grammar::ToIdentifier(methodName).c_str());
+
+            // the function the method wraps is called directly when its type can be spelled, and through the method otherwise
+            AZStd::string functionPointerType;
+            const AZStd::string handleType = GraphToCPlusPlusCpp::ToNativeFunctionPointerType(behaviorMethod, functionPointerType)
+                ? AZStd::string::format("NativeFunction<%s>", functionPointerType.c_str())
+                : AZStd::string("NativeMethod");
+
+            m_dotCPPMethods.WriteLineIndented("static const %s %s(%s, %s);"
+                , handleType.c_str()
+                , handle.c_str()
+                , GraphToCPlusPlusCpp::ToStringLiteral(className).c_str()
+                , GraphToCPlusPlusCpp::ToStringLiteral(methodName).c_str());
+            m_methodHandles.emplace(key, handle);
+            return handle;
         }
 
-        AZ::Outcome<void, AZStd::pair<AZStd::string, AZStd::string>> GraphToCPlusPlus::Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP)
+        AZStd::string GraphToCPlusPlus::GetClassName() const
         {
-            GraphToCPlusPlus translation(model);
+            return GraphToCPlusPlusCpp::ToNativeName(GetGraphName());
+        }
+
+        AZStd::string GraphToCPlusPlus::GetFunctionSignature(Grammar::ExecutionTreeConstPtr execution, bool isDefinition)
+        {
+            if (!execution->IsPure() || execution->HasExplicitUserOutCalls() || execution->GetReturnValueCount() > 1)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedNode));
+                return {};
+            }
+
+            const bool isStart = execution == m_model.GetStart();
+
+            AZStd::string signature = execution->HasReturnValues() ? GetTypeName(execution, execution->GetReturnValue(0).second->m_source) : "void";
+            signature.append(" ");
+
+            if (isDefinition)
+            {
+                signature.append(GetClassName());
+                signature.append("::");
+            }
+
+            signature.append(isStart ? AZStd::string(Grammar::k_OnGraphStartFunctionName) : GraphToCPlusPlusCpp::ToNativeName(execution->GetName()));
+            signature.append(isDefinition ? "([[maybe_unused]] const RuntimeContext& context" : "(const RuntimeContext& context");
+
+            if (!isStart && execution->GetChildrenCount() > 0)
+            {
+                for (const auto& parameter : execution->GetChild(0).m_output)
+                {
+                    signature.append(", ");
+                    signature.append(GetTypeName(execution, parameter.second->m_source));
+                    signature.append(" ");
+                    signature.append(GetVariableReference(execution, parameter.second->m_source));
+                }
+            }
+
+            signature.append(")");
+            return signature;
+        }
+
+        AZStd::string_view GraphToCPlusPlus::GetOperatorString(Grammar::ExecutionTreeConstPtr execution)
+        {
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::OperatorAddition:
+                return " + ";
+            case Grammar::Symbol::OperatorDivision:
+                return " / ";
+            case Grammar::Symbol::OperatorMultiplication:
+                return " * ";
+            case Grammar::Symbol::OperatorSubraction:
+                return " - ";
+            default:
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::UntranslatedArithmetic));
+                return "";
+            }
+        }
+
+        AZStd::string GraphToCPlusPlus::GetTypeName(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable)
+        {
+            if (const char* typeName = GraphToCPlusPlusCpp::GetNativeTypeName(variable->m_datum.GetType()))
+            {
+                return typeName;
+            }
+
+            AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedType));
+            return "void";
+        }
+
+        AZStd::string GraphToCPlusPlus::GetVariableReference(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable)
+        {
+            AZ_Assert(variable, "non valid variable");
+
+            // member variables require per entity data, which isn't supported
+            if (variable->m_isMember)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedGraph));
+            }
+
+            return GraphToCPlusPlusCpp::ToNativeName(variable->m_name);
+        }
+
+        bool GraphToCPlusPlus::IsGraphSupported()
+        {
+            const auto& runtimeInputs = m_model.GetRuntimeInputs();
+
+            if (m_model.IsPerEntityDataRequired()
+                || m_model.IsUserNodeable()
+                || !m_model.GetEBusHandlings().empty()
+                || !m_model.GetEventHandlings().empty()
+                || !m_model.GetNodeableParse().empty()
+                || !runtimeInputs.m_nodeables.empty()
+                || !runtimeInputs.m_variables.empty()
+                || !runtimeInputs.m_entityIds.empty()
+                || !runtimeInputs.m_staticVariables.empty())
+            {
+                AddError(nullptr, aznew Internal::ParseError(AZ::EntityId(), ParseErrors::NativeUnsupportedGraph));
+                return false;
+            }
+
+            return true;
+        }
+
+        AZ::u32 GraphToCPlusPlus::GetFingerprint(AZStd::string_view luaTranslation)
+        {
+            return static_cast<AZ::u32>(AZ::Crc32(luaTranslation.data(), luaTranslation.size()));
+        }
+
+        AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> GraphToCPlusPlus::Translate(const Grammar::AbstractCodeModel& model, AZ::u32 fingerprint)
+        {
+            GraphToCPlusPlus translation(model, fingerprint);
 
             if (translation.IsSuccessfull())
             {
-                dotH = AZStd::move(translation.m_dotH.MoveOutput());
-                dotCPP = AZStd::move(translation.m_dotCPP.MoveOutput());
-                return AZ::Success();
+                TargetResult dotH;
+                dotH.m_text = translation.m_dotH.MoveOutput();
+                dotH.m_duration = translation.GetTranslationDuration();
+
+                TargetResult dotCPP;
+                dotCPP.m_text = translation.m_dotCPP.MoveOutput();
+                // both files come out of the same pass, which is counted once
+                dotCPP.m_duration = 0;
+
+                return AZ::Success(AZStd::make_pair(AZStd::move(dotH), AZStd::move(dotCPP)));
             }
             else
             {
-                return AZ::Failure(AZStd::make_pair(AZStd::string(".h errors"), AZStd::string(".cpp errors")));
+                return AZ::Failure(translation.MoveErrors());
             }
         }
 
@@ -77,47 +576,242 @@ namespace ScriptCanvas
             m_dotH.WriteSpace();
             SingleLineComment(m_dotH);
             m_dotH.WriteSpace();
-            m_dotH.WriteLine("class %s", GetGraphName().data());
+            m_dotH.WriteLine("class %s", GetClassName().c_str());
         }
 
         void GraphToCPlusPlus::TranslateClassOpen()
         {
-            m_dotH.WriteIndent();
-            m_dotH.WriteLine("class %s", GetGraphName().data());
-            m_dotH.WriteIndent();
-            m_dotH.WriteLine("{");
+            m_dotH.WriteLineIndented("class %s", GetClassName().c_str());
+            m_dotH.WriteLineIndented("{");
+            m_dotH.WriteLineIndented("public:");
             m_dotH.Indent();
         }
 
-        void GraphToCPlusPlus::TranslateConstruction()
+        void GraphToCPlusPlus::TranslateDependenciesDotH()
         {
+            m_dotH.WriteLine("#include <ScriptCanvas/Data/Data.h>");
+            m_dotH.WriteLine("#include <ScriptCanvas/Execution/NativeHostDeclarations.h>");
+            m_dotH.WriteNewLine();
+        }
 
+        void GraphToCPlusPlus::TranslateDependenciesDotCPP()
+        {
+            m_dotCPP.WriteLine("#include <AzCore/Math/MathUtils.h>");
+            m_dotCPP.WriteLine("#include <ScriptCanvas/Execution/NativeHostDefinitions.h>");
+            m_dotCPP.WriteNewLine();
         }
 
-        void GraphToCPlusPlus::TranslateDependencies()
+        void GraphToCPlusPlus::TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution)
         {
-            TranslateDependenciesDotH();
-            TranslateDependenciesDotCPP();
+            if (!IsSuccessfull())
+            {
+                return;
+            }
+
+            switch (execution->GetSymbol())
+            {
+            case Grammar::Symbol::IfCondition:
+                TranslateExecutionTreeIfCondition(execution);
+                // the branches are translated in their own scopes
+                return;
+
+            case Grammar::Symbol::CompareEqual:
+            case Grammar::Symbol::CompareGreater:
+            case Grammar::Symbol::CompareGreaterEqual:
+            case Grammar::Symbol::CompareLess:
+            case Grammar::Symbol::CompareLessEqual:
+            case Grammar::Symbol::CompareNotEqual:
+            case Grammar::Symbol::IsNull:
+            case Grammar::Symbol::LogicalAND:
+            case Grammar::Symbol::LogicalNOT:
+            case Grammar::Symbol::LogicalOR:
+            case Grammar::Symbol::FunctionCall:
+            case Grammar::Symbol::OperatorAddition:
+            case Grammar::Symbol::OperatorDivision:
+            case Grammar::Symbol::OperatorMultiplication:
+            case Grammar::Symbol::OperatorSubraction:
+            case Grammar::Symbol::VariableAssignment:
+                TranslateExecutionTreeFunctionCall(execution);
+                break;
+
+            case Grammar::Symbol::VariableDeclaration:
+                WriteVariableDeclaration(execution, execution->GetInput(0).m_value);
+                break;
+
+            case Grammar::Symbol::DebugInfoEmptyStatement:
+            case Grammar::Symbol::FunctionDefinition:
+            case Grammar::Symbol::PlaceHolderDuringParsing:
+            case Grammar::Symbol::Sequence:
+                break;
+
+            default:
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedNode));
+                return;
+            }
+
+            for (size_t childIndex = 0; childIndex < execution->GetChildrenCount(); ++childIndex)
+            {
+                const auto& child = execution->GetChild(childIndex);
+
+                if (child.m_execution && !child.m_execution->IsInternalOut())
+                {
+                    TranslateExecutionTreeEntry(child.m_execution);
+                }
+            }
         }
 
-        void GraphToCPlusPlus::TranslateDependenciesDotH()
+        void GraphToCPlusPlus::TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution)
         {
+            if (!execution->GetConversions().empty()
+                || execution->GetChildrenCount() > 1
+                || execution->GetSymbol() == Grammar::Symbol::IsNull)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedNode));
+                return;
+            }
+
+            Grammar::VariableConstPtr output;
+
+            if (execution->GetChildrenCount() == 1)
+            {
+                const auto& childOutput = execution->GetChild(0).m_output;
+
+                if (childOutput.size() > 1)
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedNode));
+                    return;
+                }
 
+                if (!childOutput.empty())
+                {
+                    output = childOutput[0].second->m_source;
+                }
+            }
+
+            const bool isExpression = Grammar::IsLogicalExpression(execution)
+                || Grammar::IsVariableGet(execution)
+                || Grammar::IsVariableSet(execution)
+                || execution->GetSymbol() == Grammar::Symbol::VariableAssignment
+                || Grammar::IsOperatorArithmetic(execution);
+
+            if (isExpression)
+            {
+                // expressions have no side effects, there is nothing to write unless their result is used
+                if (output)
+                {
+                    m_dotCPPFunctions.WriteIndent();
+                    WriteVariableWrite(execution, output);
+
+                    if (Grammar::IsLogicalExpression(execution))
+                    {
+                        WriteLogicalExpression(execution);
+                    }
+                    else if (Grammar::IsOperatorArithmetic(execution))
+                    {
+                        WriteOperatorArithmetic(execution);
+                    }
+                    else
+                    {
+                        WriteFunctionCallInput(execution, 0);
+                    }
+
+                    m_dotCPPFunctions.WriteLine(";");
+                }
+            }
+            else if (Grammar::IsExecutedPropertyExtraction(execution)
+                || Grammar::IsWrittenMathExpression(execution)
+                || Grammar::IsEventConnectCall(execution)
+                || Grammar::IsEventDisconnectCall(execution)
+                || Grammar::IsGlobalPropertyRead(execution)
+                || Grammar::IsClassPropertyRead(execution)
+                || Grammar::IsClassPropertyWrite(execution)
+                || Grammar::IsUserFunctionCall(execution)
+                || Grammar::IsFunctionCallNullCheckRequired(execution))
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedNode));
+                return;
+            }
+            else
+            {
+                WriteMethodCall(execution, output);
+            }
+
+            WriteOutputAssignments(execution);
         }
 
-        void GraphToCPlusPlus::TranslateDependenciesDotCPP()
+        void GraphToCPlusPlus::TranslateExecutionTreeIfCondition(Grammar::ExecutionTreeConstPtr execution)
         {
+            if (execution->GetChildrenCount() != 2 || execution->GetInputCount() != 1)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedNode));
+                return;
+            }
+
+            m_dotCPPFunctions.WriteIndented("if (");
+            WriteFunctionCallInput(execution, 0);
+            m_dotCPPFunctions.WriteLine(")");
 
+            for (size_t childIndex = 0; childIndex < 2; ++childIndex)
+            {
+                if (childIndex == 1)
+                {
+                    m_dotCPPFunctions.WriteLineIndented("else");
+                }
+
+                OpenScope(m_dotCPPFunctions);
+                {
+                    const auto& child = execution->GetChild(childIndex);
+
+                    if (child.m_execution && !child.m_execution->IsInternalOut())
+                    {
+                        TranslateExecutionTreeEntry(child.m_execution);
+                    }
+                }
+                CloseScope(m_dotCPPFunctions);
+            }
         }
 
-        void GraphToCPlusPlus::TranslateDestruction()
+        void GraphToCPlusPlus::TranslateFunction(Grammar::ExecutionTreeConstPtr execution)
         {
+            m_dotH.WriteLineIndented("static %s;", GetFunctionSignature(execution, false).c_str());
+
+            if (!IsSuccessfull())
+            {
+                return;
+            }
+
+            m_dotCPPFunctions.WriteLineIndented(GetFunctionSignature(execution, true));
+            OpenScope(m_dotCPPFunctions);
+            {
+                WriteOutputAssignments(execution);
+                WriteLocalVariableInitialization(execution);
+                WriteReturnValueInitialization(execution);
 
+                if (execution->GetChildrenCount() > 0 && execution->GetChild(0).m_execution)
+                {
+                    TranslateExecutionTreeEntry(execution->GetChild(0).m_execution);
+                }
+
+                WriteReturnStatement(execution);
+            }
+            CloseScope(m_dotCPPFunctions);
         }
-                
-        void GraphToCPlusPlus::TranslateHandlers()
+
+        void GraphToCPlusPlus::TranslateFunctions()
         {
+            if (auto start = m_model.GetStart())
+            {
+                TranslateFunction(start);
+            }
 
+            for (auto function : m_model.GetFunctions())
+            {
+                if (IsSuccessfull())
+                {
+                    m_dotCPPFunctions.WriteNewLine();
+                    TranslateFunction(function);
+                }
+            }
         }
 
         void GraphToCPlusPlus::TranslateNamespaceOpen()
@@ -126,53 +820,409 @@ namespace ScriptCanvas
             OpenNamespace(m_dotH, GetAutoNativeNamespace());
             OpenNamespace(m_dotCPP, "ScriptCanvas");
             OpenNamespace(m_dotCPP, GetAutoNativeNamespace());
+
+            m_dotCPPMethods.SetIndent(m_dotCPP.GetIndent());
+            m_dotCPPFunctions.SetIndent(m_dotCPP.GetIndent());
         }
 
         void GraphToCPlusPlus::TranslateNamespaceClose()
         {
-            CloseNamespace(m_dotH, "ScriptCanvas");
+            // the method handles are declared before the functions that call them
+            m_dotCPP.Write(m_dotCPPMethods.GetOutput());
+            m_dotCPP.WriteNewLine();
+            m_dotCPP.Write(m_dotCPPFunctions.GetOutput());
+
             CloseNamespace(m_dotH, GetAutoNativeNamespace());
-            CloseNamespace(m_dotCPP, "ScriptCanvas");
+            CloseNamespace(m_dotH, "ScriptCanvas");
             CloseNamespace(m_dotCPP, GetAutoNativeNamespace());
+            CloseNamespace(m_dotCPP, "ScriptCanvas");
+        }
+
+        void GraphToCPlusPlus::TranslateRegistration()
+        {
+            if (!m_model.GetStart() || !IsSuccessfull())
+            {
+                return;
+            }
+
+            const AZStd::string className = GetClassName();
+            const AZStd::string registeredName = ExecutionStateNativeOnGraphStart::GetRegisteredName(m_model.GetSource().m_assetId);
+
+            m_dotH.WriteNewLine();
+            m_dotH.WriteLineIndented("// call from the gem module to execute the graph natively, in place of its Lua translation, until the graph is edited");
+            m_dotH.WriteLineIndented("static bool Register();");
+            m_dotH.WriteLineIndented("static bool Unregister();");
+
+            m_dotCPPFunctions.WriteNewLine();
+            m_dotCPPFunctions.WriteLineIndented("bool %s::Register()", className.c_str());
+            OpenScope(m_dotCPPFunctions);
+            m_dotCPPFunctions.WriteLineIndented("return RegisterNativeGraphStart(\"%s\", &%s::%s, 0x%08xu);", registeredName.c_str(), className.c_str(), Grammar::k_OnGraphStartFunctionName, m_fingerprint);
+            CloseScope(m_dotCPPFunctions);
+
+            m_dotCPPFunctions.WriteNewLine();
+            m_dotCPPFunctions.WriteLineIndented("bool %s::Unregister()", className.c_str());
+            OpenScope(m_dotCPPFunctions);
+            m_dotCPPFunctions.WriteLineIndented("return UnregisterNativeGraphStart(\"%s\");", registeredName.c_str());
+            CloseScope(m_dotCPPFunctions);
         }
 
-        void GraphToCPlusPlus::TranslateStartNode()
+        void GraphToCPlusPlus::WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution, size_t index)
         {
-            // write a start function
-            const Node* startNode = nullptr;
-            
-            if (startNode)
+            auto& input = execution->GetInput(index).m_value;
+
+            if (input->m_source != execution || input->m_requiresCreationFunction)
             {
-                { // .h
-                    m_dotH.WriteIndent();
-                    m_dotH.WriteLine("public: static void %s(const RuntimeContext& context);", Grammar::k_OnGraphStartFunctionName);
+                m_dotCPPFunctions.Write(GetVariableReference(execution, input));
+            }
+            else
+            {
+                AZStd::string valueString;
+
+                if (GraphToCPlusPlusCpp::ToNativeValueString(input->m_datum, valueString))
+                {
+                    m_dotCPPFunctions.Write(valueString);
                 }
-                
-                { // .cpp
-                    m_dotCPP.WriteIndent();
-                    m_dotCPP.WriteLine("void %s::%s(const RuntimeContext& context)", GetGraphName().data(), Grammar::k_OnGraphStartFunctionName);
-                    OpenScope(m_dotCPP);
+                else
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedType));
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::WriteLocalVariableInitialization(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (const auto& localDeclaredVariables = m_model.GetLocalVariables(execution))
+            {
+                // sorted, so the generated code doesn't change from one build to the next
+                AZStd::vector<Grammar::VariableConstPtr> variables(localDeclaredVariables->begin(), localDeclaredVariables->end());
+                AZStd::sort(variables.begin(), variables.end(), [](const Grammar::VariableConstPtr& lhs, const Grammar::VariableConstPtr& rhs)
+                {
+                    return lhs->m_name < rhs->m_name;
+                });
+
+                for (const auto& variable : variables)
+                {
+                    const auto requirement = Grammar::ParseConstructionRequirement(variable);
+
+                    if (requirement == Grammar::VariableConstructionRequirement::None
+                        || (requirement != Grammar::VariableConstructionRequirement::Static && execution != m_model.GetStart()))
                     {
-                        m_dotCPP.WriteIndent();
-                        m_dotCPP.WriteLine("AZ_TracePrintf(\"ScriptCanvas\", \"This call wasn't generated from parsing a print node!\");");
-                        m_dotCPP.WriteLine("LogNotificationBus::Event(context.GetGraphId(), &LogNotifications::LogMessage, \"This call wasn't generated from parsing a print node!\");");
-                        // get the related function call and call it
-                        // with possible appropriate variables
+                        WriteVariableDeclaration(execution, variable);
+                    }
+                    else
+                    {
+                        // initialized from the runtime data, which isn't supported
+                        AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedGraph));
                     }
-                    CloseScope(m_dotCPP);
                 }
             }
         }
 
-        void GraphToCPlusPlus::TranslateVariables()
+        void GraphToCPlusPlus::WriteLogicalExpression(Grammar::ExecutionTreeConstPtr execution)
         {
+            const auto symbol = execution->GetSymbol();
+
+            if (symbol == Grammar::Symbol::LogicalNOT)
+            {
+                m_dotCPPFunctions.Write("!");
+                WriteFunctionCallInput(execution, 0);
+                return;
+            }
 
+            if (execution->GetInputCount() != 2)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedNode));
+                return;
+            }
+
+            if (Grammar::IsFloatingPointNumberEqualityComparison(execution))
+            {
+                // matches the tolerance of the Lua translation
+                m_dotCPPFunctions.Write(symbol == Grammar::Symbol::CompareEqual ? "AZ::IsClose(" : "!AZ::IsClose(");
+                WriteFunctionCallInput(execution, 0);
+                m_dotCPPFunctions.Write(", ");
+                WriteFunctionCallInput(execution, 1);
+                m_dotCPPFunctions.Write(", %s)", Grammar::k_LuaEpsilonString);
+                return;
+            }
+
+            const bool isOrdered = symbol == Grammar::Symbol::CompareGreater
+                || symbol == Grammar::Symbol::CompareGreaterEqual
+                || symbol == Grammar::Symbol::CompareLess
+                || symbol == Grammar::Symbol::CompareLessEqual;
+
+            if (isOrdered)
+            {
+                const Data::Type& type = execution->GetInput(0).m_value->m_datum.GetType();
+
+                if (type != Data::Type::Number() && type != Data::Type::String())
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedType));
+                    return;
+                }
+            }
+
+            WriteFunctionCallInput(execution, 0);
+
+            switch (symbol)
+            {
+            case Grammar::Symbol::CompareEqual:
+                m_dotCPPFunctions.Write(" == ");
+                break;
+            case Grammar::Symbol::CompareGreater:
+                m_dotCPPFunctions.Write(" > ");
+                break;
+            case Grammar::Symbol::CompareGreaterEqual:
+                m_dotCPPFunctions.Write(" >= ");
+                break;
+            case Grammar::Symbol::CompareLess:
+                m_dotCPPFunctions.Write(" < ");
+                break;
+            case Grammar::Symbol::CompareLessEqual:
+                m_dotCPPFunctions.Write(" <= ");
+                break;
+            case Grammar::Symbol::CompareNotEqual:
+                m_dotCPPFunctions.Write(" != ");
+                break;
+            case Grammar::Symbol::LogicalAND:
+                m_dotCPPFunctions.Write(" && ");
+                break;
+            case Grammar::Symbol::LogicalOR:
+                m_dotCPPFunctions.Write(" || ");
+                break;
+            default:
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedNode));
+                return;
+            }
+
+            WriteFunctionCallInput(execution, 1);
         }
 
-        void GraphToCPlusPlus::WriteHeader()
+        void GraphToCPlusPlus::WriteMethodCall(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr output)
         {
-            WriteHeaderDotH();
-            WriteHeaderDotCPP();
+            using namespace Nodes::Core;
+
+            const Method* method = azrtti_cast<const Method*>(execution->GetId().m_node);
+            const AZ::BehaviorMethod* behaviorMethod = method ? method->GetMethod() : nullptr;
+
+            if (!behaviorMethod
+                || method->IsMethodOverloaded()
+                || execution->GetEventType() != EventType::Count
+                || (method->GetMethodType() != MethodType::Free && method->GetMethodType() != MethodType::Member)
+                || behaviorMethod->GetNumArguments() != execution->GetInputCount())
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedNode));
+                return;
+            }
+
+            const AZStd::string className = method->GetMethodType() == MethodType::Member ? method->GetRawMethodClassName() : AZStd::string();
+            const AZStd::string handle = FindMethodHandle(className, method->GetRawMethodName(), *behaviorMethod);
+
+            AZStd::string resultName;
+            const char* resultCast = nullptr;
+
+            if (output)
+            {
+                if (!behaviorMethod->HasResult())
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedNode));
+                    return;
+                }
+
+                const AZ::Uuid resultType = behaviorMethod->GetResult()->m_typeId;
+
+                if (resultType == Data::ToAZType(output->m_datum.GetType()))
+                {
+                    if (output->m_source == execution)
+                    {
+                        m_dotCPPFunctions.WriteLineIndented("%s %s{};", GetTypeName(execution, output).c_str(), GetVariableReference(execution, output).c_str());
+                    }
+
+                    resultName = GetVariableReference(execution, output);
+                }
+                else if (output->m_datum.GetType() == Data::Type::Number() && (resultCast = GraphToCPlusPlusCpp::GetNativeArithmeticTypeName(resultType)))
+                {
+                    resultName = AZStd::string::format("result%zu", m_resultCount++);
+                    m_dotCPPFunctions.WriteLineIndented("%s %s{};", resultCast, resultName.c_str());
+                }
+                else
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedType));
+                    return;
+                }
+            }
+
+            if (output)
+            {
+                m_dotCPPFunctions.WriteIndented("%s.InvokeResult(%s", handle.c_str(), resultName.c_str());
+            }
+            else
+            {
+                m_dotCPPFunctions.WriteIndented("%s.Invoke(", handle.c_str());
+            }
+
+            for (size_t index = 0; index < execution->GetInputCount(); ++index)
+            {
+                if (index > 0 || output)
+                {
+                    m_dotCPPFunctions.Write(", ");
+                }
+
+                const AZ::Uuid parameterType = behaviorMethod->GetArgument(index)->m_typeId;
+                const Data::Type& inputType = execution->GetInput(index).m_value->m_datum.GetType();
+
+                if (parameterType == Data::ToAZType(inputType))
+                {
+                    WriteFunctionCallInput(execution, index);
+                }
+                else if (const char* parameterCast = inputType == Data::Type::Number() ? GraphToCPlusPlusCpp::GetNativeArithmeticTypeName(parameterType) : nullptr)
+                {
+                    m_dotCPPFunctions.Write("static_cast<%s>(", parameterCast);
+                    WriteFunctionCallInput(execution, index);
+                    m_dotCPPFunctions.Write(")");
+                }
+                else
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedArgument));
+                    return;
+                }
+            }
+
+            m_dotCPPFunctions.WriteLine(");");
+
+            if (resultCast)
+            {
+                m_dotCPPFunctions.WriteIndent();
+                WriteVariableWrite(execution, output);
+                m_dotCPPFunctions.WriteLine("static_cast<Data::NumberType>(%s);", resultName.c_str());
+            }
+        }
+
+        void GraphToCPlusPlus::WriteOperatorArithmetic(Grammar::ExecutionTreeConstPtr execution)
+        {
+            const auto count = execution->GetInputCount();
+
+            if (count < 2)
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NotEnoughInputForArithmeticOperator));
+                return;
+            }
+
+            const Data::Type& type = execution->GetInput(0).m_value->m_datum.GetType();
+            const bool isSupportedType = type == Data::Type::Number()
+                || type == Data::Type::Vector2()
+                || type == Data::Type::Vector3()
+                || type == Data::Type::Vector4()
+                || (type == Data::Type::String() && execution->GetSymbol() == Grammar::Symbol::OperatorAddition);
+
+            for (size_t i(0); i < count; ++i)
+            {
+                if (!isSupportedType || execution->GetInput(i).m_value->m_datum.GetType() != type)
+                {
+                    AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedType));
+                    return;
+                }
+            }
+
+            const AZStd::string_view operatorString = GetOperatorString(execution);
+
+            for (size_t i(0); i < (count - 1); ++i)
+            {
+                m_dotCPPFunctions.Write("(");
+            }
+
+            // write operand 0 + operand 1
+            WriteFunctionCallInput(execution, 0);
+            m_dotCPPFunctions.Write(operatorString);
+            WriteFunctionCallInput(execution, 1);
+            m_dotCPPFunctions.Write(")");
+
+            for (size_t i(2); i < count; ++i)
+            {
+                m_dotCPPFunctions.Write(operatorString);
+                WriteFunctionCallInput(execution, i);
+                m_dotCPPFunctions.Write(")");
+            }
+        }
+
+        void GraphToCPlusPlus::WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (const auto output = execution->GetLocalOutput())
+            {
+                for (const auto& outputIter : *output)
+                {
+                    if (!outputIter.second->m_sourceConversions.empty())
+                    {
+                        AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedType));
+                        return;
+                    }
+
+                    for (const auto& assignment : outputIter.second->m_assignments)
+                    {
+                        m_dotCPPFunctions.WriteLineIndented("%s = %s;"
+                            , GetVariableReference(execution, assignment).c_str()
+                            , GetVariableReference(execution, outputIter.second->m_source).c_str());
+                    }
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::WriteReturnStatement(Grammar::ExecutionTreeConstPtr execution)
+        {
+            if (execution->HasReturnValues() && !execution->HasExplicitUserOutCalls())
+            {
+                m_dotCPPFunctions.WriteLineIndented("return %s;", GetVariableReference(execution, execution->GetReturnValue(0).second->m_source).c_str());
+            }
+        }
+
+        void GraphToCPlusPlus::WriteReturnValueInitialization(Grammar::ExecutionTreeConstPtr execution)
+        {
+            for (size_t index(0), sentinel(execution->GetReturnValueCount()); index < sentinel; ++index)
+            {
+                const auto& returnValue = execution->GetReturnValue(index).second;
+
+                if (returnValue->m_isNewValue)
+                {
+                    if (returnValue->m_initializationValue)
+                    {
+                        m_dotCPPFunctions.WriteLineIndented("%s %s = %s;"
+                            , GetTypeName(execution, returnValue->m_source).c_str()
+                            , GetVariableReference(execution, returnValue->m_source).c_str()
+                            , GetVariableReference(execution, returnValue->m_initializationValue).c_str());
+                    }
+                    else
+                    {
+                        WriteVariableDeclaration(execution, returnValue->m_source);
+                    }
+                }
+            }
+        }
+
+        void GraphToCPlusPlus::WriteVariableDeclaration(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable)
+        {
+            AZStd::string valueString;
+
+            if (!GraphToCPlusPlusCpp::ToNativeValueString(variable->m_datum, valueString))
+            {
+                AddError(execution, aznew Internal::ParseError(execution->GetNodeId(), ParseErrors::NativeUnsupportedType));
+                return;
+            }
+
+            m_dotCPPFunctions.WriteIndented("%s %s = ", GetTypeName(execution, variable).c_str(), GetVariableReference(execution, variable).c_str());
+            m_dotCPPFunctions.Write(valueString);
+            m_dotCPPFunctions.WriteLine(";");
+        }
+
+        void GraphToCPlusPlus::WriteVariableWrite(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable)
+        {
+            if (variable->m_source == execution)
+            {
+                m_dotCPPFunctions.Write("%s %s = ", GetTypeName(execution, variable).c_str(), GetVariableReference(execution, variable).c_str());
+            }
+            else
+            {
+                m_dotCPPFunctions.Write("%s = ", GetVariableReference(execution, variable).c_str());
+            }
         }
 
         void GraphToCPlusPlus::WriteHeaderDotCPP()
@@ -193,9 +1243,7 @@ namespace ScriptCanvas
             m_dotH.WriteNewLine();
             WriteDoNotModify(m_dotH);
             m_dotH.WriteNewLine();
-            m_dotH.WriteLine("#include <Execution/NativeHostDeclarations.h>");
-            m_dotH.WriteNewLine();
         }
 
-    } 
-} 
+    }
+}
@@ -9,7 +9,9 @@
 #pragma once
 
 #include <AzCore/Outcome/Outcome.h>
+#include <AzCore/std/containers/unordered_map.h>
 
+#include "TranslationResult.h"
 #include "TranslationUtilities.h"
 #include "GraphToX.h"
 
@@ -24,37 +26,68 @@ namespace ScriptCanvas
 
     namespace Translation
     {
+        // Translates a graph to a C++ class with static functions, meant to be built into a gem. Only graphs made of functions
+        // are supported: no event handlers, nodeables or member variables, and BehaviorContext methods are the only calls.
+        // Anything else is reported as an error, and the graph keeps executing interpreted.
+        //
+        // The class provides Register() and Unregister(), which the gem module calls to have the runtime execute the
+        // on graph start function of the graph in place of the Lua translation. Register() passes the fingerprint of the
+        // graph, so that the runtime ignores the C++ once the graph is edited and built again.
         class GraphToCPlusPlus
             : public GraphToX
         {
         public:
-            static AZ::Outcome<void, AZStd::pair<AZStd::string, AZStd::string>> Translate(const Grammar::AbstractCodeModel& model, AZStd::string& dotH, AZStd::string& dotCPP);
-            
-            AZ_INLINE bool IsSuccessfull() const { return false;  }
-        private:         
+            // first is the .h, second is the .cpp
+            static AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> Translate(const Grammar::AbstractCodeModel& model, AZ::u32 fingerprint);
+
+            // the fingerprint of a graph is that of its Lua translation, which the builder stores in the runtime data
+            static AZ::u32 GetFingerprint(AZStd::string_view luaTranslation);
+
+        private:
             // cpp only
             Writer m_dotH;
             Writer m_dotCPP;
-            
-            GraphToCPlusPlus(const Grammar::AbstractCodeModel& model);
+            // written into the .cpp before the functions that use them
+            Writer m_dotCPPMethods;
+            Writer m_dotCPPFunctions;
+            AZStd::unordered_map<AZStd::string, AZStd::string> m_methodHandles;
+            size_t m_resultCount = 0;
+            const AZ::u32 m_fingerprint;
 
+            GraphToCPlusPlus(const Grammar::AbstractCodeModel& model, AZ::u32 fingerprint);
+
+            AZStd::string FindMethodHandle(const AZStd::string& className, const AZStd::string& methodName, const AZ::BehaviorMethod& behaviorMethod);
+            AZStd::string GetClassName() const;
+            AZStd::string GetFunctionSignature(Grammar::ExecutionTreeConstPtr execution, bool isDefinition);
+            AZStd::string_view GetOperatorString(Grammar::ExecutionTreeConstPtr execution);
+            AZStd::string GetTypeName(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable);
+            AZStd::string GetVariableReference(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable);
+            bool IsGraphSupported();
             void TranslateClassClose();
             void TranslateClassOpen();
-            void TranslateConstruction();
-            void TranslateDependencies();
             void TranslateDependenciesDotH();
             void TranslateDependenciesDotCPP();
-            void TranslateDestruction();
+            void TranslateExecutionTreeEntry(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeFunctionCall(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateExecutionTreeIfCondition(Grammar::ExecutionTreeConstPtr execution);
+            void TranslateFunction(Grammar::ExecutionTreeConstPtr execution);
             void TranslateFunctions();
-            void TranslateHandlers();
             void TranslateNamespaceOpen();
             void TranslateNamespaceClose();
-            void TranslateStartNode();
-            void TranslateVariables();
-            void WriteHeader(); // Write, not translate, because this should be less dependent on the contents of the graph
+            void TranslateRegistration();
+            void WriteFunctionCallInput(Grammar::ExecutionTreeConstPtr execution, size_t index);
+            void WriteLocalVariableInitialization(Grammar::ExecutionTreeConstPtr execution);
+            void WriteLogicalExpression(Grammar::ExecutionTreeConstPtr execution);
+            void WriteMethodCall(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr output);
+            void WriteOperatorArithmetic(Grammar::ExecutionTreeConstPtr execution);
+            void WriteOutputAssignments(Grammar::ExecutionTreeConstPtr execution);
+            void WriteReturnStatement(Grammar::ExecutionTreeConstPtr execution);
+            void WriteReturnValueInitialization(Grammar::ExecutionTreeConstPtr execution);
+            void WriteVariableDeclaration(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable);
+            void WriteVariableWrite(Grammar::ExecutionTreeConstPtr execution, Grammar::VariableConstPtr variable);
             void WriteHeaderDotH(); // Write, not translate, because this should be less dependent on the contents of the graph
             void WriteHeaderDotCPP(); // Write, not translate, because this should be less dependent on the contents of the graph
         };
-    } 
+    }
 
 }
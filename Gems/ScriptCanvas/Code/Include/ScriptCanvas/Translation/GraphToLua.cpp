@@ -18,11 +18,13 @@
 #include <ScriptCanvas/Debugger/ValidationEvents/GraphTranslationValidation/GraphTranslationValidations.h>
 #include <ScriptCanvas/Debugger/ValidationEvents/ParsingValidation/ParsingValidations.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionInterpretedAPI.h>
+#include <ScriptCanvas/Execution/Interpreted/ExecutionInterpretedThunks.h>
 #include <ScriptCanvas/Grammar/AbstractCodeModel.h>
 #include <ScriptCanvas/Grammar/ParsingMetaData.h>
 #include <ScriptCanvas/Grammar/ParsingUtilities.h>
 #include <ScriptCanvas/Grammar/Primitives.h>
 #include <ScriptCanvas/Grammar/PrimitivesExecution.h>
+#include <ScriptCanvas/Libraries/Core/Method.h>
 
 #include "GraphToLuaUtility.h"
 
@@ -37,6 +39,49 @@ namespace GraphToLuaCpp
     {
         return ScriptCanvas::Grammar::ToSafeName(fileName);
     }
+
+    // Returns the thunk that can be called in place of the reflected method the node calls, if there is one.
+    const ScriptCanvas::Execution::InterpretedThunk* FindInterpretedThunk(ScriptCanvas::Grammar::ExecutionTreeConstPtr execution)
+    {
+        using namespace ScriptCanvas;
+        using namespace ScriptCanvas::Nodes::Core;
+
+        if (!Grammar::g_useInterpretedThunks
+            || execution->GetEventType() != EventType::Count
+            || execution->GetNameLexicalScope().m_type == Grammar::LexicalScopeType::Variable)
+        {
+            return nullptr;
+        }
+
+        const Method* method = azrtti_cast<const Method*>(execution->GetId().m_node);
+        const AZ::BehaviorMethod* behaviorMethod = method ? method->GetMethod() : nullptr;
+
+        if (!behaviorMethod || method->IsMethodOverloaded() || method->GetMethodType() != MethodType::Member)
+        {
+            return nullptr;
+        }
+
+        const Execution::InterpretedThunk* thunk = Execution::FindInterpretedThunk(method->GetRawMethodClassName(), method->GetRawMethodName(), *behaviorMethod);
+        return thunk && thunk->m_argumentTypes.size() == execution->GetInputCount() ? thunk : nullptr;
+    }
+
+    // Returns true if the node calls a reflected method through its class or namespace, the performance configuration calls those
+    // methods through the tracked call so that they are counted for the node.
+    bool IsTrackedMethodCall(ScriptCanvas::Grammar::ExecutionTreeConstPtr execution)
+    {
+        using namespace ScriptCanvas;
+        using namespace ScriptCanvas::Nodes::Core;
+
+        const Grammar::LexicalScopeType scopeType = execution->GetNameLexicalScope().m_type;
+        if (execution->GetEventType() != EventType::Count
+            || (scopeType != Grammar::LexicalScopeType::Class && scopeType != Grammar::LexicalScopeType::Namespace))
+        {
+            return false;
+        }
+
+        const Method* method = azrtti_cast<const Method*>(execution->GetId().m_node);
+        return method && method->GetMethod();
+    }
 }
 
 namespace ScriptCanvas
@@ -1567,28 +1612,67 @@ namespace ScriptCanvas
                 m_dotLua.Write("%s(", Grammar::k_TypeSafeEBusMultipleResultsName);
             }
 
-            WriteFunctionCallNamespace(execution);
+            const Execution::InterpretedThunk* thunk = nameOverride.empty() && inputOverride >= execution->GetInputCount()
+                ? GraphToLuaCpp::FindInterpretedThunk(execution)
+                : nullptr;
 
-            switch (execution->GetEventType())
+            if (thunk)
             {
-            case ScriptCanvas::EventType::Broadcast:
-                m_dotLua.Write("Broadcast.%s(", Grammar::ToIdentifier(name).data());
-                break;
-            case ScriptCanvas::EventType::BroadcastQueue:
-                m_dotLua.Write("QueueBroadcast.%s(", Grammar::ToIdentifier(name).data());
-                break;
-            case ScriptCanvas::EventType::Event:
-                m_dotLua.Write("Event.%s(", Grammar::ToIdentifier(name).data());
-                break;
-            case ScriptCanvas::EventType::EventQueue:
-                m_dotLua.Write("QueueEvent.%s(", Grammar::ToIdentifier(name).data());
-                break;
-            case ScriptCanvas::EventType::Count:
-                m_dotLua.Write("%s(", Grammar::ToIdentifier(name).data());
-                break;
-            default:
-                AddError(execution, aznew InvalidFunctionCallNameValidation(execution->GetId().m_node->GetEntityId(), execution->GetId().m_slot->GetId()));
-                break;
+                // the thunk takes the same input as the method, without going through the BehaviorContext
+                if (m_executionConfig == BuildConfiguration::Performance)
+                {
+                    // preceded by the id of the node, so the calls are counted per node
+                    m_dotLua.Write("%s('%llu', ", thunk->m_trackedGlobalName.c_str()
+                        , static_cast<unsigned long long>(static_cast<AZ::u64>(execution->GetId().m_node->GetEntityId())));
+                }
+                else
+                {
+                    m_dotLua.Write("%s(", thunk->m_globalName.c_str());
+                }
+            }
+            else
+            {
+                const bool isTracked = m_executionConfig == BuildConfiguration::Performance
+                    && nameOverride.empty() && inputOverride >= execution->GetInputCount()
+                    && GraphToLuaCpp::IsTrackedMethodCall(execution);
+
+                if (isTracked)
+                {
+                    // the method is passed to the tracked call with its input, preceded by the id of the node
+                    m_dotLua.Write("%s('%llu', ", Grammar::k_InterpretedTrackedCallName
+                        , static_cast<unsigned long long>(static_cast<AZ::u64>(execution->GetId().m_node->GetEntityId())));
+                }
+
+                WriteFunctionCallNamespace(execution);
+
+                switch (execution->GetEventType())
+                {
+                case ScriptCanvas::EventType::Broadcast:
+                    m_dotLua.Write("Broadcast.%s(", Grammar::ToIdentifier(name).data());
+                    break;
+                case ScriptCanvas::EventType::BroadcastQueue:
+                    m_dotLua.Write("QueueBroadcast.%s(", Grammar::ToIdentifier(name).data());
+                    break;
+                case ScriptCanvas::EventType::Event:
+                    m_dotLua.Write("Event.%s(", Grammar::ToIdentifier(name).data());
+                    break;
+                case ScriptCanvas::EventType::EventQueue:
+                    m_dotLua.Write("QueueEvent.%s(", Grammar::ToIdentifier(name).data());
+                    break;
+                case ScriptCanvas::EventType::Count:
+                    if (isTracked)
+                    {
+                        m_dotLua.Write(execution->GetInputCount() > 0 ? "%s, " : "%s", Grammar::ToIdentifier(name).data());
+                    }
+                    else
+                    {
+                        m_dotLua.Write("%s(", Grammar::ToIdentifier(name).data());
+                    }
+                    break;
+                default:
+                    AddError(execution, aznew InvalidFunctionCallNameValidation(execution->GetId().m_node->GetEntityId(), execution->GetId().m_slot->GetId()));
+                    break;
+                }
             }
 
             // #functions2 pure on graph start nodes with dependencies can only be added to the graph as variables, which is a work-flow we may never want to support
@@ -27,40 +27,37 @@ namespace TranslationCPP
     using namespace ScriptCanvas;
     using namespace ScriptCanvas::Translation;
 
-    /*
-    AZ::Outcome<AZStd::pair<AZStd::string, AZStd::string>, AZStd::pair<AZStd::string, AZStd::string>> ToCPlusPlus(const Grammar::AbstractCodeModel& model, bool rawSave = false)
+    // the native translation is only of use as files to add to a gem, so it is always saved
+    AZ::Outcome<AZStd::pair<TargetResult, TargetResult>, ErrorList> ToCPlusPlus(const Grammar::AbstractCodeModel& model, AZ::u32 fingerprint)
     {
-        AZStd::string dotH, dotCPP;
-        auto outcome = GraphToCPlusPlus::Translate(model, dotH, dotCPP);
+        auto outcome = GraphToCPlusPlus::Translate(model, fingerprint);
         if (outcome.IsSuccess())
         {
+            const auto& dotHAndDotCPP = outcome.GetValue();
 #if defined(SCRIPT_CANVAS_PRINT_FILES_CONSOLE)
             AZ_TracePrintf("ScriptCanvas", "\n\n *** .h file ***\n\n");
-            AZ_TracePrintf("ScriptCanvas", dotH.data());
+            AZ_TracePrintf("ScriptCanvas", dotHAndDotCPP.first.m_text.data());
             AZ_TracePrintf("ScriptCanvas", "\n\n *** .cpp file *\n\n");
-            AZ_TracePrintf("ScriptCanvas", dotCPP.data());
+            AZ_TracePrintf("ScriptCanvas", dotHAndDotCPP.second.m_text.data());
             AZ_TracePrintf("ScriptCanvas", "\n\n");
 #endif
-            if (rawSave)
+            auto saveOutcome = SaveDotH(model.GetSource(), dotHAndDotCPP.first.m_text);
+            if (saveOutcome.IsSuccess())
             {
-                auto saveOutcome = SaveDotH(model.GetSource(), dotH);
-                if (saveOutcome.IsSuccess())
-                {
-                    saveOutcome = SaveDotCPP(model.GetSource(), dotCPP);
-                }
-                if (!saveOutcome.IsSuccess())
-                {
-                    AZ_TracePrintf("Save failed %s", saveOutcome.GetError().data());
-                }
+                saveOutcome = SaveDotCPP(model.GetSource(), dotHAndDotCPP.second.m_text);
+            }
+            if (!saveOutcome.IsSuccess())
+            {
+                AZ_TracePrintf("ScriptCanvas", "Save failed %s", saveOutcome.GetError().data());
             }
-            return AZ::Success(AZStd::make_pair(AZStd::move(dotH), AZStd::move(dotCPP)));
+
+            return AZ::Success(outcome.TakeValue());
         }
         else
         {
             return AZ::Failure(outcome.TakeError());
         }
     }
-    */
 
     AZ::Outcome<TargetResult, ErrorList> ToLua(const Grammar::AbstractCodeModel& model, bool rawSave = false)
     {
@@ -134,31 +131,34 @@ namespace ScriptCanvas
                     }
                 }
 
-                // Translation to C++ (executed via BehaviorContext calls) has been demonstrated in the past and is partially in progress.
-                // These calls allow for users to execute multiple translations from the same abstract code model.
-                // More work is required to complete all the latest features of the ACM, and do integrate output files into the build.
-                // 
-                //                 if (targetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
-                //                 {
-                //                     auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), rawSave);
-                //                     if (outcomeCPP.IsSuccess())
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeValue();
-                //                         
-                //                         TargetResult cppResult;
-                //                         cppResult.m_text = AZStd::move(hppAndCpp.first);
-                //                         translations.emplace(TargetFlags::Hpp, AZStd::move(cppResult));
-                //                         TargetResult hppResult;
-                //                         hppResult.m_text = AZStd::move(hppAndCpp.second);
-                //                         translations.emplace(TargetFlags::Cpp, AZStd::move(hppResult));
-                //                     }
-                //                     else
-                //                     {
-                //                         auto hppAndCpp = outcomeCPP.TakeError();
-                //                         errors.emplace(TargetFlags::Hpp, AZStd::move(hppAndCpp.first));
-                //                         errors.emplace(TargetFlags::Cpp, AZStd::move(hppAndCpp.second));
-                //                     }
-                //                 }
+                // Translation to C++, executed with direct BehaviorContext calls. Only a subset of graphs is supported, a failure
+                // leaves the Lua translation in use.
+                if (request.translationTargetFlags & (TargetFlags::Cpp | TargetFlags::Hpp))
+                {
+                    // the C++ is registered with the fingerprint of the Lua translation, which the runtime data of the graph stores
+                    AZ::u32 fingerprint = 0;
+                    auto luaIter = translations.find(TargetFlags::Lua);
+                    if (luaIter != translations.end())
+                    {
+                        fingerprint = GraphToCPlusPlus::GetFingerprint(luaIter->second.m_text);
+                    }
+                    else if (auto outcomeLua = TranslationCPP::ToLua(*model.get()); outcomeLua.IsSuccess())
+                    {
+                        fingerprint = GraphToCPlusPlus::GetFingerprint(outcomeLua.GetValue().m_text);
+                    }
+
+                    auto outcomeCPP = TranslationCPP::ToCPlusPlus(*model.get(), fingerprint);
+                    if (outcomeCPP.IsSuccess())
+                    {
+                        auto dotHAndDotCPP = outcomeCPP.TakeValue();
+                        translations.emplace(TargetFlags::Hpp, AZStd::move(dotHAndDotCPP.first));
+                        translations.emplace(TargetFlags::Cpp, AZStd::move(dotHAndDotCPP.second));
+                    }
+                    else
+                    {
+                        errors.emplace(TargetFlags::Cpp, outcomeCPP.TakeError());
+                    }
+                }
 
             }
 
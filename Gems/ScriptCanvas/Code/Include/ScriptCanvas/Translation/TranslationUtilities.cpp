@@ -24,6 +24,7 @@ namespace TranslationUtilitiesCPP
     
     const char* k_namespaceNameNative = "AutoNative";
     const char* k_fileDirectoryPathLua = "@usercache@/DebugScriptCanvas2LuaOutput/";
+    const char* k_fileDirectoryPathNative = "@usercache@/ScriptCanvasNativeOutput/";
     const char* k_space = " ";
     
     const size_t k_maxTabs = 20;
@@ -71,6 +72,12 @@ namespace TranslationUtilitiesCPP
         return AZStd::string::format("%s%s_VM.%s", TranslationUtilitiesCPP::k_fileDirectoryPathLua, source.m_name.data(), extension.data());
     }
 
+    // the native output is meant to be added to a gem as is, so the file names match the generated class name
+    AZStd::string GetNativeFilePath(const Grammar::Source& source, AZStd::string_view extension)
+    {
+        return AZStd::string::format("%s%s.%s", TranslationUtilitiesCPP::k_fileDirectoryPathNative, source.m_name.data(), extension.data());
+    }
+
     class FileEventHandler
         : public AZ::IO::FileIOEventBus::Handler
     {
@@ -99,7 +106,7 @@ namespace TranslationUtilitiesCPP
         }
     };
 
-    AZ::Outcome<void, AZStd::string> SaveFile(const Grammar::Source& source, AZStd::string_view text, AZStd::string_view extension)
+    AZ::Outcome<void, AZStd::string> SaveFile(const AZStd::string& filePath, AZStd::string_view text)
     {
         AZ::IO::FileIOBase* fileIO = AZ::IO::FileIOBase::GetInstance();
 
@@ -108,9 +115,6 @@ namespace TranslationUtilitiesCPP
             return AZ::Failure(AZStd::string("FileIOBase unavailable"));
         }
 
-        // \todo get a (debug) file path based on the extension
-        const AZStd::string filePath = TranslationUtilitiesCPP::GetDebugLuaFilePath(source, extension);
-
         FileEventHandler eventHandler;
 
         AZ::IO::HandleType fileHandle = AZ::IO::InvalidHandle;
@@ -187,17 +191,17 @@ namespace ScriptCanvas
 
         AZ::Outcome<void, AZStd::string> SaveDotCPP(const Grammar::Source& source, AZStd::string_view dotCPP)
         {
-            return TranslationUtilitiesCPP::SaveFile(source, dotCPP, "cpp");
+            return TranslationUtilitiesCPP::SaveFile(TranslationUtilitiesCPP::GetNativeFilePath(source, "cpp"), dotCPP);
         }
 
         AZ::Outcome<void, AZStd::string> SaveDotH(const Grammar::Source& source, AZStd::string_view dotH)
         {
-            return TranslationUtilitiesCPP::SaveFile(source, dotH, "h");
+            return TranslationUtilitiesCPP::SaveFile(TranslationUtilitiesCPP::GetNativeFilePath(source, "h"), dotH);
         }
 
         AZ::Outcome<void, AZStd::string> SaveDotLua(const Grammar::Source& source, AZStd::string_view dotLua)
         {
-            return TranslationUtilitiesCPP::SaveFile(source, dotLua, "lua");
+            return TranslationUtilitiesCPP::SaveFile(TranslationUtilitiesCPP::GetDebugLuaFilePath(source, "lua"), dotLua);
         }
       
         Writer::Writer()
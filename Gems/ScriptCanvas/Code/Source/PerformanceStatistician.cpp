@@ -48,6 +48,12 @@ namespace ScriptCanvas
             consoleString += "[SCRIPT COST] ";
             consoleString += AZStd::string::format("%7.4f%% of duration \n", stats.scriptCostPercent);
 
+            for (const auto& iter : stats.report.byNode)
+            {
+                const double nodeMs = aznumeric_caster(iter.second.executionTime / 1000.0);
+                consoleString += AZStd::string::format("[       NODE] %7.3f ms %10llu calls %s\n", nodeMs, static_cast<unsigned long long>(iter.second.callCount), iter.first.ToString().c_str());
+            }
+
             return consoleString;
         }
 
@@ -7,6 +7,7 @@
  */
 
 #include <ScriptCanvas/Execution/ExecutionPerformanceTimer.h>
+#include <ScriptCanvas/Execution/Interpreted/ExecutionInterpretedThunks.h>
 
 #include <ScriptCanvas/PerformanceTracker.h>
 
@@ -65,6 +66,17 @@ namespace ScriptCanvas
 
             m_timersByAsset.clear();
 
+#if defined(SCRIPT_CANVAS_PERFORMANCE_TRACKING_ENABLED)
+            PerformanceReportByNode nodeReports;
+            CollectInterpretedThunkReports(nodeReports);
+
+            for (auto& iter : nodeReports)
+            {
+                m_snapshotReport.byNode[iter.first] += iter.second;
+                m_globalReport.byNode[iter.first] += iter.second;
+            }
+#endif
+
             m_lastCapturedSnapshot = m_snapshotReport;
             m_lastCapturedGlobal = m_globalReport;
             m_snapshotReport = {};
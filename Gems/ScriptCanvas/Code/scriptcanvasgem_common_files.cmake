@@ -180,6 +180,8 @@ set(FILES
     Include/ScriptCanvas/Execution/Interpreted/ExecutionInterpretedEBusAPI.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionInterpretedOut.h
     Include/ScriptCanvas/Execution/Interpreted/ExecutionInterpretedOut.cpp
+    Include/ScriptCanvas/Execution/Interpreted/ExecutionInterpretedThunks.h
+    Include/ScriptCanvas/Execution/Interpreted/ExecutionInterpretedThunks.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpreted.h
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpreted.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedPerActivation.h
@@ -190,6 +192,8 @@ set(FILES
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedSingleton.cpp
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedUtility.h
     Include/ScriptCanvas/Execution/Interpreted/ExecutionStateInterpretedUtility.cpp
+    Include/ScriptCanvas/Execution/Native/ExecutionStateNative.h
+    Include/ScriptCanvas/Execution/Native/ExecutionStateNative.cpp
     Include/ScriptCanvas/Execution/NodeableOut/NodeableOutNative.h
     Include/ScriptCanvas/Grammar/AbstractCodeModel.h
     Include/ScriptCanvas/Grammar/AbstractCodeModel.cpp
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#ifdef HAVE_BENCHMARK
+#include <AzCore/Component/ComponentApplication.h>
+#include <AzCore/Math/MathReflection.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/UnitTest/TestTypes.h>
+#include <ScriptCanvas/Data/Data.h>
+#include <ScriptCanvas/Execution/NativeHostDefinitions.h>
+
+namespace ScriptCanvasTests
+{
+    using namespace ScriptCanvas;
+
+    constexpr float k_deltaTime = 0.016f;
+
+    // The body of a small on tick graph, position += velocity * dt, then a comparison of the length of the position. The Lua is
+    // what the interpreted graph executes each tick, the native benchmarks make the calls the C++ translation of the graph makes.
+    class ScriptCanvasNativeBenchmarkFixture
+        : public UnitTest::AllocatorsBenchmarkFixture
+    {
+    public:
+        void SetUp(const ::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+        void SetUp(::benchmark::State& state) override
+        {
+            UnitTest::AllocatorsBenchmarkFixture::SetUp(state);
+            internalSetUp();
+        }
+
+        void TearDown(const ::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+        void TearDown(::benchmark::State& state) override
+        {
+            internalTearDown();
+            UnitTest::AllocatorsBenchmarkFixture::TearDown(state);
+        }
+
+    protected:
+        void internalSetUp()
+        {
+            // the native calls look the methods up in the BehaviorContext of the application
+            m_application = aznew AZ::ComponentApplication();
+            AZ::ComponentApplication::Descriptor descriptor;
+            descriptor.m_useExistingAllocator = true;
+            AZ::ComponentApplication::StartupParameters startupParameters;
+            startupParameters.m_allocator = &AZ::AllocatorInstance<AZ::SystemAllocator>::Get();
+            m_application->Create(descriptor, startupParameters);
+
+            AZ::BehaviorContext* behaviorContext = m_application->GetBehaviorContext();
+            if (behaviorContext->m_classes.find("Vector3") == behaviorContext->m_classes.end())
+            {
+                AZ::MathReflect(behaviorContext);
+            }
+
+            m_scriptContext = aznew AZ::ScriptContext();
+            m_scriptContext->BindTo(behaviorContext);
+            m_scriptContext->Execute(AZStd::string::format(
+                "position = Vector3(0, 0, 0)\n"
+                "velocity = Vector3(1, 2, 3)\n"
+                "outside = 0\n"
+                "function Tick()\n"
+                "    position = position + velocity * %f\n"
+                "    if position:GetLength() > 1000 then\n"
+                "        outside = outside + 1\n"
+                "    end\n"
+                "end\n", k_deltaTime).c_str(), "ScriptCanvasNativeBenchmarks");
+        }
+
+        void internalTearDown()
+        {
+            delete m_scriptContext;
+            m_scriptContext = nullptr;
+
+            m_application->Destroy();
+            delete m_application;
+            m_application = nullptr;
+        }
+
+        AZ::ComponentApplication* m_application = nullptr;
+        AZ::ScriptContext* m_scriptContext = nullptr;
+    };
+
+    BENCHMARK_DEFINE_F(ScriptCanvasNativeBenchmarkFixture, BM_PerTick_Lua)(benchmark::State& state)
+    {
+        for ([[maybe_unused]] auto _ : state)
+        {
+            AZ::ScriptDataContext call;
+            if (m_scriptContext->Call("Tick", call))
+            {
+                call.CallExecute();
+            }
+        }
+
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // calls the way the C++ translation called them before it spelled out the function types, through BehaviorMethod::Invoke
+    BENCHMARK_DEFINE_F(ScriptCanvasNativeBenchmarkFixture, BM_PerTick_NativeMethod)(benchmark::State& state)
+    {
+        const NativeMethod multiplyFloat("Vector3", "MultiplyFloat");
+        const NativeMethod add("Vector3", "Add");
+        const NativeMethod getLength("Vector3", "GetLength");
+
+        Data::Vector3Type position = Data::Vector3Type::CreateZero();
+        const Data::Vector3Type velocity(1.0f, 2.0f, 3.0f);
+        Data::NumberType outside = 0.0;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            Data::Vector3Type step{};
+            multiplyFloat.InvokeResult(step, velocity, k_deltaTime);
+            Data::Vector3Type next{};
+            add.InvokeResult(next, position, step);
+            position = next;
+
+            float length{};
+            getLength.InvokeResult(length, position);
+            if (length > 1000.0f)
+            {
+                outside = outside + 1.0;
+            }
+        }
+
+        benchmark::DoNotOptimize(outside);
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    // calls the way the C++ translation calls them, through the function pointers the BehaviorMethods hold
+    BENCHMARK_DEFINE_F(ScriptCanvasNativeBenchmarkFixture, BM_PerTick_NativeFunction)(benchmark::State& state)
+    {
+        const NativeFunction<Data::Vector3Type(Data::Vector3Type::*)(float)> multiplyFloat("Vector3", "MultiplyFloat");
+        const NativeFunction<Data::Vector3Type(Data::Vector3Type::*)(const Data::Vector3Type&)> add("Vector3", "Add");
+        const NativeFunction<float(Data::Vector3Type::*)()> getLength("Vector3", "GetLength");
+
+        Data::Vector3Type position = Data::Vector3Type::CreateZero();
+        const Data::Vector3Type velocity(1.0f, 2.0f, 3.0f);
+        Data::NumberType outside = 0.0;
+
+        for ([[maybe_unused]] auto _ : state)
+        {
+            Data::Vector3Type step{};
+            multiplyFloat.InvokeResult(step, velocity, k_deltaTime);
+            Data::Vector3Type next{};
+            add.InvokeResult(next, position, step);
+            position = next;
+
+            float length{};
+            getLength.InvokeResult(length, position);
+            if (length > 1000.0f)
+            {
+                outside = outside + 1.0;
+            }
+        }
+
+        benchmark::DoNotOptimize(outside);
+        state.SetItemsProcessed(state.iterations());
+    }
+
+    BENCHMARK_REGISTER_F(ScriptCanvasNativeBenchmarkFixture, BM_PerTick_Lua);
+    BENCHMARK_REGISTER_F(ScriptCanvasNativeBenchmarkFixture, BM_PerTick_NativeMethod);
+    BENCHMARK_REGISTER_F(ScriptCanvasNativeBenchmarkFixture, BM_PerTick_NativeFunction);
+}
+#endif
@@ -0,0 +1,181 @@
+/*
+ * Copyright (c) Contributors to the Open 3D Engine Project.
+ * For complete copyright and license terms please see the LICENSE at the root of this distribution.
+ *
+ * SPDX-License-Identifier: Apache-2.0 OR MIT
+ *
+ */
+
+#include <AzCore/Math/Vector3.h>
+#include <AzCore/RTTI/BehaviorContext.h>
+#include <AzCore/std/string/string.h>
+#include <ScriptCanvas/Execution/Native/ExecutionStateNative.h>
+#include <ScriptCanvas/Execution/NativeHostDefinitions.h>
+#include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
+#include <ScriptCanvas/Translation/GraphToCPlusPlus.h>
+#include <ScriptCanvas/Translation/Translation.h>
+#include <Source/Framework/ScriptCanvasTestFixture.h>
+#include <Source/Framework/ScriptCanvasTestUtilities.h>
+
+using namespace ScriptCanvas;
+using namespace ScriptCanvasTests;
+
+namespace NativeTestCPP
+{
+    int s_graphStartCount = 0;
+
+    void OnGraphStart(const RuntimeContext&)
+    {
+        ++s_graphStartCount;
+    }
+
+    Translation::Result TranslateToNative(const Graph& graph)
+    {
+        Grammar::Request request;
+        request.graph = &graph;
+        request.name = "NativeTestGraph";
+        request.translationTargetFlags = Translation::TargetFlags::Lua | Translation::TargetFlags::Cpp | Translation::TargetFlags::Hpp;
+        request.addDebugInformation = false;
+        return Translation::ParseAndTranslateGraph(request);
+    }
+
+    AZStd::string GetTranslation(const Translation::Result& result, Translation::TargetFlags flag)
+    {
+        auto iter = result.m_translations.find(flag);
+        return iter != result.m_translations.end() ? iter->second.m_text : AZStd::string();
+    }
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeMethod_Vector3GetLength_InvokesBehaviorMethod)
+{
+    const NativeMethod getLength("Vector3", "GetLength");
+    ASSERT_NE(getLength.Get(), nullptr);
+
+    float length = 0.0f;
+    EXPECT_TRUE(getLength.InvokeResult(length, AZ::Vector3(3.0f, 4.0f, 0.0f)));
+    EXPECT_FLOAT_EQ(length, 5.0f);
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeGraphStart_Registered_IsCalledUntilUnregistered)
+{
+    using namespace NativeTestCPP;
+
+    const AZStd::string name = AZ::Uuid::CreateRandom().ToString<AZStd::string>();
+    const RuntimeContext context{ AZ::EntityId() };
+    s_graphStartCount = 0;
+
+    EXPECT_FALSE(IsNativeGraphStartRegistered(name));
+    EXPECT_FALSE(CallNativeGraphStart(name, context));
+
+    EXPECT_TRUE(RegisterNativeGraphStart(name, &OnGraphStart));
+    EXPECT_TRUE(IsNativeGraphStartRegistered(name));
+    EXPECT_TRUE(CallNativeGraphStart(name, context));
+    EXPECT_EQ(s_graphStartCount, 1);
+
+    EXPECT_TRUE(UnregisterNativeGraphStart(name));
+    EXPECT_FALSE(IsNativeGraphStartRegistered(name));
+    EXPECT_FALSE(CallNativeGraphStart(name, context));
+    EXPECT_EQ(s_graphStartCount, 1);
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeFunction_Vector3GetLength_CallsFunctionPointer)
+{
+    const NativeFunction<float(Data::Vector3Type::*)()> getLength("Vector3", "GetLength");
+    EXPECT_NE(getLength.Get(), nullptr);
+
+    float length = 0.0f;
+    EXPECT_TRUE(getLength.InvokeResult(length, Data::Vector3Type(3.0f, 4.0f, 0.0f)));
+    EXPECT_FLOAT_EQ(length, 5.0f);
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeFunction_SignatureMismatch_FallsBackToBehaviorMethod)
+{
+    const NativeFunction<double(Data::Vector3Type::*)()> getLength("Vector3", "GetLength");
+    EXPECT_EQ(getLength.Get(), nullptr);
+
+    float length = 0.0f;
+    EXPECT_TRUE(getLength.InvokeResult(length, Data::Vector3Type(3.0f, 4.0f, 0.0f)));
+    EXPECT_FLOAT_EQ(length, 5.0f);
+}
+
+TEST_F(ScriptCanvasTestFixture, NativeGraphStart_Fingerprint_IsStoredWithRegistration)
+{
+    using namespace NativeTestCPP;
+
+    const AZStd::string name = AZ::Uuid::CreateRandom().ToString<AZStd::string>();
+    AZ::u32 fingerprint = 0;
+    EXPECT_FALSE(GetNativeGraphStartFingerprint(name, fingerprint));
+
+    EXPECT_TRUE(RegisterNativeGraphStart(name, &OnGraphStart, 0x1234u));
+    EXPECT_TRUE(GetNativeGraphStartFingerprint(name, fingerprint));
+    EXPECT_EQ(fingerprint, 0x1234u);
+
+    EXPECT_TRUE(UnregisterNativeGraphStart(name));
+}
+
+TEST_F(ScriptCanvasTestFixture, ExecutionStateNative_IsAvailable_RequiresMatchingFingerprint)
+{
+    using namespace NativeTestCPP;
+
+    const AZ::Data::AssetId assetId(AZ::Uuid::CreateRandom());
+    const AZStd::string name = ExecutionStateNativeOnGraphStart::GetRegisteredName(assetId);
+    constexpr AZ::u32 fingerprint = 0xCAFEu;
+
+    EXPECT_FALSE(ExecutionStateNativeOnGraphStart::IsAvailable(assetId, fingerprint));
+
+    EXPECT_TRUE(RegisterNativeGraphStart(name, &OnGraphStart, fingerprint));
+    EXPECT_TRUE(ExecutionStateNativeOnGraphStart::IsAvailable(assetId, fingerprint));
+
+    // the graph was edited after the C++ was generated from it
+    EXPECT_FALSE(ExecutionStateNativeOnGraphStart::IsAvailable(assetId, fingerprint + 1));
+
+    {
+        const bool executeNativeGraphs = Grammar::g_executeNativeGraphs;
+        Grammar::g_executeNativeGraphs = false;
+        const bool isAvailable = ExecutionStateNativeOnGraphStart::IsAvailable(assetId, fingerprint);
+        Grammar::g_executeNativeGraphs = executeNativeGraphs;
+        EXPECT_FALSE(isAvailable);
+    }
+
+    EXPECT_TRUE(UnregisterNativeGraphStart(name));
+}
+
+TEST_F(ScriptCanvasTestFixture, GraphToCPlusPlus_Translate_RegistersWithFingerprintOfGraph)
+{
+    using namespace NativeTestCPP;
+
+    ScriptCanvas::Graph* graph = nullptr;
+    SystemRequestBus::BroadcastResult(graph, &SystemRequests::MakeGraph);
+    ASSERT_NE(graph, nullptr);
+    graph->GetEntity()->Init();
+
+    const ScriptCanvasId& graphUniqueId = graph->GetScriptCanvasId();
+
+    AZ::EntityId startID;
+    CreateTestNode<ScriptCanvas::Nodes::Core::Start>(graphUniqueId, startID);
+    const AZ::EntityId getLengthID = CreateClassFunctionNode(graphUniqueId, "Vector3", "GetLength");
+    EXPECT_TRUE(Connect(*graph, startID, "Out", getLengthID, "In"));
+
+    const Translation::Result result = TranslateToNative(*graph);
+    EXPECT_TRUE(result.TranslationSucceed(Translation::TargetFlags::Lua));
+    EXPECT_TRUE(result.TranslationSucceed(Translation::TargetFlags::Cpp));
+    EXPECT_TRUE(result.TranslationSucceed(Translation::TargetFlags::Hpp));
+
+    const AZ::u32 fingerprint = Translation::GraphToCPlusPlus::GetFingerprint(GetTranslation(result, Translation::TargetFlags::Lua));
+    const AZStd::string dotCPP = GetTranslation(result, Translation::TargetFlags::Cpp);
+    EXPECT_NE(dotCPP.find("NativeFunction<"), AZStd::string::npos);
+    EXPECT_NE(dotCPP.find("RegisterNativeGraphStart"), AZStd::string::npos);
+    EXPECT_NE(dotCPP.find(AZStd::string::format("0x%08xu", fingerprint)), AZStd::string::npos);
+
+    // editing the graph changes the fingerprint, so the C++ translated before the edit is no longer executed
+    const AZ::EntityId getLengthAgainID = CreateClassFunctionNode(graphUniqueId, "Vector3", "GetLength");
+    EXPECT_TRUE(Connect(*graph, getLengthID, "Out", getLengthAgainID, "In"));
+
+    const Translation::Result editedResult = TranslateToNative(*graph);
+    EXPECT_TRUE(editedResult.TranslationSucceed(Translation::TargetFlags::Cpp));
+    const AZ::u32 editedFingerprint = Translation::GraphToCPlusPlus::GetFingerprint(GetTranslation(editedResult, Translation::TargetFlags::Lua));
+    EXPECT_NE(editedFingerprint, fingerprint);
+    EXPECT_NE(GetTranslation(editedResult, Translation::TargetFlags::Cpp).find(AZStd::string::format("0x%08xu", editedFingerprint)), AZStd::string::npos);
+
+    delete graph->GetEntity();
+}
@@ -13,8 +13,12 @@
 #include <ScriptCanvas/Core/EBusHandler.h>
 #include <ScriptCanvas/Core/SubgraphInterfaceUtility.h>
 #include <ScriptCanvas/Core/Nodeable.h>
+#include <AzCore/Script/ScriptContext.h>
+#include <AzCore/Script/lua/lua.h>
 #include <ScriptCanvas/Execution/Interpreted/ExecutionInterpretedAPI.h>
+#include <ScriptCanvas/Execution/Interpreted/ExecutionInterpretedThunks.h>
 #include <ScriptCanvas/Execution/NodeableOut/NodeableOutNative.h>
+#include <ScriptCanvas/Grammar/PrimitivesDeclarations.h>
 #include <Source/Framework/ScriptCanvasTestFixture.h>
 #include <Source/Framework/ScriptCanvasTestNodes.h>
 #include <Source/Framework/ScriptCanvasTestUtilities.h>
@@ -935,3 +939,117 @@ TEST_F(ScriptCanvasTestFixture, InterpretedExecutionOutPerformance)
 {
     RunUnitTestGraph("LY_SC_UnitTest_ExecutionOutPerformance", ExecutionMode::Interpreted);
 }
+
+TEST_F(ScriptCanvasTestFixture, InterpretedThunk_MatchesReflectedSignature_CallsMethod)
+{
+    const AZ::BehaviorClass* vector3Class = m_behaviorContext->m_classes.find("Vector3")->second;
+    const AZ::BehaviorMethod* getLength = vector3Class->m_methods.find("GetLength")->second;
+    const AZ::BehaviorMethod* cross = vector3Class->m_methods.find("Cross")->second;
+
+    const InterpretedThunk* thunk = FindInterpretedThunk("Vector3", "GetLength", *getLength);
+    ASSERT_NE(thunk, nullptr);
+    // a thunk is never used for a method with another signature
+    EXPECT_EQ(FindInterpretedThunk("Vector3", "GetLength", *cross), nullptr);
+
+    AZ::ScriptContext scriptContext;
+    scriptContext.BindTo(m_behaviorContext);
+    RegisterInterpretedThunks(scriptContext.NativeContext());
+
+    const AZStd::string script = AZStd::string::format(
+        "local v = Vector3(3, 4, 0)\n"
+        "length = %s(v)\n"
+        "crossed = SCRIPT_CANVAS_THUNK_Vector3_Cross(v, Vector3(0, 0, 1))\n", thunk->m_globalName.c_str());
+    EXPECT_TRUE(scriptContext.Execute(script.c_str(), "InterpretedThunk_MatchesReflectedSignature_CallsMethod"));
+
+    lua_State* lua = scriptContext.NativeContext();
+    lua_getglobal(lua, "length");
+    EXPECT_FLOAT_EQ(aznumeric_cast<float>(lua_tonumber(lua, -1)), 5.0f);
+    lua_getglobal(lua, "crossed");
+    const AZ::Vector3* crossed = AZ::ScriptValue<AZ::Vector3*>::StackRead(lua, -1);
+    ASSERT_NE(crossed, nullptr);
+    EXPECT_TRUE(crossed->IsClose(AZ::Vector3(4.0f, -3.0f, 0.0f)));
+    lua_pop(lua, 2);
+}
+
+#if defined(SCRIPT_CANVAS_PERFORMANCE_TRACKING_ENABLED)
+TEST_F(ScriptCanvasTestFixture, InterpretedThunk_TrackedCalls_CountedByNodeId)
+{
+    const AZ::BehaviorClass* vector3Class = m_behaviorContext->m_classes.find("Vector3")->second;
+    const AZ::BehaviorMethod* getLength = vector3Class->m_methods.find("GetLength")->second;
+    const InterpretedThunk* thunk = FindInterpretedThunk("Vector3", "GetLength", *getLength);
+    ASSERT_NE(thunk, nullptr);
+
+    AZ::ScriptContext scriptContext;
+    scriptContext.BindTo(m_behaviorContext);
+    RegisterInterpretedThunks(scriptContext.NativeContext());
+
+    // drop the calls made by other tests
+    PerformanceReportByNode reports;
+    CollectInterpretedThunkReports(reports);
+    reports.clear();
+
+    // two nodes calling the same method, with ids that don't fit in a Lua number
+    const AZ::EntityId firstNodeId(0xFEDCBA9876543211ull);
+    const AZ::EntityId secondNodeId(0xFEDCBA9876543212ull);
+    const AZStd::string script = AZStd::string::format(
+        "local v = Vector3(3, 4, 0)\n"
+        "length = %s('%llu', v)\n"
+        "%s('%llu', v)\n"
+        "%s('%llu', v)\n"
+        , thunk->m_trackedGlobalName.c_str(), static_cast<unsigned long long>(static_cast<AZ::u64>(firstNodeId))
+        , thunk->m_trackedGlobalName.c_str(), static_cast<unsigned long long>(static_cast<AZ::u64>(secondNodeId))
+        , thunk->m_trackedGlobalName.c_str(), static_cast<unsigned long long>(static_cast<AZ::u64>(secondNodeId)));
+    EXPECT_TRUE(scriptContext.Execute(script.c_str(), "InterpretedThunk_TrackedCalls_CountedByNodeId"));
+
+    lua_State* lua = scriptContext.NativeContext();
+    lua_getglobal(lua, "length");
+    EXPECT_FLOAT_EQ(aznumeric_cast<float>(lua_tonumber(lua, -1)), 5.0f);
+    lua_pop(lua, 1);
+
+    CollectInterpretedThunkReports(reports);
+    EXPECT_EQ(reports.size(), 2);
+    EXPECT_EQ(reports[firstNodeId].callCount, 1);
+    EXPECT_EQ(reports[secondNodeId].callCount, 2);
+
+    // the counts restart after each collection
+    reports.clear();
+    CollectInterpretedThunkReports(reports);
+    EXPECT_TRUE(reports.empty());
+}
+
+TEST_F(ScriptCanvasTestFixture, InterpretedTrackedCall_AnyFunction_CountedByNodeIdAndReturnsAllResults)
+{
+    AZ::ScriptContext scriptContext;
+    scriptContext.BindTo(m_behaviorContext);
+    RegisterInterpretedThunks(scriptContext.NativeContext());
+
+    // drop the calls made by other tests
+    PerformanceReportByNode reports;
+    CollectInterpretedThunkReports(reports);
+    reports.clear();
+
+    const AZ::EntityId methodNodeId(0xFEDCBA9876543213ull);
+    const AZ::EntityId functionNodeId(0xFEDCBA9876543214ull);
+    const AZStd::string script = AZStd::string::format(
+        "local v = Vector3(3, 4, 0)\n"
+        "length = %s('%llu', Vector3.GetLength, v)\n"
+        "first, second = %s('%llu', function(a, b) return b, a end, 1, 2)\n"
+        , ScriptCanvas::Grammar::k_InterpretedTrackedCallName, static_cast<unsigned long long>(static_cast<AZ::u64>(methodNodeId))
+        , ScriptCanvas::Grammar::k_InterpretedTrackedCallName, static_cast<unsigned long long>(static_cast<AZ::u64>(functionNodeId)));
+    EXPECT_TRUE(scriptContext.Execute(script.c_str(), "InterpretedTrackedCall_AnyFunction_CountedByNodeIdAndReturnsAllResults"));
+
+    lua_State* lua = scriptContext.NativeContext();
+    lua_getglobal(lua, "length");
+    lua_getglobal(lua, "first");
+    lua_getglobal(lua, "second");
+    EXPECT_FLOAT_EQ(aznumeric_cast<float>(lua_tonumber(lua, -3)), 5.0f);
+    EXPECT_EQ(lua_tonumber(lua, -2), 2.0);
+    EXPECT_EQ(lua_tonumber(lua, -1), 1.0);
+    lua_pop(lua, 3);
+
+    CollectInterpretedThunkReports(reports);
+    EXPECT_EQ(reports.size(), 2);
+    EXPECT_EQ(reports[methodNodeId].callCount, 1);
+    EXPECT_EQ(reports[functionNodeId].callCount, 1);
+}
+#endif
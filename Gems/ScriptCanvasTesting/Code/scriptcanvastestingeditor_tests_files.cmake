@@ -15,6 +15,7 @@ set(FILES
     Source/Framework/ScriptCanvasTestUtilities.cpp
     Source/Framework/ScriptCanvasTestApplication.h
     Source/Framework/EntityRefTests.h
+    Tests/ScriptCanvasNativeBenchmarks.cpp
     Tests/ScriptCanvasTestingTest.cpp
     Tests/ScriptCanvas_BehaviorContext.cpp
     Tests/ScriptCanvas_ContainerSupport.cpp
@@ -22,6 +23,7 @@ set(FILES
     Tests/ScriptCanvas_EventHandlers.cpp
     Tests/ScriptCanvas_Math.cpp
     Tests/ScriptCanvas_MethodOverload.cpp
+    Tests/ScriptCanvas_Native.cpp
     Tests/ScriptCanvas_NodeGenerics.cpp
     Tests/ScriptCanvas_Regressions.cpp
     Tests/ScriptCanvas_RuntimeInterpreted.cpp
@@ -41,6 +41,11 @@ namespace SurfaceData
         virtual void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags,
                                                 SurfacePointListPerPosition& surfacePointListPerPosition) const = 0;
 
+        // Same as GetSurfacePointsFromRegion, but the points are returned in a flat buffer, which is cleared first.  Callers that
+        // query regions repeatedly should keep the buffer, since it reuses its memory from one query to the next.
+        virtual void GetSurfacePointBufferFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags,
+                                                     SurfacePointBuffer& surfacePoints) const = 0;
+
         virtual SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry) = 0;
         virtual void UnregisterSurfaceDataProvider(const SurfaceDataRegistryHandle& handle) = 0;
         virtual void UpdateSurfaceDataProvider(const SurfaceDataRegistryHandle& handle, const SurfaceDataRegistryEntry& entry) = 0;
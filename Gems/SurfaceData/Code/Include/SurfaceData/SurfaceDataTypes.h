@@ -11,14 +11,161 @@
 #include <AzCore/Math/Aabb.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Memory/SystemAllocator.h>
+#include <AzCore/std/algorithm.h>
 #include <AzCore/std/string/string.h>
+#include <AzCore/std/containers/fixed_vector.h>
 #include <AzCore/std/containers/unordered_set.h>
+#include <AzCore/std/containers/vector.h>
+#include <AzCore/std/utils.h>
 #include <SurfaceData/SurfaceTag.h>
 
 namespace SurfaceData
 {
+    //! Flat map of surface tag crc to contribution factor.
+    //! Surface points carry only a handful of tags, so the tags are stored in place with a fixed capacity instead of in a hash map,
+    //! and copying or clearing the weights of a point never allocates.  The interface is the subset of AZStd::unordered_map
+    //! that surface data code uses.
+    class SurfaceTagWeights final
+    {
+    public:
+        AZ_TYPE_INFO(SurfaceTagWeights, "{A9A6C5A4-5A8B-4B3F-9C93-1E3A8C7DAB7E}");
+
+        //! The most tags a single point can carry.  Adding a tag past this replaces the tag with the lowest weight,
+        //! see AddOrReplace().
+        static constexpr size_t MaxSurfaceWeights = 16;
+
+        using value_type = AZStd::pair<AZ::Crc32, float>;
+        using container_type = AZStd::fixed_vector<value_type, MaxSurfaceWeights>;
+        using iterator = container_type::iterator;
+        using const_iterator = container_type::const_iterator;
+        using size_type = container_type::size_type;
+
+        iterator begin() { return m_weights.begin(); }
+        iterator end() { return m_weights.end(); }
+        const_iterator begin() const { return m_weights.begin(); }
+        const_iterator end() const { return m_weights.end(); }
+
+        size_type size() const { return m_weights.size(); }
+        bool empty() const { return m_weights.empty(); }
+        void clear() { m_weights.clear(); }
+
+        iterator find(const AZ::Crc32 tag)
+        {
+            return AZStd::find_if(m_weights.begin(), m_weights.end(), [tag](const value_type& weight) { return weight.first == tag; });
+        }
+
+        const_iterator find(const AZ::Crc32 tag) const
+        {
+            return AZStd::find_if(m_weights.begin(), m_weights.end(), [tag](const value_type& weight) { return weight.first == tag; });
+        }
+
+        size_type count(const AZ::Crc32 tag) const
+        {
+            return find(tag) != end() ? 1 : 0;
+        }
+
+        //! Returns the weight of the tag, adding the tag with a weight of 0 if it isn't present.
+        //! When all of the tags are in use, the tag with the lowest weight is replaced before the new weight is known,
+        //! so code that adds tags to full weights should use AddOrReplace() instead.
+        float& operator[](const AZ::Crc32 tag)
+        {
+            auto weightItr = find(tag);
+            if (weightItr != m_weights.end())
+            {
+                return weightItr->second;
+            }
+
+            if (m_weights.size() == MaxSurfaceWeights)
+            {
+                auto lowestItr = FindLowestWeight();
+                *lowestItr = value_type(tag, 0.0f);
+                return lowestItr->second;
+            }
+            m_weights.emplace_back(tag, 0.0f);
+            return m_weights.back().second;
+        }
+
+        //! Sets the weight of the tag, adding the tag if it isn't present.  When all of the tags are in use, a new tag only
+        //! replaces the tag with the lowest weight if its own weight is higher.
+        //! Returns false if the tag wasn't added.
+        bool AddOrReplace(const AZ::Crc32 tag, const float weight)
+        {
+            auto weightItr = find(tag);
+            if (weightItr != m_weights.end())
+            {
+                weightItr->second = weight;
+                return true;
+            }
+
+            if (m_weights.size() == MaxSurfaceWeights)
+            {
+                auto lowestItr = FindLowestWeight();
+                if (weight <= lowestItr->second)
+                {
+                    return false;
+                }
+                *lowestItr = value_type(tag, weight);
+                return true;
+            }
+
+            m_weights.emplace_back(tag, weight);
+            return true;
+        }
+
+        size_type erase(const AZ::Crc32 tag)
+        {
+            auto weightItr = find(tag);
+            if (weightItr == m_weights.end())
+            {
+                return 0;
+            }
+            m_weights.erase(weightItr);
+            return 1;
+        }
+
+        //! Order independent, like the comparison of two maps.
+        bool operator==(const SurfaceTagWeights& rhs) const
+        {
+            if (m_weights.size() != rhs.m_weights.size())
+            {
+                return false;
+            }
+
+            for (const auto& weight : m_weights)
+            {
+                auto rhsItr = rhs.find(weight.first);
+                if (rhsItr == rhs.end() || rhsItr->second != weight.second)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool operator!=(const SurfaceTagWeights& rhs) const
+        {
+            return !(*this == rhs);
+        }
+
+    private:
+        iterator FindLowestWeight()
+        {
+            auto lowestItr = m_weights.begin();
+            for (auto weightItr = m_weights.begin(); weightItr != m_weights.end(); ++weightItr)
+            {
+                if (weightItr->second < lowestItr->second)
+                {
+                    lowestItr = weightItr;
+                }
+            }
+            return lowestItr;
+        }
+
+        container_type m_weights;
+    };
+
     //map of id or crc to contribution factor
-    using SurfaceTagWeightMap = AZStd::unordered_map<AZ::Crc32, float>;
+    using SurfaceTagWeightMap = SurfaceTagWeights;
     using SurfaceTagNameSet = AZStd::unordered_set<AZStd::string>;
     using SurfaceTagVector = AZStd::vector<SurfaceTag>;
 
@@ -36,6 +183,86 @@ namespace SurfaceData
     using SurfacePointList = AZStd::vector<SurfacePoint>;
     using SurfacePointListPerPosition = AZStd::vector<AZStd::pair<AZ::Vector3, SurfacePointList>>;
 
+    //! Flat storage for the surface points of many input positions, as returned by region queries.
+    //! Each attribute of the points is kept in its own array, and the points of every input position are stored contiguously,
+    //! so a region query fills a handful of arrays instead of one list per position.  Clear() keeps the memory, so a buffer
+    //! that is reused for queries of the same size doesn't allocate.
+    class SurfacePointBuffer final
+    {
+    public:
+        AZ_CLASS_ALLOCATOR(SurfacePointBuffer, AZ::SystemAllocator, 0);
+
+        void Clear()
+        {
+            m_inputPositions.clear();
+            m_firstPointIndices.clear();
+            m_entityIds.clear();
+            m_positions.clear();
+            m_normals.clear();
+            m_masks.clear();
+        }
+
+        void Reserve(size_t inputPositionCount, size_t pointCount)
+        {
+            m_inputPositions.reserve(inputPositionCount);
+            m_firstPointIndices.reserve(inputPositionCount);
+            m_entityIds.reserve(pointCount);
+            m_positions.reserve(pointCount);
+            m_normals.reserve(pointCount);
+            m_masks.reserve(pointCount);
+        }
+
+        //! Starts the points of a new input position.  Points that are added belong to the last input position added.
+        void AddInputPosition(const AZ::Vector3& inPosition)
+        {
+            m_inputPositions.push_back(inPosition);
+            m_firstPointIndices.push_back(m_positions.size());
+        }
+
+        void AddSurfacePoint(const AZ::EntityId& entityId, const AZ::Vector3& position, const AZ::Vector3& normal, const SurfaceTagWeights& masks)
+        {
+            AZ_Assert(!m_inputPositions.empty(), "An input position has to be added before its surface points");
+            m_entityIds.push_back(entityId);
+            m_positions.push_back(position);
+            m_normals.push_back(normal);
+            m_masks.push_back(masks);
+        }
+
+        void AddSurfacePoint(const SurfacePoint& point)
+        {
+            AddSurfacePoint(point.m_entityId, point.m_position, point.m_normal, point.m_masks);
+        }
+
+        size_t GetInputPositionCount() const { return m_inputPositions.size(); }
+        const AZ::Vector3& GetInputPosition(size_t inputIndex) const { return m_inputPositions[inputIndex]; }
+
+        //! The points of an input position are [GetFirstPointIndex(inputIndex), GetFirstPointIndex(inputIndex) + GetPointCount(inputIndex)).
+        size_t GetFirstPointIndex(size_t inputIndex) const { return m_firstPointIndices[inputIndex]; }
+        size_t GetPointCount(size_t inputIndex) const
+        {
+            const size_t endIndex = (inputIndex + 1 < m_firstPointIndices.size()) ? m_firstPointIndices[inputIndex + 1] : m_positions.size();
+            return endIndex - m_firstPointIndices[inputIndex];
+        }
+
+        size_t GetPointCount() const { return m_positions.size(); }
+        bool IsEmpty() const { return m_positions.empty(); }
+
+        const AZ::EntityId& GetEntityId(size_t pointIndex) const { return m_entityIds[pointIndex]; }
+        const AZ::Vector3& GetPosition(size_t pointIndex) const { return m_positions[pointIndex]; }
+        const AZ::Vector3& GetNormal(size_t pointIndex) const { return m_normals[pointIndex]; }
+        const SurfaceTagWeights& GetMasks(size_t pointIndex) const { return m_masks[pointIndex]; }
+        SurfaceTagWeights& GetMasks(size_t pointIndex) { return m_masks[pointIndex]; }
+
+    private:
+        AZStd::vector<AZ::Vector3> m_inputPositions;
+        AZStd::vector<size_t> m_firstPointIndices;
+
+        AZStd::vector<AZ::EntityId> m_entityIds;
+        AZStd::vector<AZ::Vector3> m_positions;
+        AZStd::vector<AZ::Vector3> m_normals;
+        AZStd::vector<SurfaceTagWeights> m_masks;
+    };
+
     struct SurfaceDataRegistryEntry
     {
         AZ::EntityId m_entityId;
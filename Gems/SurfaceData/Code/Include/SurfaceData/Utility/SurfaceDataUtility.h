@@ -92,7 +92,7 @@ namespace SurfaceData
     {
         const auto maskItr = masks.find(tag);
         const float valueOld = maskItr != masks.end() ? maskItr->second : 0.0f;
-        masks[tag] = AZ::GetMax(value, valueOld);
+        masks.AddOrReplace(tag, AZ::GetMax(value, valueOld));
     }
 
     AZ_INLINE void AddMaxValueForMasks(SurfaceTagWeightMap& masks, const SurfaceTagVector& tags, const float value)
@@ -10,6 +10,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
 #include <AzCore/Serialization/EditContext.h>
+#include <AzCore/std/containers/unordered_map.h>
 #include <AzCore/std/sort.h>
 
 #include "SurfaceDataSystemComponent.h"
@@ -52,7 +53,19 @@ namespace SurfaceData
                 ->Property("entityId", BehaviorValueProperty(&SurfacePoint::m_entityId))
                 ->Property("position", BehaviorValueProperty(&SurfacePoint::m_position))
                 ->Property("normal", BehaviorValueProperty(&SurfacePoint::m_normal))
-                ->Property("masks", BehaviorValueProperty(&SurfacePoint::m_masks))
+                ->Property("masks",
+                    [](SurfacePoint* point)
+                    {
+                        return AZStd::unordered_map<AZ::Crc32, float>(point->m_masks.begin(), point->m_masks.end());
+                    },
+                    [](SurfacePoint* point, const AZStd::unordered_map<AZ::Crc32, float>& masks)
+                    {
+                        point->m_masks.clear();
+                        for (const auto& mask : masks)
+                        {
+                            point->m_masks.AddOrReplace(mask.first, mask.second);
+                        }
+                    })
                 ;
 
             behaviorContext->Class<SurfaceDataSystemComponent>()
@@ -314,6 +327,85 @@ namespace SurfaceData
         }
     }
 
+    void SurfaceDataSystemComponent::GetSurfacePointBufferFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, SurfacePointBuffer& surfacePoints) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
+        AZStd::lock_guard<decltype(m_registrationMutex)> registrationLock(m_registrationMutex);
+
+        const size_t inputPositionCount = aznumeric_cast<size_t>(ceil(inRegion.GetXExtent() / stepSize.GetX())) * aznumeric_cast<size_t>(ceil(inRegion.GetYExtent() / stepSize.GetY()));
+        surfacePoints.Clear();
+        surfacePoints.Reserve(inputPositionCount, inputPositionCount);
+
+        const bool hasDesiredTags = HasValidTags(desiredTags);
+        const bool hasModifierTags = hasDesiredTags && HasMatchingTags(desiredTags, m_registeredModifierTags);
+
+        // Check the tags and the overall AABB bounds of each provider and modifier once for the region, instead of once per point.
+        m_regionProviders.clear();
+        for (const auto& entryPair : m_registeredSurfaceDataProviders)
+        {
+            const SurfaceDataRegistryEntry& entry = entryPair.second;
+            if ((!hasDesiredTags || hasModifierTags || HasMatchingTags(desiredTags, entry.m_tags)) &&
+                (!entry.m_bounds.IsValid() || AabbOverlaps2D(entry.m_bounds, inRegion)))
+            {
+                m_regionProviders.emplace_back(entryPair.first, &entry);
+            }
+        }
+
+        m_regionModifiers.clear();
+        for (const auto& entryPair : m_registeredSurfaceDataModifiers)
+        {
+            const SurfaceDataRegistryEntry& entry = entryPair.second;
+            if (!entry.m_bounds.IsValid() || AabbOverlaps2D(entry.m_bounds, inRegion))
+            {
+                m_regionModifiers.emplace_back(entryPair.first, &entry);
+            }
+        }
+
+        // The points of each input position are gathered, modified, combined and filtered in a list that is reused for every
+        // position, and then appended to the buffer.  This is inclusive on the min sides of inRegion, and exclusive on the max sides.
+        for (float y = inRegion.GetMin().GetY(); y < inRegion.GetMax().GetY(); y += stepSize.GetY())
+        {
+            for (float x = inRegion.GetMin().GetX(); x < inRegion.GetMax().GetX(); x += stepSize.GetX())
+            {
+                surfacePoints.AddInputPosition(AZ::Vector3(x, y, AZ::Constants::FloatMax));
+
+                m_regionPointList.clear();
+                for (const auto& provider : m_regionProviders)
+                {
+                    const SurfaceDataRegistryEntry& entry = *provider.second;
+                    AZ::Vector3 point3d(x, y, entry.m_bounds.GetMax().GetZ());
+                    if (!entry.m_bounds.IsValid() || entry.m_bounds.Contains(point3d))
+                    {
+                        SurfaceDataProviderRequestBus::Event(provider.first, &SurfaceDataProviderRequestBus::Events::GetSurfacePoints, point3d, m_regionPointList);
+                    }
+                }
+
+                if (m_regionPointList.empty())
+                {
+                    continue;
+                }
+
+                for (const auto& modifier : m_regionModifiers)
+                {
+                    const SurfaceDataRegistryEntry& entry = *modifier.second;
+                    AZ::Vector3 point3d(x, y, entry.m_bounds.GetMax().GetZ());
+                    if (!entry.m_bounds.IsValid() || entry.m_bounds.Contains(point3d))
+                    {
+                        SurfaceDataModifierRequestBus::Event(modifier.first, &SurfaceDataModifierRequestBus::Events::ModifySurfacePoints, m_regionPointList);
+                    }
+                }
+
+                CombineSortAndFilterNeighboringPoints(m_regionPointList, hasDesiredTags, desiredTags);
+
+                for (const SurfacePoint& point : m_regionPointList)
+                {
+                    surfacePoints.AddSurfacePoint(point);
+                }
+            }
+        }
+    }
+
     void SurfaceDataSystemComponent::CombineSortAndFilterNeighboringPoints(SurfacePointList& sourcePointList, bool hasDesiredTags, const SurfaceTagVector& desiredTags) const
     {
         AZ_PROFILE_FUNCTION(Entity);
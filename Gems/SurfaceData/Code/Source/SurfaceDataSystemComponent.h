@@ -40,6 +40,7 @@ namespace SurfaceData
         // SurfaceDataSystemRequestBus implementation
         void GetSurfacePoints(const AZ::Vector3& inPosition, const SurfaceTagVector& desiredTags, SurfacePointList& surfacePointList) const override;
         void GetSurfacePointsFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, SurfacePointListPerPosition& surfacePointListPerPosition) const override;
+        void GetSurfacePointBufferFromRegion(const AZ::Aabb& inRegion, const AZ::Vector2 stepSize, const SurfaceTagVector& desiredTags, SurfacePointBuffer& surfacePoints) const override;
 
         SurfaceDataRegistryHandle RegisterSurfaceDataProvider(const SurfaceDataRegistryEntry& entry) override;
         void UnregisterSurfaceDataProvider(const SurfaceDataRegistryHandle& handle) override;
@@ -70,5 +71,10 @@ namespace SurfaceData
 
         //point vector reserved for reuse
         mutable SurfacePointList m_targetPointList;
+
+        //region query scratch data reserved for reuse
+        mutable SurfacePointList m_regionPointList;
+        mutable AZStd::vector<AZStd::pair<SurfaceDataRegistryHandle, const SurfaceDataRegistryEntry*>> m_regionProviders;
+        mutable AZStd::vector<AZStd::pair<SurfaceDataRegistryHandle, const SurfaceDataRegistryEntry*>> m_regionModifiers;
     };
 }
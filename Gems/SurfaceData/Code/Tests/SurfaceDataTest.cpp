@@ -743,4 +743,125 @@ TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointsFromRegion_DissimilarPoi
     }
 }
 
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfacePointBufferFromRegion_MatchesPointsPerPosition)
+{
+    // This test verifies that GetSurfacePointBufferFromRegion returns the same points, in the same order, as GetSurfacePointsFromRegion,
+    // and that a buffer reused for a second query only holds the results of that query.
+
+    SurfaceData::SurfaceTagVector providerTags = { SurfaceData::SurfaceTag(m_testSurface1Crc), SurfaceData::SurfaceTag(m_testSurface2Crc) };
+    MockSurfaceProvider mockProvider(MockSurfaceProvider::ProviderType::SURFACE_PROVIDER, providerTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(8.0f), AZ::Vector3(0.25f, 0.25f, 4.0f));
+
+    SurfaceData::SurfaceTagVector modifierTags = { SurfaceData::SurfaceTag(m_testSurface1Crc) };
+    MockSurfaceProvider mockModifier(MockSurfaceProvider::ProviderType::SURFACE_MODIFIER, modifierTags,
+                                     AZ::Vector3(0.0f), AZ::Vector3(2.0f), AZ::Vector3(0.25f, 0.25f, 4.0f));
+
+    AZ::Vector2 stepSize(1.0f, 1.0f);
+    AZ::Aabb regionBounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(4.0f));
+
+    SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
+    SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+        &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+        regionBounds, stepSize, providerTags, availablePointsPerPosition);
+
+    SurfaceData::SurfacePointBuffer surfacePoints;
+    for (int query = 0; query < 2; ++query)
+    {
+        SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointBufferFromRegion,
+            regionBounds, stepSize, providerTags, surfacePoints);
+
+        ASSERT_EQ(surfacePoints.GetInputPositionCount(), availablePointsPerPosition.size());
+        for (size_t inputIndex = 0; inputIndex < surfacePoints.GetInputPositionCount(); ++inputIndex)
+        {
+            const SurfaceData::SurfacePointList& pointList = availablePointsPerPosition[inputIndex].second;
+            EXPECT_TRUE(surfacePoints.GetInputPosition(inputIndex) == availablePointsPerPosition[inputIndex].first);
+            ASSERT_EQ(surfacePoints.GetPointCount(inputIndex), pointList.size());
+
+            const size_t firstPointIndex = surfacePoints.GetFirstPointIndex(inputIndex);
+            for (size_t pointIndex = 0; pointIndex < pointList.size(); ++pointIndex)
+            {
+                EXPECT_TRUE(surfacePoints.GetEntityId(firstPointIndex + pointIndex) == pointList[pointIndex].m_entityId);
+                EXPECT_TRUE(surfacePoints.GetPosition(firstPointIndex + pointIndex) == pointList[pointIndex].m_position);
+                EXPECT_TRUE(surfacePoints.GetNormal(firstPointIndex + pointIndex) == pointList[pointIndex].m_normal);
+                EXPECT_TRUE(surfacePoints.GetMasks(firstPointIndex + pointIndex) == pointList[pointIndex].m_masks);
+            }
+        }
+    }
+}
+
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfaceTagWeights)
+{
+    // The flat tag weights are used like a map: each tag is stored once, and comparisons don't depend on the order of the tags.
+    SurfaceData::SurfaceTagWeights weights;
+    EXPECT_TRUE(weights.empty());
+
+    SurfaceData::AddMaxValueForMasks(weights, m_testSurface1Crc, 0.5f);
+    SurfaceData::AddMaxValueForMasks(weights, m_testSurface2Crc, 0.25f);
+    SurfaceData::AddMaxValueForMasks(weights, m_testSurface1Crc, 0.75f);
+    SurfaceData::AddMaxValueForMasks(weights, m_testSurface1Crc, 0.1f);
+    EXPECT_TRUE(weights.size() == 2);
+    EXPECT_TRUE(weights[m_testSurface1Crc] == 0.75f);
+    EXPECT_TRUE(weights[m_testSurface2Crc] == 0.25f);
+    EXPECT_TRUE(SurfaceData::HasMatchingTag(weights, m_testSurface2Crc, 0.2f, 0.3f));
+
+    SurfaceData::SurfaceTagWeights reversedWeights;
+    reversedWeights[m_testSurface2Crc] = 0.25f;
+    reversedWeights[m_testSurface1Crc] = 0.75f;
+    EXPECT_TRUE(weights == reversedWeights);
+
+    reversedWeights.erase(m_testSurface2Crc);
+    EXPECT_TRUE(weights != reversedWeights);
+    EXPECT_TRUE(reversedWeights.count(m_testSurface2Crc) == 0);
+
+    // Past the capacity, new tags replace the tag with the lowest weight.
+    for (AZ::u32 tag = 1; tag < SurfaceData::SurfaceTagWeights::MaxSurfaceWeights; ++tag)
+    {
+        weights[AZ::Crc32(tag)] = 1.0f;
+    }
+    EXPECT_TRUE(weights.size() == SurfaceData::SurfaceTagWeights::MaxSurfaceWeights);
+    EXPECT_TRUE(weights.count(m_testSurface2Crc) == 0);
+    EXPECT_TRUE(weights.count(m_testSurface1Crc) == 1);
+}
+
+TEST_F(SurfaceDataTestApp, SurfaceData_TestSurfaceTagWeightsPastCapacityKeepHighestWeights)
+{
+    // Fill the weights with tags that have weights of 0.1, 0.2, ... so that the first tag has the lowest weight.
+    SurfaceData::SurfaceTagWeights weights;
+    constexpr AZ::u32 maxWeights = static_cast<AZ::u32>(SurfaceData::SurfaceTagWeights::MaxSurfaceWeights);
+    for (AZ::u32 tag = 1; tag <= maxWeights; ++tag)
+    {
+        SurfaceData::AddMaxValueForMasks(weights, AZ::Crc32(tag), tag * 0.1f);
+    }
+    EXPECT_TRUE(weights.size() == maxWeights);
+
+    // A new tag with a weight that isn't higher than the lowest weight is dropped, and nothing is evicted.
+    SurfaceData::AddMaxValueForMasks(weights, AZ::Crc32(maxWeights + 1), 0.05f);
+    EXPECT_FALSE(weights.AddOrReplace(AZ::Crc32(maxWeights + 2), 0.1f));
+    EXPECT_TRUE(weights.size() == maxWeights);
+    EXPECT_TRUE(weights.count(AZ::Crc32(maxWeights + 1)) == 0);
+    EXPECT_TRUE(weights.count(AZ::Crc32(maxWeights + 2)) == 0);
+    EXPECT_TRUE(weights.count(AZ::Crc32(1)) == 1);
+
+    // A new tag with a higher weight replaces the tag with the lowest weight.
+    SurfaceData::AddMaxValueForMasks(weights, AZ::Crc32(maxWeights + 3), 0.15f);
+    EXPECT_TRUE(weights.size() == maxWeights);
+    EXPECT_TRUE(weights.count(AZ::Crc32(1)) == 0);
+    EXPECT_TRUE(weights.find(AZ::Crc32(maxWeights + 3))->second == 0.15f);
+
+    // Tags that are already present are updated in place, even when the weights are full.
+    EXPECT_TRUE(weights.AddOrReplace(AZ::Crc32(2), 0.01f));
+    EXPECT_TRUE(weights.size() == maxWeights);
+    EXPECT_TRUE(weights.find(AZ::Crc32(2))->second == 0.01f);
+
+    // Merging more than the capacity keeps the highest weights of both sets.
+    SurfaceData::SurfaceTagWeights highWeights;
+    for (AZ::u32 tag = 1; tag <= maxWeights; ++tag)
+    {
+        highWeights.AddOrReplace(AZ::Crc32(tag + 100), 10.0f + tag);
+    }
+    SurfaceData::AddMaxValueForMasks(weights, highWeights);
+    EXPECT_TRUE(weights == highWeights);
+}
+
 AZ_UNIT_TEST_HOOK(DEFAULT_UNIT_TEST_ENV);
@@ -12,6 +12,7 @@
 #include <AzCore/Component/Entity.h>
 #include <AzCore/Component/TransformBus.h>
 #include <AzCore/Casting/lossy_cast.h>
+#include <AzCore/Debug/Profiler.h>
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
@@ -90,6 +91,9 @@ namespace Terrain
 
     void TerrainPhysicsColliderComponent::Deactivate()
     {
+        AZ::TickBus::Handler::BusDisconnect();
+        m_dirtyRegion = AZ::Aabb::CreateNull();
+
         AzFramework::Terrain::TerrainDataNotificationBus::Handler::BusDisconnect();
         Physics::HeightfieldProviderRequestsBus::Handler ::BusDisconnect();
         LmbrCentral::ShapeComponentNotificationsBus::Handler::BusDisconnect();
@@ -122,8 +126,13 @@ namespace Terrain
         LmbrCentral::ShapeComponentRequestsBus::EventResult(
             worldSize, GetEntityId(), &LmbrCentral::ShapeComponentRequestsBus::Events::GetEncompassingAabb);
 
+        NotifyListenersOfHeightfieldDataChange(worldSize);
+    }
+
+    void TerrainPhysicsColliderComponent::NotifyListenersOfHeightfieldDataChange(const AZ::Aabb& dirtyRegion)
+    {
         Physics::HeightfieldProviderNotificationBus::Broadcast(
-            &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged, worldSize);
+            &Physics::HeightfieldProviderNotificationBus::Events::OnHeightfieldDataChanged, dirtyRegion);
     }
 
     void TerrainPhysicsColliderComponent::OnShapeChanged([[maybe_unused]] ShapeChangeReasons changeReason)
@@ -149,9 +158,30 @@ namespace Terrain
     }
 
     void TerrainPhysicsColliderComponent::OnTerrainDataChanged(
-        [[maybe_unused]] const AZ::Aabb& dirtyRegion, [[maybe_unused]] TerrainDataChangedMask dataChangedMask)
+        const AZ::Aabb& dirtyRegion, [[maybe_unused]] TerrainDataChangedMask dataChangedMask)
     {
-        NotifyListenersOfHeightfieldDataChange();
+        // A null dirty region means that the entire terrain changed.
+        m_dirtyRegion.AddAabb(dirtyRegion.IsValid() ? dirtyRegion : GetHeightfieldAabb());
+
+        // Defer the notification to the next tick. This coalesces multiple changes within a frame, and lets listeners
+        // re-sample the dirty region outside of the locks held while terrain change notifications are sent.
+        if (!AZ::TickBus::Handler::BusIsConnected())
+        {
+            AZ::TickBus::Handler::BusConnect();
+        }
+    }
+
+    void TerrainPhysicsColliderComponent::OnTick([[maybe_unused]] float deltaTime, [[maybe_unused]] AZ::ScriptTimePoint time)
+    {
+        AZ::TickBus::Handler::BusDisconnect();
+
+        const AZ::Aabb dirtyRegion = m_dirtyRegion;
+        m_dirtyRegion = AZ::Aabb::CreateNull();
+
+        if (dirtyRegion.IsValid())
+        {
+            NotifyListenersOfHeightfieldDataChange(dirtyRegion);
+        }
     }
 
     AZ::Aabb TerrainPhysicsColliderComponent::GetHeightfieldAabb() const
@@ -238,6 +268,19 @@ namespace Terrain
     void TerrainPhysicsColliderComponent::GenerateHeightsAndMaterialsInBounds(
         AZStd::vector<Physics::HeightMaterialPoint>& heightMaterials) const
     {
+        int32_t gridWidth, gridHeight;
+        GetHeightfieldGridSize(gridWidth, gridHeight);
+
+        GenerateHeightsAndMaterialsInRegion(
+            0, 0, aznumeric_cast<size_t>(AZStd::max(gridWidth, 0)), aznumeric_cast<size_t>(AZStd::max(gridHeight, 0)), heightMaterials);
+    }
+
+    void TerrainPhysicsColliderComponent::GenerateHeightsAndMaterialsInRegion(
+        size_t startColumn, size_t startRow, size_t numColumns, size_t numRows,
+        AZStd::vector<Physics::HeightMaterialPoint>& heightMaterials) const
+    {
+        AZ_PROFILE_FUNCTION(Entity);
+
         const AZ::Vector2 gridResolution = GetHeightfieldGridSpacing();
 
         AZ::Aabb worldSize = GetHeightfieldAabb();
@@ -245,19 +288,20 @@ namespace Terrain
         const float worldCenterZ = worldSize.GetCenter().GetZ();
         const float worldHeightBoundsMin = worldSize.GetMin().GetZ();
         const float worldHeightBoundsMax = worldSize.GetMax().GetZ();
-
-        int32_t gridWidth, gridHeight;
-        GetHeightfieldGridSize(gridWidth, gridHeight);
+        const float worldMinX = worldSize.GetMin().GetX();
+        const float worldMinY = worldSize.GetMin().GetY();
 
         heightMaterials.clear();
-        heightMaterials.reserve(gridWidth * gridHeight);
+        heightMaterials.resize(numColumns * numRows);
 
-        for (int32_t row = 0; row < gridHeight; row++)
+        // The samples are taken one at a time through the TerrainDataRequestBus. Its handlers are guarded by a recursive mutex,
+        // so the sampling stays on this thread rather than being split into jobs that would take turns on the bus lock.
+        for (size_t row = 0; row < numRows; row++)
         {
-            const float y = row * gridResolution.GetY() + worldSize.GetMin().GetY();
-            for (int32_t col = 0; col < gridWidth; col++)
+            const float y = (startRow + row) * gridResolution.GetY() + worldMinY;
+            for (size_t col = 0; col < numColumns; col++)
             {
-                const float x = col * gridResolution.GetX() + worldSize.GetMin().GetX();
+                const float x = (startColumn + col) * gridResolution.GetX() + worldMinX;
                 float height = 0.0f;
 
                 bool terrainExists = true;
@@ -272,10 +316,10 @@ namespace Terrain
                     terrainExists = false;
                 }
 
-                Physics::HeightMaterialPoint point;
+                Physics::HeightMaterialPoint& point = heightMaterials[row * numColumns + col];
                 point.m_height = height - worldCenterZ;
-                point.m_quadMeshType = terrainExists ? Physics::QuadMeshType::SubdivideUpperLeftToBottomRight : Physics::QuadMeshType::Hole;
-                heightMaterials.emplace_back(point);
+                point.m_quadMeshType =
+                    terrainExists ? Physics::QuadMeshType::SubdivideUpperLeftToBottomRight : Physics::QuadMeshType::Hole;
             }
         }
     }
@@ -318,4 +362,52 @@ namespace Terrain
 
         return heightMaterials;
     }
+
+    void TerrainPhysicsColliderComponent::GetHeightfieldIndicesFromRegion(
+        const AZ::Aabb& region, size_t& startColumn, size_t& startRow, size_t& numColumns, size_t& numRows) const
+    {
+        startColumn = 0;
+        startRow = 0;
+        numColumns = 0;
+        numRows = 0;
+
+        int32_t gridWidth, gridHeight;
+        GetHeightfieldGridSize(gridWidth, gridHeight);
+        if (!region.IsValid() || gridWidth <= 0 || gridHeight <= 0)
+        {
+            return;
+        }
+
+        const AZ::Vector2 gridResolution = GetHeightfieldGridSpacing();
+        const AZ::Vector2 heightfieldMin = AZ::Vector2(GetHeightfieldAabb().GetMin());
+
+        // Sample (col, row) is located at heightfieldMin + (col, row) * gridResolution. Widen the region to the enclosing grid lines
+        // so that every quad touching the region gets refreshed, and clamp it to the grid.
+        const AZ::Vector2 regionMin = (AZ::Vector2(region.GetMin()) - heightfieldMin) / gridResolution;
+        const AZ::Vector2 regionMax = (AZ::Vector2(region.GetMax()) - heightfieldMin) / gridResolution;
+
+        const float firstColumn = AZ::GetClamp(floorf(regionMin.GetX()), 0.0f, aznumeric_cast<float>(gridWidth));
+        const float firstRow = AZ::GetClamp(floorf(regionMin.GetY()), 0.0f, aznumeric_cast<float>(gridHeight));
+        const float lastColumn = AZ::GetClamp(ceilf(regionMax.GetX()), -1.0f, aznumeric_cast<float>(gridWidth - 1));
+        const float lastRow = AZ::GetClamp(ceilf(regionMax.GetY()), -1.0f, aznumeric_cast<float>(gridHeight - 1));
+
+        if (lastColumn < firstColumn || lastRow < firstRow)
+        {
+            return;
+        }
+
+        startColumn = aznumeric_cast<size_t>(firstColumn);
+        startRow = aznumeric_cast<size_t>(firstRow);
+        numColumns = aznumeric_cast<size_t>(lastColumn - firstColumn) + 1;
+        numRows = aznumeric_cast<size_t>(lastRow - firstRow) + 1;
+    }
+
+    AZStd::vector<Physics::HeightMaterialPoint> TerrainPhysicsColliderComponent::GetHeightsAndMaterialsInRegion(
+        size_t startColumn, size_t startRow, size_t numColumns, size_t numRows) const
+    {
+        AZStd::vector<Physics::HeightMaterialPoint> heightMaterials;
+        GenerateHeightsAndMaterialsInRegion(startColumn, startRow, numColumns, numRows, heightMaterials);
+
+        return heightMaterials;
+    }
 }
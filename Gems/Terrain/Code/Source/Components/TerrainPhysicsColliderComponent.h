@@ -9,6 +9,7 @@
 #pragma once
 
 #include <AzCore/Component/Component.h>
+#include <AzCore/Component/TickBus.h>
 
 #include <AzFramework/Physics/HeightfieldProviderBus.h>
 #include <AzFramework/Physics/Material.h>
@@ -40,6 +41,7 @@ namespace Terrain
         , public Physics::HeightfieldProviderRequestsBus::Handler
         , protected LmbrCentral::ShapeComponentNotificationsBus::Handler
         , protected AzFramework::Terrain::TerrainDataNotificationBus::Handler
+        , private AZ::TickBus::Handler
     {
     public:
         template<typename, typename>
@@ -64,6 +66,10 @@ namespace Terrain
         AZStd::vector<Physics::MaterialId> GetMaterialList() const override;
         AZStd::vector<float> GetHeights() const override;
         AZStd::vector<Physics::HeightMaterialPoint> GetHeightsAndMaterials() const override;
+        void GetHeightfieldIndicesFromRegion(
+            const AZ::Aabb& region, size_t& startColumn, size_t& startRow, size_t& numColumns, size_t& numRows) const override;
+        AZStd::vector<Physics::HeightMaterialPoint> GetHeightsAndMaterialsInRegion(
+            size_t startColumn, size_t startRow, size_t numColumns, size_t numRows) const override;
 
     protected:
         //////////////////////////////////////////////////////////////////////////
@@ -75,8 +81,12 @@ namespace Terrain
 
         void GenerateHeightsInBounds(AZStd::vector<float>& heights) const;
         void GenerateHeightsAndMaterialsInBounds(AZStd::vector<Physics::HeightMaterialPoint>& heightMaterials) const;
+        void GenerateHeightsAndMaterialsInRegion(
+            size_t startColumn, size_t startRow, size_t numColumns, size_t numRows,
+            AZStd::vector<Physics::HeightMaterialPoint>& heightMaterials) const;
 
         void NotifyListenersOfHeightfieldDataChange();
+        void NotifyListenersOfHeightfieldDataChange(const AZ::Aabb& dirtyRegion);
 
         // ShapeComponentNotificationsBus
         void OnShapeChanged(ShapeChangeReasons changeReason) override;
@@ -85,7 +95,15 @@ namespace Terrain
         void OnTerrainDataDestroyBegin() override;
         void OnTerrainDataChanged(const AZ::Aabb& dirtyRegion, TerrainDataChangedMask dataChangedMask) override;
 
+        // TickBus
+        void OnTick(float deltaTime, AZ::ScriptTimePoint time) override;
+
     private:
         TerrainPhysicsColliderConfig m_configuration;
+
+        //! Union of the terrain regions that changed since the listeners were last notified.
+        //! Terrain changes are coalesced and forwarded once per tick, so that editor painting or runtime deformation
+        //! only refreshes the modified part of the heightfield, outside of the terrain system's change notification.
+        AZ::Aabb m_dirtyRegion = AZ::Aabb::CreateNull();
     };
 }
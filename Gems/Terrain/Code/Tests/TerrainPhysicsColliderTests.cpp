@@ -27,6 +27,7 @@ using ::testing::NiceMock;
 using ::testing::AtLeast;
 using ::testing::_;
 using ::testing::Return;
+using ::testing::Invoke;
 
 class TerrainPhysicsColliderComponentTest
     : public ::testing::Test
@@ -290,3 +291,111 @@ TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderReturnsRelativ
 
     m_entity->Reset();
 }
+
+TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderReturnsRegionIndicesCorrectly)
+{
+    // Check that a dirty region is converted to the rectangle of heightfield samples it affects.
+    CreateEntity();
+
+    AddTerrainPhysicsColliderAndShapeComponentToEntity();
+
+    m_entity->Activate();
+
+    NiceMock<UnitTest::MockShapeComponentRequests> boxShape(m_entity->GetId());
+    const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(256.0f));
+    ON_CALL(boxShape, GetEncompassingAabb).WillByDefault(Return(bounds));
+
+    NiceMock<UnitTest::MockTerrainDataRequests> terrainListener;
+    ON_CALL(terrainListener, GetTerrainHeightQueryResolution).WillByDefault(Return(AZ::Vector2(1.0f)));
+
+    size_t startColumn, startRow, numColumns, numRows;
+
+    // The region is widened to the enclosing grid lines.
+    const AZ::Aabb region = AZ::Aabb::CreateFromMinMax(AZ::Vector3(10.5f, 20.2f, 0.0f), AZ::Vector3(12.5f, 30.0f, 10.0f));
+    Physics::HeightfieldProviderRequestsBus::Event(
+        m_entity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion, region, startColumn,
+        startRow, numColumns, numRows);
+    EXPECT_EQ(startColumn, 10);
+    EXPECT_EQ(startRow, 20);
+    EXPECT_EQ(numColumns, 4);
+    EXPECT_EQ(numRows, 11);
+
+    // The region is clamped to the heightfield.
+    const AZ::Aabb overlappingRegion = AZ::Aabb::CreateFromMinMax(AZ::Vector3(-50.0f, 250.0f, 0.0f), AZ::Vector3(2.0f, 500.0f, 10.0f));
+    Physics::HeightfieldProviderRequestsBus::Event(
+        m_entity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion, overlappingRegion,
+        startColumn, startRow, numColumns, numRows);
+    EXPECT_EQ(startColumn, 0);
+    EXPECT_EQ(startRow, 250);
+    EXPECT_EQ(numColumns, 3);
+    EXPECT_EQ(numRows, 6);
+
+    // A region outside of the heightfield doesn't affect any samples.
+    const AZ::Aabb outsideRegion = AZ::Aabb::CreateFromMinMax(AZ::Vector3(300.0f, 300.0f, 0.0f), AZ::Vector3(310.0f, 310.0f, 10.0f));
+    Physics::HeightfieldProviderRequestsBus::Event(
+        m_entity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldIndicesFromRegion, outsideRegion,
+        startColumn, startRow, numColumns, numRows);
+    EXPECT_EQ(numColumns, 0);
+    EXPECT_EQ(numRows, 0);
+
+    m_entity.reset();
+}
+
+TEST_F(TerrainPhysicsColliderComponentTest, TerrainPhysicsColliderRegionSamplesMatchFullHeightfield)
+{
+    // Check that the samples returned for a region match the same samples of the full heightfield.
+    CreateEntity();
+
+    AddTerrainPhysicsColliderAndShapeComponentToEntity();
+
+    m_entity->Activate();
+
+    NiceMock<UnitTest::MockShapeComponentRequests> boxShape(m_entity->GetId());
+    const AZ::Aabb bounds = AZ::Aabb::CreateFromMinMax(AZ::Vector3(0.0f), AZ::Vector3(64.0f, 64.0f, 256.0f));
+    ON_CALL(boxShape, GetEncompassingAabb).WillByDefault(Return(bounds));
+
+    NiceMock<UnitTest::MockTerrainDataRequests> terrainListener;
+    ON_CALL(terrainListener, GetTerrainHeightQueryResolution).WillByDefault(Return(AZ::Vector2(1.0f)));
+    ON_CALL(terrainListener, GetHeightFromFloats)
+        .WillByDefault(Invoke(
+            [](float x, float y, [[maybe_unused]] AzFramework::Terrain::TerrainDataRequests::Sampler sampler, bool* terrainExists)
+            {
+                if (terrainExists)
+                {
+                    *terrainExists = true;
+                }
+                return x + 2.0f * y;
+            }));
+
+    AZStd::vector<Physics::HeightMaterialPoint> heightMaterials;
+    Physics::HeightfieldProviderRequestsBus::EventResult(
+        heightMaterials, m_entity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightsAndMaterials);
+
+    int32_t cols, rows;
+    Physics::HeightfieldProviderRequestsBus::Event(
+        m_entity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightfieldGridSize, cols, rows);
+    ASSERT_EQ(heightMaterials.size(), cols * rows);
+
+    const size_t startColumn = 5;
+    const size_t startRow = 7;
+    const size_t numColumns = 10;
+    const size_t numRows = 3;
+    AZStd::vector<Physics::HeightMaterialPoint> regionHeightMaterials;
+    Physics::HeightfieldProviderRequestsBus::EventResult(
+        regionHeightMaterials, m_entity->GetId(), &Physics::HeightfieldProviderRequestsBus::Events::GetHeightsAndMaterialsInRegion,
+        startColumn, startRow, numColumns, numRows);
+    ASSERT_EQ(regionHeightMaterials.size(), numColumns * numRows);
+
+    for (size_t row = 0; row < numRows; row++)
+    {
+        for (size_t col = 0; col < numColumns; col++)
+        {
+            const Physics::HeightMaterialPoint& expected = heightMaterials[(startRow + row) * cols + startColumn + col];
+            const Physics::HeightMaterialPoint& actual = regionHeightMaterials[row * numColumns + col];
+            EXPECT_NEAR(actual.m_height, expected.m_height, 0.01f);
+            EXPECT_EQ(actual.m_quadMeshType, expected.m_quadMeshType);
+        }
+    }
+
+    m_entity.reset();
+}
@@ -12,6 +12,7 @@
 #include <AzCore/EBus/EBus.h>
 #include <AzCore/Math/Vector3.h>
 #include <AzCore/Component/ComponentBus.h>
+#include <AzCore/std/parallel/atomic.h>
 
 namespace Vegetation
 {
@@ -19,6 +20,22 @@ namespace Vegetation
     {
         AZStd::atomic_int m_areaTaskQueueCount{ 0 };
         AZStd::atomic_int m_areaTaskActiveCount{ 0 };
+
+        //! Sectors waiting to be created or updated by the vegetation thread.
+        AZStd::atomic_int m_sectorUpdateQueueCount{ 0 };
+        //! Time from a sector being queued for an update until it was filled, in microseconds.
+        AZStd::atomic<AZ::s64> m_sectorLatencyLastUs{ 0 };
+        AZStd::atomic<AZ::s64> m_sectorLatencyMaxUs{ 0 };
+        AZStd::atomic<AZ::s64> m_sectorLatencyTotalUs{ 0 };
+        AZStd::atomic<AZ::u64> m_sectorUpdateCount{ 0 };
+
+        void ResetSectorLatency()
+        {
+            m_sectorLatencyLastUs.store(0, AZStd::memory_order_relaxed);
+            m_sectorLatencyMaxUs.store(0, AZStd::memory_order_relaxed);
+            m_sectorLatencyTotalUs.store(0, AZStd::memory_order_relaxed);
+            m_sectorUpdateCount.store(0, AZStd::memory_order_relaxed);
+        }
     };
 
     class DebugSystemData
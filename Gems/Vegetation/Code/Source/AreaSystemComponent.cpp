@@ -22,6 +22,7 @@
 #include <AzCore/RTTI/BehaviorContext.h>
 #include <AzCore/Serialization/EditContext.h>
 #include <AzCore/Serialization/SerializeContext.h>
+#include <AzCore/Jobs/JobCompletion.h>
 #include <AzCore/Jobs/JobFunction.h>
 #include <AzCore/std/chrono/chrono.h>
 #include <AzCore/std/sort.h>
@@ -56,6 +57,10 @@ namespace Vegetation
             }
             return true;
         }
+
+        //! Set while the current thread fills a sector, so that instance queries made by its areas see the other sectors
+        //! that are being filled at the same time.
+        static thread_local bool s_fillingSector = false;
     }
 
     //////////////////////////////////////////////////////////////////////////
@@ -143,6 +148,7 @@ namespace Vegetation
                 ->Field("ThreadProcessingIntervalMs", &AreaSystemConfig::m_threadProcessingIntervalMs)
                 ->Field("SectorSearchPadding", &AreaSystemConfig::m_sectorSearchPadding)
                 ->Field("SectorPointSnapMode", &AreaSystemConfig::m_sectorPointSnapMode)
+                ->Field("ParallelSectorCount", &AreaSystemConfig::m_parallelSectorCount)
             ;
 
             AZ::EditContext* edit = serialize->GetEditContext();
@@ -173,6 +179,9 @@ namespace Vegetation
                     ->DataElement(AZ::Edit::UIHandlers::ComboBox, &AreaSystemConfig::m_sectorPointSnapMode, "Sector Point Snap Mode", "Controls whether vegetation placement points are located at the corner or the center of the cell.")
                     ->EnumAttribute(SnapMode::Corner, "Corner")
                     ->EnumAttribute(SnapMode::Center, "Center")
+                    ->DataElement(AZ::Edit::UIHandlers::Default, &AreaSystemConfig::m_parallelSectorCount, "Parallel Sector Count", "The number of sectors that are gathered and filled at the same time on the job system.  Areas still claim points for one sector at a time.")
+                    ->Attribute(AZ::Edit::Attributes::Min, 1)
+                    ->Attribute(AZ::Edit::Attributes::Max, 32)
                 ;
             }
         }
@@ -189,6 +198,7 @@ namespace Vegetation
                 ->Property("sectorPointSnapMode",
                 [](AreaSystemConfig* config) { return static_cast<AZ::u8>(config->m_sectorPointSnapMode); },
                 [](AreaSystemConfig* config, const AZ::u8& i) { config->m_sectorPointSnapMode = static_cast<SnapMode>(i); })
+                ->Property("parallelSectorCount", BehaviorValueProperty(&AreaSystemConfig::m_parallelSectorCount))
             ;
         }
     }
@@ -664,10 +674,10 @@ namespace Vegetation
         {
             for (int currX = minX; currX <= maxX; ++currX)
             {
-                const SectorInfo* sectorInfo = m_vegTasks.GetSector(SectorId(currX, currY));
-                if (sectorInfo) // manual sector id's can be outside the active area
+                const ClaimContainer* claims = m_vegTasks.GetSectorClaims(SectorId(currX, currY));
+                if (claims) // manual sector id's can be outside the active area
                 {
-                    for (const auto& claimPair : sectorInfo->m_claimedWorldPoints)
+                    for (const auto& claimPair : *claims)
                     {
                         const auto& instanceData = claimPair.second;
                         if (bounds.Contains(instanceData.m_position))
@@ -778,6 +788,7 @@ namespace Vegetation
                     m_cachedMainThreadData.m_sectorSizeInMeters = m_configuration.m_sectorSizeInMeters;
                     m_cachedMainThreadData.m_sectorDensity = m_configuration.m_sectorDensity;
                     m_cachedMainThreadData.m_sectorPointSnapMode = m_configuration.m_sectorPointSnapMode;
+                    m_cachedMainThreadData.m_parallelSectorCount = m_configuration.m_parallelSectorCount;
                 }
 
                 // Set the state to Dirty to signal the thread that it will need to pull a new copy of the main thread state data
@@ -1072,22 +1083,37 @@ namespace Vegetation
         return itSector != m_sectorRollingWindow.end() ? &itSector->second : nullptr;
     }
 
-    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
+    const AreaSystemComponent::ClaimContainer* AreaSystemComponent::VegetationThreadTasks::GetSectorClaims(const SectorId& sectorId) const
     {
         AZ_PROFILE_FUNCTION(Entity);
 
-        SectorInfo sectorInfo;
-        sectorInfo.m_id = sectorId;
-        sectorInfo.m_bounds = GetSectorBounds(sectorId, sectorSizeInMeters);
-        UpdateSectorPoints(sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
+        if (AreaSystemUtil::s_fillingSector)
+        {
+            auto itSector = m_sectorsBeingFilled.find(sectorId);
+            if (itSector != m_sectorsBeingFilled.end())
+            {
+                return &itSector->second->m_claimedWorldPoints;
+            }
+        }
+
+        const SectorInfo* sectorInfo = GetSector(sectorId);
+        return sectorInfo ? &sectorInfo->m_claimedWorldPoints : nullptr;
+    }
+
+    AreaSystemComponent::SectorInfo* AreaSystemComponent::VegetationThreadTasks::CommitSector(SectorInfo&& sectorInfo)
+    {
+        AZ_PROFILE_FUNCTION(Entity);
 
         AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
         SectorInfo& sectorInfoRef = m_sectorRollingWindow[sectorInfo.m_id] = AZStd::move(sectorInfo);
-        UpdateSectorCallbacks(sectorInfoRef);
+        // the callbacks only refer to the sector while it's being filled
+        sectorInfoRef.m_baseContext.m_existedCallback = nullptr;
+        sectorInfoRef.m_baseContext.m_createdCallback = nullptr;
         return &sectorInfoRef;
     }
 
-    void AreaSystemComponent::VegetationThreadTasks::UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode)
+    void AreaSystemComponent::VegetationThreadTasks::UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode,
+        SurfaceData::SurfacePointBuffer& surfacePoints)
     {
         AZ_PROFILE_FUNCTION(Entity);
         const float vegStep = sectorSizeInMeters / static_cast<float>(sectorDensity);
@@ -1095,13 +1121,11 @@ namespace Vegetation
         //build a free list of all points in the sector for areas to consume
         sectorInfo.m_baseContext.m_masks.clear();
         sectorInfo.m_baseContext.m_availablePoints.clear();
-        sectorInfo.m_baseContext.m_availablePoints.reserve(sectorDensity * sectorDensity);
 
         // Determine within our texel area where we want to create our vegetation positions:
         // 0 = lower left corner, 0.5 = center
         const float texelOffset = (sectorPointSnapMode == SnapMode::Center) ? 0.5f : 0.0f;
 
-        SurfaceData::SurfacePointListPerPosition availablePointsPerPosition;
         AZ::Vector2 stepSize(vegStep, vegStep);
         AZ::Vector3 regionOffset(texelOffset * vegStep, texelOffset * vegStep, 0.0f);
         AZ::Aabb regionBounds = sectorInfo.m_bounds;
@@ -1115,30 +1139,32 @@ namespace Vegetation
         regionBounds.SetMax(regionBounds.GetMin() + AZ::Vector3(vegStep * (sectorDensity - 0.5f),
             vegStep * (sectorDensity - 0.5f), 0.0f));
 
+        surfacePoints.Clear();
         SurfaceData::SurfaceDataSystemRequestBus::Broadcast(
-            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointsFromRegion,
+            &SurfaceData::SurfaceDataSystemRequestBus::Events::GetSurfacePointBufferFromRegion,
             regionBounds,
             stepSize,
             SurfaceData::SurfaceTagVector(),
-            availablePointsPerPosition);
+            surfacePoints);
 
-        AZ_Assert(availablePointsPerPosition.size() == (sectorDensity * sectorDensity),
-            "Veg sector ended up with unexpected density (%d points created, %d expected)", availablePointsPerPosition.size(),
+        AZ_Assert(surfacePoints.GetInputPositionCount() == (sectorDensity * sectorDensity),
+            "Veg sector ended up with unexpected density (%d points created, %d expected)", surfacePoints.GetInputPositionCount(),
             (sectorDensity * sectorDensity));
 
+        // The buffer holds the points of each input position contiguously and in order, so they can be walked in a single pass.
+        const size_t pointCount = surfacePoints.GetPointCount();
+        sectorInfo.m_baseContext.m_availablePoints.reserve(pointCount);
+
         uint claimIndex = 0;
-        for (auto& availablePoints : availablePointsPerPosition)
-        {
-            for (auto& surfacePoint : availablePoints.second)
-            {
-                sectorInfo.m_baseContext.m_availablePoints.push_back();
-                ClaimPoint& claimPoint = sectorInfo.m_baseContext.m_availablePoints.back();
-                claimPoint.m_handle = CreateClaimHandle(sectorInfo, ++claimIndex);
-                claimPoint.m_position = surfacePoint.m_position;
-                claimPoint.m_normal = surfacePoint.m_normal;
-                claimPoint.m_masks = surfacePoint.m_masks;
-                SurfaceData::AddMaxValueForMasks(sectorInfo.m_baseContext.m_masks, surfacePoint.m_masks);
-            }
+        for (size_t pointIndex = 0; pointIndex < pointCount; ++pointIndex)
+        {
+            sectorInfo.m_baseContext.m_availablePoints.push_back();
+            ClaimPoint& claimPoint = sectorInfo.m_baseContext.m_availablePoints.back();
+            claimPoint.m_handle = CreateClaimHandle(sectorInfo, ++claimIndex);
+            claimPoint.m_position = surfacePoints.GetPosition(pointIndex);
+            claimPoint.m_normal = surfacePoints.GetNormal(pointIndex);
+            claimPoint.m_masks = surfacePoints.GetMasks(pointIndex);
+            SurfaceData::AddMaxValueForMasks(sectorInfo.m_baseContext.m_masks, claimPoint.m_masks);
         }
     }
 
@@ -1293,6 +1319,7 @@ namespace Vegetation
         sectorInfo.m_claimedWorldPointsBeforeFill.clear();
 
         // Iterate over the claims by area id and release them
+        AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
         for (const auto& claimPair : claimsToRelease)
         {
             const auto& areaId = claimPair.first;
@@ -1313,14 +1340,19 @@ namespace Vegetation
         AZ_PROFILE_FUNCTION(Entity);
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillSectorStart, sectorInfo.GetSectorX(), sectorInfo.GetSectorY(), AZStd::chrono::system_clock::now()));
 
-        ReleaseUnregisteredClaims(sectorInfo);
+        AreaSystemUtil::s_fillingSector = true;
+        UpdateSectorCallbacks(sectorInfo);
 
         //m_availablePoints is a free list initialized with the complete set of points in the sector.
         ClaimContext activeContext = sectorInfo.m_baseContext;
 
-        // Clear out the list of claimed world points before we begin
-        sectorInfo.m_claimedWorldPointsBeforeFill = sectorInfo.m_claimedWorldPoints;
-        sectorInfo.m_claimedWorldPoints.clear();
+        // Clear out the list of claimed world points before we begin.  The claims of a sector that's being filled are only changed
+        // under the rolling window lock, because the areas filling other sectors can look at them.
+        {
+            AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
+            sectorInfo.m_claimedWorldPointsBeforeFill = AZStd::move(sectorInfo.m_claimedWorldPoints);
+            sectorInfo.m_claimedWorldPoints.clear();
+        }
 
         //for all active areas attempt to spawn vegetation on sector grid positions
         for (const auto& area : activeAreas)
@@ -1337,15 +1369,21 @@ namespace Vegetation
                 VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillAreaStart, area.m_id, AZStd::chrono::system_clock::now()));
 
                 //each area is responsible for removing whatever points it claims from m_availablePoints, so subsequent areas will have fewer points to try to claim.
-                AreaNotificationBus::Event(area.m_id, &AreaNotificationBus::Events::OnAreaConnect);
-                AreaRequestBus::Event(area.m_id, &AreaRequestBus::Events::ClaimPositions, EntityIdStack{}, activeContext);
-                AreaNotificationBus::Event(area.m_id, &AreaNotificationBus::Events::OnAreaDisconnect);
+                //areas are only connected around each claim and keep scratch state of their own, so sectors that are filled at the
+                //same time take turns claiming.  This is also the lock that the claims of the sector are written under.
+                {
+                    AZStd::lock_guard<decltype(m_sectorRollingWindowMutex)> lock(m_sectorRollingWindowMutex);
+                    AreaNotificationBus::Event(area.m_id, &AreaNotificationBus::Events::OnAreaConnect);
+                    AreaRequestBus::Event(area.m_id, &AreaRequestBus::Events::ClaimPositions, EntityIdStack{}, activeContext);
+                    AreaNotificationBus::Event(area.m_id, &AreaNotificationBus::Events::OnAreaDisconnect);
+                }
 
                 VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillAreaEnd, area.m_id, AZStd::chrono::system_clock::now(), aznumeric_cast<AZ::u32>(activeContext.m_availablePoints.size())));
             }
         }
 
         ReleaseUnusedClaims(sectorInfo);
+        AreaSystemUtil::s_fillingSector = false;
 
         VEG_PROFILE_METHOD(DebugNotificationBus::TryQueueBroadcast(&DebugNotificationBus::Events::FillSectorEnd, sectorInfo.GetSectorX(), sectorInfo.GetSectorY(), AZStd::chrono::system_clock::now(), aznumeric_cast<AZ::u32>(activeContext.m_availablePoints.size())));
     }
@@ -1494,7 +1532,7 @@ namespace Vegetation
 
             if (keepProcessing)
             {
-                keepProcessing = UpdateOneSector(threadData, vegTasks);
+                keepProcessing = UpdateNextSectors(threadData, vegTasks);
             }
         }
     }
@@ -1597,6 +1635,10 @@ namespace Vegetation
                 m_updateWorkList.end(),
                 [currViewRect](const auto& entry) {return !currViewRect.IsInside(entry.first); }),
             m_updateWorkList.end());
+        for (auto requestTime = m_updateRequestTimes.begin(); requestTime != m_updateRequestTimes.end();)
+        {
+            requestTime = currViewRect.IsInside(requestTime->first) ? AZStd::next(requestTime) : m_updateRequestTimes.erase(requestTime);
+        }
         AZ_Assert(m_updateWorkList.size() <= m_viewRectSectorCount, "Refreshed RequestedUpdate list should not be larger than the view rectangle.");
 
         // Clear our delete work list, we'll recreate it and sort it again below.
@@ -1609,8 +1651,11 @@ namespace Vegetation
         if (deleteAllSectors)
         {
             m_updateWorkList.clear();
+            m_updateRequestTimes.clear();
         }
 
+        const auto requestTime = AZStd::chrono::system_clock::now();
+
         // Run through our list of active sectors and determine which ones need adding / updating / deleting
         {
             AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
@@ -1641,6 +1686,7 @@ namespace Vegetation
                             else
                             {
                                 m_updateWorkList.emplace_back(sectorId, UpdateMode::Create);
+                                m_updateRequestTimes.emplace(sectorId, requestTime);
                             }
 
                             // Since we've already removed entries that aren't in the view rect, and these loops are only
@@ -1678,6 +1724,7 @@ namespace Vegetation
                     else
                     {
                         m_updateWorkList.emplace_back(sectorId, UpdateMode::RebuildSurfaceCacheAndFill);
+                        m_updateRequestTimes.emplace(sectorId, requestTime);
                     }
 
                     // We shouldn't ever have an update list that's larger than the set of sectors in the view rect.
@@ -1694,6 +1741,7 @@ namespace Vegetation
                         // overwrite existing entries because an existing entry might have previously
                         // requested "RebuildSurfaceCacheAndFill", which is more comprehensive than this request.
                         m_updateWorkList.emplace_back(sectorId, UpdateMode::Fill);
+                        m_updateRequestTimes.emplace(sectorId, requestTime);
 
                         // We shouldn't ever have an update list that's larger than the set of sectors in the view rect.
                         AZ_Assert(m_updateWorkList.size() <= m_viewRectSectorCount, "Too many update requests added");
@@ -1756,10 +1804,42 @@ namespace Vegetation
             });
         }
 
+        if (DebugData* debugData = vegTasks->GetDebugData())
+        {
+            debugData->m_sectorUpdateQueueCount.store(static_cast<int>(m_updateWorkList.size()), AZStd::memory_order_relaxed);
+        }
+
         return !m_deleteWorkList.empty() || !m_updateWorkList.empty();
     }
 
-    bool AreaSystemComponent::UpdateContext::UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
+    void AreaSystemComponent::UpdateContext::ReportSectorLatency(VegetationThreadTasks* vegTasks, const SectorId& sectorId)
+    {
+        auto requestTime = m_updateRequestTimes.find(sectorId);
+        if (requestTime == m_updateRequestTimes.end())
+        {
+            return;
+        }
+
+        DebugData* debugData = vegTasks->GetDebugData();
+        if (debugData)
+        {
+            const AZ::s64 latencyUs = AZStd::chrono::microseconds(AZStd::chrono::system_clock::now() - requestTime->second).count();
+            debugData->m_sectorUpdateCount.fetch_add(1, AZStd::memory_order_relaxed);
+            debugData->m_sectorLatencyLastUs.store(latencyUs, AZStd::memory_order_relaxed);
+            debugData->m_sectorLatencyTotalUs.fetch_add(latencyUs, AZStd::memory_order_relaxed);
+
+            AZ::s64 maxLatencyUs = debugData->m_sectorLatencyMaxUs.load(AZStd::memory_order_relaxed);
+            while (latencyUs > maxLatencyUs && !debugData->m_sectorLatencyMaxUs.compare_exchange_weak(maxLatencyUs, latencyUs, AZStd::memory_order_relaxed))
+            {
+            }
+
+            debugData->m_sectorUpdateQueueCount.store(static_cast<int>(m_updateWorkList.size()), AZStd::memory_order_relaxed);
+        }
+
+        m_updateRequestTimes.erase(requestTime);
+    }
+
+    bool AreaSystemComponent::UpdateContext::UpdateNextSectors(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks)
     {
         AZ_PROFILE_FUNCTION(Entity);
 
@@ -1784,45 +1864,93 @@ namespace Vegetation
         // Create / update if there's anything to do and we didn't prioritize a delete.
         if (!m_updateWorkList.empty())
         {
-            auto& updateEntry = m_updateWorkList.back();
-            SectorId sectorId = updateEntry.first;
-            UpdateMode mode = updateEntry.second;
-            m_updateWorkList.pop_back();
+            auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
+            auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
+            auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
 
+            // Take the closest sectors off of the work list and give each one its own copy of its sector, so that they can be
+            // gathered and filled in parallel.  The rolling window keeps the current claims until the updates are merged.
+            const size_t batchSize = AZStd::min(static_cast<size_t>(AZStd::max(m_cachedMainThreadData.m_parallelSectorCount, 1)), m_updateWorkList.size());
+            m_sectorUpdates.resize(batchSize);
             {
                 AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
 
-                auto& sectorDensity = m_cachedMainThreadData.m_sectorDensity;
-                auto& sectorSizeInMeters = m_cachedMainThreadData.m_sectorSizeInMeters;
-                auto& sectorPointSnapMode = m_cachedMainThreadData.m_sectorPointSnapMode;
-
-                switch (mode)
+                for (auto& update : m_sectorUpdates)
                 {
-                    case UpdateMode::RebuildSurfaceCacheAndFill:
+                    update.m_id = m_updateWorkList.back().first;
+                    update.m_mode = m_updateWorkList.back().second;
+                    m_updateWorkList.pop_back();
+
+                    SectorInfo& sector = update.m_sector;
+                    if (update.m_mode == UpdateMode::Create)
                     {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
-                        AZ_Assert(sectorInfo, "Sector update mode is 'RebuildSurfaceCache' but sector doesn't exist");
-                        vegTasks->UpdateSectorPoints(*sectorInfo, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+                        AZ_Assert(!vegTasks->GetSector(update.m_id), "Sector update mode is 'Create' but sector already exists");
+                        sector = SectorInfo();
+                        sector.m_id = update.m_id;
+                        sector.m_bounds = VegetationThreadTasks::GetSectorBounds(update.m_id, sectorSizeInMeters);
                     }
-                    break;
-
-                    case UpdateMode::Fill:
+                    else
                     {
-                        auto sectorInfo = vegTasks->GetSector(sectorId);
-                        AZ_Assert(sectorInfo, "Sector update mode is 'Fill' but sector doesn't exist");
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
+                        SectorInfo* sectorInfo = vegTasks->GetSector(update.m_id);
+                        AZ_Assert(sectorInfo, "Sector update mode is 'Fill' or 'RebuildSurfaceCache' but sector doesn't exist");
+                        sector.m_id = sectorInfo->m_id;
+                        sector.m_bounds = sectorInfo->m_bounds;
+                        sector.m_claimedWorldPoints = sectorInfo->m_claimedWorldPoints;
+                        if (update.m_mode == UpdateMode::Fill)
+                        {
+                            // nothing reads the points of a sector in the rolling window, they're handed back when the update is merged
+                            sector.m_baseContext = AZStd::move(sectorInfo->m_baseContext);
+                        }
                     }
-                    break;
 
-                    case UpdateMode::Create:
+                    vegTasks->ReleaseUnregisteredClaims(sector);
+                    vegTasks->m_sectorsBeingFilled[update.m_id] = &sector;
+                }
+            }
+
+            const VegetationAreaVector& activeAreas = threadData->m_activeAreasInBubble;
+            auto updateSector = [vegTasks, &activeAreas, sectorDensity, sectorSizeInMeters, sectorPointSnapMode](SectorUpdate& update)
+            {
+                if (update.m_mode != UpdateMode::Fill)
+                {
+                    vegTasks->UpdateSectorPoints(update.m_sector, sectorDensity, sectorSizeInMeters, sectorPointSnapMode, update.m_surfacePoints);
+                }
+                vegTasks->FillSector(update.m_sector, activeAreas);
+            };
+
+            if (m_sectorUpdates.size() == 1)
+            {
+                updateSector(m_sectorUpdates.front());
+            }
+            else
+            {
+                AZ::JobCompletion jobCompletion;
+                for (auto& update : m_sectorUpdates)
+                {
+                    auto job = AZ::CreateJobFunction([&updateSector, &update]()
                     {
-                        AZ_Assert(!vegTasks->GetSector(sectorId), "Sector update mode is 'Create' but sector already exists");
-                        auto sectorInfo = vegTasks->CreateSector(sectorId, sectorDensity, sectorSizeInMeters, sectorPointSnapMode);
-                        vegTasks->FillSector(*sectorInfo, threadData->m_activeAreasInBubble);
-                    }
-                    break;
+                        updateSector(update);
+                    }, true);
+                    job->SetDependent(&jobCompletion);
+                    job->Start();
                 }
+                jobCompletion.StartAndWaitForCompletion();
+            }
+
+            // Merge the updated sectors and their claims into the rolling window.
+            {
+                AZStd::lock_guard<decltype(vegTasks->m_sectorRollingWindowMutex)> lock(vegTasks->m_sectorRollingWindowMutex);
+
+                vegTasks->m_sectorsBeingFilled.clear();
+                for (auto& update : m_sectorUpdates)
+                {
+                    vegTasks->CommitSector(AZStd::move(update.m_sector));
+                }
+            }
+
+            for (const auto& update : m_sectorUpdates)
+            {
+                ReportSectorLatency(vegTasks, update.m_id);
             }
 
             return true;
@@ -15,6 +15,7 @@
 #include <AzCore/std/parallel/semaphore.h>
 #include <AzCore/Component/TickBus.h>
 #include <AzCore/std/parallel/thread.h>
+#include <AzCore/std/chrono/chrono.h>
 #include <GradientSignal/Ebuses/SectorDataRequestBus.h>
 #include <SurfaceData/SurfaceDataSystemNotificationBus.h>
 #include <CrySystemBus.h>
@@ -50,7 +51,8 @@ namespace Vegetation
                    && m_sectorSizeInMeters == other.m_sectorSizeInMeters
                    && m_threadProcessingIntervalMs == other.m_threadProcessingIntervalMs
                    && m_sectorSearchPadding == other.m_sectorSearchPadding
-                   && m_sectorPointSnapMode == other.m_sectorPointSnapMode;
+                   && m_sectorPointSnapMode == other.m_sectorPointSnapMode
+                   && m_parallelSectorCount == other.m_parallelSectorCount;
         }
 
         int m_viewRectangleSize = 13;
@@ -59,6 +61,7 @@ namespace Vegetation
         int m_threadProcessingIntervalMs = 500;
         int m_sectorSearchPadding = 0;
         SnapMode m_sectorPointSnapMode = SnapMode::Corner;
+        int m_parallelSectorCount = 4;
     private:
         static const int s_maxViewRectangleSize;
         static const int s_maxSectorDensity;
@@ -272,6 +275,7 @@ namespace Vegetation
             int m_sectorSizeInMeters = 0;
             int m_sectorDensity = 0;
             SnapMode m_sectorPointSnapMode = SnapMode::Corner;
+            int m_parallelSectorCount = 1;
         };
 
         // VegetationThreadTasks is the task queue that's used equally by the main thread and the vegetation thread.
@@ -292,9 +296,20 @@ namespace Vegetation
             const SectorInfo* GetSector(const SectorId& sectorId) const;
             SectorInfo* GetSector(const SectorId& sectorId);
 
-            SectorInfo* CreateSector(const SectorId& sectorId, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
-            void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode);
+            //! Gets the claims of a sector that instance queries should see.  Sector fills see the claims of the sectors that
+            //! are being filled with them, so that areas can keep their distance from each other's instances.  Everyone else
+            //! sees the claims in the rolling window.
+            const ClaimContainer* GetSectorClaims(const SectorId& sectorId) const;
+
+            //! Moves a filled sector into the rolling window, replacing the sector with the same id if there is one.
+            SectorInfo* CommitSector(SectorInfo&& sectorInfo);
+            //! Gathers the surface points of a sector.  surfacePoints is scratch space, reused between calls to avoid allocations.
+            void UpdateSectorPoints(SectorInfo& sectorInfo, int sectorDensity, int sectorSizeInMeters, SnapMode sectorPointSnapMode,
+                SurfaceData::SurfacePointBuffer& surfacePoints);
+            //! Fills a sector that isn't in the rolling window.  Several sectors can be filled at once, their areas take
+            //! turns claiming points under the rolling window lock.
             void FillSector(SectorInfo& sectorInfo, const VegetationAreaVector& activeAreas);
+            void ReleaseUnregisteredClaims(SectorInfo& sectorInfo);
             void DeleteSector(const SectorId& sectorId);
             void ClearSectors();
 
@@ -302,6 +317,7 @@ namespace Vegetation
             static AZ::Aabb GetSectorBounds(const SectorId& sectorId, int sectorSizeInMeters);
 
             void FetchDebugData();
+            DebugData* GetDebugData() const { return m_debugData; }
 
             void MarkDirtySectors(const AZ::Aabb& bounds, DirtySectors& dirtySet, float worldToSector, const ViewRect& viewRect);
             void AddUnregisteredVegetationArea(const VegetationAreaInfo& area, float worldToSector, const ViewRect& viewRect);
@@ -311,13 +327,16 @@ namespace Vegetation
             mutable AZStd::recursive_mutex m_sectorRollingWindowMutex;
             SectorRollingWindow m_sectorRollingWindow;
 
+            //! The sectors that are being filled, outside of the rolling window.  This is only changed on the vegetation
+            //! thread while no sectors are being filled.
+            AZStd::unordered_map<SectorId, const SectorInfo*> m_sectorsBeingFilled;
+
         private:
             // claiming logic
             void CreateClaim(SectorInfo& sectorInfo, const ClaimHandle handle, const InstanceData& instanceData);
             ClaimHandle CreateClaimHandle(const SectorInfo& sectorInfo, uint32_t index) const;
 
             void ReleaseUnusedClaims(SectorInfo& sectorInfo);
-            void ReleaseUnregisteredClaims(SectorInfo& sectorInfo);
 
             //! Creates a new sector
             void UpdateSectorCallbacks(SectorInfo& sectorInfo);
@@ -430,7 +449,8 @@ namespace Vegetation
 
         private:
             bool UpdateSectorWorkLists(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
-            bool UpdateOneSector(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            bool UpdateNextSectors(PersistentThreadData* threadData, VegetationThreadTasks* vegTasks);
+            void ReportSectorLatency(VegetationThreadTasks* vegTasks, const SectorId& sectorId);
 
             enum class UpdateMode
             {
@@ -439,6 +459,20 @@ namespace Vegetation
                 Fill
             };
 
+            // A sector taken off of the update work list.  The sector is gathered and filled in m_sector, with its own copy
+            // of its claims, so that several sectors can be updated at once without writing to the rolling window.
+            struct SectorUpdate
+            {
+                SectorId m_id = {};
+                UpdateMode m_mode = UpdateMode::Fill;
+                SectorInfo m_sector;
+                // kept with the update so that its memory is reused by the next sector gathered in this slot
+                SurfaceData::SurfacePointBuffer m_surfacePoints;
+            };
+
+            // The sectors being updated in the current pass.
+            AZStd::vector<SectorUpdate> m_sectorUpdates;
+
             // The sorted work list of sectors to delete.  The list is recreated every time UpdateSectorWorkLists() is run.
             AZStd::vector<SectorId> m_deleteWorkList;
 
@@ -447,6 +481,9 @@ namespace Vegetation
             // be recalculated.
             AZStd::vector<AZStd::pair<SectorId, UpdateMode>> m_updateWorkList;
 
+            // When each sector in the update work list was first requested, used to report how long sectors wait to be filled.
+            AZStd::unordered_map<SectorId, AZStd::chrono::system_clock::time_point> m_updateRequestTimes;
+
             // Sector counts of the number of expected sectors in the view rectangle vs the number of sectors
             // currently active.  These are used to "load balance" sector deletes and creates so that we don't have
             // too many sectors active at any one point in time.
@@ -973,14 +973,23 @@ void DebugComponent::DrawDebugStats(AzFramework::DebugDisplayRequests& debugDisp
     AZ::u32 destroyTaskCount = 0;
     InstanceSystemStatsRequestBus::BroadcastResult(destroyTaskCount, &InstanceSystemStatsRequestBus::Events::GetDestroyTaskCount);
 
+    const AZ::u64 sectorUpdateCount = m_debugData->m_sectorUpdateCount.load(AZStd::memory_order_relaxed);
+    const double sectorLatencyAverageMs = sectorUpdateCount > 0
+        ? static_cast<double>(m_debugData->m_sectorLatencyTotalUs.load(AZStd::memory_order_relaxed)) / sectorUpdateCount / 1000.0
+        : 0.0;
+
     debugDisplay.SetColor(AZ::Color(1.0f));
     debugDisplay.Draw2dTextLabel(
         40.0f, 22.0f, 0.7f,
         AZStd::string::format(
             "VegetationSystemStats:\nActive Instances Count: %d\nInstance Register Queue: %d\nInstance Unregister Queue: %d\nThread "
-            "Queue Count: %d\nThread Processing Count: %d",
+            "Queue Count: %d\nThread Processing Count: %d\nSector Update Queue: %d\nSector Latency (ms) Last: %.2f Avg: %.2f Max: %.2f",
             instanceCount, createTaskCount, destroyTaskCount, m_debugData->m_areaTaskQueueCount.load(AZStd::memory_order_relaxed),
-            m_debugData->m_areaTaskActiveCount.load(AZStd::memory_order_relaxed))
+            m_debugData->m_areaTaskActiveCount.load(AZStd::memory_order_relaxed),
+            m_debugData->m_sectorUpdateQueueCount.load(AZStd::memory_order_relaxed),
+            static_cast<double>(m_debugData->m_sectorLatencyLastUs.load(AZStd::memory_order_relaxed)) / 1000.0,
+            sectorLatencyAverageMs,
+            static_cast<double>(m_debugData->m_sectorLatencyMaxUs.load(AZStd::memory_order_relaxed)) / 1000.0)
             .c_str(),
         false);
 }
@@ -1014,6 +1023,18 @@ namespace
     AZ_CONSOLEFREEFUNC(
         veg_debugClearAllAreas, AZ::ConsoleFunctorFlags::DontReplicate, "Clear and refresh all vegetation areas in the current view");
 
+    static void veg_debugResetSectorLatency([[maybe_unused]] const AZ::ConsoleCommandContainer& arguments)
+    {
+        DebugData* debugData = nullptr;
+        DebugSystemDataBus::BroadcastResult(debugData, &DebugSystemDataBus::Events::GetDebugData);
+        if (debugData)
+        {
+            debugData->ResetSectorLatency();
+        }
+    }
+    AZ_CONSOLEFREEFUNC(
+        veg_debugResetSectorLatency, AZ::ConsoleFunctorFlags::DontReplicate, "Resets the sector update latency shown in the vegetation stats");
+
 
     const char* GetSortTypeString(DebugRequests::SortType sortType)
     {